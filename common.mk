@@ -12,15 +12,21 @@ BRD	= DBC_BOARD
 CC      = arm-none-eabi-
 CFLAGS  += $(addprefix -I,$(DIRS)) -c -O3 -mcpu=arm926ej-s \
 	-ffunction-sections -fdata-sections -fno-builtin-function \
-	-MMD -MT$@ -Wall -Wformat=0 -DARM -DRAMSIZE$(RAMSIZE) -D$(BRD)
+	-MMD -MT$@ -Wall -Wformat=0 -DARM -DRAMSIZE$(RAMSIZE) -D$(BRD) \
+	-DASSET_ADDR=$(ASSET_ADDR)
 LFLAGS	+= -lm -Xlinker --gc-sections -Wl,-Map,$(NAME).map \
 	-Wl,--defsym=RAMSIZE=$(RAMSIZE) -T$(BASE)drv/
 FEL	= "$(BASE)tools\sunxi\sunxi-fel"
 MKSUNXI	= "$(BASE)tools\sunxi\mksunxi"
+LZ4PACK	= out/lz4pack.exe
+IMAGE	= $(if $(LZ4),$(NAME).lz4,$(NAME).bin)
+ASSETPACK = out/assetpack.exe
+ASSET_ADDR = 1048576
+ASSET_BIN = $(if $(ASSETS),out/assets.bin)
 
 .PHONY:	all clean run flash
 
-all:	out $(BOOT).bin $(NAME).bin
+all:	out $(BOOT).bin $(IMAGE) $(ASSET_BIN)
 	$(CC)size -G out/*.elf
 run:	#all
 	$(FEL) -p spl $(BOOT).bin
@@ -28,13 +34,25 @@ run:	#all
 	$(FEL) exec 0x80000000
 flash:	all
 	$(FEL) -p spiflash-write 0 $(BOOT).bin
-	$(FEL) -p spiflash-write 8192 $(NAME).bin
+	$(FEL) -p spiflash-write 8192 $(IMAGE)
+	$(if $(ASSETS),$(FEL) -p spiflash-write $(ASSET_ADDR) $(ASSET_BIN))
 build:	clean all
 	rm -fr out/*.d* out/*.e* out/*.m* out/*.o*
 $(NAME).bin: $(NAME).elf
 	$(CC)objcopy -O binary $^ $@
 $(NAME).elf: $(OBJS)
 	$(CC)gcc $^ -o$@ --specs=rdimon.specs $(LFLAGS)link.ld
+$(NAME).lz4: $(NAME).bin $(LZ4PACK)
+	$(LZ4PACK) $< $@
+$(LZ4PACK): $(BASE)tools/lz4pack/lz4pack.c $(BASE)drv/lz4.c $(BASE)drv/lz4.h
+	gcc -o$@ $(BASE)tools/lz4pack/lz4pack.c $(BASE)drv/lz4.c -s -O2 \
+	-I$(BASE)tools/host -I$(BASE)drv
+out/assets.bin: $(wildcard $(ASSETS)/*) $(ASSETPACK)
+	$(ASSETPACK) $@ $(wildcard $(ASSETS)/*)
+$(ASSETPACK): $(BASE)tools/assetpack/assetpack.c $(BASE)drv/asset.c $(BASE)drv/asset.h
+	gcc -o$@ $(BASE)tools/assetpack/assetpack.c $(BASE)drv/asset.c \
+	$(BASE)drv/lz4.c -s -O2 -I$(BASE)tools/host -I$(BASE)drv \
+	-DASSET_ADDR=$(ASSET_ADDR)
 $(BOOT).bin: $(BOOT).elf
 	$(CC)objcopy -O binary $^ $@
 	$(MKSUNXI) $@ 1>&0
@@ -0,0 +1,127 @@
+#include <string.h>
+#include <malloc.h>
+#include "sys.h"
+#include "mmu.h"
+
+/******************************************************************************/
+/*                        PACKED ASSETS IN SPI FLASH                          */
+/******************************************************************************/
+static struct ASSET_HDR hdr;
+static struct ASSET_ENT *dir;
+static struct {
+  u8 *ptr;
+  u32 idx;
+  u32 refs;
+  u32 tick;
+} map[ASSET_MAPS];
+static u32 map_size, map_tick;
+
+/* Reads the archive dir, returns the number of assets or -1 */
+int asset_init (void)
+{
+  spi_init();
+  free(dir);
+  dir = NULL;
+  hdr.num = 0;
+  spi_flash_read(ASSET_ADDR, &hdr, sizeof(hdr));
+  if(hdr.magic != ASSET_MAGIC || !hdr.num || hdr.num > 0xFFFF) return -1;
+  dir = memalign(CACHE_LINE_SIZE, hdr.num * sizeof(struct ASSET_ENT));
+  if(!dir) return -1;
+  spi_flash_read(ASSET_ADDR + sizeof(hdr), dir, hdr.num * sizeof(struct ASSET_ENT));
+  if(lz4_crc(dir, hdr.num * sizeof(struct ASSET_ENT)) != hdr.crc)
+  {
+    free(dir);
+    dir = NULL;
+    return -1;
+  }
+  return hdr.num;
+}
+
+int asset_open (struct ASSET *a, const char *name)
+{
+  int i, c, lo = 0, hi = dir ? hdr.num - 1 : -1;
+  while(lo <= hi)
+  {
+    i = (lo + hi) / 2;
+    c = strncmp(name, dir[i].name, ASSET_NAME);
+    if(!c)
+    {
+      a->idx = i;
+      a->size = dir[i].size;
+      a->pos = 0;
+      return OK;
+    }
+    if(c < 0) hi = i - 1;
+    else lo = i + 1;
+  }
+  return KO;
+}
+
+static int map_find (u32 idx)
+{
+  int i;
+  for(i = 0; i < ASSET_MAPS; i++) if(map[i].ptr && map[i].idx == idx) return i;
+  return -1;
+}
+
+/* Sequential read, served from the cache when the asset is mapped */
+int asset_read (struct ASSET *a, void *buf, u32 len)
+{
+  int i = map_find(a->idx);
+  if(len > a->size - a->pos) len = a->size - a->pos;
+  if(!len) return 0;
+  if(i >= 0) memcpy(buf, map[i].ptr + a->pos, len);
+  else spi_flash_read(ASSET_ADDR + dir[a->idx].ofs + a->pos, buf, len);
+  a->pos += len;
+  return len;
+}
+
+/* Free slot with room in the budget, evicts least recently used
+   unmapped assets; goes over the budget when all are in use */
+static int map_slot (u32 size)
+{
+  int i, j, k;
+  for(;;)
+  {
+    for(i = -1, k = -1, j = 0; j < ASSET_MAPS; j++)
+    {
+      if(!map[j].ptr) { if(k < 0) k = j; }
+      else if(!map[j].refs && (i < 0 || map[j].tick < map[i].tick)) i = j;
+    }
+    if(i < 0 || (k >= 0 && map_size + size <= ASSET_CACHE)) return k;
+    map_size -= dir[map[i].idx].size;
+    free(map[i].ptr);
+    map[i].ptr = NULL;
+  }
+}
+
+/* Whole asset in DRAM, loaded once and kept until the cache needs room */
+void *asset_map (struct ASSET *a)
+{
+  int i = map_find(a->idx);
+  if(i < 0)
+  {
+    if((i = map_slot(a->size)) < 0) return NULL;
+    map[i].ptr = memalign(CACHE_LINE_SIZE, a->size ? a->size : 1);
+    if(!map[i].ptr) return NULL;
+    spi_flash_read(ASSET_ADDR + dir[a->idx].ofs, map[i].ptr, a->size);
+    if(lz4_crc(map[i].ptr, a->size) != dir[a->idx].crc)
+    {
+      free(map[i].ptr);
+      map[i].ptr = NULL;
+      return NULL;
+    }
+    map[i].idx = a->idx;
+    map[i].refs = 0;
+    map_size += a->size;
+  }
+  map[i].refs++;
+  map[i].tick = ++map_tick;
+  return map[i].ptr;
+}
+
+void asset_unmap (struct ASSET *a)
+{
+  int i = map_find(a->idx);
+  if(i >= 0 && map[i].refs) map[i].refs--;
+}
@@ -0,0 +1,41 @@
+#ifndef ASSET_H
+#define ASSET_H
+
+#ifndef ASSET_ADDR
+#define ASSET_ADDR  0x100000    // archive offset in SPI flash (common.mk)
+#endif
+#define ASSET_MAGIC 0x54455341  // "ASET"
+#define ASSET_NAME  48
+#define ASSET_ALIGN 32          // data alignment inside the archive
+#define ASSET_MAPS  16          // assets kept in the DRAM cache
+#define ASSET_CACHE (4 << 20)   // cache budget, bytes
+
+/* Archive: header, index sorted by name, then the data */
+struct ASSET_HDR {
+  u32 magic;
+  u32 num;        // index entries
+  u32 size;       // whole archive, bytes
+  u32 crc;        // CRC-32 of the index
+};
+
+struct ASSET_ENT {
+  char name[ASSET_NAME];
+  u32 ofs;        // data offset from the archive start
+  u32 size;
+  u32 crc;        // CRC-32 of the data
+  u32 res;
+};
+
+struct ASSET {
+  u32 idx;
+  u32 size;
+  u32 pos;
+};
+
+int asset_init (void);
+int asset_open (struct ASSET *a, const char *name);
+int asset_read (struct ASSET *a, void *buf, u32 len);
+void *asset_map (struct ASSET *a);
+void asset_unmap (struct ASSET *a);
+
+#endif
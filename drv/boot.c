@@ -1,3 +1,4 @@
+#include <string.h>
 #include "sys.h"
 
 void __attribute__((naked)) _boot (void)
@@ -18,6 +19,13 @@ void __attribute__((naked)) _boot (void)
     "mrc    p15, 0, r1, c1, c0, 0\n"  // [64] = CP15 SCTLR Register
     "mrc    p15, 0, r2, c1, c0, 0\n"  // [68] = CP15 Control Register
     "stmia  r0, {r1-r2, sp, lr}\n"    // [72] = SP, [76] = LR
+    /* Clear .bss, the BROM leaves SRAM as it was */
+    "ldr    r0, =__bss_start\n"
+    "ldr    r1, =__bss_end\n"
+    "mov    r2, #0\n"
+    "1:     cmp r0, r1\n"
+    "strlo  r2, [r0], #4\n"
+    "blo    1b\n"
     "bl     boot\n"
     /* Return to FEL */
     "mov    r0, #64\n"
@@ -63,8 +71,99 @@ void put_num (unsigned int num)
 
 void sys_dram_init(void);
 
+#define LZ4_LOAD  0x81000000          // compressed image buffer, DRAM + 16MB
+#define APP_ADDR  0x80000000
+#define SD_BUF    (LZ4_LOAD - 1024)   // sdboot scratch sectors
+#define BROM_SD   0xFFFF40F8          // BROM return address after an SD card boot
+
+/* Plain application image: vector table branch, its size at [20] */
+static u32 raw_size (u32 *img)
+{
+  if((img[0] & 0xFF000000) != 0xEA000000 || !img[5] || img[5] > SD_BUF - 512 - APP_ADDR) return 0;
+  return img[5];
+}
+
+/* Unpacks the image loaded at LZ4_LOAD and checks it, returns its size */
+static u32 lz4_boot (struct LZ4_IMG *hdr)
+{
+  put_string("LZ4 size: ");
+  put_num(hdr->size);
+  if(hdr->raw > LZ4_LOAD - APP_ADDR ||
+    lz4_decode((void*)LZ4_LOAD, hdr->size, (void*)APP_ADDR, hdr->raw) != hdr->raw ||
+    lz4_crc((void*)APP_ADDR, hdr->raw) != hdr->crc)
+  {
+    put_string("Image CRC error\n");
+    return 0;
+  }
+  boot_trace("lz4");
+  return hdr->raw;
+}
+
+static u32 spi_boot (void)
+{
+  struct LZ4_IMG hdr;
+  u32 size;
+  /* SPI NOR initialization */
+  put_string("\n\n\033[36mSPI-boot\033[0m\nImage size: ");
+  spi_init();
+  spi_flash_read(8192, &hdr, sizeof(hdr));
+  boot_trace("spi_init");
+  if(hdr.magic == LZ4_IMG_MAGIC)
+  {
+    /* Compressed image: load it above the application, unpack in place */
+    put_num(hdr.raw);
+    if(hdr.size > TRACE_ADDR - LZ4_LOAD) return 0;
+    spi_flash_read(8192 + sizeof(hdr), (void*)LZ4_LOAD, hdr.size);
+    boot_trace("load");
+    return lz4_boot(&hdr);
+  }
+  size = raw_size((u32*)&hdr);
+  put_num(size);
+  if(size)
+  {
+    spi_flash_read(8192, (void*)APP_ADDR, size);
+    boot_trace("load");
+  }
+  return size;
+}
+
+/* APP.IMG on the FAT volume or the raw image at SDBOOT_LBA, the same
+   .bin or .lz4 image as in SPI flash, read with multi-block commands */
+static u32 sd_boot (void)
+{
+  struct SDBOOT b = { &sd_read, (u8*)SD_BUF };
+  struct LZ4_IMG hdr;
+  u32 size;
+  put_string("\n\n\033[36mSD-boot\033[0m\n");
+  sd_init();
+  if(!sd_card_init() || sdboot_open(&b) != OK) return 0;
+  put_string(b.csize ? "APP.IMG size: " : "Raw image size: ");
+  if(sdboot_read(&b, (void*)APP_ADDR, 1) != OK) return 0;
+  boot_trace("sd_init");
+  memcpy(&hdr, (void*)APP_ADDR, sizeof(hdr));
+  if(hdr.magic == LZ4_IMG_MAGIC)
+  {
+    /* The first block is already in, move its payload to LZ4_LOAD */
+    put_num(hdr.raw);
+    size = sizeof(hdr) + hdr.size;
+    if(hdr.size > TRACE_ADDR - 512 - LZ4_LOAD || (b.size && b.size < size)) return 0;
+    memcpy((void*)LZ4_LOAD, (u8*)APP_ADDR + sizeof(hdr), 512 - sizeof(hdr));
+    if(sdboot_read(&b, (u8*)LZ4_LOAD + 512 - sizeof(hdr), (size - 1) / 512) != OK) return 0;
+    boot_trace("load");
+    return lz4_boot(&hdr);
+  }
+  size = raw_size((u32*)&hdr);
+  put_num(size);
+  if(!size || (b.size && b.size < size) ||
+    sdboot_read(&b, (u8*)APP_ADDR + 512, (size - 1) / 512) != OK) return 0;
+  boot_trace("load");
+  return size;
+}
+
 void boot (void)
 {
+  u32 size, us, sd, t_clk, t_uart;
+  boot_trace_start();
   dev_enable(1);
   /* System clock initialization */
   CCU->PLL_STABLE0 = 0x1FF;
@@ -80,22 +179,45 @@ void boot (void)
   for(CCU->PLL_CPU_CTRL = 0x80001700; !(CCU->PLL_CPU_CTRL & (1 << 28)); ) {};
   CCU->CPU_CLK_SRC = 0x20000;         // CPU:576MHz
   sdelay(100);
+  t_clk = boot_trace_us();
   /* UART initialization */
   uart_init(SYS_UART_NUM, (struct UART_CFG) { .port = SYS_UART_PORT,
     .bitrate = UART_BR(115200), .parity = UART_PAR_NO, .stop = UART_STP_1,
     .lenght = UART_8b });
+  t_uart = boot_trace_us();
   /* DDR initialization */
   sys_dram_init();
+  boot_trace_init();                  // the trace log lives in DRAM
+  boot_trace_at("spl", 0);
+  boot_trace_at("clock", t_clk);
+  boot_trace_at("uart", t_uart);
+  boot_trace("dram");
   /* Firmware loading */
   if(*(unsigned int*)8 != 0x4c45462e)
   {
-    /* SPI NOR initialization */
-    put_string("\n\n\033[36mSPI-boot\033[0m\nImage size: ");
-    spi_init();
-    spi_flash_read(8192, (void*)0x80000000, 32);
-    put_num(*(int*)0x80000014);
-    spi_flash_read(8192, (void*)0x80000000, *(int*)0x80000014);
-    ((void(*)())0x80000000)();
+    CCU->AVS_CLK = (1U << 31);
+    TIM->AVS_CTRL = 3;
+    TIM->AVS_DIV = (11999 << 16) | 11;  // AVS1:1mS, AVS0:1uS
+    /* Boot media first, the other one if it holds no valid image */
+    us = boot_trace_us();
+    sd = *(u32*)76 == BROM_SD;
+    if(!(size = sd ? sd_boot() : spi_boot())) size = sd ? spi_boot() : sd_boot();
+    if(!size)
+    {
+      put_string("No valid image\n");
+      return;
+    }
+    us = boot_trace_us() - us;
+    put_string("Load time (uS): ");
+    put_num(us);
+    put_string("Load speed (kB/s): ");
+    put_num(size / (us / 1000 + 1));
+    boot_trace("jump");
+    ((void(*)())APP_ADDR)();
+  }
+  else
+  {
+    put_string("\n\n\033[36mUSB-boot\033[0m\n");
+    boot_trace("fel");
   }
-  else put_string("\n\n\033[36mUSB-boot\033[0m\n");
 }
@@ -153,10 +153,10 @@ typedef struct {
   __IO  u32 PAR;            // 0x18 Dedicated DMA Parameter
   __IO  u32 DAT;            // 0x1C Dedicated DMA General Dara (for DDMA3)
 } DDMA_T;
-#define DDMA0 ((NDMA_T*)0x01C02300)
-#define DDMA1 ((NDMA_T*)0x01C02320)
-#define DDMA2 ((NDMA_T*)0x01C02340)
-#define DDMA3 ((NDMA_T*)0x01C02360)
+#define DDMA0 ((DDMA_T*)0x01C02300)
+#define DDMA1 ((DDMA_T*)0x01C02320)
+#define DDMA2 ((DDMA_T*)0x01C02340)
+#define DDMA3 ((DDMA_T*)0x01C02360)
 
 /* INTC */
 enum IRQ_SRCS { IRQ_NMI = 0, IRQ_UART0, IRQ_UART1, IRQ_UART2,
@@ -705,7 +705,7 @@ typedef struct {
   __IO  u16 RXMAXP;         // 0x84
   __IO  u16 RXCSR;          // 0x86
   __IO  u16 RXCOUNT;        // 0x88
-  __IO  u16 res1;           // 0x8A
+  __IO  u16 RXPKTCNT;       // 0x8A IN packets requested by AutoReq
   __IO  u8  TXTYPE;         // 0x8C
   __IO  u8  TXINTERVAL;     // 0x8D
   __IO  u8  RXTYPE;         // 0x8E
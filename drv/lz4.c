@@ -0,0 +1,70 @@
+#include <string.h>
+#include "sys.h"
+#include "lz4.h"
+
+/******************************************************************************/
+/*                            LZ4 BLOCK DECODER                               */
+/******************************************************************************/
+static int lz4_len (const u8 **ip, const u8 *iend, u32 *len)
+{
+  u8 c;
+  do
+  {
+    if(*ip >= iend) return KO;
+    c = *(*ip)++;
+    *len += c;
+  } while(c == 255);
+  return OK;
+}
+
+/* Returns the decoded size or -1 on a corrupted block */
+int lz4_decode (const void *src, u32 slen, void *dst, u32 dlen)
+{
+  const u8 *ip = src, *iend = ip + slen, *m;
+  u8 *op = dst, *oend = op + dlen, tok;
+  u32 len, ofs;
+  while(ip < iend)
+  {
+    tok = *ip++;
+    len = tok >> 4;
+    if(len == 15 && lz4_len(&ip, iend, &len) != OK) return -1;
+    if(len > iend - ip || len > oend - op) return -1;
+    memcpy(op, ip, len);
+    ip += len;
+    op += len;
+    if(ip == iend) break;             // the last sequence has no match
+    if(iend - ip < 2) return -1;
+    ofs = ip[0] | (ip[1] << 8);
+    ip += 2;
+    len = tok & 15;
+    if(len == 15 && lz4_len(&ip, iend, &len) != OK) return -1;
+    len += 4;
+    if(!ofs || ofs > op - (u8*)dst || len > oend - op) return -1;
+    m = op - ofs;
+    if(ofs >= len)
+    {
+      memcpy(op, m, len);
+      op += len;
+    }
+    else while(len--) *op++ = *m++;   // overlapping: repeats the pattern
+  }
+  return op - (u8*)dst;
+}
+
+/* CRC-32 (IEEE 802.3), nibble table to keep the SPL small */
+u32 lz4_crc (const void *buf, u32 len)
+{
+  static const u32 tab[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+    0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C };
+  const u8 *p = buf;
+  u32 crc = 0xFFFFFFFF;
+  while(len--)
+  {
+    crc ^= *p++;
+    crc = (crc >> 4) ^ tab[crc & 15];
+    crc = (crc >> 4) ^ tab[crc & 15];
+  }
+  return ~crc;
+}
@@ -0,0 +1,18 @@
+#ifndef LZ4_H
+#define LZ4_H
+
+#define LZ4_IMG_MAGIC 0x49345A4C  // "LZ4I"
+
+/* Compressed application image: this header, then one LZ4 block */
+struct LZ4_IMG {
+  u32 magic;
+  u32 raw;        // decompressed size
+  u32 size;       // compressed size (after the header)
+  u32 crc;        // CRC-32 of the decompressed image
+  u32 res[4];
+};
+
+int lz4_decode (const void *src, u32 slen, void *dst, u32 dlen);
+u32 lz4_crc (const void *buf, u32 len);
+
+#endif
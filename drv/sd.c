@@ -1,7 +1,7 @@
 #include <stdio.h>
 #include <string.h>
-#include <malloc.h>
 #include "sys.h"
+#include "mmu.h"
 
 #define CMD_LOAD          (1U << 31)
 #define CMD_PRG_CLK       (1U << 21)
@@ -26,6 +26,7 @@
 struct {
   u32 rca;
   u32 cap;
+  u32 au;
   u32 ccs : 1;
   u32 det : 1;
 } card;
@@ -81,6 +82,8 @@ static int wait_event (u32 event)
   return -2;
 }
 
+static u32 card_au (void);
+
 static int cmd (u32 cmd, u32 arg)
 {
   u32 res;
@@ -144,69 +147,152 @@ int sd_card_init (void)
     cmd(6 + RES_R1, 2);           // SET_BUS_WIDTH (4bit SD bus)
     SD0->BWD = 1;
     CCU->SDMMC0_CLK = 0x80000000; // Speed up
+    card.au = card_au();
     card.cap = card.det ? arg : 0;
     delay(10);
   }
   return card.cap;
 }
 
-int sd_read (void *ptr, u32 addr, u32 cnt)
+/* Unaligned buffers: small transfers go through a preallocated cache-aligned
+   bounce pool, larger ones are merged in place so that only the unaligned head
+   and tail bytes of the buffer are stored bytewise. */
+#define BOUNCE_BLKS       4
+#define BOUNCE_NUM        2
+
+static struct {
+  u32 buf[BOUNCE_NUM][BOUNCE_BLKS * 128] __attribute__((aligned(CACHE_LINE_SIZE)));
+  u32 used;
+} bounce;
+
+struct SD_STAT sd_stat;
+
+static u32 *bounce_get (u32 cnt)
+{
+  if(cnt > BOUNCE_BLKS) return NULL;
+  for(int i = 0; i < BOUNCE_NUM; i++)
+    if(!(bounce.used & (1 << i)))
+    {
+      bounce.used |= (1 << i);
+      sd_stat.bounce += cnt * 512;
+      return bounce.buf[i];
+    }
+  return NULL;
+}
+
+static void bounce_put (u32 *buf)
+{
+  bounce.used &= ~(1 << ((buf - bounce.buf[0]) / (BOUNCE_BLKS * 128)));
+}
+
+static void data_cmd (u32 idx, u32 addr, u32 cnt, u32 flags)
 {
-  u32 ctr = cnt * 128, *buf = (u32*)ptr;
-  if(!card.cap) return cnt;
-  if((u32)ptr & 3)
-  {
-    //printf("sd_read: ptr is not aligned (%p %u %u)\n", ptr, addr, cnt);
-    buf = malloc(cnt * 512);
-    sd_read(buf, addr, cnt);
-    memcpy(ptr, buf, cnt * 512);
-    free(buf);
-    return cnt;
-  }
   SD0->GCTL &= ~0x100;
   SD0->BYC = cnt * 512;
   SD0->ARG = card.ccs ? addr : addr * 512;
   SD0->GCTL |= (1U << 31);
-  SD0->CMD = cnt == 1 ? 17 | CMD_DATA_TRANS | CMD_WAIT_PRE_OVER | CMD_LOAD | RES_R1 :
-    18 | CMD_DATA_TRANS | CMD_STOP_CMD_FLAG | CMD_WAIT_PRE_OVER | CMD_LOAD | RES_R1;
-  do {
-    if(wait_status(4, 0)) break;
-    *buf++ = SD0->FIFO;
-  } while(--ctr);
+  SD0->CMD = cnt == 1 ? idx | CMD_DATA_TRANS | CMD_WAIT_PRE_OVER | CMD_LOAD | RES_R1 | flags :
+    (idx + 1) | CMD_DATA_TRANS | CMD_STOP_CMD_FLAG | CMD_WAIT_PRE_OVER | CMD_LOAD | RES_R1 | flags;
+}
+
+static void data_end (u32 cnt)
+{
   wait_event(4);
   wait_event(cnt == 1 ? 1 << 3 : 1 << 14);
   SD0->RIS = 0xFFFFFFFF;
   SD0->GCTL |= 0x100;
-  return cnt;
 }
 
-int sd_write (void *ptr, u32 addr, u32 cnt)
+static void fifo_read (u8 *ptr, u32 ctr)
 {
-  uint32_t ctr = cnt * 128, *buf = (uint32_t*)ptr;
-  if(!card.cap) return cnt;
-  if((u32)ptr & 3)
+  u32 i, w, c, *dst, off = (u32)ptr & 3, hd = 4 - off;
+  if(!off)
+  {
+    for(dst = (u32*)ptr; ctr && !wait_status(4, 0); ctr--) *dst++ = SD0->FIFO;
+    return;
+  }
+  if(wait_status(4, 0)) return;
+  w = SD0->FIFO;
+  for(i = 0; i < hd; i++) *ptr++ = w >> (i * 8);
+  c = w >> (hd * 8);
+  for(dst = (u32*)ptr; --ctr && !wait_status(4, 0); c = w >> (hd * 8))
+  {
+    w = SD0->FIFO;
+    *dst++ = c | (w << (off * 8));
+  }
+  for(ptr = (u8*)dst, i = 0; i < off; i++) *ptr++ = c >> (i * 8);
+  sd_stat.bounce += 4;
+}
+
+static void fifo_write (u8 *ptr, u32 ctr)
+{
+  u32 i, w, c, *src, off = (u32)ptr & 3, hd = 4 - off;
+  if(!off)
+  {
+    for(src = (u32*)ptr; ctr && !wait_status(8, 0); ctr--) SD0->FIFO = *src++;
+    return;
+  }
+  for(c = 0, i = 0; i < hd; i++) c |= *ptr++ << (i * 8);
+  for(src = (u32*)ptr; ctr-- && !wait_status(8, 0); c = w >> (off * 8))
   {
-    //printf("sd_write: ptr is not aligned (%p %u %u)\n", ptr, addr, cnt);
-    buf = malloc(cnt * 512);
-    memcpy(buf, ptr, cnt * 512);
-    sd_write(buf, addr, cnt);
-    free(buf);
-    return cnt;
+    if(ctr) w = *src++;
+    else for(w = 0, ptr = (u8*)src, i = 0; i < off; i++) w |= *ptr++ << (i * 8);
+    SD0->FIFO = c | (w << (hd * 8));
   }
+  sd_stat.bounce += 4;
+}
+
+/* Allocation unit size (sectors) from the AU_SIZE field of the SD status */
+static u32 card_au (void)
+{
+  static const u32 au[16] = { 0, 32, 64, 128, 256, 512, 1024, 2048, 4096,
+    8192, 16384, 24576, 32768, 49152, 65536, 131072 };
+  u32 sta[16];
+  cmd(55 + RES_R1, card.rca);
+  SD0->BKS = 64;
+  SD0->BYC = 64;
+  SD0->ARG = 0;
   SD0->GCTL &= ~0x100;
-  SD0->BYC = cnt * 512;
-  SD0->ARG = card.ccs ? addr : addr * 512;
   SD0->GCTL |= (1U << 31);
-  SD0->CMD = cnt == 1 ? 24 | CMD_DATA_TRANS | CMD_WAIT_PRE_OVER | CMD_TRANS_WRITE | CMD_LOAD | RES_R1 :
-    25 | CMD_DATA_TRANS | CMD_STOP_CMD_FLAG | CMD_WAIT_PRE_OVER | CMD_TRANS_WRITE | CMD_LOAD | RES_R1;
-  do {
-    if(wait_status(8, 0)) break;
-    SD0->FIFO = *buf++;
-  } while(--ctr);
-  wait_event(4);
-  wait_event(cnt == 1 ? 1 << 3 : 1 << 14);
-  SD0->RIS = 0xFFFFFFFF;
-  SD0->GCTL |= 0x100;
+  SD0->CMD = 13 | CMD_DATA_TRANS | CMD_WAIT_PRE_OVER | CMD_LOAD | RES_R1; // SD_STATUS
+  fifo_read((u8*)sta, 16);
+  data_end(1);
+  SD0->BKS = 512;
+  return au[(sta[2] >> 20) & 15];
+}
+
+int sd_card_au (void)
+{
+  return card.cap ? card.au : 0;
+}
+
+int sd_read (void *ptr, u32 addr, u32 cnt)
+{
+  u32 *buf = NULL;
+  if(!card.cap) return cnt;
+  if((u32)ptr & 3) buf = bounce_get(cnt);
+  data_cmd(17, addr, cnt, 0);
+  fifo_read(buf ? (u8*)buf : (u8*)ptr, cnt * 128);
+  data_end(cnt);
+  if(buf)
+  {
+    memcpy(ptr, buf, cnt * 512);
+    bounce_put(buf);
+  }
+  sd_stat.rd_blks += cnt;
+  return cnt;
+}
+
+int sd_write (void *ptr, u32 addr, u32 cnt)
+{
+  u32 *buf = NULL;
+  if(!card.cap) return cnt;
+  if((u32)ptr & 3 && (buf = bounce_get(cnt)) != NULL) memcpy(buf, ptr, cnt * 512);
+  data_cmd(24, addr, cnt, CMD_TRANS_WRITE);
+  fifo_write(buf ? (u8*)buf : (u8*)ptr, cnt * 128);
+  data_end(cnt);
+  if(buf) bounce_put(buf);
+  sd_stat.wr_blks += cnt;
   for(ctr_us = 0; ctr_us < 10000000; )
   {
     cmd(13 + RES_R1, card.rca);
@@ -1,10 +1,19 @@
 #ifndef SD_H
 #define SD_H
 
+struct SD_STAT {
+  u32 rd_blks;
+  u32 wr_blks;
+  u32 bounce;     // bytes copied through the bounce pool or merged bytewise
+};
+
+extern struct SD_STAT sd_stat;
+
 void sd_init (void);
 void sd_deinit (void);
 int sd_card_detect (void);
 int sd_card_init (void);
+int sd_card_au (void);
 int sd_read (void *ptr, u32 addr, u32 cnt);
 int sd_write (void *ptr, u32 addr, u32 cnt);
 
@@ -0,0 +1,120 @@
+#include <string.h>
+#include "sys.h"
+
+static u32 ld16 (const u8 *p) { return p[0] | (p[1] << 8); }
+static u32 ld32 (const u8 *p) { return ld16(p) | (ld16(p + 2) << 16); }
+
+static int rd (struct SDBOOT *b, void *buf, u32 lba, u32 cnt)
+{
+  b->cmds++;
+  b->blks += cnt;
+  return b->rd(buf, lba, cnt) == cnt ? OK : KO;
+}
+
+static int rd_sec (struct SDBOOT *b, u32 lba)
+{
+  if(lba == b->cached) return OK;
+  b->cached = ~0;
+  if(rd(b, b->sec, lba, 1) != OK) return KO;
+  b->cached = lba;
+  return OK;
+}
+
+static u32 fat_next (struct SDBOOT *b, u32 clus)
+{
+  u32 ofs = clus << (b->fat32 ? 2 : 1);
+  if(rd_sec(b, b->fat + ofs / 512) != OK) return 0;
+  ofs &= 511;
+  return b->fat32 ? ld32(b->sec + ofs) & 0x0FFFFFFF : ld16(b->sec + ofs);
+}
+
+/* FAT16/FAT32 volume at lba, returns the FAT16 root directory sectors */
+static int fat_mount (struct SDBOOT *b, u32 lba, u32 *root)
+{
+  u8 *s = b->sec;
+  u32 rsv, fsz, tot;
+  if(rd_sec(b, lba) != OK || ld16(s + 510) != 0xAA55 || ld16(s + 11) != 512) return KO;
+  b->csize = s[13];
+  rsv = ld16(s + 14);
+  fsz = ld16(s + 22) ? ld16(s + 22) : ld32(s + 36);
+  tot = ld16(s + 19) ? ld16(s + 19) : ld32(s + 32);
+  *root = (ld16(s + 17) * 32 + 511) / 512;
+  if(!b->csize || (b->csize & (b->csize - 1)) || !rsv || !s[16] || !fsz) return KO;
+  b->fat = lba + rsv;
+  b->data = b->fat + s[16] * fsz + *root;
+  if(tot <= b->data - lba) return KO;
+  b->nclus = (tot - (b->data - lba)) / b->csize;
+  b->fat32 = b->nclus >= 65525;
+  if(b->nclus < 4085 || b->fat32 != !*root) return KO;  // no FAT12
+  b->clus = b->fat32 ? ld32(s + 44) : b->data - *root;
+  b->pos = 0;
+  return OK;
+}
+
+int sdboot_open (struct SDBOOT *b)
+{
+  u8 *s = b->sec, *d;
+  u32 i, n, lba = 0, csize;
+  b->cached = ~0;
+  b->cmds = 0;
+  b->blks = 0;
+  /* First partition of an MBR or a volume without partition table */
+  if(rd_sec(b, 0) == OK && ld16(s + 510) == 0xAA55 && s[0] != 0xEB && s[0] != 0xE9)
+    lba = ld32(s + 454);
+  if(fat_mount(b, lba, &n) == OK)
+  {
+    d = b->sec + 512;
+    csize = b->csize;
+    if(n) b->csize = 0;                 // FAT16 root directory is a plain extent
+    while(sdboot_read(b, d, 1) == OK && d[0])
+    {
+      for(i = 0; i < 512 && d[i]; i += 32)
+      {
+        if(d[i] == 0xE5 || d[i + 11] & 0x18 || memcmp(&d[i], SDBOOT_NAME, 11)) continue;
+        b->csize = csize;
+        b->clus = ld16(&d[i + 26]) | (b->fat32 ? ld16(&d[i + 20]) << 16 : 0);
+        b->pos = 0;
+        b->size = ld32(&d[i + 28]);
+        if(b->size) return OK;
+        break;
+      }
+      if(i < 512 || (n && !--n)) break;
+    }
+  }
+  b->csize = 0;
+  b->clus = SDBOOT_LBA;
+  b->size = 0;
+  return OK;
+}
+
+int sdboot_read (struct SDBOOT *b, void *buf, u32 cnt)
+{
+  u8 *dst = (u8*)buf;
+  u32 n, lba, last, adv;
+  while(cnt)
+  {
+    if(!b->csize)
+    {
+      n = cnt > SDBOOT_CHUNK ? SDBOOT_CHUNK : cnt;
+      lba = b->clus;
+      b->clus += n;
+    }
+    else
+    {
+      if(b->clus < 2 || b->clus - 2 >= b->nclus) return KO;
+      /* Physically consecutive clusters go into one multi-block read */
+      for(last = b->clus, n = b->csize - b->pos; n < cnt && n < SDBOOT_CHUNK &&
+        fat_next(b, last) == last + 1; n += b->csize) last++;
+      if(n > cnt) n = cnt;
+      if(n > SDBOOT_CHUNK) n = SDBOOT_CHUNK;
+      lba = b->data + (b->clus - 2) * b->csize + b->pos;
+      adv = (b->pos + n) / b->csize;
+      b->pos = (b->pos + n) & (b->csize - 1);
+      b->clus = b->clus + adv <= last ? b->clus + adv : fat_next(b, last);
+    }
+    if(rd(b, dst, lba, n) != OK) return KO;
+    dst += n * 512;
+    cnt -= n;
+  }
+  return OK;
+}
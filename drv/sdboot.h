@@ -0,0 +1,30 @@
+#ifndef SDBOOT_H
+#define SDBOOT_H
+
+#define SDBOOT_LBA    128           // raw image: 64KB into the card, behind the SPL
+#define SDBOOT_NAME   "APP     IMG" // APP.IMG in the root directory of the first FAT
+#define SDBOOT_CHUNK  2048          // blocks per multi-block read
+
+/* Boot image on an SD card: a file in the root directory of a FAT16/FAT32
+   volume or, failing that, a raw image at SDBOOT_LBA. The reader has the
+   sd_read() signature, so the host tools can run it against a disk image. */
+struct SDBOOT {
+  int (*rd) (void *ptr, u32 addr, u32 cnt);
+  u8 *sec;        // 1024-byte scratch: FAT and directory sectors
+  u32 fat;        // FAT start sector
+  u32 data;       // cluster 2 sector
+  u32 nclus;      // clusters on the volume
+  u32 csize;      // sectors per cluster, 0 - raw image
+  u32 fat32;
+  u32 cached;     // FAT sector in sec
+  u32 clus;       // current cluster (file) or sector (raw)
+  u32 pos;        // sector inside the current cluster
+  u32 size;       // file size, bytes
+  u32 cmds;       // read commands issued
+  u32 blks;       // blocks read
+};
+
+int sdboot_open (struct SDBOOT *b);
+int sdboot_read (struct SDBOOT *b, void *buf, u32 cnt);
+
+#endif
@@ -1,16 +1,25 @@
 #include "sys.h"
+#include "mmu.h"
 
 /******************************************************************************/
 /*                                SPI0 (FLASH)                                */
 /******************************************************************************/
 #define spi_flash_select() SPI0->TC = 0x44
 #define spi_flash_deselect() SPI0->TC = 0xC4
+#define SPI_BURST_MAX   0xFFFFFC        // burst counters are 24-bit
+#define SPI_DMA_MIN     512             // shorter reads are drained by the CPU
+#define NDMA_DRQ_SPI0   0x04
+#define NDMA_DRQ_SDRAM  0x11
+
+struct SPI_STAT spi_stat;
+static enum SPI_FLASH_MODE spi_mode = SPI_FLASH_DUAL;
+static u8 spi_dma = 1;               // cleared if NDMA0 stalls once
 
 void spi_init (void)
 {
-  CCU->BUS_CLK_GATING0 |= (1 << 20);  // SPI0
-  CCU->BUS_SOFT_RST0 &= ~(1 << 20);
-  CCU->BUS_SOFT_RST0 |= (1 << 20);
+  CCU->BUS_CLK_GATING0 |= (1 << 20) | (1 << 6); // SPI0, DMA
+  CCU->BUS_SOFT_RST0 &= ~((1 << 20) | (1 << 6));
+  CCU->BUS_SOFT_RST0 |= (1 << 20) | (1 << 6);
   PC->CFG0 = 0x2222;                  // PC0-CLK, PC1-CS, PC2-MISO, PC3-MOSI
   SPI0->CC = 0x1001;                  // AHB / 4 = 48MHz
   for(SPI0->GC = 0x80000083; SPI0->GC & 0x80000000;) {};
@@ -24,32 +33,121 @@ void spi_deinit (void)
   PC->CFG0 = 0x7777;
 }
 
-int spi_flash_read (u32 addr, void *buf, u32 len)
+void spi_flash_mode (enum SPI_FLASH_MODE mode)
 {
-  u8 i, *rx = (u8*)buf;
-  if(!buf || !len) return 1;
-  spi_flash_select();
-  SPI0->MBC = 4;
-  SPI0->MTC = 4;
-  SPI0->BCC = 4;
-  SPI0->TX.word = __builtin_bswap32((addr & 0x00FFFFFF) | 0x03000000);
+  spi_mode = mode;
+}
+
+/* Command, address and (for fast reads) one dummy byte, the received
+   bytes of this phase are dropped */
+static void spi_flash_cmd (u32 addr)
+{
+  static const u8 cmd[] = { 0x03, 0x0B, 0x3B };
+  u32 n = spi_mode == SPI_FLASH_SLOW ? 4 : 5;
+  SPI0->MBC = n;
+  SPI0->MTC = n;
+  SPI0->BCC = n;
+  SPI0->TX.word = __builtin_bswap32((addr & 0x00FFFFFF) | (cmd[spi_mode] << 24));
+  if(n > 4) SPI0->TX.byte = 0;
   for(SPI0->TC |= (1U << 31); SPI0->TC & (1U << 31); ) {};
   SPI0->RX.word;
-  do
+  if(n > 4) SPI0->RX.byte;
+}
+
+/* Receive-only burst: all clocks after the command phase carry data,
+   on MISO/MOSI both in the dual mode */
+static void spi_flash_burst (u32 len)
+{
+  SPI0->MBC = len;
+  SPI0->MTC = 0;
+  SPI0->BCC = spi_mode == SPI_FLASH_DUAL ? (1 << 28) : 0;
+  SPI0->TC |= (1U << 31);
+}
+
+static void spi_flash_pio (u8 *rx, u32 len)
+{
+  u32 i, n;
+  while(len)
   {
-    i = len > 64 ? 64 : len;
-    SPI0->MBC = i;
-    SPI0->TC |= (1U << 31);
-    len -= i;
+    n = len > SPI_BURST_MAX ? SPI_BURST_MAX : len;
+    spi_flash_burst(n);
+    len -= n;
     do
     {
-      if(SPI0->FS & 0xFF)
+      i = SPI0->FS & 0xFF;
+      if(i >= 4 && n >= 4)
+      {
+        if((u32)rx & 3)
+        {
+          i = SPI0->RX.word;
+          rx[0] = i; rx[1] = i >> 8; rx[2] = i >> 16; rx[3] = i >> 24;
+        }
+        else *(u32*)rx = SPI0->RX.word;
+        rx += 4;
+        n -= 4;
+      }
+      else if(i)
       {
         *rx++ = SPI0->RX.byte;
-        i--;
+        n--;
       }
-    } while(i);
-  } while(len);
+    } while(n);
+  }
+}
+
+/* NDMA0 moves whole words from the RX FIFO to DRAM, the CPU only waits:
+   twice the time of the slowest mode, 6MB/s, before it gives up */
+static int spi_flash_dma (u32 *rx, u32 len)
+{
+  u32 n;
+  mmu_clean_invalidated_dcache((u32)rx, len);
+  SPI0->FC = (SPI0->FC & ~0xFF) | (1 << 8) | 4;   // RX DRQ while a word is ready
+  while(len)
+  {
+    n = len > SPI_BURST_MAX ? SPI_BURST_MAX : len;
+    NDMA0->SRC = (u32)&SPI0->RX.word;
+    NDMA0->DST = (u32)rx;
+    NDMA0->CNT = n;
+    NDMA0->CFG = (1U << 31) | (2 << 24) | (NDMA_DRQ_SDRAM << 16) | (2 << 8) |
+      (1 << 5) | NDMA_DRQ_SPI0;
+    spi_flash_burst(n);
+    for(ctr_us = 0; NDMA0->CFG & (1 << 30); )
+      if(ctr_us > 1000 + n / 3) break;
+    if(NDMA0->CFG & (1 << 30))
+    {
+      NDMA0->CFG = 0;
+      break;
+    }
+    rx += n / 4;
+    len -= n;
+  }
+  SPI0->FC = (SPI0->FC & ~(0xFF | (1 << 8))) | 1;
+  return len ? KO : OK;
+}
+
+int spi_flash_read (u32 addr, void *buf, u32 len)
+{
+  u8 *rx = (u8*)buf;
+  u32 n;
+  if(!buf || !len) return 1;
+  spi_flash_select();
+  spi_flash_cmd(addr);
+  n = !spi_dma || ((u32)rx & 3) || len < SPI_DMA_MIN ? 0 : len & ~3;
+  if(n && spi_flash_dma((u32*)rx, n) == OK)
+  {
+    spi_stat.dma += n;
+    rx += n;
+    len -= n;
+  }
+  else if(n)
+  {                                   // DMA stalled: reset, read it all by PIO
+    spi_dma = 0;
+    spi_init();
+    spi_flash_select();
+    spi_flash_cmd(addr);
+  }
+  spi_stat.pio += len;
+  if(len) spi_flash_pio(rx, len);
   spi_flash_deselect();
   return 0;
 }
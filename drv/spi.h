@@ -1,9 +1,23 @@
 #ifndef SPI_H
 #define SPI_H
 
+enum SPI_FLASH_MODE {
+  SPI_FLASH_SLOW,   // 0x03 READ
+  SPI_FLASH_FAST,   // 0x0B FAST READ, 8 dummy clocks
+  SPI_FLASH_DUAL    // 0x3B DUAL OUTPUT FAST READ, 8 dummy clocks (default)
+};
+
+struct SPI_STAT {
+  u32 pio;          // bytes drained by the CPU
+  u32 dma;          // bytes moved by NDMA0
+};
+
+extern struct SPI_STAT spi_stat;
+
 void spi_init (void);
 void spi_deinit (void);
 
+void spi_flash_mode (enum SPI_FLASH_MODE mode);
 int spi_flash_read (u32 addr, void *buf, u32 len);
 
 #endif
\ No newline at end of file
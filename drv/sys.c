@@ -151,7 +151,9 @@ struct mem_desc r6_mem_desc[] = {
 void sys_init (void)
 {
   TIM->WDOG_MODE = 0;                 // Watchdog disabled
+  boot_trace("reset");
   rt_hw_mmu_init(r6_mem_desc, sizeof(r6_mem_desc) / sizeof(r6_mem_desc[0]));
+  boot_trace("mmu");
   setbuf(stdout, NULL);
   CCU->AVS_CLK = (1U << 31);
   TIM->AVS_CTRL = 3;
@@ -159,6 +161,7 @@ void sys_init (void)
   ADC->CTRL |= 1;                     // ADC enabled
   usb_deinit();
   spi_deinit();
+  boot_trace("sys_init");
 }
 
 void udelay (u32 us) { for(ctr_us = 0; ctr_us < us; ) {}; }
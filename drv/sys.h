@@ -10,6 +10,10 @@
 #include "twi.h"
 #include "aud.h"
 #include "sd.h"
+#include "lz4.h"
+#include "trace.h"
+#include "asset.h"
+#include "sdboot.h"
 
 #ifdef MANGO_BOARD
 #define SYS_UART_NUM  UART1
@@ -45,6 +49,8 @@ void led_set (enum LED_STATE state);
 
 void disk_init ( u8 pdrv, int (*cbrd) (void *ptr, u32 addr, u32 cnt),
   int (*cbwr) (void *ptr, u32 addr, u32 cnt));
+void disk_geometry (u8 pdrv, u32 cnt, u32 blk);
+void disk_sync (u8 pdrv, int (*cbsync) (void));
 
 static inline void IRQ_ENABLE (void)
 {
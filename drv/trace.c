@@ -0,0 +1,60 @@
+#include <stdio.h>
+#include "sys.h"
+
+/******************************************************************************/
+/*                                 BOOT TRACE                                 */
+/******************************************************************************/
+#define trace ((struct TRACE*)TRACE_ADDR)
+
+/* Timer2 counts down from 0xFFFFFFFF at 24MHz / 8, nothing else uses it */
+void boot_trace_start (void)
+{
+  TIM->T2_INTV = 0xFFFFFFFF;
+  TIM->T2_CURV = 0xFFFFFFFF;
+  TIM->T2_CTRL = 0x35;        // OSC24M / 8, continuous
+}
+
+void boot_trace_init (void)
+{
+  trace->magic = TRACE_MAGIC;
+  trace->num = 0;
+}
+
+u32 boot_trace_us (void)
+{
+  return ~TIM->T2_CURV / 3;
+}
+
+void boot_trace_at (const char *tag, u32 us)
+{
+  u32 i;
+  if(!(TIM->T2_CTRL & 1))
+  {                           // started without the SPL
+    boot_trace_start();
+    boot_trace_init();
+  }
+  if(trace->magic != TRACE_MAGIC) boot_trace_init();
+  if(trace->num >= TRACE_NUM) return;
+  trace->ent[trace->num].us = us;
+  for(i = 0; i < sizeof(trace->ent[0].tag) - 1 && tag[i]; i++)
+    trace->ent[trace->num].tag[i] = tag[i];
+  trace->ent[trace->num++].tag[i] = 0;
+}
+
+void boot_trace (const char *tag)
+{
+  boot_trace_at(tag, boot_trace_us());
+}
+
+/* One "trace <us> <delta> <tag>" line per event, tools/boottrace reads it */
+void boot_trace_dump (void)
+{
+  u32 i, t = 0;
+  if(trace->magic != TRACE_MAGIC) return;
+  for(i = 0; i < trace->num; i++)
+  {
+    printf("trace %8u %8u %s\n", trace->ent[i].us, trace->ent[i].us - t,
+      trace->ent[i].tag);
+    t = trace->ent[i].us;
+  }
+}
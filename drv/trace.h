@@ -0,0 +1,31 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+/* Boot trace log in the unused 64K above stack_und (see link.ld), it is
+   written by the SPL after DRAM init and kept by the application */
+#ifdef RAMSIZE64M
+#define TRACE_ADDR  (0x84000000 - 0x10000)
+#else
+#define TRACE_ADDR  (0x82000000 - 0x10000)
+#endif
+#define TRACE_MAGIC 0x45434154  // "TACE"
+#define TRACE_NUM   255
+
+struct TRACE {
+  u32 magic;
+  u32 num;
+  u32 res[2];
+  struct {
+    u32 us;                     // Timer2 time since the SPL entry
+    char tag[12];
+  } ent[TRACE_NUM];
+};
+
+void boot_trace_start (void);
+void boot_trace_init (void);
+u32 boot_trace_us (void);
+void boot_trace_at (const char *tag, u32 us);
+void boot_trace (const char *tag);
+void boot_trace_dump (void);
+
+#endif
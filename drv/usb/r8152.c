@@ -18,11 +18,14 @@ int ctrl_msg (u32 w1, u32 w2, void *data);
 #define usb_rcvctrlpipe(dev, endpoint) 0
 #define usb_sndctrlpipe(dev, endpoint) 0
 
+static u32 ocp_xfers;
+
 int usb_control_msg(u8 dev, unsigned int pipe,
 			unsigned char request, unsigned char requesttype,
 			unsigned short value, unsigned short index,
 			void *data, unsigned short size, int timeout)
 {
+  ocp_xfers++;
   return ctrl_msg(requesttype | (request << 8) | (value << 16),
     index | (size << 16), data);
 }
@@ -45,28 +48,93 @@ static const struct r8152_version r8152_versions[] = {
 	{ 0x6010, RTL_VER_09, 1 },
 };
 
+/* EP0 moves its data by PIO, no DMA bounce buffer is needed */
 static
 int get_registers(struct r8152 *tp, u16 value, u16 index, u16 size, void *data)
 {
-	ALLOC_CACHE_ALIGN_BUFFER(void *, tmp, size);
-	int ret;
-
-	ret = usb_control_msg(tp->udev, usb_rcvctrlpipe(tp->udev, 0),
-		RTL8152_REQ_GET_REGS, RTL8152_REQT_READ,
-		value, index, tmp, size, 500);
-	memcpy(data, tmp, size);
-	return ret;
+	return usb_control_msg(tp->udev, usb_rcvctrlpipe(tp->udev, 0),
+			       RTL8152_REQ_GET_REGS, RTL8152_REQT_READ,
+			       value, index, data, size, 500);
 }
 
 static
 int set_registers(struct r8152 *tp, u16 value, u16 index, u16 size, void *data)
 {
-	ALLOC_CACHE_ALIGN_BUFFER(void *, tmp, size);
-
-	memcpy(tmp, data, size);
 	return usb_control_msg(tp->udev, usb_sndctrlpipe(tp->udev, 0),
 			       RTL8152_REQ_SET_REGS, RTL8152_REQT_WRITE,
-			       value, index, tmp, size, 500);
+			       value, index, data, size, 500);
+}
+
+/* Shadow copies of configuration registers only the driver changes, read
+   back on every link change. Status registers must never be listed here.
+   An entry holds the dword the register is in and which of the register's
+   own bytes are known, the other bytes of the dword come from the device */
+static struct ocp_shadow {
+	u16 type;
+	u16 index;
+	u8 size;
+	u8 valid;
+	u32 data;
+} ocp_shadow[] = {
+	{ MCU_TYPE_PLA, PLA_RCR, 4 },
+	{ MCU_TYPE_PLA, PLA_FMC, 2 },
+	{ MCU_TYPE_PLA, PLA_MISC_1, 2 },
+	{ MCU_TYPE_PLA, PLA_EEEP_CR, 2 },
+};
+
+static u32 ocp_byen_mask(u8 byen)
+{
+	u32 mask = 0;
+	int i;
+
+	for (i = 0; i < 4; i++)
+		if (byen & (1 << i))
+			mask |= 0xffU << (i * 8);
+	return mask;
+}
+
+/* The dword at index if the bytes byen of it are all shadowed */
+static bool ocp_shadow_get(u16 type, u16 index, u8 byen, u32 *data)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(ocp_shadow); i++)
+		if (ocp_shadow[i].type == type &&
+		    (ocp_shadow[i].index & ~3) == index &&
+		    (ocp_shadow[i].valid & byen) == byen) {
+			*data = ocp_shadow[i].data;
+			return true;
+		}
+	return false;
+}
+
+/* The bytes byen of the dword at index were read or written: the ones of
+   shadowed registers are kept */
+static void ocp_shadow_put(u16 type, u16 index, u8 byen, u32 data)
+{
+	struct ocp_shadow *sh;
+	u32 mask;
+	u8 own;
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(ocp_shadow); i++) {
+		sh = &ocp_shadow[i];
+		if (sh->type != type || (sh->index & ~3) != index)
+			continue;
+		own = byen & (((1 << sh->size) - 1) << (sh->index & 3));
+		mask = ocp_byen_mask(own);
+		sh->data = (sh->data & ~mask) | (data & mask);
+		sh->valid |= own;
+	}
+}
+
+/* A NIC reset or a new device: registers are read from the device again */
+static void ocp_shadow_reset(void)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(ocp_shadow); i++)
+		ocp_shadow[i].valid = 0;
 }
 
 int generic_ocp_read(struct r8152 *tp, u16 index, u16 size,
@@ -161,18 +229,31 @@ int pla_ocp_write(struct r8152 *tp, u16 index, u16 byteen, u16 size, void *data)
 
 u32 ocp_read_dword(struct r8152 *tp, u16 type, u16 index)
 {
-	__le32 data = 0;
+	u32 data;
+	__le32 tmp = 0;
 
-	generic_ocp_read(tp, index, sizeof(data), &data, type);
+	if (ocp_shadow_get(type, index, BYTE_EN_START_MASK, &data))
+		return data;
+
+	generic_ocp_read(tp, index, sizeof(tmp), &tmp, type);
 
-	return __le32_to_cpu(data);
+	data = __le32_to_cpu(tmp);
+	ocp_shadow_put(type, index, BYTE_EN_START_MASK, data);
+
+	return data;
 }
 
 void ocp_write_dword(struct r8152 *tp, u16 type, u16 index, u32 data)
 {
 	__le32 tmp = __cpu_to_le32(data);
+	u32 old;
+
+	if (ocp_shadow_get(type, index, BYTE_EN_START_MASK, &old) && old == data)
+		return;
 
 	generic_ocp_write(tp, index, BYTE_EN_DWORD, sizeof(tmp), &tmp, type);
+
+	ocp_shadow_put(type, index, BYTE_EN_START_MASK, data);
 }
 
 u16 ocp_read_word(struct r8152 *tp, u16 type, u16 index)
@@ -180,12 +261,16 @@ u16 ocp_read_word(struct r8152 *tp, u16 type, u16 index)
 	u32 data;
 	__le32 tmp = 0;
 	u8 shift = index & 2;
+	u8 byen = (BYTE_EN_WORD << shift) & BYTE_EN_START_MASK;
 
 	index &= ~3;
 
-	generic_ocp_read(tp, index, sizeof(tmp), &tmp, type);
+	if (!ocp_shadow_get(type, index, byen, &data)) {
+		generic_ocp_read(tp, index, sizeof(tmp), &tmp, type);
+		data = __le32_to_cpu(tmp);
+		ocp_shadow_put(type, index, BYTE_EN_START_MASK, data);
+	}
 
-	data = __le32_to_cpu(tmp);
 	data >>= (shift * 8);
 	data &= 0xffff;
 
@@ -195,6 +280,7 @@ u16 ocp_read_word(struct r8152 *tp, u16 type, u16 index)
 void ocp_write_word(struct r8152 *tp, u16 type, u16 index, u32 data)
 {
 	u32 mask = 0xffff;
+	u32 old;
 	__le32 tmp;
 	u16 byen = BYTE_EN_WORD;
 	u8 shift = index & 2;
@@ -208,9 +294,15 @@ void ocp_write_word(struct r8152 *tp, u16 type, u16 index, u32 data)
 		index &= ~3;
 	}
 
+	if (ocp_shadow_get(type, index, byen & BYTE_EN_START_MASK, &old) &&
+	    !((old ^ data) & mask))
+		return;
+
 	tmp = __cpu_to_le32(data);
 
 	generic_ocp_write(tp, index, byen, sizeof(tmp), &tmp, type);
+
+	ocp_shadow_put(type, index, byen & BYTE_EN_START_MASK, data);
 }
 
 u8 ocp_read_byte(struct r8152 *tp, u16 type, u16 index)
@@ -218,12 +310,16 @@ u8 ocp_read_byte(struct r8152 *tp, u16 type, u16 index)
 	u32 data;
 	__le32 tmp = 0;
 	u8 shift = index & 3;
+	u8 byen = (BYTE_EN_BYTE << shift) & BYTE_EN_START_MASK;
 
 	index &= ~3;
 
-	generic_ocp_read(tp, index, sizeof(tmp), &tmp, type);
+	if (!ocp_shadow_get(type, index, byen, &data)) {
+		generic_ocp_read(tp, index, sizeof(tmp), &tmp, type);
+		data = __le32_to_cpu(tmp);
+		ocp_shadow_put(type, index, BYTE_EN_START_MASK, data);
+	}
 
-	data = __le32_to_cpu(tmp);
 	data >>= (shift * 8);
 	data &= 0xff;
 
@@ -233,6 +329,7 @@ u8 ocp_read_byte(struct r8152 *tp, u16 type, u16 index)
 void ocp_write_byte(struct r8152 *tp, u16 type, u16 index, u32 data)
 {
 	u32 mask = 0xff;
+	u32 old;
 	__le32 tmp;
 	u16 byen = BYTE_EN_BYTE;
 	u8 shift = index & 3;
@@ -246,9 +343,45 @@ void ocp_write_byte(struct r8152 *tp, u16 type, u16 index, u32 data)
 		index &= ~3;
 	}
 
+	if (ocp_shadow_get(type, index, byen & BYTE_EN_START_MASK, &old) &&
+	    !((old ^ data) & mask))
+		return;
+
 	tmp = __cpu_to_le32(data);
 
 	generic_ocp_write(tp, index, byen, sizeof(tmp), &tmp, type);
+
+	ocp_shadow_put(type, index, byen & BYTE_EN_START_MASK, data);
+}
+
+/* Writes a table of register, value pairs: runs of consecutive words go in
+   one burst. Only for plain registers such as the breakpoints, ports like
+   the PHY RAM code ones need a transfer per write */
+void ocp_write_words(struct r8152 *tp, u16 type, const u16 *tbl, int n)
+{
+	u8 buf[64];
+	u16 start, byen;
+	int i, j, k;
+
+	for (i = 0; i < n; i = j) {
+		start = tbl[i] & ~3;
+		for (j = i + 2; j < n && tbl[j] == tbl[j - 2] + 2 &&
+		     (tbl[j] & ~3) + 4 - start <= sizeof(buf); j += 2)
+			;
+		if (j == i + 2) {
+			ocp_write_word(tp, type, tbl[i], tbl[i + 1]);
+			continue;
+		}
+		for (k = i; k < j; k += 2) {
+			buf[tbl[k] - start] = tbl[k + 1];
+			buf[tbl[k] - start + 1] = tbl[k + 1] >> 8;
+			ocp_shadow_put(type, tbl[k] & ~3, 3 << (tbl[k] & 2),
+				       (u32)tbl[k + 1] << ((tbl[k] & 2) * 8));
+		}
+		byen = (tbl[i] & 2 ? 0x0c : 0x0f) | (tbl[j - 2] & 2 ? 0xf0 : 0x30);
+		generic_ocp_write(tp, start, byen, (tbl[j - 2] & ~3) + 4 - start,
+				  buf, type);
+	}
 }
 
 u16 ocp_reg_read(struct r8152 *tp, u16 addr)
@@ -491,6 +624,8 @@ static void rtl8152_nic_reset(struct r8152 *tp)
 				 BIST_CTRL_SW_RESET, 0, R8152_WAIT_TIMEOUT);
 	if (ret)
 		debug("Timeout waiting for NIC reset\n");
+
+	ocp_shadow_reset();
 }
 
 static void r8152b_exit_oob(struct r8152 *tp)
@@ -754,6 +889,9 @@ u8 rtl8152_get_speed (void)
 
 int r8152_probe (unsigned char *mac)
 {
+  ocp_shadow_reset();
+  tp.ocp_base = 0;
+  ocp_xfers = 0;
   r8152b_get_version(&tp);
   debug("RTL8152 (vers.%d)\n", tp.version);
   r8152b_init(&tp);
@@ -761,6 +899,7 @@ int r8152_probe (unsigned char *mac)
 	rtl8152_set_speed(&tp, AUTONEG_ENABLE,
 			  tp.supports_gmii ? SPEED_1000 : SPEED_100, DUPLEX_FULL);
   r8152_write_hwaddr(&tp, mac);
+  debug("RTL8152 up: %d control transfers\n", ocp_xfers);
   return tp.version;
 }
 
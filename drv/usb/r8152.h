@@ -780,6 +780,8 @@ void ocp_write_word(struct r8152 *tp, u16 type, u16 index, u32 data);
 u8 ocp_read_byte(struct r8152 *tp, u16 type, u16 index);
 void ocp_write_byte(struct r8152 *tp, u16 type, u16 index, u32 data);
 
+void ocp_write_words(struct r8152 *tp, u16 type, const u16 *tbl, int n);
+
 u16 ocp_reg_read(struct r8152 *tp, u16 addr);
 void ocp_reg_write(struct r8152 *tp, u16 addr, u16 data);
 
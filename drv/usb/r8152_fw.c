@@ -947,8 +947,6 @@ static void r8153_wdt1_end(struct r8152 *tp)
 
 void r8152b_firmware(struct r8152 *tp)
 {
-	int i;
-
 	if (tp->version == RTL_VER_01) {
 		int i;
 
@@ -959,10 +957,8 @@ void r8152b_firmware(struct r8152 *tp)
 				  sizeof(r8152b_pla_patch_a),
 				  r8152b_pla_patch_a, MCU_TYPE_PLA);
 
-		for (i = 0; i < ARRAY_SIZE(r8152b_pla_patch_a_bp); i += 2)
-			ocp_write_word(tp, MCU_TYPE_PLA,
-				       r8152b_pla_patch_a_bp[i],
-				       r8152b_pla_patch_a_bp[i+1]);
+		ocp_write_words(tp, MCU_TYPE_PLA, r8152b_pla_patch_a_bp,
+				ARRAY_SIZE(r8152b_pla_patch_a_bp));
 
 		ocp_write_word(tp, MCU_TYPE_PLA, PLA_OCP_GPHY_BASE, 0x2000);
 		ocp_write_word(tp, MCU_TYPE_PLA, 0xb092, 0x7070);
@@ -980,11 +976,8 @@ void r8152b_firmware(struct r8152 *tp)
 				  sizeof(r8152b_pla_patch_a2),
 				  r8152b_pla_patch_a2, MCU_TYPE_PLA);
 
-		for (i = 0; i < ARRAY_SIZE(r8152b_pla_patch_a2_bp);
-		     i += 2)
-			ocp_write_word(tp, MCU_TYPE_PLA,
-				       r8152b_pla_patch_a2_bp[i],
-				       r8152b_pla_patch_a2_bp[i+1]);
+		ocp_write_words(tp, MCU_TYPE_PLA, r8152b_pla_patch_a2_bp,
+				ARRAY_SIZE(r8152b_pla_patch_a2_bp));
 	}
 }
 
@@ -1020,10 +1013,8 @@ void r8153_firmware(struct r8152 *tp)
 				  sizeof(r8153_usb_patch_b),
 				  r8153_usb_patch_b, MCU_TYPE_USB);
 
-		for (i = 0; i < ARRAY_SIZE(r8153_usb_patch_b_bp); i += 2)
-			ocp_write_word(tp, MCU_TYPE_USB,
-				       r8153_usb_patch_b_bp[i],
-				       r8153_usb_patch_b_bp[i+1]);
+		ocp_write_words(tp, MCU_TYPE_USB, r8153_usb_patch_b_bp,
+				ARRAY_SIZE(r8153_usb_patch_b_bp));
 
 		if (!(ocp_read_word(tp, MCU_TYPE_PLA, 0xd38e) & BIT(0))) {
 			ocp_write_word(tp, MCU_TYPE_PLA, 0xd38c, 0x0082);
@@ -1037,10 +1028,8 @@ void r8153_firmware(struct r8152 *tp)
 				  sizeof(r8153_pla_patch_b),
 				  r8153_pla_patch_b, MCU_TYPE_PLA);
 
-		for (i = 0; i < ARRAY_SIZE(r8153_pla_patch_b_bp); i += 2)
-			ocp_write_word(tp, MCU_TYPE_PLA,
-				       r8153_pla_patch_b_bp[i],
-				       r8153_pla_patch_b_bp[i+1]);
+		ocp_write_words(tp, MCU_TYPE_PLA, r8153_pla_patch_b_bp,
+				ARRAY_SIZE(r8153_pla_patch_b_bp));
 
 		ocp_write_word(tp, MCU_TYPE_PLA, 0xd388, 0x08ca);
 	} else if (tp->version == RTL_VER_05) {
@@ -1068,10 +1057,8 @@ void r8153_firmware(struct r8152 *tp)
 				  sizeof(r8153_usb_patch_c),
 				  r8153_usb_patch_c, MCU_TYPE_USB);
 
-		for (i = 0; i < ARRAY_SIZE(r8153_usb_patch_c_bp); i += 2)
-			ocp_write_word(tp, MCU_TYPE_USB,
-				       r8153_usb_patch_c_bp[i],
-				       r8153_usb_patch_c_bp[i+1]);
+		ocp_write_words(tp, MCU_TYPE_USB, r8153_usb_patch_c_bp,
+				ARRAY_SIZE(r8153_usb_patch_c_bp));
 
 		if (ocp_read_byte(tp, MCU_TYPE_USB, 0xcfef) & 1) {
 			ocp_write_word(tp, MCU_TYPE_USB, 0xfc30, 0x1578);
@@ -1087,10 +1074,8 @@ void r8153_firmware(struct r8152 *tp)
 				  sizeof(r8153_pla_patch_c),
 				  r8153_pla_patch_c, MCU_TYPE_PLA);
 
-		for (i = 0; i < ARRAY_SIZE(r8153_pla_patch_c_bp); i += 2)
-			ocp_write_word(tp, MCU_TYPE_PLA,
-				       r8153_pla_patch_c_bp[i],
-				       r8153_pla_patch_c_bp[i+1]);
+		ocp_write_words(tp, MCU_TYPE_PLA, r8153_pla_patch_c_bp,
+				ARRAY_SIZE(r8153_pla_patch_c_bp));
 
 		ocp_write_word(tp, MCU_TYPE_PLA, 0xd388, 0x08ca);
 
@@ -1122,10 +1107,8 @@ void r8153_firmware(struct r8152 *tp)
 		generic_ocp_write(tp, 0xf800, 0xff, sizeof(usb_patch_d),
 				  usb_patch_d, MCU_TYPE_USB);
 
-		for (i = 0; i < ARRAY_SIZE(r8153_usb_patch_d_bp); i += 2)
-			ocp_write_word(tp, MCU_TYPE_USB,
-				       r8153_usb_patch_d_bp[i],
-				       r8153_usb_patch_d_bp[i+1]);
+		ocp_write_words(tp, MCU_TYPE_USB, r8153_usb_patch_d_bp,
+				ARRAY_SIZE(r8153_usb_patch_d_bp));
 
 		rtl_clear_bp(tp, MCU_TYPE_PLA);
 
@@ -1133,10 +1116,8 @@ void r8153_firmware(struct r8152 *tp)
 		generic_ocp_write(tp, 0xf800, 0xff, sizeof(pla_patch_d),
 				  pla_patch_d, MCU_TYPE_PLA);
 
-		for (i = 0; i < ARRAY_SIZE(r8153_pla_patch_d_bp); i += 2)
-			ocp_write_word(tp, MCU_TYPE_PLA,
-				       r8153_pla_patch_d_bp[i],
-				       r8153_pla_patch_d_bp[i + 1]);
+		ocp_write_words(tp, MCU_TYPE_PLA, r8153_pla_patch_d_bp,
+				ARRAY_SIZE(r8153_pla_patch_d_bp));
 
 		ocp_data = ocp_read_byte(tp, MCU_TYPE_USB, USB_USB2PHY);
 		ocp_data |= USB2PHY_L1 | USB2PHY_SUSPEND;
@@ -1151,7 +1132,6 @@ void r8153_firmware(struct r8152 *tp)
 void r8153b_firmware(struct r8152 *tp)
 {
 	u32 ocp_data;
-	int i;
 
 	if (tp->version != RTL_VER_09)
 		return;
@@ -1162,10 +1142,8 @@ void r8153b_firmware(struct r8152 *tp)
 	generic_ocp_write(tp, 0xe600, 0xff, sizeof(usb_patch2_b),
 			  usb_patch2_b, MCU_TYPE_USB);
 
-	for (i = 0; i < ARRAY_SIZE(r8153b_usb_patch_b_bp); i += 2)
-		ocp_write_word(tp, MCU_TYPE_USB,
-			       r8153b_usb_patch_b_bp[i],
-			       r8153b_usb_patch_b_bp[i + 1]);
+	ocp_write_words(tp, MCU_TYPE_USB, r8153b_usb_patch_b_bp,
+			ARRAY_SIZE(r8153b_usb_patch_b_bp));
 
 	rtl_clear_bp(tp, MCU_TYPE_PLA);
 
@@ -1173,10 +1151,8 @@ void r8153b_firmware(struct r8152 *tp)
 	generic_ocp_write(tp, 0xf800, 0xff, sizeof(pla_patch2_b),
 			  pla_patch2_b, MCU_TYPE_PLA);
 
-	for (i = 0; i < ARRAY_SIZE(r8153b_pla_patch_b_bp); i += 2)
-		ocp_write_word(tp, MCU_TYPE_PLA,
-			       r8153b_pla_patch_b_bp[i],
-			       r8153b_pla_patch_b_bp[i + 1]);
+	ocp_write_words(tp, MCU_TYPE_PLA, r8153b_pla_patch_b_bp,
+			ARRAY_SIZE(r8153b_pla_patch_b_bp));
 
 	ocp_data = ocp_read_byte(tp, MCU_TYPE_USB, USB_USB2PHY);
 	ocp_data |= USB2PHY_L1 | USB2PHY_SUSPEND;
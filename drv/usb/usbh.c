@@ -76,97 +76,21 @@ void usbh_init (void)
   dev_usb = 0;
 }
 
-int wait_csr (u8 ep, u32 mask, u32 event, u32 timeout)
-{
-  u8  cur_ep = USB->EP_IDX;
-  int res = OK;
-  USB->EP_IDX = ep & 127;
-  for(ctr_us = 0; res == OK; )
-  {
-    if(ep & IN)
-    { // ep in
-      if((USB->RXCSR & mask) == event) break;
-      res = USB->RXCSR & 0x14C; // RXERR_INCMP, RXERR_STALL, RX_NAKTOD, RXERR_TO
-    }
-    else if(ep & 127)
-    { // ep out
-      if((USB->TXCSR & mask) == event) break;
-      res = USB->TXCSR & 0xC4;  // TXERR_NAKTOINCMP, TXERR_STALL, 
-    }
-    else
-    { // ep0
-      if((USB->TXCSR & mask) == event) break;
-      res = USB->TXCSR & 0x94;  // EP0ERR_NAKTO, EP0ERR_TO, EP0ERR_STALL
-    }
-    if(USB->BUS_IS & 0xF7) res |= 0x4000;
-    if(ctr_us >= timeout) res |= 0x8000;
-  }
-  USB->EP_IDX = cur_ep;
-  return res;
-}
-
+/* Control transfer on EP0: w1 - bmRequestType, bRequest, wValue; w2 - wIndex,
+   wLength. Returns the bytes read, 1 for host-to-device, 0 on error */
 int ctrl_msg (u32 w1, u32 w2, void *data)
 {
-  int res = 0;
-  u8  *ptr = data, ep = USB->EP_IDX;
-  USB->EP_IDX = 0;
+  struct URB urb = { .ep = 0, .setup = { w1, w2 }, .buf = data };
   PUTF("CTRL -> %08X %08X ", __builtin_bswap32(w1), __builtin_bswap32(w2));
-  USB->FIFO[0].word32 = w1;
-  USB->FIFO[0].word32 = w2;
-  w2 >>= 16;
-  USB->TXCSR = 0x0A;            // SetupPkt | TxPktRdy
-  if(wait_csr(0, 2, 0, 500000) == OK)
+  usbh_submit(&urb);
+  if(usbh_wait(&urb, 500) != OK)
   {
-    if(w1 & 0x80) // Device-to-host
-    {
-      if(w2) PUTF("<-");
-      while(w2)
-      {
-        USB->TXCSR |= 0x20;     // ReqPkt
-        if(wait_csr(0, 0x20, 0, 500000) != OK) return 0;
-        w2 -= USB->RXCOUNT;
-        PUTF("%d ", USB->RXCOUNT);
-        PUTF(" (%02X,%d)", USB->TXCSR, USB->RXCOUNT);
-        if(!USB->RXCOUNT) break;
-        while(USB->RXCOUNT) ptr[res++] = USB->FIFO[0].byte;
-      }
-      USB->TXCSR &= ~1;
-      PUTF("csr_%02X ", USB->TXCSR);
-      USB->TXCSR |= 0x42;       // StatusPkt | TxPktRdy
-      if(wait_csr(0, 2, 0, 500000) != OK) return 0;
-      USB->EP_IDX = ep;
-      for(int i = 0; i < res; i++) PUTF(" %02X", ptr[i]);
-      PUTC('\n');
-      return res;
-    }
-    else  // Host-to-device
-    {
-      while(res < w2)
-      {
-        USB->TXCSR &= ~2;
-        for(int i = 0; i < 64 && res < w2; i++) USB->FIFO[0].byte = ptr[res++];
-        USB->TXCSR |= 2;        // TxPktRdy
-        if(wait_csr(0, 2, 0, 500000) != OK)
-        {
-          puts("txpkt error");
-          while(1);
-        }
-      }
-      PUTF("csr_%02X ", USB->TXCSR);
-      USB->TXCSR |= 0x60;       // StatusPkt | ReqPkt
-      if(wait_csr(0, 1, 1, 500000) == OK)
-      {
-        PUTF("csr_%02X ", USB->TXCSR);
-        USB->TXCSR &= ~0x41;
-        USB->EP_IDX = ep;
-        PUTC('\n');
-        return 1;
-      }
-      else PUTS("stat error");
-    }
+    PUTF("err_%04X\n", urb.status);
+    return 0;
   }
-  USB->EP_IDX = ep;
-  return 0;
+  for(int i = 0; i < urb.act; i++) PUTF(" %02X", urb.buf[i]);
+  PUTC('\n');
+  return w1 & 0x80 ? urb.act : 1;
 }
 
 int get_dev_dsc (DSC_DEV *ptr)
@@ -217,7 +141,7 @@ static void usb_reset (void)
   USB->TXFUNCADDR = 0;
   USB->TXHUBADDR = 0;
   USB->TXHUBPORT = 0;
-  USB->TXINTERVAL = 0;
+  USB->TXINTERVAL = URB_NAKLIM;       // EP0 NAK limit
 }
 
 static void print_str_dsc (char *str, u8 *ptr)
@@ -267,14 +191,17 @@ void usbh_handler (void)
     delay(250);
     USB->DEVCTL |= 1;
     USB->BUS_IS = 0xFF;
+    usbh_cancel(0, 0x4000);
+    usbh_cancel(OUT | 1, 0x4000);
+    usbh_cancel(IN | 1, 0x4000);
+    usbh_cancel(IN | 2, 0x4000);
     #ifdef USBH_NET
     if(dev_usb == 2) usbh_net_deinit();
     #endif
     dev_usb = 0;
   }
-  isr = USB->EP_IS;
-  if(isr) USB->EP_IS = isr;
+  usbh_poll();
   #ifdef USBH_NET
-  if(dev_usb == 2) usbh_net_handler(isr);
+  if(dev_usb == 2) usbh_net_handler();
   #endif
 }
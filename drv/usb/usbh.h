@@ -6,13 +6,65 @@
 #define OUT 0
 #define IN  128
 
+/* Endpoint FIFO RAM: EP0, the bulk pair of EP1 double-buffered, EP2 RX */
+#define FIFO_EP0  0
+#define FIFO_TX1  64
+#define FIFO_RX1  (FIFO_TX1 + 2 * 512)
+#define FIFO_RX2  (FIFO_RX1 + 2 * 512)
+#define FIFO_END  (FIFO_RX2 + 64)
+#define FIFO_DB   (1 << 4)  // TXFIFOSZ/RXFIFOSZ: double buffering
+
+#define URB_BUSY  (-1)
+#define URB_NAKLIM  12      // bulk NAK limit: 2 ^ (12 - 1) microframes, 256mS
+
+/* A piece of a bulk OUT transfer gathered at the FIFO */
+struct URB_SEG {
+  const u8 *ptr;
+  u32 len;
+};
+
+/* USB request block: a transfer queued on EP0, on the bulk pair of EP1 or on
+   the interrupt IN of EP2, moved packet by packet from the USB interrupt */
+struct URB {
+  struct URB *next;
+  u8  ep;                 // 0 - control, 1 | IN, 1 | OUT, 2 | IN - interrupt
+  u8  dma;                // whole packets by DDMA0 when it is free
+  u8  stage;
+  u16 naks;               // NAK limit expiries left, 0 - retry forever
+  u32 setup[2];           // control request
+  u8  *buf;
+  const struct URB_SEG *seg;  // bulk OUT by PIO from these pieces instead of buf
+  u32 len;
+  u32 act;                // bytes transferred
+  u32 sidx, soff;         // piece and offset reached in seg
+  volatile int status;    // URB_BUSY, OK or the CSR error bits
+  void (*done) (struct URB *urb);   // called from the interrupt
+  void *ctx;
+};
+
+struct USBH_STAT {
+  u32 urbs;               // URBs completed
+  u32 irqs;               // service passes with endpoint events
+  u32 naks;               // NAK limit expiries retried
+  u32 pio;                // bulk bytes moved by the CPU
+  u32 dma;                // bulk bytes moved by DDMA0
+  u32 wait;               // uS spent in usbh_wait(), CPU idle with usbh_irq(1)
+};
+
 extern u8 dev_usb;
+extern struct USBH_STAT usbh_stat;
 
 void usbh_init (void);
 void usbh_handler (void);
 
+void usbh_irq (int en);
+void usbh_isr (void);
+void usbh_poll (void);
+int usbh_submit (struct URB *urb);
+void usbh_cancel (u8 ep, int status);
+int usbh_wait (struct URB *urb, u32 timeout);
+
 int set_cfg (u8 cfg);
 int ctrl_msg (u32 w1, u32 w2, void *data);
-int wait_csr (u8 ep, u32 mask, u32 event, u32 timeout);
 
 #endif
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include <stdio.h>
+#include <string.h>
 #include "sys.h"
-#include "usbh.h"
+#include "mmu.h"
+#include "usbh_msc.h"
 #include "usb_msc.h"
 
 #if 1
@@ -13,8 +15,25 @@
 #define PUTF(...)
 #endif
 
+#define MSC_MAX_BLKS    128             // blocks per READ(10)/WRITE(10)
+#define MSC_RA_BLKS     64              // read-ahead window
+#define MSC_WC_BLKS     64              // write-combining buffer
+
 CSW csw;
 u8 msc_bulk_in, msc_bulk_out;
+struct MSC_STAT msc_stat;
+static u8 msc_dma = 1;
+
+/* Small sequential reads are served from a read-ahead window, small
+   writes are gathered until they stop being contiguous */
+static struct {
+  u32 ra[MSC_RA_BLKS * 128] __attribute__((aligned(CACHE_LINE_SIZE)));
+  u32 wc[MSC_WC_BLKS * 128] __attribute__((aligned(CACHE_LINE_SIZE)));
+  u32 ra_lba, ra_cnt;
+  u32 wc_lba, wc_cnt;
+  u32 next;                           // block after the last read
+  u32 blocks;                         // device capacity
+} cache;
 
 #define _CBW_(_cmd, _dir) \
   .signature = CBW_SIGNATURE, .tag = _cmd, \
@@ -41,62 +60,37 @@ static CBW reqsense_cbw = {
 int msc_reset (void)
 {
   int res = ctrl_msg(0x0000FF21, 0x00000000, NULL);
+  USB->EP_IDX = 1;
   USB->TXCSR = 0x0048;
+  USB->TXCSR = 0x0048;  // flush both buffers
   USB->RXCSR = 0x0090;  // clr data toggle
+  USB->RXCSR = 0x0010;
   ctrl_msg(0x00000102, msc_bulk_in, NULL),
   ctrl_msg(0x00000102, msc_bulk_out, NULL);
   return res;
 }
 
-int bulk_out (void *ptr, u32 len)
+/* Bulk stages go through the EP1 queues, aligned runs of whole packets by
+   DDMA0 */
+static int bulk (u8 ep, void *ptr, u32 len)
 {
-  int i, res = OK;
-  while(len && res == OK)
-  {
-    i = len > 512 ? 512 : len;
-    len -= i;
-    while(i--) USB->FIFO[1].byte = *(u8*)ptr++;
-    USB->TXCSR = 1;       // TxPktRdy
-    res = wait_csr(OUT | 1, 1, 0, 5000000);
-  }
-  return res;
+  struct URB urb = { .ep = ep | 1, .dma = msc_dma, .buf = ptr, .len = len };
+  usbh_submit(&urb);
+  return usbh_wait(&urb, 5000);
 }
 
-int bulk_in (void *ptr, u32 len)
+void usbh_msc_dma (int en)
 {
-  while(len)
-  {
-    USB->RXCSR = 32;
-    if(wait_csr(IN | 1, 1, 1, 5000000) != OK) return KO;
-    len -= USB->RXCOUNT;
-    if(USB->RXCOUNT & 3 || (u32)ptr & 3)
-      while(USB->RXCOUNT--) *(u8*)ptr++ = USB->FIFO[1].byte;
-    else
-    {
-      while(USB->RXCOUNT)
-      {
-        *(u32*)ptr = USB->FIFO[1].word32;
-        ptr += 4;
-        USB->RXCOUNT -= 4;
-      }
-    }
-  }
-  return OK;
+  msc_dma = en ? 1 : 0;
 }
 
 int msc_xfer (CBW *cbw, void *dat)
 {
-  if(bulk_out(cbw, sizeof(CBW)) == OK)
+  msc_stat.cmds++;
+  if(bulk(OUT, cbw, sizeof(CBW)) == OK)
   {
-    if(cbw->dir == IN)
-    {
-      if(bulk_in(dat, cbw->total_bytes) != OK) msc_reset();
-    }
-    else
-    {
-      if(bulk_out(dat, cbw->total_bytes) != OK) msc_reset();
-    }
-    if(bulk_in(&csw, sizeof(csw)) == OK && !csw.status) return OK;
+    if(bulk(cbw->dir, dat, cbw->total_bytes) != OK) msc_reset();
+    if(bulk(IN, &csw, sizeof(csw)) == OK && !csw.status) return OK;
   }
   msc_reset();
   return KO;
@@ -113,19 +107,84 @@ int msc_cmd (CBW *cbw, void *dat)
   return KO;
 }
 
+/* READ(10)/WRITE(10) of up to MSC_MAX_BLKS blocks per command */
+static int msc_rw (void *ptr, u32 addr, u32 cnt, u8 dir)
+{
+  CBW cbw = { CBW_SIGNATURE, 0, 0, dir, 0, sizeof(RD10_CMD) };
+  u32 n;
+  for(; cnt; cnt -= n, addr += n, ptr += n * 512)
+  {
+    n = cnt > MSC_MAX_BLKS ? MSC_MAX_BLKS : cnt;
+    cbw.tag = dir == IN ? RD10 : WR10;
+    cbw.total_bytes = n * 512;
+    cbw.cb.rd10 = (RD10_CMD){ cbw.tag, 0, __builtin_bswap32(addr), 0, __builtin_bswap16(n), 0 };
+    if(msc_cmd(&cbw, ptr) != OK) return KO;
+    msc_stat.data += n * 512;
+  }
+  return OK;
+}
+
+int usbh_msc_sync (void)
+{
+  u32 n = cache.wc_cnt;
+  cache.wc_cnt = 0;
+  return n ? msc_rw(cache.wc, cache.wc_lba, n, OUT) : OK;
+}
+
+static int overlap (u32 a, u32 n, u32 b, u32 m)
+{
+  return n && m && a < b + m && b < a + n;
+}
+
 int usbh_msc_read (void *ptr, u32 addr, u32 cnt)
 {
-  CBW cbw = { CBW_SIGNATURE, RD10, cnt * 512, IN, 0, sizeof(RD10_CMD),
-    .cb.rd10 = { RD10, 0, __builtin_bswap32(addr), 0, __builtin_bswap16(cnt), 0 }};
-  msc_cmd(&cbw, ptr);
-  return cnt;
+  u8 *dst = ptr;
+  u32 n, res = cnt;
+  if(overlap(addr, cnt, cache.wc_lba, cache.wc_cnt) && usbh_msc_sync() != OK) return 0;
+  while(cnt)
+  {
+    if(addr >= cache.ra_lba && addr < cache.ra_lba + cache.ra_cnt)
+    {
+      n = cache.ra_lba + cache.ra_cnt - addr;
+      if(n > cnt) n = cnt;
+      memcpy(dst, &cache.ra[(addr - cache.ra_lba) * 128], n * 512);
+      msc_stat.ra += n;
+    }
+    else if(addr == cache.next && cnt < MSC_RA_BLKS && addr + cnt <= cache.blocks)
+    {                                 // sequential: fetch the window
+      n = cache.blocks - addr < MSC_RA_BLKS ? cache.blocks - addr : MSC_RA_BLKS;
+      cache.ra_cnt = 0;
+      if(overlap(addr, n, cache.wc_lba, cache.wc_cnt) && usbh_msc_sync() != OK) return 0;
+      if(msc_rw(cache.ra, addr, n, IN) != OK) return 0;
+      cache.ra_lba = addr;
+      cache.ra_cnt = n;
+      continue;
+    }
+    else if(msc_rw(dst, addr, n = cnt, IN) != OK) return 0;
+    addr += n;
+    dst += n * 512;
+    cnt -= n;
+    cache.next = addr;
+  }
+  return res;
 }
 
 int usbh_msc_write (void *ptr, u32 addr, u32 cnt)
 {
-  CBW cbw = { CBW_SIGNATURE, WR10, cnt * 512, OUT, 0, sizeof(WR10_CMD),
-    .cb.wr10 = { WR10, 0, __builtin_bswap32(addr), 0, __builtin_bswap16(cnt), 0 }};
-  msc_cmd(&cbw, ptr);
+  if(overlap(addr, cnt, cache.ra_lba, cache.ra_cnt)) cache.ra_cnt = 0;
+  if(cache.wc_cnt && addr >= cache.wc_lba && addr <= cache.wc_lba + cache.wc_cnt &&
+    addr + cnt <= cache.wc_lba + MSC_WC_BLKS)
+  {                                   // appends to or rewrites the gathered run
+    memcpy(&cache.wc[(addr - cache.wc_lba) * 128], ptr, cnt * 512);
+    if(addr + cnt > cache.wc_lba + cache.wc_cnt) cache.wc_cnt = addr + cnt - cache.wc_lba;
+    msc_stat.wc += cnt;
+    return cnt;
+  }
+  if(usbh_msc_sync() != OK) return 0;
+  if(cnt >= MSC_WC_BLKS) return msc_rw(ptr, addr, cnt, OUT) == OK ? cnt : 0;
+  memcpy(cache.wc, ptr, cnt * 512);
+  cache.wc_lba = addr;
+  cache.wc_cnt = cnt;
   return cnt;
 }
 
@@ -143,20 +202,24 @@ int usbh_msc_init (DSC_CFG *cfg_dsc)
   if(ep_dsc->bEndpointAddress & IN) msc_bulk_in = ep_dsc->bEndpointAddress;
   else msc_bulk_out = ep_dsc->bEndpointAddress;
   set_cfg(1);
+  CCU->BUS_CLK_GATING0 |= (1 << 6);   // DMA
+  CCU->BUS_SOFT_RST0 |= (1 << 6);
   ctrl_msg(0x0000FEA1, 0x00010000, &maxlun);
   USB->EP_IDX = 1;      // out ep: host -> device
   USB->TXFUNCADDR = 1;  // address @ bus
   USB->TXTYPE = (1 << 6) | (2 << 4) | (msc_bulk_out & 127); // !!! setup speed
   USB->TXMAXP = 512;    //dsc.ep1.wMaxPacketSize;
-  USB->TXFIFOADDR = 64 / 8;
-  USB->TXFIFOSZ = 6;
+  USB->TXFIFOADDR = FIFO_TX1 / 8;
+  USB->TXFIFOSZ = FIFO_DB | 6;  // 2 x 512
   USB->TXCSR = 0x0048;
+  USB->TXINTERVAL = URB_NAKLIM;
   USB->RXFUNCADDR = 1;  // address @ bus
   USB->RXTYPE = (1 << 6) | (2 << 4) | (msc_bulk_in & 127);
   USB->RXMAXP = 512;    //dsc.ep1.wMaxPacketSize;
-  USB->RXFIFOADDR = (512 + 64) / 8;  // addr * 8
-  USB->RXFIFOSZ = 6;    // 2 ^ (size + 3)
+  USB->RXFIFOADDR = FIFO_RX1 / 8;    // addr * 8
+  USB->RXFIFOSZ = FIFO_DB | 6;       // 2 x 2 ^ (size + 3)
   USB->RXCSR = 0x0080;  // clr data toggle
+  USB->RXINTERVAL = URB_NAKLIM;
   if(msc_cmd(&inquiry_cbw, &inquiry_res) != OK ||
      msc_cmd(&rd_capacity_cbw, &rdcap_res) != OK)
   {
@@ -164,6 +227,10 @@ int usbh_msc_init (DSC_CFG *cfg_dsc)
     return KO;
   }
   if(!(__builtin_bswap32(rdcap_res.last_lba) / (2 * 1024))) return KO;
+  cache.blocks = __builtin_bswap32(rdcap_res.last_lba) + 1;
+  cache.ra_cnt = 0;
+  cache.wc_cnt = 0;
+  cache.next = 0;
   PUTF("Capacity: %dMB\n",
     __builtin_bswap32(rdcap_res.last_lba) / (2 * 1024));
   return OK;
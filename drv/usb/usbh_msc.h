@@ -3,8 +3,19 @@
 
 #include "usbh.h"
 
+struct MSC_STAT {
+  u32 cmds;         // SCSI commands (CBW + CSW, 44 bytes and 2 round trips each)
+  u32 data;         // READ(10)/WRITE(10) payload bytes
+  u32 ra;           // blocks read from the read-ahead window
+  u32 wc;           // blocks gathered into a pending write
+};
+
+extern struct MSC_STAT msc_stat;
+
 int usbh_msc_init (DSC_CFG *cfg_dsc);
 int usbh_msc_read (void *ptr, u32 addr, u32 cnt);
 int usbh_msc_write (void *ptr, u32 addr, u32 cnt);
+int usbh_msc_sync (void);
+void usbh_msc_dma (int en);
 
 #endif
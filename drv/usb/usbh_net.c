@@ -6,6 +6,7 @@
 #include "r8152.h"
 #include "usbh_net.h"
 #include "netif/etharp.h"
+#include "lwip/inet_chksum.h"
 
 #if 1
 #define PUTC(ch)  putchar(ch)
@@ -17,86 +18,250 @@
 #define PUTF(...)
 #endif
 
-u8 ip_buf[32768];
+#define NET_RXBUF 16384             // bulk IN transfer, the device aggregates frames
+#define NET_RXN   8                 // transfer buffers, a power of 2
+#define NET_RXREF 64                // frames lent to lwIP
+#define NET_TXBUF 16384             // bulk OUT transfer, frames aggregated
+#define NET_TXN   3                 // transfers, on the bus and filling
+#define NET_TXF   64                // frames of a transfer
+#define NET_TXSEG 192               // pieces of a transfer
+#define TX_CUT    0xFFFFFFFF        // tx_csum(): the headers cross a pbuf
+
+/* TCP and IPv4 header checksums are generated by the device or tx_csum().
+   UDP stays in software: lwIP fragments datagrams after checksumming them */
+#define NET_CSUM  (NETIF_CHECKSUM_ENABLE_ALL & ~NETIF_CHECKSUM_GEN_TCP & ~NETIF_CHECKSUM_GEN_IP)
+
+/* A received frame handed to lwIP in place: a custom pbuf referencing its
+   transfer buffer, which is queued again when the last frame is freed */
+struct RX_REF {
+  struct pbuf_custom pc;
+  struct RX_REF *next;
+  u32 idx;
+};
+
+/* A bulk OUT transfer gathered at the FIFO: per frame its tx_desc, the
+   payloads of its pbuf chain, which are held until the transfer ends, and
+   the padding to TX_ALIGN */
+struct TX_AGG {
+  struct URB urb;
+  struct URB_SEG seg[NET_TXSEG];
+  struct pbuf *p[NET_TXF];
+  struct tx_desc desc[NET_TXF];
+  u32 len, segs, frames;
+  u8  out;                          // submitted
+};
+
+static u32 rx_buf[NET_RXN][NET_RXBUF / 4] __attribute__((aligned(32)));
+static struct TX_AGG tx[NET_TXN];
+static struct URB rx_urb[NET_RXN];
+static struct RX_REF rx_pool[NET_RXREF], *rx_free;
+static u8 rx_ref[NET_RXN];          // parser and frames holding the buffer
+static u8 rx_done[NET_RXN];         // completed transfers in bus order
+static volatile u32 rx_head;
+static u32 rx_tail, rx_queued;
+static u32 tx_idx, tx_last;         // transfer being filled, last on the bus
+static const u32 tx_pad;
+static struct URB int_urb;
+static u8 int_buf[INTBUFSIZE];
+static u8 lan_chk, lan_poll;        // read the PHY status, every 100mS
+struct NET_STAT net_stat;
 struct netif netif;
-u32 lan_tim, lan_con = 0, ip_idx = 0, eth_len = 0, usb_len = 0;
+u32 lan_tim, lan_con = 0;
+
+/* lwIP leaves the TCP and IPv4 header checksums at zero. For TCP over IPv4
+   the pseudo header sum is put in place, as Linux does, and the device
+   adds the segment and the header (IPV4_CS). Other IPv4 frames get their
+   header checksum here, so each header is summed once. The headers have to
+   be in the first pbuf of len bytes, TX_CUT if they are not and more follow */
+static u32 tx_csum (u8 *f, u32 len, int more)
+{
+  u32 hl, sum;
+  u8  *t;
+  if(len < 14 || f[12] != 0x08 || f[13] != 0) return 0;
+  if(len < 14 + 20) return more ? TX_CUT : 0;
+  hl = (f[14] & 15) * 4;
+  if(hl < 20) return 0;
+  if(14 + hl > len) return more ? TX_CUT : 0;
+  if(f[23] == 6 && !((f[20] & 0x3F) | f[21]) && 14 + hl + 20 > len && more) return TX_CUT;
+  if(f[23] != 6 || ((f[20] & 0x3F) | f[21]) || 14 + hl + 20 > len)
+  {                                     // fragment, UDP, ICMP...
+    f[24] = f[25] = 0;
+    *(u16*)&f[24] = inet_chksum(f + 14, hl);
+    return 0;
+  }
+  t = f + 14 + hl;
+  sum = (f[26] << 8 | f[27]) + (f[28] << 8 | f[29]) + (f[30] << 8 | f[31]) +
+    (f[32] << 8 | f[33]) + 6 + (f[16] << 8 | f[17]) - hl;
+  sum = (sum & 0xFFFF) + (sum >> 16);
+  sum = (sum & 0xFFFF) + (sum >> 16);
+  t[16] = sum >> 8;
+  t[17] = sum;
+  net_stat.tx_csum++;
+  return IPV4_CS | TCP_CS | ((14 + hl) << TCPHO_SHIFT);
+}
+
+/* The pbufs of a transfer that has ended are released */
+static void tx_free (struct TX_AGG *t)
+{
+  if(t->out && t->urb.status == URB_BUSY) return;
+  for(u32 i = 0; i < t->frames; i++) pbuf_free(t->p[i]);
+  t->len = t->segs = t->frames = t->out = 0;
+}
+
+static void tx_flush (void)
+{
+  struct TX_AGG *t = &tx[tx_idx];
+  t->urb = (struct URB){ .ep = OUT | 1, .seg = t->seg, .len = t->len };
+  t->out = 1;
+  usbh_submit(&t->urb);
+  tx_last = tx_idx;
+  tx_idx = (tx_idx + 1) % NET_TXN;
+  net_stat.tx_urbs++;
+}
 
+/* The transfer to fill, NULL while it is on the bus */
+static struct TX_AGG *tx_next (void)
+{
+  struct TX_AGG *t = &tx[tx_idx];
+  if(t->out) tx_free(t);
+  return t->out ? NULL : t;
+}
+
+/* Frames are queued with their descriptor into the transfer being filled and
+   written from their pbufs to the FIFO, the TX path copies nothing. The
+   transfer goes on the bus at once when the endpoint is idle, otherwise it
+   collects frames until the transfer ahead completes. A frame whose headers
+   cross its first pbuf is copied, tx_csum() needs them in one piece */
 static err_t net_snd (struct netif *netif, struct pbuf *p)
 {
-  u32 i, j, len = p->tot_len;
-  pbuf_copy_partial(p, ip_buf, len, 0);
-  if(lan_con)
+  struct TX_AGG *t;
+  struct tx_desc *d;
+  struct pbuf *q;
+  u32 opts, n, segs = 2;
+  if(!lan_con) return ERR_OK;
+  for(q = p; q; q = q->next) segs++;
+  n = ALIGN(sizeof(struct tx_desc) + p->tot_len, TX_ALIGN);
+  if(n > NET_TXBUF || segs > NET_TXSEG) return ERR_OK;
+  if((t = tx_next()) != NULL && (t->frames == NET_TXF || t->segs + segs > NET_TXSEG ||
+    t->len + n > NET_TXBUF))
   {
-    USB->EP_IDX = 1;
-    USB->FIFO[1].word32 = len | TX_FS | TX_LS;
-    USB->FIFO[1].word32 = 0;
-    i = 512 - 8;
-    for(j = 0; j < len; )
-    {
-      if((len - j) > 3)
-      {
-        USB->FIFO[1].word32 = *(u32*)&ip_buf[j];
-        j += 4;
-        i -= 4;
-      }
-      else
-      {
-        USB->FIFO[1].byte = ip_buf[j++];
-        i--;
-      }
-      if(!i || j == len)
-      {
-        USB->TXCSR = 1;
-        i = 512;
-        wait_csr(1, 1, 0, 5000000);
-      }
-    }
+    tx_flush();
+    t = tx_next();
+  }
+  if(!t)
+  {
+    net_stat.tx_drop++;               // every transfer on the bus, lwIP retransmits
+    return ERR_MEM;
   }
+  opts = tx_csum(p->payload, p->len, p->next != NULL);
+  if(opts == TX_CUT)
+  {
+    if((p = pbuf_clone(PBUF_RAW, PBUF_RAM, p)) == NULL) return ERR_MEM;
+    opts = tx_csum(p->payload, p->len, 0);
+  }
+  else pbuf_ref(p);
+  d = &t->desc[t->frames];
+  d->opts1 = p->tot_len | TX_FS | TX_LS;
+  d->opts2 = opts;
+  t->seg[t->segs++] = (struct URB_SEG){ (u8*)d, sizeof(*d) };
+  for(q = p; q; q = q->next)
+    if(q->len) t->seg[t->segs++] = (struct URB_SEG){ q->payload, q->len };
+  if(n > sizeof(*d) + p->tot_len)
+    t->seg[t->segs++] = (struct URB_SEG){ (u8*)&tx_pad, n - sizeof(*d) - p->tot_len };
+  t->p[t->frames++] = p;
+  t->len += n;
+  net_stat.tx_frames++;
+  if(tx[tx_last].urb.status != URB_BUSY) tx_flush();
   return ERR_OK;
 }
 
-static void net_rcv (void)
+static void rx_complete (struct URB *urb)
+{
+  rx_done[rx_head++ % NET_RXN] = urb - rx_urb;
+}
+
+static void rx_submit (u32 i)
+{
+  rx_urb[i] = (struct URB){ .ep = IN | 1, .buf = (u8*)rx_buf[i], .len = NET_RXBUF,
+    .done = rx_complete };
+  rx_ref[i] = 1;
+  rx_queued++;
+  usbh_submit(&rx_urb[i]);
+}
+
+static void rx_unref (u32 i)
 {
-  struct pbuf* p;
-  int len = USB->RXCOUNT;
-  while(len)
+  if(!--rx_ref[i] && lan_con) rx_submit(i);
+}
+
+static void rx_pfree (struct pbuf *p)
+{
+  struct RX_REF *r = (struct RX_REF*)p;
+  r->next = rx_free;
+  rx_free = r;
+  rx_unref(r->idx);
+}
+
+/* Frames are lent in place while at least two transfers stay queued,
+   otherwise copied so that lwIP can't starve the endpoint */
+static struct pbuf *rx_frame (u32 i, u8 *ptr, u32 len)
+{
+  struct RX_REF *r = rx_free;
+  struct pbuf *p;
+  if(r && rx_queued >= 2)
+  {
+    rx_free = r->next;
+    r->idx = i;
+    rx_ref[i]++;
+    return pbuf_alloced_custom(PBUF_RAW, len, PBUF_REF, &r->pc, ptr, len);
+  }
+  if((p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL)) != NULL) pbuf_take(p, ptr, len);
+  return p;
+}
+
+/* Checksums the device verified are not checked again by lwIP, a failed one
+   drops the frame. IP fragments and other protocols are checked in software */
+static int rx_csum (struct rx_desc *d)
+{
+  u32 f = NET_CSUM;
+  if(d->opts2 & RD_IPV4_CS)
   {
-    if(usb_len == 0)
+    if(d->opts3 & IPF) return KO;
+    f &= ~NETIF_CHECKSUM_CHECK_IP;
+    if(d->opts2 & RD_TCP_CS)
     {
-      if(USB->RXCOUNT < 4)
-      {
-        PUTF("rxcount err: %d", USB->RXCOUNT);
-        while(1);
-      }
-      eth_len = USB->FIFO[1].word32 & RX_LEN_MASK;
-      usb_len = eth_len + 20;
-      if(eth_len & (RX_ALIGN - 1))
-        usb_len += (RX_ALIGN - (eth_len & (RX_ALIGN - 1)));
-      len -= 4;
+      if(d->opts3 & TCPF) return KO;
+      f &= ~NETIF_CHECKSUM_CHECK_TCP;
     }
-    if(len)
+    if(d->opts2 & RD_UDP_CS)
     {
-      if(len > 3 && usb_len > 3 && !((u32)ip_buf & 3))
-      {
-        *(u32*)&ip_buf[ip_idx] = USB->FIFO[1].word32;
-        ip_idx += 4;
-        len -= 4;
-        usb_len -= 4;
-      }
-      else
-      {
-        len--;
-        usb_len--;
-        ip_buf[ip_idx++] = USB->FIFO[1].byte;
-      }
-      if(usb_len == 0)
-      {
-        p = pbuf_alloc(PBUF_RAW, eth_len, PBUF_POOL);
-        if(p != NULL) pbuf_take(p, &ip_buf[20], eth_len);
-        if(netif.input(p, &netif) != ERR_OK) pbuf_free(p);
-        ip_idx = 0;
-      }
+      if(d->opts3 & UDPF) return KO;
+      f &= ~NETIF_CHECKSUM_CHECK_UDP;
     }
+    net_stat.rx_csum++;
+  }
+  NETIF_SET_CHECKSUM_CTRL(&netif, f);
+  return OK;
+}
+
+/* Aggregated RX: descriptor, frame with CRC, padding to RX_ALIGN. A frame
+   cut by the end of the transfer is dropped, as in the Linux driver */
+static void net_rcv (u32 i)
+{
+  struct rx_desc *d = (struct rx_desc*)rx_buf[i];
+  struct pbuf *p;
+  u32 len = rx_urb[i].act, n;
+  while(len >= sizeof(*d))
+  {
+    n = d->opts1 & RX_LEN_MASK;
+    if(n < 14 + CRC_SIZE || sizeof(*d) + n > len) break;
+    if(d->opts1 & RD_CRC || rx_csum(d) != OK) net_stat.rx_drop++;
+    else if((p = rx_frame(i, (u8*)(d + 1), n - CRC_SIZE)) != NULL)
+      if(netif.input(p, &netif) != ERR_OK) pbuf_free(p);
+    n = (sizeof(*d) + n + RX_ALIGN - 1) & ~(RX_ALIGN - 1);
+    if(n >= len) break;
+    d = (struct rx_desc*)((u8*)d + n);
+    len -= n;
   }
 }
 
@@ -108,6 +273,7 @@ static err_t ethernetif_init(struct netif *netif)
   netif->output = etharp_output;
   netif->mtu = 1500;
   netif->flags |= NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_LINK_UP;
+  NETIF_SET_CHECKSUM_CTRL(netif, NET_CSUM);
   netif->hwaddr_len = 6;
   memcpy(netif->hwaddr, ip_mac, 6);
   return ERR_OK;
@@ -131,17 +297,55 @@ void net_init (void)
   netif_set_up(&netif);
 }
 
-void usbh_net_handler (u32 isr)
+/* Completed RX transfers are parsed in bus order, the rest stay queued */
+static void rx_drain (void)
+{
+  u32 i;
+  while(rx_tail != rx_head)
+  {
+    i = rx_done[rx_tail++ % NET_RXN];
+    rx_queued--;
+    if(lan_con && rx_urb[i].status == OK) net_rcv(i);
+    rx_unref(i);
+  }
+}
+
+/* Every buffer no frame is holding goes on the endpoint */
+static void rx_queue (void)
+{
+  u32 i;
+  rx_drain();                       // transfers cancelled on the last disconnect
+  if(!rx_pool[0].pc.custom_free_function)
+    for(i = 0; i < NET_RXREF; i++)
+    {
+      rx_pool[i].pc.custom_free_function = rx_pfree;
+      rx_pool[i].next = rx_free;
+      rx_free = &rx_pool[i];
+    }
+  for(i = 0; i < NET_RXN; i++) if(!rx_ref[i]) rx_submit(i);
+}
+
+/* The interrupt endpoint reports the link state, the PHY status is only read
+   by control transfers when it changes. A failing endpoint falls back to
+   reading it every 100mS */
+void usbh_net_handler (void)
 {
-  if(isr & 0x20000)
+  rx_drain();
+  for(u32 i = 0; i < NET_TXN; i++) if(tx[i].out) tx_free(&tx[i]);
+  if(tx[tx_idx].frames && !tx[tx_idx].out && tx[tx_last].urb.status != URB_BUSY) tx_flush();
+  if(!lan_poll && int_urb.status != URB_BUSY)
   {
-    USB->EP_IDX = 1;
-    net_rcv();
-    USB->RXCSR = 32;
+    if(int_urb.status != OK) lan_poll = 1, PUTS("LAN interrupt endpoint error");
+    else if(int_urb.act && !(int_buf[0] & INTR_LINK) != !lan_con) lan_chk = 1;
+    int_urb = (struct URB){ .ep = IN | 2, .buf = int_buf, .len = INTBUFSIZE };
+    if(!lan_poll) usbh_submit(&int_urb);
   }
-  if((lan_tim - sys_now()) > 100)
+  if(lan_poll && (lan_tim - sys_now()) > 100) lan_chk = 1;
+  if(lan_chk)
   {
+    lan_chk = 0;
     lan_tim = sys_now() + 100;
+    net_stat.phy++;
     if(rtl8152_get_speed() & 2)
     {
       if(!lan_con)
@@ -149,9 +353,8 @@ void usbh_net_handler (u32 isr)
         lan_con = 1;
         PUTS("LAN connect");
         rtl8152_enable();
-        USB->EP_IDX = 1;
-        USB->RXCSR = 32;
-        ip_idx = 0, eth_len = 0, usb_len = 0;
+        tx_idx = tx_last = 0;
+        rx_queue();
         net_init();
       }
     }
@@ -161,6 +364,9 @@ void usbh_net_handler (u32 isr)
       {
         lan_con = 0;
         PUTS("LAN disconnect");
+        usbh_cancel(IN | 1, 0x4000);
+        usbh_cancel(OUT | 1, 0x4000);
+        for(u32 i = 0; i < NET_TXN; i++) tx_free(&tx[i]);
         rtl8152_disable();
         net_deinit();
       }
@@ -171,6 +377,10 @@ void usbh_net_handler (u32 isr)
 void usbh_net_deinit (void)
 {
   lan_con = 0;
+  usbh_cancel(IN | 1, 0x4000);
+  usbh_cancel(OUT | 1, 0x4000);
+  usbh_cancel(IN | 2, 0x4000);
+  for(u32 i = 0; i < NET_TXN; i++) tx_free(&tx[i]);
   PUTS("LAN disconnect");
   net_deinit();
 }
@@ -187,17 +397,29 @@ int usbh_net_init (DSC_DEV *dev_dsc)
   USB->RXFUNCADDR = 1;                    // address @ bus
   USB->RXTYPE = (1 << 6) | (2 << 4) | 1;
   USB->RXMAXP = 512;                      //dsc.ep1.wMaxPacketSize;
-  USB->RXFIFOADDR = 64 / 8;               // addr * 8
-  USB->RXFIFOSZ = 6;                      // 2 ^ (size + 3)
+  USB->RXFIFOADDR = FIFO_RX1 / 8;         // addr * 8
+  USB->RXFIFOSZ = FIFO_DB | 6;            // 2 x 2 ^ (size + 3)
   USB->RXCSR = 0x0080;                    // clr data toggle
+  USB->RXINTERVAL = URB_NAKLIM;
   USB->TXFUNCADDR = 1;                    // address @ bus
   USB->TXTYPE = (1 << 6) | (2 << 4) | 2;  // !!! setup   speed
   USB->TXMAXP = 512;                      //dsc.ep1.wMaxPacketSize;
-  USB->TXFIFOADDR = (512 + 64) / 8;
-  USB->TXFIFOSZ = 6;
+  USB->TXFIFOADDR = FIFO_TX1 / 8;
+  USB->TXFIFOSZ = FIFO_DB | 6;
   USB->TXCSR = 0x0048;
+  USB->TXINTERVAL = URB_NAKLIM;
+  USB->EP_IDX = 2;
+  USB->RXFUNCADDR = 1;
+  USB->RXTYPE = (1 << 6) | (3 << 4) | 3;  // interrupt, EP3
+  USB->RXMAXP = INTBUFSIZE;
+  USB->RXFIFOADDR = FIFO_RX2 / 8;
+  USB->RXFIFOSZ = 3;                      // 64 bytes
+  USB->RXCSR = 0x0080;
+  USB->RXINTERVAL = 8;                    // 2 ^ (8 - 1) microframes, 16mS
   USB->EP_IDX = 0;
-  lan_tim = sys_now() + 100;
+  int_urb = (struct URB){ 0 };
+  lan_chk = 1;
+  lan_poll = 0;
   return OK;
 }
 
@@ -8,8 +8,20 @@ extern u8 ip_mask[4];
 extern u8 ip_gate[4];
 extern u8 ip_mac[6];
 
+struct NET_STAT {
+  u32 tx_frames;          // frames queued by lwIP
+  u32 tx_urbs;            // bulk OUT transfers, frames aggregated
+  u32 tx_drop;            // frames refused with every TX buffer on the bus
+  u32 tx_csum;            // TCP checksums generated by the device
+  u32 rx_csum;            // IPv4 frames verified by the device
+  u32 rx_drop;            // CRC or checksum errors
+  u32 phy;                // PHY status reads by control transfer
+};
+
+extern struct NET_STAT net_stat;
+
 int usbh_net_init (DSC_DEV *dev_dsc);
 void usbh_net_deinit (void);
-void usbh_net_handler (u32 isr);
+void usbh_net_handler (void);
 
 #endif
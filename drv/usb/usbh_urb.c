@@ -0,0 +1,488 @@
+#include <stdio.h>
+#include "sys.h"
+#include "mmu.h"
+#include "usbh.h"
+
+#define DDMA_DRQ_USB    0x04
+#define DDMA_DRQ_SDRAM  0x01
+#define DMA_DDMA0_END   (1 << 17)     // DMA->IE/IS: DDMA0 full transfer
+
+enum URB_QUEUE { Q_EP0, Q_OUT, Q_IN, Q_INT, Q_NUM };
+enum URB_STAGE { ST_SETUP, ST_DATA, ST_STATUS, ST_PIO, ST_DMA };
+
+struct USBH_STAT usbh_stat;
+
+static struct URB *queue[Q_NUM];    // per endpoint, the head is on the bus
+static struct URB *dma_urb;         // URB streaming through DDMA0
+static u8 irq_on, dma_ok = 1;       // dma_ok is cleared if DDMA0 stalls once
+static u32 isr_ticks;               // spent in usbh_isr(), not idle
+
+static void start (int q);
+
+/* Timer2 of the boot trace: free running, 3MHz */
+static u32 ticks (void) { return ~TIM->T2_CURV; }
+
+static int qidx (u8 ep)
+{
+  return !(ep & 127) ? Q_EP0 : (ep & 127) == 2 ? Q_INT : ep & IN ? Q_IN : Q_OUT;
+}
+
+static u8 qep (int q) { return q == Q_EP0 ? 0 : q == Q_INT ? 2 : 1; }
+
+/* The queues are shared with the interrupt */
+static void lock (void)
+{
+  if(irq_on) INT->EN[0] &= ~((1 << IRQ_USB) | (1 << IRQ_DMA));
+}
+
+static void unlock (void)
+{
+  if(irq_on) INT->EN[0] |= (1 << IRQ_USB) | (1 << IRQ_DMA);
+}
+
+/*******************************************************************************
+                                   EP1 FIFO
+*******************************************************************************/
+/* Word-wide PIO, words of unaligned buffers are assembled in registers */
+static void fifo_write (u8 *ptr, u32 len)
+{
+  usbh_stat.pio += len;
+  if((u32)ptr & 3)
+    for(; len >= 4; ptr += 4, len -= 4)
+      USB->FIFO[1].word32 = ptr[0] | (ptr[1] << 8) | (ptr[2] << 16) | (ptr[3] << 24);
+  else for(; len >= 4; ptr += 4, len -= 4) USB->FIFO[1].word32 = *(u32*)ptr;
+  while(len--) USB->FIFO[1].byte = *ptr++;
+}
+
+/* The next len bytes of the pieces of a gathered transfer: a word a piece
+   ends inside is completed from the next one, the packet's last bytes go
+   byte-wide */
+static void fifo_gather (struct URB *urb, u32 len)
+{
+  const struct URB_SEG *s;
+  const u8 *ptr;
+  u32 w = 0, k = 0, n;
+  usbh_stat.pio += len;
+  while(len)
+  {
+    s = &urb->seg[urb->sidx];
+    ptr = s->ptr + urb->soff;
+    n = s->len - urb->soff < len ? s->len - urb->soff : len;
+    len -= n;
+    if((urb->soff += n) == s->len) urb->sidx++, urb->soff = 0;
+    for(; n && k; n--)
+    {
+      w |= *ptr++ << (k * 8);
+      if(++k == 4) USB->FIFO[1].word32 = w, w = k = 0;
+    }
+    if((u32)ptr & 3)
+      for(; n >= 4; ptr += 4, n -= 4)
+        USB->FIFO[1].word32 = ptr[0] | (ptr[1] << 8) | (ptr[2] << 16) | (ptr[3] << 24);
+    else for(; n >= 4; ptr += 4, n -= 4) USB->FIFO[1].word32 = *(u32*)ptr;
+    while(n--) w |= *ptr++ << (k++ * 8);
+  }
+  for(; k; k--, w >>= 8) USB->FIFO[1].byte = w;
+}
+
+static void fifo_read (u8 *ptr, u32 len)
+{
+  u32 w;
+  usbh_stat.pio += len;
+  if((u32)ptr & 3)
+    for(; len >= 4; ptr += 4, len -= 4)
+    {
+      w = USB->FIFO[1].word32;
+      ptr[0] = w; ptr[1] = w >> 8; ptr[2] = w >> 16; ptr[3] = w >> 24;
+    }
+  else for(; len >= 4; ptr += 4, len -= 4) *(u32*)ptr = USB->FIFO[1].word32;
+  while(len--) *ptr++ = USB->FIFO[1].byte;
+}
+
+/* DDMA0 streams whole packets between DRAM and the EP1 FIFO: DMA request
+   mode 1, the controller sets TxPktRdy itself (AutoSet) or requests and
+   releases the IN packets (AutoReq, AutoClear) for the whole run */
+static void dma_start (void *ptr, u32 len, u8 dir)
+{
+  u32 fifo = (u32)&USB->FIFO[1].word32;
+  DDMA0->SRC = dir == IN ? fifo : (u32)ptr;
+  DDMA0->DST = dir == IN ? (u32)ptr : fifo;
+  DDMA0->CNT = len;
+  DDMA0->PAR = 0;
+  DDMA0->CFG = (1U << 31) | (2 << 24) | (2 << 8) | (dir == IN ?
+    (DDMA_DRQ_SDRAM << 16) | (1 << 5) | DDMA_DRQ_USB :
+    (1 << 21) | (DDMA_DRQ_USB << 16) | DDMA_DRQ_SDRAM);
+}
+
+/* Whole 512-byte packets of an aligned buffer go by DMA */
+static u32 dma_len (struct URB *urb)
+{
+  if(!urb->dma || urb->seg || !dma_ok || dma_urb || ((u32)urb->buf & 3)) return 0;
+  return (urb->len - urb->act) & ~511;
+}
+
+static void dma_stop (void)
+{
+  DDMA0->CFG = 0;
+  USB->VEND0 = 0;
+  if(dma_urb->ep & IN) USB->RXCSR = 0;
+  else USB->TXCSR &= ~((1 << 15) | (1 << 12));  // no AutoSet, no DMAReqEnab
+  dma_urb = NULL;
+}
+
+/*******************************************************************************
+                                   Scheduler
+*******************************************************************************/
+static void complete (int q, int status)
+{
+  struct URB *urb = queue[q];
+  if(urb == dma_urb) dma_stop();
+  queue[q] = urb->next;
+  urb->next = NULL;
+  urb->status = status;
+  usbh_stat.urbs++;
+  if(queue[q]) start(q);
+  if(urb->done) urb->done(urb);
+}
+
+/* NAK limit expired: give up or let the endpoint go on */
+static int nak (int q)
+{
+  usbh_stat.naks++;
+  return queue[q]->naks && !--queue[q]->naks ? KO : OK;
+}
+
+static void out_pio (struct URB *urb)
+{
+  u32 n;
+  urb->stage = ST_PIO;
+  while(urb->act < urb->len && !(USB->TXCSR & 1))   // a FIFO buffer is free
+  {
+    n = urb->len - urb->act > 512 ? 512 : urb->len - urb->act;
+    if(urb->seg) fifo_gather(urb, n);
+    else fifo_write(urb->buf + urb->act, n);
+    urb->act += n;
+    USB->TXCSR = 1;                   // TxPktRdy
+  }
+  if(urb->act == urb->len && !(USB->TXCSR & 3)) complete(Q_OUT, OK);
+}
+
+static void ep0_out (struct URB *urb)
+{
+  u32 n = 0;
+  while(urb->act < urb->len && n < 64) USB->FIFO[0].byte = urb->buf[urb->act++], n++;
+  USB->TXCSR = 2;                     // TxPktRdy
+}
+
+static void start (int q)
+{
+  struct URB *urb = queue[q];
+  u32 n = q == Q_EP0 || q == Q_INT ? 0 : dma_len(urb);
+  USB->EP_IDX = qep(q);
+  if(q == Q_EP0)
+  {
+    urb->stage = ST_SETUP;
+    USB->FIFO[0].word32 = urb->setup[0];
+    USB->FIFO[0].word32 = urb->setup[1];
+    USB->TXCSR = 0x0A;                // SetupPkt | TxPktRdy
+  }
+  else if(n)
+  {
+    urb->stage = ST_DMA;
+    dma_urb = urb;
+    if(q == Q_OUT)
+    {
+      mmu_clean_dcache((u32)urb->buf + urb->act, n);
+      USB->VEND0 = 1;                           // DRQ: EP1 TX
+      dma_start(urb->buf + urb->act, n, OUT);
+      USB->TXCSR = (1 << 15) | (1 << 10);       // AutoSet, DMAReqMode 1
+      USB->TXCSR = (1 << 15) | (1 << 12) | (1 << 10);  // DMAReqEnab
+    }
+    else
+    {
+      mmu_clean_invalidated_dcache((u32)urb->buf + urb->act, n);
+      USB->VEND0 = 3;                           // DRQ: EP1 RX
+      USB->RXPKTCNT = n / 512;                  // AutoReq stops after these
+      dma_start(urb->buf + urb->act, n, IN);
+      USB->RXCSR = (1 << 15) | (1 << 14) | (1 << 11);  // AutoClear, AutoReq, DMAReqMode 1
+      USB->RXCSR = (1 << 15) | (1 << 14) | (1 << 13) | (1 << 11) | 32;  // DMAReqEnab, ReqPkt
+    }
+  }
+  else if(q == Q_OUT) out_pio(urb);
+  else
+  {
+    urb->stage = ST_PIO;
+    USB->RXCSR = 32;                  // ReqPkt
+  }
+}
+
+/* DDMA0 has moved its run, the FIFO may still hold the last OUT packets */
+static void dma_done (void)
+{
+  struct URB *urb = dma_urb;
+  int q = urb->ep & IN ? Q_IN : Q_OUT;
+  u32 n;
+  USB->EP_IDX = 1;
+  dma_stop();
+  n = (urb->len - urb->act) & ~511;
+  urb->act += n;
+  usbh_stat.dma += n;
+  if(q == Q_OUT) out_pio(urb);
+  else if(urb->act < urb->len)
+  {
+    urb->stage = ST_PIO;
+    USB->RXCSR = 32;
+  }
+  else complete(Q_IN, OK);
+}
+
+static void ep0_irq (struct URB *urb)
+{
+  u32 csr, n;
+  USB->EP_IDX = 0;
+  csr = USB->TXCSR;
+  if(csr & 0x80 && nak(Q_EP0) == OK)  // EP0ERR_NAKTO
+  {
+    USB->TXCSR = csr & ~0x80;
+    return;
+  }
+  if(csr & 0x94)                      // EP0ERR_NAKTO, EP0ERR_TO, EP0ERR_STALL
+  {
+    USB->TXCSR = 0;
+    complete(Q_EP0, csr & 0x94);
+    return;
+  }
+  if(urb->stage == ST_SETUP)
+  {
+    urb->stage = ST_DATA;
+    if(!urb->len)
+    {
+      urb->stage = ST_STATUS;
+      USB->TXCSR = urb->setup[0] & 0x80 ? 0x42 : 0x60;
+    }
+    else if(urb->setup[0] & 0x80) USB->TXCSR = 0x20;  // ReqPkt
+    else ep0_out(urb);
+  }
+  else if(urb->stage == ST_DATA && urb->setup[0] & 0x80)
+  {                                   // device-to-host data
+    if(!(csr & 1)) return;
+    n = USB->RXCOUNT;
+    while(USB->RXCOUNT && urb->act < urb->len) urb->buf[urb->act++] = USB->FIFO[0].byte;
+    if(!n || urb->act == urb->len)
+    {
+      urb->stage = ST_STATUS;
+      USB->TXCSR = 0x42;              // StatusPkt | TxPktRdy
+    }
+    else USB->TXCSR = 0x20;
+  }
+  else if(urb->stage == ST_DATA)
+  {                                   // host-to-device data
+    if(csr & 2) return;
+    if(urb->act < urb->len) ep0_out(urb);
+    else
+    {
+      urb->stage = ST_STATUS;
+      USB->TXCSR = 0x60;              // StatusPkt | ReqPkt
+    }
+  }
+  else if(urb->setup[0] & 0x80)
+  {
+    if(!(csr & 2)) complete(Q_EP0, OK);
+  }
+  else if(csr & 1)
+  {
+    USB->TXCSR = csr & ~0x41;
+    complete(Q_EP0, OK);
+  }
+}
+
+static void out_irq (struct URB *urb)
+{
+  u32 csr;
+  USB->EP_IDX = 1;
+  csr = USB->TXCSR;
+  if(csr & 0x80 && nak(Q_OUT) == OK)  // TXERR_NAKTO: the packet stays in the FIFO
+  {
+    USB->TXCSR = csr & ~0x80;
+    return;
+  }
+  if(csr & 0xA4)                      // TXERR_NAKTO, TXERR_STALL, TXERR
+  {
+    if(urb == dma_urb) dma_stop();
+    USB->TXCSR = 0x08;                // flush
+    USB->TXCSR = 0x08;
+    complete(Q_OUT, csr & 0xA4);
+  }
+  else if(urb->stage == ST_PIO) out_pio(urb);
+}
+
+static void in_irq (struct URB *urb)
+{
+  u32 csr, n;
+  USB->EP_IDX = 1;
+  csr = USB->RXCSR;
+  if(csr & 8 && !(csr & 1) && nak(Q_IN) == OK)  // RX_NAKTO: request again
+  {
+    USB->RXCSR = (urb->stage == ST_PIO ? 0 : csr & ~8) | 32;
+    return;
+  }
+  if(csr & 0x14C || (urb->stage == ST_DMA && csr & 1 && USB->RXCOUNT < 512))
+  {                                   // errors, a short packet stops DMA
+    if(urb == dma_urb) dma_stop();
+    USB->RXCSR = 0x10;                // flush
+    complete(Q_IN, csr & 0x14C ? csr & 0x14C : 0x2000);
+    return;
+  }
+  if(urb->stage != ST_PIO || !(csr & 1)) return;
+  n = USB->RXCOUNT;
+  fifo_read(urb->buf + urb->act, n < urb->len - urb->act ? n : urb->len - urb->act);
+  urb->act += n < urb->len - urb->act ? n : urb->len - urb->act;
+  if(n < 512 || urb->act == urb->len)
+  {
+    USB->RXCSR = 0;                   // RxPktRdy, the rest of an overlong packet
+    complete(Q_IN, OK);
+  }
+  else USB->RXCSR = 32;
+}
+
+/* Interrupt IN on EP2: the controller polls the device every RXINTERVAL by
+   itself, the URB takes one packet */
+static void int_irq (struct URB *urb)
+{
+  u32 csr, n;
+  USB->EP_IDX = 2;
+  csr = USB->RXCSR;
+  if(csr & 0x144)                     // RXERR, RX_STALL, IncompRx
+  {
+    USB->RXCSR = 0x10;
+    complete(Q_INT, csr & 0x144);
+    return;
+  }
+  if(!(csr & 1)) return;
+  n = USB->RXCOUNT;
+  while(n-- && urb->act < urb->len) urb->buf[urb->act++] = USB->FIFO[2].byte;
+  USB->RXCSR = 0;                     // RxPktRdy, the rest of an overlong packet
+  complete(Q_INT, OK);
+}
+
+/* The MUSB and DDMA0 interrupt, or a polling pass */
+void usbh_isr (void)
+{
+  u32 t = ticks();
+  u8  idx = USB->EP_IDX;
+  u32 is = USB->EP_IS;
+  USB->EP_IS = is;
+  if(is) usbh_stat.irqs++;
+  if(DMA->IS & DMA_DDMA0_END) DMA->IS = DMA_DDMA0_END;
+  if(dma_urb && !(DDMA0->CFG & (1 << 30))) dma_done();
+  if(is & 1 && queue[Q_EP0]) ep0_irq(queue[Q_EP0]);
+  if(is & 2 && queue[Q_OUT]) out_irq(queue[Q_OUT]);
+  if(is & 0x20000 && queue[Q_IN]) in_irq(queue[Q_IN]);
+  if(is & 0x40000 && queue[Q_INT]) int_irq(queue[Q_INT]);
+  USB->EP_IDX = idx;
+  isr_ticks += ticks() - t;
+}
+
+void usbh_poll (void)
+{
+  if(!irq_on) usbh_isr();
+}
+
+/* Routes EP0, EP1, EP2 RX and DDMA0 events to usbh_isr(), which the application
+   calls from its irq_handler (-D_IRQ_) */
+void usbh_irq (int en)
+{
+  lock();
+  irq_on = en;
+  USB->EP_IE = en ? 0x60003 : 0;      // EP0, EP1 TX, EP1 RX, EP2 RX
+  DMA->IE = en ? DMA->IE | DMA_DDMA0_END : DMA->IE & ~DMA_DDMA0_END;
+  INT->BASE_ADDR = 0;
+  if(en)
+  {
+    INT->MASK[0] &= ~((1 << IRQ_USB) | (1 << IRQ_DMA));
+    INT->EN[0] |= (1 << IRQ_USB) | (1 << IRQ_DMA);
+    IRQ_ENABLE();
+  }
+  else
+  {
+    INT->EN[0] &= ~((1 << IRQ_USB) | (1 << IRQ_DMA));
+    INT->MASK[0] |= (1 << IRQ_USB) | (1 << IRQ_DMA);
+  }
+}
+
+int usbh_submit (struct URB *urb)
+{
+  struct URB **p;
+  u8  idx;
+  int q = qidx(urb->ep);
+  urb->next = NULL;
+  urb->act = 0;
+  urb->sidx = urb->soff = 0;
+  urb->status = URB_BUSY;
+  if(q == Q_EP0) urb->len = urb->setup[1] >> 16;
+  lock();
+  for(p = &queue[q]; *p; p = &(*p)->next);
+  *p = urb;
+  if(queue[q] == urb)
+  {
+    idx = USB->EP_IDX;
+    start(q);
+    USB->EP_IDX = idx;
+  }
+  unlock();
+  return OK;
+}
+
+/* Completes every URB queued on ep with status, the endpoint FIFO is flushed.
+   A DMA run stopped with a packet waiting in the FIFO means the DMA request
+   does not work, bulk transfers then stay with PIO */
+void usbh_cancel (u8 ep, int status)
+{
+  struct URB *urb, *next;
+  u8  idx;
+  int q = qidx(ep);
+  lock();
+  idx = USB->EP_IDX;
+  USB->EP_IDX = qep(q);
+  if(queue[q] && queue[q] == dma_urb)
+  {
+    if(q == Q_IN ? USB->RXCSR & 1 : !(USB->TXCSR & 3)) dma_ok = 0;
+    dma_stop();
+  }
+  if(q == Q_EP0) USB->TXCSR = 0x100;  // FlushFIFO
+  else if(q == Q_OUT) USB->TXCSR = 0x08, USB->TXCSR = 0x08;
+  else USB->RXCSR = 0x10;             // EP1 or EP2 RX
+  urb = queue[q];
+  queue[q] = NULL;
+  while(urb)
+  {
+    next = urb->next;
+    urb->next = NULL;
+    urb->status = status;
+    if(urb->done) urb->done(urb);
+    urb = next;
+  }
+  USB->EP_IDX = idx;
+  unlock();
+}
+
+/* Sleeps (usbh_irq(1)) or polls until the URB completes. A bus event or the
+   timeout, mS, cancels the endpoint. The interrupts taken while sleeping are
+   not idle time */
+int usbh_wait (struct URB *urb, u32 timeout)
+{
+  u32 t = ticks(), i = isr_ticks;
+  while(urb->status == URB_BUSY)
+  {
+    if(USB->BUS_IS & 0xF7) usbh_cancel(urb->ep, 0x4000);
+    else if((ticks() - t) / 3000 >= timeout) usbh_cancel(urb->ep, 0x8000);
+    else if(!irq_on) usbh_isr();
+    else
+    {
+      IRQ_DISABLE();                  // the interrupt can't slip in before WFI
+      if(urb->status == URB_BUSY) IRQ_WAIT();
+      IRQ_ENABLE();
+    }
+  }
+  usbh_stat.wait += (ticks() - t - (isr_ticks - i)) / 3;
+  return urb->status;
+}
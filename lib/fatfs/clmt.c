@@ -0,0 +1,94 @@
+/*-----------------------------------------------------------------------*/
+/* Fast seek helper: cluster link map tables (CLMT) for media files      */
+/*-----------------------------------------------------------------------*/
+/* A file opened read-only gets a CLMT sized to its fragment count, so   */
+/* f_lseek/f_read find clusters without walking the FAT chain. Tables    */
+/* are cached by start cluster and size and reused on the next open;   */
+/* call clmt_flush() after rewriting files in place.                     */
+/*-----------------------------------------------------------------------*/
+#include <stdlib.h>
+#include "clmt.h"
+
+static struct {
+  FATFS *fs;
+  WORD id;
+  DWORD sclust;
+  FSIZE_t size;
+  DWORD *tbl;
+  UINT refs;
+  UINT tick;
+} cache[CLMT_CACHE];
+
+static UINT tick;
+
+static DWORD *clmt_build (FIL *fp)
+{
+  DWORD *tbl = 0, *tmp;
+  UINT len = CLMT_MIN;
+  FRESULT res;
+  while(len <= CLMT_MAX && (tmp = realloc(tbl, len * sizeof(DWORD))))
+  {
+    tbl = fp->cltbl = tmp;
+    tbl[0] = len;
+    res = f_lseek(fp, CREATE_LINKMAP);
+    if(res == FR_OK) return tbl;
+    if(res != FR_NOT_ENOUGH_CORE) break;
+    len = tbl[0];       /* Required size */
+  }
+  fp->cltbl = 0;
+  free(tbl);
+  return 0;
+}
+
+FRESULT clmt_open (FIL *fp, const TCHAR *path, BYTE mode)
+{
+  UINT i, j;
+  FRESULT res = f_open(fp, path, mode);
+  if(res != FR_OK || (mode & FA_WRITE) || !fp->obj.sclust) return res;
+  for(i = 0, j = CLMT_CACHE; i < CLMT_CACHE; i++)
+  {
+    if(cache[i].tbl && cache[i].fs == fp->obj.fs && cache[i].id == fp->obj.id &&
+      cache[i].sclust == fp->obj.sclust && cache[i].size == fp->obj.objsize) break;
+    if(!cache[i].refs && (j == CLMT_CACHE || !cache[i].tbl ||
+      (cache[j].tbl && cache[i].tick < cache[j].tick))) j = i;
+  }
+  if(i == CLMT_CACHE)
+  {                     /* Miss: build into the least recently used free slot */
+    if(j == CLMT_CACHE) return FR_OK;
+    free(cache[j].tbl);
+    cache[j].tbl = clmt_build(fp);
+    if(!cache[j].tbl) return FR_OK;
+    cache[j].fs = fp->obj.fs;
+    cache[j].id = fp->obj.id;
+    cache[j].sclust = fp->obj.sclust;
+    cache[j].size = fp->obj.objsize;
+    i = j;
+  }
+  fp->cltbl = cache[i].tbl;
+  cache[i].refs++;
+  cache[i].tick = ++tick;
+  return FR_OK;
+}
+
+FRESULT clmt_close (FIL *fp)
+{
+  UINT i;
+  for(i = 0; fp->cltbl && i < CLMT_CACHE; i++)
+  {
+    if(cache[i].tbl == fp->cltbl && cache[i].refs) cache[i].refs--;
+  }
+  return f_close(fp);
+}
+
+void clmt_flush (void)
+{
+  UINT i;
+  for(i = 0; i < CLMT_CACHE; i++)
+  {
+    if(!cache[i].refs)
+    {
+      free(cache[i].tbl);
+      cache[i].tbl = 0;
+    }
+  }
+}
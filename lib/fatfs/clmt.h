@@ -0,0 +1,14 @@
+#ifndef CLMT_H
+#define CLMT_H
+
+#include "ff.h"
+
+#define CLMT_CACHE  4     // cluster link maps kept between opens
+#define CLMT_MIN    16    // first table size (7 fragments)
+#define CLMT_MAX    4096  // largest table (2047 fragments), walk the FAT beyond
+
+FRESULT clmt_open (FIL *fp, const TCHAR *path, BYTE mode);
+FRESULT clmt_close (FIL *fp);
+void clmt_flush (void);
+
+#endif
@@ -6,6 +6,7 @@
 /* This is an example of glue functions to attach various exsisting      */
 /* storage control modules to the FatFs module with a defined API.       */
 /*-----------------------------------------------------------------------*/
+#include <string.h>
 #include "ff.h"     /* Obtains integer types */
 #include "diskio.h" /* Declarations of disk functions */
 #include "sys.h"
@@ -17,8 +18,15 @@ struct {
   volatile DSTATUS stat;
   int (*cbrd) (void *ptr, u32 addr, u32 cnt);
   int (*cbwr) (void *ptr, u32 addr, u32 cnt);
+  int (*cbsync) (void);
+  u32 cnt;
+  u32 blk;
 } drv[DRIVE_NUM];
 
+#if FF_MULTI_PARTITION
+PARTITION VolToPart[FF_VOLUMES] = { { 0, 0 }, { 1, 0 } };  /* Auto-detect */
+#endif
+
 /*-----------------------------------------------------------------------*/
 /* Get Drive Status                                                      */
 /*-----------------------------------------------------------------------*/
@@ -46,9 +54,28 @@ void disk_init ( BYTE pdrv, int (*cbrd) (void *ptr, u32 addr, u32 cnt),
     drv[pdrv].stat = STA_NOINIT;
     drv[pdrv].cbrd = cbrd;
     drv[pdrv].cbwr = cbwr;
+    drv[pdrv].cbsync = NULL;
+    drv[pdrv].cnt = 0;
+    drv[pdrv].blk = 0;
+  }
+}
+
+/* Drive size and erase block (allocation unit) size in sectors, 0 - unknown */
+void disk_geometry (u8 pdrv, u32 cnt, u32 blk)
+{
+  if(pdrv < DRIVE_NUM)
+  {
+    drv[pdrv].cnt = cnt;
+    drv[pdrv].blk = blk;
   }
 }
 
+/* Flushes the driver's write buffer on CTRL_SYNC (f_sync, f_close) */
+void disk_sync (u8 pdrv, int (*cbsync) (void))
+{
+  if(pdrv < DRIVE_NUM) drv[pdrv].cbsync = cbsync;
+}
+
 /*-----------------------------------------------------------------------*/
 /* Read Sector(s)                                                        */
 /*-----------------------------------------------------------------------*/
@@ -92,14 +119,80 @@ DRESULT disk_ioctl (
 {
   switch (cmd)
   {
-    case CTRL_SYNC: return RES_OK;
+    case CTRL_SYNC:
+      if(pdrv < DRIVE_NUM && drv[pdrv].cbsync && drv[pdrv].cbsync() != OK) return RES_ERROR;
+      return RES_OK;
+    case GET_SECTOR_COUNT:
+      if(pdrv >= DRIVE_NUM || !drv[pdrv].cnt) return RES_PARERR;
+      *(LBA_t *) buff = (LBA_t) drv[pdrv].cnt;
+      return RES_OK;
     case GET_SECTOR_SIZE:
       *(DWORD *) buff = (DWORD) SECTOR_SIZE;
       return RES_OK;
     case GET_BLOCK_SIZE:
-      *(DWORD *) buff = (DWORD) SECTOR_SIZE;
+      *(DWORD *) buff = (DWORD) (pdrv < DRIVE_NUM && drv[pdrv].blk ?
+        drv[pdrv].blk : SECTOR_SIZE);
       return RES_OK;
     default: return RES_PARERR;
   }
   return RES_OK;
 }
+
+#if FF_USE_MKFS && !FF_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* Format a memory card                                                  */
+/*-----------------------------------------------------------------------*/
+/* The layout follows the SD Association file system specification: the   */
+/* partition starts at an allocation unit boundary, the data area is      */
+/* aligned to the allocation unit and the cluster size is chosen by the   */
+/* capacity class (large clusters suit the media files).                  */
+/*-----------------------------------------------------------------------*/
+FRESULT disk_mkfs (
+  BYTE pdrv,        /* Physical drive number (bound to the same volume) */
+  void *work,       /* Working buffer */
+  UINT len          /* Size of working buffer [byte] */
+)
+{
+  MKFS_PARM opt = { .n_fat = 1 };
+  TCHAR path[3] = { '0' + pdrv, ':', 0 };
+  BYTE *mbr = work;
+  DWORD au, cnt;
+  FRESULT res;
+  if(pdrv >= DRIVE_NUM || pdrv >= FF_VOLUMES || len < SECTOR_SIZE) return FR_INVALID_PARAMETER;
+  if(!drv[pdrv].cnt || disk_initialize(pdrv) & STA_NOINIT) return FR_NOT_READY;
+  au = drv[pdrv].blk ? drv[pdrv].blk : 8192;  /* 4MB if the card does not tell */
+  while(au > 32 && drv[pdrv].cnt / au < 16) au /= 2;
+  cnt = (drv[pdrv].cnt / au - 1) * au;
+  if(drv[pdrv].cnt <= 0x400000)               /* SDSC (up to 2GB): FAT16 */
+  {
+    opt.fmt = FM_FAT | FM_FAT32;
+    opt.au_size = 32768;
+  }
+  else if(drv[pdrv].cnt <= 0x4000000)         /* SDHC (up to 32GB): FAT32 */
+  {
+    opt.fmt = FM_FAT32;
+    opt.au_size = 32768;
+  }
+  else                                        /* SDXC: exFAT */
+  {
+    opt.fmt = FM_EXFAT;
+    opt.au_size = 131072;
+  }
+  opt.align = au & -au;                       /* Power of two dividing the AU */
+  /* Single partition from the first allocation unit to the last whole one */
+  memset(mbr, 0, SECTOR_SIZE);
+  mbr[446 + 1] = mbr[446 + 5] = 0xFE;         /* CHS not used (LBA only) */
+  mbr[446 + 2] = mbr[446 + 3] = mbr[446 + 6] = mbr[446 + 7] = 0xFF;
+  mbr[446 + 4] = opt.fmt == FM_EXFAT ? 0x07 : opt.fmt == FM_FAT32 ? 0x0C : 0x06;
+  mbr[446 + 8] = au; mbr[446 + 9] = au >> 8;
+  mbr[446 + 10] = au >> 16; mbr[446 + 11] = au >> 24;
+  mbr[446 + 12] = cnt; mbr[446 + 13] = cnt >> 8;
+  mbr[446 + 14] = cnt >> 16; mbr[446 + 15] = cnt >> 24;
+  mbr[510] = 0x55; mbr[511] = 0xAA;
+  if(disk_write(pdrv, mbr, 0, 1) != RES_OK) return FR_DISK_ERR;
+  VolToPart[pdrv].pt = 1;
+  res = f_mkfs(path, &opt, work, len);
+  VolToPart[pdrv].pt = 0;
+  return res;
+}
+#endif
@@ -31,6 +31,7 @@ DSTATUS disk_status (BYTE pdrv);
 DRESULT disk_read (BYTE pdrv, BYTE* buff, LBA_t sector, UINT count);
 DRESULT disk_write (BYTE pdrv, const BYTE* buff, LBA_t sector, UINT count);
 DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff);
+FRESULT disk_mkfs (BYTE pdrv, void* work, UINT len);
 
 
 /* Disk Status Bits (DSTATUS) */
@@ -42,8 +42,6 @@
 err_t
 fs_open(struct fs_file *file, const char *name)
 {
-  const struct fsdata_file *f;
-
   if ((file == NULL) || (name == NULL)) {
     return ERR_ARG;
   }
@@ -55,6 +53,16 @@ fs_open(struct fs_file *file, const char *name)
   }
 #endif /* LWIP_HTTPD_CUSTOM_FILES */
 
+  return fs_open_fsdata(file, name);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/** Like fs_open(), but only looks at the files built in by makefsdata */
+err_t
+fs_open_fsdata(struct fs_file *file, const char *name)
+{
+  const struct fsdata_file *f;
+
   for (f = FS_ROOT; f != NULL; f = f->next) {
     if (!strcmp(name, (const char *)f->name)) {
       file->data = (const char *)f->data;
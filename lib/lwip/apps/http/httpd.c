@@ -121,6 +121,12 @@
 #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
 #define HTTP11_CONNECTIONKEEPALIVE  "Connection: keep-alive"
 #define HTTP11_CONNECTIONKEEPALIVE2 "Connection: Keep-Alive"
+#define HTTP11_CONNECTIONCLOSE      "Connection: close"
+#define HTTP11_REQUESTLINE          " HTTP/1.1" CRLF
+#endif
+
+#if LWIP_HTTPD_SUPPORT_PIPELINE && !(LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SUPPORT_REQUESTLIST)
+#error "LWIP_HTTPD_SUPPORT_PIPELINE needs LWIP_HTTPD_SUPPORT_11_KEEPALIVE and LWIP_HTTPD_SUPPORT_REQUESTLIST"
 #endif
 
 #if LWIP_HTTPD_DYNAMIC_FILE_READ
@@ -250,6 +256,9 @@ struct http_state {
 #if LWIP_HTTPD_SUPPORT_REQUESTLIST
   struct pbuf *req;
 #endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+#if LWIP_HTTPD_SUPPORT_PIPELINE
+  struct pbuf *pipe;      /* Requests received while sending a response. */
+#endif /* LWIP_HTTPD_SUPPORT_PIPELINE */
 
 #if LWIP_HTTPD_DYNAMIC_FILE_READ
   char *buf;        /* File read buffer. */
@@ -260,6 +269,9 @@ struct http_state {
 #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
   u8_t keepalive;
 #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+#if LWIP_HTTPD_SUPPORT_GZIP
+  u8_t gzip;        /* Client accepts gzip content encoding. */
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
 #if LWIP_HTTPD_SSI
   struct http_ssi_state *ssi;
 #endif /* LWIP_HTTPD_SSI */
@@ -308,6 +320,8 @@ LWIP_MEMPOOL_DECLARE(HTTPD_SSI_STATE, MEMP_NUM_PARALLEL_HTTPD_SSI_CONNS, sizeof(
 static err_t http_close_conn(struct altcp_pcb *pcb, struct http_state *hs);
 static err_t http_close_or_abort_conn(struct altcp_pcb *pcb, struct http_state *hs, u8_t abort_conn);
 static err_t http_find_file(struct http_state *hs, const char *uri, int is_09);
+static void http_recv_request(struct altcp_pcb *pcb, struct http_state *hs, struct pbuf *p);
+static u8_t http_send_next(struct altcp_pcb *pcb, struct http_state *hs);
 static err_t http_init_file(struct http_state *hs, struct fs_file *file, int is_09, const char *uri, u8_t tag_check, char *params);
 static err_t http_poll(void *arg, struct altcp_pcb *pcb);
 static u8_t http_check_eof(struct altcp_pcb *pcb, struct http_state *hs);
@@ -505,6 +519,12 @@ http_state_eof(struct http_state *hs)
     hs->req = NULL;
   }
 #endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+#if LWIP_HTTPD_SUPPORT_PIPELINE
+  if (hs->pipe) {
+    pbuf_free(hs->pipe);
+    hs->pipe = NULL;
+  }
+#endif /* LWIP_HTTPD_SUPPORT_PIPELINE */
 }
 
 /** Free a struct http_state.
@@ -657,6 +677,10 @@ http_eof(struct altcp_pcb *pcb, struct http_state *hs)
   /* HTTP/1.1 persistent connection? (Not supported for SSI) */
 #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
   if (hs->keepalive) {
+#if LWIP_HTTPD_SUPPORT_PIPELINE
+    struct pbuf *pipe = hs->pipe;
+    hs->pipe = NULL;
+#endif /* LWIP_HTTPD_SUPPORT_PIPELINE */
     http_remove_connection(hs);
 
     http_state_eof(hs);
@@ -667,6 +691,11 @@ http_eof(struct altcp_pcb *pcb, struct http_state *hs)
     http_add_connection(hs);
     /* ensure nagle doesn't interfere with sending all data as fast as possible: */
     altcp_nagle_disable(pcb);
+#if LWIP_HTTPD_SUPPORT_PIPELINE
+    /* the request(s) the client sent meanwhile are served by http_send_next(),
+       not from here: that would nest a level per response sent */
+    hs->pipe = pipe;
+#endif /* LWIP_HTTPD_SUPPORT_PIPELINE */
   } else
 #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
   {
@@ -1646,6 +1675,31 @@ http_send(struct altcp_pcb *pcb, struct http_state *hs)
   return data_to_send;
 }
 
+/**
+ * http_send() from a callback: once the response is done, the requests
+ * pipelined meanwhile are served by http_recv_request() in a loop.
+ *
+ * @param pcb the pcb to send data
+ * @param hs connection state
+ */
+static u8_t
+http_send_next(struct altcp_pcb *pcb, struct http_state *hs)
+{
+#if LWIP_HTTPD_SUPPORT_PIPELINE
+  /* without keep-alive, the end of the response frees hs */
+  u8_t keepalive = hs->keepalive;
+  u8_t data_to_send = http_send(pcb, hs);
+  if (keepalive && (hs->pipe != NULL) && (hs->handle == NULL)) {
+    struct pbuf *pipe = hs->pipe;
+    hs->pipe = NULL;
+    http_recv_request(pcb, hs, pipe);
+  }
+  return data_to_send;
+#else /* LWIP_HTTPD_SUPPORT_PIPELINE */
+  return http_send(pcb, hs);
+#endif /* LWIP_HTTPD_SUPPORT_PIPELINE */
+}
+
 #if LWIP_HTTPD_SUPPORT_EXTSTATUS
 /** Initialize a http connection with a file to send for an error message
  *
@@ -1930,7 +1984,7 @@ void httpd_post_data_recved(void *connection, u16_t recved_len)
         if ((hs->post_content_len_left == 0) && (hs->unrecved_bytes == 0)) {
           /* finished handling POST */
           http_handle_post_finished(hs);
-          http_send(hs->pcb, hs);
+          http_send_next(hs->pcb, hs);
         }
       }
     }
@@ -1952,7 +2006,7 @@ http_continue(void *connection)
   if (hs && (hs->pcb) && (hs->handle)) {
     LWIP_ASSERT("hs->pcb != NULL", hs->pcb != NULL);
     LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("httpd_continue: try to send more data\n"));
-    if (http_send(hs->pcb, hs)) {
+    if (http_send_next(hs->pcb, hs)) {
       /* If we wrote anything to be sent, go ahead and send it now. */
       LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("tcp_output\n"));
       altcp_output(hs->pcb);
@@ -1961,6 +2015,49 @@ http_continue(void *connection)
 }
 #endif /* LWIP_HTTPD_FS_ASYNC_READ */
 
+#if LWIP_HTTPD_SUPPORT_GZIP
+/** Check the Accept-Encoding header of a request for gzip
+ *
+ * @param data the request
+ * @param data_len length of data
+ * @return 1 if the client accepts gzip encoded content
+ */
+static u8_t
+http_accepts_gzip(const char *data, u16_t data_len)
+{
+  const char *enc = lwip_strnistr(data, CRLF "Accept-Encoding:", data_len);
+  if (enc != NULL) {
+    const char *eol = lwip_strnstr(enc + 2, CRLF, data_len - (enc + 2 - data));
+    if ((eol != NULL) && (lwip_strnistr(enc, "gzip", (size_t)(eol - enc)) != NULL)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
+
+#if LWIP_HTTPD_SUPPORT_PIPELINE
+/** Keep what follows the request just parsed: the client sent its next
+ * request(s) without waiting for this response. They are parsed when the
+ * response is done (see http_send_next). The rest of the request list is
+ * handed over, the parsed request stays in a pbuf kept or in httpd_req_buf.
+ * It is copied into one pbuf only when it spans several, so that segments
+ * still coming fit LWIP_HTTPD_REQ_QUEUELEN.
+ *
+ * @param hs http connection state
+ */
+static void
+http_keep_pipelined(struct http_state *hs)
+{
+  u16_t end = pbuf_memfind(hs->req, CRLF CRLF, 4, 0);
+  if ((end != 0xFFFF) && (end + 4 < hs->req->tot_len)) {
+    hs->pipe = pbuf_free_header(hs->req, (u16_t)(end + 4));
+    hs->req = NULL;
+    hs->pipe = pbuf_coalesce(hs->pipe, PBUF_RAW);
+  }
+}
+#endif /* LWIP_HTTPD_SUPPORT_PIPELINE */
+
 /**
  * When data has been received in the correct state, try to parse it
  * as a HTTP request.
@@ -2084,15 +2181,20 @@ http_parse_request(struct pbuf *inp, struct http_state *hs, struct altcp_pcb *pc
         if (lwip_strnstr(data, CRLF CRLF, data_len) != NULL) {
           char *uri = sp1 + 1;
 #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
-          /* This is HTTP/1.0 compatible: for strict 1.1, a connection
-             would always be persistent unless "close" was specified. */
+          /* HTTP/1.0 asks for a persistent connection, for HTTP/1.1 it is
+             the default unless "close" was specified. */
           if (!is_09 && (lwip_strnstr(data, HTTP11_CONNECTIONKEEPALIVE, data_len) ||
-                         lwip_strnstr(data, HTTP11_CONNECTIONKEEPALIVE2, data_len))) {
+                         lwip_strnstr(data, HTTP11_CONNECTIONKEEPALIVE2, data_len) ||
+                         (lwip_strnstr(data, HTTP11_REQUESTLINE, data_len) &&
+                          !lwip_strnistr(data, HTTP11_CONNECTIONCLOSE, data_len)))) {
             hs->keepalive = 1;
           } else {
             hs->keepalive = 0;
           }
 #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+#if LWIP_HTTPD_SUPPORT_GZIP
+          hs->gzip = http_accepts_gzip(data, data_len);
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
           /* null-terminate the METHOD (pbuf is freed anyway wen returning) */
           *sp1 = 0;
           uri[uri_len] = 0;
@@ -2119,6 +2221,15 @@ http_parse_request(struct pbuf *inp, struct http_state *hs, struct altcp_pcb *pc
           } else
 #endif /* LWIP_HTTPD_SUPPORT_POST */
           {
+#if LWIP_HTTPD_CUSTOM_FILES && LWIP_HTTPD_CUSTOM_FILES_REQUEST
+            /* the header lines follow the (now null-terminated) URI */
+            fs_request_custom(sp2 + 1, (int)(data_len - (sp2 + 1 - data)));
+#endif /* LWIP_HTTPD_CUSTOM_FILES && LWIP_HTTPD_CUSTOM_FILES_REQUEST */
+#if LWIP_HTTPD_SUPPORT_PIPELINE
+            if (hs->keepalive) {
+              http_keep_pipelined(hs);
+            }
+#endif /* LWIP_HTTPD_SUPPORT_PIPELINE */
             return http_find_file(hs, uri, is_09);
           }
         }
@@ -2187,6 +2298,41 @@ http_uri_is_ssi(struct fs_file *file, const char *uri)
 }
 #endif /* LWIP_HTTPD_SSI */
 
+/** Open a file for the request, its gzip variant "<name>.gz" if the client
+ * accepts that and the built-in files have one.
+ *
+ * @param hs http connection state
+ * @param name the file name
+ * @return ERR_OK if a file was opened into hs->file_handle
+ */
+static err_t
+http_fs_open(struct http_state *hs, const char *name)
+{
+  err_t err = fs_open(&hs->file_handle, name);
+#if LWIP_HTTPD_SUPPORT_GZIP
+  /* gzip variants only come with the built-in files (makefsdata -gz), custom
+     files are served as they are without looking for "<name>.gz" */
+  if ((err == ERR_OK) && hs->gzip && !(hs->file_handle.flags & FS_FILE_FLAGS_CUSTOM)) {
+    char gz_name[LWIP_HTTPD_MAX_REQUEST_URI_LEN + 4];
+    struct fs_file gz;
+    size_t len = strlen(name);
+    if (len + 4 <= sizeof(gz_name)) {
+      MEMCPY(gz_name, name, len);
+      MEMCPY(&gz_name[len], ".gz", 4);
+      if (fs_open_fsdata(&gz, gz_name) == ERR_OK) {
+        if (gz.flags & FS_FILE_FLAGS_GZIP) {
+          fs_close(&hs->file_handle);
+          hs->file_handle = gz;
+        } else {
+          fs_close(&gz);
+        }
+      }
+    }
+  }
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
+  return err;
+}
+
 /** Try to find the file specified by uri and, if found, initialize hs
  * accordingly.
  *
@@ -2245,7 +2391,7 @@ http_find_file(struct http_state *hs, const char *uri, int is_09)
         file_name = httpd_default_filenames[loop].name;
       }
       LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("Looking for %s...\n", file_name));
-      err = fs_open(&hs->file_handle, file_name);
+      err = http_fs_open(hs, file_name);
       if (err == ERR_OK) {
         uri = file_name;
         file = &hs->file_handle;
@@ -2288,7 +2434,7 @@ http_find_file(struct http_state *hs, const char *uri, int is_09)
 
     LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("Opening %s\n", uri));
 
-    err = fs_open(&hs->file_handle, uri);
+    err = http_fs_open(hs, uri);
     if (err == ERR_OK) {
       file = &hs->file_handle;
     } else {
@@ -2476,7 +2622,7 @@ http_sent(void *arg, struct altcp_pcb *pcb, u16_t len)
 
   hs->retries = 0;
 
-  http_send(pcb, hs);
+  http_send_next(pcb, hs);
 
   return ERR_OK;
 }
@@ -2521,7 +2667,7 @@ http_poll(void *arg, struct altcp_pcb *pcb)
      * cause the connection to close immediately. */
     if (hs->handle) {
       LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("http_poll: try to send more data\n"));
-      if (http_send(pcb, hs)) {
+      if (http_send_next(pcb, hs)) {
         /* If we wrote anything to be sent, go ahead and send it now. */
         LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("tcp_output\n"));
         altcp_output(pcb);
@@ -2532,6 +2678,64 @@ http_poll(void *arg, struct altcp_pcb *pcb)
   return ERR_OK;
 }
 
+/** Parse a received request (or a part of it) and start the response.
+ * Takes over the pbuf.
+ *
+ * @return 1 if hs is kept for the next request, 0 if it may be freed
+ */
+static u8_t
+http_parse_send(struct altcp_pcb *pcb, struct http_state *hs, struct pbuf *p)
+{
+  u8_t next = 0;
+  err_t parsed = http_parse_request(p, hs, pcb);
+  LWIP_ASSERT("http_parse_request: unexpected return value", parsed == ERR_OK
+              || parsed == ERR_INPROGRESS || parsed == ERR_ARG || parsed == ERR_USE);
+#if LWIP_HTTPD_SUPPORT_REQUESTLIST
+  if (parsed != ERR_INPROGRESS) {
+    /* request fully parsed or error */
+    if (hs->req != NULL) {
+      pbuf_free(hs->req);
+      hs->req = NULL;
+    }
+  }
+#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+  pbuf_free(p);
+  if (parsed == ERR_OK) {
+#if LWIP_HTTPD_SUPPORT_POST
+    if (hs->post_content_len_left == 0)
+#endif /* LWIP_HTTPD_SUPPORT_POST */
+    {
+      LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("http_recv: data %p len %"S32_F"\n", (const void *)hs->file, hs->left));
+#if LWIP_HTTPD_SUPPORT_PIPELINE
+      next = hs->keepalive;
+#endif /* LWIP_HTTPD_SUPPORT_PIPELINE */
+      http_send(pcb, hs);
+    }
+  } else if (parsed == ERR_ARG) {
+    /* @todo: close on ERR_USE? */
+    http_close_conn(pcb, hs);
+  }
+  return next;
+}
+
+/** Parse a received request and start the response, then the requests
+ * pipelined behind it as long as their responses are done at once.
+ * Takes over the pbuf.
+ */
+static void
+http_recv_request(struct altcp_pcb *pcb, struct http_state *hs, struct pbuf *p)
+{
+  while (http_parse_send(pcb, hs, p)) {
+#if LWIP_HTTPD_SUPPORT_PIPELINE
+    if ((hs->pipe == NULL) || (hs->handle != NULL)) {
+      break;
+    }
+    p = hs->pipe;
+    hs->pipe = NULL;
+#endif /* LWIP_HTTPD_SUPPORT_PIPELINE */
+  }
+}
+
 /**
  * Data has been received on this pcb.
  * For HTTP 1.0, this should normally only happen once (if the request fits in one packet).
@@ -2559,7 +2763,9 @@ http_recv(void *arg, struct altcp_pcb *pcb, struct pbuf *p, err_t err)
   }
 
 #if LWIP_HTTPD_SUPPORT_POST && LWIP_HTTPD_POST_MANUAL_WND
-  if (hs->no_auto_wnd) {
+  /* only the POST body is left to the application, a request following it
+     on a persistent connection is taken as usual */
+  if (hs->no_auto_wnd && (hs->post_content_len_left > 0)) {
     hs->unrecved_bytes += p->tot_len;
   } else
 #endif /* LWIP_HTTPD_SUPPORT_POST && LWIP_HTTPD_POST_MANUAL_WND */
@@ -2577,39 +2783,27 @@ http_recv(void *arg, struct altcp_pcb *pcb, struct pbuf *p, err_t err)
     /* pbuf is passed to the application, don't free it! */
     if (hs->post_content_len_left == 0) {
       /* all data received, send response or close connection */
-      http_send(pcb, hs);
+      http_send_next(pcb, hs);
     }
     return ERR_OK;
   } else
 #endif /* LWIP_HTTPD_SUPPORT_POST */
   {
     if (hs->handle == NULL) {
-      err_t parsed = http_parse_request(p, hs, pcb);
-      LWIP_ASSERT("http_parse_request: unexpected return value", parsed == ERR_OK
-                  || parsed == ERR_INPROGRESS || parsed == ERR_ARG || parsed == ERR_USE);
-#if LWIP_HTTPD_SUPPORT_REQUESTLIST
-      if (parsed != ERR_INPROGRESS) {
-        /* request fully parsed or error */
-        if (hs->req != NULL) {
-          pbuf_free(hs->req);
-          hs->req = NULL;
-        }
-      }
-#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
-      pbuf_free(p);
-      if (parsed == ERR_OK) {
-#if LWIP_HTTPD_SUPPORT_POST
-        if (hs->post_content_len_left == 0)
-#endif /* LWIP_HTTPD_SUPPORT_POST */
-        {
-          LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("http_recv: data %p len %"S32_F"\n", (const void *)hs->file, hs->left));
-          http_send(pcb, hs);
+      http_recv_request(pcb, hs, p);
+    } else {
+#if LWIP_HTTPD_SUPPORT_PIPELINE
+      if (hs->keepalive && ((hs->pipe == NULL) ||
+          (pbuf_clen(hs->pipe) + pbuf_clen(p) <= LWIP_HTTPD_REQ_QUEUELEN))) {
+        /* pipelined request, parsed when the current response is done */
+        if (hs->pipe == NULL) {
+          hs->pipe = p;
+        } else {
+          pbuf_cat(hs->pipe, p);
         }
-      } else if (parsed == ERR_ARG) {
-        /* @todo: close on ERR_USE? */
-        http_close_conn(pcb, hs);
+        return ERR_OK;
       }
-    } else {
+#endif /* LWIP_HTTPD_SUPPORT_PIPELINE */
       LWIP_DEBUGF(HTTPD_DEBUG, ("http_recv: already sending data\n"));
       /* already sending but still receiving data, we might want to RST here? */
       pbuf_free(p);
@@ -0,0 +1,657 @@
+/**
+ * gzip encoder for makefsdata (-gz): RFC 1951 deflate with LZ77 hash chains
+ * and lazy matching, each block coded with dynamic or fixed Huffman tables,
+ * whichever is smaller, wrapped in a RFC 1952 gzip member.
+ *
+ * Included by makefsdata.c so it still builds from a single source file.
+ */
+
+#define GZ_WSIZE    32768
+#define GZ_WMASK    (GZ_WSIZE - 1)
+#define GZ_HBITS    15
+#define GZ_CHAIN    4096
+#define GZ_MIN      3
+#define GZ_MAX      258
+#define GZ_BLOCK    16384   /* symbols per block */
+
+struct gz_out {
+  u8_t *buf;
+  size_t len;
+  size_t cap;
+  u32_t bits;
+  int nbits;
+};
+
+static const u16_t gz_len_base[29] = {
+  3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const u8_t gz_len_extra[29] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const u16_t gz_dist_base[30] = {
+  1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+  257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const u8_t gz_dist_extra[30] = {
+  0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+  7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+static const u8_t gz_cl_order[19] = {
+  16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+static void gz_byte(struct gz_out *o, u8_t b)
+{
+  if (o->len == o->cap) {
+    o->cap = o->cap ? o->cap * 2 : 4096;
+    o->buf = (u8_t *)realloc(o->buf, o->cap);
+    LWIP_ASSERT("gz_byte: out of memory", o->buf != NULL);
+  }
+  o->buf[o->len++] = b;
+}
+
+/* deflate packs bits LSB first */
+static void gz_put(struct gz_out *o, u32_t v, int n)
+{
+  o->bits |= v << o->nbits;
+  o->nbits += n;
+  while (o->nbits >= 8) {
+    gz_byte(o, (u8_t)o->bits);
+    o->bits >>= 8;
+    o->nbits -= 8;
+  }
+}
+
+static void gz_flush(struct gz_out *o)
+{
+  if (o->nbits > 0) {
+    gz_put(o, 0, 8 - o->nbits);
+  }
+}
+
+static int gz_len_code(int len)
+{
+  int c = 28;
+  while (gz_len_base[c] > len) {
+    c--;
+  }
+  return c;
+}
+
+static int gz_dist_code(int dist)
+{
+  int c = 29;
+  while (gz_dist_base[c] > dist) {
+    c--;
+  }
+  return c;
+}
+
+/* Huffman code lengths of at most 'limit' bits: the frequencies are halved
+   until the tree fits. Always at least two codes, so every table is complete */
+static void gz_lengths(const u32_t *freq, int n, int limit, u8_t *len)
+{
+  u32_t f[2 * 288], w[2 * 288];
+  int parent[2 * 288];
+  int i, nodes, used, max;
+  for (i = 0; i < n; i++) {
+    f[i] = freq[i];
+  }
+  for (used = 0, i = 0; i < n; i++) {
+    used += f[i] != 0;
+  }
+  for (i = 0; used < 2 && i < n; i++) {
+    if (!f[i]) {
+      f[i] = 1;
+      used++;
+    }
+  }
+  for (;;) {
+    nodes = n;
+    for (i = 0; i < n; i++) {
+      w[i] = f[i];
+      parent[i] = -1;
+    }
+    for (;;) {
+      int a = -1, b = -1;
+      for (i = 0; i < nodes; i++) {
+        if (!w[i] || parent[i] >= 0) {
+          continue;
+        }
+        if (a < 0 || w[i] < w[a]) {
+          b = a;
+          a = i;
+        } else if (b < 0 || w[i] < w[b]) {
+          b = i;
+        }
+      }
+      if (b < 0) {
+        break;
+      }
+      w[nodes] = w[a] + w[b];
+      parent[nodes] = -1;
+      parent[a] = parent[b] = nodes++;
+    }
+    for (max = 0, i = 0; i < n; i++) {
+      int d = 0, p = i;
+      if (f[i]) {
+        while (parent[p] >= 0) {
+          p = parent[p];
+          d++;
+        }
+      }
+      len[i] = (u8_t)d;
+      if (d > max) {
+        max = d;
+      }
+    }
+    if (max <= limit) {
+      return;
+    }
+    for (i = 0; i < n; i++) {
+      if (f[i]) {
+        f[i] = (f[i] >> 1) | 1;
+      }
+    }
+  }
+}
+
+/* canonical codes, bit-reversed for LSB first output */
+static void gz_codes(const u8_t *len, int n, u16_t *code)
+{
+  u16_t count[16], next[16];
+  int i, b;
+  memset(count, 0, sizeof(count));
+  for (i = 0; i < n; i++) {
+    count[len[i]]++;
+  }
+  count[0] = 0;
+  next[0] = 0;
+  for (b = 1; b < 16; b++) {
+    next[b] = (u16_t)((next[b - 1] + count[b - 1]) << 1);
+  }
+  for (i = 0; i < n; i++) {
+    u16_t c = 0, v;
+    if (!len[i]) {
+      continue;
+    }
+    v = next[len[i]]++;
+    for (b = 0; b < len[i]; b++) {
+      c = (u16_t)((c << 1) | ((v >> b) & 1));
+    }
+    code[i] = c;
+  }
+}
+
+/* run length coded code lengths (symbols 0..18), returns the count */
+static int gz_rle(const u8_t *len, int n, u16_t *sym, u8_t *ext)
+{
+  int i = 0, k = 0;
+  while (i < n) {
+    int run = 1;
+    while (i + run < n && len[i + run] == len[i]) {
+      run++;
+    }
+    if (len[i] == 0 && run >= 3) {
+      run = run > 138 ? 138 : run;
+      sym[k] = run >= 11 ? 18 : 17;
+      ext[k++] = (u8_t)(run >= 11 ? run - 11 : run - 3);
+    } else if (len[i] != 0 && run >= 4) {
+      run = run > 7 ? 7 : run;
+      sym[k] = len[i];
+      ext[k++] = 0;
+      sym[k] = 16;
+      ext[k++] = (u8_t)(run - 4);
+    } else {
+      run = 1;
+      sym[k] = len[i];
+      ext[k++] = 0;
+    }
+    i += run;
+  }
+  return k;
+}
+
+static void gz_block(struct gz_out *o, const u16_t *lit, const u16_t *dist, int n, int last)
+{
+  u32_t lfreq[286], dfreq[30], cfreq[19];
+  u8_t llen[286], dlen[30], clen[19], fl[288], fd[30], all[316], ext[316];
+  u16_t lcode[286], dcode[30], ccode[19], sym[316];
+  u32_t dyn, fix;
+  int i, nl, nd, nc, ns;
+  const u8_t *ul, *ud;
+  const u16_t *uc, *ucd;
+  u16_t flcode[288], fdcode[30];
+
+  memset(lfreq, 0, sizeof(lfreq));
+  memset(dfreq, 0, sizeof(dfreq));
+  for (i = 0; i < n; i++) {
+    if (dist[i]) {
+      lfreq[257 + gz_len_code(lit[i])]++;
+      dfreq[gz_dist_code(dist[i])]++;
+    } else {
+      lfreq[lit[i]]++;
+    }
+  }
+  lfreq[256] = 1;
+  gz_lengths(lfreq, 286, 15, llen);
+  gz_lengths(dfreq, 30, 15, dlen);
+  for (nl = 286; nl > 257 && !llen[nl - 1]; nl--);
+  for (nd = 30; nd > 1 && !dlen[nd - 1]; nd--);
+  memcpy(all, llen, nl);
+  memcpy(all + nl, dlen, nd);
+  ns = gz_rle(all, nl + nd, sym, ext);
+  memset(cfreq, 0, sizeof(cfreq));
+  for (i = 0; i < ns; i++) {
+    cfreq[sym[i]]++;
+  }
+  gz_lengths(cfreq, 19, 7, clen);
+  for (nc = 19; nc > 4 && !clen[gz_cl_order[nc - 1]]; nc--);
+
+  /* fixed tables of RFC 1951 3.2.6, the canonical codes need all 288
+     literal/length symbols */
+  for (i = 0; i < 288; i++) {
+    fl[i] = i < 144 ? 8 : i < 256 ? 9 : i < 280 ? 7 : 8;
+  }
+  memset(fd, 5, sizeof(fd));
+
+  /* block sizes in bits */
+  dyn = 14 + 3 * nc;
+  for (i = 0; i < ns; i++) {
+    dyn += clen[sym[i]] + (sym[i] == 16 ? 2 : sym[i] == 17 ? 3 : sym[i] == 18 ? 7 : 0);
+  }
+  fix = 0;
+  for (i = 0; i < 286; i++) {
+    dyn += lfreq[i] * llen[i];
+    fix += lfreq[i] * fl[i];
+    if (i >= 257) {
+      dyn += lfreq[i] * gz_len_extra[i - 257];
+      fix += lfreq[i] * gz_len_extra[i - 257];
+    }
+  }
+  for (i = 0; i < 30; i++) {
+    dyn += dfreq[i] * (dlen[i] + gz_dist_extra[i]);
+    fix += dfreq[i] * (fd[i] + gz_dist_extra[i]);
+  }
+
+  gz_put(o, last, 1);
+  if (dyn < fix) {
+    gz_codes(llen, 286, lcode);
+    gz_codes(dlen, 30, dcode);
+    gz_codes(clen, 19, ccode);
+    gz_put(o, 2, 2);
+    gz_put(o, nl - 257, 5);
+    gz_put(o, nd - 1, 5);
+    gz_put(o, nc - 4, 4);
+    for (i = 0; i < nc; i++) {
+      gz_put(o, clen[gz_cl_order[i]], 3);
+    }
+    for (i = 0; i < ns; i++) {
+      gz_put(o, ccode[sym[i]], clen[sym[i]]);
+      if (sym[i] >= 16) {
+        gz_put(o, ext[i], sym[i] == 16 ? 2 : sym[i] == 17 ? 3 : 7);
+      }
+    }
+    ul = llen;
+    ud = dlen;
+    uc = lcode;
+    ucd = dcode;
+  } else {
+    gz_codes(fl, 288, flcode);
+    gz_codes(fd, 30, fdcode);
+    gz_put(o, 1, 2);
+    ul = fl;
+    ud = fd;
+    uc = flcode;
+    ucd = fdcode;
+  }
+  for (i = 0; i < n; i++) {
+    if (dist[i]) {
+      int lc = gz_len_code(lit[i]), dc = gz_dist_code(dist[i]);
+      gz_put(o, uc[257 + lc], ul[257 + lc]);
+      gz_put(o, lit[i] - gz_len_base[lc], gz_len_extra[lc]);
+      gz_put(o, ucd[dc], ud[dc]);
+      gz_put(o, dist[i] - gz_dist_base[dc], gz_dist_extra[dc]);
+    } else {
+      gz_put(o, uc[lit[i]], ul[lit[i]]);
+    }
+  }
+  gz_put(o, uc[256], ul[256]);
+}
+
+static u32_t gz_crc32(const u8_t *d, size_t n)
+{
+  u32_t c = 0xFFFFFFFF;
+  size_t i;
+  int k;
+  for (i = 0; i < n; i++) {
+    c ^= d[i];
+    for (k = 0; k < 8; k++) {
+      c = (c >> 1) ^ (0xEDB88320 & (0 - (c & 1)));
+    }
+  }
+  return ~c;
+}
+
+static int gz_hash(const u8_t *d)
+{
+  return ((d[0] << 10) ^ (d[1] << 5) ^ d[2]) & ((1 << GZ_HBITS) - 1);
+}
+
+static int gz_match(const u8_t *d, size_t n, size_t pos, const int *head, const int *prev, int *dist)
+{
+  int best = 0, chain = GZ_CHAIN;
+  int max = (int)LWIP_MIN(GZ_MAX, n - pos);
+  long p;
+  if (max < GZ_MIN) {
+    return 0;
+  }
+  for (p = head[gz_hash(d + pos)]; p >= 0 && pos - p < GZ_WSIZE && chain--; p = prev[p & GZ_WMASK]) {
+    int l = 0;
+    if (d[p + best] != d[pos + best]) {
+      continue;
+    }
+    while (l < max && d[p + l] == d[pos + l]) {
+      l++;
+    }
+    if (l > best) {
+      best = l;
+      *dist = (int)(pos - p);
+      if (l == max) {
+        break;
+      }
+    }
+  }
+  return best >= GZ_MIN ? best : 0;
+}
+
+/** gzip 'len' bytes of 'data'; returns a malloc'ed buffer and its size */
+static u8_t *gz_compress(const u8_t *data, size_t len, size_t *out_len)
+{
+  struct gz_out o;
+  int *head = (int *)malloc(sizeof(int) << GZ_HBITS);
+  int *prev = (int *)malloc(sizeof(int) * GZ_WSIZE);
+  u16_t *lit = (u16_t *)malloc(sizeof(u16_t) * GZ_BLOCK);
+  u16_t *dist = (u16_t *)malloc(sizeof(u16_t) * GZ_BLOCK);
+  size_t pos = 0, ins = 0;
+  int n = 0, i;
+  u32_t crc = gz_crc32(data, len);
+  static const u8_t hdr[10] = { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 2, 255 };
+
+  LWIP_ASSERT("gz_compress: out of memory", head && prev && lit && dist);
+  memset(&o, 0, sizeof(o));
+  memset(head, 0xFF, sizeof(int) << GZ_HBITS);
+  for (i = 0; i < 10; i++) {
+    gz_byte(&o, hdr[i]);
+  }
+  while (pos < len) {
+    int d = 0, l, d2 = 0;
+    /* hash every position up to here */
+    for (; ins < pos && ins + GZ_MIN <= len; ins++) {
+      int h = gz_hash(data + ins);
+      prev[ins & GZ_WMASK] = head[h];
+      head[h] = (int)ins;
+    }
+    l = gz_match(data, len, pos, head, prev, &d);
+    if (l && l < GZ_MAX && pos + 1 + GZ_MIN <= len) {
+      /* lazy matching: prefer a longer match one byte later */
+      int h = gz_hash(data + pos);
+      prev[pos & GZ_WMASK] = head[h];
+      head[h] = (int)pos;
+      ins = pos + 1;
+      if (gz_match(data, len, pos + 1, head, prev, &d2) > l) {
+        l = 0;
+      }
+    }
+    if (l) {
+      lit[n] = (u16_t)l;
+      dist[n++] = (u16_t)d;
+      pos += l;
+    } else {
+      lit[n] = data[pos++];
+      dist[n++] = 0;
+    }
+    if (n == GZ_BLOCK) {
+      gz_block(&o, lit, dist, n, pos == len);
+      n = 0;
+    }
+  }
+  if (n || !len) {
+    gz_block(&o, lit, dist, n, 1);
+  }
+  gz_flush(&o);
+  for (i = 0; i < 4; i++) {
+    gz_byte(&o, (u8_t)(crc >> (8 * i)));
+  }
+  for (i = 0; i < 4; i++) {
+    gz_byte(&o, (u8_t)(len >> (8 * i)));
+  }
+  free(head);
+  free(prev);
+  free(lit);
+  free(dist);
+  *out_len = o.len;
+  return o.buf;
+}
+
+/* Decoder for the round-trip check: a canonical Huffman decoder after
+ * zlib's puff.c, written apart from the encoder so it does not share its
+ * mistakes. It handles stored, fixed and dynamic blocks. */
+
+struct gz_in {
+  const u8_t *buf;
+  size_t len;
+  size_t pos;
+  u32_t bits;
+  int nbits;
+};
+
+struct gz_huff {
+  u16_t count[16];  /* codes of each length */
+  u16_t symbol[288];
+};
+
+static int gz_need(struct gz_in *s, int n)
+{
+  u32_t v = s->bits;
+  while (s->nbits < n) {
+    if (s->pos == s->len) {
+      return -1;
+    }
+    v |= (u32_t)s->buf[s->pos++] << s->nbits;
+    s->nbits += 8;
+  }
+  s->bits = v >> n;
+  s->nbits -= n;
+  return (int)(v & ((1UL << n) - 1));
+}
+
+/* returns 0, or -1 for an over-subscribed code; an incomplete or empty one
+ * only fails once a missing code is read */
+static int gz_build(struct gz_huff *h, const u8_t *len, int n)
+{
+  u16_t offs[16];
+  int i, left = 1;
+  memset(h->count, 0, sizeof(h->count));
+  for (i = 0; i < n; i++) {
+    h->count[len[i]]++;
+  }
+  for (i = 1; i < 16; i++) {
+    left = (left << 1) - h->count[i];
+    if (left < 0) {
+      return -1;
+    }
+  }
+  offs[1] = 0;
+  for (i = 1; i < 15; i++) {
+    offs[i + 1] = (u16_t)(offs[i] + h->count[i]);
+  }
+  for (i = 0; i < n; i++) {
+    if (len[i]) {
+      h->symbol[offs[len[i]]++] = (u16_t)i;
+    }
+  }
+  return 0;
+}
+
+static int gz_decode(struct gz_in *s, const struct gz_huff *h)
+{
+  int code = 0, first = 0, index = 0, len, bit;
+  for (len = 1; len < 16; len++) {
+    if ((bit = gz_need(s, 1)) < 0) {
+      return -1;
+    }
+    code |= bit;
+    if (code - first < h->count[len]) {
+      return h->symbol[index + code - first];
+    }
+    index += h->count[len];
+    first = (first + h->count[len]) << 1;
+    code <<= 1;
+  }
+  return -1;
+}
+
+static int gz_codes_in(struct gz_in *s, const struct gz_huff *lh, const struct gz_huff *dh,
+                       u8_t *out, size_t cap, size_t *pos)
+{
+  int sym, len, dist, e;
+  for (;;) {
+    if ((sym = gz_decode(s, lh)) < 0) {
+      return -1;
+    }
+    if (sym < 256) {
+      if (*pos == cap) {
+        return -1;
+      }
+      out[(*pos)++] = (u8_t)sym;
+      continue;
+    }
+    if (sym == 256) {
+      return 0;
+    }
+    sym -= 257;
+    if (sym >= 29 || (e = gz_need(s, gz_len_extra[sym])) < 0) {
+      return -1;
+    }
+    len = gz_len_base[sym] + e;
+    if ((sym = gz_decode(s, dh)) < 0 || sym >= 30 || (e = gz_need(s, gz_dist_extra[sym])) < 0) {
+      return -1;
+    }
+    dist = gz_dist_base[sym] + e;
+    if ((size_t)dist > *pos || *pos + len > cap) {
+      return -1;
+    }
+    for (; len; len--, (*pos)++) {
+      out[*pos] = out[*pos - dist];
+    }
+  }
+}
+
+/** Inflate the gzip member 'data' into 'out' (its size is known from the
+ * source); returns 0 if it decodes to exactly 'cap' bytes with the right
+ * CRC-32 and length trailer */
+static int gz_decompress(const u8_t *data, size_t len, u8_t *out, size_t cap)
+{
+  struct gz_in s;
+  struct gz_huff lh, dh;
+  u8_t lens[288 + 32];
+  size_t pos = 0;
+  int last, type, i, n;
+
+  if (len < 18 || data[0] != 0x1f || data[1] != 0x8b || data[2] != 8 || data[3] != 0) {
+    return -1;
+  }
+  memset(&s, 0, sizeof(s));
+  s.buf = data;
+  s.len = len - 8;
+  s.pos = 10;
+  do {
+    if ((last = gz_need(&s, 1)) < 0 || (type = gz_need(&s, 2)) < 0) {
+      return -1;
+    }
+    if (type == 0) {
+      s.bits = 0;
+      s.nbits = 0;
+      if (s.pos + 4 > s.len) {
+        return -1;
+      }
+      n = s.buf[s.pos] | s.buf[s.pos + 1] << 8;
+      if ((n ^ 0xFFFF) != (s.buf[s.pos + 2] | s.buf[s.pos + 3] << 8) ||
+          s.pos + 4 + n > s.len || pos + n > cap) {
+        return -1;
+      }
+      memcpy(out + pos, s.buf + s.pos + 4, n);
+      s.pos += 4 + n;
+      pos += n;
+      continue;
+    }
+    if (type == 1) {
+      for (i = 0; i < 288; i++) {
+        lens[i] = i < 144 ? 8 : i < 256 ? 9 : i < 280 ? 7 : 8;
+      }
+      gz_build(&lh, lens, 288);
+      memset(lens, 5, 30);
+      gz_build(&dh, lens, 30);
+    } else if (type == 2) {
+      int nlen = gz_need(&s, 5) + 257, ndist = gz_need(&s, 5) + 1, ncode = gz_need(&s, 4) + 4;
+      struct gz_huff ch;
+      if (nlen < 257 || nlen > 286 || ndist < 1 || ndist > 30 || ncode < 4) {
+        return -1;
+      }
+      memset(lens, 0, 19);
+      for (i = 0; i < ncode; i++) {
+        if ((n = gz_need(&s, 3)) < 0) {
+          return -1;
+        }
+        lens[gz_cl_order[i]] = (u8_t)n;
+      }
+      if (gz_build(&ch, lens, 19)) {
+        return -1;
+      }
+      for (i = 0; i < nlen + ndist;) {
+        int sym = gz_decode(&s, &ch), rep, val = 0;
+        if (sym < 0) {
+          return -1;
+        }
+        if (sym < 16) {
+          lens[i++] = (u8_t)sym;
+          continue;
+        }
+        if (sym == 16) {
+          val = i ? lens[i - 1] : -1;
+          rep = gz_need(&s, 2) + 3;
+        } else if (sym == 17) {
+          rep = gz_need(&s, 3) + 3;
+        } else {
+          rep = gz_need(&s, 7) + 11;
+        }
+        if (val < 0 || rep < (sym == 18 ? 11 : 3) || i + rep > nlen + ndist) {
+          return -1;
+        }
+        while (rep--) {
+          lens[i++] = (u8_t)val;
+        }
+      }
+      if (!lens[256] || gz_build(&lh, lens, nlen) || gz_build(&dh, lens + nlen, ndist)) {
+        return -1;
+      }
+    } else {
+      return -1;
+    }
+    if (gz_codes_in(&s, &lh, &dh, out, cap, &pos)) {
+      return -1;
+    }
+  } while (!last);
+  if (pos != cap || s.pos != s.len) {
+    return -1;
+  }
+  data += len - 8;
+  if (gz_crc32(out, pos) != (u32_t)(data[0] | data[1] << 8 | data[2] << 16 | (u32_t)data[3] << 24) ||
+      (u32_t)pos != (u32_t)(data[4] | data[5] << 8 | data[6] << 16 | (u32_t)data[7] << 24)) {
+    return -1;
+  }
+  return 0;
+}
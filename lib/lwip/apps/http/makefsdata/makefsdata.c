@@ -106,6 +106,7 @@ static int deflate_level; /* default compression level, can be changed via comma
 
 #include "../core/inet_chksum.c"
 #include "../core/def.c"
+#include "gzip.c"
 
 /** (Your server name here) */
 static const char *serverID = "Server: "HTTPD_SERVER_AGENT"\r\n";
@@ -130,8 +131,9 @@ struct file_entry {
 
 int process_sub(FILE *data_file, FILE *struct_file);
 int process_file(FILE *data_file, FILE *struct_file, const char *filename);
+static int process_file_variant(FILE *data_file, FILE *struct_file, const char *filename, int gz);
 int file_write_http_header(FILE *data_file, const char *filename, int file_size, u16_t *http_hdr_len,
-                           u16_t *http_hdr_chksum, u8_t provide_content_len, int is_compressed);
+                           u16_t *http_hdr_chksum, u8_t provide_content_len, int is_compressed, int gz);
 int file_put_ascii(FILE *file, const char *ascii_string, int len, int *i);
 int s_put_ascii(char *buf, const char *ascii_string, int len, int *i);
 void concat_files(const char *file1, const char *file2, const char *targetfile);
@@ -154,6 +156,7 @@ static unsigned char useHttp11 = 0;
 static unsigned char supportSsi = 1;
 static unsigned char precalcChksum = 0;
 static unsigned char includeLastModified = 0;
+static unsigned char gzipFiles = 0;
 #if MAKEFS_SUPPORT_DEFLATE
 static unsigned char deflateNonSsiFiles = 0;
 static size_t deflatedBytesReduced = 0;
@@ -171,7 +174,7 @@ static size_t ssi_file_num_lines;
 
 static void print_usage(void)
 {
-  printf(" Usage: htmlgen [targetdir] [-s] [-e] [-11] [-nossi] [-ssi:<filename>] [-c] [-f:<filename>] [-m] [-svr:<name>] [-x:<ext_list>] [-xc:<ext_list>" USAGE_ARG_DEFLATE NEWLINE NEWLINE);
+  printf(" Usage: htmlgen [targetdir] [-s] [-e] [-11] [-nossi] [-ssi:<filename>] [-c] [-f:<filename>] [-m] [-svr:<name>] [-x:<ext_list>] [-xc:<ext_list>] [-gz" USAGE_ARG_DEFLATE NEWLINE NEWLINE);
   printf("   targetdir: relative or absolute path to files to convert" NEWLINE);
   printf("   switch -s: toggle processing of subdirectories (default is on)" NEWLINE);
   printf("   switch -e: exclude HTTP header from file (header is created at runtime, default is off)" NEWLINE);
@@ -184,6 +187,8 @@ static void print_usage(void)
   printf("   switch -svr: server identifier sent in HTTP response header ('Server' field)" NEWLINE);
   printf("   switch -x: comma separated list of extensions of files to exclude (e.g., -x:json,txt)" NEWLINE);
   printf("   switch -xc: comma separated list of extensions of files to not compress (e.g., -xc:mp3,jpg)" NEWLINE);
+  printf("   switch -gz: add a gzip-compressed \"<name>.gz\" variant of every non-SSI file it shrinks by 1/8," NEWLINE);
+  printf("               httpd sends it to clients accepting gzip (LWIP_HTTPD_SUPPORT_GZIP)" NEWLINE);
 #if MAKEFS_SUPPORT_DEFLATE
   printf("   switch -defl: deflate-compress all non-SSI files (with opt. compr.-level, default=10)" NEWLINE);
   printf("                 ATTENTION: browser has to support \"Content-Encoding: deflate\"!" NEWLINE);
@@ -245,6 +250,8 @@ int main(int argc, char *argv[])
         printf("Writing to file \"%s\"\n", targetfile);
       } else if (!strcmp(argv[i], "-m")) {
         includeLastModified = 1;
+      } else if (!strcmp(argv[i], "-gz")) {
+        gzipFiles = 1;
       } else if (strstr(argv[i], "-defl") == argv[i]) {
 #if MAKEFS_SUPPORT_DEFLATE
         const char *colon = &argv[i][5];
@@ -342,6 +349,8 @@ int main(int argc, char *argv[])
   fprintf(data_file, "#ifndef FS_FILE_FLAGS_HEADER_INCLUDED" NEWLINE "#define FS_FILE_FLAGS_HEADER_INCLUDED 1" NEWLINE "#endif" NEWLINE);
   /* define FS_FILE_FLAGS_HEADER_PERSISTENT to 0 if not defined (compatibility with older httpd/fs: wasn't supported back then) */
   fprintf(data_file, "#ifndef FS_FILE_FLAGS_HEADER_PERSISTENT" NEWLINE "#define FS_FILE_FLAGS_HEADER_PERSISTENT 0" NEWLINE "#endif" NEWLINE);
+  /* define FS_FILE_FLAGS_GZIP to 0 if not defined (older httpd/fs do not look for gzip variants) */
+  fprintf(data_file, "#ifndef FS_FILE_FLAGS_GZIP" NEWLINE "#define FS_FILE_FLAGS_GZIP 0" NEWLINE "#endif" NEWLINE);
 
   /* define alignment defines */
 #if ALIGN_PAYLOAD
@@ -551,11 +560,12 @@ int process_sub(FILE *data_file, FILE *struct_file)
 
             printf("processing %s/%s..." NEWLINE, curSubdir, curName);
 
-            if (process_file(data_file, struct_file, curName) < 0) {
+            ret = process_file(data_file, struct_file, curName);
+            if (ret < 0) {
               printf(NEWLINE "Error... aborting" NEWLINE);
               return -1;
             }
-            filesProcessed++;
+            filesProcessed += ret;
           }
         }
       }
@@ -565,7 +575,7 @@ int process_sub(FILE *data_file, FILE *struct_file)
   return filesProcessed;
 }
 
-static u8_t *get_file_data(const char *filename, int *file_size, int can_be_compressed, int *is_compressed)
+static u8_t *get_file_data(const char *filename, int *file_size, int can_be_compressed, int *is_compressed, int gz)
 {
   FILE *inFile;
   size_t fsize = 0;
@@ -678,6 +688,21 @@ static u8_t *get_file_data(const char *filename, int *file_size, int can_be_comp
   LWIP_UNUSED_ARG(can_be_compressed);
 #endif
   fclose(inFile);
+  if (gz) {
+    size_t gz_size;
+    u8_t *gz_buf = gz_compress(buf, (size_t)*file_size, &gz_size);
+    u8_t *chk = (u8_t *)malloc((size_t)*file_size + 1);
+    LWIP_ASSERT("chk != NULL", chk != NULL);
+    if (gz_decompress(gz_buf, gz_size, chk, (size_t)*file_size) ||
+        memcmp(buf, chk, (size_t)*file_size)) {
+      printf("%s: gzip round-trip check failed" NEWLINE, filename);
+      exit(-1);
+    }
+    free(chk);
+    free(buf);
+    buf = gz_buf;
+    *file_size = (int)gz_size;
+  }
   return buf;
 }
 
@@ -958,7 +983,36 @@ static int file_can_be_compressed(const char *filename)
     return (ncompress_list == NULL) || !ext_in_list(filename, ncompress_list);
 }
 
+/** Emits the file and its gzip variant, if that is smaller.
+ * Returns the number of fsdata entries written or -1 */
 int process_file(FILE *data_file, FILE *struct_file, const char *filename)
+{
+  int gz = 0;
+  if (gzipFiles && includeHttpHeader && !is_ssi_file(filename) && file_can_be_compressed(filename)) {
+    int file_size, gz_size, is_compressed;
+    u8_t *file_data = get_file_data(filename, &file_size, 0, &is_compressed, 0);
+    free(file_data);
+    file_data = get_file_data(filename, &gz_size, 0, &is_compressed, 1);
+    free(file_data);
+    /* a variant costs its full size in flash, keep it only if it saves 1/8 */
+    if (gz_size < file_size - file_size / 8) {
+      printf(" - gzip: %d bytes -> %d bytes (%.02f%%)" NEWLINE, file_size, gz_size, (float)((gz_size * 100.0) / file_size));
+      gz = 1;
+    } else {
+      printf(" - no gzip variant: (%d bytes -> %d bytes)" NEWLINE, file_size, gz_size);
+    }
+  }
+  if (process_file_variant(data_file, struct_file, filename, gz) < 0) {
+    return -1;
+  }
+  if (gz && (process_file_variant(data_file, struct_file, filename, 2) < 0)) {
+    return -1;
+  }
+  return 1 + gz;
+}
+
+/** gz: 0 plain file, 1 plain file with a gzip variant, 2 the gzip variant */
+static int process_file_variant(FILE *data_file, FILE *struct_file, const char *filename, int gz)
 {
   char varname[MAX_PATH_LEN];
   int i = 0;
@@ -976,7 +1030,11 @@ int process_file(FILE *data_file, FILE *struct_file, const char *filename)
   int flags_printed;
 
   /* create qualified name (@todo: prepend slash or not?) */
-  snprintf(qualifiedName, sizeof(qualifiedName), "%s/%s", curSubdir, filename);
+  if ((size_t)snprintf(qualifiedName, sizeof(qualifiedName), "%s/%s%s", curSubdir, filename,
+                       gz == 2 ? ".gz" : "") >= sizeof(qualifiedName)) {
+    printf("File name too long: \"%s/%s\"" NEWLINE, curSubdir, filename);
+    return -1;
+  }
   /* create C variable name */
   strncpy(varname, qualifiedName, sizeof(varname));
   /* convert slashes & dots to underscores */
@@ -1006,10 +1064,13 @@ int process_file(FILE *data_file, FILE *struct_file, const char *filename)
     flags |= FS_FILE_FLAGS_SSI;
   }
   has_content_len = !is_ssi;
-  can_be_compressed = includeHttpHeader && !is_ssi && file_can_be_compressed(filename);
-  file_data = get_file_data(filename, &file_size, can_be_compressed, &is_compressed);
+  can_be_compressed = includeHttpHeader && !is_ssi && file_can_be_compressed(filename) && !gz;
+  file_data = get_file_data(filename, &file_size, can_be_compressed, &is_compressed, gz == 2);
+  if (gz == 2) {
+    flags |= FS_FILE_FLAGS_GZIP;
+  }
   if (includeHttpHeader) {
-    file_write_http_header(data_file, filename, file_size, &http_hdr_len, &http_hdr_chksum, has_content_len, is_compressed);
+    file_write_http_header(data_file, filename, file_size, &http_hdr_len, &http_hdr_chksum, has_content_len, is_compressed, gz);
     flags |= FS_FILE_FLAGS_HEADER_INCLUDED;
     if (has_content_len) {
       flags |= FS_FILE_FLAGS_HEADER_PERSISTENT;
@@ -1055,6 +1116,13 @@ int process_file(FILE *data_file, FILE *struct_file, const char *filename)
     fputs("FS_FILE_FLAGS_SSI", struct_file);
     flags_printed = 1;
   }
+  if (flags & FS_FILE_FLAGS_GZIP) {
+    if (flags_printed) {
+      fputs(" | ", struct_file);
+    }
+    fputs("FS_FILE_FLAGS_GZIP", struct_file);
+    flags_printed = 1;
+  }
   if (!flags_printed) {
     fputs("0", struct_file);
   }
@@ -1077,7 +1145,7 @@ int process_file(FILE *data_file, FILE *struct_file, const char *filename)
 }
 
 int file_write_http_header(FILE *data_file, const char *filename, int file_size, u16_t *http_hdr_len,
-                           u16_t *http_hdr_chksum, u8_t provide_content_len, int is_compressed)
+                           u16_t *http_hdr_chksum, u8_t provide_content_len, int is_compressed, int gz)
 {
   int i = 0;
   int response_type = HTTP_HDR_OK;
@@ -1254,6 +1322,19 @@ int file_write_http_header(FILE *data_file, const char *filename, int file_size,
   LWIP_UNUSED_ARG(is_compressed);
 #endif
 
+  if (gz) {
+    /* caches must key on Accept-Encoding, the gzip variant tells its encoding */
+    cur_string = gz == 2 ? "Content-Encoding: gzip\r\nVary: Accept-Encoding\r\n" : "Vary: Accept-Encoding\r\n";
+    cur_len = strlen(cur_string);
+    fprintf(data_file, NEWLINE "/* \"%s\" (%"SZT_F" bytes) */" NEWLINE, cur_string, cur_len);
+    written += file_put_ascii(data_file, cur_string, cur_len, &i);
+    i = 0;
+    if (precalcChksum) {
+      memcpy(&hdr_buf[hdr_len], cur_string, cur_len);
+      hdr_len += cur_len;
+    }
+  }
+
   /* write content-type, ATTENTION: this includes the double-CRLF! */
   cur_string = file_type;
   cur_len = strlen(cur_string);
@@ -5,7 +5,8 @@
  * @author   Logan Gunthorpe <logang@deltatee.com>
  *           Dirk Ziegelmeier <dziegel@gmx.de>
  *
- * @brief    Trivial File Transfer Protocol (RFC 1350)
+ * @brief    Trivial File Transfer Protocol (RFC 1350) with the blksize,
+ *           tsize and windowsize options (RFC 2347, 2348, 2349, 7440)
  *
  * Copyright (c) Deltatee Enterprises Ltd. 2013
  * All rights reserved.
@@ -65,6 +66,11 @@
 #define TFTP_DATA  3
 #define TFTP_ACK   4
 #define TFTP_ERROR 5
+#define TFTP_OACK  6
+
+/* RFC 2348 blksize range */
+#define TFTP_MIN_BLKSIZE      8
+#define TFTP_OPTION_LEN       16
 
 enum tftp_error {
   TFTP_ERROR_FILE_NOT_FOUND    = 1,
@@ -81,22 +87,64 @@ enum tftp_error {
 struct tftp_state {
   const struct tftp_context *ctx;
   void *handle;
+  /* OACK, resent until the client answers it */
   struct pbuf *last_data;
+  /* read: blocks sent but not acknowledged yet, starting at blknum */
+  struct pbuf *window[TFTP_MAX_WINDOWSIZE];
   struct udp_pcb *upcb;
   ip_addr_t addr;
   u16_t port;
   int timer;
   int last_pkt;
+  /* read: first unacknowledged block, write: next expected block */
   u16_t blknum;
+  u16_t blksize;
+  u16_t windowsize;
+  /* read: blocks in window[] */
+  u16_t window_len;
+  /* write: blocks received since the last ACK */
+  u16_t ack_count;
   u8_t retries;
   u8_t mode_write;
   u8_t tftp_mode;
+  /* read: the last (short) block has been read */
+  u8_t eof;
+  /* write: a block was missed and acknowledged, wait for the client to go back */
+  u8_t gap;
+  /* the transfer was requested by a client (RRQ/WRQ) */
+  u8_t server;
 };
 
 static struct tftp_state tftp_state;
 
 static void tftp_tmr(void *arg);
 
+static void
+free_window(u16_t count)
+{
+  u16_t i;
+
+  for (i = 0; i < count; i++) {
+    pbuf_free(tftp_state.window[i]);
+  }
+  tftp_state.window_len = (u16_t)(tftp_state.window_len - count);
+  memmove(&tftp_state.window[0], &tftp_state.window[count],
+          tftp_state.window_len * sizeof(tftp_state.window[0]));
+}
+
+static void
+reset_transfer(void)
+{
+  free_window(tftp_state.window_len);
+  tftp_state.blknum = 1;
+  tftp_state.blksize = TFTP_MAX_PAYLOAD_SIZE;
+  tftp_state.windowsize = 1;
+  tftp_state.ack_count = 0;
+  tftp_state.eof = 0;
+  tftp_state.gap = 0;
+  tftp_state.server = 0;
+}
+
 static void
 close_handle(void)
 {
@@ -107,6 +155,7 @@ close_handle(void)
     pbuf_free(tftp_state.last_data);
     tftp_state.last_data = NULL;
   }
+  free_window(tftp_state.window_len);
 
   sys_untimeout(tftp_tmr, NULL);
 
@@ -192,15 +241,15 @@ send_ack(const ip_addr_t *addr, u16_t port, u16_t blknum)
 }
 
 static err_t
-resend_data(const ip_addr_t *addr, u16_t port)
+resend_data(const ip_addr_t *addr, u16_t port, struct pbuf *data)
 {
   err_t ret;
-  struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, tftp_state.last_data->len, PBUF_RAM);
+  struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, data->len, PBUF_RAM);
   if (p == NULL) {
     return ERR_MEM;
   }
 
-  ret = pbuf_copy(p, tftp_state.last_data);
+  ret = pbuf_copy(p, data);
   if (ret != ERR_OK) {
     pbuf_free(p);
     return ret;
@@ -211,32 +260,132 @@ resend_data(const ip_addr_t *addr, u16_t port)
   return ret;
 }
 
+/* Tops the window up with new blocks and sends all of it, a window always
+   starts at the first block not acknowledged yet (RFC 7440) */
 static void
 send_data(const ip_addr_t *addr, u16_t port)
 {
-  u16_t *payload;
+  struct pbuf *p;
+  u16_t i;
   int ret;
 
-  if (tftp_state.last_data != NULL) {
-    pbuf_free(tftp_state.last_data);
+  while (!tftp_state.eof && (tftp_state.window_len < tftp_state.windowsize)) {
+    p = init_packet(TFTP_DATA, (u16_t)(tftp_state.blknum + tftp_state.window_len), tftp_state.blksize);
+    if (p == NULL) {
+      break;
+    }
+
+    ret = tftp_state.ctx->read(tftp_state.handle, (u8_t *)p->payload + TFTP_HEADER_LENGTH, tftp_state.blksize);
+    if (ret < 0) {
+      pbuf_free(p);
+      send_error(addr, port, TFTP_ERROR_ACCESS_VIOLATION, "Error occurred while reading the file.");
+      close_handle();
+      return;
+    }
+
+    pbuf_realloc(p, (u16_t)(TFTP_HEADER_LENGTH + ret));
+    tftp_state.eof = ret < tftp_state.blksize;
+    tftp_state.window[tftp_state.window_len++] = p;
   }
 
-  tftp_state.last_data = init_packet(TFTP_DATA, tftp_state.blknum, TFTP_MAX_PAYLOAD_SIZE);
-  if (tftp_state.last_data == NULL) {
-    return;
+  for (i = 0; i < tftp_state.window_len; i++) {
+    resend_data(addr, port, tftp_state.window[i]);
   }
+}
+
+/* Option values are decimal, -1 if it is not a number or does not fit an int */
+static int
+option_value(const char *str)
+{
+  int value = 0;
 
-  payload = (u16_t *) tftp_state.last_data->payload;
+  if (*str == 0) {
+    return -1;
+  }
+  for (; *str; str++) {
+    if ((*str < '0') || (*str > '9') || (value > (0x7FFFFFFF - (*str - '0')) / 10)) {
+      return -1;
+    }
+    value = value * 10 + (*str - '0');
+  }
+  return value;
+}
 
-  ret = tftp_state.ctx->read(tftp_state.handle, &payload[2], TFTP_MAX_PAYLOAD_SIZE);
-  if (ret < 0) {
-    send_error(addr, port, TFTP_ERROR_ACCESS_VIOLATION, "Error occurred while reading the file.");
-    close_handle();
+static void
+add_option(struct pbuf *p, u16_t *len, const char *name, int value)
+{
+  char str[TFTP_OPTION_LEN];
+
+  lwip_itoa(str, sizeof(str), value);
+  if (*len + strlen(name) + strlen(str) + 2 > p->tot_len) {
     return;
   }
+  pbuf_take_at(p, name, (u16_t)(strlen(name) + 1), *len);
+  *len = (u16_t)(*len + strlen(name) + 1);
+  pbuf_take_at(p, str, (u16_t)(strlen(str) + 1), *len);
+  *len = (u16_t)(*len + strlen(str) + 1);
+}
+
+/* Negotiates the RFC 2347 options following the mode string. Returns the
+ * OACK or NULL if no option was accepted, *err is set if the transfer has to
+ * be refused. */
+static struct pbuf*
+parse_options(struct pbuf *req, u16_t offset, u8_t write, enum tftp_error *err)
+{
+  const char tftp_null = 0;
+  char name[TFTP_OPTION_LEN];
+  char str[TFTP_OPTION_LEN];
+  struct pbuf *p;
+  u16_t name_end, str_end, len = 2;
+  u8_t seen = 0;
+  int value;
+
+  *err = (enum tftp_error)0;
+  p = pbuf_alloc(PBUF_TRANSPORT, 2 + 3 * 2 * TFTP_OPTION_LEN, PBUF_RAM);
+  if (p == NULL) {
+    return NULL;
+  }
+  *(u16_t *)p->payload = PP_HTONS(TFTP_OACK);
+
+  while (offset < req->tot_len) {
+    name_end = pbuf_memfind(req, &tftp_null, sizeof(tftp_null), offset);
+    str_end = pbuf_memfind(req, &tftp_null, sizeof(tftp_null), (u16_t)(name_end + 1));
+    if ((name_end == 0xFFFF) || (str_end == 0xFFFF) ||
+        (name_end - offset >= TFTP_OPTION_LEN) || (str_end - name_end > TFTP_OPTION_LEN)) {
+      break;
+    }
+    pbuf_copy_partial(req, name, (u16_t)(name_end - offset + 1), offset);
+    pbuf_copy_partial(req, str, (u16_t)(str_end - name_end), (u16_t)(name_end + 1));
+    offset = (u16_t)(str_end + 1);
+    value = option_value(str);
+
+    /* each option is answered once, repeats are ignored */
+    if (!lwip_stricmp(name, "blksize") && !(seen & 1) && (value >= TFTP_MIN_BLKSIZE)) {
+      seen |= 1;
+      tftp_state.blksize = (u16_t)LWIP_MIN(value, TFTP_MAX_BLKSIZE);
+      add_option(p, &len, "blksize", tftp_state.blksize);
+    } else if (!lwip_stricmp(name, "windowsize") && !(seen & 2) && (value >= 1)) {
+      seen |= 2;
+      tftp_state.windowsize = (u16_t)LWIP_MIN(value, TFTP_MAX_WINDOWSIZE);
+      add_option(p, &len, "windowsize", tftp_state.windowsize);
+    } else if (!lwip_stricmp(name, "tsize") && !(seen & 4) && (value >= 0) && (tftp_state.ctx->tsize != NULL)) {
+      seen |= 4;
+      /* write: the size to expect, read: ask for the file size */
+      value = tftp_state.ctx->tsize(tftp_state.handle, write ? value : -1);
+      if (value >= 0) {
+        add_option(p, &len, "tsize", value);
+      } else if (write) {
+        *err = TFTP_ERROR_DISK_FULL;
+      }
+    }
+  }
 
-  pbuf_realloc(tftp_state.last_data, (u16_t)(TFTP_HEADER_LENGTH + ret));
-  resend_data(addr, port);
+  if ((len == 2) || (*err != 0)) {
+    pbuf_free(p);
+    return NULL;
+  }
+  pbuf_realloc(p, len);
+  return p;
 }
 
 static void
@@ -244,6 +393,7 @@ tftp_recv(void *arg, struct udp_pcb *upcb, struct pbuf *p, const ip_addr_t *addr
 {
   u16_t *sbuf = (u16_t *) p->payload;
   int opcode;
+  u8_t oack_answered = 0;
 
   LWIP_UNUSED_ARG(arg);
   LWIP_UNUSED_ARG(upcb);
@@ -260,6 +410,13 @@ tftp_recv(void *arg, struct udp_pcb *upcb, struct pbuf *p, const ip_addr_t *addr
   tftp_state.last_pkt = tftp_state.timer;
   tftp_state.retries = 0;
 
+  if ((tftp_state.last_data != NULL) && (opcode != PP_HTONS(TFTP_RRQ)) && (opcode != PP_HTONS(TFTP_WRQ))) {
+    /* the client answered the OACK */
+    pbuf_free(tftp_state.last_data);
+    tftp_state.last_data = NULL;
+    oack_answered = 1;
+  }
+
   switch (opcode) {
     case PP_HTONS(TFTP_RRQ): /* fall through */
     case PP_HTONS(TFTP_WRQ): {
@@ -268,6 +425,7 @@ tftp_recv(void *arg, struct udp_pcb *upcb, struct pbuf *p, const ip_addr_t *addr
       char mode[TFTP_MAX_MODE_LEN + 1];
       u16_t filename_end_offset;
       u16_t mode_end_offset;
+      enum tftp_error err;
 
       if (tftp_state.handle != NULL) {
         send_error(addr, port, TFTP_ERROR_ACCESS_VIOLATION, "Only one connection at a time is supported");
@@ -298,25 +456,36 @@ tftp_recv(void *arg, struct udp_pcb *upcb, struct pbuf *p, const ip_addr_t *addr
       pbuf_copy_partial(p, mode, mode_end_offset - filename_end_offset, filename_end_offset + 1);
 
       tftp_state.handle = tftp_state.ctx->open(filename, mode, opcode == PP_HTONS(TFTP_WRQ));
-      tftp_state.blknum = 1;
+      reset_transfer();
 
       if (!tftp_state.handle) {
         send_error(addr, port, TFTP_ERROR_FILE_NOT_FOUND, "Unable to open requested file.");
         break;
       }
 
+      tftp_state.last_data = parse_options(p, (u16_t)(mode_end_offset + 1), opcode == PP_HTONS(TFTP_WRQ), &err);
+      if (err != 0) {
+        send_error(addr, port, err, "Not enough space for the file.");
+        close_handle();
+        break;
+      }
+
       LWIP_DEBUGF(TFTP_DEBUG | LWIP_DBG_STATE, ("tftp: %s request from ", (opcode == PP_HTONS(TFTP_WRQ)) ? "write" : "read"));
       ip_addr_debug_print(TFTP_DEBUG | LWIP_DBG_STATE, addr);
-      LWIP_DEBUGF(TFTP_DEBUG | LWIP_DBG_STATE, (" for '%s' mode '%s'\n", filename, mode));
+      LWIP_DEBUGF(TFTP_DEBUG | LWIP_DBG_STATE, (" for '%s' mode '%s' blksize %"U16_F" windowsize %"U16_F"\n",
+                  filename, mode, tftp_state.blksize, tftp_state.windowsize));
 
       ip_addr_copy(tftp_state.addr, *addr);
       tftp_state.port = port;
+      tftp_state.mode_write = opcode == PP_HTONS(TFTP_WRQ);
+      tftp_state.server = 1;
 
-      if (opcode == PP_HTONS(TFTP_WRQ)) {
-        tftp_state.mode_write = 1;
+      if (tftp_state.last_data != NULL) {
+        /* the client goes on with DATA 1 (write) or ACK 0 (read) */
+        resend_data(addr, port, tftp_state.last_data);
+      } else if (tftp_state.mode_write) {
         send_ack(addr, port, 0);
       } else {
-        tftp_state.mode_write = 0;
         send_data(addr, port);
       }
 
@@ -345,27 +514,35 @@ tftp_recv(void *arg, struct udp_pcb *upcb, struct pbuf *p, const ip_addr_t *addr
         if (ret < 0) {
           send_error(addr, port, TFTP_ERROR_ACCESS_VIOLATION, "error writing file");
           close_handle();
-        } else {
-          send_ack(addr, port, blknum);
+          break;
         }
 
-        if (p->tot_len < TFTP_MAX_PAYLOAD_SIZE) {
+        tftp_state.gap = 0;
+        if (p->tot_len < tftp_state.blksize) {
+          send_ack(addr, port, blknum);
           close_handle();
         } else {
           tftp_state.blknum++;
+          /* one ACK per window */
+          if (++tftp_state.ack_count >= tftp_state.windowsize) {
+            send_ack(addr, port, blknum);
+            tftp_state.ack_count = 0;
+          }
         }
-      } else if ((u16_t)(blknum + 1) == tftp_state.blknum) {
-        /* retransmit of previous block, ack again (casting to u16_t to care for overflow) */
-        send_ack(addr, port, blknum);
-      } else {
-        send_error(addr, port, TFTP_ERROR_UNKNOWN_TRFR_ID, "Wrong block number");
+      } else if (!tftp_state.gap) {
+        /* retransmit or a lost block: acknowledge the last block received in
+           order, the client sends again from there (casting to u16_t to care
+           for overflow) */
+        send_ack(addr, port, (u16_t)(tftp_state.blknum - 1));
+        tftp_state.ack_count = 0;
+        tftp_state.gap = 1;
       }
       break;
     }
 
     case PP_HTONS(TFTP_ACK): {
       u16_t blknum;
-      int lastpkt;
+      u16_t acked;
 
       if (tftp_state.handle == NULL) {
         send_error(addr, port, TFTP_ERROR_ACCESS_VIOLATION, "No connection");
@@ -377,23 +554,25 @@ tftp_recv(void *arg, struct udp_pcb *upcb, struct pbuf *p, const ip_addr_t *addr
         break;
       }
 
+      /* blocks of the window acknowledged by this ACK, the client may
+         acknowledge part of a window to have the rest sent again */
       blknum = lwip_ntohs(sbuf[1]);
-      if (blknum != tftp_state.blknum) {
-        send_error(addr, port, TFTP_ERROR_UNKNOWN_TRFR_ID, "Wrong block number");
+      acked = (u16_t)(blknum + 1 - tftp_state.blknum);
+      if ((acked > tftp_state.window_len) || ((acked == 0) && !oack_answered)) {
+        /* duplicate ACK of an earlier window: ignore it, answering it would
+           send every block twice from here on (Sorcerer's Apprentice,
+           RFC 1123). tftp_tmr() resends the window if it was lost. Only
+           ACK 0 to the OACK starts the first window. */
         break;
       }
 
-      lastpkt = 0;
-
-      if (tftp_state.last_data != NULL) {
-        lastpkt = tftp_state.last_data->tot_len != (TFTP_MAX_PAYLOAD_SIZE + TFTP_HEADER_LENGTH);
-      }
+      free_window(acked);
+      tftp_state.blknum = (u16_t)(tftp_state.blknum + acked);
 
-      if (!lastpkt) {
-        tftp_state.blknum++;
-        send_data(addr, port);
-      } else {
+      if (tftp_state.eof && (tftp_state.window_len == 0)) {
         close_handle();
+      } else {
+        send_data(addr, port);
       }
 
       break;
@@ -416,6 +595,8 @@ tftp_recv(void *arg, struct udp_pcb *upcb, struct pbuf *p, const ip_addr_t *addr
 static void
 tftp_tmr(void *arg)
 {
+  u16_t i;
+
   LWIP_UNUSED_ARG(arg);
 
   tftp_state.timer++;
@@ -427,10 +608,25 @@ tftp_tmr(void *arg)
   sys_timeout(TFTP_TIMER_MSECS, tftp_tmr, NULL);
 
   if ((tftp_state.timer - tftp_state.last_pkt) > (TFTP_TIMEOUT_MSECS / TFTP_TIMER_MSECS)) {
-    if ((tftp_state.last_data != NULL) && (tftp_state.retries < TFTP_MAX_RETRIES)) {
+    if (tftp_state.retries < TFTP_MAX_RETRIES) {
       LWIP_DEBUGF(TFTP_DEBUG | LWIP_DBG_STATE, ("tftp: timeout, retrying\n"));
-      resend_data(&tftp_state.addr, tftp_state.port);
+      tftp_state.last_pkt = tftp_state.timer;
       tftp_state.retries++;
+      if (tftp_state.last_data != NULL) {
+        resend_data(&tftp_state.addr, tftp_state.port, tftp_state.last_data);
+      } else if (tftp_state.mode_write) {
+        /* server write: ACK the last block again in case the client waits
+           for it. A client get has nothing to acknowledge before DATA 1. */
+        if (tftp_state.server) {
+          send_ack(&tftp_state.addr, tftp_state.port, (u16_t)(tftp_state.blknum - 1));
+          tftp_state.ack_count = 0;
+          tftp_state.gap = 0;
+        }
+      } else {
+        for (i = 0; i < tftp_state.window_len; i++) {
+          resend_data(&tftp_state.addr, tftp_state.port, tftp_state.window[i]);
+        }
+      }
     } else {
       LWIP_DEBUGF(TFTP_DEBUG | LWIP_DBG_STATE, ("tftp: timeout\n"));
       close_handle();
@@ -527,7 +723,7 @@ tftp_get(void* handle, const ip_addr_t *addr, u16_t port, const char* fname, enu
   LWIP_ERROR("tftp_get: invalid mode", mode <= TFTP_MODE_BINARY, return ERR_VAL);
 
   tftp_state.handle = handle;
-  tftp_state.blknum = 1;
+  reset_transfer();
   tftp_state.mode_write = 1; /* We want to receive data */
   return send_request(addr, port, TFTP_RRQ, fname, mode_to_string(mode));
 }
@@ -540,7 +736,7 @@ tftp_put(void* handle, const ip_addr_t *addr, u16_t port, const char* fname, enu
   LWIP_ERROR("tftp_put: invalid mode", mode <= TFTP_MODE_BINARY, return ERR_VAL);
 
   tftp_state.handle = handle;
-  tftp_state.blknum = 1;
+  reset_transfer();
   tftp_state.mode_write = 0; /* We want to send data */
   return send_request(addr, port, TFTP_WRQ, fname, mode_to_string(mode));
 }
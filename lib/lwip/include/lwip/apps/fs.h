@@ -55,6 +55,7 @@ struct fsdata_chksum {
 #define FS_FILE_FLAGS_HEADER_HTTPVER_1_1  0x04
 #define FS_FILE_FLAGS_SSI                 0x08
 #define FS_FILE_FLAGS_CUSTOM              0x10
+#define FS_FILE_FLAGS_GZIP                0x20
 
 /** Define FS_FILE_EXTENSION_T_DEFINED if you have typedef'ed to your private
  * pointer type (defaults to 'void' so the default usage is 'void*')
@@ -87,6 +88,7 @@ typedef void (*fs_wait_cb)(void *arg);
 #endif /* LWIP_HTTPD_FS_ASYNC_READ */
 
 err_t fs_open(struct fs_file *file, const char *name);
+err_t fs_open_fsdata(struct fs_file *file, const char *name);
 void fs_close(struct fs_file *file);
 #if LWIP_HTTPD_DYNAMIC_FILE_READ
 #if LWIP_HTTPD_FS_ASYNC_READ
@@ -130,6 +132,9 @@ int fs_read_async_custom(struct fs_file *file, char *buffer, int count, fs_wait_
 #else /* LWIP_HTTPD_FS_ASYNC_READ */
 int fs_read_custom(struct fs_file *file, char *buffer, int count);
 #endif /* LWIP_HTTPD_FS_ASYNC_READ */
+#if LWIP_HTTPD_CUSTOM_FILES_REQUEST
+void fs_request_custom(const char *hdrs, int hdrs_len);
+#endif /* LWIP_HTTPD_CUSTOM_FILES_REQUEST */
 #endif /* LWIP_HTTPD_CUSTOM_FILES */
 
 #ifdef __cplusplus
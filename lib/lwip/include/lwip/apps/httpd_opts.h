@@ -258,6 +258,20 @@
 #define LWIP_HTTPD_SUPPORT_11_KEEPALIVE     0
 #endif
 
+/** Set this to 1 to answer pipelined requests: requests that arrive while a
+ * response is sent are queued and served in order on the same persistent
+ * connection. Needs LWIP_HTTPD_SUPPORT_11_KEEPALIVE and
+ * LWIP_HTTPD_SUPPORT_REQUESTLIST. */
+#if !defined LWIP_HTTPD_SUPPORT_PIPELINE || defined __DOXYGEN__
+#define LWIP_HTTPD_SUPPORT_PIPELINE         0
+#endif
+
+/** Set this to 1 to send "<uri>.gz" (a file flagged FS_FILE_FLAGS_GZIP, see
+ * makefsdata -gz) instead of "<uri>" to clients that accept gzip encoding */
+#if !defined LWIP_HTTPD_SUPPORT_GZIP || defined __DOXYGEN__
+#define LWIP_HTTPD_SUPPORT_GZIP             0
+#endif
+
 /** Set this to 1 to support HTTP request coming in in multiple packets/pbufs */
 #if !defined LWIP_HTTPD_SUPPORT_REQUESTLIST || defined __DOXYGEN__
 #define LWIP_HTTPD_SUPPORT_REQUESTLIST      1
@@ -360,6 +374,15 @@
 #define LWIP_HTTPD_CUSTOM_FILES       0
 #endif
 
+/** Set this to 1 and provide the function:
+ * - "void fs_request_custom(const char *hdrs, int hdrs_len)"
+ *    Called with the request header lines before the file is opened,
+ *    e.g. to parse a Range header for the following fs_open_custom().
+ */
+#if !defined LWIP_HTTPD_CUSTOM_FILES_REQUEST || defined __DOXYGEN__
+#define LWIP_HTTPD_CUSTOM_FILES_REQUEST 0
+#endif
+
 /** Set this to 1 to support fs_read() to dynamically read file data.
  * Without this (default=off), only one-block files are supported,
  * and the contents must be ready after fs_open().
@@ -92,6 +92,14 @@ struct tftp_context {
    * @param size size of msg
    */
   void (*error)(void* handle, int err, const char* msg, int size);
+  /**
+   * Transfer size option (RFC 2349), may be NULL (server mode only).
+   * @param handle File handle returned by open()
+   * @param size Size announced by the client for a write, -1 for a read
+   * @returns Write: &gt;= 0 to accept the size, &lt; 0 if it doesn't fit;
+   *          read: the file size, &lt; 0 if unknown
+   */
+  int (*tsize)(void* handle, int size);
 };
 
 #define LWIP_TFTP_MODE_SERVER       0x01
@@ -99,6 +99,23 @@
 #define TFTP_MAX_MODE_LEN     10
 #endif
 
+/**
+ * Largest block size granted to a client asking for the blksize option
+ * (RFC 2348), 512 keeps the RFC 1350 block size. Values above 1468 make
+ * the blocks IP fragments on Ethernet.
+ */
+#if !defined TFTP_MAX_BLKSIZE || defined __DOXYGEN__
+#define TFTP_MAX_BLKSIZE      512
+#endif
+
+/**
+ * Largest window granted to a client asking for the windowsize option
+ * (RFC 7440). A read keeps this many blocks for retransmission.
+ */
+#if !defined TFTP_MAX_WINDOWSIZE || defined __DOXYGEN__
+#define TFTP_MAX_WINDOWSIZE   1
+#endif
+
 /**
  * @}
  */
@@ -5,6 +5,7 @@
 #include "mp3dec.h"
 #include "sys.h"
 #include "ff.h"
+#include "diskio.h"
 
 #define MPEG_SN     576
 #define MP3_PART    8192
@@ -50,7 +51,8 @@ int main (void)
        FG_YELLOW "Usage:\n"
        "  'r' change sample rate\n"
        "  'b' change MP3 bitrate\n"
-       "  's' start/stop recording" ATTR_RESET);
+       "  's' start/stop recording\n"
+       "  'f' format memory card" ATTR_RESET);
   sd_init();
   disk_init(0, &sd_read, &sd_write);
   ac.adc.size = MPEG_SN * 256;
@@ -64,7 +66,9 @@ int main (void)
     printf(CLR_LINE "Please insert memory card\r");
     delay(100);
   }
-  printf(CLR_LINE "Card inserted: %uMB\n", sd_card_init() / 2048);
+  c = sd_card_init();
+  disk_geometry(0, c, sd_card_au());
+  printf(CLR_LINE "Card inserted: %uMB (AU %uKB)\n", c / 2048, sd_card_au() / 2);
   printf("SD-disk mount: ");
   if(f_mount(&fs, (TCHAR*)"0:", 1) != FR_OK)
   {
@@ -84,6 +88,18 @@ int main (void)
         if(c == 'r' || c == 'R') if(++sr > 8) sr = 0;
         if(c == 'b' || c == 'B') if(++br > 15) br = 0;
         if(!mp3br[sr][br]) br = 1;
+        if(c == 'f' || c == 'F')
+        {
+          printf(CLR_LINE "Format memory card? (y/n)\r");
+          if(getchar() == 'y')
+          {
+            void *work = malloc(32768);
+            f_unmount((TCHAR*)"0:");
+            printf(CLR_LINE "Format: %s\n", disk_mkfs(0, work, 32768) == FR_OK &&
+              f_mount(&fs, (TCHAR*)"0:", 1) == FR_OK ? "OK" : "error");
+            free(work);
+          }
+        }
       } while(c != 's' && c != 'S');
       ac_enable(mp3sr[sr], 1);
       if(f_open(&fil, "record.mp3", FA_CREATE_ALWAYS | FA_WRITE) == FR_OK)
@@ -0,0 +1,137 @@
+#include <stdio.h>
+#include <string.h>
+#include "sys.h"
+#include "bench.h"
+#include "diskio.h"
+
+enum { RAW_RD, RAW_WR, FS_RD, FS_WR };
+
+static const char *mode_str[] = { "raw read", "raw write", "fs read", "fs write" };
+
+static struct BENCH *bench;
+static FIL fil;
+static u32 lba, seed;
+
+static u32 rnd (u32 n)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 8) % n;
+}
+
+static void hist_add (struct BENCH_HIST *h, u32 us)
+{
+  u32 i;
+  for(i = 0; i < BENCH_BINS - 1 && us >= (2U << i); i++);
+  h->bin[i]++;
+  if(!h->num || us < h->min) h->min = us;
+  if(us > h->max) h->max = us;
+  h->sum += us;
+  h->num++;
+}
+
+static void hist_print (const char *str, struct BENCH_HIST *h)
+{
+  u32 i;
+  printf("%s latency: min %uus avg %uus max %uus\n", str, h->min,
+    h->num ? h->sum / h->num : 0, h->max);
+  for(i = 0; i < BENCH_BINS; i++)
+  {
+    if(!h->bin[i]) continue;
+    if(i == BENCH_BINS - 1) printf("  >=%6uus", 1U << i);
+    else printf("  <%7uus", 2U << i);
+    printf(" %5u %3u%%\n", h->bin[i], h->bin[i] * 100 / h->num);
+  }
+}
+
+static int xfer (int mode, u32 ofs, u32 blks)
+{
+  UINT res;
+  switch(mode)
+  {
+    case RAW_RD: return bench->rd(bench->buf, lba + ofs, blks) == (int)blks ? OK : KO;
+    case RAW_WR: return bench->wr(bench->buf, lba + ofs, blks) == (int)blks ? OK : KO;
+    case FS_RD:
+      if(f_lseek(&fil, (FSIZE_t)ofs * 512) != FR_OK) return KO;
+      return f_read(&fil, bench->buf, blks * 512, &res) == FR_OK && res == blks * 512 ? OK : KO;
+    default:
+      if(f_lseek(&fil, (FSIZE_t)ofs * 512) != FR_OK) return KO;
+      return f_write(&fil, bench->buf, blks * 512, &res) == FR_OK && res == blks * 512 ? OK : KO;
+  }
+}
+
+/* Runs num transfers of blks blocks, sequential or at random aligned
+   offsets inside the test file, returns the total time in us */
+static u32 pass (int mode, u32 blks, u32 num, int random, struct BENCH_HIST *h)
+{
+  u32 i, ofs, t, t0, t1;
+  if(mode == FS_WR && f_sync(&fil) != FR_OK) return 0;
+  t0 = t = bench->us();
+  for(i = 0, ofs = 0; i < num; i++)
+  {
+    if(random) ofs = rnd(BENCH_SIZE / 512 / blks) * blks;
+    if(xfer(mode, ofs, blks) != OK) return 0;
+    ofs = (ofs + blks) % (BENCH_SIZE / 512);
+    t1 = bench->us();
+    if(h) hist_add(h, t1 - t);
+    t = t1;
+  }
+  if(mode == FS_WR && f_sync(&fil) != FR_OK) return 0;
+  if(mode == RAW_WR && disk_ioctl(0, CTRL_SYNC, NULL) != RES_OK) return 0;  // write-back drivers
+  t = bench->us() - t0;
+  return t ? t : 1;
+}
+
+static void print_mbs (u32 bytes, u32 us)
+{
+  if(!us) printf("   error");
+  else printf(" %4u.%02u", bytes / us, bytes % us * 100 / us);
+}
+
+int bench_run (struct BENCH *b, const TCHAR *path)
+{
+  static const int seq[4] = { RAW_WR, RAW_RD, FS_WR, FS_RD };
+  static struct BENCH_HIST h[4];
+  FATFS *fs;
+  u32 i, blks, t[4];
+  bench = b;
+  seed = 1;
+  memset(b->buf, 0xA5, BENCH_BLKS * 512);
+  if(f_open(&fil, path, FA_CREATE_ALWAYS | FA_READ | FA_WRITE) != FR_OK) return KO;
+  if(f_expand(&fil, BENCH_SIZE, 1) != FR_OK)
+  {
+    puts("No contiguous free space for the test file");
+    f_close(&fil);
+    f_unlink(path);
+    return KO;
+  }
+  fs = fil.obj.fs;
+  lba = fs->database + (fil.obj.sclust - 2) * fs->csize;
+  printf("Test file: %uMB at sector %u, cluster %uKB\n", BENCH_SIZE >> 20, lba, fs->csize / 2);
+  puts("Sequential, MB/s and raw latency avg/max us:\n"
+       "  Blocks  raw wr  raw rd   fs wr   fs rd     raw wr latency     raw rd latency");
+  for(blks = 1; blks <= BENCH_BLKS; blks *= 2)
+  {
+    memset(h, 0, sizeof(h));
+    printf("  %6u", blks);
+    for(i = 0; i < 4; i++)
+    {
+      t[i] = pass(seq[i], blks, BENCH_PASS / 512 / blks, 0, &h[i]);
+      print_mbs(BENCH_PASS, t[i]);
+    }
+    printf("  %7u/%7u  %7u/%7u\n", h[0].num ? h[0].sum / h[0].num : 0, h[0].max,
+      h[1].num ? h[1].sum / h[1].num : 0, h[1].max);
+  }
+  puts("Random 4K:");
+  memset(h, 0, sizeof(h));
+  for(i = 0; i < 4; i++)
+  {
+    t[i] = pass(seq[i], 8, BENCH_RAND, 1, &h[i]);
+    printf("  %-9s %5u IOPS", mode_str[seq[i]], t[i] ? (u32)((uint64_t)BENCH_RAND * 1000000 / t[i]) : 0);
+    print_mbs(BENCH_RAND * 4096, t[i]);
+    printf("MB/s\n");
+  }
+  for(i = 0; i < 4; i++) hist_print(mode_str[seq[i]], &h[i]);
+  f_close(&fil);
+  f_unlink(path);
+  return OK;
+}
@@ -0,0 +1,29 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "ff.h"
+
+#define BENCH_SIZE  (8 << 20)   // test file, the raw passes use its sectors
+#define BENCH_PASS  (1 << 20)   // bytes per sequential pass
+#define BENCH_BLKS  128         // largest transfer, blocks
+#define BENCH_RAND  256         // random 4K commands per pass
+#define BENCH_BINS  16          // latency buckets: <2us, <4us ... >=32mS
+
+struct BENCH_HIST {
+  u32 num;
+  u32 min;
+  u32 max;
+  u32 sum;
+  u32 bin[BENCH_BINS];
+};
+
+struct BENCH {
+  int (*rd) (void *ptr, u32 addr, u32 cnt);   // the drive registered with disk_init, returns blocks moved
+  int (*wr) (void *ptr, u32 addr, u32 cnt);
+  u32 (*us) (void);                           // free-running microsecond clock
+  u8  *buf;                                   // BENCH_BLKS * 512 bytes, cache line aligned
+};
+
+int bench_run (struct BENCH *b, const TCHAR *path);
+
+#endif
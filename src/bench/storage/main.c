@@ -0,0 +1,88 @@
+#include <stdio.h>
+#include <string.h>
+#include <malloc.h>
+#include "sys.h"
+#include "mmu.h"
+#include "ff.h"
+#include "usbh_msc.h"
+#include "bench.h"
+
+void __attribute__((interrupt("IRQ"))) irq_handler (void)
+{
+  usbh_isr();
+}
+
+static u32 bench_us (void)
+{
+  return ctr_ms;                      // AVS1 is switched to 1uS below
+}
+
+static void bench_disk (struct BENCH *b)
+{
+  FATFS fs;
+  printf("Mount: ");
+  if(f_mount(&fs, (TCHAR*)"0:", 1) != FR_OK) puts("not support or error");
+  else
+  {
+    printf("%s\n", fs.fs_type == 2 ? "FAT16" : fs.fs_type == 3 ? "FAT32" : "exFAT");
+    if(bench_run(b, (TCHAR*)"0:/bench.bin") != OK) puts("Benchmark error");
+    f_mount(NULL, (TCHAR*)"0:", 0);
+  }
+}
+
+int main (void)
+{
+  struct BENCH b = { .us = &bench_us, .buf = memalign(CACHE_LINE_SIZE, BENCH_BLKS * 512) };
+  int c;
+  u32 t;
+  puts("\033[36mF1C100S - Storage benchmark\033[0m\n"
+       "Usage:\n"
+       "  's' microSD card\n"
+       "  'u' USB disk\n"
+       "  'p' USB disk, bulk transfers by PIO only");
+  TIM->AVS_DIV = (11 << 16) | 11;     // AVS1:1uS, ctr_ms is not used by the drivers
+  while(1)
+  {
+    c = getchar();
+    if(c == 's' || c == 'S')
+    {
+      sd_init();
+      if(!sd_card_detect() || !sd_card_init()) puts("No memory card");
+      else
+      {
+        printf("SD card: %uKB AU\n", sd_card_au() / 2);
+        disk_init(0, b.rd = &sd_read, b.wr = &sd_write);
+        bench_disk(&b);
+        printf("Driver: %u blocks read, %u written, %u bytes bounced\n",
+          sd_stat.rd_blks, sd_stat.wr_blks, sd_stat.bounce);
+      }
+    }
+    if(c == 'u' || c == 'U' || c == 'p' || c == 'P')
+    {
+      usbh_msc_dma(c == 'u' || c == 'U');
+      memset(&msc_stat, 0, sizeof(msc_stat));
+      memset(&usbh_stat, 0, sizeof(usbh_stat));
+      usb_mux(USB_MUX_HOST);
+      usbh_init();
+      usbh_irq(1);
+      for(ctr_ms = 0; dev_usb != 1 && ctr_ms < 3000000; ) usbh_handler();
+      if(dev_usb != 1) puts("No USB disk");
+      else
+      {
+        disk_init(0, b.rd = &usbh_msc_read, b.wr = &usbh_msc_write);
+        disk_sync(0, &usbh_msc_sync);
+        t = ctr_ms;
+        bench_disk(&b);
+        t = ctr_ms - t;
+        printf("Driver: %u bytes by DMA, %u by PIO\n", usbh_stat.dma, usbh_stat.pio);
+        printf("USB: %u URBs, %u interrupts, %u NAK limits, CPU idle %u%% of %ums\n",
+          usbh_stat.urbs, usbh_stat.irqs, usbh_stat.naks,
+          t ? (u32)((uint64_t)usbh_stat.wait * 100 / t) : 0, t / 1000);
+        printf("SCSI: %u commands, %u payload bytes per command, %u blocks read ahead, %u combined\n",
+          msc_stat.cmds, msc_stat.cmds ? msc_stat.data / msc_stat.cmds : 0, msc_stat.ra, msc_stat.wc);
+      }
+      usbh_irq(0);
+      dev_usb = 255;
+    }
+  }
+}
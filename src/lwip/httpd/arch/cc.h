@@ -118,6 +118,12 @@ typedef u32_t          mem_ptr_t;
 
 #define PACK_STRUCT_FIELD(x) x
 
+// ARMv5 assembly internet checksum, arch/chksum.c
+#ifdef ARM
+unsigned short lwip_standard_chksum(const void *dataptr, int len);
+#define LWIP_CHKSUM lwip_standard_chksum
+#endif
+
 // Platform specific diagnostic output
 #include <stdio.h>
 
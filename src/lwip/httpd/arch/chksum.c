@@ -0,0 +1,78 @@
+#include "lwip/arch.h"
+
+/* Internet checksum for ARMv5: 32 bytes per LDM summed with carries into a
+   32-bit accumulator, folded to 16 bits at the end. An odd start is summed
+   shifted by a byte and swapped back, as LWIP_CHKSUM_ALGORITHM 2 does.
+   Returns the non-inverted sum in host order */
+u16_t __attribute__((naked)) lwip_standard_chksum (const void *dataptr, int len)
+{
+  __asm__ __volatile__ (
+    "push   {r4-r10}\n"
+    "mov    r2, #0\n"                 // sum
+    "and    r12, r0, #1\n"            // odd start
+    "cmp    r1, #0\n"
+    "ble    5f\n"
+    "cmp    r12, #0\n"
+    "beq    6f\n"
+    "ldrb   r2, [r0], #1\n"
+    "mov    r2, r2, lsl #8\n"         // high byte of its halfword
+    "sub    r1, r1, #1\n"
+    "6:\n"
+    "tst    r0, #2\n"                 // align to a word
+    "beq    1f\n"
+    "cmp    r1, #2\n"
+    "blt    3f\n"
+    "ldrh   r3, [r0], #2\n"
+    "add    r2, r2, r3\n"
+    "sub    r1, r1, #2\n"
+    "1:\n"
+    "subs   r1, r1, #32\n"
+    "blt    2f\n"
+    "0:\n"
+    "ldmia  r0!, {r3-r10}\n"
+    "adds   r2, r2, r3\n"
+    "adcs   r2, r2, r4\n"
+    "adcs   r2, r2, r5\n"
+    "adcs   r2, r2, r6\n"
+    "adcs   r2, r2, r7\n"
+    "adcs   r2, r2, r8\n"
+    "adcs   r2, r2, r9\n"
+    "adcs   r2, r2, r10\n"
+    "adc    r2, r2, #0\n"
+    "subs   r1, r1, #32\n"
+    "bge    0b\n"
+    "2:\n"
+    "adds   r1, r1, #28\n"            // words left
+    "blt    3f\n"
+    "4:\n"
+    "ldr    r3, [r0], #4\n"
+    "adds   r2, r2, r3\n"
+    "adc    r2, r2, #0\n"
+    "subs   r1, r1, #4\n"
+    "bge    4b\n"
+    "3:\n"
+    "ands   r1, r1, #3\n"             // 0..3 bytes left
+    "beq    5f\n"
+    "cmp    r1, #2\n"
+    "blt    7f\n"
+    "ldrh   r3, [r0], #2\n"
+    "adds   r2, r2, r3\n"
+    "adc    r2, r2, #0\n"
+    "subs   r1, r1, #2\n"
+    "beq    5f\n"
+    "7:\n"
+    "ldrb   r3, [r0]\n"               // low byte of its halfword
+    "adds   r2, r2, r3\n"
+    "adc    r2, r2, #0\n"
+    "5:\n"
+    "adds   r2, r2, r2, lsl #16\n"    // fold: high half = high + low
+    "addcs  r2, r2, #0x10000\n"
+    "mov    r0, r2, lsr #16\n"
+    "cmp    r12, #0\n"
+    "andne  r3, r0, #0xFF\n"          // odd start: swap the bytes back
+    "movne  r0, r0, lsr #8\n"
+    "orrne  r0, r0, r3, lsl #8\n"
+    "pop    {r4-r10}\n"
+    "bx     lr\n"
+    );
+}
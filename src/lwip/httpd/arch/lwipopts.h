@@ -116,6 +116,20 @@
 
 #define LWIP_DBG_TYPES_ON         (LWIP_DBG_ON|LWIP_DBG_TRACE|LWIP_DBG_STATE|LWIP_DBG_FRESH|LWIP_DBG_HALT)
 
+/* ---------- Profile ---------- */
+/* LWIP_THROUGHPUT 0: the small footprint profile, 1: TCP windows and pools
+   sized for iperf at the wire speed of the RTL8152B. The throughput
+   profile costs about 72K more static memory:
+     PBUF_POOL    64 x 1536 instead of 120 x 256 bytes    +67K
+     TCP segments 160 instead of 16                       + 4K
+     pbufs        64 instead of 16                        + 1K
+   and a connection sending at full rate takes up to 46K of the 256K heap
+   (MEM_SIZE, the same in both) instead of 6K. The USB net buffers (RX
+   8 x 16K, TX 3 x 16K) do not depend on it. */
+#ifndef LWIP_THROUGHPUT
+#define LWIP_THROUGHPUT            0
+#endif
+
 /* ---------- Memory options ---------- */
 /* MEM_ALIGNMENT: should be set to the alignment of the CPU for which
    lwIP is compiled. 4 byte alignment -> define MEM_ALIGNMENT to 4, 2
@@ -131,7 +145,11 @@ a lot of data that needs to be copied, this should be set high. */
 /* MEMP_NUM_PBUF: the number of memp struct pbufs. If the application
    sends a lot of data out of ROM (or other static memory), this
    should be set high. */
+#if LWIP_THROUGHPUT
+#define MEMP_NUM_PBUF           64
+#else
 #define MEMP_NUM_PBUF           16
+#endif
 /* MEMP_NUM_RAW_PCB: the number of UDP protocol control blocks. One
    per active RAW "connection". */
 #define MEMP_NUM_RAW_PCB        4
@@ -146,7 +164,11 @@ a lot of data that needs to be copied, this should be set high. */
 #define MEMP_NUM_TCP_PCB_LISTEN 8
 /* MEMP_NUM_TCP_SEG: the number of simultaneously queued TCP
    segments. */
+#if LWIP_THROUGHPUT
+#define MEMP_NUM_TCP_SEG        (TCP_SND_QUEUELEN + TCP_OOSEQ_MAX_PBUFS)
+#else
 #define MEMP_NUM_TCP_SEG        16
+#endif
 /* MEMP_NUM_SYS_TIMEOUT: the number of simulateously active
    timeouts. */
 #define MEMP_NUM_SYS_TIMEOUT    16
@@ -165,11 +187,16 @@ a lot of data that needs to be copied, this should be set high. */
 
 
 /* ---------- Pbuf options ---------- */
-/* PBUF_POOL_SIZE: the number of buffers in the pbuf pool. */
+/* PBUF_POOL_SIZE: the number of buffers in the pbuf pool.
+   PBUF_POOL_BUFSIZE: the size of each pbuf in the pbuf pool, a whole
+   frame in the throughput profile. */
+#if LWIP_THROUGHPUT
+#define PBUF_POOL_SIZE          64
+#define PBUF_POOL_BUFSIZE       1536
+#else
 #define PBUF_POOL_SIZE          120
-
-/* PBUF_POOL_BUFSIZE: the size of each pbuf in the pbuf pool. */
 #define PBUF_POOL_BUFSIZE       256
+#endif
 
 /** SYS_LIGHTWEIGHT_PROT
  * define SYS_LIGHTWEIGHT_PROT in lwipopts.h if you want inter-task protection
@@ -193,11 +220,23 @@ a lot of data that needs to be copied, this should be set high. */
    order. Define to 0 if your device is low on memory. */
 #define TCP_QUEUE_OOSEQ         1
 
+/* Out of order segments kept per connection, SACK tells the peer which
+   ones arrived. */
+#if LWIP_THROUGHPUT
+#define TCP_OOSEQ_MAX_PBUFS     32
+#define LWIP_TCP_SACK_OUT       1
+#define LWIP_TCP_MAX_SACK_NUM   4
+#endif
+
 /* TCP Maximum segment size. */
 #define TCP_MSS                 1460
 
 /* TCP sender buffer space (bytes). */
+#if LWIP_THROUGHPUT
+#define TCP_SND_BUF             (32 * TCP_MSS)
+#else
 #define TCP_SND_BUF             (4 * TCP_MSS)
+#endif
 
 /* TCP sender buffer space (pbufs). This must be at least = 2 *
    TCP_SND_BUF/TCP_MSS for things to work. */
@@ -208,8 +247,15 @@ a lot of data that needs to be copied, this should be set high. */
    available in the tcp snd_buf for select to return writable */
 #define TCP_SNDLOWAT           (TCP_SND_BUF/2)
 
-/* TCP receive window. */
+/* TCP receive window. Past 64K it needs window scaling, 2 ^ TCP_RCV_SCALE
+   bytes per unit. */
+#if LWIP_THROUGHPUT
+#define LWIP_WND_SCALE          1
+#define TCP_RCV_SCALE           2
+#define TCP_WND                 (48 * TCP_MSS)
+#else
 #define TCP_WND                 (16 * TCP_MSS)
+#endif
 
 /* Maximum number of retransmissions of data segments. */
 #define TCP_MAXRTX              12
@@ -238,6 +284,10 @@ a lot of data that needs to be copied, this should be set high. */
 #define IP_FRAG                 1
 #define IPV6_FRAG_COPYHEADER    1
 
+/* ---------- Checksum options ---------- */
+/* The netif driver turns off what the Ethernet controller computes */
+#define LWIP_CHECKSUM_CTRL_PER_NETIF 1
+
 /* ---------- ICMP options ---------- */
 #define ICMP_TTL                255
 
@@ -269,6 +319,36 @@ a lot of data that needs to be copied, this should be set high. */
 #define LWIP_RAW                0
 
 
+/* ---------- HTTPD options ---------- */
+/* Files on the SD card (fs_fat.c) are served before the built-in fsdata,
+   read in chunks as large as the TCP send buffer allows */
+#define LWIP_HTTPD_CUSTOM_FILES         1
+#define LWIP_HTTPD_CUSTOM_FILES_REQUEST 1
+#define LWIP_HTTPD_DYNAMIC_FILE_READ    1
+#define LWIP_HTTPD_FILE_EXTENSION       1
+#define HTTPD_LIMIT_SENDING_TO_2MSS     0
+
+/* Persistent connections with pipelining. fsdata is built with HTTP/1.1
+   headers and gzip variants (makefsdata -11 -gz), sent to clients that
+   accept gzip */
+#define LWIP_HTTPD_SUPPORT_11_KEEPALIVE 1
+#define LWIP_HTTPD_SUPPORT_PIPELINE     1
+#define LWIP_HTTPD_SUPPORT_GZIP         1
+
+/* POST /upload/x writes 0:/x, the window is opened as the data reaches the
+   card */
+#define LWIP_HTTPD_SUPPORT_POST         1
+#define LWIP_HTTPD_POST_MANUAL_WND      1
+
+
+/* ---------- TFTP options ---------- */
+/* Blocks up to a full Ethernet frame, 16 of them in flight per ACK */
+#define TFTP_MAX_BLKSIZE        1468
+#define TFTP_MAX_WINDOWSIZE     16
+#define TFTP_MAX_FILENAME_LEN   64
+#define TFTP_TIMEOUT_MSECS      1000
+
+
 /* ---------- Statistics options ---------- */
 
 #define LWIP_STATS              0
@@ -0,0 +1,416 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ff.h"
+#include "clmt.h"
+#include "lwip/init.h"
+#include "lwip/def.h"
+#include "lwip/apps/fs.h"
+#include "lwip/apps/httpd.h"
+#include "mmu.h"
+#include "fs_fat.h"
+
+/* httpd files on the SD card: URI "/x" is served from FAT_ROOT "/x" ahead of
+   the built-in fsdata. Files stay open between requests with a cluster link
+   map, so repeated and Range requests skip the directory lookup and the FAT
+   chain walk. Reads end on a sector boundary, so every chunk after the first
+   goes from the card straight into the httpd buffer.
+   POST FAT_UPLOAD "/x" writes the request body to "0:/x~", which replaces
+   "0:/x" once the body is complete: a refused or broken upload leaves the
+   old file as it was */
+
+#define FAT_ROOT    "0:/www"
+#define FAT_FILES   4       // cached handles, one per concurrent download
+#define FAT_HDR     256     // response header
+#define FAT_MAXLEN  0x7FFFFF00
+#define FAT_UPLOAD  "/upload"   // POST prefix, also the name of its response
+#define UPL_CHUNK   (16 * 1024) // written to the card once buffered
+#define UPL_BUF     ((TCP_WND + 1023) & ~511)
+
+struct FAT_FILE {
+  FIL fil;
+  char name[LWIP_HTTPD_MAX_REQUEST_URI_LEN + 1];
+  char hdr[FAT_HDR];
+  int hdr_len;
+  int open;                 // in use by a connection
+  u32_t tick;
+};
+
+static struct FAT_FILE fat_file[FAT_FILES];
+static u32_t fat_tick;
+static long rng_lo, rng_hi; // Range of the pending request, -1 if omitted
+static int rng;
+
+static struct {
+  FIL fil;
+  char path[sizeof(FAT_ROOT) + LWIP_HTTPD_MAX_REQUEST_URI_LEN];
+  char tmp[sizeof(FAT_ROOT) + LWIP_HTTPD_MAX_REQUEST_URI_LEN + 1];  // path "~"
+  void *conn;               // connection being received, 0 if idle
+  u32_t left;               // body bytes still expected
+  u32_t unacked;            // received, TCP window not opened yet
+  UINT fill;
+  int status;               // 0 while receiving, then the HTTP status
+  char reply[FAT_HDR];
+  int reply_len;
+  int reply_due;            // the next open of FAT_UPLOAD is the POST response
+  u8_t buf[UPL_BUF] __attribute__((aligned(CACHE_LINE_SIZE)));
+} upl;
+
+static const char *const fat_type[][2] = {
+  { "html", "text/html" },
+  { "htm",  "text/html" },
+  { "css",  "text/css" },
+  { "js",   "application/javascript" },
+  { "json", "application/json" },
+  { "txt",  "text/plain" },
+  { "png",  "image/png" },
+  { "jpg",  "image/jpeg" },
+  { "jpeg", "image/jpeg" },
+  { "gif",  "image/gif" },
+  { "ico",  "image/x-icon" },
+  { "svg",  "image/svg+xml" },
+  { "mp3",  "audio/mpeg" },
+  { "mp4",  "video/mp4" },
+  { "pdf",  "application/pdf" },
+};
+
+static const char *fat_mime (const char *name)
+{
+  const char *ext = strrchr(name, '.');
+  unsigned int i;
+  for(i = 0; ext && i < LWIP_ARRAYSIZE(fat_type); i++)
+  {
+    if(!lwip_stricmp(ext + 1, fat_type[i][0])) return fat_type[i][1];
+  }
+  return "application/octet-stream";
+}
+
+static int fat_hex (int c)
+{
+  if(c >= '0' && c <= '9') return c - '0';
+  c |= 0x20;
+  return c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+}
+
+/* root + URI with %xx escapes decoded, 0 for paths leaving the root */
+static int fat_path (char *path, const char *root, const char *uri)
+{
+  char *p = path + strlen(strcpy(path, root));
+  int h, l;
+  for(; *uri; p++)
+  {
+    if(*uri == '%' && (h = fat_hex(uri[1])) >= 0 && (l = fat_hex(uri[2])) >= 0 &&
+      (h | l))
+    {
+      *p = h << 4 | l;
+      uri += 3;
+    }
+    else *p = *uri++;
+  }
+  *p = 0;
+  return !strstr(path, "..");
+}
+
+static long fat_num (const char *p, char **e)
+{
+  unsigned long v;
+  if(*p < '0' || *p > '9')
+  {
+    *e = (char*)p;
+    return -1;
+  }
+  v = strtoul(p, e, 10);
+  return v > FAT_MAXLEN ? FAT_MAXLEN : (long)v;
+}
+
+/* Single "bytes=lo-hi", "bytes=lo-" or "bytes=-n" ranges, anything else
+   gets the whole file */
+void fs_request_custom (const char *hdrs, int hdrs_len)
+{
+  const char *p = lwip_strnistr(hdrs, "\r\nRange: bytes=", hdrs_len);
+  char *e;
+  rng = 0;
+  if(!p) return;
+  rng_lo = fat_num(p + 15, &e);
+  if(*e != '-') return;
+  rng_hi = fat_num(e + 1, &e);
+  if(*e != '\r' || (rng_lo < 0 && rng_hi < 0)) return;
+  rng = 1;
+}
+
+int fs_open_custom (struct fs_file *file, const char *name)
+{
+  struct FAT_FILE *f = 0;
+  char path[sizeof(FAT_ROOT) + LWIP_HTTPD_MAX_REQUEST_URI_LEN];
+  FILINFO fno;
+  long size, lo, hi;
+  int i;
+  if(upl.reply_due && !strcmp(name, FAT_UPLOAD))
+  {
+    upl.reply_due = 0;
+    file->data = upl.reply;
+    file->len = upl.reply_len;
+    file->index = file->len;
+    file->pextension = NULL;
+    file->flags = FS_FILE_FLAGS_HEADER_INCLUDED;
+    return 1;
+  }
+  if(strlen(name) >= sizeof(f->name)) return 0;
+  for(i = 0; i < FAT_FILES; i++)    // cached idle handle, else the LRU one
+  {
+    if(fat_file[i].open) continue;
+    if(!strcmp(fat_file[i].name, name))
+    {
+      f = &fat_file[i];
+      break;
+    }
+    if(!f || fat_file[i].tick < f->tick) f = &fat_file[i];
+  }
+  if(!f) return 0;
+  if(strcmp(f->name, name))
+  {
+    if(!fat_path(path, FAT_ROOT, name) || f_stat(path, &fno) != FR_OK || (fno.fattrib & AM_DIR) ||
+      fno.fsize > FAT_MAXLEN - FAT_HDR) return 0;
+    if(f->name[0]) clmt_close(&f->fil);
+    f->name[0] = 0;
+    if(clmt_open(&f->fil, path, FA_READ) != FR_OK) return 0;
+    strcpy(f->name, name);
+  }
+  size = (long)f_size(&f->fil);
+  lo = 0;
+  hi = size - 1;
+  if(rng)
+  {
+    if(rng_lo < 0) lo = rng_hi < size ? size - rng_hi : 0;
+    else
+    {
+      lo = rng_lo;
+      if(rng_hi >= 0 && rng_hi < hi) hi = rng_hi;
+    }
+  }
+  if(rng && lo > hi)
+  {
+    f->hdr_len = snprintf(f->hdr, FAT_HDR, "HTTP/1.1 416 Range Not Satisfiable\r\n"
+      "Server: " HTTPD_SERVER_AGENT "\r\nContent-Range: bytes */%ld\r\n"
+      "Content-Length: 0\r\n\r\n", size);
+    lo = hi + 1;
+  }
+  else
+  {
+    if(f_lseek(&f->fil, lo) != FR_OK) return 0;
+    if(rng) f->hdr_len = snprintf(f->hdr, FAT_HDR, "HTTP/1.1 206 Partial Content\r\n"
+      "Server: " HTTPD_SERVER_AGENT "\r\nContent-Range: bytes %ld-%ld/%ld\r\n"
+      "Content-Length: %ld\r\nContent-Type: %s\r\n\r\n",
+      lo, hi, size, hi + 1 - lo, fat_mime(name));
+    else f->hdr_len = snprintf(f->hdr, FAT_HDR, "HTTP/1.1 200 OK\r\n"
+      "Server: " HTTPD_SERVER_AGENT "\r\nAccept-Ranges: bytes\r\n"
+      "Content-Length: %ld\r\nContent-Type: %s\r\n\r\n", size, fat_mime(name));
+  }
+  if(f->hdr_len >= FAT_HDR) return 0;
+  rng = 0;
+  f->open = 1;
+  f->tick = ++fat_tick;
+  file->data = NULL;
+  file->len = f->hdr_len + (int)(hi + 1 - lo);
+  file->index = 0;
+  file->pextension = f;
+  file->flags = FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT;
+  return 1;
+}
+
+void fs_close_custom (struct fs_file *file)
+{
+  struct FAT_FILE *f = file->pextension;
+  if(f) f->open = 0;
+}
+
+int fs_read_custom (struct fs_file *file, char *buffer, int count)
+{
+  struct FAT_FILE *f = file->pextension;
+  UINT n = 0, br = 0, tail;
+  if(file->index < f->hdr_len)
+  {
+    n = LWIP_MIN(count, f->hdr_len - file->index);
+    memcpy(buffer, f->hdr + file->index, n);
+  }
+  count = LWIP_MIN(count, file->len - file->index) - n;
+  tail = (UINT)(f_tell(&f->fil) + count) & 511;
+  if(count > (int)tail && file->index + (int)n + count < file->len)
+    count -= tail;          // end on a sector, the next read starts aligned
+  if(count > 0 && f_read(&f->fil, buffer + n, count, &br) != FR_OK) return FS_READ_EOF;
+  n += br;
+  file->index += n;
+  return n ? (int)n : FS_READ_EOF;
+}
+
+static const char *upl_reason (int status)
+{
+  switch(status)
+  {
+    case 201: return "Created";
+    case 404: return "Not Found";
+    case 409: return "Conflict";
+    case 507: return "Insufficient Storage";
+  }
+  return "Internal Server Error";
+}
+
+static void upl_reply (int status)
+{
+  upl.reply_len = snprintf(upl.reply, FAT_HDR, "HTTP/1.1 %d %s\r\n"
+    "Server: " HTTPD_SERVER_AGENT "\r\nContent-Length: 0\r\n\r\n",
+    status, upl_reason(status));
+}
+
+/* Before path is rewritten: cached handles are dropped, 0 if the file is
+   being sent */
+static int fat_drop (const char *path)
+{
+  char name[sizeof(upl.path)];
+  int i;
+  for(i = 0; i < FAT_FILES; i++)
+  {
+    if(!fat_file[i].name[0]) continue;
+    if(fat_file[i].open)
+    {
+      fat_path(name, FAT_ROOT, fat_file[i].name);
+      if(!lwip_stricmp(name, path)) return 0;
+    }
+    else
+    {
+      clmt_close(&fat_file[i].fil);
+      fat_file[i].name[0] = 0;
+    }
+  }
+  return 1;
+}
+
+/* Closes the file: a complete upload replaces the old file unless that is
+   being sent, a failed one is removed */
+static void upl_end (int status)
+{
+  FRESULT res;
+  if(f_close(&upl.fil) != FR_OK && status == 201) status = 500;
+  if(status == 201 && !fat_drop(upl.path)) status = 409;
+  if(status == 201)
+  {
+    res = f_unlink(upl.path);
+    if((res != FR_OK && res != FR_NO_FILE) || f_rename(upl.tmp, upl.path) != FR_OK) status = 500;
+  }
+  if(status != 201) f_unlink(upl.tmp);
+  clmt_flush();             // a replaced file may be mapped from its old clusters
+  upl.status = status;
+  upl.fill = 0;
+  upl_reply(status);
+}
+
+static int upl_write (int all)
+{
+  UINT n = all ? upl.fill : upl.fill & ~511, bw = 0;
+  if(n && f_write(&upl.fil, upl.buf, n, &bw) != FR_OK) return 500;
+  if(bw != n) return 507;
+  memmove(upl.buf, upl.buf + n, upl.fill - n);
+  upl.fill -= n;
+  return 0;
+}
+
+/* Opens the TCP window for n received bytes */
+static void upl_ack (void *conn, u32_t n)
+{
+  u16_t len;
+  upl.unacked -= n;
+  for(; n; n -= len)
+  {
+    len = (u16_t)LWIP_MIN(n, 0xFFFF);
+    httpd_post_data_recved(conn, len);
+  }
+}
+
+/* The same, 0 also if the file is being uploaded */
+int fat_release (const char *path)
+{
+  if(upl.conn && (!lwip_stricmp(path, upl.path) || !lwip_stricmp(path, upl.tmp))) return 0;
+  return fat_drop(path);
+}
+
+/* The body has to fit next to the old file, which stays until it is in */
+static int upl_fits (u32_t len)
+{
+  DWORD nclst, csz;
+  FATFS *fs;
+  if(f_getfree("0:", &nclst, &fs) != FR_OK) return 0;
+  csz = (DWORD)fs->csize * FF_MAX_SS;
+  return (QWORD)nclst >= ((QWORD)len + csz - 1) / csz;
+}
+
+err_t httpd_post_begin (void *connection, const char *uri, const char *http_request,
+  u16_t http_request_len, int content_len, char *response_uri,
+  u16_t response_uri_len, u8_t *post_auto_wnd)
+{
+  FRESULT res;
+  int status = 409;
+  LWIP_UNUSED_ARG(http_request);
+  LWIP_UNUSED_ARG(http_request_len);
+  snprintf(response_uri, response_uri_len, FAT_UPLOAD);
+  if(strncmp(uri, FAT_UPLOAD "/", sizeof(FAT_UPLOAD)) ||
+    !fat_path(upl.path, "0:", uri + sizeof(FAT_UPLOAD) - 1)) status = 404;
+  else if(!upl.conn && fat_release(upl.path))
+  {
+    strcat(strcpy(upl.tmp, upl.path), "~");
+    if(!upl_fits(content_len)) res = FR_DENIED, status = 507;
+    else if((res = f_open(&upl.fil, upl.tmp, FA_CREATE_ALWAYS | FA_WRITE)) == FR_OK && content_len)
+    {                       // contiguous if possible, else the clusters come as written
+      if((res = f_expand(&upl.fil, content_len, 1)) == FR_DENIED) res = FR_OK;
+      else if(res != FR_OK)
+      {
+        f_close(&upl.fil);
+        f_unlink(upl.tmp);
+      }
+    }
+    if(res == FR_OK)
+    {
+      upl.conn = connection;
+      upl.left = content_len;
+      upl.unacked = 0;
+      upl.fill = 0;
+      upl.status = 0;
+      *post_auto_wnd = 0;
+      return ERR_OK;
+    }
+    if(status != 507) status = res == FR_NO_PATH || res == FR_INVALID_NAME ? 404 :
+      res == FR_DENIED || res == FR_EXIST ? 409 : 500;
+  }
+  upl_reply(status);
+  upl.reply_due = 1;
+  return ERR_VAL;
+}
+
+err_t httpd_post_receive_data (void *connection, struct pbuf *p)
+{
+  u16_t off = 0, n;
+  upl.unacked += p->tot_len;
+  while(!upl.status && upl.left && off < p->tot_len)
+  {
+    if(upl.fill == UPL_BUF && (upl.status = upl_write(0))) break;
+    n = (u16_t)LWIP_MIN(LWIP_MIN((UINT)(p->tot_len - off), UPL_BUF - upl.fill), upl.left);
+    pbuf_copy_partial(p, upl.buf + upl.fill, n, off);
+    upl.fill += n;
+    upl.left -= n;
+    off += n;
+  }
+  pbuf_free(p);
+  if(!upl.status && (upl.fill >= UPL_CHUNK || !upl.left))
+    upl.status = upl_write(!upl.left);
+  if(upl.status || !upl.left) upl_end(upl.status ? upl.status : 201);
+  upl_ack(connection, upl.unacked - upl.fill);  // what is on the card
+  return upl.status && upl.status != 201 ? ERR_VAL : ERR_OK;
+}
+
+void httpd_post_finished (void *connection, char *response_uri, u16_t response_uri_len)
+{
+  LWIP_UNUSED_ARG(connection);
+  if(!upl.status) upl_end(500);   // connection closed early
+  upl.conn = 0;
+  upl.reply_due = 1;
+  snprintf(response_uri, response_uri_len, FAT_UPLOAD);
+}
@@ -0,0 +1,12 @@
+#ifndef FS_FAT_H
+#define FS_FAT_H
+
+#include "lwip/apps/tftp_server.h"
+
+/* fs_fat.c: before path is rewritten, 0 if it is being sent or uploaded */
+int fat_release (const char *path);
+
+/* tftp_fat.c: TFTP server on the SD card */
+extern const struct tftp_context tftp_fat;
+
+#endif
@@ -1,16 +1,23 @@
 #include <stdio.h>
 #include "sys.h"
 #include "usbh.h"
+#include "ff.h"
 #include "lwip/init.h"
 #include "lwip/timeouts.h"
 #include "lwip/apps/httpd.h"
 #include "lwip/apps/lwiperf.h"
+#include "fs_fat.h"
 
 u8 ip_addr[4] = { 192, 168, 1, 191 };
 u8 ip_mask[4] = { 255, 255, 255, 0 };
 u8 ip_gate[4] = { 192, 168, 1, 1 };
 u8 ip_mac[6]  = { 0xF8, 0xF0, 0x12, 0x34, 0x00, 0x00 };
 
+void __attribute__((interrupt("IRQ"))) irq_handler (void)
+{
+  usbh_isr();
+}
+
 void lwiperf_report(void *arg, enum lwiperf_report_type report_type,
   const ip_addr_t* local_addr, u16_t local_port,
   const ip_addr_t* remote_addr, u16_t remote_port,
@@ -26,11 +33,23 @@ void lwiperf_report(void *arg, enum lwiperf_report_type report_type,
 
 int main (void)
 {
+  FATFS fs;
   puts(FG_CYAN "F1C100S USBH & RTL8152B & LWIP-"LWIP_VERSION_STRING"" ATTR_RESET);
+  sd_init();
+  disk_init(0, &sd_read, &sd_write);
+  if(sd_card_detect())
+  {
+    printf("Card inserted: %uMB\n", sd_card_init() / 2048);
+    printf("SD-disk mount: ");
+    if(f_mount(&fs, (TCHAR*)"0:", 1) != FR_OK) puts("error");
+    else printf("%s, serving 0:/www\n", fs.fs_type == 2 ? "FAT16" : fs.fs_type == 3 ? "FAT32" : "exFAT");
+  }
   usb_mux(USB_MUX_HOST);
   usbh_init();
+  usbh_irq(1);
   lwip_init();
   httpd_init();
+  tftp_init_server(&tftp_fat);
   lwiperf_start_tcp_server_default(lwiperf_report, NULL);
   while(1)
   {
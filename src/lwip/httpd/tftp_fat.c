@@ -0,0 +1,135 @@
+#include <string.h>
+#include "ff.h"
+#include "clmt.h"
+#include "mmu.h"
+#include "fs_fat.h"
+
+/* TFTP server on the SD card: "get x" reads and "put x" writes "0:/x". A put
+   announcing its size (tsize) gets the file preallocated in one piece, the
+   blocks are gathered into whole sectors before they go to the card. An
+   existing file is only truncated once the put is accepted */
+
+#define TFTP_ROOT   "0:/"
+#define TFTP_BUF    (32 * 1024)
+
+static struct {
+  FIL fil;
+  char path[sizeof(TFTP_ROOT) + TFTP_MAX_FILENAME_LEN];
+  int write;
+  int err;
+  int created;              // the put created the file
+  int trunc;                // the put is not accepted yet, the old file is intact
+  long size;                // announced by tsize, -1 if not
+  UINT fill;
+  u8_t buf[TFTP_BUF] __attribute__((aligned(CACHE_LINE_SIZE)));
+} tf;
+
+static int tftp_flush (int all)
+{
+  UINT n = all ? tf.fill : tf.fill & ~511, bw = 0;
+  if(tf.trunc)
+  {                               // the put is accepted, the old contents go
+    tf.trunc = 0;
+    if(f_truncate(&tf.fil) != FR_OK) return -1;
+  }
+  if(n && (f_write(&tf.fil, tf.buf, n, &bw) != FR_OK || bw != n)) return -1;
+  memmove(tf.buf, tf.buf + n, tf.fill - n);
+  tf.fill -= n;
+  return 0;
+}
+
+static void *tftp_open (const char *fname, const char *mode, u8_t write)
+{
+  FRESULT res;
+  LWIP_UNUSED_ARG(mode);
+  while(*fname == '/') fname++;
+  strcpy(tf.path, TFTP_ROOT);
+  strcat(tf.path, fname);
+  if(strstr(tf.path, "..")) return NULL;
+  tf.write = write;
+  tf.err = 0;
+  tf.size = -1;
+  tf.fill = 0;
+  tf.created = 0;
+  tf.trunc = write;
+  if(!write) res = f_open(&tf.fil, tf.path, FA_READ);
+  else if(!fat_release(tf.path)) return NULL;
+  else if((res = f_open(&tf.fil, tf.path, FA_CREATE_NEW | FA_WRITE)) == FR_EXIST)
+    res = f_open(&tf.fil, tf.path, FA_OPEN_EXISTING | FA_WRITE);
+  else tf.created = res == FR_OK;
+  return res == FR_OK ? &tf : NULL;
+}
+
+static void tftp_close (void *handle)
+{
+  LWIP_UNUSED_ARG(handle);
+  if(!tf.write)
+  {
+    f_close(&tf.fil);
+    return;
+  }
+  if(!tf.err && tftp_flush(1)) tf.err = 1;
+  if(tf.size >= 0 && (long)f_tell(&tf.fil) != tf.size) tf.err = 1;
+  if(f_close(&tf.fil) != FR_OK) tf.err = 1;
+  if(tf.err && (tf.created || !tf.trunc))
+    f_unlink(tf.path);            // broken or short transfer, a refused one keeps the old file
+  clmt_flush();                   // a rewritten file may keep its start cluster and size
+}
+
+static int tftp_read (void *handle, void *buf, int bytes)
+{
+  UINT br;
+  LWIP_UNUSED_ARG(handle);
+  return f_read(&tf.fil, buf, bytes, &br) == FR_OK ? (int)br : -1;
+}
+
+static int tftp_write (void *handle, struct pbuf *p)
+{
+  u16_t off = 0, n;
+  LWIP_UNUSED_ARG(handle);
+  while(off < p->tot_len)
+  {
+    if(tf.fill == TFTP_BUF && tftp_flush(0)) break;
+    n = (u16_t)LWIP_MIN((UINT)(p->tot_len - off), TFTP_BUF - tf.fill);
+    pbuf_copy_partial(p, tf.buf + tf.fill, n, off);
+    tf.fill += n;
+    off += n;
+  }
+  if(off < p->tot_len) tf.err = 1;
+  return tf.err ? -1 : 0;
+}
+
+static void tftp_error (void *handle, int err, const char *msg, int size)
+{
+  LWIP_UNUSED_ARG(handle);
+  LWIP_UNUSED_ARG(err);
+  LWIP_UNUSED_ARG(msg);
+  LWIP_UNUSED_ARG(size);
+  tf.err = 1;
+}
+
+static int tftp_tsize (void *handle, int size)
+{
+  DWORD nclst, csz;
+  FATFS *fs;
+  LWIP_UNUSED_ARG(handle);
+  if(!tf.write) return (int)LWIP_MIN(f_size(&tf.fil), 0x7FFFFFFF);
+  if(f_getfree(TFTP_ROOT, &nclst, &fs) != FR_OK) tf.err = 1;
+  else
+  {                               // the clusters of the old file count as free
+    csz = (DWORD)fs->csize * FF_MAX_SS;
+    if((QWORD)nclst + (f_size(&tf.fil) + csz - 1) / csz < ((QWORD)size + csz - 1) / csz) tf.err = 1;
+  }
+  if(tf.err || tftp_flush(1))
+  {
+    tf.err = 1;
+    return -1;
+  }
+  if(size > 0) f_expand(&tf.fil, size, 1);   // one piece if there is one, else as it comes
+  tf.size = size;
+  return size;
+}
+
+const struct tftp_context tftp_fat = {
+  tftp_open, tftp_close, tftp_read, tftp_write, tftp_error, tftp_tsize
+};
@@ -107,27 +107,34 @@ int slideshow (char *path)
 int main (void)
 {
   FATFS   fs;
+  boot_trace("main");
   puts("\033[36mF1C100S - Slideshow ("__DATE__" "__TIME__")\033[0m");
 
   //disp_init(&TV_PAL, 0);
   //disp_init(&TV_NTSC, 0);
   disp_init(&TFT_800x480, 0);
+  boot_trace("disp_init");
   fb = fb_alloc(display->width, display->height, 16);
   lay_config(0, display->width, display->height, 0, 0, 16, fb, 0, 5 << 8);
   lay_update(0);
   delay(100);
+  boot_trace("delay");
   disp_backlight(75);
   sd_init();
+  boot_trace("sd_init");
   disk_init(0, &sd_read, &sd_write);
   while(1)
   {
     if(sd_card_detect())
     {
       printf("Card inserted: %uMB\n", sd_card_init() / 2048);
+      boot_trace("sd_card");
       printf("SD-disk mount: ");
       if(f_mount(&fs, (TCHAR*)"0:", 1) != FR_OK) puts("error");
       else
       {
+        boot_trace("mount");
+        boot_trace_dump();
         printf("%s\n", fs.fs_type == 2 ? "FAT16" : fs.fs_type == 3 ? "FAT32" : "exFAT");
         while(sd_card_detect()) slideshow("0:/wallpapers");
         puts("Card removed");
@@ -115,7 +115,7 @@ int load_ppm (char *ppm, irgb_t *irgb)
 
 int load_model (int i, const unsigned char *md2, const unsigned char *ppm)
 {
-  if(!load_md2(md2, &mdl[i])) return 0;
+  if(!md2 || !ppm || !load_md2(md2, &mdl[i])) return 0;
   if(!load_ppm((char*)ppm, &irgb[i])) return 0;
   glGenTextures(1, &mdl[i].tex_id);	
   glBindTexture(GL_TEXTURE_2D, mdl[i].tex_id);
@@ -131,14 +131,13 @@ int load_model (int i, const unsigned char *md2, const unsigned char *ppm)
 GLfloat lightpos[4] = {0.0, 0.0, 0.2, 1.0};
 GLfloat lightdirect[3] = {-0.5, -0.6, -0.7};
 
-extern const unsigned char buf0_md2[];
-extern const unsigned char buf0_ppm[];
-
-extern const unsigned char buf1_md2[];
-extern const unsigned char buf1_ppm[];
-
-extern const unsigned char buf_md2[];
-extern const unsigned char buf_ppm[];
+/* Models stay mapped from the SPI flash asset archive while in use */
+const unsigned char *asset_load (const char *name)
+{
+  struct ASSET a;
+  if(asset_open(&a, name) != OK) return 0;
+  return asset_map(&a);
+}
 
 int main (void)
 {
@@ -175,7 +174,9 @@ int main (void)
   glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_DECAL);
   glHint(GL_PERSPECTIVE_CORRECTION_HINT, GL_FASTEST);
   glEnable(GL_TEXTURE_2D);
-  if(!load_model(0, buf0_md2, buf0_ppm) || !load_model(1, buf1_md2, buf1_ppm))
+  if(asset_init() <= 0 ||
+     !load_model(0, asset_load("soldier.md2"), asset_load("soldier.ppm")) ||
+     !load_model(1, asset_load("soldier2.md2"), asset_load("soldier2.ppm")))
   {
     puts("Model_0 loading error!");
     while(1);
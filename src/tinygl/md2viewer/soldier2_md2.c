@@ -1,4355 +0,0 @@
-/* Generated by bin2c, do not edit manually */
-const unsigned char buf1_md2[69632] = {
-    0x49, 0x44, 0x50, 0x32, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x74, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00,
-    0x86, 0x00, 0x00, 0x00, 0xF1, 0x02, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-    0x84, 0x00, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0xD8, 0x08, 0x00, 0x00, 0x3C, 0x04, 0x01, 0x00,
-    0x00, 0x10, 0x01, 0x00, 0x70, 0x6C, 0x61, 0x79, 0x65, 0x72, 0x73, 0x2F, 0x4D, 0x61, 0x72, 0x69,
-    0x6E, 0x65, 0x2F, 0x77, 0x65, 0x61, 0x70, 0x6F, 0x6E, 0x2E, 0x70, 0x63, 0x78, 0x00, 0x6C, 0x20,
-    0x46, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x28, 0x2A, 0x2E, 0x2A, 0x29, 0x00, 0x2A, 0x2E, 0x2A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x45, 0x00, 0x05, 0x00, 0x45, 0x00, 0x10, 0x00, 0x32, 0x00,
-    0x14, 0x00, 0x39, 0x00, 0x28, 0x00, 0x32, 0x00, 0x23, 0x00, 0x39, 0x00, 0x2D, 0x00, 0x39, 0x00,
-    0x0C, 0x00, 0x2E, 0x00, 0x21, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x15, 0x00, 0x04, 0x00,
-    0x29, 0x00, 0x01, 0x00, 0x29, 0x00, 0x04, 0x00, 0x15, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00,
-    0x14, 0x00, 0x07, 0x00, 0x15, 0x00, 0x07, 0x00, 0x29, 0x00, 0x07, 0x00, 0x0A, 0x00, 0x4C, 0x00,
-    0x00, 0x00, 0x4C, 0x00, 0x05, 0x00, 0x47, 0x00, 0x05, 0x00, 0x51, 0x00, 0x2E, 0x00, 0x71, 0x00,
-    0x42, 0x00, 0x6B, 0x00, 0x42, 0x00, 0x71, 0x00, 0x2E, 0x00, 0x6B, 0x00, 0x42, 0x00, 0x5A, 0x00,
-    0x2E, 0x00, 0x5F, 0x00, 0x2E, 0x00, 0x5A, 0x00, 0x42, 0x00, 0x5F, 0x00, 0x2E, 0x00, 0x65, 0x00,
-    0x42, 0x00, 0x65, 0x00, 0x2E, 0x00, 0x6A, 0x00, 0x42, 0x00, 0x6A, 0x00, 0x2E, 0x00, 0x7E, 0x00,
-    0x42, 0x00, 0x78, 0x00, 0x42, 0x00, 0x7E, 0x00, 0x2E, 0x00, 0x78, 0x00, 0x27, 0x00, 0x60, 0x00,
-    0x19, 0x00, 0x60, 0x00, 0x1D, 0x00, 0x5A, 0x00, 0x23, 0x00, 0x5A, 0x00, 0x24, 0x00, 0x65, 0x00,
-    0x1D, 0x00, 0x65, 0x00, 0x30, 0x00, 0x2D, 0x00, 0x30, 0x00, 0x10, 0x00, 0x68, 0x00, 0x10, 0x00,
-    0x5D, 0x00, 0x2D, 0x00, 0x2C, 0x00, 0x58, 0x00, 0x0F, 0x00, 0x4F, 0x00, 0x1E, 0x00, 0x3B, 0x00,
-    0x55, 0x00, 0x3B, 0x00, 0x55, 0x00, 0x58, 0x00, 0x63, 0x00, 0x2D, 0x00, 0x72, 0x00, 0x2D, 0x00,
-    0x72, 0x00, 0x3A, 0x00, 0x7E, 0x00, 0x5B, 0x00, 0x73, 0x00, 0x6D, 0x00, 0x79, 0x00, 0x59, 0x00,
-    0x10, 0x00, 0x5A, 0x00, 0x15, 0x00, 0x60, 0x00, 0x09, 0x00, 0x5A, 0x00, 0x05, 0x00, 0x60, 0x00,
-    0x6D, 0x00, 0x04, 0x00, 0x6D, 0x00, 0x0C, 0x00, 0x30, 0x00, 0x08, 0x00, 0x08, 0x00, 0x15, 0x00,
-    0x08, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x1B, 0x00, 0x77, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x77, 0x00, 0x30, 0x00, 0x03, 0x00, 0x68, 0x00, 0x00, 0x00,
-    0x77, 0x00, 0x24, 0x00, 0x24, 0x00, 0x58, 0x00, 0x7D, 0x00, 0x26, 0x00, 0x7D, 0x00, 0x3A, 0x00,
-    0x18, 0x00, 0x7D, 0x00, 0x02, 0x00, 0x7D, 0x00, 0x12, 0x00, 0x58, 0x00, 0x09, 0x00, 0x52, 0x00,
-    0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x15, 0x00, 0x5C, 0x00, 0x3F, 0x00, 0x5C, 0x00, 0x54, 0x00,
-    0x30, 0x00, 0x36, 0x00, 0x28, 0x00, 0x10, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x28, 0x00, 0x2F, 0x00,
-    0x18, 0x00, 0x28, 0x00, 0x08, 0x00, 0x0A, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x6B, 0x00, 0x54, 0x00,
-    0x7C, 0x00, 0x58, 0x00, 0x63, 0x00, 0x3A, 0x00, 0x7D, 0x00, 0x75, 0x00, 0x76, 0x00, 0x76, 0x00,
-    0x5D, 0x00, 0x3A, 0x00, 0x4F, 0x00, 0x5A, 0x00, 0x55, 0x00, 0x5A, 0x00, 0x5B, 0x00, 0x70, 0x00,
-    0x56, 0x00, 0x71, 0x00, 0x5C, 0x00, 0x56, 0x00, 0x60, 0x00, 0x68, 0x00, 0x43, 0x00, 0x64, 0x00,
-    0x4A, 0x00, 0x78, 0x00, 0x5C, 0x00, 0x76, 0x00, 0x4F, 0x00, 0x7E, 0x00, 0x66, 0x00, 0x70, 0x00,
-    0x65, 0x00, 0x68, 0x00, 0x73, 0x00, 0x57, 0x00, 0x70, 0x00, 0x7E, 0x00, 0x78, 0x00, 0x06, 0x00,
-    0x78, 0x00, 0x17, 0x00, 0x6F, 0x00, 0x17, 0x00, 0x6F, 0x00, 0x01, 0x00, 0x7D, 0x00, 0x01, 0x00,
-    0x7D, 0x00, 0x17, 0x00, 0x28, 0x00, 0x77, 0x00, 0x24, 0x00, 0x66, 0x00, 0x1A, 0x00, 0x66, 0x00,
-    0x1D, 0x00, 0x77, 0x00, 0x25, 0x00, 0x7D, 0x00, 0x28, 0x00, 0x66, 0x00, 0x2C, 0x00, 0x77, 0x00,
-    0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x05, 0x00, 0x03, 0x00,
-    0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 0x05, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x07, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x03, 0x00,
-    0x05, 0x00, 0x04, 0x00, 0x08, 0x00, 0x07, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x03, 0x00,
-    0x02, 0x00, 0x05, 0x00, 0x08, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x05, 0x00, 0x04, 0x00,
-    0x07, 0x00, 0x04, 0x00, 0x02, 0x00, 0x07, 0x00, 0x07, 0x00, 0x08, 0x00, 0x05, 0x00, 0x07, 0x00,
-    0x08, 0x00, 0x04, 0x00, 0x04, 0x00, 0x03, 0x00, 0x06, 0x00, 0x02, 0x00, 0x01, 0x00, 0x09, 0x00,
-    0x06, 0x00, 0x07, 0x00, 0x04, 0x00, 0x09, 0x00, 0x07, 0x00, 0x02, 0x00, 0x0A, 0x00, 0x0E, 0x00,
-    0x0D, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0x0A, 0x00,
-    0x0D, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00,
-    0x0B, 0x00, 0x09, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x11, 0x00, 0x0F, 0x00, 0x09, 0x00, 0x10, 0x00,
-    0x0F, 0x00, 0x11, 0x00, 0x12, 0x00, 0x0F, 0x00, 0x09, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x11, 0x00,
-    0x13, 0x00, 0x12, 0x00, 0x0C, 0x00, 0x0D, 0x00, 0x10, 0x00, 0x14, 0x00, 0x0C, 0x00, 0x15, 0x00,
-    0x0C, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x14, 0x00, 0x0A, 0x00, 0x0C, 0x00, 0x0F, 0x00, 0x0D, 0x00,
-    0x0E, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x0D, 0x00, 0x16, 0x00,
-    0x19, 0x00, 0x17, 0x00, 0x12, 0x00, 0x18, 0x00, 0x17, 0x00, 0x1A, 0x00, 0x1B, 0x00, 0x1C, 0x00,
-    0x12, 0x00, 0x13, 0x00, 0x18, 0x00, 0x1A, 0x00, 0x1D, 0x00, 0x1B, 0x00, 0x13, 0x00, 0x19, 0x00,
-    0x18, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x13, 0x00, 0x14, 0x00, 0x19, 0x00, 0x1E, 0x00,
-    0x21, 0x00, 0x1F, 0x00, 0x14, 0x00, 0x1A, 0x00, 0x19, 0x00, 0x21, 0x00, 0x22, 0x00, 0x1F, 0x00,
-    0x14, 0x00, 0x11, 0x00, 0x1A, 0x00, 0x21, 0x00, 0x23, 0x00, 0x22, 0x00, 0x11, 0x00, 0x1B, 0x00,
-    0x1A, 0x00, 0x23, 0x00, 0x24, 0x00, 0x22, 0x00, 0x11, 0x00, 0x15, 0x00, 0x1B, 0x00, 0x23, 0x00,
-    0x25, 0x00, 0x24, 0x00, 0x15, 0x00, 0x1C, 0x00, 0x1B, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00,
-    0x15, 0x00, 0x16, 0x00, 0x1C, 0x00, 0x26, 0x00, 0x29, 0x00, 0x27, 0x00, 0x16, 0x00, 0x17, 0x00,
-    0x1C, 0x00, 0x29, 0x00, 0x1C, 0x00, 0x27, 0x00, 0x16, 0x00, 0x12, 0x00, 0x17, 0x00, 0x29, 0x00,
-    0x1A, 0x00, 0x1C, 0x00, 0x1A, 0x00, 0x17, 0x00, 0x18, 0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C, 0x00,
-    0x1A, 0x00, 0x18, 0x00, 0x19, 0x00, 0x2A, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x1A, 0x00, 0x1B, 0x00,
-    0x1C, 0x00, 0x2A, 0x00, 0x2E, 0x00, 0x2F, 0x00, 0x1A, 0x00, 0x1C, 0x00, 0x17, 0x00, 0x2A, 0x00,
-    0x2F, 0x00, 0x2B, 0x00, 0x1D, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00,
-    0x20, 0x00, 0x39, 0x00, 0x1D, 0x00, 0x32, 0x00, 0x33, 0x00, 0x30, 0x00, 0x38, 0x00, 0x22, 0x00,
-    0x24, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x24, 0x00, 0x23, 0x00, 0x21, 0x00, 0x36, 0x00,
-    0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 0x25, 0x00, 0x26, 0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B, 0x00,
-    0x40, 0x00, 0x50, 0x00, 0x42, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x32, 0x00, 0x24, 0x00,
-    0x30, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x41, 0x00, 0x30, 0x00, 0x24, 0x00, 0x20, 0x00, 0x41, 0x00,
-    0x40, 0x00, 0x42, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00,
-    0x2D, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x24, 0x00, 0x22, 0x00,
-    0x20, 0x00, 0x40, 0x00, 0x49, 0x00, 0x42, 0x00, 0x30, 0x00, 0x20, 0x00, 0x31, 0x00, 0x44, 0x00,
-    0x32, 0x00, 0x45, 0x00, 0x31, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x45, 0x00, 0x32, 0x00, 0x31, 0x00,
-    0x2F, 0x00, 0x34, 0x00, 0x2D, 0x00, 0x4A, 0x00, 0x4B, 0x00, 0x46, 0x00, 0x20, 0x00, 0x22, 0x00,
-    0x1E, 0x00, 0x42, 0x00, 0x49, 0x00, 0x4C, 0x00, 0x31, 0x00, 0x23, 0x00, 0x24, 0x00, 0x45, 0x00,
-    0x4D, 0x00, 0x4E, 0x00, 0x31, 0x00, 0x24, 0x00, 0x32, 0x00, 0x45, 0x00, 0x4E, 0x00, 0x43, 0x00,
-    0x2F, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x4A, 0x00, 0x46, 0x00, 0x48, 0x00, 0x1E, 0x00, 0x25, 0x00,
-    0x37, 0x00, 0x4F, 0x00, 0x3A, 0x00, 0x39, 0x00, 0x20, 0x00, 0x1E, 0x00, 0x39, 0x00, 0x32, 0x00,
-    0x4F, 0x00, 0x33, 0x00, 0x38, 0x00, 0x36, 0x00, 0x22, 0x00, 0x34, 0x00, 0x50, 0x00, 0x35, 0x00,
-    0x27, 0x00, 0x28, 0x00, 0x26, 0x00, 0x51, 0x00, 0x52, 0x00, 0x3B, 0x00, 0x26, 0x00, 0x25, 0x00,
-    0x27, 0x00, 0x3B, 0x00, 0x3A, 0x00, 0x51, 0x00, 0x1E, 0x00, 0x22, 0x00, 0x28, 0x00, 0x4C, 0x00,
-    0x49, 0x00, 0x53, 0x00, 0x28, 0x00, 0x27, 0x00, 0x1E, 0x00, 0x53, 0x00, 0x54, 0x00, 0x4C, 0x00,
-    0x25, 0x00, 0x1E, 0x00, 0x27, 0x00, 0x3A, 0x00, 0x4F, 0x00, 0x51, 0x00, 0x26, 0x00, 0x28, 0x00,
-    0x22, 0x00, 0x55, 0x00, 0x56, 0x00, 0x35, 0x00, 0x1F, 0x00, 0x1D, 0x00, 0x2A, 0x00, 0x31, 0x00,
-    0x30, 0x00, 0x57, 0x00, 0x2A, 0x00, 0x29, 0x00, 0x1F, 0x00, 0x57, 0x00, 0x58, 0x00, 0x31, 0x00,
-    0x21, 0x00, 0x23, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x37, 0x00, 0x59, 0x00, 0x2C, 0x00, 0x2B, 0x00,
-    0x21, 0x00, 0x59, 0x00, 0x5A, 0x00, 0x38, 0x00, 0x1D, 0x00, 0x21, 0x00, 0x2A, 0x00, 0x30, 0x00,
-    0x5B, 0x00, 0x57, 0x00, 0x33, 0x00, 0x31, 0x00, 0x1F, 0x00, 0x5C, 0x00, 0x45, 0x00, 0x31, 0x00,
-    0x1F, 0x00, 0x29, 0x00, 0x33, 0x00, 0x31, 0x00, 0x58, 0x00, 0x5C, 0x00, 0x23, 0x00, 0x31, 0x00,
-    0x33, 0x00, 0x4D, 0x00, 0x45, 0x00, 0x5C, 0x00, 0x33, 0x00, 0x2C, 0x00, 0x23, 0x00, 0x5C, 0x00,
-    0x5D, 0x00, 0x4D, 0x00, 0x2B, 0x00, 0x2A, 0x00, 0x21, 0x00, 0x5E, 0x00, 0x57, 0x00, 0x5B, 0x00,
-    0x2D, 0x00, 0x35, 0x00, 0x2E, 0x00, 0x46, 0x00, 0x5F, 0x00, 0x47, 0x00, 0x2D, 0x00, 0x29, 0x00,
-    0x35, 0x00, 0x46, 0x00, 0x58, 0x00, 0x5F, 0x00, 0x33, 0x00, 0x29, 0x00, 0x2D, 0x00, 0x5C, 0x00,
-    0x58, 0x00, 0x46, 0x00, 0x2D, 0x00, 0x34, 0x00, 0x33, 0x00, 0x46, 0x00, 0x4B, 0x00, 0x5C, 0x00,
-    0x2C, 0x00, 0x33, 0x00, 0x34, 0x00, 0x5D, 0x00, 0x5C, 0x00, 0x4B, 0x00, 0x34, 0x00, 0x2F, 0x00,
-    0x2C, 0x00, 0x4B, 0x00, 0x60, 0x00, 0x5D, 0x00, 0x2C, 0x00, 0x2F, 0x00, 0x35, 0x00, 0x59, 0x00,
-    0x61, 0x00, 0x62, 0x00, 0x2E, 0x00, 0x35, 0x00, 0x2F, 0x00, 0x63, 0x00, 0x62, 0x00, 0x61, 0x00,
-    0x35, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x5F, 0x00, 0x58, 0x00, 0x57, 0x00, 0x35, 0x00, 0x2B, 0x00,
-    0x2C, 0x00, 0x62, 0x00, 0x5A, 0x00, 0x59, 0x00, 0x35, 0x00, 0x2A, 0x00, 0x2B, 0x00, 0x5F, 0x00,
-    0x57, 0x00, 0x5E, 0x00, 0x26, 0x00, 0x36, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x64, 0x00, 0x39, 0x00,
-    0x22, 0x00, 0x36, 0x00, 0x26, 0x00, 0x35, 0x00, 0x50, 0x00, 0x55, 0x00, 0x50, 0x00, 0x43, 0x00,
-    0x41, 0x00, 0x3D, 0x00, 0x65, 0x00, 0x66, 0x00, 0x37, 0x00, 0x39, 0x00, 0x1E, 0x00, 0x39, 0x00,
-    0x33, 0x00, 0x4F, 0x00, 0x1D, 0x00, 0x38, 0x00, 0x21, 0x00, 0x30, 0x00, 0x67, 0x00, 0x5B, 0x00,
-    0x24, 0x00, 0x21, 0x00, 0x38, 0x00, 0x36, 0x00, 0x38, 0x00, 0x34, 0x00, 0x1D, 0x00, 0x39, 0x00,
-    0x38, 0x00, 0x30, 0x00, 0x33, 0x00, 0x67, 0x00, 0x36, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x68, 0x00,
-    0x69, 0x00, 0x6A, 0x00, 0x3C, 0x00, 0x3B, 0x00, 0x36, 0x00, 0x6A, 0x00, 0x6B, 0x00, 0x68, 0x00,
-    0x38, 0x00, 0x39, 0x00, 0x3A, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x6D, 0x00, 0x3A, 0x00, 0x3C, 0x00,
-    0x38, 0x00, 0x6D, 0x00, 0x6A, 0x00, 0x69, 0x00, 0x39, 0x00, 0x37, 0x00, 0x3D, 0x00, 0x69, 0x00,
-    0x68, 0x00, 0x6B, 0x00, 0x3D, 0x00, 0x3A, 0x00, 0x39, 0x00, 0x6B, 0x00, 0x6A, 0x00, 0x69, 0x00,
-    0x37, 0x00, 0x36, 0x00, 0x3B, 0x00, 0x6E, 0x00, 0x68, 0x00, 0x6B, 0x00, 0x3B, 0x00, 0x3D, 0x00,
-    0x37, 0x00, 0x6B, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x3B, 0x00, 0x6A, 0x00,
-    0x70, 0x00, 0x6B, 0x00, 0x3A, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x6A, 0x00, 0x6B, 0x00, 0x70, 0x00,
-    0x3D, 0x00, 0x3B, 0x00, 0x3E, 0x00, 0x6F, 0x00, 0x6B, 0x00, 0x70, 0x00, 0x3E, 0x00, 0x3F, 0x00,
-    0x3D, 0x00, 0x70, 0x00, 0x71, 0x00, 0x6F, 0x00, 0x3E, 0x00, 0x51, 0x00, 0x41, 0x00, 0x70, 0x00,
-    0x72, 0x00, 0x66, 0x00, 0x42, 0x00, 0x50, 0x00, 0x51, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x72, 0x00,
-    0x3C, 0x00, 0x52, 0x00, 0x51, 0x00, 0x6A, 0x00, 0x73, 0x00, 0x72, 0x00, 0x40, 0x00, 0x51, 0x00,
-    0x52, 0x00, 0x74, 0x00, 0x72, 0x00, 0x73, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x52, 0x00, 0x70, 0x00,
-    0x66, 0x00, 0x72, 0x00, 0x52, 0x00, 0x3A, 0x00, 0x3F, 0x00, 0x72, 0x00, 0x6A, 0x00, 0x70, 0x00,
-    0x3F, 0x00, 0x3E, 0x00, 0x41, 0x00, 0x71, 0x00, 0x70, 0x00, 0x66, 0x00, 0x41, 0x00, 0x43, 0x00,
-    0x3F, 0x00, 0x66, 0x00, 0x75, 0x00, 0x71, 0x00, 0x44, 0x00, 0x46, 0x00, 0x47, 0x00, 0x76, 0x00,
-    0x77, 0x00, 0x78, 0x00, 0x47, 0x00, 0x45, 0x00, 0x44, 0x00, 0x78, 0x00, 0x79, 0x00, 0x76, 0x00,
-    0x48, 0x00, 0x45, 0x00, 0x47, 0x00, 0x76, 0x00, 0x79, 0x00, 0x78, 0x00, 0x47, 0x00, 0x49, 0x00,
-    0x48, 0x00, 0x78, 0x00, 0x77, 0x00, 0x76, 0x00, 0x45, 0x00, 0x48, 0x00, 0x44, 0x00, 0x79, 0x00,
-    0x7A, 0x00, 0x76, 0x00, 0x46, 0x00, 0x44, 0x00, 0x48, 0x00, 0x77, 0x00, 0x76, 0x00, 0x7A, 0x00,
-    0x48, 0x00, 0x49, 0x00, 0x46, 0x00, 0x7A, 0x00, 0x7B, 0x00, 0x77, 0x00, 0x4A, 0x00, 0x4C, 0x00,
-    0x4D, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0x4D, 0x00, 0x4B, 0x00, 0x4A, 0x00, 0x7E, 0x00,
-    0x7F, 0x00, 0x7C, 0x00, 0x4E, 0x00, 0x4B, 0x00, 0x4D, 0x00, 0x7C, 0x00, 0x7F, 0x00, 0x7E, 0x00,
-    0x4D, 0x00, 0x4F, 0x00, 0x4E, 0x00, 0x7E, 0x00, 0x7D, 0x00, 0x7C, 0x00, 0x4B, 0x00, 0x4E, 0x00,
-    0x4A, 0x00, 0x7F, 0x00, 0x7C, 0x00, 0x80, 0x00, 0x4C, 0x00, 0x4A, 0x00, 0x4E, 0x00, 0x81, 0x00,
-    0x82, 0x00, 0x7C, 0x00, 0x4E, 0x00, 0x4F, 0x00, 0x4C, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x81, 0x00,
-    0x51, 0x00, 0x50, 0x00, 0x41, 0x00, 0x72, 0x00, 0x3D, 0x00, 0x66, 0x00, 0x43, 0x00, 0x50, 0x00,
-    0x52, 0x00, 0x66, 0x00, 0x3D, 0x00, 0x72, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x51, 0x00, 0x70, 0x00,
-    0x6A, 0x00, 0x72, 0x00, 0x40, 0x00, 0x42, 0x00, 0x51, 0x00, 0x74, 0x00, 0x3E, 0x00, 0x72, 0x00,
-    0x3C, 0x00, 0x3A, 0x00, 0x52, 0x00, 0x6A, 0x00, 0x6D, 0x00, 0x73, 0x00, 0x52, 0x00, 0x50, 0x00,
-    0x40, 0x00, 0x72, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x7A, 0xF6, 0xAC, 0x3D, 0xF1, 0x89, 0xE5, 0x3C,
-    0x57, 0xAC, 0x3D, 0x3D, 0xD0, 0xD3, 0x12, 0xC0, 0x13, 0x83, 0x1D, 0xC1, 0xCB, 0x9D, 0x81, 0x40,
-    0x73, 0x74, 0x61, 0x6E, 0x64, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x79, 0x3B, 0xD4, 0x41, 0x86, 0x31, 0xEE, 0x56, 0x9B, 0x31, 0xE4, 0x56, 0x70, 0x28, 0xD6, 0x7A,
-    0x80, 0x1A, 0xFB, 0x7A, 0xA2, 0x1A, 0xEA, 0x62, 0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08,
-    0xA3, 0x40, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C,
-    0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A,
-    0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87,
-    0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62,
-    0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47,
-    0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x19, 0xD7, 0x7A,
-    0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1A, 0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07,
-    0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42,
-    0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x44, 0x83, 0xA0, 0x42, 0x75, 0x89, 0x1A,
-    0x4C, 0x5D, 0xD1, 0x06, 0x0D, 0x1B, 0xEB, 0x78, 0x00, 0x64, 0x90, 0x94, 0x0F, 0x6D, 0xF5, 0x16,
-    0xDF, 0x20, 0xAF, 0x38, 0x63, 0x37, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x3F, 0xDD, 0x84,
-    0x10, 0x3F, 0xFF, 0x05, 0x23, 0x5D, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60,
-    0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49,
-    0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58,
-    0x79, 0x43, 0x71, 0x6C, 0x71, 0x88, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77,
-    0xA2, 0xFF, 0x92, 0x9E, 0xB5, 0xFB, 0x94, 0x2C, 0xA0, 0x86, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x3F,
-    0xA5, 0xF8, 0xA7, 0x01, 0xA3, 0x7F, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56,
-    0x54, 0x4A, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6E, 0x7C, 0x18,
-    0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A, 0x35, 0x36, 0xAD, 0x3D,
-    0x24, 0x9E, 0xDE, 0x3C, 0x3C, 0x1C, 0x3D, 0x3D, 0x54, 0x8C, 0xEA, 0xBF, 0x2F, 0x58, 0x16, 0xC1,
-    0x70, 0x13, 0x6B, 0x40, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x79, 0x30, 0xD4, 0x41, 0x85, 0x26, 0xEE, 0x56, 0x9A, 0x27, 0xE4, 0x56,
-    0x70, 0x1C, 0xD6, 0x7A, 0x80, 0x0D, 0xFA, 0x7A, 0xA2, 0x0F, 0xEA, 0x62, 0x70, 0x43, 0xDB, 0x11,
-    0x81, 0x35, 0xFF, 0x08, 0xA2, 0x37, 0xEF, 0x26, 0xE0, 0x5B, 0x65, 0x20, 0xE0, 0x41, 0x62, 0x68,
-    0xE1, 0x4C, 0x6B, 0x0E, 0xDF, 0x51, 0x5C, 0x52, 0xFE, 0x43, 0x54, 0x65, 0xFF, 0x4E, 0x5D, 0x8B,
-    0xFE, 0x5D, 0x57, 0x2A, 0xFD, 0x53, 0x4E, 0x48, 0xD5, 0x5B, 0x92, 0x20, 0xD5, 0x24, 0x8B, 0x68,
-    0xD7, 0x2D, 0x9B, 0x87, 0xD7, 0x49, 0x9E, 0x0A, 0xD3, 0x53, 0x83, 0x4E, 0xD3, 0x37, 0x7F, 0x58,
-    0xF7, 0x27, 0x7B, 0x62, 0xF9, 0x2F, 0x8B, 0x8C, 0xF9, 0x4B, 0x8E, 0x0B, 0xF8, 0x5E, 0x82, 0x29,
-    0xF5, 0x55, 0x73, 0x47, 0xF5, 0x39, 0x6F, 0x55, 0x50, 0x33, 0x6C, 0x58, 0xEE, 0x00, 0x40, 0x70,
-    0x5F, 0x0B, 0xD6, 0x7A, 0xD8, 0x06, 0x9B, 0x6E, 0x51, 0x7D, 0x76, 0x1A, 0xF0, 0xAB, 0x55, 0x25,
-    0x60, 0x55, 0xDF, 0x07, 0xD9, 0x6B, 0xA8, 0x25, 0xE7, 0x31, 0x25, 0x60, 0xE8, 0x93, 0x31, 0x4F,
-    0xFA, 0x15, 0x32, 0x42, 0xFC, 0x9F, 0x43, 0x2E, 0x4B, 0x1E, 0xCA, 0x7A, 0x41, 0x39, 0x82, 0xA0,
-    0x42, 0x6B, 0x88, 0x1A, 0x4C, 0x51, 0xD0, 0x06, 0x0D, 0x07, 0xE9, 0x7A, 0x00, 0x56, 0x8E, 0x94,
-    0x0E, 0x5C, 0xF3, 0x16, 0xDF, 0x1C, 0xB0, 0x38, 0x62, 0x2A, 0xEE, 0x86, 0xDF, 0x48, 0xB6, 0x31,
-    0x4E, 0x32, 0xDC, 0x84, 0x10, 0x2C, 0xFD, 0x05, 0x23, 0x50, 0x92, 0x51, 0xBC, 0xA0, 0x47, 0x1E,
-    0xBB, 0x1E, 0x37, 0x60, 0xB4, 0x9F, 0x4B, 0x1B, 0xB3, 0x1D, 0x3B, 0x71, 0xA3, 0x42, 0x0F, 0x78,
-    0xAA, 0xA2, 0x11, 0x49, 0xA4, 0x9F, 0x1A, 0x07, 0xA9, 0x45, 0x06, 0x5E, 0x9D, 0x9D, 0x0A, 0x1C,
-    0x9D, 0x51, 0x00, 0x58, 0x7A, 0x3C, 0x71, 0x6C, 0x71, 0x85, 0x1B, 0x19, 0x7A, 0x69, 0x76, 0x14,
-    0x71, 0x63, 0x17, 0x77, 0xA1, 0xFF, 0x94, 0x9E, 0xB4, 0xFC, 0x97, 0x2C, 0xA0, 0x83, 0x85, 0x94,
-    0xB3, 0x80, 0x87, 0x3F, 0xA4, 0xF7, 0xAA, 0x01, 0xA3, 0x7B, 0x9A, 0x7F, 0x3C, 0x4F, 0x2E, 0x71,
-    0x59, 0x72, 0x25, 0x56, 0x54, 0x41, 0x77, 0x7D, 0x71, 0x55, 0x6C, 0x3F, 0x3D, 0x90, 0x36, 0x1B,
-    0x55, 0x66, 0x7C, 0x18, 0x7F, 0x6A, 0x32, 0x92, 0x93, 0x92, 0x20, 0x08, 0x93, 0x4D, 0x17, 0x6B,
-    0x2C, 0x60, 0xAD, 0x3D, 0x2A, 0x0E, 0xE2, 0x3C, 0x30, 0x64, 0x3C, 0x3D, 0xC7, 0x82, 0xB0, 0xBF,
-    0x83, 0x65, 0x14, 0xC1, 0x70, 0x11, 0x56, 0x40, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x30, 0x33, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x2F, 0xD3, 0x41, 0x85, 0x24, 0xEE, 0x56,
-    0x9A, 0x27, 0xE4, 0x56, 0x70, 0x1A, 0xD5, 0x7A, 0x80, 0x0B, 0xFA, 0x7A, 0xA2, 0x10, 0xEA, 0x62,
-    0x70, 0x41, 0xDA, 0x11, 0x80, 0x32, 0xFF, 0x08, 0xA2, 0x36, 0xF0, 0x26, 0xE0, 0x63, 0x67, 0x20,
-    0xE0, 0x4A, 0x63, 0x68, 0xE1, 0x53, 0x6D, 0x0C, 0xDF, 0x59, 0x5E, 0x52, 0xFE, 0x4E, 0x56, 0x65,
-    0xFF, 0x58, 0x5F, 0x8B, 0xFE, 0x67, 0x59, 0x2A, 0xFD, 0x5E, 0x50, 0x48, 0xD5, 0x61, 0x94, 0x20,
-    0xD5, 0x2B, 0x8C, 0x68, 0xD7, 0x33, 0x9C, 0x87, 0xD7, 0x4E, 0xA0, 0x0A, 0xD3, 0x59, 0x84, 0x4E,
-    0xD3, 0x3E, 0x80, 0x58, 0xF7, 0x30, 0x7D, 0x63, 0xF9, 0x38, 0x8C, 0x8C, 0xF9, 0x53, 0x90, 0x0B,
-    0xF7, 0x66, 0x84, 0x29, 0xF5, 0x5E, 0x75, 0x47, 0xF5, 0x43, 0x71, 0x55, 0x50, 0x33, 0x6B, 0x58,
-    0xEF, 0x0C, 0x40, 0x70, 0x5F, 0x09, 0xD5, 0x7A, 0xD8, 0x0D, 0x9C, 0x6E, 0x51, 0x7C, 0x75, 0x1A,
-    0xF0, 0xB3, 0x58, 0x25, 0x5F, 0x51, 0xDF, 0x07, 0xD9, 0x6F, 0xAA, 0x25, 0xE7, 0x3D, 0x26, 0x60,
-    0xE7, 0x9C, 0x33, 0x4F, 0xFB, 0x22, 0x33, 0x42, 0xFC, 0xA9, 0x46, 0x2E, 0x4B, 0x1A, 0xC8, 0x68,
-    0x41, 0x38, 0x80, 0xA0, 0x42, 0x69, 0x87, 0x1A, 0x4C, 0x4C, 0xD0, 0x06, 0x0D, 0x00, 0xE6, 0x7A,
-    0x00, 0x50, 0x8C, 0x94, 0x0E, 0x53, 0xF2, 0x16, 0xDE, 0x21, 0xB2, 0x38, 0x62, 0x26, 0xED, 0x86,
-    0xDF, 0x4D, 0xB8, 0x31, 0x4E, 0x2D, 0xDB, 0x84, 0x10, 0x23, 0xFB, 0x05, 0x23, 0x4D, 0x90, 0x51,
-    0xBC, 0xA6, 0x49, 0x1E, 0xBC, 0x27, 0x37, 0x60, 0xB4, 0xA5, 0x4D, 0x1B, 0xB3, 0x26, 0x3B, 0x71,
-    0xA3, 0x4B, 0x0F, 0x78, 0xAA, 0xA9, 0x13, 0x49, 0xA4, 0xA6, 0x1C, 0x07, 0xAA, 0x4E, 0x06, 0x5E,
-    0x9D, 0xA4, 0x0B, 0x1C, 0x9D, 0x59, 0x00, 0x58, 0x7A, 0x3F, 0x70, 0x6C, 0x71, 0x8A, 0x1C, 0x1B,
-    0x7A, 0x6A, 0x77, 0x14, 0x71, 0x68, 0x17, 0x77, 0xA0, 0xFF, 0x97, 0x9E, 0xB3, 0xFD, 0x9A, 0x2C,
-    0x9F, 0x86, 0x86, 0x94, 0xB2, 0x84, 0x89, 0x3F, 0xA3, 0xF7, 0xAD, 0x01, 0xA2, 0x7D, 0x9B, 0x7F,
-    0x3D, 0x51, 0x2D, 0x71, 0x5A, 0x74, 0x24, 0x56, 0x54, 0x41, 0x76, 0x7D, 0x71, 0x57, 0x6C, 0x3F,
-    0x3D, 0x90, 0x36, 0x1B, 0x55, 0x65, 0x7B, 0x18, 0x7F, 0x6E, 0x32, 0x92, 0x93, 0x98, 0x21, 0x08,
-    0x93, 0x54, 0x17, 0x6B, 0x8D, 0x74, 0xAD, 0x3D, 0xAF, 0x1A, 0xEC, 0x3C, 0x6E, 0x8E, 0x3B, 0x3D,
-    0x0A, 0x31, 0x71, 0xBF, 0x8E, 0x84, 0x15, 0xC1, 0xA3, 0x25, 0x47, 0x40, 0x73, 0x74, 0x61, 0x6E,
-    0x64, 0x30, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x33, 0xD3, 0x41,
-    0x85, 0x29, 0xEE, 0x56, 0x9A, 0x2D, 0xE5, 0x56, 0x70, 0x1F, 0xD4, 0x7A, 0x80, 0x10, 0xF9, 0x7A,
-    0xA1, 0x17, 0xEB, 0x62, 0x6F, 0x44, 0xDA, 0x11, 0x80, 0x35, 0xFF, 0x08, 0xA1, 0x3C, 0xF1, 0x26,
-    0xE0, 0x6F, 0x69, 0x20, 0xE0, 0x57, 0x65, 0x68, 0xE1, 0x60, 0x6E, 0x0C, 0xDF, 0x66, 0x5F, 0x52,
-    0xFE, 0x5D, 0x58, 0x65, 0xFF, 0x66, 0x61, 0x8B, 0xFE, 0x75, 0x5C, 0x2A, 0xFD, 0x6C, 0x52, 0x48,
-    0xD5, 0x6B, 0x96, 0x20, 0xD5, 0x37, 0x8D, 0x68, 0xD7, 0x3F, 0x9D, 0x87, 0xD7, 0x58, 0xA1, 0x0A,
-    0xD3, 0x63, 0x86, 0x4E, 0xD3, 0x4A, 0x82, 0x58, 0xF7, 0x3E, 0x7E, 0x63, 0xF9, 0x46, 0x8E, 0x8C,
-    0xF9, 0x5F, 0x92, 0x0B, 0xF7, 0x72, 0x87, 0x29, 0xF5, 0x6A, 0x77, 0x47, 0xF5, 0x51, 0x73, 0x55,
-    0x51, 0x39, 0x6A, 0x58, 0xF0, 0x1E, 0x41, 0x70, 0x5F, 0x0E, 0xD3, 0x7A, 0xD9, 0x1A, 0x9D, 0x6E,
-    0x51, 0x7E, 0x75, 0x1A, 0xEF, 0xBD, 0x5B, 0x25, 0x5F, 0x53, 0xDF, 0x07, 0xD8, 0x78, 0xAC, 0x25,
-    0xE8, 0x4D, 0x27, 0x60, 0xE7, 0xA8, 0x36, 0x4F, 0xFC, 0x34, 0x34, 0x42, 0xFB, 0xB5, 0x49, 0x2E,
-    0x4B, 0x1E, 0xC7, 0x68, 0x42, 0x3C, 0x7F, 0xA0, 0x41, 0x6B, 0x87, 0x1A, 0x4B, 0x4D, 0xCF, 0x06,
-    0x0D, 0x00, 0xE3, 0x7A, 0x00, 0x4F, 0x89, 0x94, 0x0D, 0x4F, 0xF0, 0x16, 0xDE, 0x2D, 0xB3, 0x38,
-    0x62, 0x29, 0xEC, 0x86, 0xDE, 0x57, 0xBA, 0x31, 0x4D, 0x2F, 0xDA, 0x84, 0x0F, 0x21, 0xF9, 0x05,
-    0x23, 0x4E, 0x8F, 0x51, 0xBC, 0xAE, 0x4B, 0x1E, 0xBC, 0x35, 0x37, 0x60, 0xB4, 0xAD, 0x4F, 0x1B,
-    0xB4, 0x33, 0x3B, 0x71, 0xA4, 0x58, 0x0F, 0x78, 0xAA, 0xB2, 0x14, 0x49, 0xA3, 0xAE, 0x1D, 0x07,
-    0xAB, 0x5C, 0x06, 0x5E, 0x9D, 0xAD, 0x0C, 0x1C, 0x9E, 0x66, 0x00, 0x58, 0x7A, 0x46, 0x70, 0x6C,
-    0x71, 0x91, 0x1C, 0x1B, 0x7A, 0x70, 0x77, 0x14, 0x71, 0x70, 0x16, 0x77, 0x9F, 0xFF, 0x9A, 0x9E,
-    0xB2, 0xFE, 0x9D, 0x2C, 0x9F, 0x8B, 0x87, 0x94, 0xB2, 0x8B, 0x8A, 0x3F, 0xA2, 0xF6, 0xB0, 0x01,
-    0xA2, 0x83, 0x9D, 0x7F, 0x3D, 0x56, 0x2B, 0x71, 0x5A, 0x7B, 0x24, 0x56, 0x55, 0x46, 0x75, 0x7D,
-    0x71, 0x5D, 0x6B, 0x3F, 0x3D, 0x93, 0x35, 0x14, 0x54, 0x69, 0x7B, 0x18, 0x7F, 0x76, 0x32, 0x92,
-    0x93, 0xA0, 0x22, 0x08, 0x94, 0x60, 0x17, 0x6B, 0x21, 0x67, 0xAD, 0x3D, 0x71, 0xEA, 0xF7, 0x3C,
-    0xDD, 0xAE, 0x3A, 0x3D, 0x58, 0xFE, 0x06, 0xBF, 0x9F, 0xCA, 0x16, 0xC1, 0xF4, 0x2B, 0x41, 0x40,
-    0x73, 0x74, 0x61, 0x6E, 0x64, 0x30, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x38, 0xD3, 0x3E, 0x84, 0x2E, 0xEE, 0x56, 0x99, 0x34, 0xE5, 0x56, 0x70, 0x25, 0xD3, 0x73,
-    0x80, 0x16, 0xF8, 0x7A, 0xA1, 0x1F, 0xEB, 0x62, 0x6F, 0x47, 0xDA, 0x0F, 0x7F, 0x39, 0xFF, 0x08,
-    0xA1, 0x42, 0xF1, 0x26, 0xE0, 0x7B, 0x6A, 0x20, 0xE0, 0x65, 0x66, 0x68, 0xE1, 0x6D, 0x70, 0x0C,
-    0xDF, 0x73, 0x61, 0x52, 0xFE, 0x6D, 0x5A, 0x65, 0xFF, 0x75, 0x63, 0x8B, 0xFE, 0x84, 0x5E, 0x2A,
-    0xFD, 0x7B, 0x54, 0x48, 0xD4, 0x75, 0x97, 0x20, 0xD5, 0x44, 0x8E, 0x68, 0xD7, 0x4B, 0x9E, 0x87,
-    0xD6, 0x63, 0xA3, 0x0E, 0xD3, 0x6F, 0x87, 0x4E, 0xD3, 0x56, 0x83, 0x59, 0xF7, 0x4E, 0x80, 0x63,
-    0xF9, 0x54, 0x90, 0x6F, 0xF9, 0x6D, 0x94, 0x0B, 0xF7, 0x7F, 0x89, 0x29, 0xF5, 0x78, 0x79, 0x47,
-    0xF5, 0x60, 0x75, 0x55, 0x51, 0x3F, 0x68, 0x58, 0xF0, 0x30, 0x42, 0x70, 0x5F, 0x13, 0xD2, 0x7A,
-    0xD9, 0x29, 0x9D, 0x70, 0x50, 0x80, 0x74, 0x1A, 0xEF, 0xC7, 0x5E, 0x25, 0x5F, 0x54, 0xDE, 0x07,
-    0xD8, 0x81, 0xAE, 0x25, 0xE8, 0x5D, 0x28, 0x60, 0xE7, 0xB4, 0x38, 0x4F, 0xFC, 0x46, 0x35, 0x42,
-    0xFB, 0xC0, 0x4C, 0x2E, 0x4B, 0x21, 0xC6, 0x68, 0x42, 0x3F, 0x7D, 0x58, 0x41, 0x6C, 0x86, 0x1A,
-    0x4B, 0x4E, 0xCE, 0x07, 0x0D, 0x00, 0xE0, 0x7A, 0x00, 0x4D, 0x87, 0x94, 0x0D, 0x4A, 0xEE, 0x15,
-    0xDE, 0x3B, 0xB4, 0x38, 0x61, 0x2C, 0xEB, 0x86, 0xDE, 0x62, 0xBB, 0x31, 0x4D, 0x32, 0xD9, 0x84,
-    0x0F, 0x1F, 0xF6, 0x05, 0x23, 0x4E, 0x8D, 0x51, 0xBB, 0xB6, 0x4D, 0x1E, 0xBD, 0x43, 0x37, 0x60,
-    0xB3, 0xB4, 0x50, 0x1B, 0xB5, 0x41, 0x3B, 0x71, 0xA4, 0x64, 0x0F, 0x78, 0xAA, 0xBA, 0x15, 0x49,
-    0xA3, 0xB6, 0x1E, 0x07, 0xAB, 0x68, 0x06, 0x5E, 0x9D, 0xB5, 0x0D, 0x1C, 0x9E, 0x71, 0x00, 0x5D,
-    0x7A, 0x4E, 0x6F, 0x6C, 0x71, 0x96, 0x1B, 0x19, 0x7A, 0x75, 0x77, 0x14, 0x72, 0x78, 0x16, 0x77,
-    0x9D, 0xFF, 0x9D, 0x9E, 0xB0, 0xFF, 0xA0, 0x2C, 0x9E, 0x91, 0x89, 0x94, 0xB2, 0x92, 0x8C, 0x3F,
-    0xA0, 0xF6, 0xB2, 0x01, 0xA1, 0x88, 0x9E, 0x7F, 0x3E, 0x5B, 0x29, 0x71, 0x5A, 0x80, 0x23, 0x56,
-    0x55, 0x4B, 0x74, 0x7D, 0x71, 0x63, 0x6B, 0x3F, 0x3D, 0x94, 0x34, 0x14, 0x54, 0x6C, 0x7A, 0x18,
-    0x7F, 0x7D, 0x32, 0x92, 0x93, 0xA7, 0x22, 0x08, 0x94, 0x6A, 0x17, 0x6B, 0xA5, 0x1A, 0xAD, 0x3D,
-    0xD9, 0xAB, 0x03, 0x3D, 0x90, 0xE1, 0x39, 0x3D, 0x6B, 0x2A, 0x0B, 0xBE, 0x9A, 0x85, 0x18, 0xC1,
-    0x33, 0xEE, 0x46, 0x40, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x3E, 0xD2, 0x3E, 0x84, 0x35, 0xEE, 0x56, 0x99, 0x3D, 0xE5, 0x56,
-    0x70, 0x2B, 0xD3, 0x73, 0x80, 0x1E, 0xF8, 0x68, 0xA2, 0x2A, 0xEB, 0x62, 0x6F, 0x4C, 0xDA, 0x0F,
-    0x7F, 0x3F, 0xFF, 0x08, 0xA1, 0x4B, 0xF2, 0x26, 0xE0, 0x88, 0x6C, 0x20, 0xE0, 0x73, 0x68, 0x68,
-    0xE1, 0x7B, 0x71, 0x0C, 0xDF, 0x81, 0x62, 0x52, 0xFE, 0x7E, 0x5C, 0x65, 0xFF, 0x85, 0x65, 0x8B,
-    0xFE, 0x93, 0x60, 0x2A, 0xFD, 0x8B, 0x56, 0x48, 0xD4, 0x81, 0x99, 0x20, 0xD5, 0x53, 0x8F, 0x68,
-    0xD7, 0x59, 0x9F, 0x87, 0xD6, 0x70, 0xA4, 0x09, 0xD3, 0x7B, 0x89, 0x4E, 0xD3, 0x64, 0x84, 0x59,
-    0xF8, 0x5F, 0x82, 0x65, 0xF9, 0x65, 0x92, 0x6F, 0xF9, 0x7C, 0x97, 0x0B, 0xF6, 0x8D, 0x8B, 0x29,
-    0xF5, 0x87, 0x7B, 0x1C, 0xF5, 0x70, 0x76, 0x40, 0x51, 0x43, 0x67, 0x58, 0xF1, 0x44, 0x43, 0x70,
-    0x60, 0x19, 0xD1, 0x7A, 0xD9, 0x39, 0x9E, 0x70, 0x50, 0x80, 0x74, 0x1A, 0xEE, 0xD1, 0x61, 0x25,
-    0x5E, 0x56, 0xDE, 0x07, 0xD7, 0x8C, 0xB0, 0x25, 0xE9, 0x6E, 0x29, 0x60, 0xE6, 0xBF, 0x3A, 0x4F,
-    0xFD, 0x5A, 0x36, 0x42, 0xFA, 0xCC, 0x4F, 0x2E, 0x4C, 0x25, 0xC4, 0x68, 0x42, 0x42, 0x7C, 0x58,
-    0x41, 0x6C, 0x85, 0x1A, 0x4B, 0x4F, 0xCD, 0x07, 0x0E, 0x00, 0xDE, 0x7A, 0x00, 0x49, 0x84, 0x94,
-    0x0C, 0x46, 0xEC, 0x15, 0xDF, 0x4A, 0xB5, 0x37, 0x62, 0x30, 0xEB, 0x86, 0xDE, 0x6F, 0xBD, 0x31,
-    0x4D, 0x34, 0xD8, 0x84, 0x0F, 0x1D, 0xF4, 0x05, 0x23, 0x4D, 0x8B, 0x51, 0xBB, 0xBD, 0x4E, 0x1E,
-    0xBD, 0x52, 0x37, 0x60, 0xB2, 0xBA, 0x51, 0x1B, 0xB5, 0x4F, 0x3B, 0x71, 0xA5, 0x6F, 0x0F, 0x78,
-    0xAA, 0xC1, 0x16, 0x49, 0xA3, 0xBC, 0x1F, 0x07, 0xAC, 0x74, 0x06, 0x5E, 0x9D, 0xBB, 0x0D, 0x1C,
-    0x9F, 0x7B, 0x00, 0x5D, 0x7A, 0x55, 0x6F, 0x6C, 0x71, 0x9A, 0x1B, 0x19, 0x79, 0x79, 0x77, 0x14,
-    0x72, 0x7D, 0x15, 0x72, 0x9B, 0xFD, 0x9F, 0x9E, 0xAE, 0xFF, 0xA3, 0x2C, 0x9E, 0x97, 0x89, 0x94,
-    0xB1, 0x99, 0x8D, 0x3F, 0x9E, 0xF5, 0xB4, 0x02, 0xA1, 0x8E, 0x9F, 0x7F, 0x3E, 0x5E, 0x28, 0x71,
-    0x5A, 0x82, 0x22, 0x56, 0x55, 0x4F, 0x73, 0x7D, 0x71, 0x68, 0x6B, 0x3F, 0x3C, 0x93, 0x33, 0x14,
-    0x54, 0x6D, 0x79, 0x18, 0x7F, 0x83, 0x32, 0x92, 0x93, 0xAC, 0x23, 0x08, 0x94, 0x73, 0x17, 0x6B,
-    0x3B, 0x54, 0xAC, 0x3D, 0xBE, 0xC4, 0x0D, 0x3D, 0xAD, 0x28, 0x39, 0x3D, 0xAA, 0x84, 0x83, 0x3E,
-    0xD4, 0x4C, 0x1B, 0xC1, 0x10, 0x0C, 0x62, 0x40, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x30, 0x37, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x46, 0xD2, 0x3E, 0x85, 0x3E, 0xEE, 0x56,
-    0x9A, 0x48, 0xE5, 0x56, 0x70, 0x33, 0xD2, 0x7A, 0x80, 0x28, 0xF8, 0x68, 0xA2, 0x37, 0xEB, 0x62,
-    0x6F, 0x51, 0xD9, 0x0F, 0x7F, 0x46, 0xFF, 0x08, 0xA1, 0x55, 0xF2, 0x26, 0xDF, 0x97, 0x6E, 0x20,
-    0xE0, 0x83, 0x69, 0x69, 0xE1, 0x8A, 0x73, 0x0C, 0xDF, 0x90, 0x64, 0x52, 0xFE, 0x91, 0x5E, 0x65,
-    0xFF, 0x98, 0x68, 0x8B, 0xFE, 0xA4, 0x63, 0x2F, 0xFD, 0x9D, 0x59, 0x48, 0xD4, 0x8E, 0x9B, 0x22,
-    0xD6, 0x64, 0x91, 0x69, 0xD7, 0x69, 0xA1, 0x87, 0xD6, 0x7F, 0xA6, 0x09, 0xD2, 0x88, 0x8A, 0x4E,
-    0xD4, 0x73, 0x85, 0x5D, 0xF8, 0x73, 0x84, 0x65, 0xF9, 0x79, 0x94, 0x38, 0xF8, 0x8E, 0x99, 0x0B,
-    0xF6, 0x9D, 0x8E, 0x2A, 0xF5, 0x98, 0x7D, 0x1C, 0xF6, 0x83, 0x79, 0x40, 0x52, 0x47, 0x65, 0x58,
-    0xF3, 0x5A, 0x44, 0x70, 0x60, 0x21, 0xD0, 0x68, 0xDA, 0x4C, 0xA0, 0x70, 0x4F, 0x7F, 0x73, 0x1A,
-    0xEC, 0xDC, 0x63, 0x25, 0x5E, 0x59, 0xDD, 0x07, 0xD7, 0x98, 0xB2, 0x25, 0xE9, 0x80, 0x2B, 0x60,
-    0xE6, 0xCB, 0x3C, 0x4F, 0xFE, 0x70, 0x38, 0x42, 0xF9, 0xD9, 0x51, 0x2E, 0x4C, 0x2A, 0xC3, 0x68,
-    0x42, 0x44, 0x7A, 0x58, 0x41, 0x6B, 0x83, 0x1A, 0x4A, 0x50, 0xCC, 0x07, 0x0F, 0x00, 0xDB, 0x7A,
-    0x00, 0x43, 0x81, 0x97, 0x0C, 0x40, 0xEA, 0x15, 0xDF, 0x5C, 0xB7, 0x37, 0x62, 0x36, 0xEA, 0x86,
-    0xDE, 0x7E, 0xBF, 0x32, 0x4D, 0x38, 0xD7, 0x84, 0x0F, 0x1B, 0xF2, 0x02, 0x23, 0x4B, 0x89, 0x51,
-    0xBA, 0xC4, 0x4F, 0x1E, 0xBE, 0x61, 0x38, 0x60, 0xB1, 0xC0, 0x53, 0x1B, 0xB6, 0x5D, 0x3B, 0x71,
-    0xA5, 0x7A, 0x0F, 0x77, 0xA9, 0xC6, 0x17, 0x49, 0xA2, 0xC1, 0x1F, 0x18, 0xAC, 0x7F, 0x06, 0x5E,
-    0x9C, 0xBF, 0x0E, 0x1C, 0x9F, 0x85, 0x00, 0x5D, 0x7B, 0x5C, 0x6E, 0x6C, 0x71, 0x9C, 0x1A, 0x19,
-    0x79, 0x7E, 0x76, 0x14, 0x72, 0x81, 0x14, 0x72, 0x98, 0xFB, 0xA0, 0x9E, 0xAB, 0xFF, 0xA4, 0x2C,
-    0x9D, 0x9D, 0x8A, 0x97, 0xB0, 0xA1, 0x8E, 0x3F, 0x9B, 0xF3, 0xB6, 0x02, 0xA0, 0x95, 0x9F, 0x7F,
-    0x3E, 0x5E, 0x26, 0x5B, 0x5A, 0x83, 0x21, 0x56, 0x55, 0x52, 0x71, 0x7D, 0x71, 0x6D, 0x6A, 0x3F,
-    0x3C, 0x8F, 0x31, 0x14, 0x54, 0x6E, 0x78, 0x15, 0x7F, 0x88, 0x31, 0x92, 0x92, 0xB0, 0x23, 0x08,
-    0x95, 0x7C, 0x17, 0x6B, 0xCA, 0xFA, 0xAA, 0x3D, 0xFA, 0x99, 0x19, 0x3D, 0x4A, 0x81, 0x38, 0x3D,
-    0x22, 0xDF, 0x2B, 0x3F, 0xDC, 0xD4, 0x1E, 0xC1, 0xBF, 0x43, 0x88, 0x40, 0x73, 0x74, 0x61, 0x6E,
-    0x64, 0x30, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x4E, 0xD2, 0x3E,
-    0x85, 0x48, 0xEE, 0x56, 0x9A, 0x54, 0xE6, 0x56, 0x71, 0x3B, 0xD1, 0x68, 0x81, 0x34, 0xF8, 0x68,
-    0xA3, 0x45, 0xEC, 0x62, 0x6E, 0x57, 0xD9, 0x0F, 0x7F, 0x4F, 0xFF, 0x08, 0xA0, 0x61, 0xF3, 0x1E,
-    0xDF, 0xA6, 0x70, 0x1F, 0xE0, 0x94, 0x6B, 0x69, 0xE1, 0x9A, 0x75, 0x0C, 0xDF, 0x9F, 0x66, 0x52,
-    0xFE, 0xA4, 0x61, 0x65, 0xFF, 0xAB, 0x6A, 0x8B, 0xFD, 0xB6, 0x65, 0x25, 0xFD, 0xAF, 0x5B, 0x48,
-    0xD3, 0x9C, 0x9C, 0x22, 0xD6, 0x76, 0x93, 0x69, 0xD7, 0x7B, 0xA3, 0x87, 0xD6, 0x8E, 0xA8, 0x09,
-    0xD2, 0x97, 0x8C, 0x4E, 0xD4, 0x84, 0x87, 0x5D, 0xF9, 0x88, 0x86, 0x65, 0xFA, 0x8D, 0x97, 0x38,
-    0xF8, 0xA0, 0x9C, 0x0D, 0xF5, 0xAE, 0x90, 0x2A, 0xF4, 0xA9, 0x80, 0x1C, 0xF6, 0x96, 0x7B, 0x4A,
-    0x53, 0x4A, 0x64, 0x58, 0xF4, 0x70, 0x47, 0x70, 0x61, 0x28, 0xCF, 0x68, 0xDB, 0x60, 0xA2, 0x6F,
-    0x4E, 0x7E, 0x71, 0x1A, 0xEA, 0xE8, 0x65, 0x23, 0x5D, 0x5C, 0xDC, 0x03, 0xD6, 0xA6, 0xB4, 0x23,
-    0xEA, 0x93, 0x2D, 0x60, 0xE4, 0xD7, 0x3E, 0x4F, 0xFF, 0x86, 0x3B, 0x42, 0xF7, 0xE6, 0x54, 0x2E,
-    0x4D, 0x2E, 0xC1, 0x68, 0x43, 0x46, 0x78, 0x58, 0x40, 0x69, 0x81, 0x1A, 0x4A, 0x52, 0xCA, 0x07,
-    0x10, 0x00, 0xD8, 0x7A, 0x00, 0x3C, 0x7E, 0x97, 0x0B, 0x3B, 0xE7, 0x15, 0xE0, 0x6F, 0xB9, 0x39,
-    0x62, 0x3C, 0xE9, 0x86, 0xDD, 0x8F, 0xC1, 0x32, 0x4E, 0x3B, 0xD5, 0x84, 0x0F, 0x19, 0xEF, 0x02,
-    0x23, 0x48, 0x86, 0x51, 0xB8, 0xCB, 0x50, 0x1E, 0xBF, 0x70, 0x39, 0x60, 0xB0, 0xC6, 0x53, 0x14,
-    0xB7, 0x6C, 0x3C, 0x71, 0xA6, 0x84, 0x0F, 0x7A, 0xA7, 0xCB, 0x17, 0x26, 0xA1, 0xC5, 0x20, 0x18,
-    0xAD, 0x8A, 0x07, 0x5E, 0x9B, 0xC3, 0x0E, 0x1D, 0x9F, 0x8D, 0x00, 0x5D, 0x7B, 0x62, 0x6E, 0x6E,
-    0x70, 0x9D, 0x19, 0x19, 0x78, 0x82, 0x76, 0x13, 0x72, 0x84, 0x13, 0x73, 0x95, 0xF9, 0xA1, 0x9E,
-    0xA8, 0xFF, 0xA5, 0x24, 0x9C, 0xA3, 0x8B, 0x97, 0xAF, 0xA9, 0x8F, 0x3F, 0x98, 0xF2, 0xB6, 0x02,
-    0x9F, 0x9C, 0xA0, 0x7F, 0x3F, 0x5D, 0x23, 0x5A, 0x5A, 0x83, 0x1F, 0x56, 0x56, 0x55, 0x70, 0x78,
-    0x71, 0x71, 0x69, 0x3F, 0x3B, 0x8A, 0x2F, 0x14, 0x53, 0x6F, 0x77, 0x11, 0x7F, 0x8C, 0x31, 0x92,
-    0x91, 0xB4, 0x23, 0x08, 0x95, 0x84, 0x17, 0x6C, 0xEE, 0xA0, 0xA9, 0x3D, 0x35, 0x89, 0x25, 0x3D,
-    0x4F, 0x02, 0x38, 0x3D, 0xC4, 0xD0, 0x8B, 0x3F, 0x16, 0x1B, 0x22, 0xC1, 0x77, 0xD7, 0xA1, 0x40,
-    0x73, 0x74, 0x61, 0x6E, 0x64, 0x30, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x55, 0xD2, 0x3E, 0x84, 0x52, 0xEE, 0x56, 0x99, 0x5F, 0xE7, 0x56, 0x71, 0x43, 0xD1, 0x68,
-    0x81, 0x3E, 0xF8, 0x68, 0xA3, 0x53, 0xED, 0x65, 0x6E, 0x5C, 0xD8, 0x0F, 0x7E, 0x57, 0xFF, 0x07,
-    0xA0, 0x6C, 0xF4, 0x1E, 0xDD, 0xB3, 0x72, 0x1F, 0xDF, 0xA3, 0x6D, 0x6D, 0xE0, 0xA9, 0x77, 0x0C,
-    0xDD, 0xAD, 0x68, 0x52, 0xFD, 0xB5, 0x63, 0x44, 0xFD, 0xBC, 0x6D, 0x8B, 0xFB, 0xC6, 0x68, 0x25,
-    0xFB, 0xC0, 0x5E, 0x4F, 0xD2, 0xA9, 0x9E, 0x22, 0xD6, 0x85, 0x94, 0x69, 0xD7, 0x8A, 0xA5, 0x87,
-    0xD5, 0x9C, 0xA9, 0x09, 0xD1, 0xA4, 0x8E, 0x4E, 0xD3, 0x92, 0x89, 0x5D, 0xF8, 0x9B, 0x89, 0x65,
-    0xF9, 0xA0, 0x99, 0x38, 0xF7, 0xB1, 0x9E, 0x0D, 0xF4, 0xBE, 0x93, 0x2A, 0xF3, 0xB9, 0x82, 0x1C,
-    0xF5, 0xA7, 0x7D, 0x40, 0x53, 0x4D, 0x62, 0x58, 0xF5, 0x84, 0x49, 0x70, 0x62, 0x30, 0xCE, 0x68,
-    0xDB, 0x72, 0xA4, 0x6F, 0x4D, 0x7C, 0x6F, 0x1A, 0xE7, 0xF1, 0x67, 0x23, 0x5C, 0x5F, 0xDB, 0x18,
-    0xD4, 0xB2, 0xB6, 0x23, 0xEA, 0xA3, 0x2E, 0x60, 0xE2, 0xE1, 0x40, 0x4F, 0xFF, 0x99, 0x3D, 0x41,
-    0xF4, 0xF2, 0x56, 0x2A, 0x4D, 0x32, 0xC0, 0x68, 0x43, 0x47, 0x76, 0x58, 0x3F, 0x67, 0x7F, 0x9C,
-    0x49, 0x53, 0xC9, 0x18, 0x11, 0x00, 0xD5, 0x7A, 0x00, 0x36, 0x7A, 0x97, 0x0A, 0x36, 0xE4, 0x15,
-    0xDF, 0x81, 0xBB, 0x39, 0x62, 0x42, 0xE8, 0x86, 0xDC, 0x9D, 0xC3, 0x32, 0x4D, 0x3E, 0xD4, 0x89,
-    0x10, 0x17, 0xEC, 0x02, 0x23, 0x45, 0x84, 0x51, 0xB6, 0xD0, 0x51, 0x1E, 0xC0, 0x7D, 0x3A, 0x5F,
-    0xAD, 0xCB, 0x54, 0x19, 0xB7, 0x78, 0x3D, 0x5A, 0xA6, 0x8D, 0x0F, 0x7A, 0xA5, 0xCE, 0x17, 0x26,
-    0x9E, 0xC8, 0x20, 0x18, 0xAC, 0x93, 0x07, 0x5F, 0x99, 0xC6, 0x0E, 0x1D, 0x9F, 0x95, 0x00, 0x5D,
-    0x7B, 0x68, 0x6D, 0x6E, 0x6F, 0x9D, 0x18, 0x19, 0x77, 0x85, 0x75, 0x13, 0x71, 0x87, 0x12, 0x73,
-    0x90, 0xF7, 0xA1, 0x9E, 0xA3, 0xFF, 0xA6, 0x24, 0x9A, 0xA8, 0x8B, 0x97, 0xAD, 0xB0, 0x90, 0x33,
-    0x93, 0xF1, 0xB6, 0x00, 0x9D, 0xA2, 0xA0, 0x7F, 0x3F, 0x5C, 0x21, 0x5A, 0x59, 0x83, 0x1E, 0x56,
-    0x55, 0x57, 0x6F, 0x78, 0x71, 0x75, 0x68, 0x3D, 0x3A, 0x85, 0x2D, 0x14, 0x53, 0x6F, 0x75, 0x15,
-    0x7E, 0x90, 0x30, 0x92, 0x8F, 0xB6, 0x23, 0x07, 0x95, 0x8B, 0x16, 0x6C, 0x5B, 0xB7, 0xA7, 0x3D,
-    0x0B, 0x24, 0x30, 0x3D, 0x05, 0xC0, 0x37, 0x3D, 0x42, 0x26, 0xBE, 0x3F, 0x89, 0x33, 0x24, 0xC1,
-    0x8F, 0x68, 0xB6, 0x40, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x5B, 0xD1, 0x3E, 0x85, 0x59, 0xEE, 0x56, 0x99, 0x67, 0xE7, 0x56,
-    0x71, 0x49, 0xD1, 0x68, 0x82, 0x46, 0xF8, 0x68, 0xA3, 0x5D, 0xED, 0x65, 0x6D, 0x60, 0xD8, 0x0F,
-    0x7E, 0x5D, 0xFF, 0x07, 0x9F, 0x75, 0xF4, 0x1C, 0xDC, 0xBE, 0x73, 0x1F, 0xDF, 0xAF, 0x6E, 0x69,
-    0xDF, 0xB5, 0x78, 0x0C, 0xDC, 0xB8, 0x69, 0x52, 0xFC, 0xC4, 0x64, 0x44, 0xFC, 0xC9, 0x6E, 0x8B,
-    0xFA, 0xD3, 0x69, 0x25, 0xFA, 0xCD, 0x5F, 0x4F, 0xD0, 0xB3, 0x9F, 0x22, 0xD6, 0x92, 0x95, 0x69,
-    0xD6, 0x97, 0xA6, 0x87, 0xD4, 0xA7, 0xAA, 0x09, 0xD0, 0xAE, 0x8E, 0x4E, 0xD2, 0x9E, 0x8A, 0x5D,
-    0xF7, 0xAA, 0x8A, 0x65, 0xF8, 0xAF, 0x9B, 0x38, 0xF6, 0xBF, 0x9F, 0x0D, 0xF2, 0xCB, 0x94, 0x2A,
-    0xF2, 0xC6, 0x84, 0x1C, 0xF4, 0xB5, 0x7F, 0x40, 0x53, 0x4F, 0x62, 0x5D, 0xF5, 0x94, 0x4A, 0x64,
-    0x63, 0x35, 0xCE, 0x68, 0xDC, 0x81, 0xA5, 0x6F, 0x4C, 0x7B, 0x6F, 0x1A, 0xE4, 0xFA, 0x68, 0x23,
-    0x5C, 0x61, 0xDB, 0x18, 0xD2, 0xBC, 0xB6, 0x23, 0xE9, 0xB0, 0x2F, 0x60, 0xE0, 0xEA, 0x41, 0x4F,
-    0xFF, 0xA9, 0x3F, 0x41, 0xF2, 0xFB, 0x57, 0x2A, 0x4E, 0x36, 0xBF, 0x68, 0x43, 0x48, 0x75, 0x58,
-    0x3E, 0x66, 0x7E, 0x9C, 0x49, 0x54, 0xC8, 0x18, 0x12, 0x00, 0xD4, 0x68, 0x00, 0x31, 0x79, 0x97,
-    0x0A, 0x32, 0xE3, 0x15, 0xDF, 0x8F, 0xBC, 0x39, 0x62, 0x47, 0xE8, 0x86, 0xDB, 0xAA, 0xC4, 0x32,
-    0x4E, 0x41, 0xD3, 0x89, 0x10, 0x15, 0xEB, 0x02, 0x23, 0x42, 0x82, 0x51, 0xB3, 0xD5, 0x51, 0x1D,
-    0xC0, 0x88, 0x3B, 0x5F, 0xAB, 0xD0, 0x54, 0x19, 0xB8, 0x83, 0x3D, 0x5A, 0xA5, 0x94, 0x0F, 0x7A,
-    0xA3, 0xD1, 0x17, 0x26, 0x9C, 0xCB, 0x20, 0x18, 0xAC, 0x9A, 0x07, 0x5F, 0x97, 0xC8, 0x0E, 0x1D,
-    0x9E, 0x9A, 0x00, 0x5D, 0x7B, 0x6D, 0x6D, 0x6E, 0x6D, 0x9D, 0x18, 0x19, 0x76, 0x88, 0x75, 0x13,
-    0x71, 0x89, 0x12, 0x73, 0x8C, 0xF6, 0xA1, 0x9D, 0x9F, 0xFF, 0xA6, 0x24, 0x98, 0xAC, 0x8B, 0x97,
-    0xAB, 0xB6, 0x90, 0x3D, 0x8F, 0xF0, 0xB6, 0x00, 0x9B, 0xA7, 0xA1, 0x81, 0x3F, 0x5B, 0x20, 0x5A,
-    0x58, 0x82, 0x1D, 0x56, 0x55, 0x59, 0x6E, 0x78, 0x70, 0x78, 0x68, 0x3D, 0x38, 0x81, 0x2C, 0x14,
-    0x52, 0x6F, 0x74, 0x11, 0x7D, 0x92, 0x30, 0x7B, 0x8E, 0xB9, 0x22, 0x07, 0x94, 0x90, 0x16, 0x6C,
-    0x04, 0xAC, 0xA5, 0x3D, 0xB9, 0x76, 0x3A, 0x3D, 0x58, 0xC9, 0x37, 0x3D, 0x02, 0x67, 0xE6, 0x3F,
-    0xE6, 0x52, 0x24, 0xC1, 0x3A, 0xA4, 0xBE, 0x40, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x31, 0x31, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x5E, 0xD1, 0x3E, 0x85, 0x5D, 0xEE, 0x56,
-    0x9A, 0x6D, 0xE7, 0x56, 0x72, 0x4D, 0xD1, 0x68, 0x83, 0x4B, 0xF8, 0x68, 0xA4, 0x64, 0xED, 0x65,
-    0x6E, 0x62, 0xD8, 0x90, 0x7E, 0x61, 0xFF, 0x07, 0x9F, 0x79, 0xF4, 0x1E, 0xDB, 0xC4, 0x73, 0x1B,
-    0xDE, 0xB5, 0x6E, 0x70, 0xDE, 0xBB, 0x78, 0x0C, 0xDC, 0xBE, 0x69, 0x52, 0xFC, 0xCB, 0x64, 0x44,
-    0xFC, 0xD1, 0x6E, 0x3B, 0xF9, 0xDA, 0x69, 0x25, 0xF9, 0xD4, 0x5F, 0x4F, 0xD0, 0xB8, 0x9F, 0x22,
-    0xD6, 0x9A, 0x95, 0x69, 0xD6, 0x9E, 0xA5, 0x87, 0xD3, 0xAE, 0xAA, 0x09, 0xCF, 0xB4, 0x8E, 0x4E,
-    0xD2, 0xA4, 0x8A, 0x5D, 0xF7, 0xB3, 0x8A, 0x44, 0xF8, 0xB7, 0x9A, 0x38, 0xF5, 0xC7, 0x9F, 0x0D,
-    0xF1, 0xD1, 0x94, 0x2A, 0xF1, 0xCD, 0x83, 0x1C, 0xF4, 0xBD, 0x7F, 0x40, 0x53, 0x50, 0x62, 0x5D,
-    0xF5, 0x9E, 0x4A, 0x64, 0x64, 0x39, 0xCE, 0x6D, 0xDC, 0x8A, 0xA5, 0x6F, 0x4B, 0x79, 0x6F, 0x19,
-    0xE2, 0xFC, 0x68, 0x23, 0x5C, 0x61, 0xDB, 0x18, 0xD1, 0xC1, 0xB6, 0x23, 0xE9, 0xB7, 0x2F, 0x60,
-    0xDE, 0xED, 0x41, 0x4F, 0xFF, 0xB3, 0x3F, 0x41, 0xF0, 0xFF, 0x57, 0x2A, 0x4F, 0x37, 0xBF, 0x69,
-    0x43, 0x48, 0x75, 0x58, 0x3E, 0x63, 0x7E, 0x9C, 0x49, 0x54, 0xC8, 0x18, 0x14, 0x00, 0xD4, 0x68,
-    0x00, 0x2C, 0x79, 0x97, 0x0A, 0x2E, 0xE3, 0x15, 0xDF, 0x97, 0xBC, 0x39, 0x63, 0x49, 0xE8, 0x86,
-    0xDA, 0xB0, 0xC4, 0x32, 0x4E, 0x42, 0xD3, 0x89, 0x11, 0x14, 0xEB, 0x02, 0x23, 0x40, 0x82, 0x51,
-    0xB1, 0xD6, 0x51, 0x1D, 0xC0, 0x8F, 0x3A, 0x5F, 0xA9, 0xD0, 0x54, 0x12, 0xB8, 0x89, 0x3D, 0x5A,
-    0xA5, 0x97, 0x0F, 0x7A, 0xA1, 0xD1, 0x17, 0x26, 0x9A, 0xCA, 0x20, 0x18, 0xAB, 0x9E, 0x07, 0x5F,
-    0x95, 0xC7, 0x0E, 0x1D, 0x9E, 0x9D, 0x00, 0x5D, 0x7B, 0x6F, 0x6D, 0x6E, 0x6C, 0x9B, 0x18, 0x12,
-    0x76, 0x88, 0x75, 0x13, 0x70, 0x88, 0x12, 0x73, 0x89, 0xF1, 0xA1, 0x9D, 0x9C, 0xFC, 0xA6, 0x24,
-    0x97, 0xAD, 0x8B, 0x97, 0xAA, 0xB8, 0x90, 0x3D, 0x8C, 0xED, 0xB6, 0x00, 0x9A, 0xA9, 0xA1, 0x81,
-    0x3E, 0x59, 0x20, 0x5A, 0x57, 0x80, 0x1D, 0x56, 0x55, 0x59, 0x6E, 0x78, 0x70, 0x79, 0x68, 0x3D,
-    0x37, 0x7D, 0x2C, 0x12, 0x51, 0x6E, 0x74, 0x10, 0x7C, 0x93, 0x30, 0x7B, 0x8C, 0xB8, 0x22, 0x07,
-    0x94, 0x92, 0x16, 0x6C, 0x55, 0x96, 0xA3, 0x3D, 0x22, 0x4E, 0x44, 0x3D, 0xB0, 0x3E, 0x38, 0x3D,
-    0xC6, 0x28, 0x02, 0x40, 0x34, 0x72, 0x21, 0xC1, 0x06, 0xA8, 0xB4, 0x40, 0x73, 0x74, 0x61, 0x6E,
-    0x64, 0x31, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x5F, 0xD2, 0x4B,
-    0x87, 0x5F, 0xEE, 0x56, 0x9B, 0x6F, 0xE6, 0x56, 0x73, 0x4E, 0xD1, 0x68, 0x85, 0x4E, 0xF8, 0x68,
-    0xA5, 0x67, 0xED, 0x65, 0x6F, 0x63, 0xD8, 0x90, 0x80, 0x62, 0xFF, 0x07, 0xA1, 0x7B, 0xF4, 0x1E,
-    0xDB, 0xC5, 0x71, 0x1B, 0xDE, 0xB8, 0x6C, 0x70, 0xDE, 0xBD, 0x76, 0x0C, 0xDB, 0xC0, 0x67, 0x52,
-    0xFC, 0xCF, 0x62, 0x44, 0xFB, 0xD4, 0x6C, 0x3B, 0xF8, 0xDC, 0x67, 0x25, 0xF9, 0xD7, 0x5D, 0x4F,
-    0xD0, 0xBA, 0x9D, 0x22, 0xD6, 0x9D, 0x93, 0x69, 0xD7, 0xA2, 0xA4, 0x87, 0xD4, 0xB0, 0xA9, 0x09,
-    0xCF, 0xB6, 0x8D, 0x4E, 0xD3, 0xA7, 0x88, 0x5D, 0xF8, 0xB7, 0x88, 0x44, 0xF8, 0xBB, 0x98, 0x38,
-    0xF5, 0xCA, 0x9D, 0x0D, 0xF1, 0xD3, 0x92, 0x2C, 0xF1, 0xCF, 0x81, 0x1C, 0xF4, 0xC1, 0x7C, 0x4A,
-    0x54, 0x50, 0x63, 0x5D, 0xF6, 0xA3, 0x48, 0x64, 0x65, 0x3B, 0xCF, 0x6D, 0xDD, 0x8E, 0xA3, 0x6F,
-    0x4B, 0x76, 0x70, 0x19, 0xE1, 0xFC, 0x66, 0x23, 0x5C, 0x61, 0xDC, 0x18, 0xD1, 0xC2, 0xB5, 0x23,
-    0xE8, 0xBA, 0x2E, 0x60, 0xDC, 0xED, 0x3F, 0x4F, 0xFF, 0xB8, 0x3C, 0x41, 0xEE, 0xFF, 0x55, 0x2A,
-    0x50, 0x38, 0xC1, 0x69, 0x44, 0x47, 0x77, 0x58, 0x3E, 0x61, 0x80, 0x9C, 0x4A, 0x52, 0xCA, 0x18,
-    0x15, 0x00, 0xD7, 0x68, 0x00, 0x29, 0x7C, 0x97, 0x0B, 0x2B, 0xE6, 0x15, 0xE0, 0x9C, 0xBA, 0x39,
-    0x64, 0x4A, 0xE9, 0x86, 0xDB, 0xB3, 0xC2, 0x32, 0x4F, 0x42, 0xD5, 0x89, 0x13, 0x13, 0xEE, 0x05,
-    0x23, 0x3E, 0x85, 0x51, 0xB0, 0xD5, 0x51, 0x1F, 0xC0, 0x92, 0x3A, 0x5F, 0xA8, 0xCE, 0x54, 0x12,
-    0xB8, 0x8B, 0x3C, 0x5A, 0xA4, 0x98, 0x0F, 0x7A, 0x9F, 0xCF, 0x17, 0x26, 0x99, 0xC8, 0x20, 0x18,
-    0xAA, 0x9F, 0x07, 0x5F, 0x93, 0xC5, 0x0E, 0x1D, 0x9C, 0x9D, 0x00, 0x5D, 0x7B, 0x70, 0x6D, 0x6E,
-    0x6A, 0x99, 0x19, 0x12, 0x75, 0x87, 0x75, 0x13, 0x6F, 0x87, 0x13, 0x73, 0x87, 0xEC, 0xA1, 0x9D,
-    0x9A, 0xF7, 0xA6, 0x24, 0x96, 0xAC, 0x8B, 0x97, 0xA9, 0xB7, 0x8F, 0x3D, 0x8B, 0xE8, 0xB6, 0x02,
-    0x9A, 0xA8, 0xA0, 0x81, 0x3E, 0x58, 0x22, 0x5A, 0x56, 0x7E, 0x1E, 0x56, 0x56, 0x59, 0x6F, 0x78,
-    0x6F, 0x78, 0x69, 0x3D, 0x36, 0x79, 0x2E, 0x13, 0x51, 0x6C, 0x76, 0x10, 0x7B, 0x91, 0x31, 0x7B,
-    0x8A, 0xB6, 0x23, 0x07, 0x93, 0x92, 0x16, 0x6E, 0x50, 0x55, 0xA1, 0x3D, 0x93, 0x6A, 0x4C, 0x3D,
-    0x61, 0xFF, 0x38, 0x3D, 0xB8, 0x85, 0x0D, 0x40, 0x70, 0x29, 0x1C, 0xC1, 0x2C, 0x6A, 0x9D, 0x40,
-    0x73, 0x74, 0x61, 0x6E, 0x64, 0x31, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x60, 0xD2, 0x4B, 0x89, 0x61, 0xED, 0x53, 0x9D, 0x71, 0xE5, 0x56, 0x75, 0x50, 0xD2, 0x68,
-    0x87, 0x50, 0xF8, 0x68, 0xA8, 0x6A, 0xEB, 0x65, 0x70, 0x63, 0xD9, 0x90, 0x82, 0x63, 0xFF, 0x07,
-    0xA3, 0x7D, 0xF2, 0x1E, 0xDB, 0xC7, 0x6E, 0x1B, 0xDE, 0xBA, 0x69, 0x70, 0xDE, 0xBF, 0x73, 0x0C,
-    0xDB, 0xC2, 0x64, 0x52, 0xFC, 0xD1, 0x5E, 0x44, 0xFB, 0xD6, 0x67, 0x3B, 0xF8, 0xDE, 0x62, 0x25,
-    0xF9, 0xD9, 0x59, 0x4F, 0xD0, 0xBB, 0x9B, 0x22, 0xD8, 0xA0, 0x90, 0x70, 0xD8, 0xA4, 0xA1, 0x87,
-    0xD5, 0xB2, 0xA6, 0x09, 0xD0, 0xB7, 0x8A, 0x4E, 0xD3, 0xA9, 0x85, 0x5D, 0xF9, 0xBA, 0x83, 0x44,
-    0xFA, 0xBF, 0x94, 0x39, 0xF6, 0xCC, 0x99, 0x0D, 0xF2, 0xD5, 0x8E, 0x2C, 0xF1, 0xD1, 0x7D, 0x1C,
-    0xF4, 0xC4, 0x78, 0x4A, 0x54, 0x50, 0x65, 0x5D, 0xF6, 0xA7, 0x44, 0x64, 0x67, 0x3C, 0xD0, 0x6D,
-    0xDF, 0x92, 0x9F, 0x6F, 0x4A, 0x74, 0x73, 0x19, 0xE0, 0xFB, 0x63, 0x23, 0x5E, 0x60, 0xDD, 0x03,
-    0xD2, 0xC3, 0xB2, 0x23, 0xE8, 0xBD, 0x2A, 0x60, 0xDB, 0xED, 0x3C, 0x4F, 0xFF, 0xBB, 0x38, 0x41,
-    0xED, 0xFF, 0x51, 0x2A, 0x52, 0x39, 0xC3, 0x69, 0x44, 0x46, 0x7A, 0x58, 0x3D, 0x5F, 0x83, 0x9C,
-    0x4B, 0x52, 0xCC, 0x18, 0x18, 0x00, 0xDB, 0x68, 0x00, 0x26, 0x82, 0x97, 0x0D, 0x29, 0xEA, 0x10,
-    0xE2, 0x9F, 0xB7, 0x39, 0x66, 0x4B, 0xEA, 0x86, 0xDC, 0xB5, 0xBF, 0x32, 0x51, 0x42, 0xD7, 0x89,
-    0x15, 0x12, 0xF2, 0x05, 0x23, 0x3C, 0x89, 0x51, 0xAF, 0xD3, 0x50, 0x1D, 0xC0, 0x94, 0x38, 0x5F,
-    0xA7, 0xCD, 0x53, 0x12, 0xB8, 0x8D, 0x3B, 0x5A, 0xA3, 0x99, 0x0F, 0x7A, 0x9D, 0xCD, 0x17, 0x26,
-    0x97, 0xC6, 0x20, 0x18, 0xA9, 0xA0, 0x06, 0x5F, 0x91, 0xC3, 0x0E, 0x9E, 0x9B, 0x9D, 0x00, 0x5D,
-    0x7B, 0x70, 0x6E, 0x6E, 0x69, 0x97, 0x1B, 0x12, 0x75, 0x86, 0x76, 0x13, 0x6D, 0x86, 0x14, 0x73,
-    0x86, 0xE8, 0xA1, 0x9D, 0x99, 0xF4, 0xA5, 0x24, 0x96, 0xAB, 0x8A, 0x97, 0xA9, 0xB7, 0x8E, 0x3D,
-    0x8A, 0xE4, 0xB6, 0x02, 0x9A, 0xA8, 0xA0, 0x81, 0x3C, 0x56, 0x26, 0x5A, 0x54, 0x7C, 0x21, 0x56,
-    0x56, 0x58, 0x72, 0x78, 0x6F, 0x77, 0x6A, 0x3D, 0x34, 0x76, 0x32, 0x13, 0x51, 0x6A, 0x78, 0x10,
-    0x7A, 0x90, 0x32, 0x7B, 0x88, 0xB4, 0x23, 0x07, 0x91, 0x93, 0x17, 0x6E, 0x37, 0x31, 0x9F, 0x3D,
-    0xE3, 0x5F, 0x52, 0x3D, 0xB5, 0xBE, 0x39, 0x3D, 0x48, 0xE2, 0x13, 0x40, 0x3D, 0x3D, 0x16, 0xC1,
-    0xD3, 0xDA, 0x81, 0x40, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x31, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x61, 0xD3, 0x4B, 0x8B, 0x62, 0xED, 0x53, 0xA0, 0x72, 0xE4, 0x53,
-    0x78, 0x51, 0xD3, 0x68, 0x8A, 0x52, 0xF8, 0x6D, 0xAB, 0x6C, 0xE9, 0x65, 0x72, 0x63, 0xDA, 0x90,
-    0x85, 0x64, 0xFF, 0x07, 0xA5, 0x7E, 0xF1, 0x1D, 0xDB, 0xC8, 0x6A, 0x1B, 0xDF, 0xBC, 0x66, 0x70,
-    0xDE, 0xC0, 0x6F, 0x0C, 0xDB, 0xC3, 0x61, 0x59, 0xFC, 0xD3, 0x59, 0x44, 0xFC, 0xD8, 0x63, 0x3B,
-    0xF8, 0xDF, 0x5E, 0x25, 0xF9, 0xDA, 0x54, 0x4F, 0xD1, 0xBC, 0x97, 0x1B, 0xD9, 0xA2, 0x8D, 0x70,
-    0xDA, 0xA6, 0x9D, 0x87, 0xD6, 0xB3, 0xA2, 0x09, 0xD0, 0xB8, 0x87, 0x4E, 0xD4, 0xAB, 0x82, 0x5D,
-    0xFA, 0xBD, 0x7F, 0x44, 0xFB, 0xC1, 0x8F, 0x39, 0xF7, 0xCE, 0x94, 0x0D, 0xF2, 0xD7, 0x89, 0x2C,
-    0xF1, 0xD3, 0x79, 0x1D, 0xF5, 0xC6, 0x74, 0x4A, 0x54, 0x4F, 0x68, 0x5D, 0xF6, 0xAA, 0x3F, 0x64,
-    0x6A, 0x3D, 0xD1, 0x6D, 0xE1, 0x95, 0x9C, 0x6F, 0x4A, 0x72, 0x76, 0x19, 0xDF, 0xFB, 0x60, 0x23,
-    0x60, 0x60, 0xDF, 0x03, 0xD3, 0xC4, 0xAF, 0x23, 0xE7, 0xBF, 0x27, 0x60, 0xDA, 0xED, 0x39, 0x4E,
-    0xFF, 0xBE, 0x33, 0x41, 0xEC, 0xFF, 0x4D, 0x2A, 0x53, 0x39, 0xC5, 0x69, 0x44, 0x46, 0x7D, 0x58,
-    0x3D, 0x5D, 0x87, 0x9C, 0x4C, 0x51, 0xCF, 0x18, 0x1A, 0x00, 0xE0, 0x68, 0x00, 0x25, 0x88, 0x96,
-    0x0E, 0x28, 0xF0, 0x10, 0xE4, 0xA1, 0xB3, 0x34, 0x69, 0x4B, 0xEB, 0x86, 0xDE, 0xB7, 0xBB, 0x32,
-    0x53, 0x42, 0xD9, 0x89, 0x17, 0x11, 0xF7, 0x05, 0x24, 0x3A, 0x8E, 0x51, 0xAE, 0xD2, 0x4E, 0x1D,
-    0xBF, 0x95, 0x36, 0x5F, 0xA6, 0xCC, 0x52, 0x12, 0xB7, 0x8F, 0x39, 0x5A, 0xA1, 0x99, 0x0E, 0x7A,
-    0x9B, 0xCC, 0x17, 0x26, 0x95, 0xC5, 0x20, 0x18, 0xA8, 0xA0, 0x05, 0x5F, 0x8F, 0xC1, 0x0E, 0x9E,
-    0x99, 0x9D, 0x00, 0x5D, 0x7B, 0x70, 0x6F, 0x6E, 0x67, 0x95, 0x1D, 0x12, 0x75, 0x85, 0x78, 0x13,
-    0x6B, 0x85, 0x16, 0x73, 0x85, 0xE5, 0xA1, 0x9D, 0x99, 0xF1, 0xA4, 0x24, 0x96, 0xAB, 0x8A, 0x96,
-    0xAA, 0xB7, 0x8D, 0x3D, 0x8A, 0xE2, 0xB6, 0x02, 0x9B, 0xA7, 0x9F, 0x81, 0x3B, 0x55, 0x2A, 0x5A,
-    0x53, 0x7A, 0x24, 0x56, 0x56, 0x58, 0x74, 0x78, 0x6F, 0x77, 0x6C, 0x3D, 0x32, 0x73, 0x36, 0x13,
-    0x51, 0x69, 0x7B, 0x10, 0x79, 0x8F, 0x33, 0x7B, 0x87, 0xB3, 0x24, 0x07, 0x90, 0x92, 0x17, 0x6E,
-    0x44, 0x89, 0x9D, 0x3D, 0x40, 0xD3, 0x55, 0x3D, 0x12, 0x4E, 0x3A, 0x3D, 0xBA, 0x80, 0x13, 0x40,
-    0xB0, 0x7A, 0x11, 0xC1, 0x10, 0x94, 0x55, 0x40, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x31, 0x35, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x61, 0xD3, 0x4B, 0x8E, 0x62, 0xED, 0x53,
-    0xA2, 0x73, 0xE3, 0x53, 0x79, 0x51, 0xD3, 0x68, 0x8D, 0x52, 0xF7, 0x69, 0xAD, 0x6D, 0xE8, 0x65,
-    0x74, 0x63, 0xDB, 0x7E, 0x87, 0x65, 0xFF, 0x07, 0xA8, 0x7F, 0xF0, 0x1D, 0xDB, 0xC8, 0x67, 0x1B,
-    0xDF, 0xBC, 0x62, 0x70, 0xDF, 0xC1, 0x6C, 0x0E, 0xDC, 0xC4, 0x5E, 0x52, 0xFC, 0xD4, 0x54, 0x44,
-    0xFC, 0xD9, 0x5E, 0x3A, 0xF9, 0xE0, 0x59, 0x25, 0xF9, 0xDB, 0x50, 0x4F, 0xD2, 0xBD, 0x95, 0x1B,
-    0xDA, 0xA3, 0x8A, 0x70, 0xDB, 0xA7, 0x9A, 0x8B, 0xD7, 0xB4, 0x9F, 0x09, 0xD1, 0xB9, 0x85, 0x9D,
-    0xD5, 0xAC, 0x7F, 0x5D, 0xFB, 0xBE, 0x7A, 0x44, 0xFC, 0xC2, 0x8A, 0x39, 0xF8, 0xCF, 0x90, 0x0D,
-    0xF3, 0xD8, 0x85, 0x2C, 0xF2, 0xD3, 0x75, 0x1D, 0xF6, 0xC7, 0x6F, 0x4A, 0x54, 0x4F, 0x6B, 0x5D,
-    0xF7, 0xAC, 0x3B, 0x64, 0x6C, 0x3E, 0xD3, 0x6D, 0xE2, 0x96, 0x98, 0x36, 0x49, 0x71, 0x79, 0x19,
-    0xDF, 0xFB, 0x5D, 0x23, 0x61, 0x60, 0xE1, 0x03, 0xD4, 0xC5, 0xAC, 0x23, 0xE7, 0xBF, 0x23, 0x60,
-    0xD9, 0xEC, 0x36, 0x4E, 0xFF, 0xBF, 0x2F, 0x41, 0xEC, 0xFF, 0x4A, 0x2A, 0x55, 0x39, 0xC7, 0x69,
-    0x45, 0x45, 0x81, 0x5B, 0x3E, 0x5D, 0x8A, 0x9C, 0x4E, 0x51, 0xD1, 0x18, 0x1C, 0x00, 0xE5, 0x68,
-    0x00, 0x23, 0x8E, 0x96, 0x10, 0x27, 0xF5, 0x10, 0xE6, 0xA3, 0xAF, 0x34, 0x6B, 0x4C, 0xED, 0x86,
-    0xE0, 0xB7, 0xB8, 0x32, 0x55, 0x43, 0xDB, 0x89, 0x19, 0x11, 0xFC, 0x05, 0x24, 0x3A, 0x92, 0x51,
-    0xAD, 0xD2, 0x4D, 0x1F, 0xBF, 0x96, 0x34, 0x60, 0xA5, 0xCB, 0x51, 0x12, 0xB7, 0x90, 0x38, 0x5A,
-    0xA0, 0x99, 0x0E, 0x7A, 0x99, 0xCB, 0x17, 0x26, 0x93, 0xC4, 0x20, 0x11, 0xA6, 0xA0, 0x05, 0x5F,
-    0x8D, 0xC0, 0x0F, 0x9E, 0x98, 0x9D, 0x00, 0x5D, 0x7B, 0x70, 0x70, 0x6E, 0x65, 0x94, 0x1F, 0x12,
-    0x75, 0x85, 0x79, 0x13, 0x6A, 0x84, 0x18, 0x73, 0x85, 0xE4, 0xA2, 0x9D, 0x99, 0xF0, 0xA4, 0x24,
-    0x97, 0xAB, 0x8A, 0x96, 0xAA, 0xB7, 0x8C, 0x3D, 0x8A, 0xE0, 0xB6, 0x02, 0x9C, 0xA7, 0x9E, 0x81,
-    0x3A, 0x54, 0x2E, 0x5A, 0x51, 0x79, 0x27, 0x56, 0x56, 0x58, 0x77, 0x78, 0x6F, 0x77, 0x6D, 0x3D,
-    0x31, 0x72, 0x3A, 0x13, 0x51, 0x69, 0x7E, 0x10, 0x78, 0x8F, 0x34, 0x7B, 0x85, 0xB2, 0x25, 0x07,
-    0x8F, 0x92, 0x17, 0x6E, 0xC3, 0xCE, 0x9C, 0x3D, 0x34, 0x6E, 0x56, 0x3D, 0xAB, 0x9C, 0x3A, 0x3D,
-    0xF0, 0x5E, 0x0A, 0x40, 0x7D, 0xB0, 0x0F, 0xC1, 0x84, 0xCB, 0x41, 0x40, 0x73, 0x74, 0x61, 0x6E,
-    0x64, 0x31, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x61, 0xD3, 0x4B,
-    0x8F, 0x63, 0xED, 0x53, 0xA3, 0x73, 0xE3, 0x53, 0x7A, 0x51, 0xD4, 0x68, 0x8E, 0x53, 0xF7, 0x6D,
-    0xAF, 0x6D, 0xE7, 0x65, 0x75, 0x63, 0xDC, 0x0F, 0x89, 0x65, 0xFF, 0x07, 0xA9, 0x7F, 0xEF, 0x1D,
-    0xDC, 0xC8, 0x65, 0x1B, 0xDF, 0xBD, 0x60, 0x70, 0xDF, 0xC1, 0x6A, 0x0C, 0xDC, 0xC4, 0x5C, 0x52,
-    0xFC, 0xD4, 0x52, 0x44, 0xFC, 0xD9, 0x5B, 0x3A, 0xF9, 0xE0, 0x57, 0x25, 0xF9, 0xDB, 0x4D, 0x4F,
-    0xD3, 0xBD, 0x93, 0x1B, 0xDB, 0xA4, 0x88, 0x70, 0xDC, 0xA8, 0x98, 0x8B, 0xD8, 0xB4, 0x9D, 0x09,
-    0xD2, 0xB9, 0x83, 0x9D, 0xD6, 0xAC, 0x7D, 0x5D, 0xFC, 0xBE, 0x77, 0x44, 0xFD, 0xC2, 0x87, 0x39,
-    0xF9, 0xCF, 0x8D, 0x0D, 0xF4, 0xD8, 0x82, 0x2C, 0xF3, 0xD4, 0x72, 0x1D, 0xF6, 0xC7, 0x6D, 0x4A,
-    0x54, 0x4F, 0x6C, 0x5D, 0xF7, 0xAC, 0x39, 0x64, 0x6D, 0x3E, 0xD3, 0x6D, 0xE3, 0x97, 0x96, 0x36,
-    0x49, 0x71, 0x7B, 0x19, 0xDF, 0xFB, 0x5A, 0x23, 0x62, 0x60, 0xE2, 0x03, 0xD5, 0xC5, 0xAA, 0x23,
-    0xE7, 0xC0, 0x21, 0x60, 0xD9, 0xEC, 0x34, 0x4E, 0xFF, 0xC0, 0x2C, 0x41, 0xEC, 0xFF, 0x47, 0x2A,
-    0x56, 0x39, 0xC9, 0x69, 0x45, 0x45, 0x83, 0x58, 0x3E, 0x5C, 0x8D, 0x9C, 0x4F, 0x51, 0xD3, 0x18,
-    0x1D, 0x00, 0xE7, 0x68, 0x00, 0x23, 0x92, 0x96, 0x11, 0x27, 0xF8, 0x10, 0xE7, 0xA3, 0xAC, 0x34,
-    0x6C, 0x4C, 0xED, 0x86, 0xE1, 0xB8, 0xB5, 0x32, 0x56, 0x43, 0xDD, 0x89, 0x1A, 0x11, 0xFF, 0x05,
-    0x24, 0x39, 0x95, 0x51, 0xAD, 0xD2, 0x4D, 0x1F, 0xBF, 0x96, 0x33, 0x60, 0xA5, 0xCB, 0x51, 0x12,
-    0xB7, 0x90, 0x37, 0x5A, 0xA0, 0x99, 0x0E, 0x7A, 0x99, 0xCB, 0x17, 0x26, 0x93, 0xC4, 0x20, 0x11,
-    0xA6, 0xA0, 0x04, 0x5F, 0x8C, 0xC0, 0x0F, 0x9E, 0x97, 0x9D, 0x00, 0x5D, 0x7B, 0x70, 0x71, 0x6E,
-    0x64, 0x94, 0x20, 0x12, 0x75, 0x85, 0x7A, 0x13, 0x69, 0x84, 0x19, 0x73, 0x86, 0xE3, 0xA2, 0x9D,
-    0x99, 0xEF, 0xA4, 0x24, 0x97, 0xAA, 0x89, 0x96, 0xAB, 0xB7, 0x8B, 0x3D, 0x8B, 0xE0, 0xB6, 0x02,
-    0x9C, 0xA7, 0x9E, 0x81, 0x39, 0x54, 0x30, 0x5A, 0x50, 0x79, 0x29, 0x56, 0x56, 0x58, 0x78, 0x78,
-    0x6F, 0x77, 0x6E, 0x4C, 0x30, 0x71, 0x3D, 0x13, 0x51, 0x69, 0x7F, 0x11, 0x77, 0x8F, 0x35, 0x7B,
-    0x85, 0xB2, 0x25, 0x07, 0x8E, 0x92, 0x18, 0x6E, 0x26, 0x4F, 0x9D, 0x3D, 0x32, 0xBA, 0x53, 0x3D,
-    0xE8, 0xFF, 0x3A, 0x3D, 0x82, 0x51, 0xEB, 0x3F, 0xCC, 0xDE, 0x11, 0xC1, 0x61, 0x3B, 0x4F, 0x40,
-    0x73, 0x74, 0x61, 0x6E, 0x64, 0x31, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x81, 0x61, 0xD3, 0x4B, 0x8F, 0x62, 0xEC, 0x53, 0xA4, 0x72, 0xE2, 0x53, 0x7B, 0x51, 0xD4, 0x68,
-    0x8F, 0x52, 0xF7, 0x69, 0xAF, 0x6C, 0xE6, 0x65, 0x75, 0x63, 0xDC, 0x7E, 0x89, 0x64, 0xFF, 0x07,
-    0xAA, 0x7E, 0xEE, 0x1D, 0xDC, 0xC8, 0x65, 0x1B, 0xE0, 0xBC, 0x5F, 0x70, 0xE0, 0xC1, 0x69, 0x0C,
-    0xDC, 0xC3, 0x5B, 0x52, 0xFD, 0xD3, 0x51, 0x42, 0xFD, 0xD8, 0x5A, 0x3A, 0xF9, 0xE0, 0x56, 0x25,
-    0xF9, 0xDB, 0x4C, 0x4F, 0xD3, 0xBC, 0x92, 0x1B, 0xDB, 0xA3, 0x87, 0x70, 0xDC, 0xA7, 0x97, 0x8B,
-    0xD8, 0xB4, 0x9C, 0x09, 0xD2, 0xB8, 0x82, 0x9D, 0xD6, 0xAB, 0x7D, 0x5D, 0xFC, 0xBD, 0x76, 0x44,
-    0xFD, 0xC1, 0x86, 0x39, 0xF9, 0xCE, 0x8C, 0x0D, 0xF4, 0xD7, 0x81, 0x2C, 0xF3, 0xD3, 0x71, 0x1D,
-    0xF7, 0xC6, 0x6C, 0x4A, 0x54, 0x4F, 0x6D, 0x5D, 0xF7, 0xAB, 0x38, 0x64, 0x6D, 0x3D, 0xD3, 0x6D,
-    0xE3, 0x96, 0x95, 0x36, 0x4A, 0x72, 0x7B, 0x19, 0xE0, 0xFB, 0x5A, 0x23, 0x63, 0x60, 0xE2, 0x03,
-    0xD6, 0xC4, 0xA9, 0x23, 0xE7, 0xBF, 0x20, 0x60, 0xD9, 0xEC, 0x34, 0x4E, 0xFF, 0xBE, 0x2B, 0x41,
-    0xEC, 0xFF, 0x46, 0x2A, 0x56, 0x39, 0xC9, 0x69, 0x45, 0x46, 0x83, 0x58, 0x3E, 0x5D, 0x8D, 0x9C,
-    0x4F, 0x51, 0xD3, 0x18, 0x1D, 0x00, 0xE8, 0x68, 0x00, 0x24, 0x93, 0x96, 0x11, 0x27, 0xF9, 0x10,
-    0xE7, 0xA2, 0xAB, 0x34, 0x6C, 0x4B, 0xED, 0x86, 0xE1, 0xB7, 0xB4, 0x32, 0x56, 0x43, 0xDD, 0x89,
-    0x1A, 0x11, 0xFF, 0x05, 0x24, 0x3A, 0x96, 0x51, 0xAD, 0xD2, 0x4C, 0x1D, 0xBF, 0x96, 0x33, 0x55,
-    0xA5, 0xCC, 0x50, 0x12, 0xB7, 0x8F, 0x37, 0x5A, 0xA0, 0x99, 0x0D, 0x7A, 0x99, 0xCB, 0x17, 0x26,
-    0x93, 0xC5, 0x20, 0x18, 0xA6, 0xA0, 0x04, 0x5F, 0x8C, 0xC1, 0x0F, 0x9E, 0x97, 0x9D, 0x00, 0x5D,
-    0x7B, 0x70, 0x71, 0x6E, 0x65, 0x95, 0x21, 0x12, 0x75, 0x85, 0x7A, 0x13, 0x69, 0x85, 0x1A, 0x73,
-    0x87, 0xE5, 0xA2, 0x9D, 0x9A, 0xF0, 0xA3, 0x24, 0x98, 0xAB, 0x89, 0x96, 0xAB, 0xB7, 0x8B, 0x3D,
-    0x8C, 0xE1, 0xB6, 0x02, 0x9D, 0xA7, 0x9E, 0x84, 0x39, 0x54, 0x31, 0x5A, 0x50, 0x7A, 0x29, 0x56,
-    0x56, 0x58, 0x78, 0x78, 0x6F, 0x77, 0x6E, 0x3D, 0x30, 0x73, 0x3E, 0x13, 0x51, 0x69, 0x80, 0x11,
-    0x77, 0x8F, 0x35, 0x7B, 0x85, 0xB2, 0x25, 0x07, 0x8E, 0x92, 0x18, 0x6E, 0x87, 0xC5, 0x9E, 0x3D,
-    0x7D, 0xF0, 0x4D, 0x3D, 0x73, 0xB8, 0x3A, 0x3D, 0xC6, 0x38, 0xAD, 0x3F, 0x9A, 0xD0, 0x16, 0xC1,
-    0x25, 0x2E, 0x72, 0x40, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x31, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0xD3, 0x4B, 0x8F, 0x61, 0xED, 0x53, 0xA3, 0x71, 0xE2, 0x53,
-    0x7A, 0x50, 0xD4, 0x68, 0x8E, 0x50, 0xF7, 0x68, 0xAE, 0x6A, 0xE7, 0x65, 0x75, 0x63, 0xDC, 0x0F,
-    0x89, 0x64, 0xFF, 0x07, 0xA9, 0x7D, 0xEF, 0x1E, 0xDD, 0xC7, 0x65, 0x1B, 0xE0, 0xBB, 0x60, 0x70,
-    0xE0, 0xBF, 0x6A, 0x0C, 0xDC, 0xC2, 0x5B, 0x52, 0xFD, 0xD2, 0x51, 0x44, 0xFD, 0xD7, 0x5B, 0x3A,
-    0xFA, 0xDE, 0x56, 0x25, 0xFA, 0xD9, 0x4D, 0x4F, 0xD4, 0xBC, 0x92, 0x22, 0xDB, 0xA1, 0x88, 0x69,
-    0xDC, 0xA5, 0x98, 0x8B, 0xD9, 0xB2, 0x9D, 0x09, 0xD2, 0xB7, 0x82, 0x9D, 0xD6, 0xAA, 0x7D, 0x5D,
-    0xFC, 0xBB, 0x77, 0x44, 0xFD, 0xBF, 0x87, 0x38, 0xFA, 0xCD, 0x8C, 0x0D, 0xF5, 0xD6, 0x82, 0x2C,
-    0xF3, 0xD2, 0x72, 0x1D, 0xF7, 0xC4, 0x6C, 0x4A, 0x53, 0x4F, 0x6D, 0x5D, 0xF7, 0xA8, 0x38, 0x64,
-    0x6C, 0x3C, 0xD4, 0x6D, 0xE3, 0x93, 0x96, 0x6F, 0x4A, 0x73, 0x7B, 0x19, 0xE1, 0xFB, 0x5A, 0x23,
-    0x62, 0x60, 0xE2, 0x03, 0xD6, 0xC4, 0xA9, 0x23, 0xE7, 0xBD, 0x21, 0x60, 0xDA, 0xED, 0x34, 0x4E,
-    0xFF, 0xBC, 0x2C, 0x41, 0xED, 0xFF, 0x47, 0x2A, 0x55, 0x39, 0xC9, 0x69, 0x45, 0x46, 0x83, 0x58,
-    0x3E, 0x5E, 0x8D, 0x9C, 0x4F, 0x51, 0xD3, 0x18, 0x1C, 0x00, 0xE8, 0x68, 0x00, 0x26, 0x92, 0x97,
-    0x11, 0x29, 0xF9, 0x10, 0xE7, 0xA0, 0xAC, 0x34, 0x6C, 0x4B, 0xED, 0x86, 0xE1, 0xB5, 0xB5, 0x32,
-    0x55, 0x42, 0xDD, 0x89, 0x1A, 0x12, 0xFF, 0x05, 0x24, 0x3B, 0x96, 0x51, 0xAE, 0xD3, 0x4C, 0x1F,
-    0xBF, 0x94, 0x33, 0x60, 0xA6, 0xCD, 0x50, 0x12, 0xB7, 0x8E, 0x37, 0x5A, 0xA0, 0x99, 0x0E, 0x7A,
-    0x9A, 0xCD, 0x17, 0x26, 0x94, 0xC6, 0x20, 0x18, 0xA6, 0xA0, 0x04, 0x5F, 0x8E, 0xC2, 0x0F, 0x9E,
-    0x97, 0x9D, 0x00, 0x5D, 0x7B, 0x70, 0x71, 0x6E, 0x65, 0x96, 0x20, 0x12, 0x76, 0x86, 0x7A, 0x13,
-    0x6A, 0x85, 0x1A, 0x73, 0x88, 0xE7, 0xA2, 0x9D, 0x9C, 0xF3, 0xA3, 0x24, 0x98, 0xAB, 0x89, 0x97,
-    0xAC, 0xB7, 0x8B, 0x3D, 0x8D, 0xE3, 0xB6, 0x02, 0x9D, 0xA7, 0x9E, 0x81, 0x39, 0x55, 0x31, 0x5A,
-    0x51, 0x7B, 0x29, 0x56, 0x56, 0x58, 0x78, 0x78, 0x6F, 0x77, 0x6E, 0x3D, 0x31, 0x75, 0x3E, 0x13,
-    0x51, 0x6A, 0x80, 0x11, 0x78, 0x90, 0x35, 0x7B, 0x86, 0xB4, 0x25, 0x07, 0x8F, 0x92, 0x18, 0x6E,
-    0xEE, 0xC1, 0xA0, 0x3D, 0x6C, 0xB3, 0x45, 0x3D, 0x4F, 0xA7, 0x3A, 0x3D, 0x30, 0xA0, 0x45, 0x3F,
-    0x91, 0xFC, 0x1C, 0xC1, 0x40, 0x07, 0x90, 0x40, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x31, 0x39, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x5F, 0xD3, 0x4B, 0x8E, 0x5F, 0xED, 0x53,
-    0xA2, 0x6F, 0xE3, 0x53, 0x79, 0x4E, 0xD4, 0x68, 0x8D, 0x4E, 0xF7, 0x68, 0xAD, 0x67, 0xE7, 0x65,
-    0x74, 0x63, 0xDC, 0x0F, 0x88, 0x62, 0xFF, 0x07, 0xA9, 0x7B, 0xEF, 0x1E, 0xDD, 0xC6, 0x66, 0x1B,
-    0xE0, 0xB8, 0x61, 0x70, 0xE0, 0xBE, 0x6A, 0x0C, 0xDD, 0xC0, 0x5C, 0x52, 0xFD, 0xCF, 0x52, 0x44,
-    0xFD, 0xD4, 0x5C, 0x3B, 0xFA, 0xDC, 0x57, 0x25, 0xFA, 0xD7, 0x4D, 0x4F, 0xD4, 0xBA, 0x93, 0x22,
-    0xDA, 0x9E, 0x88, 0x69, 0xDC, 0xA2, 0x98, 0x87, 0xD8, 0xB0, 0x9E, 0x09, 0xD2, 0xB6, 0x83, 0x4E,
-    0xD6, 0xA8, 0x7E, 0x5D, 0xFB, 0xB8, 0x78, 0x44, 0xFD, 0xBC, 0x88, 0x38, 0xFA, 0xCA, 0x8D, 0x0D,
-    0xF5, 0xD4, 0x83, 0x2C, 0xF4, 0xCF, 0x73, 0x1C, 0xF7, 0xC1, 0x6D, 0x4A, 0x53, 0x50, 0x6C, 0x58,
-    0xF6, 0xA4, 0x39, 0x64, 0x6B, 0x3B, 0xD3, 0x6D, 0xE2, 0x8F, 0x96, 0x6F, 0x4B, 0x75, 0x7B, 0x19,
-    0xE2, 0xFC, 0x5B, 0x23, 0x62, 0x61, 0xE2, 0x03, 0xD6, 0xC2, 0xAA, 0x23, 0xE7, 0xBB, 0x21, 0x60,
-    0xDC, 0xED, 0x35, 0x4E, 0xFF, 0xB8, 0x2C, 0x40, 0xEF, 0xFF, 0x47, 0x2A, 0x54, 0x38, 0xC9, 0x69,
-    0x44, 0x47, 0x82, 0x58, 0x3E, 0x61, 0x8C, 0x9C, 0x4E, 0x52, 0xD3, 0x18, 0x1A, 0x00, 0xE7, 0x68,
-    0x00, 0x29, 0x91, 0x97, 0x10, 0x2B, 0xF8, 0x10, 0xE6, 0x9C, 0xAD, 0x34, 0x6B, 0x4A, 0xED, 0x86,
-    0xE1, 0xB3, 0xB6, 0x32, 0x55, 0x42, 0xDC, 0x89, 0x19, 0x13, 0xFE, 0x05, 0x24, 0x3D, 0x95, 0x51,
-    0xB0, 0xD4, 0x4D, 0x1F, 0xBF, 0x92, 0x33, 0x60, 0xA8, 0xCE, 0x51, 0x12, 0xB7, 0x8C, 0x37, 0x5A,
-    0xA1, 0x98, 0x0E, 0x7A, 0x9C, 0xCF, 0x17, 0x26, 0x96, 0xC8, 0x20, 0x18, 0xA7, 0x9F, 0x05, 0x5F,
-    0x8F, 0xC4, 0x0F, 0x9E, 0x98, 0x9D, 0x00, 0x5D, 0x7B, 0x70, 0x71, 0x6E, 0x67, 0x99, 0x20, 0x12,
-    0x76, 0x87, 0x79, 0x13, 0x6B, 0x87, 0x19, 0x73, 0x8A, 0xEB, 0xA1, 0x9D, 0x9E, 0xF7, 0xA3, 0x24,
-    0x99, 0xAC, 0x89, 0x97, 0xAC, 0xB7, 0x8B, 0x3D, 0x8F, 0xE7, 0xB6, 0x02, 0x9E, 0xA8, 0x9E, 0x84,
-    0x3A, 0x57, 0x30, 0x5A, 0x52, 0x7E, 0x28, 0x56, 0x56, 0x59, 0x78, 0x78, 0x70, 0x78, 0x6E, 0x3D,
-    0x32, 0x78, 0x3D, 0x13, 0x52, 0x6C, 0x7F, 0x11, 0x79, 0x91, 0x35, 0x7B, 0x87, 0xB6, 0x25, 0x07,
-    0x8F, 0x93, 0x18, 0x6E, 0x05, 0xD8, 0xA2, 0x3D, 0xFC, 0xAF, 0x3B, 0x3D, 0xE6, 0x9E, 0x3A, 0x3D,
-    0x69, 0xC6, 0x22, 0x3E, 0xB4, 0xDE, 0x22, 0xC1, 0xB9, 0x21, 0xA7, 0x40, 0x73, 0x74, 0x61, 0x6E,
-    0x64, 0x32, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x5E, 0xD3, 0x4B,
-    0x8D, 0x5D, 0xED, 0x53, 0xA1, 0x6D, 0xE3, 0x53, 0x78, 0x4D, 0xD4, 0x68, 0x8B, 0x4B, 0xF7, 0x68,
-    0xAC, 0x64, 0xE8, 0x65, 0x74, 0x62, 0xDB, 0x0F, 0x87, 0x61, 0xFF, 0x07, 0xA8, 0x79, 0xEF, 0x1E,
-    0xDE, 0xC4, 0x66, 0x1B, 0xE0, 0xB6, 0x61, 0x70, 0xE0, 0xBB, 0x6B, 0x0C, 0xDD, 0xBE, 0x5C, 0x52,
-    0xFE, 0xCC, 0x53, 0x44, 0xFE, 0xD1, 0x5D, 0x3A, 0xFB, 0xDA, 0x58, 0x25, 0xFB, 0xD4, 0x4E, 0x4F,
-    0xD4, 0xB8, 0x93, 0x22, 0xDA, 0x9A, 0x89, 0x69, 0xDB, 0x9F, 0x99, 0x87, 0xD8, 0xAE, 0x9E, 0x09,
-    0xD3, 0xB4, 0x83, 0x4E, 0xD6, 0xA5, 0x7E, 0x5D, 0xFB, 0xB3, 0x79, 0x44, 0xFD, 0xB8, 0x89, 0x38,
-    0xFA, 0xC7, 0x8E, 0x0D, 0xF6, 0xD1, 0x83, 0x2C, 0xF4, 0xCD, 0x73, 0x1C, 0xF7, 0xBE, 0x6E, 0x55,
-    0x53, 0x50, 0x6C, 0x58, 0xF6, 0x9F, 0x3A, 0x64, 0x69, 0x39, 0xD3, 0x6D, 0xE1, 0x8A, 0x97, 0x6F,
-    0x4B, 0x78, 0x7A, 0x19, 0xE4, 0xFC, 0x5B, 0x23, 0x62, 0x61, 0xE1, 0x03, 0xD7, 0xC1, 0xAA, 0x23,
-    0xE8, 0xB8, 0x22, 0x60, 0xDD, 0xED, 0x35, 0x4D, 0xFF, 0xB4, 0x2D, 0x40, 0xF1, 0xFF, 0x48, 0x2A,
-    0x53, 0x38, 0xC8, 0x69, 0x44, 0x48, 0x82, 0x58, 0x3F, 0x63, 0x8C, 0x9C, 0x4E, 0x53, 0xD2, 0x18,
-    0x19, 0x00, 0xE6, 0x68, 0x00, 0x2C, 0x90, 0x97, 0x10, 0x2E, 0xF7, 0x15, 0xE6, 0x98, 0xAE, 0x34,
-    0x6A, 0x49, 0xED, 0x86, 0xE1, 0xB0, 0xB6, 0x32, 0x54, 0x42, 0xDC, 0x89, 0x18, 0x14, 0xFD, 0x05,
-    0x24, 0x40, 0x94, 0x51, 0xB1, 0xD6, 0x4D, 0x1F, 0xBF, 0x8F, 0x34, 0x60, 0xA9, 0xD0, 0x51, 0x14,
-    0xB7, 0x89, 0x38, 0x5A, 0xA1, 0x98, 0x0E, 0x7A, 0x9E, 0xD1, 0x17, 0x26, 0x97, 0xCA, 0x20, 0x18,
-    0xA7, 0x9F, 0x05, 0x5F, 0x91, 0xC7, 0x0F, 0x1D, 0x99, 0x9D, 0x00, 0x5D, 0x7B, 0x70, 0x71, 0x6E,
-    0x68, 0x9C, 0x20, 0x12, 0x77, 0x88, 0x79, 0x13, 0x6C, 0x89, 0x19, 0x73, 0x8D, 0xF1, 0xA1, 0x9D,
-    0xA0, 0xFB, 0xA3, 0x24, 0x9A, 0xAD, 0x89, 0x97, 0xAD, 0xB8, 0x8B, 0x3D, 0x91, 0xEC, 0xB6, 0x02,
-    0x9E, 0xA8, 0x9E, 0x81, 0x3A, 0x5A, 0x2F, 0x5A, 0x53, 0x80, 0x28, 0x56, 0x56, 0x5A, 0x78, 0x78,
-    0x70, 0x79, 0x6D, 0x3D, 0x34, 0x7D, 0x3C, 0x13, 0x52, 0x6E, 0x7F, 0x11, 0x7A, 0x93, 0x34, 0x7B,
-    0x89, 0xB8, 0x25, 0x08, 0x90, 0x93, 0x17, 0x6E, 0x20, 0xAA, 0xA4, 0x3D, 0x72, 0x04, 0x32, 0x3D,
-    0x2A, 0xB2, 0x3A, 0x3D, 0xA6, 0x64, 0xD9, 0xBE, 0x43, 0x00, 0x27, 0xC1, 0x88, 0x14, 0xB9, 0x40,
-    0x73, 0x74, 0x61, 0x6E, 0x64, 0x32, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x5C, 0xD3, 0x4B, 0x8C, 0x5A, 0xED, 0x53, 0xA1, 0x69, 0xE3, 0x53, 0x77, 0x4A, 0xD4, 0x68,
-    0x8A, 0x47, 0xF7, 0x68, 0xAB, 0x5F, 0xE8, 0x65, 0x74, 0x61, 0xDB, 0x0F, 0x87, 0x5E, 0xFF, 0x07,
-    0xA7, 0x76, 0xEF, 0x1E, 0xDE, 0xC0, 0x66, 0x1F, 0xE1, 0xB1, 0x61, 0x69, 0xE1, 0xB7, 0x6B, 0x0C,
-    0xDE, 0xBA, 0x5C, 0x52, 0xFE, 0xC6, 0x53, 0x66, 0xFF, 0xCC, 0x5D, 0x3A, 0xFC, 0xD5, 0x58, 0x25,
-    0xFC, 0xCF, 0x4E, 0x4F, 0xD5, 0xB5, 0x93, 0x22, 0xDA, 0x95, 0x89, 0x69, 0xDB, 0x99, 0x99, 0x87,
-    0xD9, 0xA9, 0x9E, 0x09, 0xD3, 0xB0, 0x83, 0x4E, 0xD6, 0xA0, 0x7E, 0x5D, 0xFB, 0xAC, 0x79, 0x65,
-    0xFD, 0xB1, 0x89, 0x38, 0xFA, 0xC1, 0x8E, 0x0D, 0xF6, 0xCD, 0x83, 0x2A, 0xF5, 0xC8, 0x73, 0x1C,
-    0xF7, 0xB8, 0x6E, 0x55, 0x53, 0x50, 0x6C, 0x58, 0xF6, 0x97, 0x3A, 0x64, 0x69, 0x36, 0xD3, 0x68,
-    0xE1, 0x83, 0x97, 0x6F, 0x4C, 0x7B, 0x7A, 0x19, 0xE6, 0xFB, 0x5B, 0x23, 0x62, 0x61, 0xE1, 0x03,
-    0xD7, 0xBE, 0xAA, 0x23, 0xE8, 0xB2, 0x22, 0x60, 0xDF, 0xEB, 0x35, 0x4F, 0xFF, 0xAD, 0x2D, 0x40,
-    0xF2, 0xFD, 0x48, 0x2A, 0x53, 0x36, 0xC8, 0x68, 0x44, 0x48, 0x82, 0x58, 0x3F, 0x66, 0x8C, 0x9C,
-    0x4E, 0x54, 0xD2, 0x18, 0x17, 0x00, 0xE6, 0x68, 0x00, 0x30, 0x90, 0x97, 0x10, 0x31, 0xF7, 0x15,
-    0xE5, 0x91, 0xAE, 0x39, 0x69, 0x47, 0xED, 0x86, 0xE1, 0xAB, 0xB6, 0x32, 0x53, 0x42, 0xDC, 0x89,
-    0x17, 0x15, 0xFD, 0x05, 0x24, 0x42, 0x94, 0x51, 0xB3, 0xD6, 0x4D, 0x1D, 0xBF, 0x8B, 0x34, 0x60,
-    0xAB, 0xD1, 0x51, 0x14, 0xB7, 0x85, 0x38, 0x5A, 0xA2, 0x96, 0x0E, 0x7A, 0xA0, 0xD3, 0x16, 0x26,
-    0x99, 0xCC, 0x20, 0x18, 0xA8, 0x9D, 0x05, 0x5F, 0x93, 0xC9, 0x0F, 0x1D, 0x9A, 0x9C, 0x00, 0x5D,
-    0x7B, 0x6E, 0x71, 0x6E, 0x69, 0x9E, 0x1F, 0x12, 0x77, 0x88, 0x79, 0x13, 0x6D, 0x8A, 0x19, 0x73,
-    0x8F, 0xF5, 0xA1, 0x9D, 0xA3, 0xFF, 0xA3, 0x24, 0x9B, 0xAD, 0x89, 0x97, 0xAE, 0xB7, 0x8B, 0x3D,
-    0x94, 0xF0, 0xB6, 0x02, 0x9F, 0xA8, 0x9E, 0x81, 0x3B, 0x5C, 0x2F, 0x5A, 0x54, 0x83, 0x28, 0x56,
-    0x56, 0x5A, 0x78, 0x78, 0x70, 0x79, 0x6D, 0x3D, 0x35, 0x81, 0x3C, 0x13, 0x53, 0x6F, 0x7F, 0x11,
-    0x7B, 0x93, 0x34, 0x7B, 0x8A, 0xBA, 0x25, 0x08, 0x91, 0x92, 0x17, 0x6D, 0xFA, 0x44, 0xA8, 0x3D,
-    0x1E, 0xCD, 0x1F, 0x3D, 0x01, 0x6F, 0x3E, 0x3D, 0x9E, 0xB6, 0x96, 0xBF, 0xD6, 0x09, 0x21, 0xC1,
-    0x25, 0x7E, 0xB2, 0x40, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x52, 0xD1, 0x4B, 0x8C, 0x4D, 0xE9, 0x53, 0xA1, 0x59, 0xDE, 0x56,
-    0x76, 0x3F, 0xD2, 0x68, 0x89, 0x39, 0xF4, 0x68, 0xAA, 0x4C, 0xE3, 0x62, 0x74, 0x59, 0xD9, 0x0F,
-    0x87, 0x53, 0xFB, 0x08, 0xA8, 0x66, 0xEA, 0x1E, 0xDF, 0xAD, 0x61, 0x22, 0xE1, 0x9C, 0x5C, 0x6D,
-    0xE1, 0xA2, 0x65, 0x0C, 0xDE, 0xA7, 0x57, 0x52, 0xFE, 0xAD, 0x4C, 0x66, 0xFF, 0xB4, 0x56, 0x3A,
-    0xFD, 0xBF, 0x51, 0x25, 0xFC, 0xB8, 0x48, 0x4F, 0xD6, 0xA3, 0x8E, 0x22, 0xD9, 0x7E, 0x83, 0x69,
-    0xDB, 0x83, 0x93, 0x87, 0xD9, 0x95, 0x98, 0x0E, 0xD4, 0x9E, 0x7E, 0x4E, 0xD5, 0x8B, 0x79, 0x5D,
-    0xFB, 0x92, 0x72, 0x65, 0xFD, 0x97, 0x81, 0x38, 0xFB, 0xA9, 0x87, 0x0D, 0xF7, 0xB7, 0x7C, 0x2A,
-    0xF6, 0xB2, 0x6D, 0x1C, 0xF7, 0x9F, 0x67, 0x55, 0x52, 0x4C, 0x6D, 0x58, 0xF3, 0x7B, 0x35, 0x64,
-    0x67, 0x2C, 0xD2, 0x68, 0xDF, 0x6A, 0x91, 0x6F, 0x4E, 0x7D, 0x7B, 0x1A, 0xE9, 0xED, 0x55, 0x23,
-    0x63, 0x5D, 0xE0, 0x03, 0xD9, 0xAC, 0xA4, 0x23, 0xE7, 0x9C, 0x1E, 0x60, 0xE1, 0xDD, 0x30, 0x4F,
-    0xFD, 0x91, 0x28, 0x40, 0xF5, 0xED, 0x42, 0x2A, 0x52, 0x30, 0xC8, 0x68, 0x43, 0x47, 0x84, 0x58,
-    0x40, 0x68, 0x8D, 0x1A, 0x4F, 0x52, 0xD2, 0x07, 0x16, 0x00, 0xE9, 0x7A, 0x00, 0x3A, 0x95, 0x97,
-    0x11, 0x38, 0xF9, 0x15, 0xE5, 0x78, 0xA7, 0x37, 0x69, 0x3F, 0xEB, 0x86, 0xE2, 0x96, 0xAF, 0x32,
-    0x53, 0x3D, 0xDB, 0x89, 0x16, 0x18, 0xFF, 0x05, 0x24, 0x46, 0x97, 0x51, 0xB6, 0xCE, 0x4A, 0x1E,
-    0xBD, 0x78, 0x31, 0x60, 0xAE, 0xC9, 0x4E, 0x14, 0xB5, 0x73, 0x35, 0x71, 0xA1, 0x8A, 0x0D, 0x7A,
-    0xA2, 0xCD, 0x15, 0x26, 0x9B, 0xC7, 0x1F, 0x18, 0xA7, 0x90, 0x04, 0x5E, 0x95, 0xC5, 0x0E, 0x1D,
-    0x99, 0x92, 0x00, 0x5D, 0x7B, 0x66, 0x70, 0x6E, 0x6B, 0x9E, 0x21, 0x19, 0x78, 0x84, 0x78, 0x15,
-    0x6C, 0x87, 0x1A, 0x77, 0x96, 0xF8, 0x9E, 0x9E, 0xA9, 0xFF, 0x9F, 0x24, 0x9D, 0xA6, 0x86, 0x97,
-    0xB0, 0xAD, 0x87, 0x3F, 0x9A, 0xF2, 0xB2, 0x02, 0xA1, 0x9F, 0x9A, 0x84, 0x3A, 0x5D, 0x33, 0x71,
-    0x54, 0x84, 0x2A, 0x56, 0x55, 0x57, 0x79, 0x78, 0x71, 0x74, 0x6D, 0x3E, 0x36, 0x89, 0x3F, 0x14,
-    0x53, 0x6F, 0x80, 0x11, 0x7B, 0x8F, 0x35, 0x92, 0x8C, 0xB6, 0x24, 0x08, 0x90, 0x88, 0x17, 0x6D,
-    0x36, 0x3A, 0xA9, 0x3D, 0xD7, 0x64, 0x19, 0x3D, 0x5A, 0xDD, 0x3F, 0x3D, 0xF0, 0x35, 0xD9, 0xBF,
-    0xE1, 0x13, 0x22, 0xC1, 0x6F, 0x06, 0xA1, 0x40, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x32, 0x33, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x4D, 0xD0, 0x4B, 0x8C, 0x48, 0xE8, 0x53,
-    0xA0, 0x53, 0xDD, 0x53, 0x76, 0x3B, 0xD1, 0x7A, 0x89, 0x33, 0xF2, 0x68, 0xAA, 0x45, 0xE1, 0x63,
-    0x74, 0x56, 0xD8, 0x0F, 0x87, 0x4E, 0xFA, 0x08, 0xA8, 0x60, 0xE8, 0x1E, 0xDF, 0xA6, 0x5F, 0x1F,
-    0xE0, 0x94, 0x5A, 0x69, 0xE1, 0x9A, 0x64, 0x0C, 0xDE, 0x9F, 0x56, 0x52, 0xFE, 0xA4, 0x4B, 0x66,
-    0xFF, 0xAA, 0x54, 0x3A, 0xFD, 0xB6, 0x4F, 0x2A, 0xFC, 0xAF, 0x46, 0x4F, 0xD6, 0x9C, 0x8C, 0x22,
-    0xD9, 0x75, 0x82, 0x69, 0xDB, 0x7A, 0x91, 0x87, 0xD9, 0x8E, 0x96, 0x0E, 0xD4, 0x97, 0x7C, 0x4E,
-    0xD5, 0x83, 0x77, 0x5D, 0xFA, 0x88, 0x70, 0x65, 0xFC, 0x8D, 0x7F, 0x38, 0xFB, 0xA0, 0x84, 0x31,
-    0xF8, 0xAE, 0x7A, 0x2A, 0xF6, 0xA9, 0x6B, 0x1C, 0xF7, 0x96, 0x65, 0x55, 0x52, 0x4B, 0x6E, 0x58,
-    0xF2, 0x70, 0x33, 0x70, 0x66, 0x28, 0xD1, 0x68, 0xDE, 0x60, 0x8F, 0x70, 0x4E, 0x7E, 0x7B, 0x1A,
-    0xEA, 0xE8, 0x53, 0x25, 0x63, 0x5C, 0xDF, 0x03, 0xDA, 0xA5, 0xA2, 0x25, 0xE6, 0x93, 0x1D, 0x54,
-    0xE2, 0xD7, 0x2F, 0x4F, 0xFC, 0x86, 0x26, 0x40, 0xF6, 0xE6, 0x40, 0x2E, 0x51, 0x2E, 0xC8, 0x68,
-    0x43, 0x46, 0x84, 0x58, 0x41, 0x69, 0x8D, 0x1A, 0x4F, 0x52, 0xD1, 0x07, 0x15, 0x00, 0xE9, 0x7A,
-    0x00, 0x3D, 0x96, 0x97, 0x11, 0x3B, 0xF9, 0x15, 0xE4, 0x6F, 0xA5, 0x37, 0x69, 0x3C, 0xEA, 0x86,
-    0xE2, 0x8E, 0xAD, 0x32, 0x53, 0x3B, 0xDB, 0x89, 0x16, 0x18, 0xFF, 0x05, 0x24, 0x48, 0x97, 0x51,
-    0xB6, 0xCB, 0x49, 0x1E, 0xBC, 0x71, 0x30, 0x60, 0xAE, 0xC7, 0x4D, 0x14, 0xB4, 0x6C, 0x35, 0x71,
-    0xA0, 0x85, 0x0D, 0x7A, 0xA2, 0xCC, 0x15, 0x26, 0x9C, 0xC6, 0x1E, 0x07, 0xA7, 0x8B, 0x04, 0x5E,
-    0x95, 0xC4, 0x0E, 0x1D, 0x99, 0x8F, 0x00, 0x59, 0x7B, 0x63, 0x70, 0x6E, 0x6B, 0x9E, 0x21, 0x19,
-    0x79, 0x82, 0x78, 0x15, 0x6C, 0x86, 0x1B, 0x77, 0x98, 0xF9, 0x9C, 0x9E, 0xAB, 0xFF, 0x9D, 0x24,
-    0x9D, 0xA3, 0x85, 0x97, 0xB1, 0xA9, 0x86, 0x3F, 0x9C, 0xF2, 0xB0, 0x02, 0xA2, 0x9C, 0x99, 0x84,
-    0x3A, 0x5E, 0x34, 0x71, 0x55, 0x84, 0x2B, 0x56, 0x55, 0x55, 0x79, 0x78, 0x71, 0x72, 0x6D, 0x3F,
-    0x37, 0x8C, 0x40, 0x14, 0x53, 0x6F, 0x80, 0x11, 0x7B, 0x8D, 0x35, 0x92, 0x8D, 0xB5, 0x24, 0x08,
-    0x90, 0x85, 0x17, 0x6D, 0xF9, 0x05, 0xAC, 0x3D, 0x61, 0xF9, 0x09, 0x3D, 0xFC, 0xB5, 0x3A, 0x3D,
-    0x3E, 0x43, 0x1B, 0xC0, 0x45, 0x93, 0x1D, 0xC1, 0xCC, 0x95, 0x8F, 0x40, 0x73, 0x74, 0x61, 0x6E,
-    0x64, 0x32, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x42, 0xD3, 0x3E,
-    0x88, 0x3A, 0xED, 0x56, 0x9D, 0x42, 0xE3, 0x56, 0x72, 0x2F, 0xD4, 0x7A, 0x84, 0x23, 0xF7, 0x68,
-    0xA5, 0x31, 0xE8, 0x62, 0x71, 0x4E, 0xDB, 0x0F, 0x83, 0x42, 0xFF, 0x08, 0xA4, 0x4F, 0xEF, 0x26,
-    0xE0, 0x93, 0x66, 0x1F, 0xE0, 0x7E, 0x62, 0x68, 0xE1, 0x86, 0x6B, 0x0C, 0xDF, 0x8B, 0x5D, 0x52,
-    0xFE, 0x8B, 0x53, 0x66, 0xFF, 0x92, 0x5D, 0x8B, 0xFD, 0x9F, 0x58, 0x2A, 0xFD, 0x98, 0x4F, 0x4F,
-    0xD5, 0x89, 0x94, 0x22, 0xD7, 0x5E, 0x89, 0x69, 0xD9, 0x63, 0x99, 0x87, 0xD8, 0x79, 0x9E, 0x0E,
-    0xD3, 0x84, 0x84, 0x4E, 0xD4, 0x6E, 0x7E, 0x59, 0xF9, 0x6C, 0x79, 0x65, 0xFA, 0x71, 0x89, 0x6F,
-    0xFA, 0x87, 0x8E, 0x0B, 0xF7, 0x97, 0x84, 0x2A, 0xF5, 0x92, 0x74, 0x1C, 0xF6, 0x7C, 0x6E, 0x55,
-    0x51, 0x48, 0x6C, 0x58, 0xF1, 0x54, 0x3B, 0x70, 0x63, 0x1D, 0xD3, 0x7A, 0xDB, 0x45, 0x98, 0x70,
-    0x4F, 0x82, 0x7A, 0x1A, 0xED, 0xDA, 0x5B, 0x25, 0x61, 0x57, 0xE1, 0x07, 0xD9, 0x93, 0xAB, 0x25,
-    0xE7, 0x7C, 0x23, 0x60, 0xE5, 0xC9, 0x35, 0x4F, 0xFC, 0x6A, 0x2E, 0x42, 0xF9, 0xD6, 0x48, 0x2E,
-    0x4E, 0x28, 0xC8, 0x68, 0x42, 0x46, 0x81, 0x58, 0x41, 0x6D, 0x8B, 0x1A, 0x4D, 0x50, 0xD2, 0x07,
-    0x11, 0x00, 0xE6, 0x7A, 0x00, 0x48, 0x8F, 0x94, 0x0F, 0x42, 0xF6, 0x15, 0xE1, 0x54, 0xAE, 0x37,
-    0x65, 0x33, 0xED, 0x86, 0xE0, 0x77, 0xB7, 0x31, 0x50, 0x36, 0xDC, 0x84, 0x12, 0x1B, 0xFD, 0x05,
-    0x24, 0x4D, 0x93, 0x51, 0xB9, 0xC4, 0x4D, 0x1E, 0xBC, 0x5E, 0x34, 0x60, 0xB1, 0xC0, 0x51, 0x1B,
-    0xB4, 0x5B, 0x38, 0x71, 0xA2, 0x7A, 0x0E, 0x78, 0xA7, 0xC8, 0x16, 0x49, 0xA0, 0xC2, 0x1F, 0x07,
-    0xA9, 0x7F, 0x05, 0x5E, 0x9A, 0xC2, 0x0F, 0x1D, 0x9C, 0x86, 0x00, 0x59, 0x7A, 0x5B, 0x70, 0x6D,
-    0x6E, 0x9F, 0x1F, 0x19, 0x79, 0x7E, 0x79, 0x15, 0x6F, 0x84, 0x19, 0x77, 0x9B, 0xFC, 0xA1, 0x9E,
-    0xAE, 0xFF, 0xA3, 0x2C, 0x9E, 0x9B, 0x89, 0x97, 0xB1, 0x9E, 0x8B, 0x3F, 0x9E, 0xF4, 0xB5, 0x02,
-    0xA2, 0x93, 0x9E, 0x84, 0x3C, 0x62, 0x2F, 0x71, 0x58, 0x87, 0x27, 0x56, 0x55, 0x53, 0x77, 0x7D,
-    0x71, 0x6D, 0x6D, 0x3F, 0x3A, 0x95, 0x3B, 0x14, 0x54, 0x70, 0x7E, 0x11, 0x7D, 0x8A, 0x34, 0x92,
-    0x90, 0xB3, 0x25, 0x08, 0x92, 0x7D, 0x17, 0x6B, 0xC3, 0x23, 0xAD, 0x3D, 0x1D, 0x23, 0xF6, 0x3C,
-    0x53, 0x6A, 0x3A, 0x3D, 0x18, 0x5A, 0x1A, 0xC0, 0x3E, 0xC1, 0x18, 0xC1, 0x2F, 0xCD, 0x88, 0x40,
-    0x73, 0x74, 0x61, 0x6E, 0x64, 0x32, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x79, 0x36, 0xD3, 0x41, 0x86, 0x29, 0xED, 0x56, 0x9B, 0x2F, 0xE3, 0x56, 0x70, 0x22, 0xD3, 0x73,
-    0x81, 0x11, 0xF7, 0x7A, 0xA3, 0x19, 0xE8, 0x62, 0x70, 0x45, 0xDB, 0x0F, 0x81, 0x33, 0xFF, 0x08,
-    0xA2, 0x3C, 0xF0, 0x26, 0xE0, 0x7C, 0x68, 0x20, 0xE0, 0x65, 0x63, 0x68, 0xE1, 0x6D, 0x6C, 0x0C,
-    0xDF, 0x74, 0x5E, 0x52, 0xFE, 0x6D, 0x55, 0x66, 0xFF, 0x75, 0x5F, 0x8B, 0xFE, 0x84, 0x5A, 0x2F,
-    0xFD, 0x7C, 0x50, 0x48, 0xD5, 0x73, 0x95, 0x20, 0xD5, 0x43, 0x8A, 0x68, 0xD7, 0x48, 0x9A, 0x87,
-    0xD7, 0x60, 0xA0, 0x0E, 0xD3, 0x6D, 0x85, 0x4E, 0xD3, 0x55, 0x7F, 0x59, 0xF8, 0x4C, 0x7B, 0x65,
-    0xF9, 0x51, 0x8B, 0x6F, 0xF9, 0x69, 0x90, 0x0B, 0xF7, 0x7C, 0x85, 0x29, 0xF5, 0x77, 0x75, 0x26,
-    0xF5, 0x5E, 0x70, 0x55, 0x51, 0x44, 0x6B, 0x58, 0xF0, 0x32, 0x3C, 0x70, 0x60, 0x11, 0xD3, 0x7A,
-    0xD9, 0x25, 0x99, 0x70, 0x50, 0x85, 0x79, 0x1F, 0xEF, 0xC8, 0x5D, 0x25, 0x60, 0x52, 0xE1, 0x07,
-    0xD9, 0x7E, 0xAC, 0x25, 0xE7, 0x61, 0x24, 0x60, 0xE7, 0xB7, 0x36, 0x4F, 0xFB, 0x49, 0x2F, 0x42,
-    0xFB, 0xC2, 0x4A, 0x2E, 0x4C, 0x21, 0xC7, 0x68, 0x42, 0x44, 0x80, 0xA0, 0x41, 0x71, 0x8A, 0x1A,
-    0x4C, 0x4E, 0xD1, 0x07, 0x0E, 0x00, 0xE4, 0x7A, 0x00, 0x54, 0x8D, 0x94, 0x0E, 0x4A, 0xF4, 0x18,
-    0xDF, 0x36, 0xAF, 0x38, 0x63, 0x28, 0xEC, 0x86, 0xDF, 0x5D, 0xB8, 0x31, 0x4E, 0x30, 0xDB, 0x84,
-    0x10, 0x1E, 0xFB, 0x05, 0x23, 0x53, 0x92, 0x51, 0xBB, 0xBA, 0x4D, 0x1E, 0xBC, 0x48, 0x34, 0x60,
-    0xB3, 0xB8, 0x51, 0x1B, 0xB4, 0x46, 0x38, 0x71, 0xA3, 0x6C, 0x0E, 0x77, 0xA9, 0xC2, 0x17, 0x49,
-    0xA3, 0xBE, 0x20, 0x07, 0xAA, 0x71, 0x05, 0x5E, 0x9C, 0xBE, 0x0F, 0x1C, 0x9D, 0x7B, 0x00, 0x59,
-    0x7A, 0x51, 0x70, 0x6D, 0x70, 0xA0, 0x1F, 0x1B, 0x7A, 0x78, 0x79, 0x15, 0x70, 0x82, 0x18, 0x72,
-    0x9F, 0xFF, 0xA1, 0x9E, 0xB2, 0xFF, 0xA3, 0x2C, 0x9F, 0x92, 0x89, 0x94, 0xB2, 0x92, 0x8C, 0x3F,
-    0xA2, 0xF5, 0xB6, 0x02, 0xA2, 0x88, 0x9E, 0x7F, 0x3C, 0x65, 0x2E, 0x71, 0x59, 0x8A, 0x27, 0x56,
-    0x55, 0x50, 0x76, 0x7D, 0x71, 0x67, 0x6D, 0x3F, 0x3C, 0x9E, 0x3A, 0x14, 0x54, 0x70, 0x7D, 0x18,
-    0x7E, 0x85, 0x34, 0x92, 0x92, 0xAF, 0x24, 0x08, 0x93, 0x73, 0x17, 0x6B, 0xF1, 0x3F, 0xAD, 0x3D,
-    0x5D, 0x7A, 0xDF, 0x3C, 0x8A, 0x6B, 0x3A, 0x3D, 0x62, 0x69, 0xB7, 0xBF, 0xD3, 0x04, 0x19, 0xC1,
-    0x14, 0x8C, 0x9D, 0x40, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x32, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x2A, 0xD3, 0x41, 0x84, 0x1A, 0xED, 0x56, 0x99, 0x1B, 0xE3, 0x56,
-    0x6F, 0x17, 0xD3, 0x77, 0x7F, 0x00, 0xF7, 0x7A, 0xA1, 0x02, 0xE8, 0x61, 0x70, 0x3D, 0xDB, 0x11,
-    0x80, 0x26, 0xFF, 0x08, 0xA1, 0x28, 0xF0, 0x26, 0xE0, 0x60, 0x68, 0x20, 0xE0, 0x47, 0x63, 0x68,
-    0xE1, 0x4F, 0x6C, 0x0C, 0xDF, 0x57, 0x5E, 0x52, 0xFE, 0x49, 0x55, 0x63, 0xFF, 0x51, 0x5F, 0x8B,
-    0xFE, 0x62, 0x5A, 0x2F, 0xFD, 0x59, 0x50, 0x48, 0xD5, 0x59, 0x95, 0x20, 0xD4, 0x23, 0x8A, 0x68,
-    0xD6, 0x29, 0x9A, 0x88, 0xD7, 0x44, 0xA0, 0x0E, 0xD3, 0x53, 0x85, 0x4D, 0xD3, 0x38, 0x7F, 0x59,
-    0xF6, 0x25, 0x7B, 0x63, 0xF9, 0x2B, 0x8B, 0x6F, 0xF9, 0x46, 0x90, 0x0B, 0xF7, 0x5B, 0x85, 0x29,
-    0xF5, 0x55, 0x75, 0x26, 0xF5, 0x3A, 0x70, 0x55, 0x50, 0x44, 0x6B, 0x58, 0xEE, 0x0B, 0x3C, 0x69,
-    0x5E, 0x08, 0xD3, 0x7A, 0xD7, 0x02, 0x99, 0x70, 0x51, 0x8B, 0x79, 0x1F, 0xF1, 0xB1, 0x5D, 0x25,
-    0x5F, 0x4F, 0xE1, 0x07, 0xD9, 0x63, 0xAC, 0x25, 0xE7, 0x41, 0x24, 0x60, 0xE9, 0xA0, 0x36, 0x4F,
-    0xFA, 0x21, 0x2F, 0x42, 0xFD, 0xA7, 0x4A, 0x2E, 0x4B, 0x1E, 0xC7, 0x73, 0x41, 0x47, 0x80, 0xA0,
-    0x42, 0x78, 0x8A, 0x1A, 0x4C, 0x4F, 0xD1, 0x06, 0x0C, 0x08, 0xE4, 0x77, 0x00, 0x68, 0x8D, 0x94,
-    0x0E, 0x5A, 0xF4, 0x18, 0xDE, 0x13, 0xAF, 0x36, 0x61, 0x21, 0xEC, 0x86, 0xDF, 0x3E, 0xB8, 0x31,
-    0x4D, 0x2E, 0xDB, 0x84, 0x0F, 0x29, 0xFB, 0x05, 0x23, 0x5E, 0x92, 0x51, 0xBD, 0xAC, 0x4D, 0x1E,
-    0xBB, 0x2F, 0x34, 0x60, 0xB5, 0xAC, 0x51, 0x1B, 0xB3, 0x2F, 0x38, 0x71, 0xA3, 0x5D, 0x0E, 0x78,
-    0xAC, 0xBA, 0x17, 0x49, 0xA5, 0xB6, 0x20, 0x07, 0xAA, 0x60, 0x05, 0x5E, 0x9F, 0xB8, 0x0F, 0x1C,
-    0x9D, 0x6E, 0x00, 0x59, 0x79, 0x49, 0x70, 0x6D, 0x72, 0xA1, 0x1F, 0x1B, 0x7A, 0x74, 0x79, 0x16,
-    0x71, 0x80, 0x18, 0x75, 0xA3, 0xFF, 0xA1, 0x9E, 0xB6, 0xFA, 0xA3, 0x2C, 0xA0, 0x87, 0x89, 0x94,
-    0xB3, 0x82, 0x8C, 0x3F, 0xA5, 0xF3, 0xB6, 0x02, 0xA3, 0x7B, 0x9E, 0x7F, 0x3D, 0x6D, 0x2E, 0x9F,
-    0x5A, 0x8E, 0x27, 0x56, 0x54, 0x4F, 0x76, 0x7D, 0x71, 0x63, 0x6D, 0x3F, 0x3E, 0xAC, 0x3A, 0x16,
-    0x55, 0x73, 0x7D, 0x18, 0x7F, 0x80, 0x34, 0x92, 0x94, 0xAA, 0x24, 0x08, 0x93, 0x67, 0x17, 0x6B,
-    0x8B, 0xA9, 0xAD, 0x3D, 0x92, 0xF1, 0xE9, 0x3C, 0x69, 0x8D, 0x39, 0x3D, 0xED, 0x53, 0x0E, 0x40,
-    0x29, 0x78, 0x23, 0xC1, 0x29, 0x3E, 0xD7, 0x40, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x32, 0x37, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x41, 0xD2, 0x43, 0x7F, 0x34, 0xEE, 0x56,
-    0x95, 0x32, 0xE7, 0x56, 0x6B, 0x2F, 0xD2, 0x77, 0x79, 0x1E, 0xFA, 0x7A, 0x9B, 0x1A, 0xEE, 0x62,
-    0x6C, 0x55, 0xD8, 0x11, 0x7A, 0x43, 0xFF, 0x08, 0x9C, 0x3F, 0xF4, 0x26, 0xE0, 0x59, 0x70, 0x20,
-    0xDF, 0x40, 0x6D, 0x68, 0xE0, 0x4A, 0x76, 0x0C, 0xDF, 0x4F, 0x67, 0x52, 0xFE, 0x3D, 0x63, 0x65,
-    0xFF, 0x46, 0x6C, 0x8B, 0xFF, 0x55, 0x66, 0x2F, 0xFE, 0x4C, 0x5D, 0x48, 0xD4, 0x5A, 0x9D, 0x20,
-    0xD2, 0x26, 0x95, 0x68, 0xD4, 0x2E, 0xA5, 0x89, 0xD5, 0x48, 0xA9, 0x0A, 0xD2, 0x52, 0x8D, 0x4F,
-    0xD1, 0x38, 0x89, 0x58, 0xF5, 0x22, 0x8A, 0x62, 0xF7, 0x2A, 0x9A, 0x8C, 0xF7, 0x44, 0x9D, 0x0B,
-    0xF6, 0x56, 0x91, 0x29, 0xF5, 0x4F, 0x81, 0x49, 0xF4, 0x35, 0x7D, 0x40, 0x50, 0x4D, 0x63, 0x58,
-    0xEE, 0x00, 0x4B, 0x6D, 0x5A, 0x23, 0xD0, 0x7A, 0xD5, 0x09, 0xA6, 0x6E, 0x52, 0x92, 0x6D, 0x1F,
-    0xF2, 0xA2, 0x63, 0x25, 0x5C, 0x68, 0xDA, 0x07, 0xD7, 0x68, 0xB3, 0x25, 0xE9, 0x30, 0x2F, 0x60,
-    0xEB, 0x8D, 0x3D, 0x4F, 0xFB, 0x12, 0x3F, 0x42, 0xFF, 0x95, 0x52, 0x2E, 0x47, 0x38, 0xC1, 0x7A,
-    0x41, 0x55, 0x77, 0xA0, 0x42, 0x84, 0x7E, 0x1D, 0x49, 0x68, 0xC8, 0x06, 0x08, 0x2D, 0xD8, 0x77,
-    0x00, 0x7B, 0x7A, 0x94, 0x0A, 0x7D, 0xE3, 0x16, 0xDA, 0x1C, 0xBC, 0x38, 0x5D, 0x3E, 0xE9, 0x84,
-    0xDB, 0x46, 0xC2, 0x31, 0x49, 0x4A, 0xD4, 0x84, 0x0A, 0x4F, 0xED, 0x02, 0x23, 0x70, 0x84, 0x53,
-    0xBF, 0xA1, 0x4D, 0x26, 0xBC, 0x26, 0x3C, 0x60, 0xB7, 0xA2, 0x50, 0x1B, 0xB4, 0x27, 0x3E, 0x71,
-    0xA6, 0x4E, 0x10, 0x76, 0xB0, 0xA7, 0x14, 0x4C, 0xA9, 0xA5, 0x1C, 0x07, 0xAD, 0x4F, 0x07, 0x5E,
-    0xA3, 0xA5, 0x0A, 0x1C, 0xA1, 0x5D, 0x00, 0x58, 0x79, 0x4E, 0x6E, 0x6B, 0x76, 0x96, 0x16, 0x1A,
-    0x7A, 0x78, 0x74, 0x14, 0x75, 0x75, 0x12, 0x75, 0xA3, 0xFF, 0x99, 0x4D, 0xB6, 0xF9, 0x9E, 0x2C,
-    0xA0, 0x8A, 0x88, 0x94, 0xB3, 0x84, 0x8D, 0x46, 0xA5, 0xF7, 0xAF, 0x01, 0xA2, 0x81, 0x9E, 0x7F,
-    0x40, 0x6C, 0x22, 0x71, 0x5E, 0x87, 0x1C, 0x4A, 0x54, 0x59, 0x6F, 0x7B, 0x72, 0x67, 0x68, 0x46,
-    0x41, 0xA9, 0x2A, 0x1B, 0x55, 0x7C, 0x74, 0x18, 0x82, 0x79, 0x2F, 0x8E, 0x98, 0x9C, 0x20, 0x08,
-    0x96, 0x5B, 0x16, 0x6B, 0xDD, 0xCA, 0xAD, 0x3D, 0xEA, 0x61, 0xFD, 0x3C, 0x85, 0x51, 0x37, 0x3D,
-    0x46, 0x75, 0xB2, 0x40, 0x9B, 0xD1, 0x23, 0xC1, 0x25, 0x05, 0x0E, 0x41, 0x73, 0x74, 0x61, 0x6E,
-    0x64, 0x32, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x5E, 0xD1, 0x43,
-    0x7A, 0x52, 0xEF, 0x56, 0x90, 0x4B, 0xEA, 0x56, 0x67, 0x4F, 0xD1, 0x77, 0x74, 0x3F, 0xFB, 0x7A,
-    0x96, 0x34, 0xF2, 0x69, 0x68, 0x72, 0xD6, 0x15, 0x76, 0x62, 0xFF, 0x08, 0x98, 0x57, 0xF7, 0x49,
-    0xDF, 0x57, 0x77, 0x20, 0xDD, 0x41, 0x74, 0x7A, 0xDE, 0x4A, 0x7D, 0x05, 0xDE, 0x4E, 0x6E, 0x59,
-    0xFC, 0x37, 0x6D, 0x62, 0xFD, 0x40, 0x76, 0x87, 0xFD, 0x4E, 0x70, 0x2E, 0xFC, 0x44, 0x66, 0x48,
-    0xD1, 0x5E, 0xA3, 0x20, 0xCF, 0x2E, 0x9D, 0x68, 0xD0, 0x36, 0xAC, 0x89, 0xD1, 0x4E, 0xB0, 0x0A,
-    0xD0, 0x56, 0x93, 0x4F, 0xCF, 0x3E, 0x90, 0x58, 0xF1, 0x23, 0x94, 0x62, 0xF3, 0x2B, 0xA4, 0x8C,
-    0xF4, 0x43, 0xA7, 0x0B, 0xF4, 0x53, 0x9A, 0x29, 0xF2, 0x4B, 0x8A, 0x49, 0xF1, 0x33, 0x87, 0x5F,
-    0x4F, 0x67, 0x5E, 0x58, 0xEB, 0x00, 0x56, 0x6D, 0x56, 0x47, 0xCE, 0x7A, 0xD0, 0x14, 0xAE, 0x6D,
-    0x53, 0xA7, 0x66, 0x1D, 0xF3, 0x96, 0x69, 0x25, 0x59, 0x87, 0xD6, 0x07, 0xD4, 0x6C, 0xB9, 0x25,
-    0xE7, 0x2B, 0x37, 0x60, 0xEC, 0x81, 0x42, 0x48, 0xF9, 0x0D, 0x4A, 0x66, 0xFF, 0x86, 0x59, 0x35,
-    0x44, 0x5C, 0xBD, 0x7A, 0x40, 0x72, 0x70, 0xA0, 0x42, 0x9F, 0x76, 0x1D, 0x46, 0x89, 0xC2, 0x06,
-    0x04, 0x61, 0xCE, 0x78, 0x00, 0xA3, 0x6D, 0x94, 0x08, 0xAB, 0xD8, 0x16, 0xD6, 0x26, 0xC5, 0x38,
-    0x58, 0x61, 0xE6, 0x84, 0xD8, 0x4D, 0xCA, 0x31, 0x46, 0x6E, 0xD0, 0x7F, 0x07, 0x81, 0xE3, 0x04,
-    0x22, 0x92, 0x79, 0x53, 0xC0, 0x9D, 0x4F, 0x26, 0xBB, 0x2B, 0x40, 0x5E, 0xB8, 0xA0, 0x51, 0x1F,
-    0xB2, 0x2E, 0x42, 0x72, 0xA7, 0x50, 0x11, 0x76, 0xB2, 0xA1, 0x13, 0x4C, 0xAB, 0xA2, 0x1B, 0x17,
-    0xAE, 0x50, 0x09, 0x5E, 0xA6, 0xA1, 0x08, 0x47, 0xA2, 0x5E, 0x00, 0x58, 0x78, 0x61, 0x6C, 0x6A,
-    0x78, 0x9D, 0x11, 0x1A, 0x7A, 0x88, 0x71, 0x1B, 0x77, 0x7F, 0x0D, 0x75, 0xA5, 0xFF, 0x95, 0x4D,
-    0xB7, 0xF6, 0x9C, 0x2A, 0x9F, 0x92, 0x88, 0x94, 0xB2, 0x8A, 0x8F, 0x46, 0xA6, 0xF9, 0xAC, 0x01,
-    0xA0, 0x8C, 0x9E, 0x00, 0x41, 0x81, 0x19, 0x71, 0x60, 0x94, 0x15, 0x55, 0x53, 0x72, 0x6A, 0x7B,
-    0x71, 0x79, 0x64, 0x46, 0x44, 0xBA, 0x20, 0x1B, 0x55, 0x92, 0x6E, 0x18, 0x83, 0x82, 0x2C, 0x8E,
-    0x9A, 0x9C, 0x1D, 0x08, 0x97, 0x60, 0x16, 0x79, 0xAF, 0x0B, 0xAE, 0x3D, 0x28, 0x15, 0xFA, 0x3C,
-    0x7F, 0x14, 0x33, 0x3D, 0xE2, 0x8B, 0xD8, 0x40, 0xC2, 0xB9, 0x15, 0xC1, 0xD9, 0x65, 0x2A, 0x41,
-    0x73, 0x74, 0x61, 0x6E, 0x64, 0x32, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0x5F, 0xD1, 0x43, 0x79, 0x5B, 0xF1, 0x55, 0x8E, 0x57, 0xED, 0x55, 0x66, 0x4F, 0xD1, 0x7A,
-    0x72, 0x49, 0xFE, 0x7A, 0x94, 0x43, 0xF9, 0x69, 0x66, 0x73, 0xD3, 0x15, 0x73, 0x6D, 0xFF, 0x23,
-    0x95, 0x67, 0xFA, 0x49, 0xDF, 0x5B, 0x7E, 0x1E, 0xDE, 0x44, 0x7D, 0x6B, 0xDF, 0x4F, 0x85, 0x0E,
-    0xDE, 0x50, 0x75, 0x59, 0xFD, 0x3E, 0x78, 0x62, 0xFE, 0x49, 0x81, 0x85, 0xFE, 0x56, 0x79, 0x2A,
-    0xFD, 0x4B, 0x71, 0x4A, 0xD1, 0x68, 0xA8, 0x1E, 0xCF, 0x36, 0xA6, 0x68, 0xD0, 0x42, 0xB6, 0x89,
-    0xD1, 0x5B, 0xB7, 0x08, 0xD0, 0x5D, 0x99, 0x4F, 0xCF, 0x44, 0x98, 0x5D, 0xF2, 0x30, 0xA1, 0x62,
-    0xF3, 0x3B, 0xB1, 0x8C, 0xF4, 0x54, 0xB2, 0x0D, 0xF4, 0x62, 0xA3, 0x29, 0xF3, 0x57, 0x94, 0x48,
-    0xF2, 0x3E, 0x93, 0x5F, 0x51, 0x4C, 0x58, 0x5B, 0xEE, 0x00, 0x65, 0x6D, 0x55, 0x43, 0xCE, 0x79,
-    0xD1, 0x20, 0xBB, 0x6C, 0x52, 0x8F, 0x5B, 0x1D, 0xF2, 0x9B, 0x6B, 0x25, 0x57, 0x85, 0xD0, 0x17,
-    0xD3, 0x7B, 0xBE, 0x25, 0xEA, 0x25, 0x42, 0x5D, 0xED, 0x7E, 0x45, 0x56, 0xFC, 0x0D, 0x59, 0x66,
-    0xFF, 0x8B, 0x5D, 0x2E, 0x43, 0x52, 0xB9, 0x7A, 0x40, 0x59, 0x69, 0x9F, 0x41, 0x87, 0x6A, 0x9E,
-    0x44, 0x80, 0xBA, 0x21, 0x03, 0x4E, 0xC5, 0x78, 0x00, 0x7D, 0x5C, 0x9B, 0x05, 0x9B, 0xC8, 0x16,
-    0xD5, 0x37, 0xD1, 0x3A, 0x57, 0x63, 0xE4, 0x02, 0xD6, 0x60, 0xD2, 0x32, 0x44, 0x68, 0xCA, 0x02,
-    0x05, 0x73, 0xD8, 0x04, 0x22, 0x75, 0x6D, 0x52, 0xC1, 0x94, 0x4C, 0x26, 0xBE, 0x1F, 0x48, 0x5E,
-    0xB8, 0x96, 0x4D, 0x1A, 0xB5, 0x20, 0x49, 0x73, 0xAA, 0x37, 0x12, 0x78, 0xB4, 0x8B, 0x0E, 0x4C,
-    0xAC, 0x8C, 0x16, 0x17, 0xB2, 0x37, 0x0B, 0x63, 0xA8, 0x86, 0x03, 0x47, 0xA6, 0x41, 0x00, 0x5D,
-    0x79, 0x50, 0x6A, 0x6A, 0x7A, 0x7C, 0x08, 0x1A, 0x7A, 0x79, 0x6B, 0x1B, 0x79, 0x5C, 0x07, 0x77,
-    0xA1, 0xFF, 0x89, 0x4E, 0xB3, 0xFB, 0x92, 0x2C, 0x9E, 0x8F, 0x85, 0x9B, 0xB1, 0x8A, 0x8E, 0x34,
-    0xA2, 0xFD, 0xA0, 0x01, 0x9F, 0x8D, 0x9C, 0x00, 0x43, 0x58, 0x0F, 0x71, 0x62, 0x70, 0x0C, 0x40,
-    0x54, 0x5B, 0x63, 0x7B, 0x72, 0x66, 0x60, 0x46, 0x45, 0x93, 0x11, 0x1B, 0x55, 0x7C, 0x65, 0x16,
-    0x85, 0x68, 0x27, 0x8E, 0x9B, 0x84, 0x17, 0x23, 0x9A, 0x45, 0x15, 0x6A, 0xD0, 0x10, 0xAE, 0x3D,
-    0x77, 0xE3, 0x01, 0x3D, 0x29, 0x06, 0x32, 0x3D, 0xCA, 0x41, 0xE0, 0x40, 0xE8, 0x5F, 0x1A, 0xC1,
-    0xCD, 0xFE, 0x35, 0x41, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0x73, 0xD0, 0x43, 0x78, 0x74, 0xF1, 0x55, 0x8D, 0x6F, 0xEE, 0x55,
-    0x65, 0x64, 0xD2, 0x78, 0x71, 0x66, 0xFF, 0x78, 0x93, 0x5E, 0xFB, 0x70, 0x66, 0x86, 0xD0, 0x15,
-    0x72, 0x88, 0xFD, 0x23, 0x94, 0x80, 0xF9, 0x49, 0xDF, 0x5C, 0x80, 0x1E, 0xDE, 0x46, 0x81, 0x6B,
-    0xDE, 0x52, 0x89, 0x0E, 0xDE, 0x50, 0x78, 0x59, 0xFD, 0x3E, 0x7E, 0x64, 0xFD, 0x4A, 0x85, 0x85,
-    0xFD, 0x55, 0x7D, 0x2A, 0xFD, 0x49, 0x75, 0x4A, 0xD0, 0x71, 0xA9, 0x1E, 0xCF, 0x41, 0xAB, 0x6B,
-    0xCF, 0x4E, 0xBA, 0x86, 0xD0, 0x66, 0xB9, 0x08, 0xCF, 0x63, 0x9A, 0x53, 0xCE, 0x4B, 0x9C, 0x5B,
-    0xF1, 0x38, 0xA8, 0x70, 0xF2, 0x46, 0xB6, 0x8B, 0xF3, 0x5E, 0xB5, 0x0D, 0xF3, 0x68, 0xA5, 0x29,
-    0xF2, 0x5B, 0x96, 0x48, 0xF1, 0x43, 0x98, 0x66, 0x50, 0x4C, 0x59, 0x5B, 0xEE, 0x00, 0x70, 0x6C,
-    0x54, 0x58, 0xCF, 0x79, 0xD0, 0x2F, 0xC2, 0x8A, 0x52, 0x8D, 0x56, 0x4D, 0xF2, 0x95, 0x67, 0x2C,
-    0x56, 0x98, 0xCB, 0x17, 0xD2, 0x86, 0xBD, 0x25, 0xEA, 0x1D, 0x49, 0x5D, 0xED, 0x72, 0x44, 0x56,
-    0xFB, 0x0A, 0x63, 0x65, 0xFF, 0x83, 0x5C, 0x2E, 0x43, 0x64, 0xB9, 0x79, 0x40, 0x5C, 0x68, 0x9F,
-    0x41, 0x88, 0x66, 0x4D, 0x44, 0x90, 0xB6, 0x21, 0x02, 0x65, 0xC4, 0x78, 0x00, 0x7F, 0x57, 0x9B,
-    0x05, 0xAE, 0xC0, 0x1B, 0xD4, 0x49, 0xD6, 0x3A, 0x56, 0x7B, 0xE2, 0x04, 0xD6, 0x70, 0xD3, 0x32,
-    0x44, 0x7C, 0xC8, 0x02, 0x04, 0x8B, 0xD3, 0x04, 0x22, 0x79, 0x69, 0x52, 0xC1, 0x8B, 0x48, 0x47,
-    0xBD, 0x1A, 0x4F, 0x5E, 0xB8, 0x8D, 0x49, 0x1A, 0xB5, 0x1C, 0x50, 0x73, 0xAA, 0x29, 0x17, 0x7D,
-    0xB4, 0x77, 0x0C, 0x4B, 0xAD, 0x79, 0x13, 0x22, 0xB2, 0x26, 0x10, 0x63, 0xA8, 0x71, 0x00, 0x47,
-    0xA6, 0x2F, 0x04, 0x5B, 0x79, 0x52, 0x6B, 0x88, 0x7A, 0x6A, 0x06, 0x9E, 0x7A, 0x79, 0x69, 0x1B,
-    0x79, 0x4C, 0x07, 0x76, 0xA2, 0xFD, 0x7B, 0x53, 0xB4, 0xFA, 0x85, 0x2C, 0x9E, 0x91, 0x81, 0x9B,
-    0xB0, 0x8E, 0x8B, 0x34, 0xA2, 0xFF, 0x92, 0x11, 0x9F, 0x93, 0x98, 0x00, 0x44, 0x4B, 0x0F, 0x73,
-    0x62, 0x60, 0x0A, 0x5F, 0x54, 0x5C, 0x63, 0x7C, 0x72, 0x65, 0x5F, 0x46, 0x45, 0x83, 0x0C, 0x1A,
-    0x55, 0x7C, 0x61, 0x16, 0x85, 0x5C, 0x26, 0x8E, 0x9C, 0x73, 0x15, 0x23, 0x9A, 0x37, 0x18, 0x82,
-    0xDC, 0xCF, 0xAD, 0x3D, 0x1C, 0xE1, 0xFC, 0x3C, 0xD8, 0x70, 0x31, 0x3D, 0xCC, 0x31, 0xE4, 0x40,
-    0x01, 0xDF, 0x14, 0xC1, 0xD1, 0x3C, 0x39, 0x41, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x33, 0x31, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x70, 0xCF, 0x43, 0x77, 0x76, 0xF0, 0x60,
-    0x8D, 0x73, 0xEE, 0x60, 0x65, 0x5F, 0xD2, 0x78, 0x71, 0x68, 0xFF, 0x79, 0x93, 0x63, 0xFC, 0x70,
-    0x65, 0x82, 0xCE, 0x15, 0x71, 0x8B, 0xFB, 0x21, 0x94, 0x86, 0xF8, 0x49, 0xDF, 0x5E, 0x82, 0x1C,
-    0xDF, 0x47, 0x84, 0x6A, 0xDF, 0x55, 0x8B, 0x09, 0xDF, 0x51, 0x7B, 0x5D, 0xFE, 0x43, 0x82, 0x64,
-    0xFE, 0x51, 0x89, 0x85, 0xFE, 0x5A, 0x7F, 0x2A, 0xFE, 0x4D, 0x78, 0x4A, 0xD0, 0x76, 0xA9, 0x1E,
-    0xCF, 0x45, 0xAF, 0x6B, 0xD0, 0x54, 0xBD, 0x86, 0xD0, 0x6D, 0xBA, 0x08, 0xCF, 0x66, 0x9C, 0x53,
-    0xCF, 0x4E, 0x9E, 0x5B, 0xF2, 0x40, 0xAC, 0x70, 0xF3, 0x50, 0xBA, 0x8B, 0xF3, 0x68, 0xB7, 0x0A,
-    0xF3, 0x71, 0xA6, 0x29, 0xF2, 0x62, 0x99, 0x48, 0xF2, 0x49, 0x9B, 0x66, 0x51, 0x38, 0x5A, 0x71,
-    0xF0, 0x00, 0x77, 0x6C, 0x54, 0x51, 0xCF, 0x79, 0xD0, 0x35, 0xC7, 0x8A, 0x52, 0x79, 0x53, 0x4D,
-    0xF2, 0x98, 0x66, 0x2C, 0x55, 0x92, 0xC8, 0x17, 0xD2, 0x8E, 0xBD, 0x25, 0xEC, 0x19, 0x4F, 0x5C,
-    0xED, 0x70, 0x45, 0x56, 0xFD, 0x0B, 0x6A, 0x65, 0xFF, 0x86, 0x5C, 0x2E, 0x42, 0x58, 0xB8, 0x79,
-    0x40, 0x47, 0x68, 0x9F, 0x41, 0x74, 0x63, 0x4E, 0x43, 0x85, 0xB3, 0x22, 0x02, 0x52, 0xC3, 0x78,
-    0x00, 0x61, 0x54, 0x9B, 0x03, 0x9D, 0xBB, 0x1B, 0xD5, 0x52, 0xD9, 0x3A, 0x55, 0x76, 0xE1, 0x04,
-    0xD5, 0x7A, 0xD4, 0x32, 0x43, 0x72, 0xC6, 0x02, 0x03, 0x7B, 0xCF, 0x03, 0x22, 0x61, 0x67, 0x59,
-    0xC1, 0x84, 0x47, 0x47, 0xBF, 0x11, 0x54, 0x63, 0xB8, 0x85, 0x48, 0x1A, 0xB6, 0x12, 0x55, 0x73,
-    0xAC, 0x17, 0x1B, 0x7D, 0xB5, 0x67, 0x0B, 0x4B, 0xAD, 0x6A, 0x12, 0x22, 0xB4, 0x15, 0x14, 0x63,
-    0xA9, 0x5F, 0x00, 0x4F, 0xA8, 0x1B, 0x08, 0x5B, 0x79, 0x44, 0x6C, 0x88, 0x7B, 0x52, 0x06, 0x9E,
-    0x7A, 0x6C, 0x68, 0x19, 0x7B, 0x33, 0x09, 0x77, 0x9F, 0xFA, 0x73, 0x53, 0xB2, 0xFA, 0x7D, 0x28,
-    0x9E, 0x8C, 0x7F, 0x9B, 0xB0, 0x8C, 0x89, 0x34, 0xA0, 0xFF, 0x8A, 0x11, 0x9E, 0x91, 0x96, 0x0F,
-    0x45, 0x2C, 0x10, 0x73, 0x63, 0x45, 0x0A, 0x5F, 0x54, 0x49, 0x63, 0x7C, 0x72, 0x56, 0x5F, 0x34,
-    0x46, 0x66, 0x09, 0x1A, 0x55, 0x6A, 0x5F, 0x1B, 0x86, 0x48, 0x27, 0x8F, 0x9C, 0x61, 0x14, 0x23,
-    0x9B, 0x24, 0x1B, 0x82, 0xDC, 0xCF, 0xAD, 0x3D, 0x1C, 0xE1, 0xFC, 0x3C, 0xD8, 0x70, 0x31, 0x3D,
-    0xD7, 0xD4, 0xF0, 0x40, 0x01, 0xDF, 0x14, 0xC1, 0xD1, 0x3C, 0x39, 0x41, 0x73, 0x74, 0x61, 0x6E,
-    0x64, 0x33, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x70, 0xCF, 0x43,
-    0x77, 0x76, 0xF0, 0x60, 0x8D, 0x73, 0xEE, 0x60, 0x65, 0x5F, 0xD2, 0x78, 0x71, 0x68, 0xFF, 0x79,
-    0x93, 0x63, 0xFC, 0x70, 0x65, 0x82, 0xCE, 0x15, 0x71, 0x8B, 0xFB, 0x21, 0x94, 0x86, 0xF8, 0x49,
-    0xDF, 0x5E, 0x82, 0x1C, 0xDF, 0x47, 0x84, 0x6A, 0xDF, 0x55, 0x8B, 0x09, 0xDF, 0x51, 0x7B, 0x5D,
-    0xFE, 0x43, 0x82, 0x64, 0xFE, 0x51, 0x89, 0x85, 0xFE, 0x5A, 0x7F, 0x2A, 0xFE, 0x4D, 0x78, 0x4A,
-    0xD0, 0x76, 0xA9, 0x1E, 0xCF, 0x45, 0xAF, 0x6B, 0xD0, 0x54, 0xBD, 0x86, 0xD0, 0x6D, 0xBA, 0x08,
-    0xCF, 0x66, 0x9C, 0x53, 0xCF, 0x4E, 0x9E, 0x5B, 0xF2, 0x40, 0xAC, 0x70, 0xF3, 0x50, 0xBA, 0x8B,
-    0xF3, 0x68, 0xB7, 0x0A, 0xF3, 0x71, 0xA6, 0x29, 0xF2, 0x62, 0x99, 0x48, 0xF2, 0x49, 0x9B, 0x66,
-    0x51, 0x38, 0x5A, 0x71, 0xF0, 0x00, 0x77, 0x6C, 0x54, 0x51, 0xCF, 0x79, 0xD0, 0x35, 0xC7, 0x8A,
-    0x52, 0x79, 0x53, 0x4D, 0xF2, 0x98, 0x66, 0x2C, 0x55, 0x92, 0xC8, 0x17, 0xD2, 0x8E, 0xBD, 0x25,
-    0xEC, 0x19, 0x4F, 0x5C, 0xED, 0x70, 0x45, 0x56, 0xFD, 0x0B, 0x6A, 0x65, 0xFF, 0x86, 0x5C, 0x2E,
-    0x42, 0x58, 0xB8, 0x79, 0x40, 0x47, 0x68, 0x9F, 0x41, 0x74, 0x63, 0x4E, 0x43, 0x85, 0xB3, 0x22,
-    0x02, 0x52, 0xC3, 0x78, 0x00, 0x61, 0x54, 0x9B, 0x03, 0x9D, 0xBB, 0x1B, 0xD5, 0x52, 0xD9, 0x3A,
-    0x55, 0x76, 0xE1, 0x04, 0xD5, 0x7A, 0xD4, 0x32, 0x43, 0x72, 0xC6, 0x02, 0x03, 0x7B, 0xCF, 0x03,
-    0x22, 0x61, 0x67, 0x59, 0xC1, 0x84, 0x47, 0x47, 0xBF, 0x11, 0x54, 0x63, 0xB8, 0x85, 0x48, 0x1A,
-    0xB6, 0x12, 0x55, 0x73, 0xAC, 0x17, 0x1B, 0x7D, 0xB5, 0x67, 0x0B, 0x4B, 0xAD, 0x6A, 0x12, 0x22,
-    0xB4, 0x15, 0x14, 0x63, 0xA9, 0x5F, 0x00, 0x4F, 0xA8, 0x1B, 0x08, 0x5B, 0x79, 0x44, 0x6C, 0x88,
-    0x7B, 0x52, 0x06, 0x9E, 0x7A, 0x6C, 0x68, 0x19, 0x7B, 0x33, 0x09, 0x77, 0x9F, 0xFA, 0x73, 0x53,
-    0xB2, 0xFA, 0x7D, 0x28, 0x9E, 0x8C, 0x7F, 0x9B, 0xB0, 0x8C, 0x89, 0x34, 0xA0, 0xFF, 0x8A, 0x11,
-    0x9E, 0x91, 0x96, 0x0F, 0x45, 0x2C, 0x10, 0x73, 0x63, 0x45, 0x0A, 0x5F, 0x54, 0x49, 0x63, 0x7C,
-    0x72, 0x56, 0x5F, 0x34, 0x46, 0x66, 0x09, 0x1A, 0x55, 0x6A, 0x5F, 0x1B, 0x86, 0x48, 0x27, 0x8F,
-    0x9C, 0x61, 0x14, 0x23, 0x9B, 0x24, 0x1B, 0x82, 0xF9, 0xE3, 0xAD, 0x3D, 0x16, 0x12, 0xFD, 0x3C,
-    0x95, 0x9D, 0x33, 0x3D, 0x6A, 0x0D, 0xCD, 0x40, 0xA7, 0xDC, 0x15, 0xC1, 0xD1, 0xE3, 0x2E, 0x41,
-    0x73, 0x74, 0x61, 0x6E, 0x64, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x6D, 0xD0, 0x43, 0x79, 0x71, 0xF0, 0x55, 0x8F, 0x6E, 0xED, 0x55, 0x66, 0x5D, 0xD3, 0x78,
-    0x73, 0x62, 0xFF, 0x79, 0x95, 0x5D, 0xFA, 0x70, 0x67, 0x80, 0xD0, 0x15, 0x74, 0x85, 0xFC, 0x23,
-    0x96, 0x81, 0xF7, 0x49, 0xDF, 0x5E, 0x7D, 0x1E, 0xDF, 0x47, 0x7F, 0x6A, 0xE0, 0x54, 0x86, 0x09,
-    0xDF, 0x51, 0x76, 0x5D, 0xFE, 0x42, 0x7B, 0x64, 0xFF, 0x4F, 0x82, 0x85, 0xFE, 0x59, 0x79, 0x2A,
-    0xFE, 0x4D, 0x71, 0x4A, 0xD1, 0x73, 0xA6, 0x1E, 0xD0, 0x42, 0xAA, 0x6B, 0xD1, 0x51, 0xB8, 0x86,
-    0xD2, 0x69, 0xB6, 0x08, 0xD0, 0x65, 0x98, 0x53, 0xD0, 0x4C, 0x9A, 0x5B, 0xF3, 0x3D, 0xA5, 0x70,
-    0xF4, 0x4C, 0xB3, 0x8B, 0xF5, 0x65, 0xB1, 0x0D, 0xF4, 0x6E, 0xA1, 0x29, 0xF3, 0x60, 0x93, 0x48,
-    0xF3, 0x47, 0x95, 0x66, 0x51, 0x3C, 0x5D, 0x71, 0xF0, 0x00, 0x6F, 0x6C, 0x56, 0x4F, 0xD1, 0x79,
-    0xD2, 0x31, 0xC0, 0x8A, 0x52, 0x7E, 0x57, 0x4D, 0xF2, 0x99, 0x62, 0x2C, 0x57, 0x90, 0xCC, 0x17,
-    0xD3, 0x8B, 0xB9, 0x25, 0xEB, 0x1C, 0x48, 0x5D, 0xED, 0x73, 0x41, 0x56, 0xFD, 0x0B, 0x61, 0x65,
-    0xFF, 0x87, 0x57, 0x2E, 0x44, 0x57, 0xBB, 0x79, 0x41, 0x4B, 0x6C, 0x9F, 0x41, 0x78, 0x68, 0x4E,
-    0x45, 0x85, 0xB7, 0x21, 0x04, 0x52, 0xC9, 0x78, 0x00, 0x67, 0x5C, 0x9B, 0x05, 0x9D, 0xC3, 0x1B,
-    0xD6, 0x4D, 0xD3, 0x3A, 0x57, 0x73, 0xE3, 0x04, 0xD7, 0x75, 0xD0, 0x32, 0x45, 0x71, 0xCA, 0x02,
-    0x05, 0x7B, 0xD7, 0x03, 0x22, 0x66, 0x6D, 0x59, 0xC0, 0x87, 0x46, 0x47, 0xBF, 0x13, 0x50, 0x63,
-    0xB8, 0x89, 0x47, 0x1A, 0xB6, 0x15, 0x51, 0x73, 0xAB, 0x1E, 0x19, 0x7D, 0xB4, 0x6E, 0x0B, 0x4B,
-    0xAC, 0x70, 0x12, 0x22, 0xB2, 0x1C, 0x12, 0x63, 0xA7, 0x67, 0x00, 0x4F, 0xA6, 0x22, 0x06, 0x5B,
-    0x79, 0x47, 0x6D, 0x88, 0x7A, 0x5A, 0x08, 0x9E, 0x7A, 0x6F, 0x6A, 0x19, 0x79, 0x3B, 0x0A, 0x76,
-    0xA0, 0xFB, 0x76, 0x53, 0xB2, 0xFB, 0x7F, 0x2C, 0x9E, 0x8D, 0x7F, 0x9B, 0xB1, 0x8C, 0x88, 0x34,
-    0xA1, 0xFF, 0x8D, 0x11, 0x9F, 0x90, 0x96, 0x00, 0x44, 0x35, 0x14, 0x73, 0x61, 0x4E, 0x0D, 0x5F,
-    0x54, 0x4D, 0x66, 0x7C, 0x72, 0x59, 0x60, 0x46, 0x44, 0x6F, 0x0F, 0x1A, 0x55, 0x6E, 0x63, 0x16,
-    0x85, 0x4F, 0x28, 0x8E, 0x9B, 0x68, 0x15, 0x23, 0x9A, 0x2B, 0x1A, 0x82, 0x2D, 0xD3, 0xAD, 0x3D,
-    0x5E, 0x89, 0xFC, 0x3C, 0x51, 0x72, 0x35, 0x3D, 0xF2, 0xB2, 0xBE, 0x40, 0x36, 0x19, 0x17, 0xC1,
-    0x55, 0x02, 0x25, 0x41, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x33, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x72, 0x6A, 0xD1, 0x43, 0x7C, 0x6C, 0xF0, 0x55, 0x91, 0x68, 0xEC, 0x55,
-    0x68, 0x59, 0xD4, 0x78, 0x76, 0x5C, 0xFF, 0x79, 0x98, 0x57, 0xF8, 0x70, 0x69, 0x7D, 0xD2, 0x15,
-    0x76, 0x80, 0xFD, 0x23, 0x98, 0x7A, 0xF6, 0x49, 0xE0, 0x5D, 0x78, 0x1E, 0xE0, 0x46, 0x79, 0x6B,
-    0xE0, 0x53, 0x81, 0x0E, 0xDF, 0x51, 0x71, 0x59, 0xFE, 0x41, 0x73, 0x62, 0xFF, 0x4E, 0x7A, 0x85,
-    0xFF, 0x59, 0x72, 0x2A, 0xFE, 0x4C, 0x6A, 0x4A, 0xD2, 0x71, 0xA2, 0x1E, 0xD1, 0x3F, 0xA4, 0x6B,
-    0xD2, 0x4D, 0xB2, 0x86, 0xD3, 0x66, 0xB1, 0x08, 0xD1, 0x63, 0x93, 0x53, 0xD1, 0x4A, 0x95, 0x5B,
-    0xF4, 0x3A, 0x9D, 0x70, 0xF5, 0x48, 0xAB, 0x8C, 0xF6, 0x61, 0xAA, 0x0D, 0xF5, 0x6C, 0x9B, 0x29,
-    0xF4, 0x5E, 0x8C, 0x48, 0xF4, 0x45, 0x8E, 0x66, 0x51, 0x40, 0x5F, 0x5B, 0xF0, 0x00, 0x66, 0x6E,
-    0x58, 0x4C, 0xD3, 0x79, 0xD3, 0x2D, 0xBA, 0x8A, 0x52, 0x82, 0x5C, 0x9E, 0xF2, 0x9A, 0x5E, 0x2C,
-    0x59, 0x8E, 0xCF, 0x17, 0xD5, 0x87, 0xB6, 0x25, 0xEB, 0x1E, 0x41, 0x5D, 0xEC, 0x76, 0x3D, 0x56,
-    0xFD, 0x0C, 0x58, 0x66, 0xFF, 0x88, 0x52, 0x2E, 0x45, 0x56, 0xBE, 0x79, 0x41, 0x4F, 0x6F, 0x9F,
-    0x42, 0x7C, 0x6D, 0x9E, 0x46, 0x84, 0xBC, 0x21, 0x05, 0x51, 0xD0, 0x78, 0x00, 0x6D, 0x65, 0x9B,
-    0x07, 0x9D, 0xCC, 0x1B, 0xD8, 0x48, 0xCD, 0x3A, 0x59, 0x6F, 0xE6, 0x05, 0xD9, 0x70, 0xCB, 0x32,
-    0x47, 0x6F, 0xCE, 0x02, 0x07, 0x79, 0xDE, 0x04, 0x23, 0x6A, 0x74, 0x52, 0xC0, 0x8B, 0x45, 0x47,
-    0xBE, 0x16, 0x4B, 0x5E, 0xB8, 0x8C, 0x47, 0x1A, 0xB6, 0x18, 0x4D, 0x73, 0xA9, 0x24, 0x16, 0x7D,
-    0xB2, 0x76, 0x0A, 0x4B, 0xAB, 0x78, 0x12, 0x17, 0xB1, 0x22, 0x0E, 0x63, 0xA6, 0x6F, 0x00, 0x4F,
-    0xA5, 0x2A, 0x04, 0x5B, 0x7A, 0x4A, 0x6D, 0x88, 0x78, 0x63, 0x0A, 0x1A, 0x7A, 0x72, 0x6B, 0x19,
-    0x78, 0x44, 0x0C, 0x77, 0xA1, 0xFD, 0x7A, 0x4E, 0xB3, 0xFB, 0x81, 0x2C, 0x9F, 0x8D, 0x7F, 0x9B,
-    0xB2, 0x8C, 0x87, 0x34, 0xA2, 0xFF, 0x91, 0x03, 0xA0, 0x90, 0x96, 0x00, 0x42, 0x3E, 0x18, 0x73,
-    0x60, 0x56, 0x10, 0x55, 0x55, 0x51, 0x69, 0x7C, 0x72, 0x5D, 0x62, 0x46, 0x43, 0x78, 0x15, 0x1A,
-    0x55, 0x72, 0x67, 0x16, 0x84, 0x55, 0x29, 0x8E, 0x9A, 0x6F, 0x15, 0x23, 0x99, 0x32, 0x19, 0x82,
-    0x8A, 0xE8, 0xAD, 0x3D, 0xDE, 0x30, 0xFB, 0x3C, 0xE9, 0xD9, 0x36, 0x3D, 0x39, 0xD5, 0xB1, 0x40,
-    0x4F, 0x9C, 0x18, 0xC1, 0x71, 0x2E, 0x1D, 0x41, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x33, 0x35, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x66, 0xD2, 0x43, 0x7E, 0x66, 0xF1, 0x55,
-    0x93, 0x62, 0xEB, 0x55, 0x6A, 0x55, 0xD5, 0x78, 0x78, 0x55, 0xFF, 0x79, 0x9A, 0x50, 0xF6, 0x69,
-    0x6B, 0x79, 0xD4, 0x15, 0x79, 0x79, 0xFE, 0x23, 0x9B, 0x73, 0xF5, 0x49, 0xE0, 0x5D, 0x73, 0x1E,
-    0xE0, 0x46, 0x73, 0x6B, 0xE0, 0x52, 0x7B, 0x0E, 0xDF, 0x51, 0x6B, 0x59, 0xFE, 0x41, 0x6B, 0x62,
-    0xFF, 0x4D, 0x73, 0x85, 0xFF, 0x58, 0x6B, 0x2A, 0xFE, 0x4C, 0x63, 0x4A, 0xD3, 0x6E, 0x9E, 0x1E,
-    0xD2, 0x3C, 0x9F, 0x6B, 0xD3, 0x49, 0xAD, 0x86, 0xD4, 0x62, 0xAD, 0x08, 0xD2, 0x61, 0x8F, 0x53,
-    0xD1, 0x48, 0x90, 0x5B, 0xF5, 0x37, 0x95, 0x62, 0xF6, 0x44, 0xA4, 0x8C, 0xF7, 0x5D, 0xA3, 0x0D,
-    0xF6, 0x69, 0x94, 0x29, 0xF4, 0x5C, 0x86, 0x48, 0xF4, 0x43, 0x86, 0x5F, 0x51, 0x44, 0x62, 0x9F,
-    0xEF, 0x00, 0x5E, 0x6D, 0x59, 0x48, 0xD4, 0x79, 0xD4, 0x28, 0xB4, 0x6E, 0x52, 0x87, 0x61, 0x1D,
-    0xF2, 0x9B, 0x5A, 0x2C, 0x5A, 0x8B, 0xD3, 0x17, 0xD6, 0x83, 0xB2, 0x25, 0xEA, 0x21, 0x3A, 0x5D,
-    0xEB, 0x79, 0x38, 0x56, 0xFC, 0x0C, 0x4F, 0x66, 0xFF, 0x8A, 0x4D, 0x2E, 0x47, 0x54, 0xC2, 0x7A,
-    0x41, 0x52, 0x74, 0x9F, 0x42, 0x80, 0x73, 0x9E, 0x48, 0x83, 0xC1, 0x21, 0x07, 0x50, 0xD7, 0x78,
-    0x00, 0x72, 0x6E, 0x9B, 0x08, 0x9C, 0xD5, 0x16, 0xDA, 0x42, 0xC7, 0x3A, 0x5B, 0x6B, 0xE8, 0x05,
-    0xDA, 0x6B, 0xC6, 0x32, 0x48, 0x6C, 0xD1, 0x02, 0x09, 0x77, 0xE6, 0x04, 0x23, 0x6E, 0x7A, 0x52,
-    0xBF, 0x8F, 0x43, 0x47, 0xBD, 0x19, 0x46, 0x5E, 0xB7, 0x90, 0x46, 0x1A, 0xB5, 0x1B, 0x48, 0x73,
-    0xA8, 0x2B, 0x13, 0x78, 0xB1, 0x7D, 0x0A, 0x4B, 0xA9, 0x7F, 0x12, 0x17, 0xAF, 0x29, 0x0B, 0x5C,
-    0xA4, 0x77, 0x00, 0x4F, 0xA3, 0x32, 0x02, 0x5B, 0x7A, 0x4C, 0x6E, 0x88, 0x77, 0x6C, 0x0C, 0x1A,
-    0x7A, 0x74, 0x6D, 0x1B, 0x76, 0x4C, 0x0D, 0x77, 0xA1, 0xFE, 0x7D, 0x4E, 0xB4, 0xFC, 0x84, 0x2C,
-    0x9F, 0x8E, 0x7F, 0x94, 0xB2, 0x8C, 0x86, 0x34, 0xA3, 0xFF, 0x94, 0x03, 0xA1, 0x8F, 0x96, 0x00,
-    0x41, 0x47, 0x1C, 0x71, 0x5F, 0x5F, 0x14, 0x55, 0x54, 0x54, 0x6C, 0x7C, 0x72, 0x60, 0x64, 0x46,
-    0x42, 0x81, 0x1B, 0x1B, 0x55, 0x76, 0x6B, 0x16, 0x83, 0x5C, 0x2A, 0x8E, 0x99, 0x77, 0x16, 0x23,
-    0x98, 0x38, 0x17, 0x6A, 0xAB, 0xCA, 0xAD, 0x3D, 0x53, 0xB0, 0xF9, 0x3C, 0xC5, 0x55, 0x38, 0x3D,
-    0xA6, 0xCE, 0x99, 0x40, 0xC9, 0x44, 0x1A, 0xC1, 0x31, 0x83, 0x10, 0x41, 0x73, 0x74, 0x61, 0x6E,
-    0x64, 0x33, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x61, 0xD3, 0x43,
-    0x80, 0x5F, 0xF1, 0x54, 0x95, 0x5B, 0xE9, 0x55, 0x6C, 0x51, 0xD6, 0x78, 0x7A, 0x4E, 0xFF, 0x7A,
-    0x9C, 0x48, 0xF4, 0x69, 0x6C, 0x75, 0xD6, 0x15, 0x7B, 0x71, 0xFF, 0x23, 0x9D, 0x6C, 0xF4, 0x49,
-    0xE0, 0x5C, 0x6E, 0x1E, 0xE0, 0x45, 0x6E, 0x6B, 0xE1, 0x50, 0x76, 0x0E, 0xDF, 0x51, 0x66, 0x59,
-    0xFE, 0x40, 0x64, 0x62, 0xFF, 0x4B, 0x6C, 0x8B, 0xFF, 0x57, 0x64, 0x2A, 0xFE, 0x4C, 0x5C, 0x56,
-    0xD4, 0x6B, 0x99, 0x1E, 0xD3, 0x39, 0x99, 0x6B, 0xD4, 0x45, 0xA8, 0x86, 0xD5, 0x5E, 0xA8, 0x08,
-    0xD2, 0x5F, 0x8B, 0x53, 0xD2, 0x46, 0x8B, 0x5B, 0xF5, 0x33, 0x8E, 0x62, 0xF7, 0x3F, 0x9C, 0x8C,
-    0xF7, 0x58, 0x9C, 0x0D, 0xF6, 0x65, 0x8E, 0x29, 0xF5, 0x59, 0x7F, 0x48, 0xF4, 0x40, 0x7F, 0x5F,
-    0x50, 0x48, 0x65, 0x9F, 0xEF, 0x00, 0x55, 0x6D, 0x5B, 0x44, 0xD6, 0x79, 0xD5, 0x23, 0xAD, 0x6E,
-    0x52, 0x8B, 0x66, 0x1D, 0xF2, 0x9C, 0x56, 0x2C, 0x5C, 0x87, 0xD6, 0x17, 0xD7, 0x7F, 0xAE, 0x25,
-    0xE8, 0x23, 0x33, 0x5D, 0xEA, 0x7C, 0x34, 0x56, 0xFB, 0x0D, 0x46, 0x66, 0xFE, 0x8B, 0x47, 0x2E,
-    0x48, 0x52, 0xC5, 0x7A, 0x41, 0x55, 0x78, 0x9F, 0x42, 0x83, 0x78, 0x9E, 0x49, 0x80, 0xC5, 0x21,
-    0x09, 0x4D, 0xDD, 0x78, 0x00, 0x77, 0x77, 0x94, 0x0A, 0x9A, 0xDE, 0x16, 0xDB, 0x3C, 0xC1, 0x38,
-    0x5D, 0x65, 0xEB, 0x05, 0xDC, 0x65, 0xC1, 0x32, 0x4A, 0x69, 0xD5, 0x02, 0x0B, 0x73, 0xEE, 0x04,
-    0x23, 0x71, 0x81, 0x52, 0xBF, 0x92, 0x42, 0x47, 0xBC, 0x1C, 0x42, 0x5E, 0xB7, 0x93, 0x45, 0x1A,
-    0xB4, 0x1D, 0x44, 0x73, 0xA6, 0x31, 0x11, 0x78, 0xAF, 0x85, 0x09, 0x4B, 0xA8, 0x86, 0x12, 0x17,
-    0xAD, 0x30, 0x09, 0x5C, 0xA2, 0x80, 0x01, 0x47, 0xA1, 0x3A, 0x00, 0x5B, 0x79, 0x4E, 0x6F, 0x6A,
-    0x75, 0x74, 0x0F, 0x1A, 0x7A, 0x76, 0x6F, 0x1B, 0x75, 0x55, 0x0F, 0x77, 0xA2, 0xFF, 0x81, 0x4E,
-    0xB5, 0xFC, 0x86, 0x2C, 0xA0, 0x8E, 0x80, 0x94, 0xB3, 0x8B, 0x85, 0x46, 0xA4, 0xFE, 0x97, 0x03,
-    0xA2, 0x8E, 0x96, 0x00, 0x3F, 0x4F, 0x21, 0x71, 0x5D, 0x68, 0x17, 0x55, 0x54, 0x57, 0x6F, 0x7C,
-    0x72, 0x63, 0x66, 0x46, 0x41, 0x8A, 0x21, 0x1B, 0x55, 0x78, 0x6F, 0x16, 0x82, 0x62, 0x2B, 0x8E,
-    0x97, 0x7E, 0x17, 0x23, 0x96, 0x3F, 0x16, 0x6A, 0x09, 0x77, 0xAD, 0x3D, 0xCA, 0x1F, 0xF8, 0x3C,
-    0x12, 0xF5, 0x3A, 0x3D, 0x2A, 0x0E, 0x73, 0x40, 0x95, 0x47, 0x1D, 0xC1, 0x3B, 0x04, 0x03, 0x41,
-    0x73, 0x74, 0x61, 0x6E, 0x64, 0x33, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x77, 0x5C, 0xD4, 0x43, 0x82, 0x57, 0xF0, 0x54, 0x97, 0x54, 0xE7, 0x54, 0x6D, 0x4B, 0xD7, 0x78,
-    0x7D, 0x45, 0xFE, 0x7A, 0x9E, 0x3F, 0xF1, 0x69, 0x6E, 0x6F, 0xD8, 0x15, 0x7E, 0x69, 0xFF, 0x23,
-    0x9F, 0x63, 0xF2, 0x49, 0xE0, 0x5B, 0x69, 0x1E, 0xDF, 0x44, 0x69, 0x6B, 0xE1, 0x4F, 0x71, 0x0E,
-    0xDF, 0x50, 0x61, 0x59, 0xFE, 0x3F, 0x5D, 0x62, 0xFF, 0x4A, 0x65, 0x8B, 0xFE, 0x56, 0x5D, 0x2A,
-    0xFD, 0x4B, 0x55, 0x56, 0xD5, 0x68, 0x95, 0x20, 0xD3, 0x35, 0x94, 0x68, 0xD5, 0x40, 0xA2, 0x86,
-    0xD6, 0x59, 0xA3, 0x0A, 0xD3, 0x5C, 0x87, 0x53, 0xD2, 0x43, 0x86, 0x58, 0xF6, 0x2F, 0x86, 0x62,
-    0xF8, 0x3B, 0x95, 0x8C, 0xF8, 0x54, 0x96, 0x0D, 0xF7, 0x62, 0x88, 0x29, 0xF5, 0x57, 0x79, 0x47,
-    0xF5, 0x3E, 0x78, 0x5F, 0x50, 0x4A, 0x69, 0x9F, 0xEE, 0x00, 0x4D, 0x6D, 0x5C, 0x3F, 0xD7, 0x79,
-    0xD6, 0x1E, 0xA7, 0x6E, 0x52, 0x8D, 0x6B, 0x1D, 0xF2, 0x9D, 0x53, 0x2C, 0x5E, 0x82, 0xDA, 0x17,
-    0xD8, 0x7A, 0xAA, 0x25, 0xE7, 0x26, 0x2D, 0x5D, 0xEA, 0x7F, 0x30, 0x56, 0xFA, 0x0E, 0x3F, 0x66,
-    0xFE, 0x8C, 0x43, 0x2E, 0x49, 0x4E, 0xC8, 0x7A, 0x41, 0x56, 0x7D, 0x9F, 0x42, 0x84, 0x7E, 0x9E,
-    0x4A, 0x7D, 0xCA, 0x21, 0x0A, 0x49, 0xE4, 0x78, 0x00, 0x7A, 0x81, 0x94, 0x0C, 0x96, 0xE7, 0x16,
-    0xDC, 0x35, 0xBA, 0x38, 0x5F, 0x5F, 0xEC, 0x05, 0xDD, 0x5E, 0xBC, 0x32, 0x4C, 0x64, 0xD8, 0x84,
-    0x0D, 0x6E, 0xF5, 0x04, 0x23, 0x72, 0x88, 0x52, 0xBE, 0x95, 0x42, 0x26, 0xBB, 0x1E, 0x3E, 0x5E,
-    0xB6, 0x97, 0x45, 0x1A, 0xB3, 0x20, 0x41, 0x73, 0xA4, 0x38, 0x10, 0x78, 0xAD, 0x8C, 0x0B, 0x4B,
-    0xA6, 0x8D, 0x13, 0x17, 0xAB, 0x37, 0x08, 0x5C, 0xA1, 0x88, 0x03, 0x47, 0x9F, 0x42, 0x00, 0x5B,
-    0x79, 0x4F, 0x70, 0x6A, 0x74, 0x7C, 0x13, 0x1A, 0x7A, 0x78, 0x71, 0x1B, 0x73, 0x5C, 0x12, 0x77,
-    0xA3, 0xFF, 0x84, 0x4E, 0xB6, 0xFB, 0x89, 0x2C, 0xA0, 0x8E, 0x80, 0x94, 0xB3, 0x8A, 0x84, 0x46,
-    0xA5, 0xFD, 0x9B, 0x03, 0xA3, 0x8C, 0x96, 0x02, 0x3E, 0x57, 0x27, 0x71, 0x5C, 0x6F, 0x1D, 0x55,
-    0x54, 0x59, 0x73, 0x7C, 0x72, 0x65, 0x68, 0x46, 0x3F, 0x92, 0x29, 0x1B, 0x55, 0x7B, 0x74, 0x16,
-    0x80, 0x67, 0x2D, 0x8E, 0x96, 0x84, 0x19, 0x23, 0x94, 0x46, 0x17, 0x6A, 0x62, 0xED, 0xAC, 0x3D,
-    0x20, 0xB2, 0xF5, 0x3C, 0x2D, 0x03, 0x3D, 0x3D, 0x8E, 0xBF, 0x15, 0x40, 0x1B, 0xC6, 0x20, 0xC1,
-    0x6D, 0xD9, 0xE8, 0x40, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x33, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0xD4, 0x43, 0x84, 0x4F, 0xEF, 0x54, 0x99, 0x4B, 0xE6, 0x54,
-    0x6F, 0x45, 0xD7, 0x7A, 0x7F, 0x3C, 0xFD, 0x7A, 0xA1, 0x36, 0xED, 0x69, 0x70, 0x69, 0xDA, 0x11,
-    0x80, 0x60, 0xFF, 0x23, 0xA2, 0x5A, 0xF0, 0x26, 0xE0, 0x5B, 0x65, 0x1E, 0xDF, 0x43, 0x63, 0x6B,
-    0xE1, 0x4D, 0x6C, 0x0E, 0xDF, 0x50, 0x5D, 0x59, 0xFE, 0x3E, 0x56, 0x63, 0xFF, 0x48, 0x5E, 0x8B,
-    0xFE, 0x56, 0x57, 0x2A, 0xFD, 0x4B, 0x4F, 0x56, 0xD6, 0x64, 0x91, 0x20, 0xD4, 0x31, 0x8E, 0x68,
-    0xD6, 0x3B, 0x9D, 0x87, 0xD7, 0x55, 0x9F, 0x0A, 0xD3, 0x5A, 0x83, 0x4E, 0xD3, 0x40, 0x81, 0x58,
-    0xF6, 0x2C, 0x7F, 0x62, 0xF8, 0x36, 0x8D, 0x8C, 0xF9, 0x4F, 0x8F, 0x31, 0xF8, 0x5E, 0x82, 0x29,
-    0xF6, 0x54, 0x73, 0x47, 0xF5, 0x3B, 0x72, 0x5F, 0x50, 0x4C, 0x6D, 0x9F, 0xED, 0x00, 0x46, 0x6D,
-    0x5E, 0x39, 0xD8, 0x79, 0xD7, 0x19, 0xA0, 0x6E, 0x52, 0x90, 0x71, 0x1D, 0xF2, 0x9E, 0x50, 0x2A,
-    0x60, 0x7C, 0xDD, 0x06, 0xDA, 0x75, 0xA6, 0x25, 0xE6, 0x29, 0x27, 0x5D, 0xE9, 0x82, 0x2D, 0x4F,
-    0xFA, 0x0F, 0x37, 0x66, 0xFD, 0x8E, 0x3F, 0x2E, 0x4B, 0x4A, 0xCB, 0x7A, 0x41, 0x57, 0x81, 0x9F,
-    0x42, 0x86, 0x84, 0x9E, 0x4C, 0x79, 0xCE, 0x06, 0x0C, 0x44, 0xEA, 0x78, 0x00, 0x7D, 0x8A, 0x94,
-    0x0E, 0x91, 0xEF, 0x16, 0xDE, 0x2F, 0xB4, 0x38, 0x62, 0x57, 0xEE, 0x05, 0xDF, 0x58, 0xB6, 0x32,
-    0x4D, 0x5E, 0xDC, 0x84, 0x0F, 0x68, 0xFC, 0x04, 0x23, 0x74, 0x90, 0x52, 0xBE, 0x98, 0x42, 0x26,
-    0xBA, 0x21, 0x3A, 0x5E, 0xB6, 0x9A, 0x46, 0x1A, 0xB2, 0x22, 0x3E, 0x73, 0xA2, 0x3E, 0x10, 0x78,
-    0xAC, 0x93, 0x0C, 0x49, 0xA5, 0x93, 0x15, 0x17, 0xA9, 0x3E, 0x06, 0x5C, 0x9F, 0x90, 0x04, 0x47,
-    0x9D, 0x49, 0x00, 0x58, 0x79, 0x50, 0x71, 0x6C, 0x72, 0x84, 0x17, 0x1A, 0x7A, 0x79, 0x74, 0x14,
-    0x71, 0x64, 0x15, 0x77, 0xA4, 0xFF, 0x88, 0x4E, 0xB7, 0xFA, 0x8B, 0x2C, 0xA1, 0x8D, 0x81, 0x94,
-    0xB4, 0x88, 0x84, 0x46, 0xA7, 0xFB, 0x9E, 0x01, 0xA3, 0x89, 0x97, 0x00, 0x3C, 0x5E, 0x2D, 0x71,
-    0x5A, 0x77, 0x22, 0x55, 0x54, 0x5A, 0x77, 0x7C, 0x71, 0x66, 0x6B, 0x46, 0x3E, 0x99, 0x31, 0x1B,
-    0x55, 0x7C, 0x79, 0x18, 0x7F, 0x6D, 0x30, 0x8E, 0x94, 0x8B, 0x1B, 0x23, 0x93, 0x4C, 0x17, 0x6A,
-    0xD2, 0x2F, 0xAC, 0x3D, 0xA0, 0x70, 0xF2, 0x3C, 0xE9, 0x6E, 0x41, 0x3D, 0xAA, 0x82, 0x1F, 0x3F,
-    0x7D, 0x2D, 0x21, 0xC1, 0xEB, 0xED, 0xC3, 0x40, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x33, 0x39, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x4F, 0xD2, 0x43, 0x86, 0x46, 0xEB, 0x54,
-    0x9B, 0x43, 0xE0, 0x54, 0x70, 0x3E, 0xD5, 0x78, 0x81, 0x32, 0xF8, 0x7A, 0xA3, 0x2D, 0xE7, 0x69,
-    0x72, 0x63, 0xD8, 0x11, 0x82, 0x56, 0xFB, 0x23, 0xA4, 0x51, 0xEA, 0x26, 0xE0, 0x5A, 0x5F, 0x1E,
-    0xDF, 0x42, 0x5D, 0x6B, 0xE1, 0x4C, 0x65, 0x0E, 0xDF, 0x50, 0x57, 0x52, 0xFD, 0x3D, 0x4E, 0x63,
-    0xFF, 0x47, 0x56, 0x8B, 0xFE, 0x55, 0x50, 0x2A, 0xFD, 0x4B, 0x47, 0x48, 0xD6, 0x60, 0x8B, 0x20,
-    0xD5, 0x2D, 0x87, 0x68, 0xD7, 0x37, 0x95, 0x87, 0xD8, 0x50, 0x98, 0x0A, 0xD4, 0x57, 0x7D, 0x4E,
-    0xD3, 0x3E, 0x7B, 0x58, 0xF7, 0x28, 0x75, 0x62, 0xF9, 0x31, 0x84, 0x8C, 0xFA, 0x4B, 0x86, 0x31,
-    0xF8, 0x5B, 0x7A, 0x29, 0xF6, 0x52, 0x6B, 0x47, 0xF5, 0x38, 0x69, 0x5F, 0x4F, 0x4E, 0x6F, 0x9F,
-    0xEC, 0x00, 0x3D, 0x6D, 0x5F, 0x32, 0xD6, 0x7A, 0xD8, 0x13, 0x98, 0x6E, 0x52, 0x92, 0x75, 0x1D,
-    0xF2, 0x9F, 0x4B, 0x2A, 0x62, 0x76, 0xDC, 0x07, 0xDB, 0x70, 0xA0, 0x25, 0xE5, 0x2B, 0x21, 0x59,
-    0xE8, 0x86, 0x29, 0x4F, 0xF9, 0x10, 0x2E, 0x66, 0xFD, 0x90, 0x3A, 0x2E, 0x4C, 0x45, 0xCB, 0x7A,
-    0x41, 0x58, 0x84, 0xA0, 0x42, 0x87, 0x88, 0x9E, 0x4D, 0x74, 0xCF, 0x06, 0x0D, 0x3E, 0xED, 0x78,
-    0x00, 0x7E, 0x92, 0x94, 0x10, 0x8C, 0xF4, 0x16, 0xDF, 0x28, 0xAB, 0x38, 0x64, 0x50, 0xEC, 0x05,
-    0xE0, 0x51, 0xAF, 0x31, 0x4F, 0x58, 0xDC, 0x84, 0x11, 0x61, 0xFF, 0x05, 0x24, 0x74, 0x94, 0x51,
-    0xBD, 0x9B, 0x41, 0x26, 0xB9, 0x23, 0x36, 0x5D, 0xB5, 0x9D, 0x45, 0x1B, 0xB1, 0x24, 0x3A, 0x72,
-    0xA1, 0x44, 0x0F, 0x78, 0xAA, 0x9B, 0x0D, 0x49, 0xA4, 0x9A, 0x16, 0x06, 0xA7, 0x45, 0x05, 0x5E,
-    0x9D, 0x98, 0x06, 0x1C, 0x9B, 0x51, 0x00, 0x58, 0x79, 0x50, 0x71, 0x6C, 0x70, 0x8B, 0x1B, 0x1A,
-    0x7A, 0x79, 0x74, 0x16, 0x6F, 0x6B, 0x18, 0x77, 0xA5, 0xFF, 0x8A, 0x4E, 0xB8, 0xFA, 0x8B, 0x2C,
-    0xA1, 0x8C, 0x80, 0x94, 0xB4, 0x87, 0x81, 0x46, 0xA8, 0xF9, 0x9E, 0x04, 0xA4, 0x87, 0x94, 0x02,
-    0x3B, 0x64, 0x32, 0x71, 0x58, 0x7E, 0x26, 0x55, 0x54, 0x5B, 0x78, 0x7D, 0x71, 0x68, 0x6B, 0x43,
-    0x3D, 0xA0, 0x37, 0x1B, 0x55, 0x7D, 0x7B, 0x18, 0x7E, 0x72, 0x31, 0x8E, 0x93, 0x92, 0x1D, 0x2D,
-    0x91, 0x52, 0x18, 0x6A, 0xB1, 0x42, 0xAB, 0x3D, 0xEE, 0x6D, 0xEE, 0x3C, 0xD1, 0x70, 0x47, 0x3D,
-    0xAA, 0xBB, 0xE2, 0xBF, 0x44, 0xC9, 0x23, 0xC1, 0xE8, 0x07, 0x94, 0x40, 0x73, 0x74, 0x61, 0x6E,
-    0x64, 0x34, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x48, 0xCD, 0x41,
-    0x89, 0x3D, 0xE4, 0x56, 0x9D, 0x3A, 0xD9, 0x56, 0x72, 0x37, 0xD0, 0x77, 0x83, 0x27, 0xF1, 0x7A,
-    0xA5, 0x23, 0xDE, 0x61, 0x73, 0x5C, 0xD4, 0x11, 0x85, 0x4C, 0xF5, 0x23, 0xA6, 0x47, 0xE2, 0x26,
-    0xE0, 0x59, 0x58, 0x1E, 0xDF, 0x41, 0x56, 0x68, 0xE1, 0x4A, 0x5E, 0x0C, 0xDF, 0x4F, 0x50, 0x52,
-    0xFD, 0x3D, 0x45, 0x63, 0xFF, 0x46, 0x4D, 0x8B, 0xFE, 0x55, 0x48, 0x2A, 0xFC, 0x4B, 0x40, 0x56,
-    0xD7, 0x5D, 0x84, 0x20, 0xD5, 0x29, 0x7E, 0x68, 0xD8, 0x31, 0x8D, 0x87, 0xD9, 0x4B, 0x8F, 0x0A,
-    0xD4, 0x54, 0x76, 0x4E, 0xD3, 0x3B, 0x73, 0x58, 0xF7, 0x24, 0x6C, 0x63, 0xFA, 0x2D, 0x7A, 0x6F,
-    0xFB, 0x46, 0x7D, 0x31, 0xF9, 0x58, 0x71, 0x29, 0xF6, 0x50, 0x63, 0x47, 0xF5, 0x36, 0x60, 0x55,
-    0x4F, 0x4F, 0x6F, 0x58, 0xEC, 0x00, 0x35, 0x6D, 0x61, 0x2B, 0xD2, 0x7A, 0xD9, 0x0D, 0x8E, 0x6E,
-    0x51, 0x94, 0x77, 0x1F, 0xF2, 0xA0, 0x46, 0x25, 0x64, 0x70, 0xDA, 0x07, 0xDC, 0x6B, 0x98, 0x25,
-    0xE4, 0x2E, 0x1B, 0x59, 0xE7, 0x89, 0x25, 0x4F, 0xF8, 0x11, 0x26, 0x5F, 0xFD, 0x92, 0x34, 0x33,
-    0x4D, 0x3F, 0xC8, 0x7A, 0x41, 0x58, 0x85, 0xA0, 0x43, 0x87, 0x8A, 0x1A, 0x4F, 0x6F, 0xCE, 0x06,
-    0x0F, 0x37, 0xED, 0x78, 0x00, 0x7F, 0x97, 0x94, 0x12, 0x86, 0xF5, 0x16, 0xE0, 0x21, 0xA1, 0x38,
-    0x65, 0x47, 0xE8, 0x86, 0xE2, 0x4A, 0xA5, 0x30, 0x50, 0x52, 0xD9, 0x84, 0x13, 0x59, 0xFF, 0x05,
-    0x24, 0x74, 0x97, 0x51, 0xBD, 0x9F, 0x3F, 0x26, 0xB8, 0x25, 0x31, 0x5D, 0xB5, 0xA0, 0x43, 0x1B,
-    0xB0, 0x27, 0x36, 0x72, 0x9F, 0x4A, 0x0D, 0x78, 0xA9, 0xA2, 0x0E, 0x49, 0xA2, 0xA1, 0x17, 0x06,
-    0xA6, 0x4B, 0x04, 0x5D, 0x9B, 0xA0, 0x08, 0x1C, 0x99, 0x58, 0x00, 0x58, 0x79, 0x50, 0x6F, 0x6C,
-    0x6F, 0x93, 0x1E, 0x1B, 0x7A, 0x7A, 0x73, 0x16, 0x6E, 0x72, 0x1A, 0x77, 0xA6, 0xFF, 0x89, 0x9E,
-    0xB9, 0xF9, 0x8A, 0x2C, 0xA2, 0x8B, 0x7D, 0x94, 0xB5, 0x85, 0x7D, 0x46, 0xAA, 0xF8, 0x9D, 0x04,
-    0xA5, 0x84, 0x91, 0x02, 0x39, 0x6B, 0x36, 0x71, 0x57, 0x85, 0x2A, 0x56, 0x54, 0x5B, 0x79, 0x7D,
-    0x71, 0x69, 0x6B, 0x43, 0x3C, 0xA7, 0x3D, 0x1B, 0x55, 0x7E, 0x7D, 0x18, 0x7D, 0x77, 0x32, 0x90,
-    0x92, 0x98, 0x1E, 0x2D, 0x8F, 0x58, 0x17, 0x6B, 0x54, 0xF4, 0x0F, 0x3D, 0x48, 0x7D, 0xA8, 0x3D,
-    0x89, 0xCD, 0x36, 0x3D, 0xDE, 0xE8, 0x5B, 0x41, 0xCC, 0xD9, 0x08, 0x40, 0x61, 0x7D, 0xBD, 0x40,
-    0x72, 0x75, 0x6E, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x97, 0x6D, 0xD2, 0x1C, 0xAE, 0x76, 0xEC, 0x53, 0xBD, 0x8B, 0xE4, 0x53, 0x9E, 0x62, 0xD1, 0x64,
-    0xBE, 0x6E, 0xF6, 0x36, 0xD5, 0x90, 0xE8, 0x43, 0x83, 0x67, 0xDA, 0x80, 0xA3, 0x73, 0xFF, 0x11,
-    0xBA, 0x94, 0xF1, 0x9C, 0xB9, 0xDB, 0x6C, 0x8D, 0xCB, 0xD8, 0x66, 0x37, 0xC6, 0xDA, 0x70, 0x0E,
-    0xBE, 0xD9, 0x62, 0x59, 0xE0, 0xF6, 0x5A, 0x3E, 0xDB, 0xF7, 0x64, 0x32, 0xCE, 0xF9, 0x60, 0x17,
-    0xD3, 0xF7, 0x55, 0x9D, 0xB9, 0xCE, 0x99, 0x13, 0xDF, 0xC8, 0x8C, 0x45, 0xDD, 0xCA, 0x9D, 0x3B,
-    0xCA, 0xCD, 0xA4, 0x04, 0xBA, 0xCC, 0x89, 0x99, 0xCD, 0xC9, 0x82, 0x60, 0xF7, 0xEA, 0x7E, 0x3E,
-    0xF5, 0xEC, 0x8F, 0x2E, 0xE2, 0xEF, 0x95, 0x0A, 0xD1, 0xF0, 0x8B, 0x22, 0xD2, 0xEE, 0x7B, 0x9C,
-    0xE5, 0xEB, 0x74, 0x4F, 0x5D, 0x4C, 0x67, 0x5E, 0xFF, 0xE0, 0x3D, 0x3F, 0x9C, 0x50, 0xCF, 0x36,
-    0xFA, 0xC7, 0x9A, 0x34, 0x2B, 0x54, 0x78, 0x8F, 0x8A, 0xF4, 0x65, 0x16, 0x69, 0x59, 0xE0, 0x0F,
-    0xB6, 0xD3, 0xB1, 0x18, 0xD0, 0xE0, 0x26, 0x54, 0x8D, 0xEB, 0x3D, 0x9D, 0xF7, 0xEF, 0x32, 0x48,
-    0x99, 0xFF, 0x52, 0x21, 0x7C, 0x40, 0xC3, 0x36, 0x51, 0x3D, 0x7C, 0x5E, 0x2F, 0x43, 0x88, 0x97,
-    0x59, 0x46, 0xCF, 0x0F, 0x5D, 0x00, 0xDD, 0x6F, 0x08, 0x01, 0x88, 0x72, 0x23, 0x0A, 0xF0, 0x7C,
-    0xF4, 0xCE, 0xB2, 0x2A, 0x8D, 0x55, 0xEA, 0x0C, 0xD6, 0xD4, 0xBC, 0x08, 0x73, 0x44, 0xD8, 0x85,
-    0x49, 0x06, 0xF5, 0x05, 0x2A, 0x22, 0x8E, 0x57, 0x64, 0xC2, 0x53, 0x93, 0xBC, 0xB3, 0x34, 0x55,
-    0x5E, 0xBA, 0x56, 0x91, 0xB6, 0xAA, 0x38, 0x65, 0x86, 0xA1, 0x0E, 0x70, 0x49, 0xB3, 0x1B, 0x1A,
-    0x46, 0xAC, 0x23, 0x0F, 0x88, 0xA9, 0x05, 0x4A, 0x3F, 0xA7, 0x12, 0x95, 0x73, 0x9E, 0x00, 0x60,
-    0x7B, 0x74, 0x6F, 0x39, 0x2E, 0x78, 0x1F, 0x91, 0x5C, 0x79, 0x79, 0x7B, 0x46, 0x74, 0x17, 0x62,
-    0x18, 0xAE, 0xAA, 0x9B, 0x2B, 0xC0, 0xAD, 0x16, 0x6D, 0xA0, 0x8D, 0x72, 0x7F, 0xB2, 0x90, 0x27,
-    0x25, 0xAF, 0xBF, 0x84, 0x79, 0xA1, 0xA2, 0x87, 0x2C, 0x3F, 0x29, 0x66, 0x2A, 0x5F, 0x25, 0x4E,
-    0x59, 0x51, 0x74, 0x6D, 0x61, 0x6F, 0x6C, 0x27, 0x00, 0x46, 0x39, 0x92, 0x40, 0x55, 0x7C, 0x7E,
-    0x52, 0x81, 0x34, 0x7A, 0x43, 0x9B, 0x27, 0x11, 0x72, 0x93, 0x17, 0x38, 0x51, 0xF3, 0x1B, 0x3D,
-    0x69, 0xEE, 0xA5, 0x3D, 0x75, 0x5B, 0x38, 0x3D, 0x62, 0x8F, 0x43, 0x41, 0x47, 0x78, 0xA6, 0xC0,
-    0x5A, 0x9F, 0x9B, 0xBF, 0x72, 0x75, 0x6E, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x91, 0x6D, 0xD3, 0x47, 0xA7, 0x76, 0xED, 0x53, 0xB7, 0x8B, 0xE3, 0x53,
-    0x96, 0x62, 0xD2, 0x64, 0xB4, 0x6E, 0xF6, 0x36, 0xCE, 0x8F, 0xE7, 0x43, 0x7E, 0x67, 0xDB, 0x80,
-    0x9C, 0x73, 0xFF, 0x11, 0xB6, 0x94, 0xF0, 0x9C, 0xBE, 0xDA, 0x69, 0x8D, 0xCE, 0xD6, 0x63, 0x37,
-    0xCA, 0xD8, 0x6D, 0x0E, 0xC2, 0xD8, 0x5F, 0x59, 0xE5, 0xF4, 0x55, 0x4B, 0xE1, 0xF6, 0x5F, 0x30,
-    0xD5, 0xF7, 0x5B, 0x22, 0xD9, 0xF5, 0x51, 0x9D, 0xBC, 0xCE, 0x96, 0x13, 0xDE, 0xC6, 0x8A, 0x45,
-    0xDD, 0xC9, 0x9A, 0x3B, 0xCC, 0xCD, 0xA0, 0x04, 0xBD, 0xCB, 0x86, 0x99, 0xCE, 0xC8, 0x7F, 0x60,
-    0xF8, 0xE8, 0x7A, 0x3E, 0xF7, 0xEA, 0x8B, 0x2E, 0xE6, 0xEE, 0x91, 0x0A, 0xD6, 0xF0, 0x86, 0x20,
-    0xD7, 0xED, 0x76, 0x9C, 0xE8, 0xE9, 0x70, 0x56, 0x58, 0x4B, 0x6A, 0x5E, 0xFF, 0xDD, 0x3A, 0x34,
-    0x92, 0x50, 0xD1, 0x36, 0xF7, 0xC5, 0x97, 0x34, 0x2B, 0x55, 0x7A, 0x8F, 0x96, 0xF5, 0x60, 0x16,
-    0x64, 0x5A, 0xE1, 0x0F, 0xB9, 0xD3, 0xAE, 0x18, 0xD4, 0xDD, 0x23, 0x54, 0x98, 0xEB, 0x39, 0x9D,
-    0xFA, 0xEC, 0x2E, 0x48, 0xA5, 0xFF, 0x4D, 0x21, 0x72, 0x40, 0xC6, 0x36, 0x4B, 0x3C, 0x80, 0x5C,
-    0x2C, 0x43, 0x8B, 0x97, 0x53, 0x47, 0xD2, 0x0F, 0x4E, 0x00, 0xE2, 0x6F, 0x00, 0x01, 0x8D, 0x72,
-    0x1A, 0x0C, 0xF5, 0x7C, 0xF3, 0xCD, 0xAF, 0x2A, 0x85, 0x56, 0xEC, 0x0C, 0xD7, 0xD3, 0xB9, 0x08,
-    0x6B, 0x44, 0xDB, 0x85, 0x3C, 0x07, 0xFA, 0x05, 0x24, 0x22, 0x92, 0x57, 0x6C, 0xC2, 0x50, 0x93,
-    0xBC, 0xB0, 0x33, 0x55, 0x66, 0xBA, 0x54, 0x8F, 0xB6, 0xA8, 0x37, 0x65, 0x88, 0xA0, 0x0E, 0x70,
-    0x52, 0xB4, 0x19, 0x1A, 0x4F, 0xAC, 0x22, 0x0F, 0x8B, 0xA7, 0x05, 0x40, 0x48, 0xA7, 0x11, 0x95,
-    0x77, 0x9C, 0x00, 0x60, 0x78, 0x73, 0x70, 0x39, 0x32, 0x78, 0x20, 0x91, 0x5D, 0x7A, 0x7A, 0x7C,
-    0x48, 0x74, 0x18, 0x62, 0x24, 0xB2, 0xA7, 0x9B, 0x37, 0xC3, 0xAA, 0x16, 0x70, 0xA1, 0x8C, 0x72,
-    0x83, 0xB2, 0x8E, 0x27, 0x2F, 0xB3, 0xBC, 0x84, 0x7C, 0xA1, 0xA0, 0x89, 0x29, 0x3E, 0x2D, 0x63,
-    0x2C, 0x5F, 0x27, 0x53, 0x55, 0x50, 0x76, 0x6D, 0x60, 0x6F, 0x6D, 0x26, 0x02, 0x47, 0x3C, 0x92,
-    0x3E, 0x55, 0x7E, 0x7E, 0x54, 0x81, 0x35, 0x79, 0x4A, 0x9B, 0x27, 0x11, 0x74, 0x91, 0x17, 0x38,
-    0xCF, 0xCA, 0x3A, 0x3D, 0x24, 0xF3, 0x9E, 0x3D, 0x3C, 0x73, 0x3E, 0x3D, 0x52, 0xC4, 0x4A, 0x41,
-    0xD4, 0x1D, 0xCA, 0xC0, 0xE7, 0x79, 0x99, 0x40, 0x72, 0x75, 0x6E, 0x33, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x6D, 0xD0, 0x47, 0xA1, 0x76, 0xE9, 0x53,
-    0xB2, 0x8A, 0xDE, 0x53, 0x8F, 0x61, 0xD1, 0x70, 0xAA, 0x6D, 0xF3, 0x64, 0xC6, 0x8D, 0xE1, 0x43,
-    0x7C, 0x68, 0xD9, 0x80, 0x97, 0x74, 0xFB, 0x11, 0xB3, 0x94, 0xE9, 0x9C, 0xC8, 0xD8, 0x60, 0x12,
-    0xD4, 0xD3, 0x5B, 0x36, 0xD2, 0xD6, 0x65, 0x0E, 0xCB, 0xD5, 0x57, 0x59, 0xEE, 0xF0, 0x4C, 0x41,
-    0xEB, 0xF3, 0x55, 0x30, 0xE1, 0xF5, 0x51, 0x22, 0xE4, 0xF2, 0x47, 0x4E, 0xC4, 0xCD, 0x8D, 0x13,
-    0xDF, 0xC3, 0x82, 0x45, 0xDE, 0xC6, 0x92, 0x3B, 0xD1, 0xCB, 0x97, 0x04, 0xC4, 0xCA, 0x7E, 0x99,
-    0xD2, 0xC5, 0x78, 0x60, 0xFB, 0xE4, 0x71, 0x43, 0xFB, 0xE7, 0x80, 0x35, 0xED, 0xEC, 0x86, 0x0A,
-    0xE0, 0xEE, 0x7B, 0x20, 0xE1, 0xEB, 0x6C, 0x9C, 0xEE, 0xE6, 0x66, 0x56, 0x58, 0x49, 0x6D, 0x5E,
-    0xFF, 0xD6, 0x33, 0x34, 0x88, 0x4E, 0xD1, 0x6F, 0xF3, 0xC1, 0x90, 0x34, 0x34, 0x57, 0x7C, 0x94,
-    0xAC, 0xF6, 0x55, 0x16, 0x64, 0x5C, 0xE0, 0x0F, 0xC3, 0xD3, 0xA3, 0x17, 0xDB, 0xD8, 0x1D, 0x54,
-    0xAC, 0xEA, 0x30, 0x51, 0xFE, 0xE6, 0x27, 0x48, 0xBB, 0xFF, 0x42, 0x21, 0x6B, 0x3F, 0xC8, 0x64,
-    0x4A, 0x3C, 0x84, 0x5C, 0x31, 0x45, 0x8E, 0x94, 0x52, 0x48, 0xD2, 0x11, 0x40, 0x00, 0xE8, 0x70,
-    0x00, 0x03, 0x96, 0x72, 0x17, 0x0F, 0xF9, 0x90, 0xF1, 0xCA, 0xA6, 0x29, 0x7E, 0x56, 0xEB, 0x0C,
-    0xDB, 0xD2, 0xAE, 0x08, 0x65, 0x45, 0xDB, 0x86, 0x32, 0x08, 0xFF, 0x05, 0x24, 0x24, 0x97, 0x57,
-    0x80, 0xC3, 0x4A, 0x93, 0xBF, 0xAB, 0x30, 0x55, 0x79, 0xBB, 0x4E, 0x8F, 0xB8, 0xA4, 0x35, 0x62,
-    0x90, 0x9C, 0x0D, 0x70, 0x67, 0xB4, 0x16, 0x1D, 0x63, 0xAD, 0x1F, 0x0F, 0x94, 0xA3, 0x04, 0x40,
-    0x5C, 0xA7, 0x0F, 0x95, 0x81, 0x99, 0x00, 0x60, 0x7A, 0x72, 0x70, 0x38, 0x42, 0x78, 0x22, 0x8F,
-    0x64, 0x7A, 0x79, 0x92, 0x52, 0x72, 0x1B, 0x69, 0x40, 0xB8, 0x9F, 0x9B, 0x54, 0xCA, 0xA0, 0x1B,
-    0x7C, 0xA2, 0x86, 0x72, 0x90, 0xB3, 0x87, 0x28, 0x4A, 0xB9, 0xB3, 0x84, 0x86, 0xA3, 0x9A, 0x89,
-    0x2F, 0x3D, 0x34, 0x63, 0x37, 0x5E, 0x2B, 0x53, 0x56, 0x4F, 0x79, 0x6B, 0x65, 0x6F, 0x6D, 0x28,
-    0x0F, 0x49, 0x40, 0x92, 0x44, 0x56, 0x80, 0x7E, 0x60, 0x80, 0x35, 0x78, 0x5C, 0x9B, 0x25, 0x03,
-    0x7D, 0x8E, 0x17, 0x38, 0x73, 0x19, 0x56, 0x3D, 0x54, 0x51, 0x96, 0x3D, 0x67, 0x44, 0x46, 0x3D,
-    0xE2, 0x2E, 0x45, 0x41, 0x55, 0x11, 0x5A, 0xC1, 0x0B, 0xF3, 0xC3, 0x40, 0x72, 0x75, 0x6E, 0x34,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x6D, 0xCB, 0x49,
-    0x9D, 0x76, 0xE2, 0x53, 0xAF, 0x8A, 0xD6, 0x53, 0x8A, 0x60, 0xCD, 0x70, 0xA3, 0x6C, 0xED, 0x70,
-    0xC1, 0x8C, 0xDA, 0x44, 0x7A, 0x69, 0xD4, 0x80, 0x94, 0x75, 0xF3, 0x18, 0xB1, 0x95, 0xE1, 0x9C,
-    0xCE, 0xD6, 0x58, 0x12, 0xD8, 0xD0, 0x54, 0x36, 0xD6, 0xD4, 0x5D, 0x0E, 0xD0, 0xD3, 0x4F, 0x59,
-    0xF2, 0xED, 0x43, 0x43, 0xF0, 0xF0, 0x4C, 0x30, 0xE8, 0xF3, 0x47, 0x21, 0xEA, 0xEF, 0x3E, 0x4E,
-    0xC9, 0xCC, 0x84, 0x12, 0xDE, 0xC0, 0x7B, 0x36, 0xDE, 0xC4, 0x89, 0x3B, 0xD3, 0xCA, 0x8E, 0x03,
-    0xC9, 0xC9, 0x75, 0x99, 0xD4, 0xC2, 0x71, 0x5E, 0xFC, 0xE0, 0x67, 0x43, 0xFC, 0xE4, 0x76, 0x35,
-    0xF1, 0xEA, 0x7B, 0x0A, 0xE6, 0xED, 0x71, 0x20, 0xE6, 0xE9, 0x62, 0x9C, 0xF1, 0xE2, 0x5D, 0x56,
-    0x57, 0x48, 0x6F, 0x5C, 0xFE, 0xD0, 0x2E, 0x37, 0x81, 0x4D, 0xCE, 0x6F, 0xF0, 0xBC, 0x88, 0x34,
-    0x3A, 0x59, 0x7B, 0x94, 0xBA, 0xF7, 0x4B, 0x22, 0x64, 0x5E, 0xDB, 0x11, 0xC8, 0xD3, 0x99, 0x17,
-    0xDF, 0xD3, 0x18, 0x60, 0xB9, 0xE9, 0x28, 0x51, 0xFF, 0xDF, 0x20, 0x4A, 0xC9, 0xFF, 0x38, 0x24,
-    0x65, 0x3F, 0xC6, 0x64, 0x49, 0x3B, 0x85, 0x5C, 0x35, 0x47, 0x8E, 0x94, 0x51, 0x4A, 0xCF, 0x11,
-    0x37, 0x00, 0xEA, 0x70, 0x00, 0x05, 0x9A, 0x75, 0x16, 0x13, 0xF8, 0x90, 0xEF, 0xC7, 0x9C, 0x29,
-    0x7A, 0x56, 0xE6, 0x0C, 0xDD, 0xD1, 0xA4, 0x08, 0x61, 0x45, 0xD8, 0x86, 0x2C, 0x0A, 0xFF, 0x05,
-    0x24, 0x25, 0x99, 0x57, 0x8D, 0xC4, 0x44, 0x9C, 0xC0, 0xA6, 0x2E, 0x55, 0x85, 0xBC, 0x48, 0x8F,
-    0xB8, 0x9F, 0x32, 0x62, 0x95, 0x98, 0x0C, 0x6D, 0x75, 0xB4, 0x13, 0x1D, 0x71, 0xAD, 0x1C, 0x11,
-    0x99, 0x9F, 0x03, 0x5F, 0x6A, 0xA7, 0x0D, 0x95, 0x88, 0x95, 0x00, 0x5E, 0x7B, 0x70, 0x6E, 0x38,
-    0x4B, 0x78, 0x22, 0x8F, 0x69, 0x7A, 0x76, 0x92, 0x59, 0x70, 0x1C, 0x69, 0x53, 0xC0, 0x95, 0x9B,
-    0x67, 0xD1, 0x95, 0x22, 0x84, 0xA3, 0x80, 0x75, 0x97, 0xB4, 0x80, 0x28, 0x5B, 0xC1, 0xA9, 0x02,
-    0x8C, 0xA4, 0x93, 0x89, 0x32, 0x3B, 0x38, 0x63, 0x3E, 0x5E, 0x2D, 0x53, 0x56, 0x4F, 0x79, 0x6B,
-    0x68, 0x6E, 0x6C, 0x28, 0x18, 0x4A, 0x43, 0x8E, 0x48, 0x57, 0x7F, 0x90, 0x66, 0x7F, 0x35, 0x78,
-    0x67, 0x9B, 0x23, 0x18, 0x82, 0x8B, 0x17, 0x38, 0x91, 0x88, 0x36, 0x3D, 0xBB, 0x18, 0xA0, 0x3D,
-    0x18, 0x2A, 0x3D, 0x3D, 0x96, 0xA1, 0x4D, 0x41, 0xC8, 0x33, 0x16, 0xC1, 0x0F, 0x39, 0x3C, 0xBF,
-    0x72, 0x75, 0x6E, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x8D, 0x6D, 0xD1, 0x47, 0xA2, 0x76, 0xEA, 0x53, 0xB3, 0x8B, 0xDF, 0x53, 0x8F, 0x61, 0xD2, 0x70,
-    0xAB, 0x6D, 0xF4, 0x6F, 0xC7, 0x8E, 0xE3, 0x43, 0x7C, 0x68, 0xDA, 0x80, 0x98, 0x74, 0xFC, 0x11,
-    0xB3, 0x94, 0xEB, 0x9C, 0xC7, 0xD8, 0x62, 0x12, 0xD4, 0xD4, 0x5C, 0x36, 0xD1, 0xD6, 0x66, 0x0E,
-    0xCA, 0xD6, 0x58, 0x59, 0xEC, 0xF1, 0x4D, 0x3E, 0xE9, 0xF3, 0x57, 0x30, 0xE0, 0xF5, 0x52, 0x17,
-    0xE3, 0xF3, 0x49, 0x4E, 0xC3, 0xCD, 0x8F, 0x13, 0xDE, 0xC4, 0x84, 0x45, 0xDE, 0xC7, 0x93, 0x3B,
-    0xD0, 0xCB, 0x99, 0x04, 0xC3, 0xCA, 0x7F, 0x99, 0xD1, 0xC5, 0x79, 0x60, 0xFB, 0xE5, 0x72, 0x43,
-    0xFA, 0xE8, 0x82, 0x2E, 0xEC, 0xEC, 0x87, 0x0A, 0xDF, 0xEE, 0x7D, 0x20, 0xE0, 0xEB, 0x6D, 0x9C,
-    0xED, 0xE6, 0x68, 0x56, 0x58, 0x4A, 0x6D, 0x5E, 0xFF, 0xD7, 0x34, 0x46, 0x89, 0x4E, 0xD2, 0x6F,
-    0xF4, 0xC1, 0x91, 0x34, 0x33, 0x56, 0x7C, 0x94, 0xA9, 0xF6, 0x57, 0x16, 0x64, 0x5B, 0xE0, 0x0F,
-    0xC1, 0xD3, 0xA5, 0x17, 0xDA, 0xD9, 0x1E, 0x54, 0xA9, 0xEA, 0x32, 0x9D, 0xFD, 0xE7, 0x28, 0x48,
-    0xB8, 0xFF, 0x44, 0x21, 0x6B, 0x3F, 0xC8, 0x64, 0x4A, 0x3C, 0x83, 0x5C, 0x31, 0x45, 0x8E, 0x94,
-    0x52, 0x48, 0xD2, 0x11, 0x42, 0x00, 0xE8, 0x70, 0x00, 0x03, 0x95, 0x72, 0x18, 0x0F, 0xF9, 0x90,
-    0xF1, 0xCA, 0xA7, 0x29, 0x7F, 0x56, 0xEB, 0x0C, 0xDB, 0xD2, 0xB0, 0x08, 0x66, 0x44, 0xDC, 0x86,
-    0x34, 0x08, 0xFF, 0x05, 0x24, 0x23, 0x97, 0x57, 0x7E, 0xC3, 0x4B, 0x93, 0xBE, 0xAC, 0x31, 0x55,
-    0x77, 0xBB, 0x4F, 0x8F, 0xB8, 0xA4, 0x35, 0x63, 0x8F, 0x9C, 0x0D, 0x6E, 0x65, 0xB4, 0x17, 0x1D,
-    0x61, 0xAD, 0x20, 0x0F, 0x93, 0xA3, 0x04, 0x40, 0x5A, 0xA7, 0x0F, 0x95, 0x80, 0x99, 0x00, 0x60,
-    0x7A, 0x72, 0x70, 0x39, 0x40, 0x78, 0x22, 0x8F, 0x63, 0x7A, 0x79, 0x92, 0x51, 0x72, 0x1B, 0x69,
-    0x3D, 0xB7, 0xA1, 0x9B, 0x50, 0xC9, 0xA2, 0x1B, 0x7B, 0xA2, 0x88, 0x72, 0x8E, 0xB3, 0x89, 0x28,
-    0x46, 0xB8, 0xB5, 0x84, 0x84, 0xA3, 0x9C, 0x89, 0x2E, 0x3D, 0x33, 0x63, 0x36, 0x5E, 0x2B, 0x53,
-    0x56, 0x50, 0x79, 0x6C, 0x64, 0x6F, 0x6E, 0x26, 0x0E, 0x48, 0x40, 0x92, 0x43, 0x56, 0x80, 0x7E,
-    0x5E, 0x80, 0x35, 0x78, 0x5A, 0x9B, 0x25, 0x03, 0x7C, 0x8F, 0x18, 0x38, 0xA5, 0xB4, 0x14, 0x3D,
-    0x65, 0x78, 0xA7, 0x3D, 0x6A, 0x7B, 0x37, 0x3D, 0x76, 0x52, 0x60, 0x41, 0x08, 0xCF, 0xD6, 0xC0,
-    0xA2, 0x3E, 0xCF, 0x40, 0x72, 0x75, 0x6E, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x94, 0x6D, 0xD2, 0x47, 0xAB, 0x76, 0xEC, 0x53, 0xBA, 0x8B, 0xE3, 0x53,
-    0x9A, 0x62, 0xD2, 0x64, 0xB9, 0x6E, 0xF6, 0x36, 0xD2, 0x8F, 0xE8, 0x43, 0x80, 0x67, 0xDB, 0x80,
-    0xA0, 0x73, 0xFF, 0x11, 0xB8, 0x94, 0xF1, 0x9C, 0xBB, 0xDA, 0x6B, 0x8D, 0xCC, 0xD7, 0x65, 0x37,
-    0xC8, 0xD9, 0x6F, 0x0E, 0xBF, 0xD8, 0x60, 0x59, 0xE2, 0xF5, 0x58, 0x3E, 0xDE, 0xF7, 0x62, 0x30,
-    0xD1, 0xF8, 0x5E, 0x17, 0xD5, 0xF6, 0x53, 0x9D, 0xBA, 0xCE, 0x98, 0x13, 0xDE, 0xC7, 0x8B, 0x45,
-    0xDD, 0xCA, 0x9C, 0x3B, 0xCB, 0xCD, 0xA2, 0x04, 0xBB, 0xCC, 0x87, 0x99, 0xCD, 0xC8, 0x81, 0x60,
-    0xF7, 0xE9, 0x7D, 0x3E, 0xF6, 0xEB, 0x8D, 0x2E, 0xE4, 0xEF, 0x93, 0x0A, 0xD3, 0xF0, 0x89, 0x22,
-    0xD5, 0xEE, 0x79, 0x9C, 0xE7, 0xEA, 0x72, 0x56, 0x5B, 0x4B, 0x68, 0x5E, 0xFF, 0xDF, 0x3C, 0x3F,
-    0x97, 0x50, 0xD0, 0x36, 0xF9, 0xC6, 0x99, 0x34, 0x2B, 0x54, 0x79, 0x8F, 0x8F, 0xF4, 0x63, 0x16,
-    0x67, 0x59, 0xE1, 0x0F, 0xB7, 0xD3, 0xB0, 0x18, 0xD1, 0xDF, 0x25, 0x54, 0x92, 0xEB, 0x3B, 0x9D,
-    0xF8, 0xEE, 0x30, 0x48, 0x9E, 0xFF, 0x50, 0x21, 0x77, 0x40, 0xC5, 0x36, 0x4E, 0x3D, 0x7E, 0x5C,
-    0x2D, 0x43, 0x89, 0x97, 0x56, 0x46, 0xD0, 0x0F, 0x56, 0x00, 0xDF, 0x6F, 0x03, 0x01, 0x8A, 0x72,
-    0x1F, 0x0B, 0xF2, 0x7C, 0xF3, 0xCE, 0xB0, 0x2A, 0x89, 0x55, 0xEB, 0x0C, 0xD6, 0xD3, 0xBB, 0x08,
-    0x6F, 0x44, 0xD9, 0x85, 0x43, 0x06, 0xF8, 0x05, 0x27, 0x22, 0x90, 0x57, 0x67, 0xC2, 0x52, 0x93,
-    0xBC, 0xB2, 0x34, 0x55, 0x61, 0xBA, 0x55, 0x8F, 0xB6, 0xAA, 0x37, 0x65, 0x86, 0xA1, 0x0E, 0x70,
-    0x4C, 0xB3, 0x1A, 0x1A, 0x4A, 0xAC, 0x23, 0x0F, 0x89, 0xA8, 0x05, 0x40, 0x42, 0xA7, 0x12, 0x95,
-    0x74, 0x9D, 0x00, 0x60, 0x79, 0x74, 0x6F, 0x39, 0x2F, 0x78, 0x20, 0x91, 0x5C, 0x79, 0x79, 0x7B,
-    0x46, 0x74, 0x18, 0x62, 0x1D, 0xB0, 0xA9, 0x9B, 0x30, 0xC2, 0xAC, 0x16, 0x6E, 0xA0, 0x8C, 0x72,
-    0x81, 0xB2, 0x8F, 0x27, 0x29, 0xB1, 0xBE, 0x84, 0x7A, 0xA1, 0xA1, 0x87, 0x2A, 0x3E, 0x2B, 0x66,
-    0x2A, 0x5F, 0x26, 0x53, 0x57, 0x50, 0x75, 0x6D, 0x60, 0x6F, 0x6D, 0x26, 0x00, 0x47, 0x3A, 0x92,
-    0x3F, 0x55, 0x7D, 0x7E, 0x53, 0x81, 0x34, 0x7A, 0x46, 0x9B, 0x27, 0x11, 0x72, 0x92, 0x17, 0x38,
-    0x3C, 0x13, 0xAD, 0x3D, 0xEE, 0x89, 0xE5, 0x3C, 0x20, 0xF1, 0x2D, 0x3D, 0xCA, 0x1A, 0x86, 0xC0,
-    0x13, 0x83, 0x1D, 0xC1, 0xC2, 0x4E, 0xE0, 0x40, 0x61, 0x74, 0x74, 0x61, 0x6B, 0x31, 0x00, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x3B, 0xCE, 0x43, 0x74, 0x31, 0xEF, 0x4A,
-    0x89, 0x31, 0xEF, 0x4A, 0x62, 0x28, 0xCB, 0x77, 0x6D, 0x1A, 0xFA, 0x7A, 0x90, 0x1A, 0xFA, 0x62,
-    0x62, 0x4F, 0xD0, 0x10, 0x6D, 0x41, 0xFF, 0x08, 0x90, 0x40, 0xFF, 0x26, 0xDF, 0x5B, 0x8C, 0x20,
-    0xDF, 0x42, 0x89, 0x68, 0xDF, 0x4C, 0x93, 0x05, 0xDF, 0x51, 0x82, 0x54, 0xFE, 0x41, 0x89, 0x65,
-    0xFE, 0x4B, 0x93, 0x87, 0xFE, 0x5A, 0x8C, 0x2F, 0xFE, 0x50, 0x82, 0x48, 0xCE, 0x5D, 0xB6, 0x20,
-    0xCE, 0x27, 0xAF, 0x68, 0xCE, 0x30, 0xC0, 0x89, 0xCE, 0x4B, 0xC4, 0x09, 0xCE, 0x54, 0xA5, 0x4F,
-    0xCE, 0x39, 0xA1, 0x5D, 0xF2, 0x27, 0xAF, 0x62, 0xF2, 0x30, 0xC0, 0x8C, 0xF2, 0x4B, 0xC4, 0x0C,
-    0xF2, 0x5D, 0xB6, 0x2E, 0xF2, 0x54, 0xA5, 0x49, 0xF2, 0x39, 0xA2, 0x42, 0x52, 0x3D, 0x4C, 0x58,
-    0xF1, 0x00, 0x6D, 0x6D, 0x52, 0x19, 0xC3, 0x7A, 0xCF, 0x0B, 0xC2, 0x6E, 0x52, 0x84, 0x56, 0x1D,
-    0xF1, 0xA7, 0x82, 0x25, 0x52, 0x61, 0xCD, 0x18, 0xCF, 0x6C, 0xCF, 0x2D, 0xEE, 0x2F, 0x4C, 0x60,
-    0xEE, 0x8E, 0x58, 0x48, 0xFF, 0x13, 0x64, 0x44, 0xFF, 0x9A, 0x75, 0x2E, 0x41, 0x2C, 0xAD, 0x7A,
-    0x41, 0x44, 0x5B, 0x58, 0x41, 0x75, 0x62, 0x1D, 0x41, 0x5D, 0xB3, 0x17, 0x00, 0x1B, 0xAE, 0x77,
-    0x00, 0x64, 0x47, 0x9B, 0x00, 0x6D, 0xB9, 0x16, 0xD3, 0x20, 0xDB, 0x38, 0x52, 0x37, 0xDD, 0x84,
-    0xD3, 0x4B, 0xE1, 0x0D, 0x41, 0x3F, 0xC1, 0x7F, 0x00, 0x3F, 0xC5, 0x02, 0x22, 0x5D, 0x5D, 0x53,
-    0xC1, 0x9E, 0x5A, 0x26, 0xC1, 0x20, 0x49, 0x5E, 0xB8, 0x9E, 0x5A, 0x1A, 0xB8, 0x20, 0x49, 0x71,
-    0xAF, 0x43, 0x13, 0x77, 0xB7, 0x9F, 0x18, 0x4C, 0xAF, 0x9E, 0x1E, 0x17, 0xB7, 0x45, 0x0C, 0x5E,
-    0xAB, 0x9C, 0x0A, 0x47, 0xAB, 0x51, 0x00, 0x5D, 0x7A, 0x43, 0x66, 0x6A, 0x7E, 0x88, 0x07, 0x1A,
-    0x7A, 0x6F, 0x6B, 0x14, 0x7E, 0x66, 0x02, 0x72, 0x9D, 0xFF, 0x9D, 0x4D, 0xAF, 0xFB, 0xA9, 0x25,
-    0x9D, 0x86, 0x8D, 0x9B, 0xAF, 0x83, 0x99, 0x34, 0x9D, 0xF8, 0xB4, 0x01, 0x9D, 0x7F, 0xA5, 0x7E,
-    0x48, 0x57, 0x01, 0x71, 0x65, 0x76, 0x05, 0x4A, 0x55, 0x4A, 0x5A, 0x7B, 0x72, 0x5C, 0x5C, 0x34,
-    0x48, 0x96, 0x09, 0x1B, 0x55, 0x6E, 0x5E, 0x15, 0x88, 0x6D, 0x26, 0x8F, 0x9E, 0x92, 0x1C, 0x08,
-    0x9E, 0x4F, 0x14, 0x79, 0x97, 0xBC, 0xAC, 0x3D, 0xF1, 0x89, 0xE5, 0x3C, 0xEC, 0x58, 0x54, 0x3D,
-    0xF6, 0x18, 0xC9, 0xC0, 0x13, 0x83, 0x1D, 0xC1, 0x2D, 0x2F, 0x17, 0x41, 0x61, 0x74, 0x74, 0x61,
-    0x6B, 0x32, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x3B, 0xB1, 0x34,
-    0x63, 0x31, 0xD0, 0x41, 0x78, 0x31, 0xDD, 0x41, 0x5A, 0x28, 0xAA, 0x73, 0x5B, 0x1A, 0xD4, 0x73,
-    0x7B, 0x1A, 0xE9, 0x70, 0x59, 0x4F, 0xAE, 0x13, 0x5A, 0x41, 0xD8, 0x07, 0x7A, 0x40, 0xED, 0x28,
-    0xDA, 0x5B, 0xC6, 0x20, 0xDA, 0x42, 0xC4, 0x68, 0xD8, 0x4C, 0xCB, 0x01, 0xDB, 0x51, 0xBE, 0x5F,
-    0xF7, 0x41, 0xD7, 0x64, 0xF5, 0x4B, 0xDE, 0x89, 0xF6, 0x5A, 0xD9, 0x2D, 0xF8, 0x50, 0xD2, 0x4B,
-    0xC2, 0x5D, 0xDC, 0x20, 0xC4, 0x27, 0xD7, 0x68, 0xC0, 0x30, 0xE4, 0x81, 0xC0, 0x4B, 0xE6, 0x03,
-    0xC6, 0x54, 0xCF, 0x48, 0xC6, 0x39, 0xCC, 0x5E, 0xE4, 0x27, 0xEC, 0x64, 0xE1, 0x30, 0xF9, 0x8A,
-    0xE1, 0x4B, 0xFC, 0x05, 0xE3, 0x5D, 0xF2, 0x2F, 0xE6, 0x54, 0xE5, 0x28, 0xE7, 0x39, 0xE2, 0x43,
-    0x63, 0x3D, 0x40, 0x5D, 0xF1, 0x00, 0xB9, 0x6D, 0x4C, 0x19, 0x9A, 0x7A, 0xC1, 0x0B, 0xE6, 0x6C,
-    0x61, 0x84, 0x47, 0x1C, 0xED, 0xA7, 0xCA, 0x23, 0x4B, 0x61, 0xA1, 0x16, 0xBF, 0x6C, 0xEF, 0x08,
-    0xF4, 0x2F, 0x9E, 0x66, 0xF1, 0x8E, 0xA8, 0x4B, 0xFF, 0x13, 0xBB, 0x46, 0xFC, 0x9A, 0xC8, 0x32,
-    0x41, 0x2C, 0x7E, 0x73, 0x50, 0x44, 0x41, 0x5D, 0x4F, 0x75, 0x46, 0x1C, 0x3F, 0x5D, 0x83, 0x17,
-    0x04, 0x1B, 0x58, 0x77, 0x18, 0x64, 0x0A, 0x99, 0x02, 0x6D, 0x60, 0x1B, 0xBF, 0x20, 0xFB, 0x8B,
-    0x47, 0x37, 0xAE, 0x7E, 0xBE, 0x4B, 0xFF, 0x0E, 0x3D, 0x3F, 0x8E, 0x7E, 0x00, 0x3F, 0x69, 0x0F,
-    0x33, 0x5D, 0x2F, 0x56, 0xC7, 0x9E, 0x8E, 0x27, 0xCA, 0x20, 0x81, 0x66, 0xBF, 0x9E, 0x89, 0x1D,
-    0xC2, 0x20, 0x7C, 0x5A, 0xC4, 0x43, 0x4D, 0x77, 0xCA, 0x9F, 0x56, 0x2B, 0xC2, 0x9E, 0x56, 0x16,
-    0xCD, 0x45, 0x4D, 0x65, 0xC2, 0x9C, 0x44, 0x26, 0xC4, 0x51, 0x3C, 0x5E, 0x83, 0x43, 0x6B, 0x79,
-    0x99, 0x88, 0x25, 0x1D, 0x82, 0x6F, 0x6F, 0x19, 0x99, 0x66, 0x22, 0x72, 0x99, 0xFF, 0xAA, 0x47,
-    0xA8, 0xFB, 0xBF, 0x25, 0x9C, 0x86, 0x9E, 0x99, 0xAA, 0x83, 0xB3, 0x3C, 0x95, 0xF8, 0xBC, 0x10,
-    0x97, 0x7F, 0xB0, 0x90, 0x67, 0x57, 0x00, 0x5A, 0x82, 0x76, 0x15, 0x41, 0x63, 0x4A, 0x4C, 0x74,
-    0x7E, 0x5C, 0x60, 0x35, 0x66, 0x96, 0x06, 0x1A, 0x62, 0x6E, 0x4F, 0x14, 0x9C, 0x6D, 0x43, 0x94,
-    0xB3, 0x92, 0x4A, 0x07, 0xB4, 0x4F, 0x43, 0x79, 0x2A, 0x40, 0xB0, 0x3D, 0x7B, 0x7B, 0xFE, 0x3C,
-    0x7B, 0x6E, 0x38, 0x3D, 0x55, 0x93, 0xC7, 0xC0, 0xC9, 0xFA, 0x3D, 0xC1, 0xE3, 0xC5, 0x05, 0x41,
-    0x61, 0x74, 0x74, 0x61, 0x6B, 0x33, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x68, 0x60, 0xC8, 0x46, 0x6D, 0x56, 0xEA, 0x40, 0x82, 0x50, 0xEF, 0x4A, 0x5E, 0x51, 0xC4, 0x77,
-    0x65, 0x44, 0xF3, 0x77, 0x87, 0x3A, 0xFB, 0x69, 0x5F, 0x74, 0xC8, 0x13, 0x66, 0x67, 0xF7, 0x08,
-    0x88, 0x5D, 0xFF, 0x28, 0xDC, 0x58, 0xA6, 0x27, 0xDB, 0x41, 0xA3, 0x7A, 0xDB, 0x4B, 0xAC, 0x04,
-    0xDC, 0x4F, 0x9C, 0x60, 0xFA, 0x38, 0xAA, 0x64, 0xF9, 0x42, 0xB3, 0x87, 0xFA, 0x4F, 0xAD, 0x2F,
-    0xFB, 0x45, 0xA4, 0x4B, 0xCA, 0x61, 0xC9, 0x20, 0xC8, 0x31, 0xC3, 0x68, 0xC8, 0x39, 0xD3, 0x81,
-    0xC8, 0x52, 0xD6, 0x09, 0xCB, 0x58, 0xB9, 0x48, 0xCA, 0x40, 0xB6, 0x5D, 0xEA, 0x26, 0xCC, 0x62,
-    0xEA, 0x2F, 0xDB, 0x8A, 0xEB, 0x47, 0xDE, 0x0C, 0xEC, 0x57, 0xD1, 0x2E, 0xED, 0x4E, 0xC1, 0x49,
-    0xEC, 0x36, 0xBF, 0x42, 0x57, 0x62, 0x4A, 0x5D, 0xED, 0x00, 0x8E, 0x6D, 0x4E, 0x48, 0xB9, 0x7A,
-    0xC7, 0x18, 0xD6, 0x6C, 0x59, 0xA3, 0x51, 0x1D, 0xF1, 0x97, 0xA0, 0x25, 0x50, 0x89, 0xC1, 0x17,
-    0xCA, 0x70, 0xE0, 0x2D, 0xED, 0x2A, 0x6D, 0x5E, 0xF0, 0x7F, 0x78, 0x48, 0xFB, 0x0D, 0x88, 0x44,
-    0xFF, 0x86, 0x97, 0x30, 0x3F, 0x5C, 0xA0, 0x7A, 0x45, 0x6E, 0x53, 0x58, 0x47, 0x9B, 0x59, 0x4D,
-    0x41, 0x89, 0xA5, 0x17, 0x00, 0x60, 0x92, 0x77, 0x09, 0x9C, 0x31, 0x99, 0x02, 0xAA, 0x9B, 0x16,
-    0xCA, 0x2B, 0xEE, 0x8C, 0x4E, 0x64, 0xD1, 0x02, 0xCB, 0x52, 0xF2, 0x0D, 0x3F, 0x6F, 0xB2, 0x7F,
-    0x00, 0x82, 0xA7, 0x01, 0x28, 0x8E, 0x4E, 0x56, 0xC5, 0x9B, 0x6F, 0x26, 0xC1, 0x29, 0x61, 0x66,
-    0xBC, 0x9D, 0x6D, 0x1F, 0xB9, 0x2B, 0x5F, 0x71, 0xB4, 0x4B, 0x29, 0x76, 0xBF, 0x9B, 0x2F, 0x4C,
-    0xB7, 0x9C, 0x33, 0x17, 0xBC, 0x4A, 0x25, 0x63, 0xB4, 0x9A, 0x1F, 0x49, 0xB2, 0x57, 0x17, 0x5D,
-    0x7C, 0x5E, 0x6A, 0x6A, 0x88, 0x95, 0x11, 0x1A, 0x7D, 0x85, 0x6F, 0x1B, 0x87, 0x77, 0x0E, 0x75,
-    0xA1, 0xFF, 0xA3, 0x4F, 0xB2, 0xF7, 0xB3, 0x2A, 0x9D, 0x92, 0x96, 0x95, 0xAE, 0x8A, 0xA6, 0x39,
-    0x9F, 0xFA, 0xBA, 0x11, 0x9C, 0x8D, 0xAD, 0x7E, 0x52, 0x79, 0x00, 0x71, 0x6F, 0x8C, 0x0A, 0x41,
-    0x59, 0x6E, 0x56, 0x7B, 0x76, 0x76, 0x5F, 0x34, 0x54, 0xB2, 0x07, 0x1B, 0x5A, 0x8F, 0x5A, 0x16,
-    0x8F, 0x7C, 0x31, 0x8F, 0xA6, 0x96, 0x2D, 0x08, 0xA4, 0x5A, 0x26, 0x79, 0xE0, 0x7A, 0xAB, 0x3D,
-    0xCB, 0x7C, 0x0B, 0x3D, 0x42, 0x37, 0x38, 0x3D, 0x30, 0x10, 0xAD, 0xC0, 0xA1, 0x91, 0x60, 0xC1,
-    0x9B, 0x6C, 0xCE, 0x40, 0x61, 0x74, 0x74, 0x61, 0x6B, 0x34, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x81, 0xD2, 0x43, 0x7A, 0x76, 0xF0, 0x55, 0x8F, 0x69, 0xEA, 0x55,
-    0x65, 0x77, 0xD3, 0x77, 0x72, 0x68, 0xFC, 0x78, 0x94, 0x54, 0xF3, 0x69, 0x68, 0x96, 0xD6, 0x15,
-    0x76, 0x87, 0xFF, 0x2D, 0x97, 0x72, 0xF6, 0x49, 0xDD, 0x55, 0x74, 0x27, 0xDB, 0x40, 0x72, 0x7A,
-    0xDC, 0x49, 0x7B, 0x0E, 0xDB, 0x4C, 0x6B, 0x59, 0xF9, 0x2E, 0x6A, 0x62, 0xFA, 0x37, 0x73, 0x87,
-    0xFB, 0x42, 0x6C, 0x2E, 0xF9, 0x3A, 0x63, 0x4A, 0xD0, 0x62, 0xA0, 0x27, 0xCC, 0x37, 0x9B, 0x7A,
-    0xCE, 0x3F, 0xAB, 0x89, 0xD0, 0x54, 0xAD, 0x0A, 0xCE, 0x5A, 0x90, 0x4F, 0xCC, 0x45, 0x8E, 0x58,
-    0xEE, 0x22, 0x92, 0x61, 0xF0, 0x2A, 0xA2, 0x8A, 0xF2, 0x3F, 0xA4, 0x0B, 0xF3, 0x4D, 0x96, 0x33,
-    0xF1, 0x45, 0x87, 0x49, 0xEE, 0x30, 0x85, 0x5F, 0x4D, 0x8B, 0x60, 0x58, 0xE5, 0x00, 0x56, 0x6D,
-    0x54, 0x74, 0xD1, 0x78, 0xCC, 0x20, 0xAE, 0x6C, 0x53, 0xC5, 0x66, 0x1D, 0xF4, 0x86, 0x62, 0x2A,
-    0x5A, 0xAE, 0xD6, 0x06, 0xD4, 0x6F, 0xB6, 0x2F, 0xE3, 0x26, 0x36, 0x5D, 0xEB, 0x73, 0x3D, 0x48,
-    0xF3, 0x07, 0x49, 0x66, 0xFF, 0x73, 0x53, 0x35, 0x42, 0x8C, 0xBF, 0x7A, 0x3E, 0x9C, 0x73, 0xA0,
-    0x42, 0xC3, 0x76, 0x1D, 0x47, 0xB4, 0xC3, 0x06, 0x03, 0xA4, 0xD3, 0x76, 0x00, 0xDA, 0x70, 0x94,
-    0x0A, 0xE6, 0xDA, 0x22, 0xD3, 0x30, 0xC4, 0x6F, 0x58, 0x8D, 0xE8, 0x05, 0xD7, 0x53, 0xC7, 0x31,
-    0x46, 0x9D, 0xD1, 0x02, 0x07, 0xC2, 0xE6, 0x04, 0x22, 0xC2, 0x7C, 0x53, 0xC1, 0x9A, 0x4A, 0x26,
-    0xB6, 0x34, 0x41, 0x5E, 0xB9, 0x9F, 0x4D, 0x1F, 0xAE, 0x39, 0x43, 0x72, 0xA3, 0x58, 0x11, 0x76,
-    0xB2, 0x9D, 0x10, 0x4B, 0xAB, 0xA1, 0x18, 0x06, 0xAA, 0x55, 0x09, 0x5C, 0xA5, 0xA0, 0x06, 0x47,
-    0x9F, 0x64, 0x00, 0x58, 0x76, 0x7B, 0x6D, 0x6A, 0x77, 0xAB, 0x10, 0x1F, 0x7A, 0x9E, 0x70, 0x1B,
-    0x74, 0x90, 0x0E, 0x75, 0xAA, 0xFF, 0x8E, 0x4D, 0xBD, 0xF2, 0x95, 0x2A, 0xA0, 0x9E, 0x85, 0x94,
-    0xB2, 0x91, 0x8B, 0x46, 0xAC, 0xFA, 0xA5, 0x03, 0xA1, 0x99, 0x9C, 0x00, 0x3F, 0xA3, 0x1C, 0x72,
-    0x5E, 0xAB, 0x16, 0x55, 0x52, 0x95, 0x6B, 0x7C, 0x70, 0x92, 0x65, 0x46, 0x44, 0xD6, 0x20, 0x1B,
-    0x55, 0xB2, 0x6E, 0x17, 0x81, 0x91, 0x2C, 0x8E, 0x9A, 0xA1, 0x1B, 0x2D, 0x94, 0x6B, 0x16, 0x79,
-    0xE3, 0x0E, 0xAD, 0x3D, 0xFC, 0xFE, 0x21, 0x3D, 0x66, 0x7B, 0x39, 0x3D, 0x71, 0x76, 0x99, 0xC0,
-    0xDE, 0x83, 0x70, 0xC1, 0xED, 0xA0, 0x14, 0x41, 0x61, 0x74, 0x74, 0x61, 0x6B, 0x35, 0x00, 0x34,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x8F, 0xC8, 0x46, 0x6A, 0x84, 0xE9, 0x40,
-    0x7E, 0x74, 0xEF, 0x40, 0x5B, 0x8A, 0xC3, 0x75, 0x60, 0x7B, 0xF1, 0x77, 0x80, 0x61, 0xFA, 0x69,
-    0x5F, 0xA3, 0xC7, 0x15, 0x64, 0x94, 0xF6, 0x08, 0x84, 0x7A, 0xFF, 0x4C, 0xD8, 0x4C, 0xA9, 0x27,
-    0xD5, 0x3B, 0xA6, 0x7A, 0xD6, 0x42, 0xAF, 0x04, 0xD8, 0x44, 0xA0, 0x60, 0xF2, 0x23, 0xAE, 0x62,
-    0xF3, 0x2B, 0xB8, 0x89, 0xF5, 0x34, 0xB1, 0x30, 0xF5, 0x2D, 0xA8, 0x41, 0xC7, 0x5C, 0xCC, 0x24,
-    0xC1, 0x38, 0xC5, 0x73, 0xC1, 0x3E, 0xD5, 0x81, 0xC3, 0x50, 0xD8, 0x09, 0xC7, 0x55, 0xBC, 0x48,
-    0xC4, 0x43, 0xB9, 0x5D, 0xE1, 0x1D, 0xCF, 0x69, 0xE1, 0x24, 0xDF, 0x6C, 0xE4, 0x36, 0xE2, 0x0C,
-    0xE7, 0x41, 0xD5, 0x35, 0xE7, 0x3A, 0xC5, 0x4C, 0xE4, 0x28, 0xC2, 0x66, 0x57, 0x9C, 0x49, 0x58,
-    0xE1, 0x00, 0x91, 0x6B, 0x4A, 0x8B, 0xB7, 0x76, 0xBD, 0x25, 0xD7, 0x6B, 0x5E, 0xCC, 0x52, 0x26,
-    0xF3, 0x70, 0xA5, 0x2F, 0x52, 0xBB, 0xC0, 0x06, 0xC7, 0x66, 0xE3, 0x2F, 0xE5, 0x20, 0x71, 0x5E,
-    0xF0, 0x60, 0x7D, 0x4B, 0xF0, 0x02, 0x8C, 0x65, 0xFF, 0x5C, 0x9C, 0x3C, 0x3E, 0xA3, 0x9E, 0x77,
-    0x46, 0xAF, 0x52, 0x58, 0x4C, 0xD0, 0x58, 0x1C, 0x43, 0xC4, 0xA4, 0x06, 0x00, 0xC8, 0x8E, 0x76,
-    0x10, 0xF3, 0x2E, 0x9D, 0x09, 0xFF, 0x98, 0x22, 0xC1, 0x32, 0xEF, 0x8C, 0x4C, 0xA0, 0xD0, 0x02,
-    0xC6, 0x4F, 0xF5, 0x0D, 0x3F, 0xB1, 0xB0, 0x00, 0x03, 0xE1, 0xA3, 0x01, 0x2C, 0xD7, 0x4C, 0x56,
-    0xC8, 0x8C, 0x73, 0x28, 0xBA, 0x37, 0x63, 0x5E, 0xC0, 0x92, 0x70, 0x1E, 0xB2, 0x3E, 0x61, 0x72,
-    0xB1, 0x59, 0x2C, 0x74, 0xC3, 0x90, 0x33, 0x3D, 0xBB, 0x95, 0x37, 0x06, 0xB9, 0x54, 0x28, 0x5C,
-    0xB9, 0x96, 0x22, 0x49, 0xB1, 0x64, 0x1A, 0x5D, 0x7A, 0x85, 0x6B, 0x79, 0x8C, 0xAA, 0x14, 0x1D,
-    0x7F, 0xA2, 0x70, 0x1F, 0x89, 0x94, 0x10, 0xA1, 0xAD, 0xEA, 0xA7, 0x47, 0xBD, 0xDB, 0xB7, 0x2A,
-    0xA0, 0x9A, 0x99, 0x9D, 0xAF, 0x8A, 0xA8, 0x38, 0xAB, 0xE7, 0xBD, 0x11, 0x9D, 0x96, 0xAF, 0x0F,
-    0x55, 0xB2, 0x00, 0x9F, 0x74, 0xB1, 0x0C, 0x42, 0x5A, 0xA4, 0x56, 0x91, 0x77, 0x9A, 0x60, 0x37,
-    0x5C, 0xDC, 0x08, 0x1F, 0x5E, 0xBC, 0x5A, 0x17, 0x90, 0x93, 0x33, 0x8D, 0xAA, 0x9A, 0x31, 0x08,
-    0xA3, 0x6D, 0x28, 0x78, 0xDB, 0x24, 0xAE, 0x3D, 0x01, 0xF6, 0xDE, 0x3C, 0xE1, 0x2D, 0x2F, 0x3D,
-    0x53, 0x95, 0x65, 0xC0, 0xD7, 0x2F, 0xF8, 0xC0, 0x42, 0x24, 0xD0, 0x40, 0x61, 0x74, 0x74, 0x61,
-    0x6B, 0x36, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x35, 0xCD, 0x3F,
-    0x73, 0x2F, 0xEF, 0x55, 0x89, 0x32, 0xF0, 0x55, 0x62, 0x1F, 0xCB, 0x7A, 0x6D, 0x18, 0xFB, 0x7A,
-    0x8F, 0x1C, 0xFC, 0x70, 0x62, 0x47, 0xCE, 0x10, 0x6C, 0x40, 0xFE, 0x06, 0x8F, 0x44, 0xFF, 0x26,
-    0xDE, 0x5E, 0x8E, 0x1E, 0xDE, 0x44, 0x8C, 0x6B, 0xDE, 0x4F, 0x96, 0x04, 0xDE, 0x52, 0x85, 0x60,
-    0xFD, 0x48, 0x8D, 0x65, 0xFD, 0x53, 0x97, 0x87, 0xFD, 0x62, 0x8F, 0x2A, 0xFD, 0x56, 0x86, 0x4A,
-    0xCD, 0x63, 0xB7, 0x20, 0xCE, 0x2B, 0xB3, 0x68, 0xCD, 0x36, 0xC3, 0x89, 0xCD, 0x52, 0xC6, 0x09,
-    0xCD, 0x58, 0xA7, 0x4F, 0xCE, 0x3C, 0xA5, 0x5D, 0xF1, 0x2F, 0xB4, 0x64, 0xF1, 0x3A, 0xC5, 0x8C,
-    0xF0, 0x56, 0xC7, 0x0D, 0xF0, 0x67, 0xB9, 0x2A, 0xF0, 0x5C, 0xA8, 0x49, 0xF1, 0x40, 0xA6, 0x42,
-    0x53, 0x24, 0x4C, 0x5B, 0xF2, 0x00, 0x74, 0x6E, 0x52, 0x0D, 0xC4, 0x7A, 0xCF, 0x10, 0xC7, 0x6E,
-    0x52, 0x6F, 0x52, 0x1D, 0xEF, 0xAE, 0x82, 0x25, 0x51, 0x58, 0xCA, 0x18, 0xCD, 0x75, 0xCF, 0x25,
-    0xEE, 0x2C, 0x51, 0x5E, 0xEC, 0x8F, 0x59, 0x48, 0xFF, 0x15, 0x6B, 0x44, 0xFD, 0xA1, 0x76, 0x2E,
-    0x41, 0x1B, 0xAC, 0x7A, 0x42, 0x2B, 0x5A, 0x58, 0x41, 0x5E, 0x5E, 0x9E, 0x40, 0x4F, 0xB0, 0x17,
-    0x01, 0x01, 0xAC, 0x7A, 0x01, 0x41, 0x43, 0x9B, 0x00, 0x56, 0xB3, 0x14, 0xD2, 0x29, 0xDF, 0x3A,
-    0x52, 0x2F, 0xDC, 0x02, 0xD1, 0x56, 0xE3, 0x0D, 0x41, 0x32, 0xBF, 0x7F, 0x00, 0x28, 0xC1, 0x01,
-    0x23, 0x41, 0x5A, 0x54, 0xC0, 0x9A, 0x59, 0x26, 0xC1, 0x16, 0x4E, 0x5E, 0xB7, 0x98, 0x58, 0x1A,
-    0xB9, 0x15, 0x4E, 0x71, 0xB0, 0x32, 0x16, 0x78, 0xB6, 0x92, 0x17, 0x4C, 0xAE, 0x90, 0x1D, 0x17,
-    0xB8, 0x34, 0x10, 0x63, 0xAB, 0x8B, 0x09, 0x47, 0xAC, 0x3D, 0x03, 0x5D, 0x7A, 0x34, 0x66, 0x6A,
-    0x7E, 0x70, 0x05, 0x1A, 0x79, 0x61, 0x6A, 0x19, 0x7E, 0x4D, 0x02, 0x77, 0x9A, 0xFF, 0x95, 0x4E,
-    0xAC, 0xFF, 0xA2, 0x2C, 0x9B, 0x82, 0x8B, 0x9B, 0xAD, 0x82, 0x98, 0x34, 0x99, 0xFA, 0xAD, 0x11,
-    0x9B, 0x7D, 0xA3, 0x7E, 0x49, 0x35, 0x00, 0x71, 0x66, 0x5A, 0x04, 0x40, 0x55, 0x34, 0x59, 0x7B,
-    0x73, 0x4B, 0x5B, 0x34, 0x48, 0x77, 0x05, 0x1B, 0x55, 0x5A, 0x5C, 0x16, 0x88, 0x59, 0x25, 0x8F,
-    0x9E, 0x81, 0x1B, 0x06, 0x9F, 0x3C, 0x16, 0x6A, 0x2D, 0xCA, 0xA7, 0x3D, 0x3C, 0xF0, 0x44, 0x3D,
-    0xC8, 0xC4, 0x3C, 0x3D, 0xD7, 0x84, 0xE6, 0xBF, 0x32, 0x70, 0x06, 0xC1, 0xE9, 0x1D, 0xBE, 0x40,
-    0x61, 0x74, 0x74, 0x61, 0x6B, 0x37, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x66, 0x64, 0xC6, 0x3D, 0x6A, 0x66, 0xE8, 0x4A, 0x7E, 0x76, 0xF0, 0x4A, 0x60, 0x52, 0xC2, 0x68,
-    0x66, 0x56, 0xF1, 0x6D, 0x86, 0x70, 0xFE, 0x36, 0x5A, 0x67, 0xC3, 0x8E, 0x60, 0x6A, 0xF2, 0x18,
-    0x80, 0x84, 0xFF, 0x1C, 0xD3, 0xC7, 0xB3, 0x1F, 0xD7, 0xB9, 0xB3, 0x6E, 0xD4, 0xBF, 0xBA, 0x01,
-    0xD5, 0xC1, 0xAB, 0x55, 0xF3, 0xD1, 0xBE, 0x37, 0xF0, 0xD7, 0xC6, 0x0C, 0xEF, 0xDE, 0xBF, 0x23,
-    0xF2, 0xD8, 0xB7, 0x48, 0xBE, 0xBE, 0xD2, 0x1F, 0xC6, 0xA2, 0xD1, 0x6D, 0xC3, 0xA7, 0xE0, 0x89,
-    0xBF, 0xB6, 0xE0, 0x03, 0xC2, 0xB9, 0xC4, 0x4F, 0xC6, 0xAA, 0xC3, 0x5E, 0xE6, 0xBC, 0xDE, 0x36,
-    0xE3, 0xC2, 0xED, 0x3B, 0xDF, 0xD0, 0xED, 0x0E, 0xDE, 0xD9, 0xDF, 0x25, 0xE2, 0xD3, 0xD1, 0x47,
-    0xE6, 0xC5, 0xD0, 0x43, 0x5F, 0x4A, 0x4A, 0x5C, 0xF4, 0xA3, 0xA7, 0x8C, 0x55, 0x3E, 0xB7, 0x6B,
-    0xC9, 0x94, 0xE5, 0x8C, 0x54, 0x70, 0x4B, 0x9E, 0xDB, 0xFC, 0xA9, 0x21, 0x4A, 0x64, 0xB8, 0x15,
-    0xBA, 0xC8, 0xE7, 0x06, 0xEF, 0xB8, 0x84, 0x5F, 0xE0, 0xEA, 0x85, 0x48, 0xFF, 0xB7, 0xA2, 0x3F,
-    0xEA, 0xFF, 0xA4, 0x2D, 0x45, 0x39, 0x9B, 0x6D, 0x4D, 0x42, 0x50, 0x5C, 0x45, 0x5C, 0x51, 0x9E,
-    0x3E, 0x54, 0x9C, 0x16, 0x0D, 0x00, 0x86, 0x6B, 0x10, 0x21, 0x23, 0xA0, 0x00, 0x2C, 0x87, 0x12,
-    0xC5, 0xA3, 0xFB, 0x3C, 0x4D, 0x4F, 0xCB, 0x7F, 0xBF, 0xBB, 0xFB, 0x09, 0x40, 0x45, 0xAB, 0x7F,
-    0x05, 0x14, 0x96, 0x00, 0x2D, 0x38, 0x44, 0x54, 0xB5, 0xD1, 0x75, 0x1C, 0xC8, 0x8E, 0x73, 0x42,
-    0xAD, 0xCB, 0x72, 0x9C, 0xC1, 0x87, 0x70, 0x61, 0xBA, 0x90, 0x38, 0x7A, 0xB4, 0xC6, 0x36, 0x28,
-    0xAD, 0xC0, 0x39, 0x15, 0xC2, 0x96, 0x35, 0x44, 0xAC, 0xBB, 0x26, 0x4D, 0xB7, 0x93, 0x24, 0x5E,
-    0x7F, 0x6C, 0x6E, 0x8A, 0x86, 0x8E, 0x14, 0x9C, 0x78, 0x84, 0x6F, 0x93, 0x8B, 0x7C, 0x14, 0x73,
-    0x7E, 0xED, 0x99, 0x4E, 0x8E, 0xF9, 0xAB, 0x24, 0x90, 0xAC, 0x97, 0xA0, 0xA0, 0xB9, 0xA9, 0x2E,
-    0x7C, 0xEA, 0xAF, 0x90, 0x8E, 0xAA, 0xAD, 0x80, 0x5C, 0x4B, 0x00, 0x61, 0x72, 0x72, 0x0C, 0x4B,
-    0x5E, 0x54, 0x55, 0x77, 0x76, 0x74, 0x60, 0x2E, 0x52, 0x6D, 0x01, 0x93, 0x59, 0x67, 0x56, 0x13,
-    0x8E, 0x89, 0x36, 0x96, 0x9F, 0xAD, 0x33, 0x18, 0xA9, 0x8A, 0x31, 0x6C, 0x48, 0x6E, 0xAD, 0x3D,
-    0xE0, 0x7A, 0x26, 0x3D, 0xEA, 0xAF, 0x34, 0x3D, 0x69, 0x37, 0xAE, 0xBF, 0x4D, 0x9C, 0x26, 0xC1,
-    0xB3, 0x8F, 0x99, 0x40, 0x61, 0x74, 0x74, 0x61, 0x6B, 0x38, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x5A, 0xCB, 0x3E, 0x71, 0x5C, 0xED, 0x4A, 0x85, 0x69, 0xF0, 0x4A,
-    0x63, 0x48, 0xC8, 0x68, 0x6C, 0x49, 0xF7, 0x68, 0x8D, 0x5F, 0xFD, 0x64, 0x5F, 0x62, 0xCA, 0x8E,
-    0x68, 0x63, 0xF9, 0x17, 0x89, 0x78, 0xFF, 0x26, 0xD7, 0xB1, 0x9B, 0x1F, 0xDA, 0xA0, 0x9A, 0x6D,
-    0xD9, 0xA8, 0xA3, 0x04, 0xD9, 0xAA, 0x93, 0x60, 0xF8, 0xB3, 0x9F, 0x45, 0xF6, 0xBB, 0xA8, 0x85,
-    0xF5, 0xC4, 0xA0, 0x25, 0xF7, 0xBD, 0x98, 0x48, 0xC5, 0xAC, 0xC1, 0x1F, 0xCB, 0x88, 0xBE, 0x6D,
-    0xC9, 0x8F, 0xCE, 0x89, 0xC6, 0xA1, 0xCF, 0x03, 0xC7, 0xA5, 0xB1, 0x4F, 0xCA, 0x93, 0xB0, 0x5E,
-    0xEC, 0x9E, 0xC3, 0x45, 0xEB, 0xA5, 0xD3, 0x3A, 0xE8, 0xB7, 0xD5, 0x0E, 0xE7, 0xC2, 0xC6, 0x2A,
-    0xE9, 0xBA, 0xB7, 0x47, 0xEB, 0xA9, 0xB5, 0x42, 0x58, 0x41, 0x4C, 0x5C, 0xF3, 0x7E, 0x86, 0x6E,
-    0x55, 0x33, 0xBF, 0x6B, 0xCD, 0x78, 0xD2, 0x8C, 0x51, 0x71, 0x4F, 0x9E, 0xE2, 0xEE, 0x90, 0x23,
-    0x4E, 0x63, 0xC3, 0x18, 0xC4, 0xB9, 0xD8, 0x23, 0xED, 0x98, 0x63, 0x5F, 0xE4, 0xD8, 0x69, 0x48,
-    0xFF, 0x93, 0x7F, 0x43, 0xF1, 0xED, 0x86, 0x2F, 0x44, 0x33, 0xA6, 0x68, 0x46, 0x3C, 0x57, 0x5B,
-    0x41, 0x5D, 0x59, 0x9E, 0x3F, 0x54, 0xA9, 0x16, 0x08, 0x00, 0x9F, 0x7A, 0x07, 0x28, 0x37, 0x98,
-    0x00, 0x37, 0xA3, 0x14, 0xCD, 0x8A, 0xE9, 0x3C, 0x51, 0x49, 0xD6, 0x84, 0xC9, 0xA7, 0xEC, 0x0A,
-    0x41, 0x42, 0xB8, 0x7F, 0x04, 0x1A, 0xB2, 0x00, 0x26, 0x3A, 0x52, 0x54, 0xB7, 0xC7, 0x62, 0x1C,
-    0xC4, 0x72, 0x5C, 0x66, 0xAF, 0xC2, 0x61, 0x9C, 0xBC, 0x6D, 0x5A, 0x67, 0xB3, 0x7A, 0x22, 0x7A,
-    0xB1, 0xBC, 0x22, 0x28, 0xAA, 0xB6, 0x27, 0x15, 0xBB, 0x7F, 0x1D, 0x66, 0xA7, 0xB1, 0x13, 0x4D,
-    0xAF, 0x7F, 0x0F, 0x5E, 0x7C, 0x60, 0x69, 0x6C, 0x7E, 0x87, 0x0A, 0x9C, 0x77, 0x7D, 0x6B, 0x12,
-    0x82, 0x71, 0x09, 0x73, 0x88, 0xF5, 0x96, 0x4E, 0x99, 0xFF, 0xA4, 0x24, 0x94, 0xA5, 0x8F, 0x98,
-    0xA5, 0xAF, 0x9E, 0x33, 0x88, 0xF3, 0xAD, 0x0F, 0x94, 0xA2, 0xA7, 0x7E, 0x50, 0x45, 0x00, 0x61,
-    0x69, 0x6C, 0x06, 0x4A, 0x59, 0x4D, 0x58, 0x76, 0x73, 0x6B, 0x5D, 0x33, 0x49, 0x6F, 0x03, 0x19,
-    0x55, 0x65, 0x5A, 0x13, 0x89, 0x7E, 0x2B, 0x91, 0x9B, 0xA4, 0x23, 0x07, 0xA2, 0x78, 0x20, 0x6A,
-    0x7A, 0xF3, 0xAF, 0x3D, 0xF1, 0x89, 0xE5, 0x3C, 0x0B, 0x4C, 0x3F, 0x3D, 0xEB, 0x26, 0x3C, 0xC1,
-    0x13, 0x83, 0x1D, 0xC1, 0x1D, 0x47, 0x1B, 0x41, 0x70, 0x61, 0x69, 0x6E, 0x31, 0x30, 0x31, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x3B, 0xC4, 0x3F, 0x6A, 0x31, 0xE5, 0x4A,
-    0x7F, 0x31, 0xEE, 0x4A, 0x5D, 0x28, 0xBE, 0x77, 0x63, 0x1A, 0xEC, 0x7A, 0x84, 0x1A, 0xFA, 0x70,
-    0x5D, 0x4F, 0xC2, 0x13, 0x62, 0x41, 0xF0, 0x07, 0x83, 0x40, 0xFF, 0x28, 0xDC, 0x5B, 0xB9, 0x20,
-    0xDC, 0x42, 0xB6, 0x68, 0xDB, 0x4C, 0xBF, 0x04, 0xDD, 0x51, 0xB0, 0x60, 0xFA, 0x41, 0xC3, 0x64,
-    0xF9, 0x4B, 0xCC, 0x87, 0xFA, 0x5A, 0xC6, 0x2F, 0xFB, 0x50, 0xBD, 0x4B, 0xC7, 0x5D, 0xD7, 0x20,
-    0xC8, 0x27, 0xD1, 0x68, 0xC6, 0x30, 0xE0, 0x81, 0xC6, 0x4B, 0xE3, 0x03, 0xC9, 0x54, 0xC8, 0x48,
-    0xCA, 0x39, 0xC5, 0x5E, 0xEA, 0x27, 0xE0, 0x64, 0xE8, 0x30, 0xEF, 0x8A, 0xE8, 0x4B, 0xF2, 0x0E,
-    0xE9, 0x5D, 0xE6, 0x2F, 0xEB, 0x54, 0xD7, 0x49, 0xEB, 0x39, 0xD4, 0x42, 0x5C, 0x3D, 0x47, 0x5D,
-    0xF1, 0x00, 0xA4, 0x6D, 0x4F, 0x19, 0xB1, 0x7A, 0xC7, 0x0B, 0xE2, 0x6C, 0x5B, 0x84, 0x50, 0x1D,
-    0xEF, 0xA7, 0xB8, 0x23, 0x4E, 0x61, 0xB9, 0x18, 0xC5, 0x6C, 0xEE, 0x2D, 0xF1, 0x2F, 0x86, 0x5F,
-    0xF0, 0x8E, 0x91, 0x4B, 0xFF, 0x13, 0xA2, 0x44, 0xFD, 0x9A, 0xB2, 0x30, 0x41, 0x2C, 0x95, 0x73,
-    0x4A, 0x44, 0x4D, 0x5D, 0x49, 0x75, 0x53, 0x4D, 0x40, 0x5D, 0x9B, 0x17, 0x02, 0x1B, 0x7D, 0x77,
-    0x0E, 0x64, 0x21, 0x99, 0x01, 0x6D, 0x86, 0x14, 0xC7, 0x20, 0xFA, 0x3A, 0x4C, 0x37, 0xC8, 0x7F,
-    0xC7, 0x4B, 0xFF, 0x0D, 0x3E, 0x3F, 0xA7, 0x80, 0x00, 0x3F, 0x90, 0x00, 0x2C, 0x5D, 0x43, 0x56,
-    0xC5, 0x9E, 0x80, 0x26, 0xC6, 0x20, 0x72, 0x66, 0xBD, 0x9E, 0x7D, 0x1A, 0xBE, 0x20, 0x6E, 0x71,
-    0xBB, 0x43, 0x3A, 0x77, 0xC2, 0x9F, 0x42, 0x2B, 0xBA, 0x9E, 0x44, 0x16, 0xC4, 0x45, 0x37, 0x66,
-    0xB9, 0x9C, 0x30, 0x26, 0xBA, 0x51, 0x28, 0x5E, 0x7F, 0x43, 0x6E, 0x6A, 0x8D, 0x88, 0x1B, 0x1A,
-    0x7F, 0x6F, 0x73, 0x19, 0x8E, 0x66, 0x17, 0x72, 0x9B, 0xFF, 0xAD, 0x4F, 0xAB, 0xFB, 0xBF, 0x25,
-    0x9C, 0x86, 0x9F, 0x99, 0xAC, 0x83, 0xB1, 0x39, 0x98, 0xF8, 0xC2, 0x0F, 0x9A, 0x7F, 0xB4, 0x7E,
-    0x5A, 0x57, 0x00, 0x5A, 0x76, 0x76, 0x10, 0x41, 0x5D, 0x4A, 0x54, 0x74, 0x79, 0x5C, 0x62, 0x34,
-    0x59, 0x96, 0x07, 0x1A, 0x5D, 0x6E, 0x58, 0x14, 0x94, 0x6D, 0x3B, 0x8F, 0xAA, 0x92, 0x3C, 0x07,
-    0xAB, 0x4F, 0x34, 0x79, 0x56, 0xB5, 0xAE, 0x3D, 0xF1, 0x89, 0xE5, 0x3C, 0x55, 0x48, 0x33, 0x3D,
-    0x9D, 0xB9, 0x06, 0xC1, 0x13, 0x83, 0x1D, 0xC1, 0x53, 0x5E, 0x06, 0x41, 0x70, 0x61, 0x69, 0x6E,
-    0x31, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x3B, 0xCB, 0x3F,
-    0x71, 0x31, 0xEC, 0x4A, 0x86, 0x31, 0xEF, 0x4A, 0x61, 0x28, 0xC7, 0x77, 0x6A, 0x1A, 0xF6, 0x7A,
-    0x8C, 0x1A, 0xFA, 0x62, 0x61, 0x4F, 0xCC, 0x13, 0x6A, 0x41, 0xFB, 0x08, 0x8C, 0x40, 0xFF, 0x28,
-    0xDE, 0x5B, 0x99, 0x1E, 0xDE, 0x42, 0x96, 0x68, 0xDE, 0x4C, 0xA0, 0x04, 0xDE, 0x51, 0x90, 0x54,
-    0xFD, 0x41, 0x9A, 0x65, 0xFC, 0x4B, 0xA4, 0x87, 0xFD, 0x5A, 0x9D, 0x2F, 0xFD, 0x50, 0x94, 0x48,
-    0xCC, 0x5D, 0xC0, 0x20, 0xCD, 0x27, 0xB9, 0x68, 0xCC, 0x30, 0xCA, 0x89, 0xCC, 0x4B, 0xCD, 0x09,
-    0xCD, 0x54, 0xB0, 0x4F, 0xCD, 0x39, 0xAC, 0x5D, 0xEF, 0x27, 0xBE, 0x62, 0xEF, 0x30, 0xCE, 0x8C,
-    0xEF, 0x4B, 0xD2, 0x0C, 0xEF, 0x5D, 0xC5, 0x2E, 0xF0, 0x54, 0xB4, 0x49, 0xF0, 0x39, 0xB1, 0x42,
-    0x55, 0x3D, 0x4A, 0x5D, 0xF1, 0x00, 0x7D, 0x6D, 0x51, 0x19, 0xBE, 0x7A, 0xCD, 0x0B, 0xCC, 0x6E,
-    0x55, 0x84, 0x53, 0x1D, 0xF1, 0xA7, 0x92, 0x25, 0x51, 0x61, 0xC7, 0x18, 0xCD, 0x6C, 0xD8, 0x2D,
-    0xEF, 0x2F, 0x5D, 0x60, 0xEE, 0x8E, 0x69, 0x48, 0xFF, 0x13, 0x76, 0x44, 0xFF, 0x9A, 0x87, 0x30,
-    0x41, 0x2C, 0xA5, 0x7A, 0x43, 0x44, 0x57, 0x58, 0x43, 0x75, 0x5D, 0x1D, 0x41, 0x5D, 0xAC, 0x17,
-    0x01, 0x1B, 0x9F, 0x77, 0x04, 0x64, 0x3B, 0x9B, 0x00, 0x6D, 0xA9, 0x16, 0xCF, 0x20, 0xE5, 0x3A,
-    0x50, 0x37, 0xD7, 0x84, 0xCF, 0x4B, 0xEA, 0x0D, 0x40, 0x3F, 0xB9, 0x7F, 0x00, 0x3F, 0xB5, 0x02,
-    0x25, 0x5D, 0x55, 0x53, 0xC2, 0x9E, 0x65, 0x26, 0xC2, 0x20, 0x55, 0x66, 0xBA, 0x9E, 0x64, 0x1A,
-    0xBA, 0x20, 0x54, 0x71, 0xB3, 0x43, 0x1E, 0x77, 0xBA, 0x9F, 0x24, 0x4C, 0xB2, 0x9E, 0x29, 0x17,
-    0xBB, 0x45, 0x19, 0x66, 0xAF, 0x9C, 0x15, 0x47, 0xAF, 0x51, 0x0B, 0x5D, 0x7B, 0x43, 0x68, 0x6A,
-    0x82, 0x88, 0x0C, 0x1A, 0x7B, 0x6F, 0x6D, 0x1B, 0x82, 0x66, 0x08, 0x72, 0x9C, 0xFF, 0xA1, 0x4D,
-    0xAE, 0xFB, 0xAF, 0x25, 0x9C, 0x86, 0x92, 0x9B, 0xAE, 0x83, 0xA0, 0x34, 0x9B, 0xF8, 0xB8, 0x0F,
-    0x9C, 0x7F, 0xA9, 0x7E, 0x4D, 0x57, 0x00, 0x71, 0x6A, 0x76, 0x08, 0x4A, 0x57, 0x4A, 0x58, 0x7B,
-    0x74, 0x5C, 0x5E, 0x34, 0x4D, 0x96, 0x08, 0x1B, 0x57, 0x6E, 0x5C, 0x15, 0x8B, 0x6D, 0x2C, 0x8F,
-    0xA2, 0x92, 0x25, 0x08, 0xA2, 0x4F, 0x1D, 0x79, 0x6F, 0xDB, 0xAD, 0x3D, 0xF1, 0x89, 0xE5, 0x3C,
-    0xDC, 0x41, 0x35, 0x3D, 0x3B, 0x38, 0xAA, 0xC0, 0x13, 0x83, 0x1D, 0xC1, 0x7B, 0x7E, 0xCC, 0x40,
-    0x70, 0x61, 0x69, 0x6E, 0x31, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x71, 0x3B, 0xD0, 0x43, 0x7B, 0x31, 0xEF, 0x56, 0x90, 0x31, 0xEB, 0x56, 0x68, 0x28, 0xD0, 0x77,
-    0x75, 0x1A, 0xFA, 0x7A, 0x97, 0x1A, 0xF4, 0x62, 0x68, 0x4F, 0xD4, 0x10, 0x75, 0x41, 0xFF, 0x08,
-    0x97, 0x40, 0xF9, 0x26, 0xE0, 0x5B, 0x7C, 0x20, 0xE0, 0x42, 0x79, 0x68, 0xE0, 0x4C, 0x82, 0x0E,
-    0xDF, 0x51, 0x73, 0x54, 0xFF, 0x41, 0x73, 0x65, 0xFF, 0x4B, 0x7D, 0x8B, 0xFF, 0x5A, 0x76, 0x2A,
-    0xFE, 0x50, 0x6D, 0x48, 0xD2, 0x5D, 0xA7, 0x20, 0xD1, 0x27, 0xA1, 0x68, 0xD2, 0x30, 0xB1, 0x89,
-    0xD2, 0x4B, 0xB4, 0x09, 0xD1, 0x54, 0x97, 0x4F, 0xD1, 0x39, 0x94, 0x5D, 0xF4, 0x27, 0x9A, 0x62,
-    0xF5, 0x30, 0xAA, 0x8C, 0xF5, 0x4B, 0xAE, 0x0D, 0xF5, 0x5D, 0xA1, 0x2E, 0xF4, 0x54, 0x90, 0x49,
-    0xF4, 0x39, 0x8D, 0x40, 0x51, 0x3D, 0x5A, 0x58, 0xF1, 0x00, 0x5A, 0x6D, 0x57, 0x19, 0xCB, 0x7A,
-    0xD3, 0x0B, 0xB3, 0x6E, 0x52, 0x84, 0x63, 0x1D, 0xF2, 0xA7, 0x6F, 0x25, 0x58, 0x61, 0xD4, 0x07,
-    0xD4, 0x6C, 0xBF, 0x25, 0xEB, 0x2F, 0x3C, 0x60, 0xEC, 0x8E, 0x47, 0x48, 0xFE, 0x13, 0x4F, 0x42,
-    0xFF, 0x9A, 0x60, 0x2E, 0x45, 0x2C, 0xB9, 0x7A, 0x41, 0x44, 0x6B, 0x58, 0x41, 0x75, 0x72, 0x1D,
-    0x45, 0x5D, 0xBF, 0x06, 0x05, 0x1B, 0xC7, 0x77, 0x00, 0x64, 0x64, 0x94, 0x06, 0x6D, 0xD1, 0x16,
-    0xD8, 0x20, 0xCA, 0x38, 0x58, 0x37, 0xE4, 0x84, 0xD8, 0x4B, 0xCF, 0x0D, 0x46, 0x3F, 0xCC, 0x7F,
-    0x06, 0x3F, 0xDC, 0x02, 0x22, 0x5D, 0x73, 0x53, 0xC0, 0x9E, 0x52, 0x26, 0xBF, 0x20, 0x42, 0x5E,
-    0xB7, 0x9E, 0x53, 0x1B, 0xB7, 0x20, 0x44, 0x71, 0xAA, 0x43, 0x11, 0x78, 0xB3, 0x9F, 0x15, 0x4C,
-    0xAB, 0x9E, 0x1C, 0x17, 0xB2, 0x45, 0x0A, 0x5E, 0xA6, 0x9C, 0x09, 0x1C, 0xA6, 0x51, 0x00, 0x5D,
-    0x7A, 0x43, 0x6A, 0x6B, 0x79, 0x88, 0x0F, 0x1A, 0x7A, 0x6F, 0x70, 0x14, 0x79, 0x66, 0x0B, 0x75,
-    0x9F, 0xFF, 0x98, 0x4E, 0xB2, 0xFB, 0xA0, 0x2C, 0x9E, 0x86, 0x89, 0x94, 0xB1, 0x83, 0x91, 0x34,
-    0xA0, 0xF8, 0xAF, 0x01, 0x9F, 0x7F, 0xA0, 0x7F, 0x43, 0x57, 0x14, 0x71, 0x61, 0x76, 0x12, 0x4A,
-    0x55, 0x4A, 0x66, 0x7B, 0x72, 0x5C, 0x63, 0x3F, 0x44, 0x96, 0x1B, 0x1B, 0x55, 0x6E, 0x6A, 0x15,
-    0x85, 0x6D, 0x2B, 0x92, 0x9B, 0x92, 0x1E, 0x08, 0x9A, 0x4F, 0x15, 0x6B, 0x7A, 0xF6, 0xAC, 0x3D,
-    0xF1, 0x89, 0xE5, 0x3C, 0x57, 0xAC, 0x3D, 0x3D, 0xD0, 0xD3, 0x12, 0xC0, 0x13, 0x83, 0x1D, 0xC1,
-    0xCB, 0x9D, 0x81, 0x40, 0x70, 0x61, 0x69, 0x6E, 0x31, 0x30, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x79, 0x3B, 0xD4, 0x41, 0x86, 0x31, 0xEE, 0x56, 0x9B, 0x31, 0xE4, 0x56,
-    0x70, 0x28, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A, 0xA2, 0x1A, 0xEA, 0x62, 0x71, 0x4F, 0xDB, 0x11,
-    0x81, 0x41, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68,
-    0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B,
-    0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x27, 0x8B, 0x68,
-    0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x39, 0x7E, 0x58,
-    0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29,
-    0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70,
-    0x5F, 0x19, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1A, 0xF1, 0xA7, 0x52, 0x25,
-    0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2E, 0x4F,
-    0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x44, 0x83, 0xA0,
-    0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5D, 0xD1, 0x06, 0x0D, 0x1B, 0xEB, 0x78, 0x00, 0x64, 0x90, 0x94,
-    0x0F, 0x6D, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38, 0x63, 0x37, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31,
-    0x4E, 0x3F, 0xDD, 0x84, 0x10, 0x3F, 0xFF, 0x05, 0x23, 0x5D, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26,
-    0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78,
-    0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9C, 0x09, 0x1C,
-    0x9C, 0x51, 0x00, 0x58, 0x79, 0x43, 0x71, 0x6C, 0x71, 0x88, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14,
-    0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E, 0xB5, 0xFB, 0x94, 0x2C, 0xA0, 0x86, 0x84, 0x94,
-    0xB3, 0x83, 0x86, 0x3F, 0xA5, 0xF8, 0xA7, 0x01, 0xA3, 0x7F, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71,
-    0x59, 0x76, 0x25, 0x56, 0x54, 0x4A, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B,
-    0x55, 0x6E, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A,
-    0x6A, 0x16, 0x76, 0x3D, 0xE2, 0xCA, 0x78, 0x3D, 0xFC, 0x41, 0x87, 0x3D, 0xE6, 0x8F, 0x6A, 0xC1,
-    0x1D, 0xA3, 0x99, 0xC1, 0xDC, 0x7A, 0x57, 0x41, 0x70, 0x61, 0x69, 0x6E, 0x32, 0x30, 0x31, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xA1, 0x99, 0x6F, 0x4C, 0xA2, 0xB1, 0x65,
-    0x5C, 0x91, 0xC2, 0x65, 0x47, 0xA2, 0x90, 0x96, 0x3C, 0xA3, 0xB1, 0x96, 0x56, 0x88, 0xCC, 0x7A,
-    0x52, 0xB0, 0x93, 0x1F, 0x47, 0xB1, 0xB3, 0x23, 0x62, 0x96, 0xCF, 0x3F, 0xCA, 0x3D, 0xD4, 0x2B,
-    0xC3, 0x34, 0xD2, 0x76, 0xC3, 0x3A, 0xD7, 0x03, 0xCA, 0x36, 0xCF, 0x5E, 0xDA, 0x1B, 0xEB, 0x68,
-    0xDB, 0x22, 0xF0, 0x7F, 0xE2, 0x24, 0xED, 0x31, 0xE1, 0x1E, 0xE8, 0x44, 0xB2, 0x57, 0xDC, 0x2A,
-    0xA2, 0x44, 0xD8, 0x75, 0x9F, 0x4C, 0xE1, 0x0F, 0xA7, 0x56, 0xE3, 0x07, 0xB4, 0x4F, 0xD3, 0x42,
-    0xAC, 0x46, 0xD2, 0x5C, 0xBC, 0x28, 0xF5, 0x6B, 0xBA, 0x31, 0xFD, 0x81, 0xC2, 0x3A, 0xFF, 0x04,
-    0xCC, 0x3C, 0xF8, 0x3B, 0xCF, 0x34, 0xF0, 0x3F, 0xC7, 0x2A, 0xEE, 0x62, 0x68, 0x8D, 0x44, 0x5B,
-    0xC3, 0x07, 0xD3, 0x78, 0x38, 0xA7, 0x80, 0x91, 0x93, 0x40, 0xE3, 0x83, 0x7D, 0xA7, 0x49, 0x4C,
-    0xF5, 0x43, 0xDE, 0x32, 0x4D, 0xC1, 0x84, 0x21, 0xB0, 0x63, 0xE9, 0x32, 0xDB, 0x0F, 0xBF, 0x63,
-    0xF7, 0x31, 0xC6, 0x44, 0xD7, 0x00, 0xD9, 0x70, 0xFF, 0x30, 0xE2, 0x0B, 0x38, 0xB4, 0x66, 0x74,
-    0x59, 0xA2, 0x3E, 0x58, 0x67, 0xB4, 0x41, 0x4B, 0x46, 0xC5, 0x6A, 0x24, 0x00, 0xE1, 0x34, 0x96,
-    0x38, 0xD9, 0x00, 0x53, 0x18, 0xFF, 0x39, 0x27, 0x95, 0x4C, 0xF2, 0x89, 0x3A, 0xB9, 0x8D, 0x11,
-    0xA2, 0x5C, 0xF5, 0x0E, 0x38, 0xC0, 0x71, 0x10, 0x05, 0xF4, 0x3F, 0x18, 0x49, 0xC3, 0x26, 0x5F,
-    0xD9, 0x5A, 0xA3, 0x3F, 0xB4, 0x2C, 0x9B, 0x61, 0xD3, 0x61, 0x9C, 0x28, 0xAD, 0x33, 0x94, 0xA1,
-    0xC3, 0x35, 0x71, 0x97, 0xE6, 0x4E, 0x7A, 0x34, 0xDE, 0x55, 0x77, 0x24, 0xCB, 0x2D, 0x74, 0x67,
-    0xE0, 0x51, 0x69, 0x3F, 0xCA, 0x36, 0x64, 0x5B, 0x81, 0x78, 0x70, 0x7B, 0xB8, 0x6D, 0x43, 0x49,
-    0x8E, 0x88, 0x73, 0x26, 0xAE, 0x61, 0x41, 0x98, 0xCA, 0xAA, 0xA8, 0x41, 0xD3, 0x9F, 0xBC, 0x30,
-    0xA6, 0x7F, 0xA0, 0x53, 0xAF, 0x73, 0xB4, 0x8B, 0xC0, 0xAF, 0xB4, 0x16, 0x9C, 0x84, 0xAC, 0x14,
-    0x80, 0x86, 0x15, 0x9F, 0xA0, 0x7A, 0x2F, 0x65, 0x6B, 0x94, 0x4D, 0x94, 0x86, 0x83, 0x66, 0x8C,
-    0x93, 0x9D, 0x1A, 0x26, 0x75, 0xA1, 0x4F, 0x20, 0xAD, 0x67, 0x5B, 0x9C, 0xCE, 0x5E, 0x68, 0x2D,
-    0xBA, 0x46, 0x64, 0x7B, 0x71, 0x2B, 0xA1, 0x3D, 0xBB, 0x3A, 0x4E, 0x3D, 0x40, 0xBB, 0x51, 0x3D,
-    0x9F, 0x2A, 0x27, 0xC1, 0x93, 0x05, 0x87, 0xC1, 0x55, 0x5E, 0x37, 0x41, 0x70, 0x61, 0x69, 0x6E,
-    0x32, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x9A, 0xB4, 0x36,
-    0x60, 0x96, 0xD4, 0x42, 0x73, 0x85, 0xE1, 0x42, 0x54, 0x97, 0xAE, 0x74, 0x55, 0x92, 0xD9, 0x76,
-    0x73, 0x78, 0xEE, 0x68, 0x5B, 0xAB, 0xB0, 0x1B, 0x5B, 0xA6, 0xDB, 0x23, 0x79, 0x8B, 0xF0, 0x3D,
-    0xD4, 0x43, 0xC4, 0x28, 0xD0, 0x36, 0xC3, 0x78, 0xD0, 0x3D, 0xCA, 0x04, 0xD3, 0x3C, 0xBD, 0x60,
-    0xEB, 0x1F, 0xD5, 0x69, 0xEB, 0x25, 0xDC, 0x84, 0xEF, 0x2B, 0xD6, 0x30, 0xEF, 0x24, 0xCF, 0x43,
-    0xC0, 0x5A, 0xDB, 0x2C, 0xB7, 0x3F, 0xD8, 0x77, 0xB6, 0x46, 0xE5, 0x7F, 0xBB, 0x54, 0xE6, 0x09,
-    0xC1, 0x52, 0xCE, 0x4A, 0xBC, 0x44, 0xCC, 0x5B, 0xD6, 0x24, 0xED, 0x68, 0xD5, 0x2B, 0xF9, 0x88,
-    0xDA, 0x39, 0xFB, 0x0E, 0xDF, 0x3F, 0xF0, 0x3C, 0xE0, 0x37, 0xE3, 0x3E, 0xDB, 0x29, 0xE1, 0x65,
-    0x5C, 0x92, 0x42, 0x5B, 0xD8, 0x03, 0xBB, 0x79, 0x45, 0x9B, 0x9F, 0x76, 0xB0, 0x34, 0xE8, 0x79,
-    0x68, 0xB6, 0x46, 0x49, 0xF4, 0x57, 0xC4, 0x2F, 0x50, 0xBF, 0xA3, 0x21, 0xC0, 0x65, 0xEE, 0x2F,
-    0xE2, 0x15, 0x9D, 0x5E, 0xF2, 0x45, 0xA2, 0x41, 0xE9, 0x00, 0xBB, 0x64, 0xFF, 0x44, 0xC2, 0x3C,
-    0x3C, 0xAC, 0x83, 0x76, 0x4C, 0xA6, 0x43, 0x58, 0x54, 0xBF, 0x46, 0x49, 0x44, 0xC5, 0x85, 0x23,
-    0x00, 0xD6, 0x5F, 0x74, 0x1C, 0xE3, 0x0C, 0x9D, 0x0E, 0xFF, 0x63, 0x20, 0xB3, 0x41, 0xFD, 0x87,
-    0x46, 0xAF, 0xB2, 0x01, 0xBA, 0x57, 0xFF, 0x0D, 0x3D, 0xBA, 0x91, 0x0F, 0x03, 0xEC, 0x6E, 0x11,
-    0x35, 0xCA, 0x31, 0x55, 0xCD, 0x6F, 0x89, 0x4C, 0xB8, 0x30, 0x82, 0x63, 0xC6, 0x76, 0x84, 0x26,
-    0xB1, 0x36, 0x7D, 0x72, 0xB7, 0x43, 0x4B, 0x91, 0xCE, 0x69, 0x50, 0x3F, 0xC6, 0x70, 0x50, 0x21,
-    0xBF, 0x3C, 0x4B, 0x61, 0xC5, 0x6D, 0x3E, 0x4B, 0xB9, 0x48, 0x3A, 0x5D, 0x7C, 0x7D, 0x6C, 0x83,
-    0x9A, 0x86, 0x22, 0x1C, 0x84, 0x93, 0x6E, 0x1F, 0x94, 0x75, 0x20, 0x96, 0xB6, 0xC7, 0xA2, 0x48,
-    0xC3, 0xBA, 0xB6, 0x2E, 0xA2, 0x8B, 0x9C, 0x9D, 0xAF, 0x7D, 0xB0, 0x38, 0xB1, 0xC9, 0xB5, 0x18,
-    0x9D, 0x8C, 0xAF, 0x10, 0x62, 0x97, 0x00, 0x9F, 0x82, 0x90, 0x13, 0x44, 0x5F, 0x9A, 0x4D, 0x8F,
-    0x7C, 0x8C, 0x5F, 0x38, 0x6D, 0xB7, 0x03, 0x1E, 0x65, 0xAC, 0x4F, 0x22, 0x99, 0x78, 0x41, 0x93,
-    0xB5, 0x77, 0x45, 0x08, 0xAA, 0x55, 0x42, 0x7D, 0xC5, 0xEF, 0xAE, 0x3D, 0xB8, 0xD9, 0x0E, 0x3D,
-    0x60, 0xDB, 0x31, 0x3D, 0xFE, 0x34, 0xAD, 0xC0, 0x1F, 0x59, 0x5A, 0xC1, 0x03, 0x30, 0x0A, 0x41,
-    0x70, 0x61, 0x69, 0x6E, 0x32, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x69, 0x8C, 0xCC, 0x46, 0x70, 0x83, 0xEE, 0x55, 0x84, 0x75, 0xF0, 0x55, 0x5F, 0x83, 0xCA, 0x77,
-    0x67, 0x76, 0xF9, 0x77, 0x88, 0x61, 0xFC, 0x69, 0x62, 0xA1, 0xCC, 0x15, 0x6B, 0x95, 0xFC, 0x23,
-    0x8C, 0x7F, 0xFF, 0x4C, 0xDB, 0x55, 0x95, 0x27, 0xD8, 0x41, 0x93, 0x7A, 0xD9, 0x4A, 0x9C, 0x0E,
-    0xDA, 0x4C, 0x8B, 0x59, 0xF6, 0x2E, 0x96, 0x62, 0xF7, 0x37, 0x9F, 0x87, 0xF8, 0x42, 0x97, 0x2F,
-    0xF8, 0x39, 0x8E, 0x4A, 0xCB, 0x66, 0xBC, 0x27, 0xC6, 0x3C, 0xB8, 0x7A, 0xC7, 0x45, 0xC8, 0x84,
-    0xC9, 0x5A, 0xCA, 0x09, 0xCA, 0x5D, 0xAC, 0x56, 0xC8, 0x48, 0xAA, 0x5D, 0xE8, 0x26, 0xBB, 0x69,
-    0xE8, 0x2E, 0xCB, 0x8A, 0xEB, 0x43, 0xCD, 0x0C, 0xEC, 0x50, 0xBF, 0x35, 0xEC, 0x47, 0xAF, 0x49,
-    0xEA, 0x32, 0xAD, 0x66, 0x52, 0x8E, 0x4C, 0x58, 0xE5, 0x00, 0x7D, 0x6B, 0x4E, 0x80, 0xC2, 0x78,
-    0xC4, 0x27, 0xCC, 0x6C, 0x58, 0xC6, 0x51, 0x1C, 0xF3, 0x83, 0x88, 0x2F, 0x54, 0xB9, 0xC7, 0x06,
-    0xCD, 0x74, 0xD3, 0x2F, 0xE6, 0x23, 0x5A, 0x5E, 0xEE, 0x6E, 0x60, 0x4A, 0xF4, 0x05, 0x74, 0x65,
-    0xFF, 0x6F, 0x7E, 0x35, 0x3F, 0x96, 0xA9, 0x77, 0x42, 0xA0, 0x59, 0x58, 0x46, 0xC7, 0x5C, 0x1C,
-    0x43, 0xBE, 0xAD, 0x21, 0x00, 0xB2, 0xA6, 0x76, 0x07, 0xDF, 0x3D, 0x95, 0x07, 0xF2, 0xAC, 0x22,
-    0xC9, 0x38, 0xE4, 0x8C, 0x50, 0x9A, 0xD9, 0x02, 0xCD, 0x5B, 0xE7, 0x0D, 0x41, 0xA8, 0xBC, 0x00,
-    0x03, 0xD0, 0xBA, 0x01, 0x27, 0xC7, 0x56, 0x54, 0xC4, 0x96, 0x5D, 0x28, 0xBA, 0x33, 0x54, 0x5E,
-    0xBC, 0x9B, 0x5D, 0x1F, 0xB2, 0x38, 0x54, 0x72, 0xAC, 0x53, 0x1B, 0x76, 0xBC, 0x96, 0x1C, 0x3E,
-    0xB4, 0x9A, 0x22, 0x17, 0xB4, 0x4F, 0x16, 0x5C, 0xB0, 0x98, 0x0E, 0x49, 0xAA, 0x5E, 0x08, 0x5D,
-    0x78, 0x7D, 0x67, 0x79, 0x83, 0xA5, 0x08, 0x1D, 0x7C, 0xA0, 0x6B, 0x1B, 0x80, 0x8A, 0x05, 0x75,
-    0xA9, 0xFF, 0x96, 0x4F, 0xBA, 0xF2, 0xA3, 0x2A, 0x9F, 0xA0, 0x8D, 0x95, 0xB0, 0x93, 0x9B, 0x37,
-    0xA8, 0xFC, 0xAD, 0x11, 0x9E, 0x9D, 0xA5, 0x0F, 0x4B, 0xA0, 0x00, 0x9F, 0x6A, 0xA6, 0x05, 0x40,
-    0x56, 0x98, 0x58, 0x92, 0x74, 0x94, 0x5C, 0x37, 0x51, 0xD2, 0x04, 0x1F, 0x59, 0xB5, 0x5B, 0x16,
-    0x8A, 0x8D, 0x28, 0x8D, 0xA3, 0x9B, 0x1F, 0x08, 0x9D, 0x66, 0x1A, 0x79, 0x7A, 0xF6, 0xAC, 0x3D,
-    0xF1, 0x89, 0xE5, 0x3C, 0x59, 0xAC, 0x3D, 0x3D, 0xD0, 0xD3, 0x12, 0xC0, 0x13, 0x83, 0x1D, 0xC1,
-    0xC7, 0x9D, 0x81, 0x40, 0x70, 0x61, 0x69, 0x6E, 0x32, 0x30, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x79, 0x3B, 0xD4, 0x41, 0x86, 0x31, 0xEE, 0x56, 0x9B, 0x31, 0xE4, 0x56,
-    0x70, 0x28, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A, 0xA2, 0x1A, 0xEA, 0x62, 0x71, 0x4F, 0xDB, 0x11,
-    0x81, 0x41, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68,
-    0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B,
-    0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x27, 0x8B, 0x68,
-    0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x39, 0x7E, 0x58,
-    0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29,
-    0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70,
-    0x5F, 0x19, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1A, 0xF1, 0xA7, 0x52, 0x25,
-    0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2E, 0x4F,
-    0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x44, 0x83, 0xA0,
-    0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5D, 0xD1, 0x06, 0x0D, 0x1B, 0xEB, 0x78, 0x00, 0x64, 0x90, 0x94,
-    0x0F, 0x6D, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38, 0x63, 0x37, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31,
-    0x4E, 0x3F, 0xDD, 0x84, 0x10, 0x3F, 0xFF, 0x05, 0x23, 0x5D, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26,
-    0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78,
-    0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9C, 0x09, 0x1C,
-    0x9C, 0x51, 0x00, 0x58, 0x79, 0x43, 0x71, 0x6C, 0x71, 0x88, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14,
-    0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E, 0xB5, 0xFB, 0x94, 0x2C, 0xA0, 0x86, 0x84, 0x94,
-    0xB3, 0x83, 0x86, 0x3F, 0xA5, 0xF8, 0xA7, 0x01, 0xA3, 0x7F, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71,
-    0x59, 0x76, 0x25, 0x56, 0x54, 0x4A, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B,
-    0x55, 0x6E, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A,
-    0x4E, 0xED, 0xA1, 0x3D, 0xC0, 0x6D, 0x5E, 0x3D, 0xF6, 0x72, 0x2A, 0x3D, 0x3D, 0xB3, 0x67, 0xC1,
-    0x82, 0x62, 0xB8, 0xC1, 0x8D, 0x0A, 0x1C, 0x41, 0x70, 0x61, 0x69, 0x6E, 0x33, 0x30, 0x31, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x82, 0xCD, 0x44, 0x69, 0x73, 0xEE, 0x4A,
-    0x7C, 0x60, 0xED, 0x40, 0x59, 0x82, 0xC8, 0x96, 0x5E, 0x6E, 0xF5, 0x75, 0x7D, 0x50, 0xF5, 0x67,
-    0x60, 0x92, 0xD2, 0x18, 0x65, 0x7D, 0xFF, 0x0A, 0x84, 0x60, 0xFF, 0x3D, 0xD5, 0x35, 0x8D, 0x2C,
-    0xD0, 0x2B, 0x87, 0x77, 0xD2, 0x2E, 0x92, 0x05, 0xD3, 0x32, 0x82, 0x54, 0xEC, 0x10, 0x86, 0x61,
-    0xED, 0x13, 0x92, 0x82, 0xF1, 0x1A, 0x8D, 0x3C, 0xEF, 0x17, 0x81, 0x41, 0xC5, 0x3F, 0xB8, 0x25,
-    0xBB, 0x29, 0xAA, 0x72, 0xBC, 0x2B, 0xBD, 0x81, 0xC1, 0x36, 0xC3, 0x0E, 0xC4, 0x3D, 0xA6, 0x48,
-    0xBF, 0x32, 0x9F, 0x59, 0xDA, 0x0B, 0xAA, 0x61, 0xDB, 0x0D, 0xBC, 0x6B, 0xE0, 0x18, 0xC3, 0x86,
-    0xE4, 0x21, 0xB7, 0x39, 0xE3, 0x1F, 0xA5, 0x4C, 0xDE, 0x14, 0x9E, 0x5F, 0x55, 0xA8, 0x4C, 0x57,
-    0xD6, 0x02, 0x62, 0x73, 0x48, 0x8B, 0xBF, 0x74, 0xB5, 0x1A, 0xBA, 0x7A, 0x62, 0xC5, 0x5E, 0x27,
-    0xF5, 0x47, 0x8C, 0x30, 0x55, 0xA8, 0xD1, 0x08, 0xC7, 0x42, 0xD2, 0x30, 0xDD, 0x1D, 0x47, 0x60,
-    0xEF, 0x44, 0x5F, 0x4B, 0xE6, 0x00, 0x5C, 0x66, 0xFF, 0x37, 0x7D, 0x3A, 0x3D, 0xA4, 0xAB, 0x75,
-    0x46, 0xB8, 0x5C, 0x57, 0x4F, 0xCC, 0x68, 0x26, 0x46, 0xB8, 0xB7, 0x08, 0x00, 0xD4, 0xAB, 0x74,
-    0x13, 0xFF, 0x4C, 0x9C, 0x0F, 0xF5, 0xC0, 0x21, 0xBB, 0x1D, 0xD6, 0x6E, 0x4C, 0x94, 0xDD, 0x7F,
-    0xC3, 0x2F, 0xE1, 0x85, 0x40, 0xAA, 0xC1, 0x00, 0x06, 0xE1, 0xC6, 0x02, 0x2F, 0xDD, 0x61, 0x56,
-    0xCA, 0x71, 0x63, 0x2B, 0xB2, 0x3D, 0x44, 0x5E, 0xC2, 0x78, 0x63, 0x20, 0xAB, 0x45, 0x44, 0xA1,
-    0xAC, 0x62, 0x11, 0x91, 0xC4, 0x82, 0x21, 0x3F, 0xBC, 0x87, 0x27, 0x08, 0xB3, 0x5D, 0x0B, 0x5D,
-    0xBA, 0x8C, 0x12, 0x4C, 0xAC, 0x6D, 0x00, 0x59, 0x78, 0x86, 0x65, 0x78, 0x8D, 0xAB, 0x0E, 0x20,
-    0x80, 0x98, 0x70, 0x22, 0x87, 0x9D, 0x05, 0x98, 0xB9, 0xB1, 0xB2, 0x47, 0xC8, 0x9F, 0xBD, 0x2E,
-    0xA2, 0x80, 0x94, 0x9C, 0xB1, 0x6D, 0xA0, 0x36, 0xB6, 0xAB, 0xC9, 0x01, 0xA0, 0x7A, 0xAB, 0x0F,
-    0x54, 0xC5, 0x03, 0xA0, 0x74, 0xB8, 0x0A, 0x40, 0x59, 0xAA, 0x5B, 0x8F, 0x77, 0x98, 0x5F, 0x36,
-    0x60, 0xDE, 0x13, 0x20, 0x60, 0xB8, 0x64, 0x17, 0x8F, 0x93, 0x2A, 0x12, 0xAB, 0x91, 0x24, 0x0A,
-    0x9F, 0x75, 0x14, 0x78, 0xC7, 0x1B, 0xAA, 0x3D, 0x64, 0xAE, 0x26, 0x3D, 0xEE, 0x5B, 0x32, 0x3D,
-    0xD8, 0x25, 0x3D, 0xC1, 0x8B, 0xD6, 0x95, 0xC1, 0x7C, 0xBF, 0xFA, 0x40, 0x70, 0x61, 0x69, 0x6E,
-    0x33, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x80, 0xCF, 0x44,
-    0x71, 0x6F, 0xEE, 0x55, 0x85, 0x5E, 0xEB, 0x55, 0x5F, 0x7C, 0xCD, 0x75, 0x68, 0x65, 0xF8, 0x77,
-    0x88, 0x4A, 0xF3, 0x67, 0x64, 0x94, 0xD4, 0x18, 0x6D, 0x7C, 0xFF, 0x2D, 0x8D, 0x61, 0xFA, 0x4C,
-    0xD9, 0x44, 0x80, 0x2C, 0xD6, 0x34, 0x7B, 0x77, 0xD7, 0x39, 0x85, 0x05, 0xD7, 0x3F, 0x76, 0x54,
-    0xF3, 0x1C, 0x76, 0x61, 0xF4, 0x21, 0x81, 0x88, 0xF6, 0x2B, 0x7B, 0x30, 0xF5, 0x26, 0x71, 0x4B,
-    0xCB, 0x4C, 0xAB, 0x24, 0xC4, 0x2B, 0xA1, 0x73, 0xC5, 0x2F, 0xB2, 0x81, 0xC9, 0x3F, 0xB7, 0x0E,
-    0xC9, 0x49, 0x9A, 0x48, 0xC6, 0x39, 0x95, 0x59, 0xE5, 0x10, 0x9C, 0x61, 0xE6, 0x13, 0xAD, 0x6C,
-    0xEA, 0x24, 0xB2, 0x85, 0xEC, 0x31, 0xA6, 0x35, 0xEA, 0x2D, 0x95, 0x4C, 0xE7, 0x1D, 0x90, 0x5F,
-    0x50, 0xA6, 0x56, 0x57, 0xDE, 0x00, 0x59, 0x68, 0x4D, 0x80, 0xC7, 0x76, 0xC1, 0x16, 0xB2, 0x6B,
-    0x59, 0xD2, 0x64, 0x1E, 0xF4, 0x67, 0x79, 0x2F, 0x57, 0xAC, 0xD5, 0x08, 0xCE, 0x52, 0xC4, 0x2F,
-    0xE0, 0x25, 0x3D, 0x60, 0xED, 0x5F, 0x4F, 0x48, 0xED, 0x03, 0x4F, 0x66, 0xFF, 0x56, 0x69, 0x35,
-    0x3F, 0x9C, 0xB5, 0x77, 0x41, 0xB6, 0x68, 0x57, 0x47, 0xD4, 0x72, 0x1C, 0x45, 0xBB, 0xBF, 0x08,
-    0x00, 0xC3, 0xC0, 0x76, 0x08, 0xFF, 0x61, 0x9C, 0x0B, 0xF6, 0xCF, 0x17, 0xC7, 0x1E, 0xCB, 0x6E,
-    0x52, 0x90, 0xE2, 0x84, 0xCD, 0x38, 0xD3, 0x0B, 0x42, 0xA6, 0xCA, 0x7F, 0x05, 0xD7, 0xD8, 0x02,
-    0x27, 0xDE, 0x71, 0x53, 0xC5, 0x8C, 0x59, 0x28, 0xB4, 0x3E, 0x41, 0x5E, 0xBD, 0x93, 0x5A, 0x20,
-    0xAC, 0x45, 0x42, 0xA1, 0xA7, 0x6A, 0x10, 0x74, 0xBA, 0x9D, 0x1A, 0x3E, 0xB3, 0xA1, 0x22, 0x06,
-    0xAE, 0x65, 0x09, 0x5D, 0xAE, 0xA5, 0x0E, 0x49, 0xA5, 0x77, 0x00, 0x59, 0x76, 0x88, 0x69, 0x79,
-    0x81, 0xBD, 0x11, 0x1F, 0x7C, 0xA3, 0x71, 0x22, 0x7D, 0xA8, 0x0B, 0x96, 0xB0, 0xDD, 0xA5, 0x47,
-    0xC1, 0xCB, 0xAE, 0x2E, 0xA0, 0x92, 0x8E, 0x93, 0xB1, 0x81, 0x97, 0x37, 0xB0, 0xD5, 0xBC, 0x01,
-    0xA0, 0x8B, 0xA5, 0x00, 0x48, 0xC8, 0x11, 0x9F, 0x68, 0xC5, 0x12, 0x40, 0x54, 0xAB, 0x64, 0x92,
-    0x72, 0x9F, 0x63, 0x45, 0x50, 0xEF, 0x1D, 0x22, 0x59, 0xC1, 0x6B, 0x17, 0x87, 0xA0, 0x2C, 0x13,
-    0xA1, 0xA7, 0x22, 0x0A, 0x99, 0x7E, 0x15, 0x78, 0x3B, 0x40, 0xAC, 0x3D, 0x9A, 0x7F, 0x03, 0x3D,
-    0x8C, 0xE0, 0x38, 0x3D, 0x5F, 0xB2, 0x0E, 0xC1, 0x87, 0x8A, 0x65, 0xC1, 0x81, 0xCA, 0xBD, 0x40,
-    0x70, 0x61, 0x69, 0x6E, 0x33, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x6B, 0xD2, 0x43, 0x7A, 0x5B, 0xEE, 0x56, 0x8F, 0x50, 0xE8, 0x56, 0x66, 0x60, 0xD2, 0x77,
-    0x73, 0x4A, 0xF9, 0x77, 0x95, 0x38, 0xEF, 0x61, 0x69, 0x80, 0xD7, 0x11, 0x76, 0x6A, 0xFF, 0x2D,
-    0x98, 0x59, 0xF4, 0x49, 0xDD, 0x54, 0x72, 0x27, 0xDB, 0x3E, 0x6E, 0x7A, 0xDD, 0x46, 0x78, 0x0C,
-    0xDC, 0x4C, 0x69, 0x52, 0xFA, 0x2F, 0x65, 0x63, 0xFB, 0x36, 0x6E, 0x8A, 0xFC, 0x44, 0x69, 0x2E,
-    0xFA, 0x3C, 0x5F, 0x48, 0xD1, 0x5A, 0x9E, 0x24, 0xCD, 0x2D, 0x96, 0x73, 0xCF, 0x32, 0xA6, 0x89,
-    0xD1, 0x49, 0xAA, 0x0A, 0xCF, 0x54, 0x8E, 0x4F, 0xCD, 0x3D, 0x8A, 0x58, 0xEF, 0x1B, 0x8C, 0x62,
-    0xF1, 0x21, 0x9C, 0x6E, 0xF3, 0x37, 0x9F, 0x0B, 0xF3, 0x48, 0x93, 0x33, 0xF1, 0x42, 0x83, 0x49,
-    0xEF, 0x2B, 0x7F, 0x5F, 0x4E, 0x85, 0x62, 0x58, 0xE7, 0x00, 0x4D, 0x6D, 0x54, 0x5C, 0xCF, 0x78,
-    0xCD, 0x12, 0xA7, 0x6D, 0x53, 0xC2, 0x6C, 0x1E, 0xF4, 0x8C, 0x65, 0x2F, 0x5A, 0x98, 0xDA, 0x07,
-    0xD5, 0x64, 0xB5, 0x2F, 0xE4, 0x2D, 0x31, 0x60, 0xEB, 0x7D, 0x3F, 0x48, 0xF5, 0x0B, 0x41, 0x66,
-    0xFF, 0x7C, 0x54, 0x35, 0x43, 0x76, 0xC0, 0x77, 0x3E, 0x93, 0x75, 0xA0, 0x42, 0xBC, 0x7D, 0x1D,
-    0x47, 0xA0, 0xC7, 0x06, 0x03, 0x88, 0xD5, 0x76, 0x00, 0xD0, 0x77, 0x94, 0x09, 0xCD, 0xE1, 0x17,
-    0xD4, 0x20, 0xBE, 0x6F, 0x58, 0x73, 0xE8, 0x84, 0xD7, 0x44, 0xC4, 0x31, 0x46, 0x85, 0xD3, 0x7F,
-    0x07, 0xA4, 0xEB, 0x02, 0x22, 0xB7, 0x82, 0x53, 0xC1, 0xA1, 0x4F, 0x26, 0xB7, 0x37, 0x3C, 0x60,
-    0xB9, 0xA5, 0x51, 0x1F, 0xAF, 0x3B, 0x3F, 0x72, 0xA4, 0x63, 0x10, 0x76, 0xB2, 0xAD, 0x15, 0x4C,
-    0xAB, 0xAF, 0x1D, 0x06, 0xAB, 0x61, 0x08, 0x5E, 0xA5, 0xB1, 0x0B, 0x26, 0xA0, 0x72, 0x00, 0x58,
-    0x76, 0x75, 0x6D, 0x6B, 0x77, 0xB7, 0x16, 0x1F, 0x7A, 0x9A, 0x73, 0x16, 0x75, 0x9A, 0x11, 0x75,
-    0xA9, 0xFF, 0x9A, 0x4D, 0xBB, 0xF2, 0xA0, 0x2A, 0xA0, 0x9A, 0x89, 0x94, 0xB2, 0x8C, 0x8E, 0x46,
-    0xAA, 0xF7, 0xB0, 0x01, 0xA1, 0x91, 0x9F, 0x00, 0x3F, 0xA8, 0x20, 0x9F, 0x5E, 0xB4, 0x1B, 0x4A,
-    0x52, 0x8E, 0x6E, 0x7B, 0x70, 0x8F, 0x67, 0x46, 0x44, 0xDD, 0x29, 0x22, 0x55, 0xAD, 0x73, 0x18,
-    0x82, 0x98, 0x2F, 0x8E, 0x9A, 0xAD, 0x20, 0x2D, 0x94, 0x75, 0x16, 0x79, 0x7B, 0xF6, 0xAC, 0x3D,
-    0xEE, 0x89, 0xE5, 0x3C, 0x61, 0xAC, 0x3D, 0x3D, 0x1A, 0x0B, 0xC4, 0xC0, 0x13, 0x83, 0x1D, 0xC1,
-    0xC7, 0x9D, 0x81, 0x40, 0x70, 0x61, 0x69, 0x6E, 0x33, 0x30, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x79, 0x3B, 0xD4, 0x41, 0x86, 0x31, 0xEE, 0x56, 0x9B, 0x31, 0xE4, 0x56,
-    0x70, 0x28, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A, 0xA2, 0x1A, 0xEA, 0x62, 0x71, 0x4F, 0xDB, 0x11,
-    0x81, 0x41, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68,
-    0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B,
-    0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x27, 0x8B, 0x68,
-    0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x39, 0x7E, 0x58,
-    0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29,
-    0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70,
-    0x5F, 0x19, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1A, 0xF1, 0xA7, 0x52, 0x25,
-    0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2E, 0x4F,
-    0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x44, 0x83, 0xA0,
-    0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5D, 0xD1, 0x06, 0x0D, 0x1B, 0xEB, 0x78, 0x00, 0x64, 0x90, 0x94,
-    0x0F, 0x6D, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38, 0x63, 0x37, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31,
-    0x4E, 0x3F, 0xDD, 0x84, 0x10, 0x3F, 0xFF, 0x05, 0x23, 0x5D, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26,
-    0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78,
-    0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9C, 0x09, 0x1C,
-    0x9C, 0x51, 0x00, 0x58, 0x79, 0x43, 0x71, 0x6C, 0x71, 0x88, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14,
-    0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E, 0xB5, 0xFB, 0x94, 0x2C, 0xA0, 0x86, 0x84, 0x94,
-    0xB3, 0x83, 0x86, 0x3F, 0xA5, 0xF8, 0xA7, 0x01, 0xA3, 0x7F, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71,
-    0x59, 0x76, 0x25, 0x56, 0x54, 0x4A, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B,
-    0x55, 0x6E, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A,
-    0xD4, 0xA4, 0xAE, 0x3D, 0xEF, 0x89, 0xE5, 0x3C, 0x9E, 0x07, 0x33, 0x3D, 0xB5, 0xDF, 0xF6, 0x40,
-    0x12, 0x83, 0x1D, 0xC1, 0x64, 0xAC, 0x5A, 0x41, 0x6A, 0x75, 0x6D, 0x70, 0x30, 0x31, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x3B, 0xCB, 0x3F, 0x71, 0x31, 0xED, 0x4A,
-    0x87, 0x31, 0xEF, 0x4A, 0x61, 0x28, 0xC7, 0x77, 0x6A, 0x1A, 0xF6, 0x7A, 0x8C, 0x1A, 0xFA, 0x70,
-    0x61, 0x4F, 0xCC, 0x13, 0x6A, 0x41, 0xFB, 0x06, 0x8C, 0x40, 0xFF, 0x28, 0xDE, 0x5B, 0x99, 0x20,
-    0xDE, 0x42, 0x96, 0x68, 0xDE, 0x4C, 0x9F, 0x05, 0xDE, 0x51, 0x8F, 0x54, 0xFD, 0x41, 0x99, 0x65,
-    0xFD, 0x4B, 0xA3, 0x87, 0xFD, 0x5A, 0x9D, 0x2F, 0xFD, 0x50, 0x93, 0x48, 0xCD, 0x5D, 0xC0, 0x20,
-    0xCD, 0x27, 0xB9, 0x68, 0xCC, 0x30, 0xC9, 0x89, 0xCC, 0x4B, 0xCD, 0x09, 0xCD, 0x54, 0xAF, 0x4F,
-    0xCD, 0x39, 0xAC, 0x5D, 0xF0, 0x27, 0xBD, 0x64, 0xEF, 0x30, 0xCE, 0x8C, 0xEF, 0x4B, 0xD1, 0x0C,
-    0xEF, 0x5D, 0xC4, 0x2E, 0xF0, 0x54, 0xB3, 0x49, 0xF0, 0x39, 0xB0, 0x42, 0x55, 0x3D, 0x4B, 0x5D,
-    0xF1, 0x00, 0x7C, 0x6D, 0x51, 0x19, 0xBE, 0x7A, 0xCD, 0x0B, 0xCB, 0x6E, 0x55, 0x84, 0x54, 0x1D,
-    0xF1, 0xA7, 0x91, 0x25, 0x51, 0x61, 0xC7, 0x18, 0xCD, 0x6C, 0xD8, 0x2D, 0xEF, 0x2F, 0x5C, 0x60,
-    0xEE, 0x8E, 0x68, 0x48, 0xFF, 0x13, 0x75, 0x44, 0xFF, 0x9A, 0x86, 0x30, 0x41, 0x2C, 0xA6, 0x7A,
-    0x43, 0x44, 0x57, 0x58, 0x43, 0x75, 0x5D, 0x1D, 0x41, 0x5D, 0xAC, 0x17, 0x01, 0x1B, 0xA0, 0x77,
-    0x04, 0x64, 0x3C, 0x9B, 0x00, 0x6D, 0xAA, 0x16, 0xD0, 0x20, 0xE4, 0x3A, 0x50, 0x37, 0xD7, 0x84,
-    0xCF, 0x4B, 0xEA, 0x0D, 0x40, 0x3F, 0xB9, 0x7F, 0x00, 0x3F, 0xB5, 0x02, 0x25, 0x5D, 0x55, 0x53,
-    0xC2, 0x9E, 0x65, 0x26, 0xC2, 0x20, 0x55, 0x5E, 0xBA, 0x9E, 0x64, 0x1A, 0xBA, 0x20, 0x54, 0x71,
-    0xB2, 0x43, 0x1D, 0x77, 0xBA, 0x9F, 0x24, 0x4C, 0xB2, 0x9E, 0x29, 0x17, 0xBA, 0x45, 0x18, 0x66,
-    0xAF, 0x9C, 0x14, 0x47, 0xAF, 0x51, 0x0B, 0x5D, 0x7B, 0x43, 0x68, 0x6A, 0x82, 0x88, 0x0C, 0x1A,
-    0x7B, 0x6F, 0x6D, 0x1B, 0x82, 0x66, 0x08, 0x72, 0x9C, 0xFF, 0xA1, 0x4D, 0xAE, 0xFB, 0xAF, 0x25,
-    0x9C, 0x86, 0x92, 0x9B, 0xAE, 0x83, 0xA0, 0x34, 0x9B, 0xF8, 0xB8, 0x0F, 0x9C, 0x7F, 0xA9, 0x7E,
-    0x4D, 0x57, 0x00, 0x71, 0x6A, 0x76, 0x08, 0x4A, 0x57, 0x4A, 0x58, 0x7B, 0x74, 0x5C, 0x5E, 0x34,
-    0x4D, 0x96, 0x08, 0x1B, 0x57, 0x6E, 0x5C, 0x15, 0x8B, 0x6D, 0x2B, 0x8F, 0xA2, 0x92, 0x25, 0x08,
-    0xA2, 0x4F, 0x1D, 0x79, 0xA2, 0x4D, 0x91, 0x3D, 0x95, 0xA4, 0x10, 0x3D, 0x82, 0xFA, 0x7E, 0x3D,
-    0x82, 0xB5, 0x42, 0x41, 0x22, 0xDB, 0xA6, 0xC1, 0x41, 0x90, 0x21, 0x41, 0x6A, 0x75, 0x6D, 0x70,
-    0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x76, 0xAF, 0x5F,
-    0x99, 0x61, 0xBB, 0x53, 0xAC, 0x52, 0xAA, 0x53, 0x7C, 0x6F, 0xB5, 0x78, 0x93, 0x53, 0xC7, 0x78,
-    0xB2, 0x3A, 0xAB, 0x71, 0x83, 0x8B, 0xB7, 0x03, 0x9A, 0x6E, 0xC9, 0x2F, 0xB9, 0x55, 0xAD, 0x49,
-    0xDE, 0x4A, 0x2F, 0x27, 0xD9, 0x38, 0x2D, 0x7A, 0xDE, 0x3D, 0x33, 0x0B, 0xD9, 0x44, 0x2A, 0x50,
-    0xF5, 0x21, 0x15, 0x5C, 0xFA, 0x26, 0x1A, 0x6E, 0xFA, 0x33, 0x16, 0x33, 0xF5, 0x2E, 0x11, 0x4F,
-    0xDD, 0x4E, 0x53, 0x27, 0xD3, 0x28, 0x50, 0x7A, 0xDA, 0x2A, 0x59, 0x88, 0xDF, 0x3E, 0x5B, 0x32,
-    0xD6, 0x4B, 0x4A, 0x4D, 0xD1, 0x38, 0x48, 0xA0, 0xF3, 0x0E, 0x34, 0x5A, 0xFA, 0x11, 0x3D, 0x70,
-    0xFF, 0x24, 0x3F, 0x3A, 0xFD, 0x34, 0x37, 0x3F, 0xF6, 0x32, 0x2E, 0x47, 0xF1, 0x1E, 0x2C, 0x54,
-    0x46, 0xA6, 0x7B, 0x98, 0xD7, 0x00, 0x10, 0x68, 0x68, 0x71, 0xBE, 0x78, 0xD7, 0x0E, 0x5A, 0x6D,
-    0x53, 0xD9, 0x80, 0x1E, 0xF6, 0x77, 0x1A, 0x29, 0x76, 0xA5, 0xC2, 0x2D, 0xE8, 0x53, 0x60, 0x29,
-    0xD0, 0x2D, 0x00, 0x57, 0xE1, 0x71, 0x06, 0x4F, 0xE3, 0x06, 0x00, 0x60, 0xFC, 0x67, 0x08, 0x3F,
-    0x54, 0x90, 0xBF, 0x78, 0x3C, 0xB5, 0x91, 0x98, 0x45, 0xD8, 0x94, 0x1F, 0x5D, 0xB4, 0xC2, 0x2D,
-    0x18, 0xB2, 0xF3, 0x7D, 0x00, 0xFF, 0xB9, 0x13, 0x27, 0xEC, 0xF8, 0x06, 0xE5, 0x15, 0x65, 0x64,
-    0x75, 0x82, 0xCC, 0x86, 0xED, 0x34, 0x68, 0x39, 0x5D, 0x9B, 0xCA, 0x86, 0x24, 0xC8, 0xFF, 0x0C,
-    0x25, 0xDD, 0xAB, 0x9D, 0xBC, 0x9C, 0x2A, 0x26, 0xA5, 0x42, 0x23, 0x59, 0xB4, 0xA2, 0x31, 0x22,
-    0x9D, 0x48, 0x29, 0x75, 0x87, 0x75, 0x12, 0x7D, 0x9D, 0xB3, 0x0D, 0x4B, 0x98, 0xB6, 0x17, 0x2D,
-    0x8C, 0x72, 0x08, 0x58, 0x8D, 0xBB, 0x0F, 0x1C, 0x80, 0x86, 0x0A, 0xA0, 0x73, 0x89, 0x6A, 0x6B,
-    0x60, 0xCE, 0x31, 0x22, 0x7B, 0xA8, 0x6D, 0x17, 0x5A, 0xB6, 0x2F, 0x7B, 0xBE, 0xEF, 0x6A, 0x9E,
-    0xD2, 0xDD, 0x63, 0x2B, 0xA9, 0x99, 0x63, 0x12, 0xBC, 0x87, 0x5C, 0x44, 0xC5, 0xE5, 0x78, 0x0E,
-    0xAF, 0x8F, 0x71, 0x05, 0x27, 0xD2, 0x5A, 0xA1, 0x47, 0xD3, 0x44, 0x53, 0x4F, 0xAB, 0x81, 0x7E,
-    0x6D, 0xA3, 0x6A, 0x42, 0x32, 0xFF, 0x5D, 0x22, 0x55, 0xC5, 0x83, 0x08, 0x70, 0xAC, 0x3B, 0x0F,
-    0x86, 0xB9, 0x23, 0x2F, 0x7A, 0x8A, 0x20, 0x79, 0x0A, 0x7D, 0x93, 0x3D, 0x43, 0x52, 0x04, 0x3D,
-    0xD4, 0x71, 0x83, 0x3D, 0x3B, 0xD7, 0x02, 0x41, 0x8D, 0x91, 0x86, 0xC1, 0xE8, 0xF5, 0x94, 0x40,
-    0x6A, 0x75, 0x6D, 0x70, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x8A, 0x71, 0xAD, 0x40, 0x9C, 0x5D, 0xB9, 0x53, 0xAF, 0x4F, 0xA7, 0x53, 0x7F, 0x67, 0xB4, 0x78,
-    0x97, 0x4B, 0xC4, 0x78, 0xB6, 0x36, 0xA8, 0x5A, 0x84, 0x86, 0xB6, 0x03, 0x9D, 0x6A, 0xC6, 0x2F,
-    0xBC, 0x55, 0xAA, 0x26, 0xDD, 0x51, 0x2E, 0x27, 0xD9, 0x3C, 0x2D, 0x7A, 0xDD, 0x43, 0x32, 0x0B,
-    0xD8, 0x4A, 0x29, 0x50, 0xF4, 0x29, 0x14, 0x5C, 0xF9, 0x2F, 0x19, 0x8C, 0xF8, 0x3D, 0x15, 0x3D,
-    0xF4, 0x37, 0x10, 0x4F, 0xDD, 0x55, 0x51, 0x27, 0xD5, 0x29, 0x4E, 0x7A, 0xDC, 0x2D, 0x57, 0x8A,
-    0xE0, 0x43, 0x59, 0x32, 0xD6, 0x51, 0x48, 0x4E, 0xD2, 0x3B, 0x47, 0xA0, 0xF4, 0x13, 0x32, 0x5A,
-    0xFB, 0x17, 0x3B, 0x70, 0xFF, 0x2D, 0x3C, 0x3C, 0xFC, 0x3E, 0x35, 0x3E, 0xF5, 0x3A, 0x2C, 0x47,
-    0xF1, 0x25, 0x2B, 0x59, 0x46, 0x9B, 0x7E, 0x98, 0xD8, 0x00, 0x10, 0x68, 0x6C, 0x66, 0xBD, 0x78,
-    0xD9, 0x0D, 0x58, 0x6D, 0x51, 0xD5, 0x82, 0x1F, 0xF2, 0x87, 0x19, 0x29, 0x77, 0xA0, 0xC1, 0x2D,
-    0xE8, 0x5C, 0x5D, 0x29, 0xCF, 0x30, 0x01, 0x57, 0xDD, 0x7D, 0x06, 0x4F, 0xE3, 0x09, 0x00, 0x60,
-    0xF8, 0x76, 0x07, 0x3F, 0x57, 0x85, 0xBF, 0x7A, 0x3D, 0xA9, 0x94, 0x98, 0x45, 0xD1, 0x97, 0x1F,
-    0x5E, 0xAD, 0xC2, 0x2D, 0x1C, 0x9E, 0xF4, 0x78, 0x00, 0xF0, 0xBD, 0x13, 0x29, 0xE0, 0xF8, 0x06,
-    0xE7, 0x18, 0x62, 0x64, 0x78, 0x7A, 0xCA, 0x85, 0xEE, 0x3B, 0x64, 0x35, 0x60, 0x91, 0xC9, 0x86,
-    0x28, 0xB8, 0xFF, 0x0C, 0x25, 0xD1, 0xAD, 0x9D, 0xB8, 0xA5, 0x2B, 0x26, 0xA4, 0x3F, 0x24, 0x58,
-    0xB0, 0xAB, 0x32, 0x22, 0x9D, 0x45, 0x2B, 0x75, 0x85, 0x73, 0x15, 0x7D, 0x98, 0xB9, 0x11, 0x48,
-    0x93, 0xBB, 0x1A, 0x2D, 0x8A, 0x70, 0x0C, 0x58, 0x88, 0xC0, 0x12, 0x1C, 0x7D, 0x84, 0x0E, 0xA0,
-    0x73, 0x83, 0x6B, 0x6B, 0x5D, 0xCC, 0x36, 0x22, 0x7A, 0xA6, 0x6E, 0x17, 0x57, 0xB1, 0x34, 0x76,
-    0xB9, 0xFF, 0x6A, 0x9E, 0xCD, 0xEE, 0x62, 0x2B, 0xA7, 0x9E, 0x63, 0x13, 0xBB, 0x8D, 0x5B, 0x44,
-    0xC1, 0xF4, 0x77, 0x0E, 0xAE, 0x93, 0x70, 0x05, 0x25, 0xC6, 0x5F, 0x75, 0x45, 0xCD, 0x49, 0x53,
-    0x4F, 0xA2, 0x83, 0x80, 0x6C, 0x9E, 0x6C, 0x42, 0x2F, 0xF9, 0x62, 0x22, 0x54, 0xBF, 0x85, 0x07,
-    0x6D, 0xAA, 0x3E, 0x0F, 0x82, 0xBD, 0x27, 0x2F, 0x78, 0x87, 0x23, 0x6B, 0xAA, 0xEE, 0x9E, 0x3D,
-    0x76, 0x6D, 0xF9, 0x3C, 0x2A, 0x68, 0x72, 0x3D, 0x48, 0x52, 0xE8, 0x3F, 0x18, 0x70, 0x63, 0xC1,
-    0x07, 0x8E, 0x0F, 0x40, 0x6A, 0x75, 0x6D, 0x70, 0x30, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x87, 0x58, 0xB2, 0x40, 0x98, 0x49, 0xC0, 0x53, 0xAC, 0x42, 0xB0, 0x53,
-    0x7D, 0x49, 0xB8, 0x78, 0x94, 0x35, 0xCC, 0x7A, 0xB3, 0x29, 0xB2, 0x61, 0x80, 0x6C, 0xBB, 0x03,
-    0x97, 0x57, 0xCF, 0x2D, 0xB7, 0x4C, 0xB4, 0x26, 0xDE, 0x56, 0x32, 0x20, 0xDC, 0x3F, 0x30, 0x68,
-    0xE0, 0x47, 0x36, 0x0B, 0xDB, 0x4D, 0x2C, 0x50, 0xF9, 0x35, 0x19, 0x5C, 0xFC, 0x3D, 0x1F, 0x8C,
-    0xFB, 0x4C, 0x1B, 0x29, 0xF7, 0x43, 0x15, 0x4F, 0xDC, 0x59, 0x58, 0x20, 0xD7, 0x29, 0x54, 0x68,
-    0xDD, 0x30, 0x5F, 0x87, 0xDF, 0x48, 0x61, 0x32, 0xD6, 0x53, 0x4E, 0x4E, 0xD4, 0x3B, 0x4C, 0xA0,
-    0xF7, 0x1D, 0x39, 0x5C, 0xFD, 0x24, 0x44, 0x6F, 0xFF, 0x3C, 0x46, 0x3C, 0xFC, 0x4E, 0x3D, 0x3D,
-    0xF7, 0x47, 0x33, 0x47, 0xF4, 0x2F, 0x31, 0x60, 0x4A, 0x6D, 0x77, 0xA0, 0xE2, 0x00, 0x11, 0x69,
-    0x6B, 0x42, 0xC0, 0x79, 0xDC, 0x0D, 0x5F, 0x6D, 0x50, 0xAD, 0x7D, 0x1F, 0xF0, 0x96, 0x1E, 0x2A,
-    0x71, 0x82, 0xC5, 0x08, 0xE4, 0x65, 0x66, 0x2A, 0xD7, 0x2F, 0x00, 0x57, 0xDF, 0x85, 0x07, 0x4F,
-    0xEC, 0x0E, 0x01, 0x60, 0xF8, 0x87, 0x0C, 0x33, 0x56, 0x5A, 0xBF, 0x7A, 0x3F, 0x78, 0x8E, 0x98,
-    0x43, 0xA4, 0x91, 0x1A, 0x5A, 0x87, 0xC3, 0x23, 0x1A, 0x5F, 0xF2, 0x78, 0x00, 0xAB, 0xB3, 0x8D,
-    0x21, 0xA9, 0xF8, 0x17, 0xE8, 0x1D, 0x6C, 0x36, 0x74, 0x5A, 0xCF, 0x86, 0xEB, 0x44, 0x6F, 0x30,
-    0x5C, 0x6A, 0xCB, 0x86, 0x23, 0x7E, 0xFF, 0x0C, 0x25, 0x98, 0xA7, 0x99, 0xB8, 0xA1, 0x2A, 0x1C,
-    0xAD, 0x30, 0x21, 0x59, 0xB0, 0xA4, 0x31, 0x22, 0xA5, 0x32, 0x28, 0x72, 0x8E, 0x5A, 0x0D, 0x78,
-    0x9C, 0xAB, 0x0A, 0x49, 0x96, 0xAC, 0x14, 0x08, 0x94, 0x5A, 0x04, 0x5D, 0x8D, 0xAD, 0x0A, 0x1C,
-    0x86, 0x6A, 0x05, 0xA0, 0x76, 0x64, 0x68, 0x6C, 0x61, 0xAA, 0x2C, 0x1B, 0x7A, 0x8B, 0x6C, 0x16,
-    0x5E, 0x8B, 0x29, 0x76, 0xAF, 0xFF, 0x6E, 0x9E, 0xC3, 0xF5, 0x68, 0x2B, 0xA4, 0x92, 0x65, 0x8D,
-    0xB8, 0x88, 0x5F, 0x43, 0xB5, 0xF6, 0x7D, 0x04, 0xAB, 0x8A, 0x74, 0x84, 0x2C, 0x8F, 0x52, 0x72,
-    0x4A, 0xA1, 0x3D, 0x54, 0x51, 0x77, 0x7D, 0x80, 0x6E, 0x7E, 0x68, 0x42, 0x31, 0xC8, 0x56, 0x16,
-    0x54, 0x98, 0x80, 0x07, 0x72, 0x8B, 0x37, 0x90, 0x86, 0xA7, 0x20, 0x2D, 0x80, 0x6B, 0x1B, 0x6B,
-    0x49, 0x37, 0xA6, 0x3D, 0xF1, 0x89, 0xE5, 0x3C, 0x41, 0xDE, 0x5D, 0x3D, 0x17, 0x9F, 0x45, 0x40,
-    0x13, 0x83, 0x1D, 0xC1, 0x6E, 0x67, 0x2C, 0xBF, 0x6A, 0x75, 0x6D, 0x70, 0x30, 0x35, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x3B, 0xBC, 0x41, 0x93, 0x31, 0xCF, 0x53,
-    0xA7, 0x31, 0xC0, 0x53, 0x7A, 0x28, 0xC1, 0x7A, 0x8F, 0x1A, 0xDA, 0x7A, 0xAF, 0x1A, 0xC3, 0x61,
-    0x7B, 0x4F, 0xC4, 0x11, 0x90, 0x41, 0xDE, 0x2D, 0xB0, 0x40, 0xC7, 0x26, 0xE0, 0x5B, 0x40, 0x20,
-    0xE0, 0x42, 0x3E, 0x68, 0xE2, 0x4C, 0x45, 0x0D, 0xDE, 0x51, 0x39, 0x57, 0xFD, 0x41, 0x28, 0x63,
-    0xFF, 0x4B, 0x2F, 0x8C, 0xFE, 0x5A, 0x2B, 0x2A, 0xFB, 0x50, 0x24, 0x4F, 0xDB, 0x5D, 0x69, 0x20,
-    0xD9, 0x27, 0x64, 0x68, 0xDD, 0x30, 0x70, 0x87, 0xDE, 0x4B, 0x72, 0x0A, 0xD7, 0x54, 0x5D, 0x4E,
-    0xD6, 0x39, 0x5A, 0x58, 0xFA, 0x27, 0x4C, 0x63, 0xFE, 0x30, 0x58, 0x6F, 0xFF, 0x4B, 0x5A, 0x31,
-    0xFC, 0x5D, 0x51, 0x3D, 0xF8, 0x54, 0x45, 0x47, 0xF7, 0x39, 0x42, 0x55, 0x4E, 0x3D, 0x72, 0x9F,
-    0xEA, 0x00, 0x1D, 0x70, 0x69, 0x19, 0xC6, 0x7A, 0xDE, 0x0B, 0x71, 0x70, 0x50, 0x84, 0x79, 0x1A,
-    0xF0, 0xA7, 0x2C, 0x2C, 0x6B, 0x61, 0xCD, 0x07, 0xE1, 0x6C, 0x79, 0x25, 0xE0, 0x2F, 0x08, 0x59,
-    0xE3, 0x8E, 0x11, 0x4F, 0xF5, 0x13, 0x0E, 0x5F, 0xF9, 0x9A, 0x1A, 0x33, 0x54, 0x2C, 0xC2, 0x7A,
-    0x41, 0x44, 0x89, 0xA1, 0x43, 0x75, 0x8D, 0x1A, 0x55, 0x5D, 0xC7, 0x06, 0x17, 0x1B, 0xEF, 0x78,
-    0x00, 0x64, 0xA6, 0x8F, 0x1A, 0x6D, 0xF7, 0x18, 0xE7, 0x20, 0x80, 0x37, 0x6F, 0x37, 0xD9, 0x86,
-    0xE8, 0x4B, 0x84, 0x30, 0x58, 0x3F, 0xD0, 0x86, 0x1C, 0x3F, 0xFF, 0x05, 0x25, 0x5D, 0x9F, 0x51,
-    0xB9, 0x9E, 0x31, 0x1C, 0xB5, 0x20, 0x25, 0x5D, 0xB1, 0x9E, 0x36, 0x1B, 0xAD, 0x20, 0x2B, 0x72,
-    0x98, 0x43, 0x0B, 0x78, 0xA1, 0x9F, 0x09, 0x49, 0x9B, 0x9E, 0x13, 0x06, 0x9E, 0x45, 0x01, 0x5D,
-    0x92, 0x9C, 0x07, 0x4D, 0x90, 0x51, 0x00, 0x58, 0x79, 0x43, 0x69, 0x6C, 0x67, 0x88, 0x24, 0x1B,
-    0x7A, 0x6F, 0x6D, 0x16, 0x66, 0x66, 0x21, 0x77, 0xA6, 0xFF, 0x78, 0x9E, 0xBA, 0xFB, 0x75, 0x2C,
-    0xA2, 0x86, 0x6E, 0x8F, 0xB6, 0x83, 0x6A, 0x43, 0xAC, 0xF8, 0x89, 0x04, 0xA8, 0x7F, 0x7E, 0x84,
-    0x33, 0x57, 0x44, 0x72, 0x50, 0x76, 0x33, 0x56, 0x54, 0x4A, 0x7A, 0x7D, 0x70, 0x5C, 0x68, 0x43,
-    0x35, 0x96, 0x4A, 0x16, 0x55, 0x6E, 0x7D, 0x18, 0x77, 0x6D, 0x33, 0x90, 0x8B, 0x92, 0x1D, 0x2D,
-    0x88, 0x4F, 0x17, 0x6B, 0x78, 0xF6, 0xAC, 0x3D, 0xF1, 0x89, 0xE5, 0x3C, 0x5B, 0xAC, 0x3D, 0x3D,
-    0xD0, 0xD3, 0x12, 0xC0, 0x13, 0x83, 0x1D, 0xC1, 0xC3, 0x9D, 0x81, 0x40, 0x6A, 0x75, 0x6D, 0x70,
-    0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3B, 0xD4, 0x41,
-    0x86, 0x31, 0xEE, 0x56, 0x9B, 0x31, 0xE4, 0x56, 0x70, 0x28, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A,
-    0xA2, 0x1A, 0xEA, 0x62, 0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26,
-    0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52,
-    0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48,
-    0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A,
-    0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C,
-    0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F,
-    0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x19, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E,
-    0x51, 0x84, 0x76, 0x1A, 0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25,
-    0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E,
-    0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x44, 0x83, 0xA0, 0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5D, 0xD1, 0x06,
-    0x0D, 0x1B, 0xEB, 0x78, 0x00, 0x64, 0x90, 0x94, 0x0F, 0x6D, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38,
-    0x63, 0x37, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x3F, 0xDD, 0x84, 0x10, 0x3F, 0xFF, 0x05,
-    0x23, 0x5D, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B,
-    0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07,
-    0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58, 0x79, 0x43, 0x71, 0x6C,
-    0x71, 0x88, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E,
-    0xB5, 0xFB, 0x94, 0x2C, 0xA0, 0x86, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x3F, 0xA5, 0xF8, 0xA7, 0x01,
-    0xA3, 0x7F, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56, 0x54, 0x4A, 0x78, 0x7D,
-    0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6E, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E,
-    0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A, 0xD2, 0x8C, 0xAD, 0x3D, 0xCA, 0x3C, 0xEF, 0x3C,
-    0x3D, 0xBD, 0x4E, 0x3D, 0xD2, 0xA8, 0xCA, 0xC0, 0xBA, 0x3B, 0x24, 0xC1, 0x1E, 0x97, 0x82, 0xC0,
-    0x66, 0x6C, 0x69, 0x70, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x4A, 0xB6, 0x34, 0x65, 0x40, 0xD6, 0x41, 0x7A, 0x3D, 0xE2, 0x41, 0x5B, 0x39, 0xAF, 0x77,
-    0x5D, 0x2A, 0xDA, 0x73, 0x7E, 0x26, 0xEE, 0x70, 0x5B, 0x5D, 0xB3, 0x13, 0x5D, 0x4F, 0xDE, 0x07,
-    0x7D, 0x4B, 0xF2, 0x28, 0xDB, 0x5A, 0xC3, 0x20, 0xDB, 0x41, 0xC0, 0x68, 0xDA, 0x4B, 0xC8, 0x02,
-    0xDD, 0x50, 0xBB, 0x55, 0xF8, 0x3D, 0xD1, 0x64, 0xF7, 0x47, 0xD9, 0x89, 0xF8, 0x56, 0xD4, 0x2D,
-    0xFA, 0x4C, 0xCC, 0x4B, 0xC5, 0x5E, 0xDB, 0x20, 0xC5, 0x2B, 0xD5, 0x68, 0xC2, 0x34, 0xE3, 0x81,
-    0xC2, 0x4D, 0xE5, 0x03, 0xC7, 0x56, 0xCD, 0x48, 0xC8, 0x3C, 0xCA, 0x5E, 0xE6, 0x26, 0xE9, 0x70,
-    0xE4, 0x2F, 0xF6, 0x8A, 0xE3, 0x49, 0xF9, 0x05, 0xE6, 0x5A, 0xEE, 0x2F, 0xE9, 0x51, 0xE1, 0x28,
-    0xE9, 0x37, 0xDE, 0x44, 0x61, 0x4C, 0x42, 0x5D, 0xF0, 0x00, 0xB4, 0x6D, 0x4D, 0x2C, 0xA0, 0x7A,
-    0xC2, 0x10, 0xE5, 0x6C, 0x61, 0x91, 0x49, 0x1C, 0xEF, 0xA0, 0xC5, 0x2D, 0x4C, 0x71, 0xA8, 0x18,
-    0xC2, 0x6D, 0xEF, 0x2D, 0xF3, 0x2D, 0x98, 0x5F, 0xF3, 0x88, 0xA2, 0x4B, 0xFF, 0x11, 0xB4, 0x46,
-    0xFE, 0x92, 0xC2, 0x32, 0x40, 0x3F, 0x84, 0x73, 0x4E, 0x56, 0x44, 0x5D, 0x4E, 0x85, 0x49, 0x1C,
-    0x40, 0x6F, 0x8A, 0x17, 0x03, 0x37, 0x62, 0x77, 0x16, 0x7C, 0x10, 0x99, 0x03, 0x86, 0x6A, 0x1B,
-    0xC2, 0x24, 0xFA, 0x8B, 0x49, 0x49, 0xB5, 0x7F, 0xC1, 0x4E, 0xFF, 0x0E, 0x3D, 0x53, 0x94, 0x7E,
-    0x00, 0x5A, 0x74, 0x0F, 0x31, 0x72, 0x35, 0x56, 0xC8, 0x9D, 0x8A, 0x28, 0xC9, 0x24, 0x7D, 0x66,
-    0xC0, 0x9E, 0x86, 0x1D, 0xC1, 0x25, 0x78, 0x71, 0xC2, 0x47, 0x47, 0x75, 0xCA, 0x9E, 0x50, 0x2B,
-    0xC1, 0x9E, 0x51, 0x16, 0xCA, 0x48, 0x47, 0x65, 0xC1, 0x9C, 0x3F, 0x49, 0xC2, 0x54, 0x37, 0x5E,
-    0x82, 0x4F, 0x6C, 0x79, 0x97, 0x8E, 0x23, 0x1D, 0x82, 0x78, 0x70, 0x19, 0x97, 0x6E, 0x1F, 0x72,
-    0x9C, 0xFF, 0xAB, 0x47, 0xAB, 0xF9, 0xBF, 0x25, 0x9D, 0x8B, 0x9F, 0x99, 0xAC, 0x86, 0xB2, 0x39,
-    0x98, 0xF9, 0xBE, 0x10, 0x99, 0x85, 0xB1, 0x90, 0x64, 0x66, 0x00, 0x5A, 0x80, 0x80, 0x14, 0x41,
-    0x62, 0x59, 0x4E, 0x74, 0x7D, 0x67, 0x60, 0x39, 0x64, 0xA2, 0x07, 0x1A, 0x61, 0x7C, 0x52, 0x14,
-    0x9A, 0x74, 0x41, 0x94, 0xB2, 0x95, 0x46, 0x07, 0xB2, 0x54, 0x3F, 0x79, 0x2B, 0x9C, 0xAF, 0x3D,
-    0xF6, 0x89, 0xE5, 0x3C, 0xFD, 0x66, 0x44, 0x3D, 0xD5, 0xCE, 0x7F, 0xC0, 0x17, 0x83, 0x1D, 0xC1,
-    0x0A, 0x03, 0x99, 0xBF, 0x66, 0x6C, 0x69, 0x70, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x65, 0x3B, 0xC0, 0x3F, 0x69, 0x31, 0xE0, 0x4A, 0x7D, 0x31, 0xEA, 0x4A,
-    0x5D, 0x28, 0xB9, 0x73, 0x61, 0x1A, 0xE6, 0x73, 0x82, 0x1A, 0xF6, 0x70, 0x5C, 0x4F, 0xBD, 0x13,
-    0x60, 0x41, 0xEA, 0x07, 0x81, 0x40, 0xFA, 0x28, 0xDB, 0x5B, 0xBC, 0x20, 0xDC, 0x42, 0xB9, 0x68,
-    0xDA, 0x4C, 0xC2, 0x04, 0xDD, 0x51, 0xB4, 0x55, 0xF9, 0x41, 0xC8, 0x64, 0xF8, 0x4B, 0xD0, 0x87,
-    0xF9, 0x5A, 0xCA, 0x2F, 0xFA, 0x50, 0xC2, 0x4B, 0xC6, 0x5D, 0xD8, 0x20, 0xC7, 0x27, 0xD3, 0x68,
-    0xC5, 0x30, 0xE1, 0x81, 0xC4, 0x4B, 0xE4, 0x03, 0xC8, 0x54, 0xCA, 0x48, 0xC9, 0x39, 0xC7, 0x5E,
-    0xE9, 0x27, 0xE3, 0x64, 0xE6, 0x30, 0xF1, 0x8A, 0xE6, 0x4B, 0xF4, 0x05, 0xE8, 0x5D, 0xE9, 0x2F,
-    0xEA, 0x54, 0xDA, 0x49, 0xEA, 0x39, 0xD7, 0x42, 0x5E, 0x3D, 0x45, 0x5D, 0xF1, 0x00, 0xA9, 0x6D,
-    0x4E, 0x19, 0xAB, 0x7A, 0xC5, 0x0B, 0xE3, 0x6C, 0x5C, 0x84, 0x4D, 0x1D, 0xEE, 0xA7, 0xBC, 0x23,
-    0x4D, 0x61, 0xB3, 0x18, 0xC4, 0x6C, 0xEE, 0x2D, 0xF2, 0x2F, 0x8C, 0x5F, 0xF0, 0x8E, 0x96, 0x4B,
-    0xFF, 0x13, 0xA8, 0x46, 0xFD, 0x9A, 0xB7, 0x32, 0x41, 0x2C, 0x90, 0x73, 0x4B, 0x44, 0x4A, 0x5D,
-    0x4A, 0x75, 0x50, 0x4D, 0x40, 0x5D, 0x95, 0x17, 0x03, 0x1B, 0x74, 0x77, 0x10, 0x64, 0x1C, 0x99,
-    0x02, 0x6D, 0x7D, 0x14, 0xC6, 0x20, 0xFA, 0x8B, 0x4B, 0x37, 0xC2, 0x7F, 0xC5, 0x4B, 0xFF, 0x0E,
-    0x3E, 0x3F, 0xA1, 0x7E, 0x00, 0x3F, 0x87, 0x00, 0x2D, 0x5D, 0x3E, 0x56, 0xC5, 0x9E, 0x84, 0x26,
-    0xC7, 0x20, 0x75, 0x66, 0xBD, 0x9E, 0x80, 0x1A, 0xBF, 0x20, 0x72, 0x71, 0xBD, 0x43, 0x3E, 0x77,
-    0xC4, 0x9F, 0x47, 0x2B, 0xBC, 0x9E, 0x48, 0x16, 0xC6, 0x45, 0x3D, 0x66, 0xBB, 0x9C, 0x35, 0x26,
-    0xBC, 0x51, 0x2D, 0x5E, 0x80, 0x43, 0x6D, 0x6A, 0x90, 0x88, 0x1E, 0x1A, 0x7F, 0x6F, 0x72, 0x19,
-    0x90, 0x66, 0x1A, 0x72, 0x9A, 0xFF, 0xAC, 0x4F, 0xAA, 0xFB, 0xBF, 0x25, 0x9C, 0x86, 0x9F, 0x99,
-    0xAC, 0x83, 0xB1, 0x39, 0x97, 0xF8, 0xC0, 0x0F, 0x99, 0x7F, 0xB3, 0x7E, 0x5D, 0x57, 0x00, 0x5A,
-    0x79, 0x76, 0x11, 0x41, 0x5E, 0x4A, 0x52, 0x74, 0x7A, 0x5C, 0x62, 0x34, 0x5C, 0x96, 0x07, 0x1A,
-    0x5E, 0x6E, 0x56, 0x14, 0x95, 0x6D, 0x3D, 0x8F, 0xAC, 0x92, 0x3F, 0x07, 0xAD, 0x4F, 0x38, 0x79,
-    0xFC, 0xB1, 0xAF, 0x3D, 0xBC, 0x7B, 0xE4, 0x3C, 0xE7, 0xE8, 0x43, 0x3D, 0xC7, 0x67, 0x52, 0xC0,
-    0x83, 0xC9, 0x1C, 0xC1, 0xCD, 0x52, 0x2B, 0xBF, 0x66, 0x6C, 0x69, 0x70, 0x30, 0x33, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x3A, 0xC0, 0x3F, 0x69, 0x30, 0xE1, 0x4A,
-    0x7D, 0x30, 0xEA, 0x4A, 0x5D, 0x26, 0xBA, 0x73, 0x61, 0x18, 0xE7, 0x73, 0x82, 0x18, 0xF6, 0x70,
-    0x5C, 0x4D, 0xBE, 0x13, 0x61, 0x3F, 0xEB, 0x07, 0x81, 0x3F, 0xFB, 0x28, 0xDB, 0x5B, 0xBC, 0x20,
-    0xDC, 0x42, 0xB9, 0x68, 0xDA, 0x4C, 0xC1, 0x02, 0xDC, 0x51, 0xB3, 0x55, 0xF9, 0x42, 0xC7, 0x64,
-    0xF8, 0x4C, 0xD0, 0x87, 0xF9, 0x5B, 0xCA, 0x2D, 0xFA, 0x51, 0xC1, 0x4B, 0xC6, 0x5D, 0xD8, 0x20,
-    0xC7, 0x27, 0xD2, 0x68, 0xC5, 0x30, 0xE1, 0x81, 0xC5, 0x4B, 0xE4, 0x03, 0xC8, 0x54, 0xCA, 0x48,
-    0xC9, 0x39, 0xC7, 0x5E, 0xE9, 0x27, 0xE2, 0x64, 0xE7, 0x30, 0xF1, 0x8A, 0xE6, 0x4B, 0xF4, 0x0E,
-    0xE8, 0x5D, 0xE8, 0x2F, 0xEA, 0x54, 0xDA, 0x49, 0xEB, 0x39, 0xD7, 0x43, 0x5D, 0x3B, 0x46, 0x5D,
-    0xF1, 0x00, 0xA9, 0x6D, 0x4E, 0x17, 0xAC, 0x7A, 0xC6, 0x0A, 0xE3, 0x6C, 0x5C, 0x83, 0x4E, 0x1D,
-    0xEE, 0xA8, 0xBC, 0x23, 0x4D, 0x5F, 0xB4, 0x18, 0xC4, 0x6C, 0xEE, 0x2D, 0xF2, 0x2F, 0x8B, 0x5F,
-    0xF0, 0x8F, 0x96, 0x4B, 0xFF, 0x14, 0xA8, 0x46, 0xFD, 0x9B, 0xB7, 0x32, 0x41, 0x29, 0x90, 0x73,
-    0x4B, 0x42, 0x4B, 0x5D, 0x4A, 0x74, 0x50, 0x4D, 0x40, 0x5B, 0x96, 0x17, 0x03, 0x18, 0x75, 0x77,
-    0x10, 0x62, 0x1C, 0x99, 0x01, 0x6A, 0x7E, 0x14, 0xC6, 0x20, 0xFA, 0x8B, 0x4B, 0x35, 0xC2, 0x7F,
-    0xC5, 0x4B, 0xFF, 0x0E, 0x3E, 0x3D, 0xA2, 0x7E, 0x00, 0x3C, 0x88, 0x00, 0x2D, 0x5B, 0x3E, 0x56,
-    0xC5, 0x9E, 0x83, 0x26, 0xC7, 0x20, 0x75, 0x66, 0xBD, 0x9E, 0x7F, 0x1A, 0xBF, 0x1F, 0x71, 0x71,
-    0xBD, 0x43, 0x3E, 0x77, 0xC4, 0x9F, 0x46, 0x2B, 0xBC, 0x9D, 0x48, 0x16, 0xC5, 0x45, 0x3C, 0x66,
-    0xBB, 0x9B, 0x35, 0x26, 0xBC, 0x51, 0x2C, 0x5E, 0x80, 0x42, 0x6D, 0x6A, 0x90, 0x87, 0x1D, 0x1A,
-    0x7F, 0x6E, 0x72, 0x19, 0x90, 0x65, 0x1A, 0x72, 0x9A, 0xFF, 0xAC, 0x4F, 0xAA, 0xFB, 0xBF, 0x25,
-    0x9C, 0x86, 0x9F, 0x99, 0xAC, 0x82, 0xB1, 0x39, 0x97, 0xF8, 0xC1, 0x0F, 0x99, 0x7F, 0xB3, 0x7E,
-    0x5D, 0x55, 0x00, 0x5A, 0x79, 0x75, 0x11, 0x41, 0x5E, 0x49, 0x52, 0x74, 0x7A, 0x5B, 0x62, 0x34,
-    0x5C, 0x95, 0x07, 0x1A, 0x5E, 0x6D, 0x56, 0x14, 0x95, 0x6C, 0x3D, 0x94, 0xAC, 0x92, 0x3F, 0x07,
-    0xAD, 0x4F, 0x37, 0x79, 0x5F, 0xA6, 0xAF, 0x3D, 0xD1, 0x59, 0xE4, 0x3C, 0x9E, 0x7B, 0x44, 0x3D,
-    0x88, 0x2B, 0x3A, 0xC0, 0x50, 0xB2, 0x1C, 0xC1, 0x2D, 0x9E, 0x21, 0xBF, 0x66, 0x6C, 0x69, 0x70,
-    0x30, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x39, 0xC0, 0x3F,
-    0x69, 0x2F, 0xE0, 0x4A, 0x7D, 0x2F, 0xEA, 0x4A, 0x5D, 0x26, 0xB9, 0x73, 0x61, 0x18, 0xE6, 0x73,
-    0x82, 0x18, 0xF6, 0x70, 0x5C, 0x4D, 0xBD, 0x13, 0x60, 0x3F, 0xEA, 0x07, 0x81, 0x3F, 0xFA, 0x28,
-    0xDB, 0x5B, 0xBC, 0x20, 0xDC, 0x42, 0xB9, 0x68, 0xDA, 0x4C, 0xC2, 0x04, 0xDC, 0x51, 0xB4, 0x55,
-    0xF9, 0x42, 0xC8, 0x64, 0xF8, 0x4C, 0xD0, 0x87, 0xF9, 0x5B, 0xCA, 0x2F, 0xFA, 0x51, 0xC2, 0x4B,
-    0xC6, 0x5D, 0xD9, 0x20, 0xC7, 0x27, 0xD3, 0x68, 0xC5, 0x30, 0xE1, 0x81, 0xC4, 0x4B, 0xE4, 0x03,
-    0xC8, 0x54, 0xCA, 0x48, 0xC9, 0x39, 0xC7, 0x5E, 0xE9, 0x27, 0xE3, 0x64, 0xE6, 0x30, 0xF1, 0x8A,
-    0xE6, 0x4B, 0xF4, 0x05, 0xE8, 0x5D, 0xE9, 0x2F, 0xEA, 0x54, 0xDA, 0x49, 0xEA, 0x39, 0xD7, 0x42,
-    0x5E, 0x3B, 0x45, 0x5D, 0xF1, 0x00, 0xAA, 0x6D, 0x4E, 0x17, 0xAB, 0x7A, 0xC5, 0x0A, 0xE3, 0x6C,
-    0x5C, 0x83, 0x4D, 0x1D, 0xEE, 0xA8, 0xBC, 0x23, 0x4D, 0x5F, 0xB3, 0x18, 0xC4, 0x6C, 0xEE, 0x2D,
-    0xF2, 0x2F, 0x8C, 0x5F, 0xF0, 0x8F, 0x96, 0x4B, 0xFF, 0x14, 0xA8, 0x46, 0xFD, 0x9B, 0xB7, 0x30,
-    0x41, 0x29, 0x90, 0x73, 0x4B, 0x42, 0x4A, 0x5D, 0x4A, 0x73, 0x50, 0x4D, 0x40, 0x5B, 0x95, 0x17,
-    0x03, 0x18, 0x74, 0x77, 0x10, 0x61, 0x1C, 0x99, 0x01, 0x6A, 0x7D, 0x14, 0xC6, 0x1F, 0xFA, 0x8B,
-    0x4B, 0x35, 0xC1, 0x7F, 0xC5, 0x4B, 0xFF, 0x0E, 0x3E, 0x3D, 0xA1, 0x7E, 0x00, 0x3C, 0x87, 0x00,
-    0x2D, 0x5B, 0x3E, 0x56, 0xC5, 0x9E, 0x84, 0x26, 0xC7, 0x1F, 0x76, 0x66, 0xBD, 0x9E, 0x80, 0x1A,
-    0xBF, 0x1F, 0x72, 0x71, 0xBD, 0x43, 0x3E, 0x77, 0xC4, 0x9F, 0x47, 0x2B, 0xBC, 0x9D, 0x48, 0x16,
-    0xC6, 0x45, 0x3D, 0x66, 0xBB, 0x9B, 0x35, 0x26, 0xBC, 0x51, 0x2D, 0x5E, 0x80, 0x42, 0x6D, 0x6A,
-    0x90, 0x87, 0x1E, 0x1A, 0x7F, 0x6E, 0x72, 0x19, 0x90, 0x65, 0x1A, 0x72, 0x9A, 0xFF, 0xAC, 0x4F,
-    0xAA, 0xFB, 0xBF, 0x25, 0x9C, 0x86, 0x9F, 0x99, 0xAC, 0x82, 0xB1, 0x39, 0x97, 0xF8, 0xC0, 0x0F,
-    0x99, 0x7F, 0xB3, 0x7E, 0x5D, 0x55, 0x00, 0x5A, 0x79, 0x75, 0x11, 0x41, 0x5E, 0x49, 0x52, 0x74,
-    0x7A, 0x5B, 0x62, 0x34, 0x5C, 0x94, 0x07, 0x1A, 0x5E, 0x6D, 0x56, 0x14, 0x95, 0x6C, 0x3D, 0x97,
-    0xAC, 0x92, 0x3F, 0x07, 0xAD, 0x4F, 0x38, 0x79, 0xB2, 0x84, 0xAF, 0x3D, 0x47, 0xBF, 0xE4, 0x3C,
-    0x74, 0xB0, 0x45, 0x3D, 0x8F, 0xFA, 0x21, 0xC0, 0xF8, 0xF7, 0x1C, 0xC1, 0xAF, 0x39, 0x42, 0xBF,
-    0x66, 0x6C, 0x69, 0x70, 0x30, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x65, 0x3A, 0xBE, 0x3F, 0x68, 0x30, 0xDF, 0x4A, 0x7D, 0x30, 0xE9, 0x41, 0x5C, 0x27, 0xB8, 0x77,
-    0x61, 0x19, 0xE5, 0x73, 0x81, 0x19, 0xF5, 0x70, 0x5C, 0x4D, 0xBC, 0x13, 0x60, 0x3F, 0xE9, 0x07,
-    0x81, 0x3F, 0xF9, 0x28, 0xDB, 0x5B, 0xBD, 0x20, 0xDB, 0x42, 0xBA, 0x68, 0xDA, 0x4C, 0xC2, 0x02,
-    0xDC, 0x51, 0xB4, 0x55, 0xF9, 0x42, 0xC9, 0x64, 0xF8, 0x4C, 0xD1, 0x87, 0xF9, 0x5B, 0xCB, 0x2D,
-    0xFA, 0x51, 0xC3, 0x4B, 0xC6, 0x5D, 0xD9, 0x20, 0xC7, 0x27, 0xD3, 0x68, 0xC5, 0x30, 0xE1, 0x81,
-    0xC4, 0x4B, 0xE4, 0x03, 0xC8, 0x54, 0xCA, 0x48, 0xC9, 0x39, 0xC7, 0x5E, 0xE8, 0x27, 0xE3, 0x64,
-    0xE6, 0x30, 0xF2, 0x8A, 0xE6, 0x4B, 0xF5, 0x0E, 0xE7, 0x5D, 0xE9, 0x2F, 0xEA, 0x54, 0xDB, 0x28,
-    0xEA, 0x39, 0xD8, 0x43, 0x5E, 0x3B, 0x45, 0x5D, 0xF1, 0x00, 0xAB, 0x6D, 0x4E, 0x18, 0xAA, 0x7A,
-    0xC5, 0x0A, 0xE3, 0x6C, 0x5D, 0x83, 0x4D, 0x1D, 0xEE, 0xA7, 0xBD, 0x23, 0x4D, 0x60, 0xB2, 0x18,
-    0xC3, 0x6C, 0xEE, 0x2D, 0xF2, 0x2F, 0x8D, 0x5F, 0xF0, 0x8F, 0x98, 0x4B, 0xFF, 0x13, 0xAA, 0x46,
-    0xFD, 0x9A, 0xB9, 0x32, 0x41, 0x2A, 0x8E, 0x73, 0x4B, 0x43, 0x4A, 0x5D, 0x4B, 0x74, 0x4F, 0x4D,
-    0x40, 0x5C, 0x94, 0x17, 0x03, 0x19, 0x72, 0x77, 0x11, 0x62, 0x1A, 0x99, 0x02, 0x6B, 0x7B, 0x14,
-    0xC5, 0x20, 0xFA, 0x8B, 0x4B, 0x36, 0xC0, 0x7F, 0xC4, 0x4B, 0xFF, 0x0E, 0x3E, 0x3E, 0xA0, 0x7E,
-    0x00, 0x3D, 0x84, 0x00, 0x2E, 0x5C, 0x3D, 0x56, 0xC5, 0x9E, 0x84, 0x27, 0xC8, 0x20, 0x76, 0x66,
-    0xBD, 0x9E, 0x80, 0x1A, 0xBF, 0x20, 0x72, 0x71, 0xBE, 0x43, 0x3F, 0x77, 0xC5, 0x9F, 0x48, 0x2B,
-    0xBC, 0x9D, 0x49, 0x16, 0xC6, 0x45, 0x3E, 0x66, 0xBB, 0x9B, 0x36, 0x26, 0xBD, 0x51, 0x2E, 0x5E,
-    0x80, 0x43, 0x6D, 0x6A, 0x90, 0x87, 0x1E, 0x1A, 0x7F, 0x6E, 0x72, 0x19, 0x91, 0x65, 0x1B, 0x72,
-    0x9A, 0xFF, 0xAC, 0x4F, 0xAA, 0xFB, 0xBF, 0x25, 0x9C, 0x86, 0x9F, 0x99, 0xAC, 0x82, 0xB1, 0x39,
-    0x97, 0xF8, 0xC0, 0x0F, 0x99, 0x7F, 0xB3, 0x7E, 0x5E, 0x56, 0x00, 0x5A, 0x7A, 0x75, 0x11, 0x41,
-    0x5F, 0x49, 0x52, 0x74, 0x7B, 0x5B, 0x62, 0x34, 0x5D, 0x95, 0x07, 0x1A, 0x5E, 0x6D, 0x55, 0x14,
-    0x96, 0x6C, 0x3D, 0x97, 0xAD, 0x92, 0x40, 0x07, 0xAE, 0x4F, 0x39, 0x79, 0xEC, 0x57, 0xAF, 0x3D,
-    0x71, 0x46, 0xE5, 0x3C, 0xD5, 0x18, 0x47, 0x3D, 0x09, 0x17, 0x0D, 0xC0, 0xBE, 0x54, 0x1D, 0xC1,
-    0xAE, 0x6A, 0x4C, 0xBF, 0x66, 0x6C, 0x69, 0x70, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x65, 0x3B, 0xBD, 0x34, 0x68, 0x31, 0xDE, 0x4A, 0x7C, 0x31, 0xE8, 0x4A,
-    0x5C, 0x28, 0xB7, 0x77, 0x60, 0x1A, 0xE3, 0x73, 0x81, 0x19, 0xF4, 0x70, 0x5C, 0x4E, 0xBB, 0x13,
-    0x5F, 0x40, 0xE7, 0x07, 0x80, 0x40, 0xF8, 0x28, 0xDB, 0x5B, 0xBE, 0x20, 0xDB, 0x42, 0xBB, 0x68,
-    0xDA, 0x4C, 0xC3, 0x02, 0xDC, 0x51, 0xB5, 0x55, 0xF9, 0x41, 0xCA, 0x64, 0xF8, 0x4B, 0xD2, 0x87,
-    0xF8, 0x5A, 0xCD, 0x2D, 0xFA, 0x50, 0xC4, 0x4B, 0xC6, 0x5D, 0xD9, 0x20, 0xC7, 0x27, 0xD3, 0x68,
-    0xC4, 0x30, 0xE2, 0x81, 0xC4, 0x4B, 0xE4, 0x03, 0xC8, 0x54, 0xCB, 0x48, 0xC8, 0x39, 0xC8, 0x5E,
-    0xE8, 0x27, 0xE4, 0x64, 0xE6, 0x30, 0xF3, 0x8A, 0xE5, 0x4B, 0xF6, 0x0E, 0xE7, 0x5D, 0xEA, 0x2F,
-    0xE9, 0x54, 0xDC, 0x49, 0xEA, 0x39, 0xD9, 0x43, 0x5E, 0x3C, 0x45, 0x5D, 0xF1, 0x00, 0xAC, 0x6D,
-    0x4E, 0x19, 0xA8, 0x7A, 0xC5, 0x0B, 0xE4, 0x6C, 0x5D, 0x84, 0x4C, 0x1D, 0xEE, 0xA7, 0xBE, 0x23,
-    0x4D, 0x61, 0xB0, 0x18, 0xC3, 0x6C, 0xEE, 0x2D, 0xF2, 0x2F, 0x8F, 0x5F, 0xF0, 0x8E, 0x99, 0x4B,
-    0xFF, 0x13, 0xAB, 0x46, 0xFD, 0x9A, 0xBA, 0x32, 0x41, 0x2B, 0x8D, 0x73, 0x4C, 0x44, 0x49, 0x5D,
-    0x4B, 0x75, 0x4E, 0x4D, 0x40, 0x5D, 0x92, 0x17, 0x03, 0x1A, 0x6F, 0x77, 0x11, 0x64, 0x19, 0x99,
-    0x02, 0x6C, 0x78, 0x14, 0xC5, 0x20, 0xFA, 0x8B, 0x4A, 0x37, 0xBE, 0x7F, 0xC4, 0x4B, 0xFF, 0x0E,
-    0x3E, 0x3F, 0x9E, 0x7E, 0x00, 0x3E, 0x82, 0x00, 0x2E, 0x5D, 0x3C, 0x56, 0xC6, 0x9E, 0x85, 0x26,
-    0xC8, 0x20, 0x77, 0x66, 0xBE, 0x9E, 0x81, 0x1A, 0xC0, 0x20, 0x73, 0x71, 0xBE, 0x43, 0x41, 0x77,
-    0xC5, 0x9F, 0x49, 0x2B, 0xBD, 0x9E, 0x4B, 0x16, 0xC7, 0x45, 0x3F, 0x66, 0xBC, 0x9C, 0x37, 0x26,
-    0xBD, 0x51, 0x2F, 0x5E, 0x80, 0x43, 0x6D, 0x6A, 0x91, 0x88, 0x1F, 0x1A, 0x80, 0x6F, 0x71, 0x19,
-    0x92, 0x66, 0x1B, 0x72, 0x9A, 0xFF, 0xAC, 0x4F, 0xAA, 0xFB, 0xBF, 0x25, 0x9C, 0x86, 0x9F, 0x99,
-    0xAC, 0x83, 0xB1, 0x39, 0x97, 0xF8, 0xC0, 0x0F, 0x99, 0x7F, 0xB3, 0x7E, 0x5F, 0x57, 0x00, 0x5A,
-    0x7A, 0x76, 0x12, 0x41, 0x5F, 0x4A, 0x51, 0x74, 0x7B, 0x5C, 0x61, 0x34, 0x5E, 0x96, 0x07, 0x1A,
-    0x5E, 0x6E, 0x55, 0x14, 0x96, 0x6D, 0x3E, 0x97, 0xAD, 0x92, 0x41, 0x07, 0xAE, 0x4F, 0x3A, 0x79,
-    0x9D, 0x2F, 0xAF, 0x3D, 0xF6, 0x89, 0xE5, 0x3C, 0xE4, 0x4A, 0x48, 0x3D, 0xE0, 0x81, 0xF5, 0xBF,
-    0x17, 0x83, 0x1D, 0xC1, 0xEF, 0x90, 0x38, 0xBF, 0x66, 0x6C, 0x69, 0x70, 0x30, 0x37, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x3B, 0xBC, 0x34, 0x67, 0x31, 0xDC, 0x41,
-    0x7C, 0x31, 0xE7, 0x41, 0x5C, 0x28, 0xB5, 0x73, 0x60, 0x1A, 0xE2, 0x73, 0x80, 0x1A, 0xF3, 0x70,
-    0x5B, 0x4F, 0xBA, 0x13, 0x5F, 0x41, 0xE6, 0x07, 0x80, 0x40, 0xF7, 0x28, 0xDB, 0x5B, 0xBE, 0x20,
-    0xDB, 0x42, 0xBC, 0x68, 0xDA, 0x4C, 0xC4, 0x02, 0xDC, 0x51, 0xB6, 0x55, 0xF9, 0x41, 0xCB, 0x64,
-    0xF7, 0x4B, 0xD3, 0x89, 0xF8, 0x5A, 0xCE, 0x2D, 0xFA, 0x50, 0xC6, 0x4B, 0xC5, 0x5D, 0xD9, 0x20,
-    0xC6, 0x27, 0xD4, 0x68, 0xC4, 0x30, 0xE2, 0x81, 0xC3, 0x4B, 0xE5, 0x03, 0xC8, 0x54, 0xCB, 0x48,
-    0xC8, 0x39, 0xC8, 0x5E, 0xE8, 0x27, 0xE5, 0x64, 0xE5, 0x30, 0xF3, 0x8A, 0xE5, 0x4B, 0xF6, 0x05,
-    0xE7, 0x5D, 0xEB, 0x2F, 0xE9, 0x54, 0xDD, 0x49, 0xEA, 0x39, 0xDA, 0x43, 0x5F, 0x3D, 0x44, 0x5D,
-    0xF1, 0x00, 0xAD, 0x6D, 0x4E, 0x19, 0xA7, 0x7A, 0xC4, 0x0B, 0xE4, 0x6C, 0x5E, 0x84, 0x4C, 0x1D,
-    0xEE, 0xA7, 0xBF, 0x23, 0x4D, 0x61, 0xAF, 0x18, 0xC3, 0x6C, 0xEE, 0x2D, 0xF2, 0x2F, 0x90, 0x5F,
-    0xF0, 0x8E, 0x9B, 0x4B, 0xFF, 0x13, 0xAD, 0x46, 0xFD, 0x9A, 0xBB, 0x32, 0x41, 0x2C, 0x8C, 0x73,
-    0x4C, 0x44, 0x48, 0x5D, 0x4B, 0x75, 0x4D, 0x4D, 0x40, 0x5D, 0x91, 0x17, 0x03, 0x1B, 0x6D, 0x77,
-    0x12, 0x64, 0x17, 0x99, 0x02, 0x6D, 0x76, 0x14, 0xC4, 0x20, 0xFA, 0x8B, 0x4A, 0x37, 0xBD, 0x7F,
-    0xC3, 0x4B, 0xFF, 0x0E, 0x3E, 0x3F, 0x9C, 0x7E, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x5D, 0x3A, 0x56,
-    0xC6, 0x9E, 0x86, 0x27, 0xC8, 0x20, 0x78, 0x66, 0xBE, 0x9E, 0x82, 0x1A, 0xC0, 0x20, 0x74, 0x71,
-    0xBF, 0x43, 0x42, 0x77, 0xC6, 0x9F, 0x4A, 0x2B, 0xBD, 0x9E, 0x4C, 0x16, 0xC7, 0x45, 0x40, 0x66,
-    0xBD, 0x9C, 0x39, 0x26, 0xBE, 0x51, 0x30, 0x5E, 0x81, 0x43, 0x6D, 0x6A, 0x92, 0x88, 0x20, 0x1A,
-    0x80, 0x6F, 0x71, 0x19, 0x92, 0x66, 0x1C, 0x72, 0x9A, 0xFF, 0xAC, 0x4F, 0xA9, 0xFB, 0xBF, 0x25,
-    0x9C, 0x86, 0x9F, 0x99, 0xAC, 0x83, 0xB2, 0x35, 0x97, 0xF8, 0xBF, 0x0F, 0x99, 0x7F, 0xB2, 0x7E,
-    0x5F, 0x57, 0x00, 0x5A, 0x7B, 0x76, 0x12, 0x41, 0x5F, 0x4A, 0x50, 0x74, 0x7B, 0x5C, 0x61, 0x35,
-    0x5E, 0x96, 0x07, 0x1A, 0x5F, 0x6E, 0x54, 0x14, 0x97, 0x6D, 0x3E, 0x97, 0xAE, 0x92, 0x42, 0x07,
-    0xAF, 0x4F, 0x3B, 0x79, 0x7F, 0xEB, 0xAE, 0x3D, 0xF6, 0x89, 0xE5, 0x3C, 0xCF, 0x33, 0x4A, 0x3D,
-    0x78, 0xF2, 0xE3, 0xBF, 0x17, 0x83, 0x1D, 0xC1, 0xCB, 0x7D, 0xD3, 0xBD, 0x66, 0x6C, 0x69, 0x70,
-    0x30, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x3B, 0xBB, 0x34,
-    0x67, 0x31, 0xDA, 0x41, 0x7B, 0x31, 0xE6, 0x41, 0x5C, 0x28, 0xB4, 0x73, 0x5F, 0x1A, 0xE0, 0x73,
-    0x80, 0x1A, 0xF1, 0x70, 0x5B, 0x4F, 0xB8, 0x13, 0x5E, 0x41, 0xE4, 0x07, 0x7F, 0x40, 0xF6, 0x28,
-    0xDB, 0x5B, 0xC0, 0x20, 0xDB, 0x42, 0xBD, 0x68, 0xDA, 0x4C, 0xC5, 0x02, 0xDC, 0x51, 0xB7, 0x55,
-    0xF9, 0x41, 0xCD, 0x64, 0xF7, 0x4B, 0xD5, 0x89, 0xF8, 0x5A, 0xD0, 0x2D, 0xFA, 0x50, 0xC7, 0x4B,
-    0xC5, 0x5D, 0xDA, 0x20, 0xC6, 0x27, 0xD4, 0x68, 0xC3, 0x30, 0xE2, 0x81, 0xC3, 0x4B, 0xE5, 0x03,
-    0xC7, 0x54, 0xCC, 0x48, 0xC8, 0x39, 0xC9, 0x5E, 0xE7, 0x27, 0xE6, 0x64, 0xE5, 0x30, 0xF4, 0x8A,
-    0xE4, 0x4B, 0xF7, 0x05, 0xE6, 0x5D, 0xEC, 0x2F, 0xE9, 0x54, 0xDE, 0x28, 0xE9, 0x39, 0xDB, 0x43,
-    0x5F, 0x3D, 0x43, 0x5D, 0xF1, 0x00, 0xAF, 0x6D, 0x4E, 0x19, 0xA5, 0x7A, 0xC4, 0x0B, 0xE4, 0x6C,
-    0x5E, 0x84, 0x4B, 0x1D, 0xEE, 0xA7, 0xC1, 0x23, 0x4C, 0x61, 0xAD, 0x18, 0xC2, 0x6C, 0xEE, 0x2D,
-    0xF2, 0x2F, 0x92, 0x5F, 0xF1, 0x8E, 0x9D, 0x4B, 0xFF, 0x13, 0xAF, 0x46, 0xFD, 0x9A, 0xBD, 0x32,
-    0x41, 0x2C, 0x8A, 0x73, 0x4D, 0x44, 0x47, 0x5D, 0x4C, 0x75, 0x4C, 0x4D, 0x40, 0x5D, 0x8F, 0x17,
-    0x03, 0x1B, 0x6A, 0x77, 0x13, 0x64, 0x15, 0x99, 0x02, 0x6D, 0x73, 0x14, 0xC3, 0x20, 0xFA, 0x8B,
-    0x4A, 0x37, 0xBA, 0x7F, 0xC3, 0x4B, 0xFF, 0x0E, 0x3E, 0x3F, 0x9A, 0x7E, 0x00, 0x3F, 0x7C, 0x00,
-    0x2F, 0x5D, 0x39, 0x56, 0xC6, 0x9E, 0x87, 0x27, 0xC8, 0x20, 0x7A, 0x66, 0xBE, 0x9E, 0x83, 0x1A,
-    0xC0, 0x20, 0x75, 0x5A, 0xC0, 0x43, 0x43, 0x77, 0xC6, 0x9F, 0x4C, 0x2B, 0xBE, 0x9E, 0x4D, 0x16,
-    0xC8, 0x45, 0x42, 0x65, 0xBD, 0x9C, 0x3A, 0x26, 0xBF, 0x51, 0x32, 0x5E, 0x81, 0x43, 0x6C, 0x6A,
-    0x93, 0x88, 0x20, 0x1A, 0x80, 0x6F, 0x71, 0x19, 0x93, 0x66, 0x1D, 0x72, 0x9A, 0xFF, 0xAB, 0x4F,
-    0xA9, 0xFB, 0xBF, 0x25, 0x9C, 0x86, 0x9F, 0x99, 0xAB, 0x83, 0xB2, 0x39, 0x96, 0xF8, 0xBF, 0x10,
-    0x98, 0x7F, 0xB2, 0x90, 0x61, 0x57, 0x00, 0x5A, 0x7C, 0x76, 0x13, 0x41, 0x60, 0x4A, 0x50, 0x74,
-    0x7C, 0x5C, 0x61, 0x35, 0x5F, 0x96, 0x07, 0x1A, 0x5F, 0x6E, 0x54, 0x14, 0x98, 0x6D, 0x3F, 0x94,
-    0xAE, 0x92, 0x43, 0x07, 0xB0, 0x4F, 0x3C, 0x79, 0x99, 0xAC, 0xAD, 0x3D, 0xF6, 0x89, 0xE5, 0x3C,
-    0x45, 0xC1, 0x50, 0x3D, 0xEA, 0xCF, 0xE2, 0xBF, 0x17, 0x83, 0x1D, 0xC1, 0xEE, 0x1F, 0x30, 0x3D,
-    0x66, 0x6C, 0x69, 0x70, 0x30, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x63, 0x3B, 0xB5, 0x34, 0x65, 0x31, 0xD4, 0x41, 0x79, 0x31, 0xE0, 0x41, 0x5B, 0x28, 0xAD, 0x73,
-    0x5D, 0x1A, 0xD8, 0x73, 0x7D, 0x1A, 0xEC, 0x70, 0x5A, 0x4F, 0xB1, 0x13, 0x5C, 0x41, 0xDC, 0x07,
-    0x7C, 0x40, 0xF0, 0x28, 0xDA, 0x5B, 0xC4, 0x20, 0xDA, 0x42, 0xC1, 0x68, 0xD9, 0x4C, 0xC9, 0x02,
-    0xDC, 0x51, 0xBC, 0x55, 0xF8, 0x41, 0xD3, 0x64, 0xF6, 0x4B, 0xDB, 0x89, 0xF7, 0x5A, 0xD6, 0x2D,
-    0xF9, 0x50, 0xCE, 0x4B, 0xC3, 0x5D, 0xDB, 0x20, 0xC5, 0x27, 0xD6, 0x68, 0xC2, 0x30, 0xE3, 0x81,
-    0xC1, 0x4B, 0xE6, 0x03, 0xC6, 0x54, 0xCE, 0x48, 0xC7, 0x39, 0xCB, 0x5E, 0xE5, 0x27, 0xEA, 0x64,
-    0xE3, 0x30, 0xF7, 0x8A, 0xE2, 0x4B, 0xFA, 0x05, 0xE4, 0x5D, 0xF0, 0x2F, 0xE7, 0x54, 0xE2, 0x28,
-    0xE8, 0x39, 0xDF, 0x43, 0x62, 0x3D, 0x41, 0x5D, 0xF1, 0x00, 0xB6, 0x6D, 0x4D, 0x19, 0x9E, 0x7A,
-    0xC2, 0x0B, 0xE5, 0x6C, 0x60, 0x84, 0x48, 0x1D, 0xED, 0xA7, 0xC7, 0x23, 0x4B, 0x61, 0xA5, 0x16,
-    0xC0, 0x6C, 0xEF, 0x08, 0xF3, 0x2F, 0x9A, 0x66, 0xF1, 0x8E, 0xA4, 0x4B, 0xFF, 0x13, 0xB7, 0x46,
-    0xFC, 0x9A, 0xC4, 0x32, 0x41, 0x2C, 0x82, 0x73, 0x4F, 0x44, 0x43, 0x5D, 0x4E, 0x75, 0x48, 0x1C,
-    0x40, 0x5D, 0x87, 0x17, 0x04, 0x1B, 0x5E, 0x77, 0x16, 0x64, 0x0E, 0x99, 0x02, 0x6D, 0x67, 0x1B,
-    0xC1, 0x20, 0xFB, 0x8B, 0x48, 0x37, 0xB2, 0x7F, 0xC0, 0x4B, 0xFF, 0x0E, 0x3D, 0x3F, 0x92, 0x7E,
-    0x00, 0x3F, 0x70, 0x0F, 0x32, 0x5D, 0x33, 0x56, 0xC7, 0x9E, 0x8B, 0x27, 0xCA, 0x20, 0x7F, 0x66,
-    0xBF, 0x9E, 0x87, 0x1A, 0xC2, 0x20, 0x7A, 0x5A, 0xC2, 0x43, 0x49, 0x77, 0xC9, 0x9F, 0x52, 0x2B,
-    0xC0, 0x9E, 0x53, 0x16, 0xCB, 0x45, 0x49, 0x65, 0xC1, 0x9C, 0x40, 0x26, 0xC2, 0x51, 0x39, 0x5E,
-    0x82, 0x43, 0x6C, 0x6A, 0x96, 0x88, 0x24, 0x1D, 0x81, 0x6F, 0x70, 0x19, 0x97, 0x66, 0x20, 0x72,
-    0x99, 0xFF, 0xAB, 0x47, 0xA8, 0xFB, 0xBF, 0x25, 0x9C, 0x86, 0x9E, 0x99, 0xAB, 0x83, 0xB2, 0x35,
-    0x95, 0xF8, 0xBD, 0x10, 0x98, 0x7F, 0xB1, 0x7C, 0x65, 0x57, 0x00, 0x5A, 0x80, 0x76, 0x14, 0x41,
-    0x62, 0x4A, 0x4D, 0x74, 0x7D, 0x5C, 0x60, 0x35, 0x63, 0x96, 0x06, 0x1A, 0x61, 0x6E, 0x51, 0x14,
-    0x9A, 0x6D, 0x42, 0x97, 0xB1, 0x92, 0x48, 0x07, 0xB3, 0x4F, 0x41, 0x79, 0xAA, 0x55, 0xAF, 0x3D,
-    0xF6, 0x89, 0xE5, 0x3C, 0x5F, 0x14, 0x47, 0x3D, 0xF2, 0xB2, 0xF6, 0xBF, 0x17, 0x83, 0x1D, 0xC1,
-    0x0D, 0x02, 0xFF, 0x3E, 0x66, 0x6C, 0x69, 0x70, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x65, 0x3B, 0xBD, 0x34, 0x68, 0x31, 0xDE, 0x4A, 0x7C, 0x31, 0xE8, 0x4A,
-    0x5C, 0x28, 0xB7, 0x77, 0x60, 0x1A, 0xE3, 0x73, 0x81, 0x1A, 0xF4, 0x70, 0x5C, 0x4F, 0xBB, 0x13,
-    0x5F, 0x41, 0xE7, 0x07, 0x80, 0x40, 0xF8, 0x28, 0xDB, 0x5B, 0xBE, 0x20, 0xDB, 0x42, 0xBB, 0x68,
-    0xDA, 0x4C, 0xC3, 0x02, 0xDC, 0x51, 0xB5, 0x55, 0xF9, 0x41, 0xCA, 0x64, 0xF8, 0x4B, 0xD2, 0x87,
-    0xF8, 0x5A, 0xCD, 0x2D, 0xFA, 0x50, 0xC4, 0x4B, 0xC6, 0x5D, 0xD9, 0x20, 0xC7, 0x27, 0xD3, 0x68,
-    0xC4, 0x30, 0xE2, 0x81, 0xC4, 0x4B, 0xE4, 0x03, 0xC8, 0x54, 0xCB, 0x48, 0xC8, 0x39, 0xC8, 0x5E,
-    0xE8, 0x27, 0xE4, 0x64, 0xE6, 0x30, 0xF3, 0x8A, 0xE5, 0x4B, 0xF6, 0x0E, 0xE7, 0x5D, 0xEA, 0x2F,
-    0xE9, 0x54, 0xDC, 0x49, 0xEA, 0x39, 0xD9, 0x43, 0x5E, 0x3D, 0x45, 0x5D, 0xF1, 0x00, 0xAC, 0x6D,
-    0x4E, 0x19, 0xA8, 0x7A, 0xC5, 0x0B, 0xE4, 0x6C, 0x5D, 0x84, 0x4C, 0x1D, 0xEE, 0xA7, 0xBE, 0x23,
-    0x4D, 0x61, 0xB0, 0x18, 0xC3, 0x6C, 0xEE, 0x2D, 0xF2, 0x2F, 0x8F, 0x5F, 0xF0, 0x8E, 0x99, 0x4B,
-    0xFF, 0x13, 0xAB, 0x46, 0xFD, 0x9A, 0xBA, 0x32, 0x41, 0x2C, 0x8D, 0x73, 0x4C, 0x44, 0x49, 0x5D,
-    0x4B, 0x75, 0x4E, 0x4D, 0x40, 0x5D, 0x92, 0x17, 0x03, 0x1B, 0x6F, 0x77, 0x11, 0x64, 0x19, 0x99,
-    0x02, 0x6D, 0x78, 0x14, 0xC5, 0x20, 0xFA, 0x8B, 0x4A, 0x37, 0xBE, 0x7F, 0xC4, 0x4B, 0xFF, 0x0E,
-    0x3E, 0x3F, 0x9E, 0x7E, 0x00, 0x3F, 0x82, 0x00, 0x2E, 0x5D, 0x3C, 0x56, 0xC6, 0x9E, 0x85, 0x26,
-    0xC8, 0x20, 0x77, 0x66, 0xBE, 0x9E, 0x81, 0x1A, 0xC0, 0x20, 0x73, 0x71, 0xBE, 0x43, 0x41, 0x77,
-    0xC5, 0x9F, 0x49, 0x2B, 0xBD, 0x9E, 0x4B, 0x16, 0xC7, 0x45, 0x3F, 0x66, 0xBC, 0x9C, 0x37, 0x26,
-    0xBD, 0x51, 0x2F, 0x5E, 0x80, 0x43, 0x6D, 0x6A, 0x91, 0x88, 0x1F, 0x1A, 0x80, 0x6F, 0x71, 0x19,
-    0x92, 0x66, 0x1B, 0x72, 0x9A, 0xFF, 0xAC, 0x4F, 0xAA, 0xFB, 0xBF, 0x25, 0x9C, 0x86, 0x9F, 0x99,
-    0xAC, 0x83, 0xB1, 0x39, 0x97, 0xF8, 0xC0, 0x0F, 0x99, 0x7F, 0xB3, 0x7E, 0x5F, 0x57, 0x00, 0x5A,
-    0x7A, 0x76, 0x12, 0x41, 0x5F, 0x4A, 0x51, 0x74, 0x7B, 0x5C, 0x61, 0x34, 0x5E, 0x96, 0x07, 0x1A,
-    0x5E, 0x6E, 0x55, 0x14, 0x96, 0x6D, 0x3E, 0x97, 0xAD, 0x92, 0x41, 0x07, 0xAE, 0x4F, 0x3A, 0x79,
-    0xB0, 0xBF, 0xAD, 0x3D, 0xF6, 0x89, 0xE5, 0x3C, 0x4E, 0xDB, 0x2F, 0x3D, 0x5E, 0x2D, 0xEB, 0xBF,
-    0x17, 0x83, 0x1D, 0xC1, 0xA5, 0x1E, 0x3A, 0x40, 0x66, 0x6C, 0x69, 0x70, 0x31, 0x31, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x3B, 0xCC, 0x3F, 0x73, 0x31, 0xEE, 0x4A,
-    0x88, 0x31, 0xEF, 0x4A, 0x62, 0x28, 0xC9, 0x77, 0x6C, 0x1A, 0xF8, 0x7A, 0x8E, 0x1A, 0xFA, 0x62,
-    0x62, 0x4F, 0xCE, 0x10, 0x6C, 0x41, 0xFD, 0x08, 0x8E, 0x40, 0xFF, 0x28, 0xDE, 0x5B, 0x91, 0x20,
-    0xDE, 0x42, 0x8E, 0x68, 0xDE, 0x4C, 0x98, 0x05, 0xDF, 0x51, 0x88, 0x54, 0xFD, 0x41, 0x90, 0x65,
-    0xFD, 0x4B, 0x9A, 0x87, 0xFD, 0x5A, 0x93, 0x2F, 0xFE, 0x50, 0x89, 0x4B, 0xCE, 0x5D, 0xBA, 0x20,
-    0xCE, 0x27, 0xB3, 0x68, 0xCD, 0x30, 0xC4, 0x89, 0xCD, 0x4B, 0xC7, 0x09, 0xCE, 0x54, 0xA9, 0x4F,
-    0xCE, 0x39, 0xA6, 0x5D, 0xF1, 0x27, 0xB5, 0x62, 0xF1, 0x30, 0xC6, 0x8C, 0xF1, 0x4B, 0xC9, 0x0C,
-    0xF1, 0x5D, 0xBC, 0x2E, 0xF1, 0x54, 0xAB, 0x49, 0xF1, 0x39, 0xA8, 0x42, 0x53, 0x3D, 0x4B, 0x5D,
-    0xF1, 0x00, 0x73, 0x6D, 0x52, 0x19, 0xC1, 0x7A, 0xCE, 0x0B, 0xC6, 0x6E, 0x53, 0x84, 0x54, 0x1D,
-    0xF1, 0xA7, 0x89, 0x25, 0x52, 0x61, 0xCA, 0x18, 0xCE, 0x6C, 0xD3, 0x2D, 0xEE, 0x2F, 0x52, 0x60,
-    0xEE, 0x8E, 0x5F, 0x48, 0xFF, 0x13, 0x6B, 0x44, 0xFF, 0x9A, 0x7C, 0x30, 0x41, 0x2C, 0xAA, 0x7A,
-    0x42, 0x44, 0x59, 0x58, 0x42, 0x75, 0x60, 0x1D, 0x41, 0x5D, 0xB0, 0x17, 0x00, 0x1B, 0xA8, 0x77,
-    0x02, 0x64, 0x42, 0x9B, 0x00, 0x6D, 0xB2, 0x16, 0xD1, 0x20, 0xDF, 0x3A, 0x51, 0x37, 0xDB, 0x84,
-    0xD1, 0x4B, 0xE5, 0x0D, 0x40, 0x3F, 0xBD, 0x7F, 0x00, 0x3F, 0xBE, 0x02, 0x23, 0x5D, 0x5A, 0x53,
-    0xC1, 0x9E, 0x5E, 0x26, 0xC2, 0x20, 0x4E, 0x5E, 0xB9, 0x9E, 0x5E, 0x1A, 0xB9, 0x20, 0x4E, 0x71,
-    0xB0, 0x43, 0x17, 0x77, 0xB8, 0x9F, 0x1D, 0x4C, 0xB0, 0x9E, 0x22, 0x17, 0xB8, 0x45, 0x11, 0x5E,
-    0xAD, 0x9C, 0x0E, 0x47, 0xAD, 0x51, 0x04, 0x5D, 0x7A, 0x43, 0x66, 0x6A, 0x80, 0x88, 0x09, 0x1A,
-    0x7A, 0x6F, 0x6C, 0x14, 0x80, 0x66, 0x04, 0x72, 0x9D, 0xFF, 0x9E, 0x4D, 0xAE, 0xFB, 0xAB, 0x25,
-    0x9D, 0x86, 0x8F, 0x9B, 0xAE, 0x83, 0x9C, 0x34, 0x9C, 0xF8, 0xB6, 0x01, 0x9C, 0x7F, 0xA6, 0x7E,
-    0x4A, 0x57, 0x00, 0x71, 0x67, 0x76, 0x06, 0x4A, 0x56, 0x4A, 0x59, 0x7B, 0x73, 0x5C, 0x5C, 0x34,
-    0x4A, 0x96, 0x08, 0x1B, 0x56, 0x6E, 0x5D, 0x15, 0x89, 0x6D, 0x28, 0x8F, 0xA0, 0x92, 0x20, 0x08,
-    0xA0, 0x4F, 0x17, 0x79, 0x72, 0xF6, 0xAC, 0x3D, 0xF6, 0x89, 0xE5, 0x3C, 0x69, 0xAC, 0x3D, 0x3D,
-    0xD8, 0xD3, 0x12, 0xC0, 0x17, 0x83, 0x1D, 0xC1, 0xA7, 0x9D, 0x81, 0x40, 0x66, 0x6C, 0x69, 0x70,
-    0x31, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3B, 0xD4, 0x41,
-    0x86, 0x31, 0xEE, 0x56, 0x9B, 0x31, 0xE4, 0x56, 0x70, 0x28, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A,
-    0xA2, 0x1A, 0xEA, 0x62, 0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26,
-    0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52,
-    0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48,
-    0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A,
-    0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C,
-    0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F,
-    0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x19, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E,
-    0x51, 0x84, 0x76, 0x1A, 0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25,
-    0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E,
-    0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x44, 0x83, 0xA0, 0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5D, 0xD1, 0x06,
-    0x0D, 0x1B, 0xEB, 0x78, 0x00, 0x64, 0x90, 0x94, 0x0F, 0x6D, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38,
-    0x63, 0x37, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x3F, 0xDD, 0x84, 0x10, 0x3F, 0xFF, 0x05,
-    0x23, 0x5D, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B,
-    0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07,
-    0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58, 0x79, 0x43, 0x71, 0x6C,
-    0x71, 0x88, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E,
-    0xB5, 0xFB, 0x94, 0x2C, 0xA0, 0x86, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x3F, 0xA5, 0xF8, 0xA7, 0x01,
-    0xA3, 0x7F, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56, 0x54, 0x4A, 0x78, 0x7D,
-    0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6E, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E,
-    0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A, 0x7A, 0xF6, 0xAC, 0x3D, 0xF1, 0x89, 0xE5, 0x3C,
-    0x57, 0xAC, 0x3D, 0x3D, 0xE9, 0x9A, 0x53, 0x40, 0x13, 0x83, 0x1D, 0xC1, 0xCB, 0x9D, 0x81, 0x40,
-    0x73, 0x61, 0x6C, 0x75, 0x74, 0x65, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x79, 0x3B, 0xD4, 0x41, 0x86, 0x31, 0xEE, 0x56, 0x9B, 0x31, 0xE4, 0x56, 0x70, 0x28, 0xD6, 0x7A,
-    0x80, 0x1A, 0xFB, 0x7A, 0xA2, 0x1A, 0xEA, 0x62, 0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08,
-    0xA3, 0x40, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C,
-    0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A,
-    0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87,
-    0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62,
-    0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47,
-    0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x19, 0xD7, 0x7A,
-    0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1A, 0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07,
-    0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42,
-    0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x44, 0x83, 0xA0, 0x42, 0x75, 0x89, 0x1A,
-    0x4C, 0x5D, 0xD1, 0x06, 0x0D, 0x1B, 0xEB, 0x78, 0x00, 0x64, 0x90, 0x94, 0x0F, 0x6D, 0xF5, 0x16,
-    0xDF, 0x20, 0xAF, 0x38, 0x63, 0x37, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x3F, 0xDD, 0x84,
-    0x10, 0x3F, 0xFF, 0x05, 0x23, 0x5D, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60,
-    0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49,
-    0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58,
-    0x79, 0x43, 0x71, 0x6C, 0x71, 0x88, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77,
-    0xA2, 0xFF, 0x92, 0x9E, 0xB5, 0xFB, 0x94, 0x2C, 0xA0, 0x86, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x3F,
-    0xA5, 0xF8, 0xA7, 0x01, 0xA3, 0x7F, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56,
-    0x54, 0x4A, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6E, 0x7C, 0x18,
-    0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A, 0x7A, 0xF6, 0xAC, 0x3D,
-    0xDE, 0xE0, 0xE5, 0x3C, 0x71, 0xB1, 0x3D, 0x3D, 0xFC, 0x0E, 0xBB, 0x40, 0xB3, 0xB0, 0x1D, 0xC1,
-    0xE8, 0x3E, 0xA4, 0x40, 0x73, 0x61, 0x6C, 0x75, 0x74, 0x65, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x79, 0x3C, 0xD4, 0x41, 0x86, 0x32, 0xEE, 0x56, 0x9B, 0x32, 0xE4, 0x56,
-    0x70, 0x29, 0xD6, 0x7A, 0x80, 0x1B, 0xFB, 0x7A, 0xA2, 0x1A, 0xEB, 0x62, 0x71, 0x4F, 0xDB, 0x11,
-    0x81, 0x41, 0xFF, 0x08, 0xA3, 0x41, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68,
-    0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B,
-    0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x28, 0x8B, 0x68,
-    0xD7, 0x31, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x3A, 0x7E, 0x58,
-    0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29,
-    0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70,
-    0x5F, 0x1A, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1D, 0xF1, 0xA7, 0x52, 0x25,
-    0x61, 0x62, 0xDF, 0x07, 0xDA, 0x6D, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2E, 0x4F,
-    0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x44, 0x83, 0xA0,
-    0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5E, 0xD1, 0x06, 0x0D, 0x1C, 0xEB, 0x78, 0x00, 0x65, 0x90, 0x94,
-    0x0F, 0x6E, 0xF5, 0x16, 0xDF, 0x20, 0xB0, 0x38, 0x63, 0x38, 0xEE, 0x86, 0xDF, 0x4C, 0xB4, 0x31,
-    0x4E, 0x40, 0xDD, 0x84, 0x10, 0x40, 0xFF, 0x05, 0x23, 0x5E, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26,
-    0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78,
-    0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9D, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9B, 0x08, 0x1C,
-    0x9C, 0x51, 0x00, 0x58, 0x79, 0x44, 0x71, 0x6C, 0x71, 0x87, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14,
-    0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x91, 0x9E, 0xB5, 0xFB, 0x93, 0x2C, 0xA0, 0x87, 0x84, 0x94,
-    0xB3, 0x83, 0x86, 0x46, 0xA5, 0xF8, 0xA6, 0x01, 0xA3, 0x80, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71,
-    0x59, 0x76, 0x25, 0x56, 0x54, 0x4B, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B,
-    0x55, 0x6F, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A,
-    0x7A, 0xF6, 0xAC, 0x3D, 0x88, 0x40, 0xE6, 0x3C, 0x99, 0xB6, 0x3D, 0x3D, 0xF0, 0xD6, 0x0F, 0x41,
-    0x0E, 0xE3, 0x1D, 0xC1, 0x6B, 0x75, 0x8A, 0x40, 0x73, 0x61, 0x6C, 0x75, 0x74, 0x65, 0x30, 0x33,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3D, 0xD4, 0x41, 0x86, 0x33, 0xEE, 0x56,
-    0x9B, 0x32, 0xE4, 0x56, 0x70, 0x2A, 0xD6, 0x7A, 0x80, 0x1C, 0xFB, 0x7A, 0xA2, 0x1B, 0xEB, 0x62,
-    0x71, 0x50, 0xDB, 0x11, 0x81, 0x42, 0xFF, 0x08, 0xA3, 0x42, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20,
-    0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63,
-    0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5E, 0x91, 0x20,
-    0xD5, 0x28, 0x8B, 0x68, 0xD7, 0x31, 0x9A, 0x87, 0xD7, 0x4C, 0x9D, 0x0A, 0xD3, 0x55, 0x81, 0x4E,
-    0xD3, 0x3A, 0x7F, 0x58, 0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31,
-    0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58,
-    0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x1B, 0xD7, 0x7A, 0xD8, 0x0C, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1D,
-    0xF1, 0xA7, 0x52, 0x25, 0x61, 0x62, 0xDF, 0x07, 0xDA, 0x6D, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59,
-    0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42, 0xFC, 0x99, 0x40, 0x2E, 0x4C, 0x2D, 0xCB, 0x7A,
-    0x41, 0x45, 0x83, 0xA0, 0x42, 0x76, 0x89, 0x1A, 0x4C, 0x5E, 0xD1, 0x06, 0x0D, 0x1D, 0xEB, 0x78,
-    0x00, 0x65, 0x90, 0x94, 0x0F, 0x6E, 0xF4, 0x16, 0xDF, 0x21, 0xB0, 0x38, 0x63, 0x39, 0xEE, 0x86,
-    0xDF, 0x4C, 0xB4, 0x31, 0x4E, 0x41, 0xDD, 0x84, 0x10, 0x41, 0xFF, 0x05, 0x23, 0x5E, 0x94, 0x51,
-    0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x72,
-    0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9E, 0x0F, 0x49, 0xA4, 0x9D, 0x19, 0x07, 0xA9, 0x44, 0x05, 0x5E,
-    0x9D, 0x9B, 0x08, 0x1C, 0x9C, 0x50, 0x00, 0x58, 0x79, 0x44, 0x71, 0x6C, 0x71, 0x87, 0x1B, 0x1B,
-    0x7A, 0x6F, 0x76, 0x14, 0x70, 0x65, 0x17, 0x77, 0xA2, 0xFF, 0x91, 0x9E, 0xB5, 0xFB, 0x93, 0x2C,
-    0xA0, 0x87, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x46, 0xA5, 0xF8, 0xA6, 0x01, 0xA3, 0x80, 0x99, 0x7F,
-    0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56, 0x54, 0x4B, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F,
-    0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6F, 0x7C, 0x18, 0x7F, 0x6C, 0x32, 0x92, 0x93, 0x91, 0x1F, 0x08,
-    0x92, 0x4F, 0x18, 0x6A, 0x7C, 0xF6, 0xAC, 0x3D, 0x5C, 0x8D, 0xE6, 0x3C, 0x76, 0xBA, 0x3D, 0x3D,
-    0x15, 0x78, 0x08, 0x41, 0x9E, 0x0B, 0x1E, 0xC1, 0x10, 0xE6, 0x9E, 0x40, 0x73, 0x61, 0x6C, 0x75,
-    0x74, 0x65, 0x30, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3D, 0xD4, 0x41,
-    0x86, 0x33, 0xEE, 0x56, 0x9B, 0x33, 0xE4, 0x56, 0x70, 0x2A, 0xD6, 0x7A, 0x80, 0x1D, 0xFB, 0x7A,
-    0xA2, 0x1C, 0xEB, 0x62, 0x71, 0x50, 0xDB, 0x11, 0x81, 0x43, 0xFF, 0x23, 0xA3, 0x42, 0xEF, 0x26,
-    0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52,
-    0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48,
-    0xD6, 0x5E, 0x91, 0x20, 0xD5, 0x28, 0x8B, 0x68, 0xD7, 0x31, 0x9A, 0x87, 0xD7, 0x4C, 0x9D, 0x0A,
-    0xD3, 0x55, 0x81, 0x4E, 0xD3, 0x3A, 0x7F, 0x58, 0xF7, 0x28, 0x7A, 0x62, 0xF9, 0x31, 0x89, 0x8C,
-    0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F,
-    0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x1B, 0xD7, 0x7A, 0xD8, 0x0C, 0x9B, 0x6E,
-    0x51, 0x84, 0x76, 0x1D, 0xF1, 0xA6, 0x52, 0x25, 0x61, 0x63, 0xDF, 0x07, 0xDA, 0x6D, 0xA6, 0x25,
-    0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8D, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42, 0xFC, 0x99, 0x40, 0x2E,
-    0x4C, 0x2D, 0xCB, 0x7A, 0x41, 0x45, 0x83, 0xA0, 0x42, 0x76, 0x89, 0x1A, 0x4C, 0x5F, 0xD1, 0x06,
-    0x0D, 0x1D, 0xEB, 0x78, 0x00, 0x65, 0x90, 0x94, 0x0F, 0x6F, 0xF4, 0x16, 0xDF, 0x21, 0xB0, 0x38,
-    0x63, 0x39, 0xEE, 0x86, 0xDF, 0x4D, 0xB4, 0x31, 0x4E, 0x41, 0xDD, 0x84, 0x10, 0x42, 0xFF, 0x05,
-    0x23, 0x5E, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B,
-    0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x42, 0x0F, 0x78, 0xAA, 0x9E, 0x0F, 0x49, 0xA4, 0x9C, 0x19, 0x07,
-    0xA9, 0x44, 0x05, 0x5E, 0x9D, 0x9A, 0x08, 0x1C, 0x9C, 0x50, 0x00, 0x58, 0x79, 0x44, 0x71, 0x6C,
-    0x71, 0x87, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14, 0x70, 0x65, 0x17, 0x77, 0xA2, 0xFF, 0x91, 0x9E,
-    0xB5, 0xFB, 0x93, 0x2C, 0xA0, 0x87, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x46, 0xA5, 0xF8, 0xA6, 0x01,
-    0xA3, 0x80, 0x99, 0x7F, 0x3C, 0x56, 0x30, 0x71, 0x59, 0x75, 0x25, 0x56, 0x54, 0x4B, 0x78, 0x7D,
-    0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x95, 0x37, 0x1B, 0x55, 0x6F, 0x7C, 0x18, 0x7F, 0x6C, 0x32, 0x92,
-    0x93, 0x91, 0x1F, 0x08, 0x92, 0x4E, 0x18, 0x6A, 0x7B, 0xF6, 0xAC, 0x3D, 0x48, 0xAC, 0xE6, 0x3C,
-    0xEA, 0xBB, 0x3D, 0x3D, 0xAF, 0xE0, 0x08, 0x41, 0xF8, 0x1B, 0x1E, 0xC1, 0x3C, 0xFB, 0x9D, 0x40,
-    0x73, 0x61, 0x6C, 0x75, 0x74, 0x65, 0x30, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x79, 0x3D, 0xD4, 0x41, 0x86, 0x34, 0xEE, 0x56, 0x9B, 0x33, 0xE4, 0x56, 0x70, 0x2A, 0xD6, 0x7A,
-    0x80, 0x1D, 0xFB, 0x7A, 0xA2, 0x1C, 0xEB, 0x62, 0x71, 0x51, 0xDB, 0x11, 0x81, 0x43, 0xFF, 0x08,
-    0xA3, 0x42, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C,
-    0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A,
-    0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5E, 0x91, 0x20, 0xD5, 0x28, 0x8B, 0x68, 0xD7, 0x31, 0x9A, 0x87,
-    0xD7, 0x4C, 0x9D, 0x0A, 0xD3, 0x55, 0x81, 0x4E, 0xD3, 0x3A, 0x7F, 0x58, 0xF7, 0x28, 0x7A, 0x62,
-    0xF9, 0x31, 0x89, 0x8C, 0xFA, 0x4C, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47,
-    0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x40, 0x70, 0x5F, 0x1B, 0xD7, 0x7A,
-    0xD8, 0x0C, 0x9B, 0x6E, 0x51, 0x85, 0x76, 0x1D, 0xF1, 0xA6, 0x52, 0x25, 0x61, 0x63, 0xDF, 0x07,
-    0xDA, 0x6D, 0xA6, 0x25, 0xE6, 0x2E, 0x24, 0x59, 0xE8, 0x8D, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42,
-    0xFC, 0x99, 0x40, 0x2E, 0x4C, 0x2E, 0xCB, 0x7A, 0x41, 0x45, 0x83, 0xA0, 0x42, 0x76, 0x89, 0x1A,
-    0x4C, 0x5F, 0xD1, 0x06, 0x0D, 0x1E, 0xEB, 0x78, 0x00, 0x65, 0x90, 0x94, 0x0F, 0x6F, 0xF4, 0x16,
-    0xDF, 0x21, 0xB0, 0x38, 0x63, 0x3A, 0xEE, 0x05, 0xDF, 0x4D, 0xB4, 0x31, 0x4E, 0x42, 0xDD, 0x84,
-    0x10, 0x42, 0xFF, 0x05, 0x23, 0x5E, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60,
-    0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x42, 0x0F, 0x78, 0xAA, 0x9E, 0x0F, 0x49,
-    0xA4, 0x9C, 0x19, 0x07, 0xA9, 0x44, 0x05, 0x5E, 0x9D, 0x9A, 0x08, 0x1C, 0x9C, 0x50, 0x00, 0x58,
-    0x79, 0x44, 0x71, 0x6C, 0x71, 0x86, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14, 0x70, 0x65, 0x17, 0x77,
-    0xA2, 0xFF, 0x91, 0x9E, 0xB5, 0xFB, 0x93, 0x2C, 0xA0, 0x87, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x46,
-    0xA5, 0xF8, 0xA6, 0x01, 0xA3, 0x80, 0x99, 0x7F, 0x3C, 0x56, 0x30, 0x71, 0x59, 0x75, 0x25, 0x56,
-    0x54, 0x4B, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x95, 0x37, 0x1B, 0x55, 0x6F, 0x7C, 0x18,
-    0x7F, 0x6C, 0x32, 0x8E, 0x93, 0x91, 0x1F, 0x08, 0x92, 0x4E, 0x18, 0x6A, 0x7A, 0xF6, 0xAC, 0x3D,
-    0xA5, 0x84, 0xE5, 0x3C, 0x08, 0xAC, 0x3D, 0x3D, 0x80, 0x7B, 0x08, 0x41, 0x4D, 0x80, 0x1D, 0xC1,
-    0x21, 0x18, 0xA7, 0x40, 0x73, 0x61, 0x6C, 0x75, 0x74, 0x65, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x79, 0x3B, 0xD4, 0x41, 0x86, 0x31, 0xEE, 0x56, 0x9B, 0x31, 0xE4, 0x56,
-    0x70, 0x28, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A, 0xA2, 0x1A, 0xEA, 0x62, 0x71, 0x4F, 0xDB, 0x11,
-    0x81, 0x40, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68,
-    0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B,
-    0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x27, 0x8B, 0x68,
-    0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x39, 0x7E, 0x58,
-    0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29,
-    0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70,
-    0x5F, 0x19, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1A, 0xF1, 0xA7, 0x52, 0x25,
-    0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2F, 0x4F,
-    0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x44, 0x83, 0xA0,
-    0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5D, 0xD1, 0x06, 0x0D, 0x1B, 0xEB, 0x78, 0x00, 0x64, 0x90, 0x94,
-    0x0F, 0x6D, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38, 0x63, 0x37, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31,
-    0x4E, 0x3F, 0xDD, 0x84, 0x10, 0x3F, 0xFF, 0x05, 0x23, 0x5D, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26,
-    0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78,
-    0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9C, 0x09, 0x1C,
-    0x9C, 0x51, 0x00, 0x58, 0x79, 0x43, 0x71, 0x6C, 0x71, 0x88, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14,
-    0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E, 0xB5, 0xFB, 0x94, 0x2C, 0xA0, 0x86, 0x84, 0x94,
-    0xB3, 0x83, 0x86, 0x3F, 0xA5, 0xF8, 0xA7, 0x01, 0xA3, 0x7F, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71,
-    0x59, 0x76, 0x25, 0x56, 0x54, 0x4A, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B,
-    0x55, 0x6E, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A,
-    0x7B, 0xF6, 0xAC, 0x3D, 0x1F, 0x37, 0x03, 0x3D, 0x5C, 0x21, 0x3D, 0x3D, 0x54, 0x95, 0x17, 0x41,
-    0x09, 0x31, 0x30, 0xC1, 0x1A, 0xB8, 0xD1, 0x40, 0x73, 0x61, 0x6C, 0x75, 0x74, 0x65, 0x30, 0x37,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x7A, 0xD4, 0x42, 0x86, 0x7F, 0xEF, 0x60,
-    0x9B, 0x7A, 0xE5, 0x60, 0x70, 0x6C, 0xDA, 0x78, 0x80, 0x72, 0xFF, 0x79, 0xA2, 0x6A, 0xF0, 0x70,
-    0x71, 0x8E, 0xD6, 0x15, 0x81, 0x94, 0xFB, 0x24, 0xA3, 0x8C, 0xEC, 0x48, 0xE0, 0x5D, 0x63, 0x1C,
-    0xE0, 0x47, 0x66, 0x6A, 0xE1, 0x53, 0x6C, 0x0A, 0xDF, 0x50, 0x5D, 0x58, 0xFE, 0x3F, 0x58, 0x62,
-    0xFF, 0x4C, 0x5E, 0x3B, 0xFE, 0x55, 0x56, 0x2B, 0xFD, 0x48, 0x4F, 0x56, 0xD6, 0x75, 0x8D, 0x1E,
-    0xD5, 0x46, 0x93, 0x6B, 0xD7, 0x54, 0x9F, 0x86, 0xD7, 0x6C, 0x9C, 0x08, 0xD3, 0x66, 0x81, 0x53,
-    0xD3, 0x4F, 0x84, 0x5B, 0xF7, 0x3D, 0x83, 0x62, 0xF9, 0x4C, 0x8F, 0x8C, 0xFA, 0x64, 0x8D, 0x32,
-    0xF8, 0x6C, 0x7E, 0x3D, 0xF6, 0x5E, 0x71, 0x48, 0xF5, 0x46, 0x74, 0x5E, 0x50, 0x49, 0x73, 0x9F,
-    0xEE, 0x00, 0x54, 0x6E, 0x5F, 0x60, 0xDE, 0x79, 0xD8, 0x36, 0xA8, 0x8A, 0x51, 0x88, 0x6C, 0x9E,
-    0xF1, 0x93, 0x43, 0x2C, 0x61, 0x9F, 0xD7, 0x17, 0xDA, 0x8C, 0x9E, 0x2C, 0xE6, 0x19, 0x30, 0x5D,
-    0xE8, 0x6D, 0x27, 0x56, 0xFA, 0x09, 0x42, 0x66, 0xFC, 0x7F, 0x35, 0x29, 0x4C, 0x69, 0xCF, 0x79,
-    0x41, 0x5A, 0x86, 0x72, 0x42, 0x85, 0x81, 0x9E, 0x4C, 0x95, 0xCA, 0x21, 0x0D, 0x6B, 0xF0, 0x83,
-    0x00, 0x7A, 0x8B, 0x94, 0x0F, 0xB3, 0xE8, 0x1B, 0xDF, 0x52, 0xB7, 0x39, 0x63, 0x84, 0xED, 0x05,
-    0xDF, 0x78, 0xB3, 0x2F, 0x4E, 0x82, 0xDB, 0x02, 0x10, 0x93, 0xFB, 0x09, 0x23, 0x77, 0x90, 0x52,
-    0xBD, 0x85, 0x39, 0x47, 0xBA, 0x16, 0x45, 0x5C, 0xB5, 0x87, 0x3C, 0x1A, 0xB2, 0x18, 0x49, 0x7A,
-    0xA2, 0x1F, 0x18, 0x83, 0xAA, 0x6C, 0x06, 0x4B, 0xA4, 0x6F, 0x0F, 0x22, 0xA9, 0x1C, 0x0F, 0x61,
-    0x9D, 0x65, 0x00, 0x4F, 0x9C, 0x23, 0x07, 0x5B, 0x79, 0x50, 0x75, 0x88, 0x71, 0x5E, 0x16, 0x1A,
-    0x7A, 0x76, 0x71, 0x1B, 0x70, 0x40, 0x19, 0x78, 0xA2, 0xFA, 0x6D, 0x51, 0xB5, 0xF8, 0x6F, 0x28,
-    0xA0, 0x91, 0x79, 0x94, 0xB3, 0x8E, 0x7B, 0x46, 0xA5, 0xFF, 0x82, 0x03, 0xA3, 0x95, 0x8E, 0x01,
-    0x3C, 0x40, 0x33, 0x73, 0x59, 0x54, 0x23, 0x60, 0x54, 0x59, 0x7A, 0x7C, 0x71, 0x62, 0x6B, 0x46,
-    0x3D, 0x77, 0x2D, 0x1A, 0x55, 0x79, 0x77, 0x16, 0x7F, 0x53, 0x31, 0x8E, 0x93, 0x68, 0x17, 0x23,
-    0x92, 0x2E, 0x1E, 0x82, 0x7A, 0xF6, 0xAC, 0x3D, 0xFA, 0xCF, 0x01, 0x3D, 0x68, 0x41, 0x3D, 0x3D,
-    0x1C, 0x8F, 0x0F, 0x41, 0x1C, 0x8D, 0x2E, 0xC1, 0x43, 0xF8, 0xC9, 0x40, 0x73, 0x61, 0x6C, 0x75,
-    0x74, 0x65, 0x30, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x75, 0xD4, 0x42,
-    0x86, 0x78, 0xEF, 0x54, 0x9B, 0x73, 0xE5, 0x60, 0x70, 0x65, 0xDA, 0x78, 0x80, 0x6A, 0xFF, 0x79,
-    0xA2, 0x62, 0xF0, 0x70, 0x71, 0x88, 0xD7, 0x15, 0x81, 0x8C, 0xFC, 0x23, 0xA3, 0x85, 0xED, 0x47,
-    0xE0, 0x5D, 0x63, 0x1C, 0xE0, 0x46, 0x65, 0x6A, 0xE1, 0x53, 0x6B, 0x0A, 0xDF, 0x50, 0x5D, 0x58,
-    0xFE, 0x3F, 0x57, 0x62, 0xFF, 0x4C, 0x5E, 0x3B, 0xFE, 0x56, 0x55, 0x2B, 0xFD, 0x49, 0x4F, 0x56,
-    0xD6, 0x73, 0x8D, 0x1E, 0xD5, 0x43, 0x92, 0x6B, 0xD7, 0x51, 0x9E, 0x86, 0xD7, 0x69, 0x9C, 0x08,
-    0xD3, 0x65, 0x81, 0x53, 0xD3, 0x4D, 0x83, 0x5B, 0xF7, 0x3B, 0x82, 0x62, 0xF9, 0x49, 0x8F, 0x8C,
-    0xFA, 0x61, 0x8D, 0x32, 0xF8, 0x6B, 0x7E, 0x3D, 0xF6, 0x5D, 0x71, 0x48, 0xF5, 0x45, 0x73, 0x5E,
-    0x50, 0x48, 0x72, 0x9F, 0xEE, 0x00, 0x51, 0x6E, 0x5F, 0x59, 0xDD, 0x79, 0xD8, 0x32, 0xA7, 0x8A,
-    0x51, 0x88, 0x6D, 0x9E, 0xF1, 0x95, 0x44, 0x2C, 0x61, 0x99, 0xD8, 0x17, 0xDA, 0x89, 0x9F, 0x2C,
-    0xE6, 0x1B, 0x2E, 0x5D, 0xE8, 0x70, 0x27, 0x56, 0xFA, 0x0A, 0x40, 0x66, 0xFC, 0x82, 0x35, 0x29,
-    0x4C, 0x63, 0xCF, 0x79, 0x41, 0x58, 0x85, 0x9F, 0x42, 0x84, 0x82, 0x9E, 0x4C, 0x90, 0xCB, 0x21,
-    0x0D, 0x64, 0xF0, 0x83, 0x00, 0x79, 0x8B, 0x94, 0x0F, 0xAD, 0xEA, 0x1B, 0xDF, 0x4D, 0xB6, 0x38,
-    0x63, 0x7D, 0xEE, 0x05, 0xDF, 0x74, 0xB3, 0x2F, 0x4E, 0x7C, 0xDC, 0x02, 0x10, 0x8B, 0xFC, 0x04,
-    0x23, 0x74, 0x90, 0x52, 0xBD, 0x88, 0x3A, 0x47, 0xBA, 0x17, 0x43, 0x5C, 0xB5, 0x8A, 0x3D, 0x1A,
-    0xB2, 0x19, 0x47, 0x73, 0xA2, 0x23, 0x16, 0x83, 0xAA, 0x71, 0x06, 0x4B, 0xA4, 0x74, 0x0F, 0x21,
-    0xA9, 0x20, 0x0D, 0x5C, 0x9D, 0x6B, 0x00, 0x4F, 0x9C, 0x28, 0x06, 0x5B, 0x79, 0x4F, 0x74, 0x88,
-    0x71, 0x62, 0x16, 0x1A, 0x7A, 0x76, 0x71, 0x1B, 0x70, 0x44, 0x18, 0x76, 0xA2, 0xFC, 0x70, 0x4E,
-    0xB5, 0xF9, 0x73, 0x28, 0xA0, 0x90, 0x7A, 0x94, 0xB3, 0x8E, 0x7C, 0x46, 0xA5, 0xFF, 0x86, 0x03,
-    0xA3, 0x93, 0x8F, 0x02, 0x3C, 0x42, 0x32, 0x73, 0x59, 0x58, 0x23, 0x55, 0x54, 0x58, 0x7A, 0x7C,
-    0x71, 0x62, 0x6B, 0x46, 0x3D, 0x7B, 0x2D, 0x1A, 0x55, 0x78, 0x77, 0x16, 0x7F, 0x56, 0x30, 0x8E,
-    0x93, 0x6D, 0x17, 0x23, 0x92, 0x31, 0x1D, 0x88, 0x7B, 0xF6, 0xAC, 0x3D, 0xDD, 0x3D, 0xFB, 0x3C,
-    0x64, 0x69, 0x3C, 0x3D, 0xC6, 0x83, 0xF2, 0x40, 0x83, 0x53, 0x1D, 0xC1, 0xBB, 0xF5, 0xC3, 0x40,
-    0x73, 0x61, 0x6C, 0x75, 0x74, 0x65, 0x30, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x79, 0x66, 0xD5, 0x43, 0x86, 0x65, 0xF0, 0x54, 0x9B, 0x62, 0xE6, 0x54, 0x70, 0x55, 0xD9, 0x78,
-    0x80, 0x55, 0xFF, 0x79, 0xA2, 0x4F, 0xEF, 0x69, 0x71, 0x79, 0xD9, 0x15, 0x81, 0x78, 0xFE, 0x23,
-    0xA3, 0x73, 0xEE, 0x47, 0xE0, 0x5D, 0x62, 0x1E, 0xE0, 0x45, 0x63, 0x6B, 0xE1, 0x51, 0x6A, 0x0E,
-    0xDF, 0x51, 0x5B, 0x59, 0xFE, 0x40, 0x54, 0x62, 0xFF, 0x4C, 0x5C, 0x3B, 0xFE, 0x58, 0x54, 0x2A,
-    0xFD, 0x4C, 0x4D, 0x56, 0xD6, 0x6E, 0x8E, 0x1E, 0xD5, 0x3C, 0x8F, 0x6B, 0xD7, 0x49, 0x9D, 0x86,
-    0xD7, 0x62, 0x9C, 0x08, 0xD3, 0x61, 0x80, 0x53, 0xD3, 0x48, 0x81, 0x5B, 0xF7, 0x36, 0x7F, 0x62,
-    0xF9, 0x43, 0x8D, 0x8C, 0xFA, 0x5C, 0x8C, 0x32, 0xF8, 0x68, 0x7E, 0x3D, 0xF6, 0x5B, 0x70, 0x48,
-    0xF5, 0x42, 0x71, 0x5F, 0x50, 0x45, 0x70, 0x9F, 0xEE, 0x00, 0x4A, 0x6D, 0x5F, 0x48, 0xDC, 0x79,
-    0xD8, 0x28, 0xA3, 0x6E, 0x51, 0x88, 0x6F, 0x1D, 0xF1, 0x9B, 0x47, 0x2C, 0x61, 0x8B, 0xDB, 0x17,
-    0xDA, 0x82, 0xA1, 0x25, 0xE6, 0x21, 0x29, 0x5D, 0xE8, 0x79, 0x27, 0x56, 0xFA, 0x0C, 0x3A, 0x66,
-    0xFC, 0x8A, 0x37, 0x29, 0x4C, 0x55, 0xCE, 0x7A, 0x41, 0x53, 0x84, 0x9F, 0x42, 0x81, 0x83, 0x9E,
-    0x4C, 0x83, 0xCD, 0x21, 0x0D, 0x50, 0xF0, 0x78, 0x00, 0x74, 0x8C, 0x94, 0x0F, 0x9D, 0xEE, 0x16,
-    0xDF, 0x41, 0xB4, 0x38, 0x63, 0x6A, 0xEF, 0x05, 0xDF, 0x6A, 0xB4, 0x32, 0x4E, 0x6C, 0xDD, 0x02,
-    0x10, 0x77, 0xFE, 0x04, 0x23, 0x6F, 0x91, 0x52, 0xBD, 0x8F, 0x3B, 0x47, 0xBA, 0x1A, 0x3E, 0x5E,
-    0xB5, 0x91, 0x3F, 0x1A, 0xB2, 0x1B, 0x42, 0x73, 0xA2, 0x2C, 0x12, 0x78, 0xAA, 0x7F, 0x07, 0x4B,
-    0xA4, 0x80, 0x10, 0x17, 0xA9, 0x2B, 0x08, 0x5C, 0x9D, 0x79, 0x00, 0x4D, 0x9C, 0x34, 0x01, 0x5B,
-    0x79, 0x4D, 0x73, 0x88, 0x71, 0x6D, 0x15, 0x1A, 0x7A, 0x75, 0x72, 0x1B, 0x70, 0x4E, 0x16, 0x76,
-    0xA2, 0xFE, 0x7A, 0x4E, 0xB5, 0xFC, 0x7C, 0x28, 0xA0, 0x8E, 0x7C, 0x94, 0xB3, 0x8C, 0x7E, 0x46,
-    0xA5, 0xFF, 0x8F, 0x03, 0xA3, 0x8F, 0x92, 0x02, 0x3C, 0x49, 0x30, 0x73, 0x59, 0x61, 0x21, 0x55,
-    0x54, 0x55, 0x79, 0x7C, 0x71, 0x61, 0x6B, 0x46, 0x3D, 0x83, 0x2E, 0x1B, 0x55, 0x77, 0x78, 0x16,
-    0x7F, 0x5D, 0x2F, 0x8E, 0x93, 0x78, 0x18, 0x23, 0x92, 0x3A, 0x19, 0x6A, 0x7A, 0xF6, 0xAC, 0x3D,
-    0x54, 0x02, 0xF1, 0x3C, 0xAF, 0x7A, 0x3D, 0x3D, 0xF8, 0x70, 0x45, 0x40, 0x70, 0xDF, 0x23, 0xC1,
-    0x70, 0xB9, 0x9D, 0x40, 0x73, 0x61, 0x6C, 0x75, 0x74, 0x65, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x79, 0x50, 0xD5, 0x43, 0x86, 0x4B, 0xEF, 0x54, 0x9B, 0x49, 0xE5, 0x54,
-    0x70, 0x3F, 0xD8, 0x7A, 0x80, 0x37, 0xFD, 0x7A, 0xA2, 0x34, 0xED, 0x69, 0x71, 0x64, 0xDA, 0x11,
-    0x81, 0x5C, 0xFF, 0x23, 0xA3, 0x59, 0xEF, 0x26, 0xE0, 0x5C, 0x63, 0x1E, 0xE0, 0x44, 0x61, 0x6B,
-    0xE1, 0x4F, 0x69, 0x0E, 0xDF, 0x51, 0x5B, 0x59, 0xFE, 0x41, 0x53, 0x65, 0xFF, 0x4C, 0x5B, 0x8B,
-    0xFE, 0x59, 0x54, 0x2A, 0xFD, 0x4E, 0x4C, 0x56, 0xD6, 0x66, 0x8F, 0x20, 0xD5, 0x32, 0x8D, 0x68,
-    0xD7, 0x3D, 0x9B, 0x86, 0xD7, 0x56, 0x9C, 0x0A, 0xD3, 0x5B, 0x81, 0x4E, 0xD3, 0x41, 0x7F, 0x58,
-    0xF7, 0x2F, 0x7C, 0x62, 0xF9, 0x39, 0x8B, 0x8C, 0xFA, 0x53, 0x8C, 0x31, 0xF8, 0x62, 0x7F, 0x29,
-    0xF6, 0x58, 0x70, 0x47, 0xF5, 0x3E, 0x6F, 0x5F, 0x50, 0x41, 0x6F, 0x9F, 0xEE, 0x00, 0x44, 0x6D,
-    0x5F, 0x31, 0xDA, 0x79, 0xD8, 0x19, 0x9F, 0x6E, 0x51, 0x86, 0x72, 0x1D, 0xF1, 0xA1, 0x4C, 0x2C,
-    0x61, 0x76, 0xDD, 0x06, 0xDA, 0x77, 0xA4, 0x25, 0xE6, 0x28, 0x26, 0x5D, 0xE8, 0x84, 0x2A, 0x4F,
-    0xFA, 0x10, 0x34, 0x66, 0xFC, 0x92, 0x3B, 0x2E, 0x4C, 0x40, 0xCD, 0x7A, 0x41, 0x4C, 0x83, 0x9F,
-    0x42, 0x7B, 0x86, 0x9E, 0x4C, 0x70, 0xCF, 0x06, 0x0D, 0x36, 0xEE, 0x78, 0x00, 0x6C, 0x8E, 0x94,
-    0x0F, 0x85, 0xF2, 0x16, 0xDF, 0x31, 0xB2, 0x38, 0x63, 0x51, 0xEF, 0x05, 0xDF, 0x5B, 0xB4, 0x32,
-    0x4E, 0x56, 0xDD, 0x84, 0x10, 0x5B, 0xFF, 0x04, 0x23, 0x66, 0x92, 0x52, 0xBD, 0x97, 0x40, 0x1C,
-    0xBA, 0x1D, 0x3A, 0x5E, 0xB5, 0x98, 0x44, 0x1A, 0xB2, 0x1E, 0x3E, 0x73, 0xA2, 0x38, 0x0F, 0x78,
-    0xAA, 0x8F, 0x0B, 0x49, 0xA4, 0x8F, 0x14, 0x17, 0xA9, 0x38, 0x06, 0x5C, 0x9D, 0x8A, 0x04, 0x4D,
-    0x9C, 0x42, 0x00, 0x58, 0x79, 0x48, 0x72, 0x6C, 0x71, 0x7B, 0x18, 0x1A, 0x7A, 0x72, 0x74, 0x14,
-    0x70, 0x5A, 0x16, 0x77, 0xA2, 0xFF, 0x86, 0x4E, 0xB5, 0xFC, 0x88, 0x2C, 0xA0, 0x8B, 0x80, 0x94,
-    0xB3, 0x87, 0x82, 0x46, 0xA5, 0xFC, 0x9C, 0x01, 0xA3, 0x87, 0x95, 0x02, 0x3C, 0x50, 0x2F, 0x71,
-    0x59, 0x6C, 0x23, 0x55, 0x54, 0x50, 0x78, 0x7D, 0x71, 0x5F, 0x6B, 0x46, 0x3D, 0x8D, 0x32, 0x1B,
-    0x55, 0x73, 0x7A, 0x18, 0x7F, 0x65, 0x30, 0x8E, 0x93, 0x85, 0x1B, 0x23, 0x92, 0x45, 0x18, 0x6A,
-    0x7A, 0xF6, 0xAC, 0x3D, 0xC3, 0x89, 0xE5, 0x3C, 0x57, 0xAC, 0x3D, 0x3D, 0x20, 0x0E, 0xCA, 0xBF,
-    0xFB, 0x82, 0x1D, 0xC1, 0xBB, 0x9D, 0x81, 0x40, 0x73, 0x61, 0x6C, 0x75, 0x74, 0x65, 0x31, 0x31,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3B, 0xD4, 0x41, 0x86, 0x31, 0xEE, 0x56,
-    0x9B, 0x31, 0xE4, 0x56, 0x70, 0x28, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A, 0xA2, 0x1A, 0xEA, 0x62,
-    0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20,
-    0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63,
-    0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20,
-    0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E,
-    0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31,
-    0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58,
-    0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x19, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1A,
-    0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59,
-    0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A,
-    0x41, 0x44, 0x83, 0xA0, 0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5D, 0xD1, 0x06, 0x0D, 0x1B, 0xEB, 0x78,
-    0x00, 0x64, 0x90, 0x94, 0x0F, 0x6D, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38, 0x63, 0x37, 0xEE, 0x86,
-    0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x3F, 0xDD, 0x84, 0x10, 0x3F, 0xFF, 0x05, 0x23, 0x5D, 0x94, 0x51,
-    0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71,
-    0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E,
-    0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58, 0x79, 0x43, 0x71, 0x6C, 0x71, 0x88, 0x1B, 0x1B,
-    0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E, 0xB5, 0xFB, 0x94, 0x2C,
-    0xA0, 0x86, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x3F, 0xA5, 0xF8, 0xA7, 0x01, 0xA3, 0x7F, 0x99, 0x7F,
-    0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56, 0x54, 0x4A, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F,
-    0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6E, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08,
-    0x92, 0x4F, 0x18, 0x6A, 0x3B, 0x60, 0xAB, 0x3D, 0xC8, 0xC9, 0xF2, 0x3C, 0x57, 0xEC, 0x43, 0x3D,
-    0x2E, 0x3D, 0x14, 0xC0, 0x13, 0xAD, 0x27, 0xC1, 0x97, 0xE4, 0x7D, 0x40, 0x74, 0x61, 0x75, 0x6E,
-    0x74, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x4E, 0xCF, 0x41,
-    0x87, 0x42, 0xE8, 0x56, 0x9C, 0x3E, 0xDD, 0x56, 0x70, 0x3E, 0xD2, 0x77, 0x82, 0x2D, 0xF4, 0x7A,
-    0xA3, 0x26, 0xE2, 0x61, 0x72, 0x62, 0xD6, 0x11, 0x83, 0x51, 0xF8, 0x2D, 0xA5, 0x4A, 0xE7, 0x26,
-    0xE0, 0x58, 0x5C, 0x20, 0xDF, 0x40, 0x5A, 0x68, 0xE1, 0x4A, 0x62, 0x0C, 0xDF, 0x4F, 0x54, 0x52,
-    0xFD, 0x3A, 0x4A, 0x63, 0xFF, 0x43, 0x52, 0x8B, 0xFE, 0x52, 0x4D, 0x2A, 0xFD, 0x49, 0x44, 0x48,
-    0xD7, 0x5C, 0x89, 0x20, 0xD4, 0x2A, 0x83, 0x68, 0xD7, 0x31, 0x91, 0x87, 0xD8, 0x4B, 0x94, 0x0A,
-    0xD4, 0x54, 0x7A, 0x4E, 0xD3, 0x3B, 0x77, 0x58, 0xF7, 0x23, 0x71, 0x62, 0xF9, 0x2A, 0x7F, 0x8C,
-    0xFA, 0x43, 0x82, 0x31, 0xF9, 0x55, 0x76, 0x29, 0xF6, 0x4D, 0x68, 0x47, 0xF5, 0x34, 0x65, 0x55,
-    0x4F, 0x59, 0x6F, 0x58, 0xEB, 0x00, 0x38, 0x6D, 0x5F, 0x33, 0xD4, 0x7A, 0xD7, 0x0E, 0x92, 0x6D,
-    0x52, 0x9C, 0x77, 0x1F, 0xF3, 0x9D, 0x4B, 0x2A, 0x62, 0x77, 0xDC, 0x07, 0xDC, 0x69, 0x9D, 0x25,
-    0xE4, 0x2E, 0x1E, 0x59, 0xE8, 0x87, 0x29, 0x4F, 0xF8, 0x10, 0x2A, 0x5F, 0xFE, 0x8E, 0x38, 0x33,
-    0x4C, 0x49, 0xC9, 0x7A, 0x40, 0x63, 0x84, 0xA0, 0x43, 0x91, 0x8A, 0x1D, 0x4E, 0x77, 0xCF, 0x06,
-    0x0D, 0x45, 0xEC, 0x78, 0x00, 0x8E, 0x94, 0x94, 0x11, 0x92, 0xF5, 0x16, 0xDF, 0x20, 0xA6, 0x38,
-    0x64, 0x4F, 0xEA, 0x86, 0xE1, 0x49, 0xAB, 0x31, 0x4F, 0x5B, 0xDB, 0x84, 0x11, 0x67, 0xFF, 0x05,
-    0x24, 0x80, 0x96, 0x51, 0xBE, 0x9F, 0x41, 0x26, 0xB8, 0x29, 0x33, 0x60, 0xB6, 0xA1, 0x46, 0x1B,
-    0xB0, 0x2A, 0x38, 0x72, 0xA0, 0x4F, 0x0E, 0x78, 0xAB, 0xA4, 0x0F, 0x49, 0xA4, 0xA4, 0x18, 0x06,
-    0xA7, 0x4F, 0x04, 0x5D, 0x9D, 0xA3, 0x08, 0x1C, 0x9A, 0x5D, 0x00, 0x58, 0x79, 0x57, 0x70, 0x6C,
-    0x70, 0x99, 0x1D, 0x1B, 0x7B, 0x7F, 0x75, 0x16, 0x6F, 0x7A, 0x19, 0x75, 0xA7, 0xFF, 0x8D, 0x9E,
-    0xBA, 0xF8, 0x8E, 0x2C, 0xA2, 0x8E, 0x7F, 0x94, 0xB5, 0x86, 0x80, 0x46, 0xAA, 0xF8, 0xA1, 0x04,
-    0xA5, 0x86, 0x94, 0x02, 0x3A, 0x76, 0x34, 0x9F, 0x58, 0x8E, 0x28, 0x56, 0x54, 0x65, 0x79, 0x7D,
-    0x71, 0x70, 0x6B, 0x43, 0x3D, 0xB1, 0x3B, 0x1B, 0x55, 0x87, 0x7D, 0x18, 0x7E, 0x7D, 0x32, 0x8E,
-    0x93, 0x9C, 0x1F, 0x2D, 0x90, 0x5E, 0x17, 0x6B, 0x24, 0x0E, 0xAC, 0x3D, 0x21, 0x4A, 0xEE, 0x3C,
-    0x84, 0xBD, 0x41, 0x3D, 0x71, 0x58, 0x00, 0xC0, 0xB6, 0x25, 0x24, 0xC1, 0xB1, 0x04, 0x67, 0x40,
-    0x74, 0x61, 0x75, 0x6E, 0x74, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7A, 0x48, 0xD1, 0x43, 0x86, 0x3C, 0xEA, 0x56, 0x9B, 0x39, 0xDF, 0x56, 0x70, 0x37, 0xD3, 0x77,
-    0x81, 0x27, 0xF6, 0x7A, 0xA3, 0x22, 0xE5, 0x61, 0x72, 0x5C, 0xD8, 0x11, 0x82, 0x4C, 0xFB, 0x2D,
-    0xA4, 0x47, 0xE9, 0x26, 0xE0, 0x59, 0x5F, 0x1E, 0xDF, 0x41, 0x5C, 0x68, 0xE1, 0x4A, 0x65, 0x0C,
-    0xDF, 0x4F, 0x56, 0x52, 0xFD, 0x3D, 0x4D, 0x63, 0xFF, 0x46, 0x55, 0x8B, 0xFE, 0x55, 0x4F, 0x2A,
-    0xFD, 0x4B, 0x47, 0x48, 0xD6, 0x5C, 0x8B, 0x20, 0xD5, 0x29, 0x85, 0x68, 0xD7, 0x31, 0x94, 0x87,
-    0xD8, 0x4B, 0x97, 0x0A, 0xD4, 0x54, 0x7D, 0x4E, 0xD3, 0x3B, 0x7A, 0x58, 0xF7, 0x24, 0x74, 0x63,
-    0xF9, 0x2C, 0x82, 0x8C, 0xFA, 0x46, 0x86, 0x0B, 0xF9, 0x58, 0x7A, 0x29, 0xF6, 0x4F, 0x6B, 0x47,
-    0xF5, 0x36, 0x68, 0x55, 0x4F, 0x4F, 0x6E, 0x58, 0xEC, 0x00, 0x3A, 0x6D, 0x5F, 0x2B, 0xD5, 0x7A,
-    0xD8, 0x0D, 0x95, 0x6E, 0x52, 0x94, 0x76, 0x1F, 0xF2, 0xA0, 0x4D, 0x25, 0x62, 0x6F, 0xDD, 0x07,
-    0xDB, 0x6A, 0xA0, 0x25, 0xE5, 0x2E, 0x20, 0x59, 0xE8, 0x8A, 0x2B, 0x4F, 0xF8, 0x11, 0x2C, 0x5F,
-    0xFD, 0x92, 0x3B, 0x33, 0x4C, 0x3F, 0xCA, 0x7A, 0x41, 0x58, 0x84, 0xA0, 0x42, 0x87, 0x8A, 0x1D,
-    0x4D, 0x6F, 0xD0, 0x06, 0x0D, 0x37, 0xEC, 0x78, 0x00, 0x80, 0x93, 0x94, 0x10, 0x86, 0xF5, 0x16,
-    0xDF, 0x20, 0xA9, 0x38, 0x63, 0x47, 0xEB, 0x86, 0xE0, 0x4A, 0xAE, 0x31, 0x4F, 0x52, 0xDB, 0x84,
-    0x11, 0x59, 0xFF, 0x05, 0x24, 0x74, 0x95, 0x51, 0xBE, 0x9F, 0x43, 0x26, 0xB9, 0x26, 0x34, 0x60,
-    0xB5, 0xA0, 0x47, 0x1B, 0xB1, 0x27, 0x39, 0x72, 0xA1, 0x4B, 0x0E, 0x78, 0xAA, 0xA2, 0x0F, 0x49,
-    0xA4, 0xA2, 0x18, 0x06, 0xA7, 0x4C, 0x05, 0x5E, 0x9D, 0xA1, 0x08, 0x1C, 0x9B, 0x59, 0x00, 0x58,
-    0x79, 0x50, 0x70, 0x6C, 0x70, 0x93, 0x1D, 0x1B, 0x7A, 0x7A, 0x75, 0x16, 0x6F, 0x73, 0x19, 0x77,
-    0xA5, 0xFF, 0x8F, 0x9E, 0xB9, 0xF9, 0x90, 0x2C, 0xA1, 0x8B, 0x81, 0x94, 0xB4, 0x85, 0x82, 0x46,
-    0xA9, 0xF8, 0xA3, 0x04, 0xA4, 0x84, 0x95, 0x7F, 0x3B, 0x6B, 0x33, 0x71, 0x58, 0x86, 0x27, 0x56,
-    0x54, 0x5C, 0x79, 0x7D, 0x71, 0x69, 0x6C, 0x43, 0x3D, 0xA8, 0x3A, 0x1B, 0x55, 0x7E, 0x7D, 0x18,
-    0x7E, 0x78, 0x32, 0x90, 0x93, 0x99, 0x1F, 0x2D, 0x91, 0x59, 0x17, 0x6A, 0x8C, 0x9A, 0xAC, 0x3D,
-    0xC4, 0x99, 0xE9, 0x3C, 0x59, 0x89, 0x3F, 0x3D, 0xD0, 0xD6, 0xD8, 0xBF, 0x7A, 0x97, 0x18, 0xC1,
-    0x02, 0xA7, 0x49, 0x40, 0x74, 0x61, 0x75, 0x6E, 0x74, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7A, 0x41, 0xD3, 0x41, 0x86, 0x36, 0xEC, 0x56, 0x9B, 0x35, 0xE2, 0x56,
-    0x70, 0x2F, 0xD5, 0x7A, 0x81, 0x20, 0xF9, 0x7A, 0xA2, 0x1E, 0xE8, 0x62, 0x71, 0x55, 0xD9, 0x11,
-    0x82, 0x46, 0xFD, 0x23, 0xA3, 0x43, 0xEC, 0x26, 0xE0, 0x5A, 0x62, 0x20, 0xDF, 0x41, 0x5F, 0x6B,
-    0xE1, 0x4B, 0x67, 0x0C, 0xDF, 0x50, 0x59, 0x52, 0xFE, 0x3F, 0x50, 0x63, 0xFF, 0x49, 0x58, 0x8B,
-    0xFE, 0x58, 0x52, 0x2A, 0xFD, 0x4E, 0x4A, 0x48, 0xD6, 0x5D, 0x8E, 0x20, 0xD5, 0x28, 0x88, 0x68,
-    0xD7, 0x31, 0x97, 0x87, 0xD8, 0x4B, 0x9A, 0x0A, 0xD4, 0x54, 0x7F, 0x4E, 0xD3, 0x3A, 0x7C, 0x58,
-    0xF7, 0x26, 0x77, 0x62, 0xF9, 0x2E, 0x86, 0x8C, 0xFA, 0x49, 0x89, 0x31, 0xF8, 0x5A, 0x7D, 0x29,
-    0xF6, 0x52, 0x6E, 0x47, 0xF5, 0x37, 0x6B, 0x5F, 0x50, 0x45, 0x6E, 0x58, 0xED, 0x00, 0x3D, 0x70,
-    0x5F, 0x21, 0xD6, 0x7A, 0xD8, 0x0C, 0x98, 0x6E, 0x51, 0x8C, 0x76, 0x1D, 0xF1, 0xA4, 0x50, 0x25,
-    0x61, 0x68, 0xDE, 0x07, 0xDA, 0x6C, 0xA3, 0x25, 0xE6, 0x2F, 0x22, 0x59, 0xE8, 0x8C, 0x2D, 0x4F,
-    0xF9, 0x12, 0x2F, 0x5F, 0xFD, 0x96, 0x3E, 0x2E, 0x4C, 0x35, 0xCB, 0x7A, 0x41, 0x4E, 0x84, 0xA0,
-    0x42, 0x7E, 0x89, 0x1A, 0x4D, 0x65, 0xD0, 0x06, 0x0D, 0x28, 0xEC, 0x78, 0x00, 0x71, 0x91, 0x94,
-    0x0F, 0x79, 0xF5, 0x16, 0xDF, 0x20, 0xAD, 0x38, 0x63, 0x3E, 0xED, 0x86, 0xE0, 0x4B, 0xB1, 0x31,
-    0x4E, 0x48, 0xDC, 0x84, 0x11, 0x4B, 0xFF, 0x05, 0x23, 0x68, 0x94, 0x51, 0xBD, 0x9F, 0x44, 0x26,
-    0xBA, 0x23, 0x36, 0x60, 0xB5, 0x9F, 0x48, 0x1B, 0xB2, 0x23, 0x3A, 0x72, 0xA1, 0x47, 0x0E, 0x78,
-    0xAA, 0xA1, 0x0F, 0x49, 0xA4, 0x9F, 0x19, 0x07, 0xA8, 0x48, 0x05, 0x5E, 0x9D, 0x9E, 0x08, 0x1C,
-    0x9B, 0x55, 0x00, 0x58, 0x79, 0x49, 0x71, 0x6C, 0x71, 0x8D, 0x1C, 0x1B, 0x7A, 0x74, 0x76, 0x16,
-    0x70, 0x6C, 0x18, 0x77, 0xA4, 0xFF, 0x90, 0x9E, 0xB7, 0xFA, 0x92, 0x2C, 0xA1, 0x89, 0x83, 0x94,
-    0xB4, 0x84, 0x84, 0x46, 0xA7, 0xF8, 0xA5, 0x04, 0xA4, 0x82, 0x97, 0x7F, 0x3B, 0x60, 0x31, 0x71,
-    0x59, 0x7D, 0x26, 0x56, 0x54, 0x52, 0x78, 0x7D, 0x71, 0x62, 0x6C, 0x43, 0x3D, 0x9E, 0x38, 0x1B,
-    0x55, 0x76, 0x7C, 0x18, 0x7E, 0x72, 0x32, 0x8E, 0x93, 0x95, 0x1F, 0x08, 0x92, 0x54, 0x18, 0x6A,
-    0x7E, 0xF6, 0xAC, 0x3D, 0xE4, 0x89, 0xE5, 0x3C, 0x5D, 0xAC, 0x3D, 0x3D, 0x91, 0x98, 0xC9, 0xBF,
-    0x46, 0xDB, 0x0F, 0xC1, 0x66, 0xAD, 0x22, 0x40, 0x74, 0x61, 0x75, 0x6E, 0x74, 0x30, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3B, 0xD4, 0x41, 0x86, 0x31, 0xEE, 0x56,
-    0x9B, 0x31, 0xE4, 0x56, 0x70, 0x28, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A, 0xA2, 0x1A, 0xEA, 0x62,
-    0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20,
-    0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63,
-    0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20,
-    0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E,
-    0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31,
-    0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58,
-    0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x19, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1A,
-    0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59,
-    0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A,
-    0x41, 0x44, 0x83, 0xA0, 0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5D, 0xD1, 0x06, 0x0D, 0x1B, 0xEB, 0x78,
-    0x00, 0x64, 0x90, 0x94, 0x0F, 0x6D, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38, 0x63, 0x37, 0xEE, 0x86,
-    0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x3F, 0xDD, 0x84, 0x10, 0x3F, 0xFF, 0x05, 0x23, 0x5D, 0x94, 0x51,
-    0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71,
-    0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E,
-    0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58, 0x79, 0x43, 0x71, 0x6C, 0x71, 0x88, 0x1B, 0x1B,
-    0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E, 0xB5, 0xFB, 0x94, 0x2C,
-    0xA0, 0x86, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x3F, 0xA5, 0xF8, 0xA7, 0x01, 0xA3, 0x7F, 0x99, 0x7F,
-    0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56, 0x54, 0x4A, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F,
-    0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6E, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08,
-    0x92, 0x4F, 0x18, 0x6A, 0x0C, 0xF5, 0xAC, 0x3D, 0xFD, 0xBC, 0xE5, 0x3C, 0x5C, 0xAC, 0x3D, 0x3D,
-    0xF2, 0xDD, 0x12, 0xC0, 0xDA, 0xB0, 0x12, 0xC1, 0x81, 0xAB, 0x67, 0x40, 0x74, 0x61, 0x75, 0x6E,
-    0x74, 0x30, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3C, 0xD4, 0x41,
-    0x86, 0x31, 0xEE, 0x56, 0x9A, 0x31, 0xE4, 0x56, 0x70, 0x29, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A,
-    0xA2, 0x1A, 0xEA, 0x61, 0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26,
-    0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52,
-    0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48,
-    0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A,
-    0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C,
-    0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F,
-    0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x1A, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E,
-    0x51, 0x85, 0x76, 0x1D, 0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25,
-    0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E,
-    0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x45, 0x83, 0xA0, 0x42, 0x76, 0x89, 0x1A, 0x4C, 0x5E, 0xD1, 0x06,
-    0x0D, 0x1C, 0xEB, 0x78, 0x00, 0x65, 0x90, 0x94, 0x0F, 0x6E, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38,
-    0x63, 0x37, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x40, 0xDD, 0x84, 0x10, 0x40, 0xFF, 0x05,
-    0x23, 0x5E, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B,
-    0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07,
-    0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58, 0x79, 0x44, 0x71, 0x6C,
-    0x71, 0x88, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E,
-    0xB6, 0xFB, 0x94, 0x2C, 0xA0, 0x87, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x46, 0xA6, 0xF8, 0xA7, 0x04,
-    0xA3, 0x7F, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71, 0x59, 0x77, 0x25, 0x56, 0x54, 0x4B, 0x78, 0x7D,
-    0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6F, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E,
-    0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A, 0x5F, 0xBA, 0xAC, 0x3D, 0xDD, 0x58, 0xEB, 0x3C,
-    0x5E, 0xAC, 0x3D, 0x3D, 0xD7, 0x13, 0xF0, 0xBF, 0x73, 0x1C, 0x1A, 0xC1, 0x45, 0x0C, 0x3D, 0x40,
-    0x74, 0x61, 0x75, 0x6E, 0x74, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x79, 0x44, 0xD4, 0x43, 0x85, 0x39, 0xEE, 0x56, 0x9A, 0x37, 0xE4, 0x56, 0x6F, 0x32, 0xD6, 0x7A,
-    0x80, 0x23, 0xFB, 0x7A, 0xA1, 0x20, 0xEA, 0x62, 0x70, 0x57, 0xDB, 0x11, 0x81, 0x48, 0xFF, 0x08,
-    0xA2, 0x45, 0xEF, 0x26, 0xE0, 0x5A, 0x64, 0x20, 0xDF, 0x41, 0x61, 0x68, 0xE1, 0x4B, 0x6A, 0x0C,
-    0xDF, 0x50, 0x5B, 0x52, 0xFE, 0x3E, 0x52, 0x63, 0xFF, 0x48, 0x5B, 0x8B, 0xFE, 0x57, 0x55, 0x2A,
-    0xFD, 0x4D, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20, 0xD4, 0x29, 0x8B, 0x68, 0xD7, 0x31, 0x9A, 0x87,
-    0xD7, 0x4B, 0x9D, 0x0A, 0xD4, 0x54, 0x82, 0x4E, 0xD3, 0x3A, 0x7E, 0x58, 0xF6, 0x25, 0x7A, 0x62,
-    0xF9, 0x2E, 0x89, 0x6F, 0xFA, 0x48, 0x8C, 0x31, 0xF8, 0x5A, 0x80, 0x29, 0xF6, 0x51, 0x71, 0x47,
-    0xF5, 0x37, 0x6E, 0x5F, 0x50, 0x49, 0x6E, 0x58, 0xED, 0x00, 0x3F, 0x70, 0x5F, 0x25, 0xD7, 0x7A,
-    0xD7, 0x0C, 0x9B, 0x6E, 0x52, 0x8E, 0x76, 0x1D, 0xF2, 0xA2, 0x52, 0x25, 0x61, 0x6B, 0xDF, 0x07,
-    0xDA, 0x6B, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8B, 0x2E, 0x4F, 0xF9, 0x12, 0x31, 0x66,
-    0xFD, 0x95, 0x40, 0x2E, 0x4B, 0x38, 0xCB, 0x7A, 0x41, 0x51, 0x83, 0xA0, 0x42, 0x81, 0x89, 0x1D,
-    0x4C, 0x69, 0xD1, 0x06, 0x0D, 0x2D, 0xEB, 0x78, 0x00, 0x76, 0x90, 0x94, 0x0F, 0x7D, 0xF5, 0x16,
-    0xDE, 0x20, 0xAF, 0x38, 0x62, 0x42, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x4B, 0xDD, 0x84,
-    0x10, 0x50, 0xFF, 0x05, 0x23, 0x6C, 0x94, 0x51, 0xBD, 0x9F, 0x45, 0x26, 0xBA, 0x24, 0x37, 0x60,
-    0xB5, 0x9F, 0x49, 0x1B, 0xB2, 0x24, 0x3B, 0x72, 0xA2, 0x48, 0x0F, 0x78, 0xAB, 0xA1, 0x10, 0x49,
-    0xA4, 0xA0, 0x19, 0x07, 0xA9, 0x49, 0x05, 0x5E, 0x9E, 0x9E, 0x09, 0x1C, 0x9C, 0x56, 0x00, 0x58,
-    0x79, 0x4C, 0x71, 0x6C, 0x71, 0x8F, 0x1B, 0x1B, 0x7A, 0x76, 0x76, 0x16, 0x70, 0x6E, 0x18, 0x77,
-    0xA4, 0xFF, 0x92, 0x9E, 0xB7, 0xFA, 0x94, 0x2C, 0xA1, 0x8A, 0x84, 0x94, 0xB4, 0x84, 0x86, 0x46,
-    0xA7, 0xF8, 0xA7, 0x04, 0xA4, 0x82, 0x99, 0x7F, 0x3C, 0x64, 0x30, 0x71, 0x59, 0x80, 0x25, 0x56,
-    0x54, 0x56, 0x78, 0x7D, 0x71, 0x64, 0x6C, 0x43, 0x3D, 0xA1, 0x37, 0x1B, 0x55, 0x79, 0x7C, 0x18,
-    0x7F, 0x74, 0x32, 0x8E, 0x94, 0x96, 0x1F, 0x08, 0x92, 0x55, 0x18, 0x6A, 0x31, 0xE6, 0xAC, 0x3D,
-    0xBC, 0x88, 0xE7, 0x3C, 0x5C, 0xAC, 0x3D, 0x3D, 0x44, 0x32, 0x13, 0xC0, 0xAF, 0x13, 0x1A, 0xC1,
-    0xC0, 0xFE, 0x63, 0x40, 0x74, 0x61, 0x75, 0x6E, 0x74, 0x30, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x79, 0x3E, 0xD4, 0x43, 0x85, 0x34, 0xEE, 0x56, 0x9A, 0x33, 0xE4, 0x56,
-    0x70, 0x2C, 0xD6, 0x77, 0x80, 0x1D, 0xFB, 0x7A, 0xA2, 0x1C, 0xEA, 0x61, 0x71, 0x52, 0xDB, 0x11,
-    0x81, 0x43, 0xFF, 0x08, 0xA3, 0x42, 0xEF, 0x26, 0xE0, 0x5A, 0x64, 0x20, 0xE0, 0x41, 0x61, 0x68,
-    0xE1, 0x4B, 0x6A, 0x0C, 0xDF, 0x50, 0x5B, 0x52, 0xFE, 0x40, 0x52, 0x63, 0xFF, 0x4A, 0x5B, 0x8B,
-    0xFE, 0x59, 0x55, 0x2A, 0xFD, 0x4F, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x28, 0x8B, 0x68,
-    0xD7, 0x31, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x3A, 0x7E, 0x58,
-    0xF7, 0x26, 0x7A, 0x62, 0xF9, 0x2F, 0x89, 0x8C, 0xFA, 0x4A, 0x8C, 0x31, 0xF8, 0x5C, 0x80, 0x29,
-    0xF6, 0x53, 0x71, 0x47, 0xF5, 0x38, 0x6E, 0x5F, 0x50, 0x41, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70,
-    0x5F, 0x1D, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x88, 0x76, 0x1D, 0xF1, 0xA5, 0x52, 0x25,
-    0x61, 0x64, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8D, 0x2E, 0x4F,
-    0xFA, 0x13, 0x31, 0x5F, 0xFD, 0x98, 0x40, 0x2E, 0x4B, 0x30, 0xCB, 0x7A, 0x41, 0x49, 0x83, 0xA0,
-    0x42, 0x79, 0x89, 0x1A, 0x4C, 0x61, 0xD1, 0x06, 0x0D, 0x21, 0xEB, 0x78, 0x00, 0x6A, 0x90, 0x94,
-    0x0F, 0x73, 0xF5, 0x16, 0xDE, 0x20, 0xAF, 0x38, 0x63, 0x3B, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31,
-    0x4E, 0x44, 0xDD, 0x84, 0x10, 0x45, 0xFF, 0x05, 0x23, 0x62, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26,
-    0xBA, 0x21, 0x37, 0x60, 0xB5, 0x9F, 0x49, 0x1B, 0xB2, 0x22, 0x3B, 0x72, 0xA2, 0x45, 0x0F, 0x78,
-    0xAB, 0xA0, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x46, 0x05, 0x5E, 0x9E, 0x9D, 0x09, 0x1C,
-    0x9C, 0x53, 0x00, 0x58, 0x79, 0x46, 0x71, 0x6C, 0x71, 0x8A, 0x1B, 0x1B, 0x7A, 0x71, 0x76, 0x16,
-    0x70, 0x69, 0x18, 0x77, 0xA3, 0xFF, 0x92, 0x9E, 0xB6, 0xFB, 0x94, 0x2C, 0xA0, 0x88, 0x84, 0x94,
-    0xB3, 0x83, 0x86, 0x46, 0xA6, 0xF8, 0xA7, 0x01, 0xA3, 0x80, 0x99, 0x7F, 0x3C, 0x5B, 0x30, 0x71,
-    0x59, 0x7A, 0x25, 0x56, 0x54, 0x4E, 0x78, 0x7D, 0x71, 0x5F, 0x6C, 0x3F, 0x3D, 0x9A, 0x37, 0x1B,
-    0x55, 0x72, 0x7C, 0x18, 0x7F, 0x6F, 0x32, 0x8E, 0x94, 0x93, 0x1F, 0x08, 0x92, 0x51, 0x18, 0x6A,
-    0x32, 0xE6, 0xAC, 0x3D, 0xBC, 0x88, 0xE7, 0x3C, 0x5F, 0xAC, 0x3D, 0x3D, 0x66, 0x6C, 0xDC, 0xBF,
-    0x2A, 0xF6, 0x18, 0xC1, 0x56, 0xC8, 0x37, 0x40, 0x74, 0x61, 0x75, 0x6E, 0x74, 0x30, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3E, 0xD4, 0x43, 0x85, 0x34, 0xEE, 0x56,
-    0x9A, 0x33, 0xE4, 0x56, 0x70, 0x2C, 0xD6, 0x77, 0x80, 0x1D, 0xFB, 0x7A, 0xA2, 0x1C, 0xEA, 0x61,
-    0x71, 0x52, 0xDB, 0x11, 0x81, 0x43, 0xFF, 0x08, 0xA3, 0x42, 0xEF, 0x26, 0xE0, 0x5A, 0x64, 0x20,
-    0xE0, 0x41, 0x61, 0x68, 0xE1, 0x4B, 0x6A, 0x0C, 0xDF, 0x50, 0x5B, 0x52, 0xFE, 0x40, 0x52, 0x63,
-    0xFF, 0x4A, 0x5B, 0x8B, 0xFE, 0x59, 0x55, 0x2A, 0xFD, 0x4F, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20,
-    0xD5, 0x28, 0x8B, 0x68, 0xD7, 0x31, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E,
-    0xD3, 0x3A, 0x7E, 0x58, 0xF7, 0x26, 0x7A, 0x62, 0xF9, 0x2F, 0x89, 0x8C, 0xFA, 0x4A, 0x8C, 0x31,
-    0xF8, 0x5C, 0x80, 0x29, 0xF6, 0x53, 0x71, 0x47, 0xF5, 0x38, 0x6E, 0x5F, 0x50, 0x41, 0x6E, 0x58,
-    0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x1D, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x88, 0x76, 0x1D,
-    0xF1, 0xA5, 0x52, 0x25, 0x61, 0x64, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59,
-    0xE8, 0x8D, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x5F, 0xFD, 0x98, 0x40, 0x2E, 0x4B, 0x30, 0xCB, 0x7A,
-    0x41, 0x49, 0x83, 0xA0, 0x42, 0x79, 0x89, 0x1A, 0x4C, 0x61, 0xD1, 0x06, 0x0D, 0x21, 0xEB, 0x78,
-    0x00, 0x6A, 0x90, 0x94, 0x0F, 0x73, 0xF5, 0x16, 0xDE, 0x20, 0xAF, 0x38, 0x63, 0x3B, 0xEE, 0x86,
-    0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x44, 0xDD, 0x84, 0x10, 0x45, 0xFF, 0x05, 0x23, 0x62, 0x94, 0x51,
-    0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x21, 0x37, 0x60, 0xB5, 0x9F, 0x49, 0x1B, 0xB2, 0x22, 0x3B, 0x72,
-    0xA2, 0x45, 0x0F, 0x78, 0xAB, 0xA0, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x46, 0x05, 0x5E,
-    0x9E, 0x9D, 0x09, 0x1C, 0x9C, 0x53, 0x00, 0x58, 0x79, 0x46, 0x71, 0x6C, 0x71, 0x8A, 0x1B, 0x1B,
-    0x7A, 0x71, 0x76, 0x16, 0x70, 0x69, 0x18, 0x77, 0xA3, 0xFF, 0x92, 0x9E, 0xB6, 0xFB, 0x94, 0x2C,
-    0xA0, 0x88, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x46, 0xA6, 0xF8, 0xA7, 0x01, 0xA3, 0x80, 0x99, 0x7F,
-    0x3C, 0x5B, 0x30, 0x71, 0x59, 0x7A, 0x25, 0x56, 0x54, 0x4E, 0x78, 0x7D, 0x71, 0x5F, 0x6C, 0x3F,
-    0x3D, 0x9A, 0x37, 0x1B, 0x55, 0x72, 0x7C, 0x18, 0x7F, 0x6F, 0x32, 0x8E, 0x94, 0x93, 0x1F, 0x08,
-    0x92, 0x51, 0x18, 0x6A, 0xFD, 0x0D, 0xAC, 0x3D, 0x9D, 0x36, 0xF4, 0x3C, 0x5B, 0xAC, 0x3D, 0x3D,
-    0x16, 0x4D, 0x02, 0xC0, 0x10, 0x9F, 0x28, 0xC1, 0xE6, 0xBB, 0x79, 0x40, 0x74, 0x61, 0x75, 0x6E,
-    0x74, 0x30, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x50, 0xD4, 0x43,
-    0x85, 0x44, 0xEE, 0x56, 0x9A, 0x40, 0xE4, 0x56, 0x6F, 0x40, 0xD6, 0x77, 0x7F, 0x30, 0xFB, 0x7A,
-    0xA1, 0x28, 0xEA, 0x61, 0x70, 0x64, 0xDB, 0x11, 0x81, 0x54, 0xFF, 0x2D, 0xA2, 0x4C, 0xEF, 0x26,
-    0xE0, 0x58, 0x64, 0x20, 0xDF, 0x40, 0x61, 0x68, 0xE1, 0x4A, 0x6A, 0x0C, 0xDF, 0x4F, 0x5B, 0x52,
-    0xFD, 0x3A, 0x52, 0x63, 0xFF, 0x43, 0x5B, 0x8B, 0xFF, 0x51, 0x55, 0x2E, 0xFD, 0x48, 0x4C, 0x48,
-    0xD6, 0x5C, 0x91, 0x20, 0xD4, 0x2A, 0x8B, 0x68, 0xD6, 0x32, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A,
-    0xD4, 0x55, 0x82, 0x4E, 0xD2, 0x3C, 0x7E, 0x58, 0xF6, 0x23, 0x7A, 0x62, 0xF8, 0x2A, 0x89, 0x6F,
-    0xFA, 0x44, 0x8C, 0x0B, 0xF8, 0x55, 0x80, 0x29, 0xF6, 0x4D, 0x71, 0x47, 0xF5, 0x34, 0x6E, 0x5F,
-    0x4F, 0x5A, 0x6E, 0x58, 0xEC, 0x00, 0x3F, 0x6D, 0x5E, 0x36, 0xD7, 0x7A, 0xD6, 0x0F, 0x9B, 0x6D,
-    0x52, 0x9D, 0x76, 0x1D, 0xF3, 0x9C, 0x52, 0x2A, 0x61, 0x79, 0xDF, 0x07, 0xDB, 0x6A, 0xA6, 0x2F,
-    0xE5, 0x2E, 0x24, 0x59, 0xE9, 0x86, 0x2E, 0x4F, 0xF8, 0x0F, 0x31, 0x66, 0xFE, 0x8D, 0x40, 0x33,
-    0x4A, 0x4B, 0xCB, 0x7A, 0x40, 0x65, 0x83, 0xA0, 0x43, 0x92, 0x89, 0x1D, 0x4C, 0x7A, 0xD1, 0x06,
-    0x0B, 0x49, 0xEB, 0x78, 0x00, 0x91, 0x90, 0x94, 0x0F, 0x96, 0xF5, 0x16, 0xDD, 0x21, 0xAF, 0x38,
-    0x62, 0x51, 0xEE, 0x86, 0xDF, 0x4A, 0xB4, 0x31, 0x4D, 0x5D, 0xDD, 0x84, 0x0F, 0x6A, 0xFF, 0x05,
-    0x23, 0x82, 0x94, 0x51, 0xBF, 0x9F, 0x45, 0x26, 0xB9, 0x29, 0x37, 0x60, 0xB6, 0xA1, 0x49, 0x1B,
-    0xB1, 0x2B, 0x3B, 0x72, 0xA2, 0x4F, 0x0F, 0x78, 0xAC, 0xA4, 0x10, 0x49, 0xA5, 0xA3, 0x19, 0x06,
-    0xA8, 0x4F, 0x05, 0x5D, 0x9F, 0xA3, 0x09, 0x1C, 0x9C, 0x5D, 0x00, 0x58, 0x79, 0x58, 0x71, 0x6C,
-    0x72, 0x9A, 0x1B, 0x1B, 0x7B, 0x80, 0x76, 0x16, 0x71, 0x7A, 0x18, 0x75, 0xA7, 0xFF, 0x92, 0x9E,
-    0xBA, 0xF7, 0x94, 0x2C, 0xA1, 0x8E, 0x84, 0x94, 0xB5, 0x87, 0x86, 0x46, 0xAA, 0xF8, 0xA7, 0x04,
-    0xA4, 0x87, 0x99, 0x7F, 0x3C, 0x77, 0x30, 0x71, 0x5A, 0x8E, 0x25, 0x55, 0x54, 0x66, 0x78, 0x7D,
-    0x71, 0x71, 0x6C, 0x46, 0x3E, 0xB2, 0x37, 0x1B, 0x55, 0x88, 0x7C, 0x18, 0x7F, 0x7E, 0x32, 0x8E,
-    0x95, 0x9C, 0x1F, 0x2D, 0x92, 0x5E, 0x18, 0x6A, 0x39, 0xF8, 0xAA, 0x3D, 0x13, 0xE8, 0x00, 0x3D,
-    0x60, 0xAC, 0x3D, 0x3D, 0x70, 0xA6, 0x26, 0xC0, 0x68, 0xD8, 0x3E, 0xC1, 0xE1, 0x7B, 0x65, 0x40,
-    0x74, 0x61, 0x75, 0x6E, 0x74, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x77, 0x63, 0xD4, 0x43, 0x83, 0x55, 0xEE, 0x56, 0x98, 0x4D, 0xE4, 0x56, 0x6D, 0x56, 0xD6, 0x77,
-    0x7D, 0x43, 0xFB, 0x7A, 0x9E, 0x35, 0xEA, 0x61, 0x70, 0x78, 0xDB, 0x11, 0x7F, 0x65, 0xFF, 0x2D,
-    0xA1, 0x57, 0xEF, 0x49, 0xE0, 0x55, 0x64, 0x27, 0xDE, 0x3F, 0x61, 0x7A, 0xE0, 0x48, 0x6A, 0x0C,
-    0xDE, 0x4D, 0x5B, 0x52, 0xFC, 0x33, 0x52, 0x63, 0xFE, 0x3B, 0x5B, 0x8B, 0xFE, 0x49, 0x55, 0x2E,
-    0xFC, 0x41, 0x4C, 0x48, 0xD5, 0x5C, 0x91, 0x20, 0xD2, 0x2D, 0x8B, 0x68, 0xD4, 0x34, 0x9A, 0x89,
-    0xD6, 0x4B, 0x9D, 0x0A, 0xD3, 0x55, 0x82, 0x4F, 0xD1, 0x3D, 0x7E, 0x58, 0xF4, 0x1F, 0x7A, 0x62,
-    0xF6, 0x26, 0x89, 0x6E, 0xF8, 0x3D, 0x8C, 0x0B, 0xF7, 0x4E, 0x80, 0x33, 0xF5, 0x47, 0x71, 0x49,
-    0xF3, 0x2F, 0x6E, 0x5F, 0x4E, 0x76, 0x6E, 0x58, 0xE9, 0x00, 0x3F, 0x6D, 0x5B, 0x50, 0xD7, 0x7A,
-    0xD3, 0x12, 0x9B, 0x6D, 0x53, 0xB4, 0x76, 0x1D, 0xF4, 0x92, 0x52, 0x2A, 0x60, 0x8F, 0xDF, 0x07,
-    0xDA, 0x68, 0xA6, 0x2F, 0xE3, 0x2D, 0x24, 0x59, 0xEA, 0x80, 0x2E, 0x4F, 0xF6, 0x0C, 0x31, 0x66,
-    0xFF, 0x81, 0x40, 0x35, 0x49, 0x68, 0xCB, 0x7A, 0x3F, 0x82, 0x83, 0xA0, 0x43, 0xAD, 0x89, 0x1D,
-    0x4C, 0x94, 0xD1, 0x06, 0x0A, 0x73, 0xEB, 0x78, 0x00, 0xB9, 0x90, 0x94, 0x0F, 0xBA, 0xF5, 0x17,
-    0xDB, 0x22, 0xAF, 0x38, 0x60, 0x69, 0xEE, 0x84, 0xDE, 0x48, 0xB4, 0x31, 0x4C, 0x79, 0xDD, 0x84,
-    0x0E, 0x91, 0xFF, 0x05, 0x23, 0xA4, 0x94, 0x51, 0xC0, 0x9F, 0x45, 0x26, 0xB7, 0x31, 0x37, 0x5D,
-    0xB7, 0xA3, 0x49, 0x1F, 0xAF, 0x34, 0x3B, 0x72, 0xA0, 0x5A, 0x0F, 0x76, 0xAD, 0xA8, 0x10, 0x4C,
-    0xA7, 0xA9, 0x19, 0x06, 0xA7, 0x59, 0x05, 0x5D, 0xA0, 0xA9, 0x09, 0x47, 0x9B, 0x68, 0x00, 0x58,
-    0x78, 0x6B, 0x71, 0x6B, 0x73, 0xAA, 0x1B, 0x1F, 0x7B, 0x90, 0x76, 0x16, 0x70, 0x8D, 0x18, 0x75,
-    0xAA, 0xFF, 0x92, 0x4D, 0xBD, 0xF4, 0x94, 0x2A, 0xA2, 0x96, 0x84, 0x94, 0xB5, 0x8B, 0x86, 0x46,
-    0xAD, 0xF8, 0xA7, 0x04, 0xA5, 0x8E, 0x99, 0x02, 0x3B, 0x95, 0x30, 0x9F, 0x5A, 0xA4, 0x25, 0x55,
-    0x53, 0x80, 0x78, 0x7C, 0x71, 0x84, 0x6C, 0x46, 0x3F, 0xCC, 0x37, 0x1B, 0x55, 0x9F, 0x7C, 0x18,
-    0x7F, 0x8D, 0x32, 0x8E, 0x96, 0xA5, 0x1F, 0x2D, 0x91, 0x6B, 0x18, 0x79, 0x35, 0xA9, 0xA9, 0x3D,
-    0x52, 0x31, 0x06, 0x3D, 0x5F, 0xAC, 0x3D, 0x3D, 0xC6, 0xD9, 0x45, 0xC0, 0x42, 0xF8, 0x52, 0xC1,
-    0x54, 0xF9, 0x42, 0x40, 0x74, 0x61, 0x75, 0x6E, 0x74, 0x31, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x76, 0x73, 0xD4, 0x42, 0x81, 0x63, 0xEE, 0x56, 0x96, 0x57, 0xE4, 0x56,
-    0x6B, 0x68, 0xD6, 0x77, 0x7A, 0x53, 0xFB, 0x77, 0x9C, 0x40, 0xEA, 0x61, 0x6E, 0x87, 0xDB, 0x11,
-    0x7E, 0x73, 0xFF, 0x2D, 0x9F, 0x5F, 0xEF, 0x49, 0xDE, 0x53, 0x64, 0x27, 0xDC, 0x3F, 0x61, 0x7A,
-    0xDE, 0x46, 0x6A, 0x0C, 0xDC, 0x4C, 0x5B, 0x52, 0xFA, 0x2E, 0x52, 0x63, 0xFC, 0x35, 0x5B, 0x8A,
-    0xFC, 0x42, 0x55, 0x2E, 0xFA, 0x3B, 0x4C, 0x48, 0xD4, 0x5B, 0x91, 0x24, 0xCF, 0x2F, 0x8B, 0x7A,
-    0xD2, 0x35, 0x9A, 0x89, 0xD5, 0x4B, 0x9D, 0x0A, 0xD1, 0x55, 0x82, 0x4F, 0xCF, 0x3F, 0x7E, 0x58,
-    0xF1, 0x1C, 0x7A, 0x61, 0xF4, 0x22, 0x89, 0x6E, 0xF6, 0x38, 0x8C, 0x0B, 0xF6, 0x48, 0x80, 0x33,
-    0xF3, 0x42, 0x71, 0x49, 0xF1, 0x2C, 0x6E, 0x5F, 0x4D, 0x8B, 0x6E, 0xA0, 0xE5, 0x00, 0x3F, 0x6D,
-    0x59, 0x65, 0xD7, 0x78, 0xD0, 0x15, 0x9B, 0x6D, 0x53, 0xC6, 0x76, 0x1E, 0xF5, 0x8A, 0x52, 0x2A,
-    0x60, 0xA0, 0xDF, 0x08, 0xD9, 0x66, 0xA6, 0x2F, 0xE1, 0x2C, 0x24, 0x59, 0xEA, 0x7A, 0x2E, 0x48,
-    0xF3, 0x09, 0x31, 0x66, 0xFF, 0x78, 0x40, 0x35, 0x47, 0x7F, 0xCB, 0x7A, 0x3E, 0x99, 0x83, 0xA0,
-    0x43, 0xC2, 0x89, 0x1D, 0x4C, 0xA8, 0xD1, 0x23, 0x08, 0x94, 0xEB, 0x78, 0x00, 0xD9, 0x90, 0x94,
-    0x0F, 0xD8, 0xF5, 0x17, 0xD9, 0x23, 0xAF, 0x6F, 0x5F, 0x7C, 0xEE, 0x84, 0xDD, 0x47, 0xB4, 0x31,
-    0x4B, 0x8E, 0xDD, 0x84, 0x0D, 0xB0, 0xFF, 0x05, 0x23, 0xBF, 0x94, 0x53, 0xC0, 0xA0, 0x45, 0x26,
-    0xB5, 0x37, 0x37, 0x5D, 0xB8, 0xA4, 0x49, 0x1F, 0xAC, 0x3C, 0x3B, 0x72, 0x9F, 0x62, 0x0F, 0x76,
-    0xAE, 0xAB, 0x10, 0x4C, 0xA7, 0xAD, 0x19, 0x06, 0xA6, 0x60, 0x05, 0x5D, 0xA1, 0xAF, 0x09, 0x47,
-    0x9A, 0x71, 0x00, 0x58, 0x76, 0x79, 0x71, 0x6B, 0x73, 0xB7, 0x1B, 0x1F, 0x7A, 0x9D, 0x76, 0x16,
-    0x70, 0x9B, 0x18, 0x75, 0xAD, 0xFF, 0x92, 0x4D, 0xC0, 0xF1, 0x94, 0x2A, 0xA2, 0x9C, 0x84, 0x93,
-    0xB5, 0x8E, 0x86, 0x46, 0xAF, 0xF7, 0xA7, 0x04, 0xA4, 0x94, 0x99, 0x02, 0x3B, 0xAC, 0x30, 0x9F,
-    0x5A, 0xB6, 0x25, 0x55, 0x52, 0x94, 0x78, 0x7C, 0x70, 0x92, 0x6C, 0x46, 0x40, 0xE0, 0x37, 0x22,
-    0x55, 0xB2, 0x7C, 0x17, 0x7F, 0x99, 0x32, 0x8E, 0x96, 0xAC, 0x1F, 0x2D, 0x90, 0x75, 0x18, 0x79,
-    0x44, 0x70, 0xA9, 0x3D, 0x01, 0xD4, 0x06, 0x3D, 0x5D, 0xAC, 0x3D, 0x3D, 0xE2, 0x9D, 0x4A, 0xC0,
-    0x20, 0x78, 0x58, 0xC1, 0x36, 0x5D, 0x2F, 0x40, 0x74, 0x61, 0x75, 0x6E, 0x74, 0x31, 0x32, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x74, 0xD4, 0x42, 0x81, 0x65, 0xEE, 0x56,
-    0x96, 0x59, 0xE4, 0x56, 0x6B, 0x6A, 0xD6, 0x77, 0x7A, 0x55, 0xFB, 0x77, 0x9B, 0x41, 0xEA, 0x61,
-    0x6E, 0x89, 0xDB, 0x11, 0x7E, 0x74, 0xFF, 0x2D, 0x9F, 0x61, 0xEF, 0x49, 0xDE, 0x53, 0x64, 0x27,
-    0xDC, 0x3F, 0x61, 0x7A, 0xDE, 0x46, 0x6A, 0x0C, 0xDC, 0x4C, 0x5B, 0x52, 0xFA, 0x2D, 0x52, 0x63,
-    0xFC, 0x35, 0x5B, 0x8A, 0xFC, 0x41, 0x55, 0x2E, 0xFA, 0x3A, 0x4C, 0x48, 0xD4, 0x5B, 0x91, 0x24,
-    0xCF, 0x2F, 0x8B, 0x7A, 0xD2, 0x35, 0x9A, 0x89, 0xD4, 0x4B, 0x9D, 0x0A, 0xD1, 0x55, 0x82, 0x4F,
-    0xCF, 0x3F, 0x7E, 0x58, 0xF1, 0x1B, 0x7A, 0x61, 0xF4, 0x21, 0x89, 0x6E, 0xF6, 0x37, 0x8C, 0x0B,
-    0xF6, 0x47, 0x80, 0x33, 0xF3, 0x41, 0x71, 0x49, 0xF1, 0x2B, 0x6E, 0x5F, 0x4C, 0x8E, 0x6E, 0xA0,
-    0xE5, 0x00, 0x3F, 0x6D, 0x59, 0x67, 0xD7, 0x78, 0xD0, 0x16, 0x9B, 0x6D, 0x53, 0xC8, 0x76, 0x1E,
-    0xF5, 0x89, 0x52, 0x2A, 0x60, 0xA2, 0xDF, 0x08, 0xD9, 0x65, 0xA6, 0x2F, 0xE1, 0x2B, 0x24, 0x59,
-    0xEA, 0x79, 0x2E, 0x48, 0xF2, 0x09, 0x31, 0x66, 0xFF, 0x77, 0x40, 0x35, 0x47, 0x82, 0xCB, 0x7A,
-    0x3E, 0x9C, 0x83, 0xA0, 0x43, 0xC4, 0x89, 0x1D, 0x4B, 0xAA, 0xD1, 0x23, 0x08, 0x98, 0xEB, 0x78,
-    0x00, 0xDC, 0x90, 0x94, 0x0F, 0xDB, 0xF5, 0x17, 0xD8, 0x23, 0xAF, 0x6F, 0x5F, 0x7E, 0xEE, 0x84,
-    0xDC, 0x47, 0xB4, 0x31, 0x4B, 0x91, 0xDD, 0x84, 0x0D, 0xB4, 0xFF, 0x05, 0x23, 0xC2, 0x94, 0x53,
-    0xC0, 0xA0, 0x45, 0x26, 0xB4, 0x38, 0x37, 0x5D, 0xB8, 0xA4, 0x49, 0x1F, 0xAC, 0x3D, 0x3B, 0x72,
-    0x9F, 0x63, 0x0F, 0x76, 0xAE, 0xAB, 0x10, 0x4C, 0xA7, 0xAD, 0x19, 0x06, 0xA6, 0x61, 0x05, 0x5D,
-    0xA1, 0xAF, 0x09, 0x47, 0x9A, 0x72, 0x00, 0x58, 0x76, 0x7B, 0x71, 0x6B, 0x73, 0xB9, 0x1B, 0x1F,
-    0x7A, 0x9F, 0x76, 0x16, 0x70, 0x9D, 0x18, 0x75, 0xAD, 0xFF, 0x92, 0x4D, 0xC0, 0xF1, 0x94, 0x2A,
-    0xA2, 0x9C, 0x84, 0x93, 0xB5, 0x8E, 0x86, 0x46, 0xB0, 0xF7, 0xA7, 0x04, 0xA4, 0x95, 0x99, 0x00,
-    0x3A, 0xAF, 0x30, 0x9F, 0x5A, 0xB8, 0x25, 0x55, 0x52, 0x96, 0x78, 0x7C, 0x70, 0x94, 0x6C, 0x46,
-    0x40, 0xE3, 0x37, 0x22, 0x55, 0xB4, 0x7C, 0x17, 0x7F, 0x9A, 0x32, 0x8E, 0x96, 0xAD, 0x1F, 0x2D,
-    0x90, 0x77, 0x18, 0x79, 0x94, 0x3D, 0xAC, 0x3D, 0x41, 0x3C, 0xF2, 0x3C, 0x5C, 0xAC, 0x3D, 0x3D,
-    0xB9, 0x35, 0x30, 0xC0, 0xAE, 0x85, 0x30, 0xC1, 0x41, 0x51, 0x65, 0x40, 0x74, 0x61, 0x75, 0x6E,
-    0x74, 0x31, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x4D, 0xD4, 0x43,
-    0x85, 0x42, 0xEE, 0x56, 0x9A, 0x3E, 0xE4, 0x56, 0x6F, 0x3D, 0xD6, 0x77, 0x7F, 0x2D, 0xFB, 0x7A,
-    0xA1, 0x26, 0xEA, 0x61, 0x70, 0x61, 0xDB, 0x11, 0x81, 0x51, 0xFF, 0x08, 0xA2, 0x4A, 0xEF, 0x26,
-    0xE0, 0x58, 0x64, 0x20, 0xDF, 0x41, 0x61, 0x68, 0xE1, 0x4A, 0x6A, 0x0C, 0xDF, 0x4F, 0x5B, 0x52,
-    0xFD, 0x3B, 0x52, 0x63, 0xFF, 0x44, 0x5B, 0x8B, 0xFE, 0x52, 0x55, 0x2A, 0xFD, 0x49, 0x4C, 0x48,
-    0xD6, 0x5D, 0x91, 0x20, 0xD4, 0x2A, 0x8B, 0x68, 0xD6, 0x32, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A,
-    0xD4, 0x55, 0x82, 0x4E, 0xD3, 0x3B, 0x7E, 0x58, 0xF6, 0x23, 0x7A, 0x62, 0xF8, 0x2B, 0x89, 0x6F,
-    0xFA, 0x44, 0x8C, 0x0B, 0xF8, 0x56, 0x80, 0x29, 0xF6, 0x4E, 0x71, 0x47, 0xF5, 0x35, 0x6E, 0x5F,
-    0x4F, 0x56, 0x6E, 0x58, 0xEC, 0x00, 0x3F, 0x6D, 0x5E, 0x32, 0xD7, 0x7A, 0xD7, 0x0E, 0x9B, 0x6D,
-    0x52, 0x9A, 0x76, 0x1D, 0xF3, 0x9D, 0x52, 0x25, 0x61, 0x76, 0xDF, 0x07, 0xDA, 0x6A, 0xA6, 0x25,
-    0xE5, 0x2E, 0x24, 0x59, 0xE9, 0x88, 0x2E, 0x4F, 0xF9, 0x10, 0x31, 0x66, 0xFE, 0x8F, 0x40, 0x2E,
-    0x4A, 0x47, 0xCB, 0x7A, 0x41, 0x60, 0x83, 0xA0, 0x42, 0x8F, 0x89, 0x1D, 0x4C, 0x76, 0xD1, 0x06,
-    0x0C, 0x43, 0xEB, 0x78, 0x00, 0x8B, 0x90, 0x94, 0x0F, 0x90, 0xF5, 0x16, 0xDE, 0x21, 0xAF, 0x38,
-    0x62, 0x4E, 0xEE, 0x86, 0xDF, 0x4A, 0xB4, 0x31, 0x4E, 0x59, 0xDD, 0x84, 0x0F, 0x64, 0xFF, 0x05,
-    0x23, 0x7D, 0x94, 0x51, 0xBE, 0x9F, 0x45, 0x26, 0xB9, 0x28, 0x37, 0x60, 0xB6, 0xA0, 0x49, 0x1B,
-    0xB1, 0x29, 0x3B, 0x72, 0xA2, 0x4E, 0x0F, 0x78, 0xAC, 0xA3, 0x10, 0x49, 0xA5, 0xA3, 0x19, 0x06,
-    0xA9, 0x4E, 0x05, 0x5E, 0x9F, 0xA2, 0x09, 0x1C, 0x9C, 0x5C, 0x00, 0x58, 0x79, 0x55, 0x71, 0x6C,
-    0x72, 0x97, 0x1B, 0x1B, 0x7B, 0x7E, 0x76, 0x16, 0x71, 0x78, 0x18, 0x75, 0xA6, 0xFF, 0x92, 0x9E,
-    0xB9, 0xF8, 0x94, 0x2C, 0xA1, 0x8D, 0x84, 0x94, 0xB4, 0x86, 0x86, 0x46, 0xA9, 0xF8, 0xA7, 0x04,
-    0xA4, 0x86, 0x99, 0x7F, 0x3C, 0x73, 0x30, 0x71, 0x5A, 0x8B, 0x25, 0x56, 0x54, 0x63, 0x78, 0x7D,
-    0x71, 0x6E, 0x6C, 0x46, 0x3E, 0xAE, 0x37, 0x1B, 0x55, 0x85, 0x7C, 0x18, 0x7F, 0x7B, 0x32, 0x8E,
-    0x95, 0x9B, 0x1F, 0x2D, 0x92, 0x5C, 0x18, 0x6A, 0xA8, 0x09, 0xA8, 0x3D, 0xEA, 0x0F, 0x0A, 0x3D,
-    0x5E, 0xAC, 0x3D, 0x3D, 0xB4, 0x07, 0x63, 0xC0, 0x51, 0x98, 0x54, 0xC1, 0x88, 0xAB, 0x6C, 0x40,
-    0x74, 0x61, 0x75, 0x6E, 0x74, 0x31, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x74, 0x7E, 0xD4, 0x42, 0x80, 0x6E, 0xEE, 0x56, 0x94, 0x5F, 0xE4, 0x56, 0x69, 0x75, 0xD6, 0x76,
-    0x79, 0x5F, 0xFB, 0x77, 0x9A, 0x48, 0xEA, 0x67, 0x6E, 0x93, 0xDB, 0x18, 0x7D, 0x7D, 0xFF, 0x2D,
-    0x9E, 0x66, 0xEF, 0x49, 0xDD, 0x52, 0x64, 0x27, 0xDA, 0x3E, 0x61, 0x7A, 0xDD, 0x45, 0x6A, 0x0C,
-    0xDB, 0x4B, 0x5B, 0x52, 0xF8, 0x29, 0x52, 0x61, 0xFA, 0x31, 0x5B, 0x8A, 0xFB, 0x3D, 0x55, 0x2E,
-    0xF9, 0x36, 0x4C, 0x48, 0xD3, 0x5B, 0x91, 0x24, 0xCD, 0x30, 0x8B, 0x7A, 0xD0, 0x36, 0x9A, 0x89,
-    0xD3, 0x4B, 0x9D, 0x0A, 0xD0, 0x55, 0x82, 0x4F, 0xCD, 0x40, 0x7E, 0x58, 0xEF, 0x19, 0x7A, 0x61,
-    0xF2, 0x1F, 0x89, 0x6E, 0xF5, 0x34, 0x8C, 0x0B, 0xF5, 0x43, 0x80, 0x33, 0xF2, 0x3E, 0x71, 0x49,
-    0xEF, 0x29, 0x6E, 0x5F, 0x4C, 0x9B, 0x6E, 0xA0, 0xE2, 0x00, 0x3F, 0x68, 0x57, 0x74, 0xD7, 0x78,
-    0xCE, 0x17, 0x9B, 0x6D, 0x53, 0xD4, 0x76, 0x1E, 0xF5, 0x84, 0x52, 0x2A, 0x5F, 0xAD, 0xDF, 0x08,
-    0xD9, 0x64, 0xA6, 0x2F, 0xDF, 0x2B, 0x24, 0x59, 0xEA, 0x76, 0x2E, 0x48, 0xF0, 0x07, 0x31, 0x66,
-    0xFF, 0x71, 0x40, 0x35, 0x46, 0x90, 0xCB, 0x77, 0x3E, 0xAB, 0x83, 0xA0, 0x43, 0xD2, 0x89, 0x1D,
-    0x4B, 0xB8, 0xD1, 0x23, 0x06, 0xAD, 0xEB, 0x76, 0x00, 0xF1, 0x90, 0x93, 0x0F, 0xEE, 0xF5, 0x17,
-    0xD6, 0x24, 0xAF, 0x6F, 0x5E, 0x8A, 0xEE, 0x84, 0xDB, 0x46, 0xB4, 0x31, 0x4A, 0x9E, 0xDD, 0x84,
-    0x0D, 0xC8, 0xFF, 0x05, 0x23, 0xD3, 0x94, 0x53, 0xC0, 0xA0, 0x45, 0x26, 0xB3, 0x3C, 0x37, 0x5D,
-    0xB8, 0xA5, 0x49, 0x1F, 0xAA, 0x42, 0x3B, 0x72, 0x9E, 0x69, 0x0F, 0x7D, 0xAE, 0xAD, 0x10, 0x4C,
-    0xA7, 0xB0, 0x19, 0x06, 0xA4, 0x66, 0x05, 0x5D, 0xA1, 0xB3, 0x09, 0x47, 0x99, 0x78, 0x00, 0x58,
-    0x75, 0x85, 0x71, 0x6B, 0x73, 0xC1, 0x1B, 0x1F, 0x7A, 0xA7, 0x76, 0x22, 0x6F, 0xA6, 0x18, 0x74,
-    0xAF, 0xFF, 0x92, 0x4D, 0xC2, 0xEF, 0x94, 0x2A, 0xA2, 0xA0, 0x84, 0x93, 0xB5, 0x90, 0x86, 0x46,
-    0xB2, 0xF7, 0xA7, 0x04, 0xA4, 0x98, 0x99, 0x02, 0x3A, 0xBE, 0x30, 0x9F, 0x5A, 0xC3, 0x25, 0x55,
-    0x51, 0xA3, 0x78, 0x7C, 0x6F, 0x9E, 0x6C, 0x46, 0x41, 0xEF, 0x37, 0x22, 0x55, 0xC0, 0x7C, 0x17,
-    0x7E, 0xA2, 0x32, 0x8E, 0x96, 0xB2, 0x1F, 0x2D, 0x8F, 0x7D, 0x18, 0x79, 0x57, 0x47, 0xA7, 0x3D,
-    0x83, 0x72, 0x0B, 0x3D, 0x64, 0xAC, 0x3D, 0x3D, 0x8C, 0x5E, 0x44, 0xC0, 0x80, 0x28, 0x59, 0xC1,
-    0xB2, 0xFA, 0x4D, 0x40, 0x74, 0x61, 0x75, 0x6E, 0x74, 0x31, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x74, 0x82, 0xD4, 0x42, 0x7F, 0x71, 0xEE, 0x56, 0x94, 0x62, 0xE4, 0x56,
-    0x69, 0x7A, 0xD6, 0x76, 0x78, 0x63, 0xFB, 0x77, 0x99, 0x4B, 0xEA, 0x67, 0x6D, 0x98, 0xDB, 0x11,
-    0x7C, 0x81, 0xFF, 0x2D, 0x9D, 0x68, 0xEF, 0x49, 0xDD, 0x51, 0x64, 0x27, 0xDA, 0x3E, 0x61, 0x7A,
-    0xDC, 0x45, 0x6A, 0x0C, 0xDB, 0x4A, 0x5B, 0x52, 0xF8, 0x28, 0x52, 0x61, 0xFA, 0x2F, 0x5B, 0x8A,
-    0xFB, 0x3B, 0x55, 0x2E, 0xF8, 0x34, 0x4C, 0x48, 0xD3, 0x5B, 0x91, 0x27, 0xCC, 0x31, 0x8B, 0x7A,
-    0xD0, 0x36, 0x9A, 0x89, 0xD3, 0x4B, 0x9D, 0x0A, 0xD0, 0x55, 0x82, 0x4F, 0xCD, 0x40, 0x7E, 0x58,
-    0xEE, 0x18, 0x7A, 0x61, 0xF1, 0x1E, 0x89, 0x6E, 0xF4, 0x32, 0x8C, 0x0B, 0xF5, 0x42, 0x80, 0x33,
-    0xF1, 0x3C, 0x71, 0x49, 0xEE, 0x28, 0x6E, 0x5F, 0x4B, 0xA1, 0x6E, 0xA0, 0xE1, 0x00, 0x3F, 0x68,
-    0x57, 0x7A, 0xD7, 0x78, 0xCD, 0x18, 0x9B, 0x6D, 0x54, 0xD9, 0x76, 0x1E, 0xF5, 0x81, 0x52, 0x2A,
-    0x5F, 0xB2, 0xDF, 0x08, 0xD8, 0x64, 0xA6, 0x2F, 0xDE, 0x2B, 0x24, 0x59, 0xEA, 0x74, 0x2E, 0x48,
-    0xEF, 0x06, 0x31, 0x66, 0xFF, 0x6F, 0x40, 0x35, 0x45, 0x97, 0xCB, 0x77, 0x3D, 0xB2, 0x83, 0xA0,
-    0x43, 0xD8, 0x89, 0x1D, 0x4B, 0xBD, 0xD1, 0x23, 0x06, 0xB6, 0xEB, 0x76, 0x00, 0xFA, 0x90, 0x93,
-    0x0F, 0xF6, 0xF5, 0x17, 0xD6, 0x24, 0xAF, 0x6F, 0x5D, 0x8F, 0xEE, 0x84, 0xDB, 0x46, 0xB4, 0x31,
-    0x4A, 0xA5, 0xDD, 0x84, 0x0C, 0xD1, 0xFF, 0x05, 0x22, 0xDB, 0x94, 0x53, 0xC1, 0xA0, 0x45, 0x26,
-    0xB2, 0x3E, 0x37, 0x5D, 0xB8, 0xA6, 0x49, 0x1F, 0xAA, 0x44, 0x3B, 0x72, 0x9D, 0x6B, 0x0F, 0x76,
-    0xAF, 0xAE, 0x10, 0x4B, 0xA8, 0xB1, 0x19, 0x06, 0xA4, 0x68, 0x05, 0x5D, 0xA1, 0xB4, 0x09, 0x47,
-    0x99, 0x7A, 0x00, 0x58, 0x75, 0x89, 0x71, 0x6A, 0x73, 0xC5, 0x1B, 0x1F, 0x7A, 0xAA, 0x76, 0x22,
-    0x6F, 0xAA, 0x18, 0x74, 0xB0, 0xFF, 0x92, 0x4D, 0xC3, 0xEE, 0x94, 0x2A, 0xA2, 0xA2, 0x84, 0x93,
-    0xB4, 0x91, 0x86, 0x46, 0xB2, 0xF7, 0xA7, 0x04, 0xA4, 0x9A, 0x99, 0x02, 0x3A, 0xC4, 0x30, 0xA1,
-    0x5A, 0xC8, 0x25, 0x55, 0x51, 0xA9, 0x78, 0x7C, 0x6F, 0xA2, 0x6C, 0x46, 0x41, 0xF5, 0x37, 0x22,
-    0x55, 0xC5, 0x7C, 0x17, 0x7E, 0xA6, 0x32, 0x8E, 0x96, 0xB4, 0x1F, 0x2D, 0x8F, 0x80, 0x18, 0x79,
-    0x08, 0x14, 0xAA, 0x3D, 0x05, 0xDC, 0x04, 0x3D, 0x5C, 0xAC, 0x3D, 0x3D, 0xCC, 0x17, 0x21, 0xC0,
-    0xED, 0x08, 0x45, 0xC1, 0x00, 0x71, 0x61, 0x40, 0x74, 0x61, 0x75, 0x6E, 0x74, 0x31, 0x36, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x6F, 0xD4, 0x42, 0x82, 0x60, 0xEE, 0x56,
-    0x97, 0x55, 0xE4, 0x56, 0x6B, 0x63, 0xD6, 0x77, 0x7B, 0x4F, 0xFB, 0x77, 0x9C, 0x3D, 0xEA, 0x61,
-    0x6F, 0x84, 0xDB, 0x11, 0x7E, 0x6F, 0xFF, 0x2D, 0xA0, 0x5D, 0xEF, 0x49, 0xDF, 0x54, 0x64, 0x27,
-    0xDC, 0x3F, 0x61, 0x7A, 0xDE, 0x47, 0x6A, 0x0C, 0xDD, 0x4C, 0x5B, 0x52, 0xFA, 0x2F, 0x52, 0x63,
-    0xFC, 0x37, 0x5B, 0x8A, 0xFD, 0x44, 0x55, 0x2E, 0xFB, 0x3C, 0x4C, 0x48, 0xD4, 0x5B, 0x91, 0x24,
-    0xD0, 0x2E, 0x8B, 0x7A, 0xD3, 0x35, 0x9A, 0x89, 0xD5, 0x4B, 0x9D, 0x0A, 0xD2, 0x55, 0x82, 0x4F,
-    0xCF, 0x3F, 0x7E, 0x58, 0xF2, 0x1C, 0x7A, 0x61, 0xF5, 0x23, 0x89, 0x6E, 0xF7, 0x39, 0x8C, 0x0B,
-    0xF6, 0x49, 0x80, 0x33, 0xF4, 0x43, 0x71, 0x49, 0xF1, 0x2C, 0x6E, 0x5F, 0x4D, 0x85, 0x6E, 0xA0,
-    0xE6, 0x00, 0x3F, 0x6D, 0x5A, 0x5F, 0xD7, 0x78, 0xD1, 0x14, 0x9B, 0x6D, 0x53, 0xC1, 0x76, 0x1E,
-    0xF4, 0x8C, 0x52, 0x2A, 0x60, 0x9B, 0xDF, 0x08, 0xDA, 0x66, 0xA6, 0x2F, 0xE2, 0x2C, 0x24, 0x59,
-    0xEA, 0x7B, 0x2E, 0x4F, 0xF4, 0x0A, 0x31, 0x66, 0xFF, 0x7B, 0x40, 0x35, 0x47, 0x79, 0xCB, 0x7A,
-    0x3F, 0x93, 0x83, 0xA0, 0x43, 0xBD, 0x89, 0x1D, 0x4C, 0xA3, 0xD1, 0x23, 0x08, 0x8C, 0xEB, 0x78,
-    0x00, 0xD0, 0x90, 0x94, 0x0F, 0xD0, 0xF5, 0x17, 0xD9, 0x23, 0xAF, 0x6F, 0x5F, 0x77, 0xEE, 0x84,
-    0xDD, 0x47, 0xB4, 0x31, 0x4B, 0x89, 0xDD, 0x84, 0x0E, 0xA9, 0xFF, 0x05, 0x23, 0xB8, 0x94, 0x51,
-    0xC0, 0x9F, 0x45, 0x26, 0xB5, 0x36, 0x37, 0x5D, 0xB8, 0xA4, 0x49, 0x1F, 0xAD, 0x3A, 0x3B, 0x72,
-    0x9F, 0x60, 0x0F, 0x76, 0xAE, 0xAA, 0x10, 0x4C, 0xA7, 0xAC, 0x19, 0x06, 0xA6, 0x5E, 0x05, 0x5D,
-    0xA1, 0xAD, 0x09, 0x47, 0x9A, 0x6F, 0x00, 0x58, 0x77, 0x76, 0x71, 0x6B, 0x73, 0xB4, 0x1B, 0x1F,
-    0x7A, 0x9A, 0x76, 0x16, 0x70, 0x98, 0x18, 0x75, 0xAC, 0xFF, 0x92, 0x4D, 0xBF, 0xF2, 0x94, 0x2A,
-    0xA2, 0x9A, 0x84, 0x94, 0xB5, 0x8D, 0x86, 0x46, 0xAF, 0xF7, 0xA7, 0x04, 0xA5, 0x92, 0x99, 0x02,
-    0x3B, 0xA6, 0x30, 0x9F, 0x5A, 0xB1, 0x25, 0x55, 0x52, 0x8F, 0x78, 0x7C, 0x70, 0x8F, 0x6C, 0x46,
-    0x40, 0xDB, 0x37, 0x22, 0x55, 0xAD, 0x7C, 0x17, 0x7F, 0x96, 0x32, 0x8E, 0x96, 0xAB, 0x1F, 0x2D,
-    0x90, 0x73, 0x18, 0x79, 0x74, 0xCF, 0xAB, 0x3D, 0x34, 0x84, 0xF6, 0x3C, 0x5F, 0xAC, 0x3D, 0x3D,
-    0x49, 0x81, 0xF5, 0xBF, 0xE8, 0x6D, 0x2A, 0xC1, 0xCB, 0x9D, 0x81, 0x40, 0x74, 0x61, 0x75, 0x6E,
-    0x74, 0x31, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x54, 0xD4, 0x43,
-    0x84, 0x47, 0xEE, 0x56, 0x99, 0x42, 0xE4, 0x56, 0x6E, 0x44, 0xD6, 0x77, 0x7F, 0x33, 0xFB, 0x7A,
-    0xA0, 0x2A, 0xEA, 0x61, 0x70, 0x68, 0xDB, 0x11, 0x81, 0x56, 0xFF, 0x2D, 0xA2, 0x4E, 0xEF, 0x26,
-    0xE0, 0x58, 0x64, 0x20, 0xDF, 0x40, 0x61, 0x68, 0xE1, 0x49, 0x6A, 0x0C, 0xDF, 0x4E, 0x5B, 0x52,
-    0xFD, 0x39, 0x52, 0x63, 0xFF, 0x42, 0x5B, 0x8B, 0xFF, 0x50, 0x55, 0x2E, 0xFD, 0x47, 0x4C, 0x56,
-    0xD6, 0x5C, 0x91, 0x20, 0xD4, 0x2B, 0x8B, 0x68, 0xD6, 0x32, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A,
-    0xD4, 0x55, 0x82, 0x4E, 0xD2, 0x3C, 0x7E, 0x58, 0xF6, 0x22, 0x7A, 0x62, 0xF8, 0x2A, 0x89, 0x6F,
-    0xFA, 0x42, 0x8C, 0x0B, 0xF8, 0x54, 0x80, 0x29, 0xF6, 0x4C, 0x71, 0x47, 0xF5, 0x33, 0x6E, 0x5F,
-    0x4F, 0x5F, 0x6E, 0x58, 0xEC, 0x00, 0x3F, 0x6D, 0x5D, 0x3A, 0xD7, 0x7A, 0xD6, 0x0F, 0x9B, 0x6D,
-    0x52, 0xA1, 0x76, 0x1D, 0xF3, 0x9A, 0x52, 0x25, 0x61, 0x7D, 0xDF, 0x07, 0xDB, 0x69, 0xA6, 0x2F,
-    0xE5, 0x2E, 0x24, 0x59, 0xEA, 0x85, 0x2E, 0x4F, 0xF8, 0x0F, 0x31, 0x66, 0xFF, 0x8B, 0x40, 0x33,
-    0x4A, 0x50, 0xCB, 0x7A, 0x40, 0x6A, 0x83, 0xA0, 0x43, 0x97, 0x89, 0x1D, 0x4C, 0x7E, 0xD1, 0x06,
-    0x0B, 0x50, 0xEB, 0x78, 0x00, 0x97, 0x90, 0x94, 0x0F, 0x9C, 0xF5, 0x16, 0xDD, 0x21, 0xAF, 0x38,
-    0x62, 0x55, 0xEE, 0x86, 0xDF, 0x4A, 0xB4, 0x31, 0x4D, 0x62, 0xDD, 0x84, 0x0F, 0x71, 0xFF, 0x05,
-    0x23, 0x88, 0x94, 0x51, 0xBF, 0x9F, 0x45, 0x26, 0xB9, 0x2A, 0x37, 0x60, 0xB7, 0xA1, 0x49, 0x1B,
-    0xB1, 0x2C, 0x3B, 0x72, 0xA2, 0x51, 0x0F, 0x78, 0xAD, 0xA4, 0x10, 0x49, 0xA6, 0xA4, 0x19, 0x06,
-    0xA8, 0x51, 0x05, 0x5D, 0x9F, 0xA4, 0x09, 0x1C, 0x9C, 0x5F, 0x00, 0x58, 0x79, 0x5B, 0x71, 0x6C,
-    0x72, 0x9C, 0x1B, 0x1A, 0x7B, 0x83, 0x76, 0x16, 0x71, 0x7D, 0x18, 0x75, 0xA7, 0xFF, 0x92, 0x4D,
-    0xBA, 0xF7, 0x94, 0x2C, 0xA2, 0x90, 0x84, 0x94, 0xB5, 0x88, 0x86, 0x46, 0xAA, 0xF8, 0xA7, 0x04,
-    0xA5, 0x88, 0x99, 0x7F, 0x3C, 0x7C, 0x30, 0x9F, 0x5A, 0x92, 0x25, 0x55, 0x54, 0x6B, 0x78, 0x7D,
-    0x71, 0x74, 0x6C, 0x46, 0x3F, 0xB7, 0x37, 0x1B, 0x55, 0x8C, 0x7C, 0x18, 0x7F, 0x80, 0x32, 0x8E,
-    0x95, 0x9E, 0x1F, 0x2D, 0x92, 0x60, 0x18, 0x6A, 0x7B, 0xF6, 0xAC, 0x3D, 0xF2, 0x89, 0xE5, 0x3C,
-    0x57, 0xAC, 0x3D, 0x3D, 0xC4, 0x69, 0x69, 0xC0, 0x95, 0x47, 0xFF, 0xC0, 0x63, 0x5C, 0xAC, 0x40,
-    0x77, 0x61, 0x76, 0x65, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x79, 0x3B, 0xD4, 0x41, 0x86, 0x31, 0xEE, 0x56, 0x9B, 0x31, 0xE4, 0x56, 0x70, 0x28, 0xD6, 0x7A,
-    0x80, 0x1A, 0xFB, 0x7A, 0xA2, 0x1A, 0xEA, 0x62, 0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08,
-    0xA3, 0x40, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C,
-    0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A,
-    0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87,
-    0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62,
-    0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47,
-    0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x19, 0xD7, 0x7A,
-    0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1A, 0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07,
-    0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42,
-    0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x44, 0x83, 0xA0, 0x42, 0x75, 0x89, 0x1A,
-    0x4C, 0x5D, 0xD1, 0x06, 0x0D, 0x1B, 0xEB, 0x78, 0x00, 0x64, 0x90, 0x94, 0x0F, 0x6D, 0xF5, 0x16,
-    0xDF, 0x20, 0xAF, 0x38, 0x63, 0x37, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x3F, 0xDD, 0x84,
-    0x10, 0x3F, 0xFF, 0x05, 0x23, 0x5D, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60,
-    0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49,
-    0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58,
-    0x79, 0x43, 0x71, 0x6C, 0x71, 0x88, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77,
-    0xA2, 0xFF, 0x92, 0x9E, 0xB5, 0xFB, 0x94, 0x2C, 0xA0, 0x86, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x3F,
-    0xA5, 0xF8, 0xA7, 0x01, 0xA3, 0x7F, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56,
-    0x54, 0x4A, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6E, 0x7C, 0x18,
-    0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A, 0x49, 0x87, 0xA3, 0x3D,
-    0xA9, 0xDE, 0x02, 0x3D, 0x41, 0x6F, 0x57, 0x3D, 0x69, 0xD3, 0x05, 0xC0, 0x72, 0x9A, 0xDF, 0xC0,
-    0x5C, 0xB3, 0x93, 0x40, 0x77, 0x61, 0x76, 0x65, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x6B, 0xC1, 0x42, 0x8C, 0x58, 0xD4, 0x53, 0xA0, 0x4D, 0xC6, 0x53,
-    0x73, 0x60, 0xC5, 0x77, 0x86, 0x47, 0xE0, 0x78, 0xA6, 0x34, 0xCA, 0x67, 0x77, 0x80, 0xC9, 0x03,
-    0x8A, 0x67, 0xE4, 0x2D, 0xAB, 0x54, 0xCE, 0x49, 0xE0, 0x52, 0x47, 0x27, 0xDD, 0x3D, 0x44, 0x7A,
-    0xE0, 0x45, 0x4B, 0x0C, 0xDD, 0x4B, 0x3F, 0x52, 0xFB, 0x2D, 0x30, 0x63, 0xFE, 0x34, 0x38, 0x8A,
-    0xFE, 0x42, 0x33, 0x2E, 0xFB, 0x3A, 0x2B, 0x48, 0xD9, 0x57, 0x70, 0x24, 0xD3, 0x2A, 0x6B, 0x73,
-    0xD8, 0x2F, 0x77, 0x87, 0xDB, 0x45, 0x7A, 0x0D, 0xD5, 0x52, 0x64, 0x4E, 0xD2, 0x3B, 0x61, 0x57,
-    0xF5, 0x17, 0x54, 0x61, 0xF9, 0x1C, 0x61, 0x6E, 0xFC, 0x32, 0x64, 0x3B, 0xFB, 0x44, 0x5A, 0x33,
-    0xF7, 0x3F, 0x4D, 0x47, 0xF4, 0x28, 0x4A, 0x60, 0x4B, 0x8D, 0x71, 0xA0, 0xE4, 0x00, 0x22, 0x69,
-    0x61, 0x5D, 0xC9, 0x78, 0xD6, 0x0E, 0x78, 0x6D, 0x53, 0xC8, 0x79, 0x1F, 0xF6, 0x8B, 0x34, 0x2A,
-    0x68, 0x98, 0xD1, 0x08, 0xE0, 0x60, 0x82, 0x2A, 0xDE, 0x2F, 0x0D, 0x59, 0xE8, 0x7E, 0x17, 0x4F,
-    0xF0, 0x0B, 0x13, 0x5F, 0xFF, 0x7B, 0x22, 0x33, 0x4D, 0x79, 0xC4, 0x7A, 0x3F, 0x9A, 0x88, 0x98,
-    0x44, 0xC3, 0x8D, 0x1D, 0x53, 0xA2, 0xC9, 0x23, 0x0F, 0x8D, 0xEE, 0x78, 0x00, 0xDB, 0xA3, 0x8D,
-    0x18, 0xD1, 0xF7, 0x17, 0xE0, 0x1B, 0x88, 0x36, 0x68, 0x72, 0xDD, 0x86, 0xE5, 0x3F, 0x8D, 0x3C,
-    0x53, 0x87, 0xD3, 0x84, 0x16, 0xA8, 0xFF, 0x05, 0x24, 0xC0, 0x9D, 0x51, 0xBF, 0xA3, 0x36, 0x26,
-    0xB1, 0x3A, 0x28, 0x59, 0xB7, 0xA8, 0x3B, 0x22, 0xA9, 0x3F, 0x2D, 0x72, 0x98, 0x6A, 0x0B, 0x7D,
-    0xA8, 0xB4, 0x0B, 0x4B, 0xA2, 0xB5, 0x15, 0x08, 0x9E, 0x68, 0x02, 0x5D, 0x9A, 0xB9, 0x08, 0x1C,
-    0x92, 0x7B, 0x00, 0x57, 0x77, 0x7A, 0x6B, 0x6B, 0x6C, 0xC0, 0x23, 0x1B, 0x7B, 0x9E, 0x6F, 0x16,
-    0x69, 0xA4, 0x1F, 0x76, 0xB2, 0xFF, 0x80, 0x4D, 0xC5, 0xF0, 0x7D, 0x2B, 0xA5, 0x9B, 0x72, 0x8D,
-    0xB8, 0x8C, 0x70, 0x46, 0xB6, 0xF5, 0x91, 0x04, 0xA9, 0x91, 0x84, 0x02, 0x34, 0xB4, 0x41, 0xA1,
-    0x54, 0xBE, 0x31, 0x56, 0x52, 0x95, 0x7A, 0x7C, 0x70, 0x94, 0x69, 0x44, 0x3B, 0xE9, 0x47, 0x22,
-    0x56, 0xB3, 0x7E, 0x07, 0x7A, 0x9F, 0x33, 0x90, 0x91, 0xB5, 0x1E, 0x2D, 0x8A, 0x7D, 0x17, 0x79,
-    0x0B, 0x66, 0x90, 0x3D, 0x91, 0xF0, 0x27, 0x3D, 0x5C, 0xA1, 0x71, 0x3D, 0x70, 0xE1, 0x01, 0xC0,
-    0x67, 0xB2, 0x69, 0xC1, 0x6C, 0x76, 0xBE, 0x3F, 0x77, 0x61, 0x76, 0x65, 0x30, 0x33, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x71, 0xB2, 0x5F, 0x90, 0x5C, 0xC1, 0x53,
-    0xA4, 0x4B, 0xB0, 0x53, 0x74, 0x6D, 0xB8, 0x76, 0x89, 0x50, 0xCC, 0x76, 0xA8, 0x36, 0xB2, 0x71,
-    0x7C, 0x83, 0xBB, 0x03, 0x91, 0x66, 0xCF, 0x2F, 0xB1, 0x4C, 0xB5, 0x49, 0xDD, 0x3D, 0x33, 0x2C,
-    0xD7, 0x2F, 0x31, 0x77, 0xDC, 0x32, 0x37, 0x85, 0xD8, 0x3A, 0x2D, 0x51, 0xF4, 0x17, 0x19, 0x5C,
-    0xF8, 0x1A, 0x1F, 0x6E, 0xF9, 0x25, 0x1B, 0x33, 0xF5, 0x22, 0x15, 0x48, 0xDA, 0x41, 0x59, 0x2C,
-    0xCF, 0x22, 0x54, 0x77, 0xD5, 0x23, 0x5F, 0x88, 0xDB, 0x32, 0x61, 0x31, 0xD4, 0x40, 0x4F, 0x4D,
-    0xCE, 0x30, 0x4C, 0x9A, 0xEF, 0x06, 0x3A, 0x5A, 0xF5, 0x07, 0x44, 0x70, 0xFB, 0x17, 0x46, 0x3A,
-    0xFA, 0x25, 0x3E, 0x3F, 0xF4, 0x24, 0x34, 0x49, 0xEE, 0x15, 0x31, 0x54, 0x45, 0xA7, 0x77, 0x98,
-    0xD5, 0x00, 0x11, 0x68, 0x60, 0x73, 0xBF, 0x78, 0xD0, 0x0B, 0x5F, 0x68, 0x55, 0xD0, 0x7D, 0x1E,
-    0xF9, 0x60, 0x1F, 0x29, 0x70, 0x9C, 0xC6, 0x2D, 0xE5, 0x43, 0x67, 0x2E, 0xD1, 0x28, 0x00, 0x57,
-    0xE5, 0x5F, 0x08, 0x4F, 0xE2, 0x04, 0x01, 0x60, 0xFF, 0x51, 0x0D, 0x34, 0x4E, 0x91, 0xBF, 0x77,
-    0x3B, 0xB5, 0x8E, 0x9B, 0x46, 0xD1, 0x92, 0x1E, 0x58, 0xAD, 0xC3, 0x2D, 0x10, 0xB8, 0xF1, 0x7D,
-    0x00, 0xFF, 0xB3, 0x12, 0x22, 0xE7, 0xF8, 0x06, 0xDE, 0x0E, 0x6C, 0x64, 0x6D, 0x7E, 0xD0, 0x86,
-    0xE7, 0x27, 0x70, 0x3C, 0x57, 0x98, 0xCB, 0x84, 0x1D, 0xC8, 0xFF, 0x0C, 0x24, 0xDB, 0xA7, 0x4E,
-    0xBF, 0x8A, 0x2C, 0x26, 0xA4, 0x42, 0x21, 0x59, 0xB8, 0x91, 0x32, 0x20, 0x9D, 0x48, 0x27, 0x75,
-    0x8B, 0x73, 0x0D, 0x7D, 0xA4, 0xA4, 0x0B, 0x4B, 0x9E, 0xA7, 0x15, 0x2D, 0x90, 0x70, 0x03, 0x58,
-    0x94, 0xAE, 0x0B, 0x26, 0x84, 0x83, 0x05, 0x9A, 0x72, 0x86, 0x68, 0x6B, 0x66, 0xC6, 0x2C, 0x22,
-    0x7B, 0x9F, 0x6C, 0x17, 0x5F, 0xB2, 0x29, 0x7B, 0xC2, 0xD0, 0x71, 0x1D, 0xD6, 0xBD, 0x6A, 0x3D,
-    0xA9, 0x8A, 0x66, 0x12, 0xBC, 0x77, 0x60, 0x44, 0xC8, 0xC6, 0x7F, 0x0E, 0xAE, 0x80, 0x75, 0x84,
-    0x2B, 0xD3, 0x51, 0xA1, 0x4D, 0xCE, 0x3D, 0x56, 0x4E, 0xAA, 0x7D, 0x7C, 0x6D, 0x9D, 0x68, 0x44,
-    0x38, 0xF7, 0x57, 0x21, 0x56, 0xBF, 0x80, 0x08, 0x74, 0xA5, 0x37, 0x10, 0x8C, 0xAD, 0x20, 0x2F,
-    0x7E, 0x87, 0x1B, 0x79, 0xA1, 0x3E, 0x84, 0x3D, 0x2C, 0x6F, 0x3C, 0x3D, 0x79, 0x65, 0x80, 0x3D,
-    0x84, 0x34, 0x50, 0xC1, 0xE5, 0xB6, 0x87, 0xC1, 0xAD, 0x03, 0x05, 0xC0, 0x77, 0x61, 0x76, 0x65,
-    0x30, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x6D, 0xAF, 0x5F,
-    0x92, 0x57, 0xBB, 0x53, 0xA5, 0x46, 0xAA, 0x53, 0x75, 0x6B, 0xB5, 0x76, 0x8A, 0x4E, 0xC6, 0x76,
-    0xA9, 0x32, 0xAA, 0x71, 0x7F, 0x7E, 0xB7, 0x09, 0x95, 0x60, 0xC8, 0x30, 0xB4, 0x44, 0xAD, 0x49,
-    0xDB, 0x34, 0x30, 0x2C, 0xD4, 0x28, 0x2E, 0x77, 0xDA, 0x2B, 0x33, 0x85, 0xD5, 0x32, 0x2A, 0x51,
-    0xF0, 0x0F, 0x15, 0x5B, 0xF5, 0x12, 0x1B, 0x8A, 0xF7, 0x1B, 0x17, 0x34, 0xF1, 0x19, 0x12, 0x4F,
-    0xDB, 0x36, 0x54, 0x2C, 0xCC, 0x1D, 0x50, 0x77, 0xD3, 0x1C, 0x59, 0x88, 0xDB, 0x29, 0x5B, 0x31,
-    0xD3, 0x37, 0x4A, 0x4D, 0xCC, 0x2A, 0x48, 0x9A, 0xEB, 0x00, 0x34, 0x5B, 0xF3, 0x00, 0x3D, 0x6D,
-    0xFA, 0x0D, 0x3F, 0x3A, 0xFA, 0x1A, 0x38, 0x46, 0xF2, 0x1A, 0x2E, 0x49, 0xEB, 0x0E, 0x2C, 0x54,
-    0x42, 0xA8, 0x7C, 0x98, 0xCC, 0x00, 0x10, 0x73, 0x60, 0x73, 0xBD, 0x78, 0xCC, 0x08, 0x5A, 0x68,
-    0x55, 0xCA, 0x81, 0x27, 0xFA, 0x4F, 0x1B, 0x33, 0x74, 0x95, 0xC2, 0x2D, 0xE7, 0x36, 0x60, 0x33,
-    0xC9, 0x25, 0x00, 0x50, 0xE3, 0x52, 0x07, 0x4F, 0xDA, 0x02, 0x00, 0x60, 0xFF, 0x42, 0x09, 0x46,
-    0x4D, 0x91, 0xBF, 0x76, 0x39, 0xB5, 0x92, 0x9B, 0x46, 0xCC, 0x96, 0x1E, 0x5B, 0xA8, 0xC2, 0x2F,
-    0x10, 0xBB, 0xF3, 0x7D, 0x00, 0xFF, 0xBA, 0x14, 0x27, 0xE2, 0xF9, 0x08, 0xDC, 0x09, 0x65, 0x70,
-    0x70, 0x7B, 0xCC, 0x86, 0xE8, 0x1D, 0x68, 0x39, 0x59, 0x95, 0xCA, 0x86, 0x20, 0xC7, 0xFF, 0x0C,
-    0x24, 0xDA, 0xAC, 0x4E, 0xC0, 0x7D, 0x2C, 0x28, 0x9D, 0x41, 0x23, 0x57, 0xB8, 0x84, 0x32, 0x20,
-    0x95, 0x48, 0x2A, 0x96, 0x83, 0x72, 0x13, 0x7C, 0xA2, 0x99, 0x10, 0x4B, 0x9C, 0x9D, 0x19, 0x2D,
-    0x89, 0x6E, 0x09, 0x58, 0x92, 0xA5, 0x11, 0x26, 0x7D, 0x81, 0x0C, 0x9A, 0x6F, 0x84, 0x6B, 0x79,
-    0x63, 0xC0, 0x33, 0x20, 0x7B, 0x99, 0x6E, 0x06, 0x5A, 0xB0, 0x31, 0x7B, 0xCC, 0xB9, 0x6D, 0x1D,
-    0xDF, 0xA5, 0x65, 0x3D, 0xAA, 0x7F, 0x65, 0x14, 0xBE, 0x6B, 0x5D, 0x66, 0xD2, 0xAE, 0x7A, 0x0E,
-    0xB0, 0x75, 0x72, 0x05, 0x26, 0xD4, 0x5B, 0x96, 0x49, 0xCB, 0x46, 0x53, 0x4C, 0xA9, 0x81, 0x7E,
-    0x6B, 0x99, 0x6B, 0x66, 0x37, 0xF2, 0x5F, 0x21, 0x55, 0xBA, 0x84, 0x08, 0x70, 0xA1, 0x3D, 0x11,
-    0x8A, 0xA5, 0x25, 0x30, 0x77, 0x85, 0x21, 0x79, 0xF2, 0xE4, 0x86, 0x3D, 0x75, 0x6F, 0x38, 0x3D,
-    0x59, 0x93, 0x7D, 0x3D, 0x8C, 0x5D, 0x36, 0xC1, 0x99, 0xFB, 0x75, 0xC1, 0x6A, 0xA9, 0x33, 0xBE,
-    0x77, 0x61, 0x76, 0x65, 0x30, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x82, 0x6E, 0xAF, 0x5F, 0x92, 0x58, 0xBC, 0x53, 0xA5, 0x47, 0xAB, 0x53, 0x74, 0x6C, 0xB5, 0x76,
-    0x8A, 0x4E, 0xC7, 0x76, 0xA9, 0x33, 0xAC, 0x71, 0x7F, 0x7F, 0xB8, 0x09, 0x94, 0x61, 0xCA, 0x30,
-    0xB3, 0x46, 0xAF, 0x49, 0xDB, 0x36, 0x30, 0x2C, 0xD5, 0x29, 0x2E, 0x77, 0xDA, 0x2C, 0x34, 0x85,
-    0xD6, 0x33, 0x2A, 0x99, 0xF1, 0x11, 0x16, 0x5B, 0xF6, 0x13, 0x1B, 0x6E, 0xF7, 0x1D, 0x18, 0x33,
-    0xF2, 0x1A, 0x12, 0x48, 0xDA, 0x38, 0x54, 0x2C, 0xCC, 0x1E, 0x51, 0x77, 0xD4, 0x1E, 0x5A, 0x88,
-    0xDB, 0x2B, 0x5C, 0x31, 0xD3, 0x38, 0x4B, 0x4D, 0xCC, 0x2B, 0x49, 0x9A, 0xEC, 0x01, 0x35, 0x5B,
-    0xF3, 0x01, 0x3E, 0x6D, 0xFA, 0x0F, 0x40, 0x3A, 0xFA, 0x1C, 0x39, 0x3F, 0xF3, 0x1C, 0x2F, 0x49,
-    0xEC, 0x0F, 0x2D, 0x54, 0x42, 0xA8, 0x7B, 0x98, 0xCE, 0x00, 0x10, 0x73, 0x60, 0x73, 0xBE, 0x78,
-    0xCD, 0x08, 0x5A, 0x68, 0x55, 0xCB, 0x80, 0x1E, 0xFA, 0x52, 0x1C, 0x33, 0x73, 0x96, 0xC3, 0x2D,
-    0xE7, 0x39, 0x62, 0x33, 0xCB, 0x25, 0x00, 0x50, 0xE4, 0x54, 0x07, 0x4F, 0xDC, 0x02, 0x00, 0x60,
-    0xFF, 0x44, 0x0A, 0x46, 0x4D, 0x91, 0xBF, 0x76, 0x39, 0xB5, 0x91, 0x9B, 0x46, 0xCD, 0x95, 0x1E,
-    0x5B, 0xA9, 0xC2, 0x2F, 0x10, 0xBB, 0xF2, 0x7D, 0x00, 0xFF, 0xB9, 0x14, 0x26, 0xE3, 0xF8, 0x06,
-    0xDD, 0x0A, 0x66, 0x70, 0x6F, 0x7B, 0xCC, 0x86, 0xE8, 0x1F, 0x69, 0x39, 0x58, 0x96, 0xCA, 0x86,
-    0x1F, 0xC8, 0xFF, 0x0C, 0x24, 0xDA, 0xAB, 0x4E, 0xC0, 0x80, 0x2B, 0x28, 0x9E, 0x41, 0x22, 0x57,
-    0xB8, 0x87, 0x32, 0x20, 0x97, 0x48, 0x29, 0x96, 0x85, 0x72, 0x12, 0x7C, 0xA2, 0x9B, 0x0E, 0x4B,
-    0x9D, 0x9E, 0x18, 0x2D, 0x8A, 0x6E, 0x08, 0x58, 0x92, 0xA6, 0x10, 0x26, 0x7F, 0x81, 0x0A, 0x9A,
-    0x6F, 0x85, 0x6A, 0x79, 0x64, 0xC1, 0x32, 0x20, 0x7B, 0x9A, 0x6D, 0x06, 0x5B, 0xB0, 0x2F, 0x7B,
-    0xCA, 0xBD, 0x6E, 0x1D, 0xDD, 0xA9, 0x66, 0x3D, 0xAA, 0x81, 0x65, 0x14, 0xBD, 0x6E, 0x5D, 0x66,
-    0xD0, 0xB2, 0x7B, 0x0E, 0xB0, 0x77, 0x72, 0x84, 0x27, 0xD3, 0x59, 0x96, 0x4A, 0xCB, 0x44, 0x56,
-    0x4C, 0xA9, 0x80, 0x7E, 0x6B, 0x9A, 0x6A, 0x66, 0x37, 0xF3, 0x5E, 0x21, 0x56, 0xBB, 0x83, 0x08,
-    0x71, 0xA2, 0x3B, 0x11, 0x8A, 0xA6, 0x24, 0x30, 0x79, 0x85, 0x1F, 0x79, 0xCB, 0x9D, 0x8D, 0x3D,
-    0x6B, 0x3B, 0x2D, 0x3D, 0x73, 0x5D, 0x75, 0x3D, 0xFD, 0x07, 0x19, 0xC1, 0x0E, 0xAE, 0x6C, 0xC1,
-    0xB4, 0x9B, 0x91, 0x3F, 0x77, 0x61, 0x76, 0x65, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x81, 0x70, 0xB1, 0x5F, 0x90, 0x5B, 0xBF, 0x53, 0xA4, 0x4A, 0xAE, 0x53,
-    0x74, 0x6D, 0xB7, 0x76, 0x89, 0x50, 0xCA, 0x76, 0xA9, 0x35, 0xB0, 0x71, 0x7D, 0x82, 0xBA, 0x03,
-    0x92, 0x65, 0xCD, 0x2F, 0xB1, 0x4A, 0xB3, 0x49, 0xDC, 0x3B, 0x32, 0x27, 0xD7, 0x2D, 0x30, 0x77,
-    0xDB, 0x30, 0x36, 0x85, 0xD8, 0x38, 0x2C, 0x51, 0xF3, 0x15, 0x18, 0x5C, 0xF8, 0x18, 0x1E, 0x6E,
-    0xF9, 0x23, 0x1A, 0x33, 0xF4, 0x1F, 0x14, 0x4F, 0xDA, 0x3E, 0x58, 0x2C, 0xCE, 0x20, 0x53, 0x77,
-    0xD5, 0x21, 0x5D, 0x88, 0xDB, 0x30, 0x60, 0x31, 0xD4, 0x3D, 0x4D, 0x4D, 0xCD, 0x2E, 0x4B, 0x9A,
-    0xEE, 0x05, 0x38, 0x5A, 0xF5, 0x05, 0x42, 0x6D, 0xFB, 0x14, 0x44, 0x3A, 0xFA, 0x22, 0x3C, 0x3F,
-    0xF4, 0x22, 0x32, 0x49, 0xED, 0x13, 0x30, 0x54, 0x44, 0xA7, 0x78, 0x98, 0xD3, 0x00, 0x11, 0x68,
-    0x60, 0x73, 0xBF, 0x78, 0xCF, 0x0A, 0x5E, 0x68, 0x55, 0xCE, 0x7E, 0x1E, 0xF9, 0x5C, 0x1E, 0x29,
-    0x71, 0x9A, 0xC5, 0x2D, 0xE5, 0x3F, 0x66, 0x2E, 0xCF, 0x27, 0x00, 0x57, 0xE5, 0x5B, 0x08, 0x4F,
-    0xE0, 0x03, 0x01, 0x60, 0xFF, 0x4D, 0x0C, 0x46, 0x4E, 0x91, 0xBF, 0x77, 0x3A, 0xB5, 0x8F, 0x9B,
-    0x46, 0xD0, 0x93, 0x1E, 0x59, 0xAC, 0xC3, 0x2D, 0x10, 0xB9, 0xF2, 0x7D, 0x00, 0xFF, 0xB5, 0x12,
-    0x23, 0xE6, 0xF8, 0x06, 0xDD, 0x0D, 0x6A, 0x70, 0x6E, 0x7D, 0xCF, 0x86, 0xE7, 0x25, 0x6E, 0x39,
-    0x57, 0x97, 0xCB, 0x84, 0x1E, 0xC8, 0xFF, 0x0C, 0x24, 0xDB, 0xA8, 0x4E, 0xC0, 0x87, 0x2C, 0x26,
-    0xA3, 0x41, 0x21, 0x59, 0xB8, 0x8E, 0x32, 0x20, 0x9B, 0x48, 0x28, 0x75, 0x89, 0x73, 0x0F, 0x7D,
-    0xA3, 0xA1, 0x0C, 0x4B, 0x9E, 0xA4, 0x16, 0x2D, 0x8F, 0x6F, 0x05, 0x58, 0x94, 0xAB, 0x0D, 0x26,
-    0x83, 0x82, 0x06, 0x9A, 0x71, 0x86, 0x69, 0x79, 0x66, 0xC4, 0x2E, 0x20, 0x7B, 0x9E, 0x6C, 0x17,
-    0x5E, 0xB1, 0x2B, 0x7B, 0xC5, 0xCA, 0x70, 0x1D, 0xD8, 0xB6, 0x69, 0x3D, 0xA9, 0x87, 0x66, 0x12,
-    0xBC, 0x74, 0x5F, 0x44, 0xCA, 0xBF, 0x7E, 0x0E, 0xAF, 0x7D, 0x74, 0x84, 0x2A, 0xD3, 0x54, 0xA1,
-    0x4C, 0xCD, 0x40, 0x56, 0x4D, 0xA9, 0x7E, 0x7E, 0x6C, 0x9C, 0x69, 0x66, 0x38, 0xF5, 0x59, 0x21,
-    0x56, 0xBD, 0x81, 0x08, 0x73, 0xA4, 0x38, 0x11, 0x8C, 0xAB, 0x22, 0x30, 0x7C, 0x86, 0x1C, 0x79,
-    0xCE, 0x48, 0x96, 0x3D, 0x7A, 0x1F, 0x1B, 0x3D, 0xFB, 0xC4, 0x68, 0x3D, 0xA2, 0x37, 0xF8, 0xC0,
-    0x79, 0x20, 0x64, 0xC1, 0x76, 0x4B, 0x1B, 0x40, 0x77, 0x61, 0x76, 0x65, 0x30, 0x37, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x74, 0xB5, 0x42, 0x8F, 0x5F, 0xC5, 0x53,
-    0xA3, 0x4E, 0xB4, 0x53, 0x74, 0x6E, 0xBA, 0x76, 0x88, 0x51, 0xD0, 0x78, 0xA8, 0x38, 0xB6, 0x5A,
-    0x7B, 0x87, 0xBE, 0x03, 0x8F, 0x6A, 0xD4, 0x2F, 0xAF, 0x50, 0xBA, 0x49, 0xDE, 0x44, 0x35, 0x27,
-    0xD9, 0x33, 0x33, 0x7A, 0xDD, 0x38, 0x39, 0x0B, 0xDA, 0x3F, 0x2F, 0x50, 0xF6, 0x1C, 0x1C, 0x5C,
-    0xFA, 0x21, 0x22, 0x8A, 0xFA, 0x2D, 0x1E, 0x33, 0xF6, 0x28, 0x18, 0x4F, 0xDA, 0x47, 0x5D, 0x2C,
-    0xD0, 0x25, 0x58, 0x77, 0xD6, 0x27, 0x63, 0x88, 0xDB, 0x38, 0x65, 0x31, 0xD4, 0x45, 0x51, 0x4D,
-    0xCF, 0x34, 0x4F, 0xA0, 0xF1, 0x0A, 0x3D, 0x5A, 0xF6, 0x0C, 0x49, 0x6E, 0xFB, 0x1E, 0x4B, 0x3B,
-    0xFB, 0x2D, 0x42, 0x3F, 0xF5, 0x2B, 0x37, 0x49, 0xF0, 0x1A, 0x35, 0x54, 0x47, 0xA6, 0x74, 0x98,
-    0xD9, 0x00, 0x12, 0x68, 0x61, 0x72, 0xC1, 0x78, 0xD2, 0x0C, 0x63, 0x68, 0x54, 0xD5, 0x7B, 0x1E,
-    0xF8, 0x6C, 0x22, 0x29, 0x6E, 0xA0, 0xC8, 0x2D, 0xE4, 0x4B, 0x6C, 0x2E, 0xD4, 0x2A, 0x00, 0x57,
-    0xE6, 0x68, 0x09, 0x4F, 0xE6, 0x05, 0x02, 0x60, 0xFF, 0x5C, 0x0F, 0x34, 0x4D, 0x91, 0xBF, 0x77,
-    0x3C, 0xB5, 0x8B, 0x98, 0x45, 0xD4, 0x90, 0x1E, 0x57, 0xB1, 0xC4, 0x2D, 0x10, 0xB5, 0xF0, 0x76,
-    0x00, 0xFF, 0xAE, 0x12, 0x1F, 0xEA, 0xF8, 0x06, 0xDE, 0x12, 0x71, 0x64, 0x6C, 0x80, 0xD2, 0x86,
-    0xE6, 0x2E, 0x75, 0x3C, 0x56, 0x99, 0xCD, 0x84, 0x1B, 0xC8, 0xFF, 0x0C, 0x24, 0xDC, 0xA3, 0x4E,
-    0xBF, 0x94, 0x2C, 0x26, 0xA8, 0x42, 0x20, 0x59, 0xB8, 0x9A, 0x32, 0x20, 0xA0, 0x48, 0x26, 0x75,
-    0x8E, 0x74, 0x0A, 0x7D, 0xA5, 0xAC, 0x08, 0x4B, 0x9F, 0xAF, 0x12, 0x2D, 0x94, 0x71, 0x00, 0x58,
-    0x96, 0xB5, 0x08, 0x1C, 0x88, 0x85, 0x01, 0x9A, 0x73, 0x88, 0x67, 0x6B, 0x68, 0xCA, 0x28, 0x22,
-    0x7B, 0xA4, 0x6B, 0x17, 0x62, 0xB4, 0x24, 0x74, 0xBE, 0xE0, 0x73, 0x1D, 0xD1, 0xCD, 0x6D, 0x29,
-    0xA8, 0x92, 0x68, 0x12, 0xBB, 0x7F, 0x62, 0x44, 0xC3, 0xD6, 0x82, 0x0E, 0xAD, 0x88, 0x77, 0x84,
-    0x2D, 0xD2, 0x4B, 0xA1, 0x4F, 0xD0, 0x38, 0x56, 0x4F, 0xAB, 0x7B, 0x7C, 0x6E, 0xA0, 0x67, 0x44,
-    0x39, 0xFB, 0x51, 0x21, 0x56, 0xC2, 0x7E, 0x06, 0x75, 0xA9, 0x34, 0x10, 0x8E, 0xB4, 0x1D, 0x2F,
-    0x81, 0x88, 0x17, 0x79, 0x1D, 0xCA, 0x9E, 0x3D, 0xA8, 0xED, 0x05, 0x3D, 0x33, 0xA7, 0x5E, 0x3D,
-    0xB1, 0x26, 0xC5, 0xC0, 0x9C, 0xA4, 0x57, 0xC1, 0x02, 0x36, 0x4D, 0x40, 0x77, 0x61, 0x76, 0x65,
-    0x30, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x76, 0xBB, 0x42,
-    0x8D, 0x61, 0xCD, 0x53, 0xA1, 0x53, 0xBE, 0x53, 0x73, 0x6D, 0xC0, 0x76, 0x87, 0x51, 0xD9, 0x78,
-    0xA7, 0x39, 0xC1, 0x67, 0x79, 0x8B, 0xC4, 0x03, 0x8C, 0x6F, 0xDD, 0x2D, 0xAC, 0x58, 0xC5, 0x49,
-    0xDF, 0x50, 0x3F, 0x27, 0xDC, 0x3C, 0x3C, 0x7A, 0xDF, 0x42, 0x43, 0x0B, 0xDC, 0x4A, 0x38, 0x50,
-    0xF9, 0x27, 0x27, 0x5C, 0xFC, 0x2E, 0x2E, 0x8A, 0xFC, 0x3B, 0x2A, 0x33, 0xF9, 0x35, 0x22, 0x48,
-    0xDA, 0x55, 0x68, 0x24, 0xD2, 0x2A, 0x62, 0x73, 0xD7, 0x2E, 0x6E, 0x88, 0xDB, 0x43, 0x71, 0x0D,
-    0xD5, 0x51, 0x5B, 0x4E, 0xD1, 0x3B, 0x59, 0x57, 0xF3, 0x12, 0x4A, 0x61, 0xF8, 0x16, 0x56, 0x6E,
-    0xFC, 0x2B, 0x59, 0x3B, 0xFB, 0x3D, 0x4F, 0x3F, 0xF6, 0x39, 0x43, 0x47, 0xF2, 0x24, 0x41, 0x60,
-    0x4A, 0xA2, 0x72, 0xA0, 0xDF, 0x00, 0x1B, 0x68, 0x61, 0x6D, 0xC5, 0x78, 0xD4, 0x0E, 0x6E, 0x6D,
-    0x54, 0xDA, 0x7A, 0x1E, 0xF7, 0x84, 0x2C, 0x2A, 0x6B, 0xA6, 0xCD, 0x08, 0xE2, 0x5B, 0x78, 0x2E,
-    0xDA, 0x2F, 0x07, 0x59, 0xE7, 0x7B, 0x11, 0x4F, 0xEC, 0x08, 0x0C, 0x5E, 0xFF, 0x73, 0x1A, 0x34,
-    0x4D, 0x8C, 0xC2, 0x77, 0x3E, 0xB0, 0x89, 0x98, 0x44, 0xD7, 0x8E, 0x1D, 0x54, 0xB3, 0xC7, 0x23,
-    0x0F, 0xA9, 0xEF, 0x78, 0x00, 0xF9, 0xA8, 0x12, 0x1B, 0xEA, 0xF7, 0x17, 0xDF, 0x18, 0x7E, 0x6F,
-    0x6A, 0x80, 0xD8, 0x86, 0xE5, 0x3B, 0x82, 0x3C, 0x54, 0x98, 0xD0, 0x84, 0x18, 0xC2, 0xFF, 0x05,
-    0x24, 0xD9, 0xA0, 0x51, 0xBF, 0xA5, 0x31, 0x26, 0xAE, 0x41, 0x24, 0x59, 0xB7, 0xAB, 0x37, 0x22,
-    0xA6, 0x47, 0x2A, 0x75, 0x94, 0x75, 0x0A, 0x7D, 0xA7, 0xBA, 0x0A, 0x4B, 0xA1, 0xBC, 0x14, 0x08,
-    0x9A, 0x72, 0x01, 0x5D, 0x98, 0xC1, 0x08, 0x1C, 0x8E, 0x86, 0x00, 0x57, 0x75, 0x88, 0x69, 0x6B,
-    0x6B, 0xD0, 0x25, 0x1F, 0x7B, 0xAA, 0x6D, 0x17, 0x66, 0xB5, 0x21, 0x74, 0xB7, 0xFF, 0x7A, 0x4D,
-    0xCA, 0xED, 0x76, 0x29, 0xA6, 0xA0, 0x6E, 0x8D, 0xB9, 0x8E, 0x69, 0x44, 0xBB, 0xF4, 0x8B, 0x04,
-    0xAB, 0x95, 0x7E, 0x84, 0x31, 0xCD, 0x45, 0xA1, 0x52, 0xD2, 0x34, 0x56, 0x51, 0xA8, 0x7A, 0x7C,
-    0x6F, 0xA3, 0x68, 0x44, 0x3A, 0xFF, 0x4C, 0x22, 0x56, 0xC5, 0x7E, 0x07, 0x78, 0xAD, 0x33, 0x10,
-    0x8F, 0xBE, 0x1E, 0x32, 0x86, 0x89, 0x17, 0x79, 0xF5, 0x7D, 0xA5, 0x3D, 0x1B, 0x00, 0x01, 0x3D,
-    0x0B, 0xA7, 0x53, 0x3D, 0x54, 0x80, 0x9A, 0xC0, 0xD7, 0xEF, 0x45, 0xC1, 0x40, 0x94, 0x6A, 0x40,
-    0x77, 0x61, 0x76, 0x65, 0x30, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x64, 0xC3, 0x42, 0x8B, 0x54, 0xD8, 0x53, 0xA0, 0x49, 0xCB, 0x53, 0x73, 0x58, 0xC7, 0x77,
-    0x85, 0x41, 0xE4, 0x7A, 0xA6, 0x31, 0xCE, 0x61, 0x76, 0x79, 0xCB, 0x11, 0x89, 0x62, 0xE8, 0x2D,
-    0xAA, 0x52, 0xD3, 0x49, 0xE0, 0x54, 0x4B, 0x27, 0xDE, 0x3E, 0x48, 0x7A, 0xE1, 0x46, 0x50, 0x0C,
-    0xDE, 0x4C, 0x43, 0x52, 0xFC, 0x2F, 0x35, 0x63, 0xFE, 0x37, 0x3D, 0x8B, 0xFE, 0x45, 0x38, 0x29,
-    0xFB, 0x3D, 0x30, 0x48, 0xD9, 0x58, 0x75, 0x24, 0xD4, 0x2A, 0x6F, 0x73, 0xD8, 0x2F, 0x7C, 0x87,
-    0xDA, 0x46, 0x7F, 0x0A, 0xD5, 0x52, 0x68, 0x4E, 0xD3, 0x3B, 0x65, 0x58, 0xF6, 0x19, 0x59, 0x61,
-    0xFA, 0x1F, 0x66, 0x6E, 0xFC, 0x36, 0x69, 0x3B, 0xFB, 0x47, 0x5F, 0x33, 0xF7, 0x42, 0x52, 0x47,
-    0xF4, 0x2B, 0x4F, 0x60, 0x4C, 0x82, 0x71, 0xA0, 0xE6, 0x00, 0x26, 0x69, 0x61, 0x54, 0xCB, 0x7A,
-    0xD7, 0x0E, 0x7D, 0x6D, 0x53, 0xBF, 0x79, 0x1F, 0xF5, 0x8F, 0x39, 0x2A, 0x67, 0x91, 0xD3, 0x08,
-    0xE0, 0x62, 0x87, 0x2F, 0xDF, 0x2F, 0x10, 0x59, 0xE8, 0x80, 0x1B, 0x4F, 0xF2, 0x0C, 0x17, 0x5F,
-    0xFF, 0x7F, 0x26, 0x33, 0x4D, 0x6F, 0xC5, 0x7A, 0x3F, 0x8E, 0x87, 0xA0, 0x44, 0xB8, 0x8D, 0x1D,
-    0x52, 0x99, 0xCA, 0x23, 0x0F, 0x7D, 0xEE, 0x78, 0x00, 0xCA, 0xA0, 0x8D, 0x16, 0xC4, 0xF7, 0x17,
-    0xE0, 0x1C, 0x8E, 0x36, 0x68, 0x6A, 0xDF, 0x86, 0xE4, 0x41, 0x93, 0x3C, 0x52, 0x7D, 0xD4, 0x84,
-    0x16, 0x9A, 0xFF, 0x05, 0x24, 0xB2, 0x9C, 0x51, 0xBF, 0xA3, 0x38, 0x26, 0xB3, 0x36, 0x2A, 0x5D,
-    0xB7, 0xA7, 0x3D, 0x22, 0xAB, 0x3A, 0x2F, 0x72, 0x9A, 0x64, 0x0C, 0x7D, 0xA9, 0xB0, 0x0C, 0x4B,
-    0xA2, 0xB2, 0x16, 0x06, 0xA0, 0x63, 0x02, 0x5D, 0x9B, 0xB4, 0x08, 0x1C, 0x94, 0x74, 0x00, 0x58,
-    0x77, 0x72, 0x6C, 0x6B, 0x6D, 0xB8, 0x22, 0x1B, 0x7B, 0x98, 0x70, 0x16, 0x6A, 0x9B, 0x1E, 0x76,
-    0xB0, 0xFF, 0x82, 0x9E, 0xC3, 0xF2, 0x80, 0x2B, 0xA5, 0x98, 0x75, 0x8D, 0xB8, 0x8B, 0x73, 0x46,
-    0xB4, 0xF6, 0x94, 0x04, 0xA9, 0x8F, 0x87, 0x02, 0x35, 0xA7, 0x3E, 0x72, 0x55, 0xB4, 0x2F, 0x56,
-    0x52, 0x8B, 0x79, 0x7C, 0x70, 0x8C, 0x69, 0x43, 0x3B, 0xDD, 0x45, 0x22, 0x56, 0xAA, 0x7D, 0x07,
-    0x7B, 0x98, 0x33, 0x90, 0x91, 0xB0, 0x1E, 0x2D, 0x8B, 0x76, 0x17, 0x79, 0x08, 0x5E, 0xAA, 0x3D,
-    0xD7, 0x7A, 0xF4, 0x3C, 0x8A, 0x2F, 0x48, 0x3D, 0xAC, 0xAC, 0x64, 0xC0, 0xE5, 0xCD, 0x31, 0xC1,
-    0xE8, 0x70, 0x7A, 0x40, 0x77, 0x61, 0x76, 0x65, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7B, 0x50, 0xCC, 0x41, 0x88, 0x43, 0xE3, 0x56, 0x9D, 0x3E, 0xD8, 0x56,
-    0x71, 0x41, 0xCF, 0x77, 0x83, 0x2E, 0xEF, 0x7A, 0xA4, 0x26, 0xDD, 0x61, 0x73, 0x64, 0xD3, 0x11,
-    0x85, 0x52, 0xF4, 0x2D, 0xA6, 0x4A, 0xE1, 0x26, 0xE0, 0x57, 0x58, 0x20, 0xDF, 0x40, 0x55, 0x68,
-    0xE1, 0x49, 0x5D, 0x0C, 0xDF, 0x4E, 0x4F, 0x52, 0xFD, 0x38, 0x44, 0x63, 0xFF, 0x41, 0x4C, 0x8B,
-    0xFE, 0x50, 0x47, 0x2A, 0xFD, 0x47, 0x3E, 0x48, 0xD8, 0x5B, 0x83, 0x20, 0xD5, 0x29, 0x7D, 0x68,
-    0xD8, 0x30, 0x8B, 0x87, 0xD9, 0x49, 0x8E, 0x0A, 0xD5, 0x53, 0x75, 0x4E, 0xD3, 0x3B, 0x72, 0x58,
-    0xF7, 0x20, 0x6A, 0x63, 0xFA, 0x28, 0x78, 0x6F, 0xFB, 0x41, 0x7B, 0x31, 0xF9, 0x52, 0x70, 0x29,
-    0xF6, 0x4B, 0x62, 0x47, 0xF5, 0x32, 0x5F, 0x55, 0x4E, 0x5F, 0x6F, 0xA0, 0xEA, 0x00, 0x33, 0x69,
-    0x60, 0x37, 0xD1, 0x7A, 0xD8, 0x0D, 0x8C, 0x6D, 0x52, 0xA2, 0x77, 0x1F, 0xF3, 0x9B, 0x46, 0x2A,
-    0x64, 0x7A, 0xD9, 0x07, 0xDD, 0x67, 0x97, 0x2F, 0xE3, 0x2F, 0x1A, 0x59, 0xE8, 0x87, 0x25, 0x4F,
-    0xF7, 0x0F, 0x24, 0x5F, 0xFE, 0x8C, 0x34, 0x33, 0x4C, 0x4E, 0xC8, 0x7A, 0x40, 0x69, 0x85, 0xA0,
-    0x43, 0x97, 0x8B, 0x1D, 0x4F, 0x7C, 0xCE, 0x06, 0x0E, 0x4D, 0xEC, 0x78, 0x00, 0x97, 0x98, 0x94,
-    0x12, 0x99, 0xF6, 0x18, 0xE0, 0x1E, 0x9F, 0x36, 0x65, 0x51, 0xE7, 0x86, 0xE2, 0x47, 0xA4, 0x31,
-    0x50, 0x5F, 0xD9, 0x84, 0x13, 0x6D, 0xFF, 0x05, 0x24, 0x88, 0x98, 0x51, 0xBE, 0xA0, 0x3F, 0x26,
-    0xB7, 0x2B, 0x30, 0x5D, 0xB6, 0xA2, 0x44, 0x1B, 0xAF, 0x2D, 0x35, 0x72, 0x9F, 0x53, 0x0D, 0x78,
-    0xAA, 0xA7, 0x0E, 0x49, 0xA3, 0xA7, 0x18, 0x06, 0xA5, 0x54, 0x04, 0x5D, 0x9C, 0xA7, 0x09, 0x1C,
-    0x98, 0x62, 0x00, 0x58, 0x79, 0x5B, 0x6F, 0x6B, 0x6F, 0xA0, 0x1F, 0x1B, 0x7B, 0x83, 0x74, 0x16,
-    0x6E, 0x80, 0x1B, 0x75, 0xA9, 0xFF, 0x8B, 0x9E, 0xBC, 0xF7, 0x8A, 0x2C, 0xA2, 0x8F, 0x7D, 0x94,
-    0xB6, 0x87, 0x7D, 0x46, 0xAC, 0xF7, 0x9E, 0x04, 0xA6, 0x87, 0x90, 0x02, 0x39, 0x7F, 0x37, 0x72,
-    0x57, 0x95, 0x2A, 0x56, 0x53, 0x6B, 0x79, 0x7C, 0x71, 0x74, 0x6B, 0x43, 0x3C, 0xB9, 0x3E, 0x1B,
-    0x55, 0x8C, 0x7D, 0x18, 0x7D, 0x82, 0x33, 0x90, 0x93, 0xA0, 0x1F, 0x2D, 0x8F, 0x62, 0x17, 0x6B,
-    0x7B, 0xF6, 0xAC, 0x3D, 0xF1, 0x89, 0xE5, 0x3C, 0x57, 0xAC, 0x3D, 0x3D, 0xD0, 0xD3, 0x12, 0xC0,
-    0x13, 0x83, 0x1D, 0xC1, 0xCB, 0x9D, 0x81, 0x40, 0x77, 0x61, 0x76, 0x65, 0x31, 0x31, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3B, 0xD4, 0x41, 0x86, 0x31, 0xEE, 0x56,
-    0x9B, 0x31, 0xE4, 0x56, 0x70, 0x28, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A, 0xA2, 0x1A, 0xEA, 0x62,
-    0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20,
-    0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63,
-    0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20,
-    0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E,
-    0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31,
-    0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58,
-    0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x19, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1A,
-    0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59,
-    0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A,
-    0x41, 0x44, 0x83, 0xA0, 0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5D, 0xD1, 0x06, 0x0D, 0x1B, 0xEB, 0x78,
-    0x00, 0x64, 0x90, 0x94, 0x0F, 0x6D, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38, 0x63, 0x37, 0xEE, 0x86,
-    0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x3F, 0xDD, 0x84, 0x10, 0x3F, 0xFF, 0x05, 0x23, 0x5D, 0x94, 0x51,
-    0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71,
-    0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E,
-    0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58, 0x79, 0x43, 0x71, 0x6C, 0x71, 0x88, 0x1B, 0x1B,
-    0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E, 0xB5, 0xFB, 0x94, 0x2C,
-    0xA0, 0x86, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x3F, 0xA5, 0xF8, 0xA7, 0x01, 0xA3, 0x7F, 0x99, 0x7F,
-    0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56, 0x54, 0x4A, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F,
-    0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6E, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08,
-    0x92, 0x4F, 0x18, 0x6A, 0x7B, 0xF6, 0xAC, 0x3D, 0xEF, 0x89, 0xE5, 0x3C, 0x57, 0xAC, 0x3D, 0x3D,
-    0x8E, 0x28, 0x85, 0x40, 0x21, 0xBC, 0xB4, 0xC0, 0xCB, 0x9D, 0x81, 0x40, 0x70, 0x6F, 0x69, 0x6E,
-    0x74, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3B, 0xD4, 0x41,
-    0x86, 0x31, 0xEE, 0x56, 0x9B, 0x31, 0xE4, 0x56, 0x70, 0x28, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A,
-    0xA2, 0x1A, 0xEA, 0x62, 0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26,
-    0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52,
-    0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48,
-    0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A,
-    0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C,
-    0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F,
-    0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x19, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E,
-    0x51, 0x84, 0x76, 0x1A, 0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25,
-    0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E,
-    0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x44, 0x83, 0xA0, 0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5D, 0xD1, 0x06,
-    0x0D, 0x1B, 0xEB, 0x78, 0x00, 0x64, 0x90, 0x94, 0x0F, 0x6D, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38,
-    0x63, 0x37, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x3F, 0xDD, 0x84, 0x10, 0x3F, 0xFF, 0x05,
-    0x23, 0x5D, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B,
-    0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07,
-    0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58, 0x79, 0x43, 0x71, 0x6C,
-    0x71, 0x88, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E,
-    0xB5, 0xFB, 0x94, 0x2C, 0xA0, 0x86, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x3F, 0xA5, 0xF8, 0xA7, 0x01,
-    0xA3, 0x7F, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56, 0x54, 0x4A, 0x78, 0x7D,
-    0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6E, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E,
-    0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A, 0x62, 0xE9, 0xA3, 0x3D, 0xF1, 0x89, 0xE5, 0x3C,
-    0xFB, 0x35, 0x66, 0x3D, 0xFE, 0x71, 0xD7, 0x40, 0xAA, 0x5B, 0x09, 0xC1, 0x46, 0xBB, 0xBF, 0x3E,
-    0x70, 0x6F, 0x69, 0x6E, 0x74, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x86, 0x3B, 0xB7, 0x40, 0x96, 0x31, 0xC7, 0x53, 0xAA, 0x31, 0xB7, 0x53, 0x7C, 0x28, 0xBC, 0x7A,
-    0x93, 0x1A, 0xD3, 0x7A, 0xB3, 0x1A, 0xBA, 0x61, 0x7E, 0x4F, 0xBF, 0x11, 0x94, 0x41, 0xD6, 0x2D,
-    0xB4, 0x40, 0xBD, 0x26, 0xDF, 0x5B, 0x37, 0x20, 0xDE, 0x42, 0x35, 0x68, 0xE1, 0x4C, 0x3C, 0x0D,
-    0xDD, 0x51, 0x31, 0x57, 0xFB, 0x41, 0x1F, 0x63, 0xFE, 0x4B, 0x25, 0x8C, 0xFC, 0x5A, 0x21, 0x2B,
-    0xF9, 0x50, 0x1A, 0x4F, 0xDB, 0x5D, 0x5F, 0x20, 0xD9, 0x27, 0x5A, 0x68, 0xDD, 0x30, 0x66, 0x87,
-    0xDE, 0x4B, 0x68, 0x0A, 0xD7, 0x54, 0x54, 0x4E, 0xD6, 0x39, 0x51, 0x58, 0xFA, 0x27, 0x41, 0x63,
-    0xFE, 0x30, 0x4C, 0x6F, 0xFF, 0x4B, 0x4E, 0x31, 0xFC, 0x5D, 0x45, 0x3D, 0xF7, 0x54, 0x3A, 0x47,
-    0xF6, 0x39, 0x38, 0x54, 0x4D, 0x3D, 0x74, 0x9F, 0xE8, 0x00, 0x15, 0x69, 0x6B, 0x19, 0xC2, 0x7A,
-    0xDF, 0x0B, 0x66, 0x70, 0x4F, 0x84, 0x7A, 0x1A, 0xEE, 0xA7, 0x23, 0x2C, 0x6E, 0x61, 0xC9, 0x08,
-    0xE2, 0x6C, 0x6F, 0x2A, 0xDC, 0x2F, 0x02, 0x59, 0xE0, 0x8E, 0x0A, 0x4F, 0xF3, 0x13, 0x05, 0x5F,
-    0xF7, 0x9A, 0x11, 0x33, 0x56, 0x2C, 0xC0, 0x7A, 0x41, 0x44, 0x8A, 0xA1, 0x43, 0x75, 0x8F, 0x1A,
-    0x57, 0x5D, 0xC4, 0x06, 0x1A, 0x1B, 0xF0, 0x78, 0x00, 0x64, 0xAC, 0x8F, 0x1D, 0x6D, 0xF7, 0x18,
-    0xE8, 0x20, 0x74, 0x36, 0x72, 0x37, 0xD4, 0x86, 0xEA, 0x4B, 0x78, 0x30, 0x5B, 0x3F, 0xCD, 0x86,
-    0x20, 0x3F, 0xFF, 0x0E, 0x25, 0x5D, 0xA2, 0x51, 0xB7, 0x9E, 0x2C, 0x1C, 0xB2, 0x20, 0x21, 0x5D,
-    0xAF, 0x9E, 0x32, 0x1B, 0xAB, 0x20, 0x27, 0x72, 0x94, 0x43, 0x0A, 0x78, 0x9D, 0x9F, 0x08, 0x49,
-    0x97, 0x9E, 0x12, 0x06, 0x99, 0x45, 0x00, 0x5D, 0x8E, 0x9C, 0x07, 0x4D, 0x8C, 0x51, 0x00, 0x58,
-    0x78, 0x43, 0x68, 0x6C, 0x63, 0x88, 0x26, 0x1B, 0x79, 0x6F, 0x6B, 0x16, 0x62, 0x66, 0x23, 0x77,
-    0xA7, 0xFF, 0x72, 0x9E, 0xBA, 0xFB, 0x6D, 0x2C, 0xA2, 0x86, 0x68, 0x8F, 0xB6, 0x83, 0x63, 0x43,
-    0xAD, 0xF8, 0x82, 0x04, 0xA8, 0x7F, 0x78, 0x84, 0x30, 0x57, 0x4A, 0x72, 0x4C, 0x76, 0x37, 0x54,
-    0x53, 0x4A, 0x7B, 0x80, 0x6F, 0x5C, 0x67, 0x43, 0x32, 0x96, 0x4F, 0x16, 0x54, 0x6E, 0x7E, 0x18,
-    0x74, 0x6D, 0x33, 0x90, 0x87, 0x92, 0x1C, 0x2D, 0x85, 0x4F, 0x17, 0x6C, 0x3A, 0x4E, 0xA7, 0x3D,
-    0xF1, 0x89, 0xE5, 0x3C, 0xAC, 0x85, 0x5A, 0x3D, 0x10, 0x65, 0xD7, 0x40, 0x42, 0xAF, 0x05, 0xC1,
-    0xF7, 0x7A, 0x07, 0x40, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x82, 0x3B, 0xBF, 0x41, 0x91, 0x31, 0xD2, 0x53, 0xA5, 0x31, 0xC4, 0x53,
-    0x79, 0x28, 0xC3, 0x7A, 0x8D, 0x1A, 0xDE, 0x7A, 0xAE, 0x1A, 0xC7, 0x61, 0x7A, 0x4F, 0xC7, 0x11,
-    0x8E, 0x41, 0xE1, 0x2D, 0xAF, 0x40, 0xCB, 0x26, 0xE0, 0x5B, 0x43, 0x20, 0xE0, 0x42, 0x41, 0x68,
-    0xE2, 0x4C, 0x48, 0x0D, 0xDE, 0x51, 0x3C, 0x57, 0xFD, 0x41, 0x2D, 0x63, 0xFF, 0x4B, 0x34, 0x8B,
-    0xFE, 0x5A, 0x2F, 0x2A, 0xFB, 0x50, 0x28, 0x4F, 0xDA, 0x5D, 0x6D, 0x20, 0xD8, 0x27, 0x68, 0x68,
-    0xDC, 0x30, 0x74, 0x87, 0xDD, 0x4B, 0x77, 0x0A, 0xD6, 0x54, 0x60, 0x4E, 0xD5, 0x39, 0x5E, 0x58,
-    0xFA, 0x27, 0x51, 0x63, 0xFD, 0x30, 0x5D, 0x6F, 0xFE, 0x4B, 0x5F, 0x31, 0xFB, 0x5D, 0x56, 0x3D,
-    0xF7, 0x54, 0x49, 0x47, 0xF7, 0x39, 0x47, 0x55, 0x4E, 0x3D, 0x72, 0x9F, 0xEB, 0x00, 0x21, 0x70,
-    0x68, 0x19, 0xC8, 0x7A, 0xDD, 0x0B, 0x75, 0x70, 0x50, 0x84, 0x79, 0x1A, 0xF0, 0xA7, 0x30, 0x2C,
-    0x6A, 0x61, 0xCF, 0x07, 0xE0, 0x6C, 0x7E, 0x25, 0xE0, 0x2F, 0x0B, 0x59, 0xE3, 0x8E, 0x14, 0x4F,
-    0xF6, 0x13, 0x11, 0x5F, 0xFA, 0x9A, 0x1E, 0x33, 0x53, 0x2C, 0xC3, 0x7A, 0x41, 0x44, 0x88, 0xA0,
-    0x43, 0x75, 0x8D, 0x1A, 0x54, 0x5D, 0xC8, 0x06, 0x16, 0x1B, 0xEF, 0x78, 0x00, 0x64, 0xA4, 0x8F,
-    0x19, 0x6D, 0xF7, 0x18, 0xE6, 0x20, 0x85, 0x36, 0x6D, 0x37, 0xDB, 0x86, 0xE7, 0x4B, 0x89, 0x30,
-    0x57, 0x3F, 0xD2, 0x84, 0x1B, 0x3F, 0xFF, 0x05, 0x25, 0x5D, 0x9E, 0x51, 0xB9, 0x9E, 0x33, 0x1C,
-    0xB6, 0x20, 0x27, 0x5D, 0xB1, 0x9E, 0x38, 0x1B, 0xAE, 0x20, 0x2D, 0x72, 0x99, 0x43, 0x0B, 0x78,
-    0xA2, 0x9F, 0x0A, 0x49, 0x9C, 0x9E, 0x13, 0x06, 0x9F, 0x45, 0x01, 0x5D, 0x94, 0x9C, 0x07, 0x4D,
-    0x92, 0x51, 0x00, 0x58, 0x79, 0x43, 0x6A, 0x6C, 0x68, 0x88, 0x23, 0x1B, 0x7A, 0x6F, 0x6E, 0x16,
-    0x67, 0x66, 0x20, 0x77, 0xA6, 0xFF, 0x7B, 0x9E, 0xB9, 0xFB, 0x78, 0x2C, 0xA2, 0x86, 0x70, 0x8F,
-    0xB6, 0x83, 0x6C, 0x43, 0xAB, 0xF8, 0x8C, 0x04, 0xA7, 0x7F, 0x81, 0x84, 0x34, 0x57, 0x42, 0x72,
-    0x51, 0x76, 0x32, 0x56, 0x54, 0x4A, 0x7A, 0x7D, 0x70, 0x5C, 0x68, 0x43, 0x36, 0x96, 0x48, 0x16,
-    0x55, 0x6E, 0x7D, 0x18, 0x78, 0x6D, 0x33, 0x90, 0x8C, 0x92, 0x1D, 0x2D, 0x8A, 0x4F, 0x17, 0x6B,
-    0x26, 0x2D, 0xAB, 0x3D, 0xF1, 0x89, 0xE5, 0x3C, 0xC0, 0x69, 0x4A, 0x3D, 0xEE, 0xD0, 0xB8, 0x40,
-    0x13, 0x83, 0x1D, 0xC1, 0x46, 0x31, 0x79, 0x40, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x30, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x3B, 0xCA, 0x41, 0x8A, 0x31, 0xE1, 0x54,
-    0x9F, 0x31, 0xD5, 0x56, 0x74, 0x28, 0xCE, 0x7A, 0x86, 0x1A, 0xEE, 0x7A, 0xA7, 0x1A, 0xDA, 0x61,
-    0x74, 0x4F, 0xD2, 0x11, 0x87, 0x41, 0xF2, 0x23, 0xA8, 0x40, 0xDE, 0x26, 0xE0, 0x5B, 0x55, 0x20,
-    0xE0, 0x42, 0x52, 0x68, 0xE1, 0x4C, 0x5B, 0x0C, 0xDE, 0x51, 0x4D, 0x52, 0xFD, 0x41, 0x41, 0x63,
-    0xFF, 0x4B, 0x49, 0x8B, 0xFE, 0x5A, 0x44, 0x2A, 0xFC, 0x50, 0x3C, 0x4F, 0xD7, 0x5D, 0x80, 0x20,
-    0xD6, 0x27, 0x7B, 0x68, 0xD9, 0x30, 0x89, 0x87, 0xDA, 0x4B, 0x8B, 0x0A, 0xD5, 0x54, 0x72, 0x4E,
-    0xD4, 0x39, 0x70, 0x58, 0xF8, 0x27, 0x67, 0x63, 0xFB, 0x30, 0x75, 0x8C, 0xFB, 0x4B, 0x78, 0x31,
-    0xF9, 0x5D, 0x6D, 0x29, 0xF6, 0x54, 0x5F, 0x47, 0xF6, 0x39, 0x5C, 0x55, 0x4F, 0x3D, 0x70, 0x58,
-    0xED, 0x00, 0x31, 0x70, 0x63, 0x19, 0xD0, 0x7A, 0xDA, 0x0B, 0x8A, 0x6E, 0x51, 0x84, 0x77, 0x1A,
-    0xF0, 0xA7, 0x43, 0x25, 0x64, 0x61, 0xD8, 0x07, 0xDC, 0x6C, 0x94, 0x25, 0xE4, 0x2F, 0x18, 0x59,
-    0xE6, 0x8E, 0x22, 0x4F, 0xF8, 0x13, 0x22, 0x5F, 0xFB, 0x9A, 0x31, 0x33, 0x4E, 0x2C, 0xC8, 0x7A,
-    0x41, 0x44, 0x85, 0xA0, 0x42, 0x75, 0x8B, 0x1A, 0x50, 0x5D, 0xCD, 0x06, 0x11, 0x1B, 0xED, 0x78,
-    0x00, 0x64, 0x99, 0x94, 0x13, 0x6D, 0xF5, 0x16, 0xE2, 0x20, 0x9C, 0x36, 0x67, 0x37, 0xE6, 0x86,
-    0xE3, 0x4B, 0xA1, 0x30, 0x52, 0x3F, 0xD8, 0x84, 0x15, 0x3F, 0xFF, 0x05, 0x24, 0x5D, 0x98, 0x51,
-    0xBB, 0x9E, 0x3D, 0x1C, 0xB9, 0x20, 0x30, 0x60, 0xB3, 0x9E, 0x42, 0x1B, 0xB0, 0x20, 0x34, 0x72,
-    0x9E, 0x43, 0x0D, 0x78, 0xA7, 0x9F, 0x0D, 0x49, 0xA0, 0x9E, 0x16, 0x06, 0xA5, 0x45, 0x04, 0x5E,
-    0x99, 0x9C, 0x08, 0x1C, 0x98, 0x51, 0x00, 0x58, 0x79, 0x43, 0x6E, 0x6C, 0x6D, 0x88, 0x1F, 0x1B,
-    0x7A, 0x6F, 0x73, 0x16, 0x6D, 0x66, 0x1B, 0x77, 0xA4, 0xFF, 0x87, 0x9E, 0xB7, 0xFB, 0x87, 0x2C,
-    0xA1, 0x86, 0x7B, 0x94, 0xB4, 0x83, 0x7A, 0x46, 0xA8, 0xF8, 0x9B, 0x04, 0xA5, 0x7F, 0x8E, 0x84,
-    0x39, 0x57, 0x38, 0x71, 0x56, 0x76, 0x2B, 0x56, 0x54, 0x4A, 0x79, 0x7D, 0x71, 0x5C, 0x6A, 0x43,
-    0x3A, 0x96, 0x3F, 0x1B, 0x55, 0x6E, 0x7D, 0x18, 0x7C, 0x6D, 0x32, 0x90, 0x90, 0x92, 0x1E, 0x2D,
-    0x8F, 0x4F, 0x17, 0x6A, 0x83, 0xC2, 0xA5, 0x3D, 0xF1, 0x89, 0xE5, 0x3C, 0xE7, 0x2B, 0x5F, 0x3D,
-    0x62, 0x04, 0x0D, 0x40, 0x13, 0x83, 0x1D, 0xC1, 0x15, 0x2E, 0x84, 0x3E, 0x70, 0x6F, 0x69, 0x6E,
-    0x74, 0x30, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x3B, 0xBB, 0x41,
-    0x93, 0x31, 0xCD, 0x53, 0xA8, 0x31, 0xBE, 0x53, 0x7A, 0x28, 0xC0, 0x7A, 0x8F, 0x1A, 0xD9, 0x7A,
-    0xB0, 0x1A, 0xC2, 0x61, 0x7C, 0x4F, 0xC3, 0x11, 0x91, 0x41, 0xDD, 0x2D, 0xB1, 0x40, 0xC5, 0x26,
-    0xE0, 0x5B, 0x3E, 0x20, 0xE0, 0x42, 0x3C, 0x68, 0xE2, 0x4C, 0x43, 0x0D, 0xDE, 0x51, 0x37, 0x57,
-    0xFD, 0x41, 0x27, 0x63, 0xFF, 0x4B, 0x2E, 0x3A, 0xFD, 0x5A, 0x29, 0x2A, 0xFB, 0x50, 0x22, 0x4F,
-    0xDB, 0x5D, 0x67, 0x20, 0xD9, 0x27, 0x62, 0x68, 0xDD, 0x30, 0x6E, 0x87, 0xDE, 0x4B, 0x71, 0x0A,
-    0xD7, 0x54, 0x5B, 0x4E, 0xD6, 0x39, 0x59, 0x58, 0xFA, 0x27, 0x4A, 0x63, 0xFE, 0x30, 0x56, 0x6F,
-    0xFF, 0x4B, 0x58, 0x31, 0xFC, 0x5D, 0x4F, 0x3D, 0xF8, 0x54, 0x43, 0x47, 0xF7, 0x39, 0x41, 0x60,
-    0x4E, 0x3D, 0x73, 0x9F, 0xEA, 0x00, 0x1C, 0x70, 0x69, 0x19, 0xC6, 0x7A, 0xDE, 0x0B, 0x6F, 0x70,
-    0x50, 0x84, 0x79, 0x1A, 0xEF, 0xA7, 0x2B, 0x2C, 0x6C, 0x61, 0xCC, 0x07, 0xE1, 0x6C, 0x78, 0x25,
-    0xDF, 0x2F, 0x07, 0x59, 0xE2, 0x8E, 0x10, 0x4F, 0xF5, 0x13, 0x0C, 0x5F, 0xF9, 0x9A, 0x18, 0x33,
-    0x54, 0x2C, 0xC2, 0x7A, 0x41, 0x44, 0x89, 0xA1, 0x43, 0x75, 0x8D, 0x1A, 0x56, 0x5D, 0xC6, 0x06,
-    0x18, 0x1B, 0xEF, 0x78, 0x00, 0x64, 0xA7, 0x8F, 0x1A, 0x6D, 0xF7, 0x18, 0xE7, 0x20, 0x7E, 0x36,
-    0x70, 0x37, 0xD8, 0x86, 0xE9, 0x4B, 0x82, 0x30, 0x59, 0x3F, 0xD0, 0x86, 0x1D, 0x3F, 0xFF, 0x05,
-    0x25, 0x5D, 0xA0, 0x51, 0xB9, 0x9E, 0x30, 0x1C, 0xB5, 0x20, 0x24, 0x5D, 0xB1, 0x9E, 0x36, 0x1B,
-    0xAD, 0x20, 0x2A, 0x72, 0x97, 0x43, 0x0A, 0x78, 0xA0, 0x9F, 0x09, 0x49, 0x9A, 0x9E, 0x13, 0x06,
-    0x9D, 0x45, 0x01, 0x5D, 0x92, 0x9C, 0x07, 0x4D, 0x90, 0x51, 0x00, 0x58, 0x79, 0x43, 0x69, 0x6C,
-    0x66, 0x88, 0x24, 0x1B, 0x7A, 0x6F, 0x6D, 0x16, 0x65, 0x66, 0x21, 0x77, 0xA6, 0xFF, 0x77, 0x9E,
-    0xBA, 0xFB, 0x73, 0x2C, 0xA3, 0x86, 0x6D, 0x8F, 0xB6, 0x83, 0x69, 0x43, 0xAC, 0xF8, 0x88, 0x04,
-    0xA8, 0x7F, 0x7D, 0x84, 0x32, 0x57, 0x45, 0x72, 0x4F, 0x76, 0x34, 0x56, 0x53, 0x4A, 0x7A, 0x80,
-    0x70, 0x5C, 0x67, 0x43, 0x34, 0x96, 0x4B, 0x16, 0x55, 0x6E, 0x7D, 0x18, 0x77, 0x6D, 0x33, 0x90,
-    0x8A, 0x92, 0x1D, 0x2D, 0x88, 0x4F, 0x17, 0x6B, 0x3C, 0x7B, 0xA6, 0x3D, 0xF1, 0x89, 0xE5, 0x3C,
-    0xA4, 0x15, 0x5D, 0x3D, 0x03, 0x09, 0xA0, 0x3F, 0x13, 0x83, 0x1D, 0xC1, 0x86, 0x92, 0xBF, 0x3E,
-    0x70, 0x6F, 0x69, 0x6E, 0x74, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x83, 0x3B, 0xBD, 0x41, 0x92, 0x31, 0xCF, 0x53, 0xA7, 0x31, 0xC1, 0x53, 0x7A, 0x28, 0xC1, 0x7A,
-    0x8E, 0x1A, 0xDB, 0x7A, 0xAF, 0x1A, 0xC4, 0x61, 0x7B, 0x4F, 0xC5, 0x11, 0x90, 0x41, 0xDF, 0x2D,
-    0xB0, 0x40, 0xC8, 0x26, 0xE0, 0x5B, 0x41, 0x20, 0xE0, 0x42, 0x3E, 0x68, 0xE2, 0x4C, 0x45, 0x0D,
-    0xDE, 0x51, 0x3A, 0x57, 0xFD, 0x41, 0x29, 0x63, 0xFF, 0x4B, 0x31, 0x8B, 0xFE, 0x5A, 0x2C, 0x2A,
-    0xFB, 0x50, 0x25, 0x4F, 0xDA, 0x5D, 0x6A, 0x20, 0xD9, 0x27, 0x65, 0x68, 0xDD, 0x30, 0x71, 0x87,
-    0xDD, 0x4B, 0x73, 0x0A, 0xD7, 0x54, 0x5D, 0x4E, 0xD6, 0x39, 0x5B, 0x58, 0xFA, 0x27, 0x4D, 0x63,
-    0xFE, 0x30, 0x59, 0x6F, 0xFF, 0x4B, 0x5C, 0x31, 0xFC, 0x5D, 0x52, 0x3D, 0xF8, 0x54, 0x46, 0x47,
-    0xF7, 0x39, 0x43, 0x55, 0x4E, 0x3D, 0x72, 0x9F, 0xEA, 0x00, 0x1E, 0x69, 0x69, 0x19, 0xC7, 0x7A,
-    0xDE, 0x0B, 0x72, 0x70, 0x50, 0x84, 0x79, 0x1A, 0xF0, 0xA7, 0x2D, 0x2C, 0x6B, 0x61, 0xCD, 0x07,
-    0xE1, 0x6C, 0x7A, 0x25, 0xE0, 0x2F, 0x09, 0x59, 0xE3, 0x8E, 0x12, 0x4F, 0xF5, 0x13, 0x0E, 0x5F,
-    0xF9, 0x9A, 0x1B, 0x33, 0x53, 0x2C, 0xC2, 0x7A, 0x41, 0x44, 0x89, 0xA1, 0x43, 0x75, 0x8D, 0x1A,
-    0x55, 0x5D, 0xC7, 0x06, 0x17, 0x1B, 0xEF, 0x78, 0x00, 0x64, 0xA6, 0x8F, 0x1A, 0x6D, 0xF7, 0x18,
-    0xE7, 0x20, 0x81, 0x37, 0x6F, 0x37, 0xD9, 0x86, 0xE8, 0x4B, 0x85, 0x30, 0x58, 0x3F, 0xD1, 0x86,
-    0x1C, 0x3F, 0xFF, 0x05, 0x25, 0x5D, 0x9F, 0x51, 0xB9, 0x9E, 0x31, 0x1C, 0xB5, 0x20, 0x26, 0x5D,
-    0xB1, 0x9E, 0x37, 0x1B, 0xAD, 0x20, 0x2B, 0x72, 0x98, 0x43, 0x0B, 0x78, 0xA1, 0x9F, 0x09, 0x49,
-    0x9B, 0x9E, 0x13, 0x06, 0x9E, 0x45, 0x01, 0x5D, 0x93, 0x9C, 0x07, 0x4D, 0x90, 0x51, 0x00, 0x58,
-    0x79, 0x43, 0x6A, 0x6C, 0x67, 0x88, 0x23, 0x1B, 0x7A, 0x6F, 0x6D, 0x16, 0x66, 0x66, 0x20, 0x77,
-    0xA6, 0xFF, 0x79, 0x9E, 0xBA, 0xFB, 0x75, 0x2C, 0xA2, 0x86, 0x6E, 0x8F, 0xB6, 0x83, 0x6A, 0x43,
-    0xAB, 0xF8, 0x8A, 0x04, 0xA8, 0x7F, 0x7F, 0x84, 0x33, 0x57, 0x44, 0x72, 0x50, 0x76, 0x33, 0x56,
-    0x54, 0x4A, 0x7A, 0x7D, 0x70, 0x5C, 0x68, 0x43, 0x35, 0x96, 0x4A, 0x16, 0x55, 0x6E, 0x7D, 0x18,
-    0x78, 0x6D, 0x33, 0x90, 0x8B, 0x92, 0x1D, 0x2D, 0x89, 0x4F, 0x17, 0x6A, 0xBE, 0x96, 0xA7, 0x3D,
-    0xEE, 0x89, 0xE5, 0x3C, 0x71, 0x97, 0x59, 0x3D, 0x67, 0x61, 0xDB, 0x3E, 0x13, 0x83, 0x1D, 0xC1,
-    0x8A, 0xFB, 0x2E, 0x3F, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x30, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x82, 0x3B, 0xBF, 0x41, 0x91, 0x31, 0xD3, 0x53, 0xA5, 0x31, 0xC5, 0x53,
-    0x78, 0x28, 0xC4, 0x7A, 0x8D, 0x1A, 0xDF, 0x7A, 0xAD, 0x1A, 0xC8, 0x61, 0x7A, 0x4F, 0xC7, 0x11,
-    0x8E, 0x41, 0xE2, 0x2D, 0xAE, 0x40, 0xCC, 0x26, 0xE0, 0x5B, 0x44, 0x20, 0xE0, 0x42, 0x42, 0x68,
-    0xE2, 0x4C, 0x49, 0x0D, 0xDE, 0x51, 0x3D, 0x57, 0xFD, 0x41, 0x2E, 0x63, 0xFF, 0x4B, 0x35, 0x8B,
-    0xFE, 0x5A, 0x30, 0x2A, 0xFB, 0x50, 0x29, 0x4F, 0xDA, 0x5D, 0x6E, 0x20, 0xD8, 0x27, 0x69, 0x68,
-    0xDC, 0x30, 0x75, 0x87, 0xDD, 0x4B, 0x78, 0x0A, 0xD6, 0x54, 0x61, 0x4E, 0xD5, 0x39, 0x5F, 0x58,
-    0xFA, 0x27, 0x52, 0x63, 0xFD, 0x30, 0x5E, 0x6F, 0xFE, 0x4B, 0x61, 0x31, 0xFB, 0x5D, 0x57, 0x3D,
-    0xF7, 0x54, 0x4A, 0x47, 0xF7, 0x39, 0x48, 0x55, 0x4E, 0x3D, 0x72, 0x9F, 0xEB, 0x00, 0x21, 0x70,
-    0x67, 0x19, 0xC9, 0x7A, 0xDD, 0x0B, 0x76, 0x70, 0x50, 0x84, 0x79, 0x1A, 0xF0, 0xA7, 0x31, 0x2A,
-    0x6A, 0x61, 0xCF, 0x07, 0xE0, 0x6C, 0x7F, 0x25, 0xE1, 0x2F, 0x0C, 0x59, 0xE3, 0x8E, 0x15, 0x4F,
-    0xF6, 0x13, 0x12, 0x5F, 0xFA, 0x9A, 0x1F, 0x33, 0x52, 0x2C, 0xC3, 0x7A, 0x41, 0x44, 0x88, 0xA0,
-    0x43, 0x75, 0x8D, 0x1A, 0x54, 0x5D, 0xC8, 0x06, 0x16, 0x1B, 0xEF, 0x78, 0x00, 0x64, 0xA3, 0x8F,
-    0x18, 0x6D, 0xF6, 0x18, 0xE6, 0x20, 0x86, 0x36, 0x6D, 0x37, 0xDC, 0x86, 0xE7, 0x4B, 0x8A, 0x30,
-    0x57, 0x3F, 0xD2, 0x84, 0x1B, 0x3F, 0xFF, 0x05, 0x24, 0x5D, 0x9E, 0x51, 0xBA, 0x9E, 0x33, 0x1C,
-    0xB6, 0x20, 0x27, 0x5D, 0xB2, 0x9E, 0x39, 0x1B, 0xAE, 0x20, 0x2D, 0x72, 0x99, 0x43, 0x0B, 0x78,
-    0xA2, 0x9F, 0x0A, 0x49, 0x9C, 0x9E, 0x14, 0x06, 0x9F, 0x45, 0x01, 0x5D, 0x94, 0x9C, 0x07, 0x4D,
-    0x92, 0x51, 0x00, 0x58, 0x79, 0x43, 0x6A, 0x6C, 0x68, 0x88, 0x23, 0x1B, 0x7A, 0x6F, 0x6E, 0x16,
-    0x67, 0x66, 0x1F, 0x77, 0xA6, 0xFF, 0x7C, 0x9E, 0xB9, 0xFB, 0x79, 0x2C, 0xA2, 0x86, 0x70, 0x8F,
-    0xB6, 0x83, 0x6D, 0x43, 0xAB, 0xF8, 0x8D, 0x04, 0xA7, 0x7F, 0x82, 0x84, 0x34, 0x57, 0x42, 0x72,
-    0x51, 0x76, 0x31, 0x56, 0x54, 0x4A, 0x7A, 0x7D, 0x70, 0x5C, 0x68, 0x43, 0x36, 0x96, 0x48, 0x16,
-    0x55, 0x6E, 0x7D, 0x18, 0x78, 0x6D, 0x33, 0x90, 0x8C, 0x92, 0x1D, 0x2D, 0x8A, 0x4F, 0x17, 0x6B,
-    0xD9, 0xE1, 0xA8, 0x3D, 0xEE, 0x89, 0xE5, 0x3C, 0x48, 0xF4, 0x54, 0x3D, 0x28, 0xB3, 0x8D, 0xBE,
-    0x13, 0x83, 0x1D, 0xC1, 0x54, 0x0F, 0x94, 0x3F, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x30, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3B, 0xC3, 0x41, 0x8F, 0x31, 0xD7, 0x53,
-    0xA3, 0x31, 0xCA, 0x53, 0x77, 0x28, 0xC7, 0x7A, 0x8A, 0x1A, 0xE3, 0x7A, 0xAB, 0x1A, 0xCE, 0x61,
-    0x78, 0x4F, 0xCA, 0x11, 0x8B, 0x41, 0xE7, 0x23, 0xAC, 0x40, 0xD1, 0x26, 0xE0, 0x5B, 0x4A, 0x20,
-    0xE0, 0x42, 0x47, 0x68, 0xE2, 0x4C, 0x4F, 0x0D, 0xDE, 0x51, 0x42, 0x57, 0xFD, 0x41, 0x34, 0x63,
-    0xFF, 0x4B, 0x3B, 0x8B, 0xFE, 0x5A, 0x36, 0x2A, 0xFC, 0x50, 0x2F, 0x4F, 0xD9, 0x5D, 0x73, 0x20,
-    0xD8, 0x27, 0x6E, 0x68, 0xDB, 0x30, 0x7B, 0x87, 0xDC, 0x4B, 0x7E, 0x0A, 0xD6, 0x54, 0x67, 0x4E,
-    0xD5, 0x39, 0x64, 0x58, 0xF9, 0x27, 0x58, 0x63, 0xFC, 0x30, 0x65, 0x6F, 0xFD, 0x4B, 0x68, 0x31,
-    0xFA, 0x5D, 0x5D, 0x3D, 0xF7, 0x54, 0x51, 0x47, 0xF6, 0x39, 0x4E, 0x55, 0x4F, 0x3D, 0x71, 0x9F,
-    0xEB, 0x00, 0x26, 0x70, 0x66, 0x19, 0xCB, 0x7A, 0xDC, 0x0B, 0x7C, 0x70, 0x51, 0x84, 0x78, 0x1A,
-    0xF0, 0xA7, 0x36, 0x25, 0x68, 0x61, 0xD2, 0x07, 0xDF, 0x6C, 0x85, 0x25, 0xE2, 0x2F, 0x10, 0x59,
-    0xE4, 0x8E, 0x19, 0x4F, 0xF7, 0x13, 0x17, 0x5F, 0xFA, 0x9A, 0x24, 0x33, 0x51, 0x2C, 0xC5, 0x7A,
-    0x41, 0x44, 0x87, 0xA0, 0x42, 0x75, 0x8C, 0x1A, 0x52, 0x5D, 0xC9, 0x06, 0x14, 0x1B, 0xEE, 0x78,
-    0x00, 0x64, 0xA0, 0x94, 0x16, 0x6D, 0xF6, 0x18, 0xE4, 0x20, 0x8D, 0x36, 0x6B, 0x37, 0xDF, 0x86,
-    0xE6, 0x4B, 0x91, 0x30, 0x55, 0x3F, 0xD4, 0x84, 0x19, 0x3F, 0xFF, 0x05, 0x24, 0x5D, 0x9C, 0x51,
-    0xBA, 0x9E, 0x36, 0x1C, 0xB7, 0x20, 0x2A, 0x5D, 0xB2, 0x9E, 0x3C, 0x1B, 0xAF, 0x20, 0x2F, 0x72,
-    0x9B, 0x43, 0x0C, 0x78, 0xA4, 0x9F, 0x0B, 0x49, 0x9D, 0x9E, 0x14, 0x06, 0xA1, 0x45, 0x02, 0x5D,
-    0x96, 0x9C, 0x07, 0x4D, 0x94, 0x51, 0x00, 0x58, 0x79, 0x43, 0x6B, 0x6C, 0x6A, 0x88, 0x21, 0x1B,
-    0x7A, 0x6F, 0x70, 0x16, 0x69, 0x66, 0x1E, 0x77, 0xA5, 0xFF, 0x7F, 0x9E, 0xB9, 0xFB, 0x7D, 0x2C,
-    0xA2, 0x86, 0x74, 0x8F, 0xB5, 0x83, 0x71, 0x43, 0xAA, 0xF8, 0x91, 0x04, 0xA6, 0x7F, 0x85, 0x84,
-    0x36, 0x57, 0x3F, 0x72, 0x53, 0x76, 0x2F, 0x56, 0x54, 0x4A, 0x7A, 0x7D, 0x70, 0x5C, 0x69, 0x43,
-    0x37, 0x96, 0x45, 0x16, 0x55, 0x6E, 0x7D, 0x18, 0x7A, 0x6D, 0x33, 0x90, 0x8D, 0x92, 0x1D, 0x2D,
-    0x8B, 0x4F, 0x17, 0x6B, 0x41, 0x2E, 0xAA, 0x3D, 0xEE, 0x89, 0xE5, 0x3C, 0xB9, 0x76, 0x4F, 0x3D,
-    0x3C, 0xA5, 0x61, 0xBF, 0x13, 0x83, 0x1D, 0xC1, 0x26, 0xB5, 0xE1, 0x3F, 0x70, 0x6F, 0x69, 0x6E,
-    0x74, 0x30, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x3B, 0xC7, 0x41,
-    0x8C, 0x31, 0xDC, 0x53, 0xA1, 0x31, 0xD0, 0x53, 0x75, 0x28, 0xCA, 0x7A, 0x88, 0x1A, 0xE9, 0x7A,
-    0xA9, 0x1A, 0xD4, 0x61, 0x76, 0x4F, 0xCE, 0x11, 0x89, 0x41, 0xEC, 0x23, 0xAA, 0x40, 0xD8, 0x26,
-    0xE0, 0x5B, 0x50, 0x20, 0xE0, 0x42, 0x4D, 0x68, 0xE1, 0x4C, 0x55, 0x0C, 0xDE, 0x51, 0x48, 0x57,
-    0xFD, 0x41, 0x3B, 0x63, 0xFF, 0x4B, 0x43, 0x8B, 0xFE, 0x5A, 0x3D, 0x2A, 0xFC, 0x50, 0x35, 0x4F,
-    0xD8, 0x5D, 0x7A, 0x20, 0xD7, 0x27, 0x75, 0x68, 0xDA, 0x30, 0x82, 0x87, 0xDB, 0x4B, 0x85, 0x0A,
-    0xD5, 0x54, 0x6D, 0x4E, 0xD4, 0x39, 0x6A, 0x58, 0xF8, 0x27, 0x60, 0x63, 0xFC, 0x30, 0x6D, 0x6F,
-    0xFC, 0x4B, 0x70, 0x31, 0xFA, 0x5D, 0x65, 0x29, 0xF7, 0x54, 0x58, 0x47, 0xF6, 0x39, 0x55, 0x55,
-    0x4F, 0x3D, 0x70, 0x9F, 0xEC, 0x00, 0x2C, 0x70, 0x64, 0x19, 0xCE, 0x7A, 0xDB, 0x0B, 0x83, 0x6E,
-    0x51, 0x84, 0x78, 0x1A, 0xF0, 0xA7, 0x3D, 0x25, 0x66, 0x61, 0xD5, 0x07, 0xDD, 0x6C, 0x8D, 0x25,
-    0xE3, 0x2F, 0x14, 0x59, 0xE5, 0x8E, 0x1E, 0x4F, 0xF7, 0x13, 0x1D, 0x5F, 0xFB, 0x9A, 0x2B, 0x33,
-    0x50, 0x2C, 0xC6, 0x7A, 0x41, 0x44, 0x86, 0xA0, 0x42, 0x75, 0x8B, 0x1A, 0x51, 0x5D, 0xCB, 0x06,
-    0x12, 0x1B, 0xEE, 0x78, 0x00, 0x64, 0x9C, 0x94, 0x14, 0x6D, 0xF6, 0x18, 0xE3, 0x20, 0x95, 0x36,
-    0x69, 0x37, 0xE2, 0x86, 0xE4, 0x4B, 0x99, 0x30, 0x53, 0x3F, 0xD6, 0x84, 0x16, 0x3F, 0xFF, 0x05,
-    0x24, 0x5D, 0x9A, 0x51, 0xBB, 0x9E, 0x3A, 0x1C, 0xB8, 0x20, 0x2D, 0x60, 0xB3, 0x9E, 0x3F, 0x1B,
-    0xB0, 0x20, 0x32, 0x72, 0x9D, 0x43, 0x0C, 0x78, 0xA5, 0x9F, 0x0C, 0x49, 0x9F, 0x9E, 0x15, 0x06,
-    0xA3, 0x45, 0x03, 0x5D, 0x98, 0x9C, 0x08, 0x1C, 0x96, 0x51, 0x00, 0x58, 0x79, 0x43, 0x6D, 0x6C,
-    0x6C, 0x88, 0x20, 0x1B, 0x7A, 0x6F, 0x71, 0x16, 0x6B, 0x66, 0x1D, 0x77, 0xA4, 0xFF, 0x83, 0x9E,
-    0xB8, 0xFB, 0x82, 0x2C, 0xA1, 0x86, 0x77, 0x8F, 0xB5, 0x83, 0x76, 0x46, 0xA9, 0xF8, 0x96, 0x04,
-    0xA6, 0x7F, 0x8A, 0x84, 0x37, 0x57, 0x3B, 0x71, 0x54, 0x76, 0x2D, 0x56, 0x54, 0x4A, 0x79, 0x7D,
-    0x71, 0x5C, 0x6A, 0x43, 0x39, 0x96, 0x42, 0x16, 0x55, 0x6E, 0x7D, 0x18, 0x7B, 0x6D, 0x33, 0x90,
-    0x8F, 0x92, 0x1E, 0x2D, 0x8D, 0x4F, 0x17, 0x6B, 0xEA, 0x57, 0xAB, 0x3D, 0xF1, 0x89, 0xE5, 0x3C,
-    0x82, 0x77, 0x49, 0x3D, 0x34, 0xB9, 0xB3, 0xBF, 0x13, 0x83, 0x1D, 0xC1, 0xC6, 0x27, 0x1E, 0x40,
-    0x70, 0x6F, 0x69, 0x6E, 0x74, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x3B, 0xCB, 0x41, 0x8A, 0x31, 0xE2, 0x56, 0x9F, 0x31, 0xD6, 0x56, 0x73, 0x28, 0xCE, 0x7A,
-    0x85, 0x1A, 0xEE, 0x7A, 0xA6, 0x1A, 0xDC, 0x62, 0x74, 0x4F, 0xD2, 0x11, 0x86, 0x41, 0xF3, 0x08,
-    0xA7, 0x40, 0xE0, 0x26, 0xE0, 0x5B, 0x56, 0x20, 0xE0, 0x42, 0x54, 0x68, 0xE1, 0x4C, 0x5C, 0x0C,
-    0xDF, 0x51, 0x4E, 0x52, 0xFD, 0x41, 0x42, 0x63, 0xFF, 0x4B, 0x4B, 0x8B, 0xFE, 0x5A, 0x45, 0x2A,
-    0xFC, 0x50, 0x3D, 0x4F, 0xD7, 0x5D, 0x82, 0x20, 0xD6, 0x27, 0x7C, 0x68, 0xD9, 0x30, 0x8A, 0x87,
-    0xD9, 0x4B, 0x8D, 0x0A, 0xD5, 0x54, 0x74, 0x4E, 0xD4, 0x39, 0x71, 0x58, 0xF8, 0x27, 0x69, 0x63,
-    0xFB, 0x30, 0x77, 0x8C, 0xFB, 0x4B, 0x79, 0x31, 0xF9, 0x5D, 0x6E, 0x29, 0xF6, 0x54, 0x60, 0x47,
-    0xF6, 0x39, 0x5D, 0x55, 0x4F, 0x3D, 0x70, 0x58, 0xED, 0x00, 0x32, 0x70, 0x62, 0x19, 0xD1, 0x7A,
-    0xDA, 0x0B, 0x8B, 0x6E, 0x51, 0x84, 0x77, 0x1A, 0xF0, 0xA7, 0x44, 0x25, 0x64, 0x61, 0xD8, 0x07,
-    0xDC, 0x6C, 0x95, 0x25, 0xE4, 0x2F, 0x19, 0x59, 0xE6, 0x8E, 0x23, 0x4F, 0xF8, 0x13, 0x23, 0x5F,
-    0xFB, 0x9A, 0x32, 0x33, 0x4E, 0x2C, 0xC8, 0x7A, 0x41, 0x44, 0x85, 0xA0, 0x42, 0x75, 0x8B, 0x1A,
-    0x4F, 0x5D, 0xCD, 0x06, 0x11, 0x1B, 0xED, 0x78, 0x00, 0x64, 0x98, 0x94, 0x12, 0x6D, 0xF5, 0x16,
-    0xE1, 0x20, 0x9E, 0x38, 0x67, 0x37, 0xE6, 0x86, 0xE2, 0x4B, 0xA2, 0x30, 0x51, 0x3F, 0xD8, 0x84,
-    0x14, 0x3F, 0xFF, 0x05, 0x24, 0x5D, 0x98, 0x51, 0xBB, 0x9E, 0x3E, 0x1C, 0xB9, 0x20, 0x30, 0x60,
-    0xB3, 0x9E, 0x42, 0x1B, 0xB1, 0x20, 0x35, 0x72, 0x9F, 0x43, 0x0D, 0x78, 0xA7, 0x9F, 0x0D, 0x49,
-    0xA1, 0x9E, 0x17, 0x07, 0xA5, 0x45, 0x04, 0x5E, 0x9A, 0x9C, 0x08, 0x1C, 0x98, 0x51, 0x00, 0x58,
-    0x79, 0x43, 0x6E, 0x6C, 0x6E, 0x88, 0x1F, 0x1B, 0x7A, 0x6F, 0x73, 0x16, 0x6D, 0x66, 0x1B, 0x77,
-    0xA4, 0xFF, 0x88, 0x9E, 0xB7, 0xFB, 0x88, 0x2C, 0xA1, 0x86, 0x7B, 0x94, 0xB4, 0x83, 0x7B, 0x3F,
-    0xA7, 0xF8, 0x9C, 0x04, 0xA5, 0x7F, 0x8F, 0x84, 0x39, 0x57, 0x38, 0x71, 0x56, 0x76, 0x2B, 0x56,
-    0x54, 0x4A, 0x79, 0x7D, 0x71, 0x5C, 0x6B, 0x43, 0x3A, 0x96, 0x3E, 0x1B, 0x55, 0x6E, 0x7D, 0x18,
-    0x7C, 0x6D, 0x32, 0x90, 0x90, 0x92, 0x1E, 0x2D, 0x8F, 0x4F, 0x17, 0x6A, 0x30, 0x48, 0xAC, 0x3D,
-    0xF1, 0x89, 0xE5, 0x3C, 0x24, 0x60, 0x43, 0x3D, 0x46, 0xEC, 0xEE, 0xBF, 0x13, 0x83, 0x1D, 0xC1,
-    0x21, 0xBB, 0x4F, 0x40, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x31, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7B, 0x3B, 0xD0, 0x41, 0x88, 0x31, 0xE8, 0x54, 0x9C, 0x31, 0xDD, 0x56,
-    0x71, 0x28, 0xD2, 0x7A, 0x83, 0x1A, 0xF5, 0x7A, 0xA4, 0x1A, 0xE3, 0x62, 0x72, 0x4F, 0xD7, 0x11,
-    0x84, 0x41, 0xF9, 0x23, 0xA5, 0x40, 0xE7, 0x26, 0xE0, 0x5B, 0x5D, 0x1E, 0xE0, 0x42, 0x5A, 0x68,
-    0xE1, 0x4C, 0x63, 0x0C, 0xDF, 0x51, 0x55, 0x52, 0xFE, 0x41, 0x4A, 0x63, 0xFF, 0x4B, 0x53, 0x8B,
-    0xFE, 0x5A, 0x4D, 0x2A, 0xFD, 0x50, 0x45, 0x48, 0xD6, 0x5D, 0x89, 0x20, 0xD5, 0x27, 0x83, 0x68,
-    0xD8, 0x30, 0x92, 0x87, 0xD8, 0x4B, 0x95, 0x0A, 0xD4, 0x54, 0x7B, 0x4E, 0xD3, 0x39, 0x78, 0x58,
-    0xF7, 0x27, 0x71, 0x63, 0xFA, 0x30, 0x80, 0x8C, 0xFA, 0x4B, 0x83, 0x31, 0xF8, 0x5D, 0x77, 0x29,
-    0xF6, 0x54, 0x69, 0x47, 0xF5, 0x39, 0x66, 0x55, 0x50, 0x3D, 0x6F, 0x58, 0xED, 0x00, 0x39, 0x70,
-    0x61, 0x19, 0xD4, 0x7A, 0xD9, 0x0B, 0x93, 0x6E, 0x51, 0x84, 0x77, 0x1A, 0xF1, 0xA7, 0x4B, 0x25,
-    0x62, 0x61, 0xDC, 0x07, 0xDB, 0x6C, 0x9E, 0x25, 0xE5, 0x2F, 0x1F, 0x59, 0xE7, 0x8E, 0x29, 0x4F,
-    0xF9, 0x13, 0x2A, 0x5F, 0xFC, 0x9A, 0x39, 0x2E, 0x4D, 0x2C, 0xCA, 0x7A, 0x41, 0x44, 0x84, 0xA0,
-    0x42, 0x75, 0x8A, 0x1A, 0x4E, 0x5D, 0xCF, 0x06, 0x0F, 0x1B, 0xEC, 0x78, 0x00, 0x64, 0x94, 0x94,
-    0x10, 0x6D, 0xF5, 0x16, 0xE0, 0x20, 0xA7, 0x38, 0x65, 0x37, 0xEA, 0x86, 0xE1, 0x4B, 0xAB, 0x31,
-    0x50, 0x3F, 0xDB, 0x84, 0x12, 0x3F, 0xFF, 0x05, 0x24, 0x5D, 0x96, 0x51, 0xBC, 0x9E, 0x42, 0x26,
-    0xBA, 0x20, 0x34, 0x60, 0xB4, 0x9E, 0x46, 0x1B, 0xB1, 0x20, 0x38, 0x71, 0xA0, 0x43, 0x0E, 0x78,
-    0xA9, 0x9F, 0x0E, 0x49, 0xA2, 0x9E, 0x18, 0x07, 0xA7, 0x45, 0x05, 0x5E, 0x9C, 0x9C, 0x08, 0x1C,
-    0x9A, 0x51, 0x00, 0x58, 0x79, 0x43, 0x70, 0x6C, 0x6F, 0x88, 0x1D, 0x1B, 0x7A, 0x6F, 0x75, 0x16,
-    0x6F, 0x66, 0x19, 0x77, 0xA3, 0xFF, 0x8D, 0x9E, 0xB6, 0xFB, 0x8E, 0x2C, 0xA1, 0x86, 0x80, 0x94,
-    0xB4, 0x83, 0x81, 0x3F, 0xA6, 0xF8, 0xA1, 0x04, 0xA4, 0x7F, 0x94, 0x7F, 0x3A, 0x57, 0x34, 0x71,
-    0x58, 0x76, 0x28, 0x56, 0x54, 0x4A, 0x79, 0x7D, 0x71, 0x5C, 0x6B, 0x43, 0x3C, 0x96, 0x3B, 0x1B,
-    0x55, 0x6E, 0x7D, 0x18, 0x7D, 0x6D, 0x32, 0x92, 0x92, 0x92, 0x1F, 0x08, 0x91, 0x4F, 0x17, 0x6B,
-    0x79, 0xF6, 0xAC, 0x3D, 0xF1, 0x89, 0xE5, 0x3C, 0x59, 0xAC, 0x3D, 0x3D, 0xD0, 0xD3, 0x12, 0xC0,
-    0x13, 0x83, 0x1D, 0xC1, 0xC7, 0x9D, 0x81, 0x40, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x31, 0x32, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3B, 0xD4, 0x41, 0x86, 0x31, 0xEE, 0x56,
-    0x9B, 0x31, 0xE4, 0x56, 0x70, 0x28, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A, 0xA2, 0x1A, 0xEA, 0x62,
-    0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20,
-    0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63,
-    0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20,
-    0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E,
-    0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31,
-    0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58,
-    0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x19, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1A,
-    0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59,
-    0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A,
-    0x41, 0x44, 0x83, 0xA0, 0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5D, 0xD1, 0x06, 0x0D, 0x1B, 0xEB, 0x78,
-    0x00, 0x64, 0x90, 0x94, 0x0F, 0x6D, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38, 0x63, 0x37, 0xEE, 0x86,
-    0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x3F, 0xDD, 0x84, 0x10, 0x3F, 0xFF, 0x05, 0x23, 0x5D, 0x94, 0x51,
-    0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71,
-    0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E,
-    0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58, 0x79, 0x43, 0x71, 0x6C, 0x71, 0x88, 0x1B, 0x1B,
-    0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E, 0xB5, 0xFB, 0x94, 0x2C,
-    0xA0, 0x86, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x3F, 0xA5, 0xF8, 0xA7, 0x01, 0xA3, 0x7F, 0x99, 0x7F,
-    0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56, 0x54, 0x4A, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F,
-    0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6E, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08,
-    0x92, 0x4F, 0x18, 0x6A, 0xE4, 0x0C, 0xAE, 0x3D, 0x1B, 0xC3, 0x03, 0x3D, 0x49, 0xC8, 0x33, 0x3D,
-    0xFD, 0x30, 0x92, 0xBD, 0x82, 0x4F, 0x47, 0xC1, 0x0D, 0x10, 0x6B, 0xC0, 0x63, 0x72, 0x73, 0x74,
-    0x6E, 0x64, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x78, 0xD0, 0x43,
-    0x7A, 0x79, 0xF0, 0x55, 0x8F, 0x73, 0xED, 0x55, 0x66, 0x69, 0xD3, 0x78, 0x73, 0x6B, 0xFF, 0x79,
-    0x95, 0x61, 0xFA, 0x70, 0x67, 0x8B, 0xD1, 0x15, 0x74, 0x8D, 0xFD, 0x23, 0x96, 0x83, 0xF8, 0x49,
-    0xDF, 0x5C, 0x7C, 0x1C, 0xDE, 0x46, 0x7E, 0x6A, 0xDF, 0x52, 0x85, 0x0E, 0xDE, 0x50, 0x75, 0x59,
-    0xFD, 0x3D, 0x79, 0x64, 0xFD, 0x49, 0x80, 0x85, 0xFD, 0x53, 0x77, 0x2A, 0xFD, 0x47, 0x70, 0x4A,
-    0xD1, 0x71, 0xA5, 0x1E, 0xCF, 0x42, 0xA8, 0x6B, 0xD0, 0x4F, 0xB6, 0x86, 0xD1, 0x67, 0xB5, 0x08,
-    0xD0, 0x64, 0x97, 0x53, 0xCF, 0x4C, 0x98, 0x5B, 0xF2, 0x38, 0xA3, 0x70, 0xF3, 0x45, 0xB1, 0x8B,
-    0xF4, 0x5D, 0xB0, 0x0D, 0xF4, 0x67, 0xA0, 0x29, 0xF3, 0x5A, 0x92, 0x48, 0xF2, 0x42, 0x93, 0x66,
-    0x50, 0x52, 0x5C, 0x9F, 0xED, 0x00, 0x6C, 0x6C, 0x55, 0x5E, 0xD1, 0x79, 0xD0, 0x30, 0xBF, 0x6C,
-    0x52, 0x91, 0x58, 0x4D, 0xF3, 0x93, 0x63, 0x2C, 0x58, 0x9E, 0xCD, 0x17, 0xD4, 0x86, 0xB9, 0x25,
-    0xE9, 0x1D, 0x46, 0x5D, 0xEC, 0x70, 0x41, 0x56, 0xFB, 0x09, 0x5E, 0x66, 0xFF, 0x80, 0x57, 0x2E,
-    0x44, 0x6A, 0xBB, 0x79, 0x40, 0x62, 0x6C, 0x9F, 0x42, 0x8E, 0x69, 0x4D, 0x45, 0x96, 0xB9, 0x21,
-    0x03, 0x6F, 0xCA, 0x78, 0x00, 0x88, 0x5D, 0x9B, 0x06, 0xB7, 0xC5, 0x1B, 0xD6, 0x4A, 0xD2, 0x3A,
-    0x57, 0x81, 0xE4, 0x04, 0xD7, 0x70, 0xCF, 0x32, 0x45, 0x82, 0xCB, 0x02, 0x06, 0x95, 0xD8, 0x04,
-    0x22, 0x81, 0x6E, 0x52, 0xC0, 0x8B, 0x46, 0x47, 0xBC, 0x1B, 0x4D, 0x5C, 0xB8, 0x8D, 0x48, 0x1A,
-    0xB4, 0x1E, 0x4F, 0x73, 0xA9, 0x2A, 0x17, 0x7D, 0xB3, 0x77, 0x0B, 0x4B, 0xAC, 0x7A, 0x12, 0x22,
-    0xB0, 0x28, 0x10, 0x63, 0xA7, 0x72, 0x00, 0x4F, 0xA4, 0x30, 0x04, 0x5B, 0x79, 0x56, 0x6C, 0x88,
-    0x79, 0x6D, 0x08, 0x9E, 0x7A, 0x7C, 0x6A, 0x1B, 0x78, 0x4F, 0x0A, 0x76, 0xA3, 0xFD, 0x79, 0x53,
-    0xB5, 0xF9, 0x82, 0x2B, 0x9F, 0x92, 0x80, 0x9B, 0xB1, 0x8F, 0x89, 0x34, 0xA4, 0xFF, 0x90, 0x03,
-    0xA0, 0x95, 0x97, 0x00, 0x42, 0x51, 0x13, 0x73, 0x61, 0x64, 0x0D, 0x5F, 0x54, 0x62, 0x66, 0x7C,
-    0x72, 0x69, 0x60, 0x46, 0x44, 0x88, 0x10, 0x1A, 0x55, 0x81, 0x64, 0x16, 0x84, 0x5E, 0x28, 0x8E,
-    0x9B, 0x74, 0x15, 0x23, 0x99, 0x39, 0x19, 0x82, 0x32, 0x46, 0xAC, 0x3D, 0x2F, 0x54, 0x0E, 0x3D,
-    0xB4, 0xCE, 0x37, 0x3D, 0xC3, 0xBB, 0xDA, 0xBF, 0xCA, 0xCF, 0x6B, 0xC1, 0x5A, 0x73, 0x98, 0xC0,
-    0x63, 0x72, 0x73, 0x74, 0x6E, 0x64, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x73, 0x91, 0xD2, 0x44, 0x7E, 0x90, 0xF0, 0x60, 0x93, 0x85, 0xEA, 0x60, 0x69, 0x87, 0xD5, 0x78,
-    0x77, 0x86, 0xFF, 0x78, 0x99, 0x73, 0xF6, 0x69, 0x6C, 0xA6, 0xD3, 0x15, 0x7A, 0xA4, 0xFC, 0x23,
-    0x9C, 0x92, 0xF4, 0x49, 0xDE, 0x58, 0x73, 0x26, 0xDD, 0x44, 0x75, 0x79, 0xDE, 0x4F, 0x7C, 0x0E,
-    0xDD, 0x4E, 0x6C, 0x59, 0xFB, 0x34, 0x6D, 0x62, 0xFC, 0x3F, 0x74, 0x85, 0xFD, 0x48, 0x6B, 0x29,
-    0xFB, 0x3D, 0x64, 0x55, 0xD3, 0x70, 0x9C, 0x1E, 0xCF, 0x45, 0xA0, 0x7A, 0xD1, 0x52, 0xAE, 0x86,
-    0xD3, 0x67, 0xAC, 0x08, 0xD1, 0x64, 0x8F, 0x53, 0xCF, 0x4F, 0x91, 0x5B, 0xF1, 0x33, 0x97, 0x69,
-    0xF4, 0x3F, 0xA5, 0x8C, 0xF5, 0x54, 0xA3, 0x0D, 0xF5, 0x5E, 0x93, 0x33, 0xF3, 0x52, 0x86, 0x48,
-    0xF1, 0x3C, 0x88, 0x5E, 0x4E, 0x76, 0x65, 0x9F, 0xE8, 0x00, 0x63, 0x6C, 0x58, 0x82, 0xD6, 0x83,
-    0xD0, 0x35, 0xB6, 0x6C, 0x53, 0xAF, 0x60, 0x4D, 0xF4, 0x85, 0x57, 0x2A, 0x5C, 0xBB, 0xD1, 0x21,
-    0xD7, 0x83, 0xAF, 0x2A, 0xE4, 0x1B, 0x3E, 0x5D, 0xEB, 0x67, 0x37, 0x56, 0xF6, 0x05, 0x54, 0x66,
-    0xFF, 0x70, 0x4A, 0x33, 0x45, 0x91, 0xC2, 0x79, 0x3F, 0x8A, 0x75, 0x9F, 0x42, 0xB1, 0x72, 0x4D,
-    0x49, 0xB9, 0xBF, 0x21, 0x06, 0xA7, 0xD8, 0x7D, 0x00, 0xBD, 0x6E, 0x94, 0x0C, 0xE8, 0xD2, 0x22,
-    0xD7, 0x4C, 0xC8, 0x8C, 0x5C, 0xA1, 0xE7, 0x05, 0xDA, 0x6E, 0xC5, 0x32, 0x49, 0xA7, 0xD1, 0x02,
-    0x0A, 0xC9, 0xE5, 0x04, 0x23, 0xAD, 0x7B, 0x52, 0xC0, 0x8B, 0x42, 0x47, 0xB8, 0x26, 0x4A, 0x5C,
-    0xB8, 0x90, 0x44, 0x1D, 0xAF, 0x2B, 0x4C, 0x77, 0xA3, 0x38, 0x17, 0x7D, 0xB0, 0x7C, 0x09, 0x4B,
-    0xA9, 0x81, 0x11, 0x21, 0xAA, 0x34, 0x0F, 0x5C, 0xA3, 0x7A, 0x00, 0x4F, 0x9E, 0x3F, 0x05, 0x5B,
-    0x77, 0x6F, 0x6F, 0x82, 0x75, 0x82, 0x0D, 0x1A, 0x7A, 0x92, 0x6C, 0x1B, 0x73, 0x67, 0x0F, 0x76,
-    0xA9, 0xFD, 0x75, 0x4E, 0xBB, 0xF4, 0x7C, 0x2B, 0xA1, 0x9C, 0x7D, 0x94, 0xB3, 0x94, 0x84, 0x46,
-    0xAB, 0xFF, 0x8C, 0x03, 0xA3, 0x9F, 0x94, 0x01, 0x3E, 0x77, 0x1F, 0x72, 0x5D, 0x81, 0x15, 0x5F,
-    0x53, 0x83, 0x6D, 0x7C, 0x71, 0x82, 0x64, 0x46, 0x42, 0xAA, 0x1B, 0x1A, 0x55, 0xA0, 0x6B, 0x16,
-    0x81, 0x73, 0x2B, 0x8E, 0x98, 0x80, 0x16, 0x23, 0x93, 0x4B, 0x1B, 0x82, 0x5F, 0x59, 0xA6, 0x3D,
-    0x2D, 0x5F, 0x29, 0x3D, 0x4E, 0x93, 0x3B, 0x3D, 0x28, 0x45, 0x3F, 0xC0, 0xF9, 0x1D, 0x88, 0xC1,
-    0x5D, 0xCD, 0xB8, 0xC0, 0x63, 0x72, 0x73, 0x74, 0x6E, 0x64, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x9A, 0xD3, 0x44, 0x84, 0x97, 0xEF, 0x54, 0x98, 0x87, 0xE7, 0x60,
-    0x6D, 0x94, 0xD8, 0x7D, 0x7D, 0x90, 0xFF, 0x78, 0x9E, 0x77, 0xF2, 0x68, 0x71, 0xAD, 0xD5, 0x16,
-    0x81, 0xA8, 0xFC, 0x25, 0xA2, 0x90, 0xEF, 0x48, 0xDE, 0x4D, 0x69, 0x26, 0xDB, 0x3C, 0x6B, 0x79,
-    0xDE, 0x45, 0x71, 0x0D, 0xDC, 0x44, 0x62, 0x57, 0xF9, 0x26, 0x5F, 0x69, 0xFB, 0x2F, 0x66, 0x85,
-    0xFC, 0x37, 0x5D, 0x29, 0xF9, 0x2E, 0x56, 0x55, 0xD5, 0x64, 0x93, 0x26, 0xCF, 0x41, 0x97, 0x79,
-    0xD3, 0x4B, 0xA4, 0x86, 0xD6, 0x5C, 0xA2, 0x2D, 0xD2, 0x5A, 0x86, 0x53, 0xCF, 0x49, 0x88, 0x9F,
-    0xF1, 0x28, 0x8A, 0x69, 0xF4, 0x32, 0x97, 0x8A, 0xF7, 0x43, 0x94, 0x31, 0xF7, 0x4B, 0x85, 0x3F,
-    0xF3, 0x41, 0x78, 0x48, 0xF0, 0x30, 0x7B, 0x5E, 0x4B, 0x8D, 0x6E, 0x9F, 0xE2, 0x00, 0x59, 0x6B,
-    0x5A, 0x95, 0xDB, 0x83, 0xD0, 0x34, 0xAD, 0x6C, 0x53, 0xBB, 0x68, 0x4D, 0xF5, 0x6C, 0x4A, 0x2B,
-    0x63, 0xC3, 0xD5, 0x21, 0xDB, 0x73, 0xA4, 0x2A, 0xDE, 0x17, 0x35, 0x5B, 0xE9, 0x55, 0x2C, 0x56,
-    0xF0, 0x00, 0x48, 0x63, 0xFF, 0x57, 0x3C, 0x33, 0x48, 0xA6, 0xCA, 0x78, 0x3E, 0xA1, 0x80, 0xA1,
-    0x43, 0xC1, 0x7C, 0x4D, 0x4E, 0xC7, 0xC6, 0x24, 0x09, 0xCA, 0xE8, 0x7D, 0x00, 0xDD, 0x81, 0x94,
-    0x13, 0xFF, 0xE1, 0x22, 0xD9, 0x44, 0xBD, 0x8C, 0x61, 0xAD, 0xEB, 0x05, 0xDE, 0x61, 0xB9, 0x30,
-    0x4D, 0xB8, 0xD8, 0x02, 0x10, 0xE6, 0xF4, 0x09, 0x23, 0xC7, 0x89, 0x52, 0xC0, 0x7F, 0x3C, 0x49,
-    0xB2, 0x2D, 0x47, 0x5C, 0xB8, 0x85, 0x3F, 0x1D, 0xAA, 0x33, 0x4A, 0x77, 0x9B, 0x42, 0x18, 0x7D,
-    0xAC, 0x76, 0x07, 0x41, 0xA6, 0x7C, 0x10, 0x21, 0xA2, 0x3C, 0x0F, 0x5A, 0x9F, 0x78, 0x00, 0x4F,
-    0x96, 0x48, 0x07, 0x9F, 0x75, 0x7C, 0x73, 0x82, 0x71, 0x8B, 0x13, 0x1D, 0x7A, 0x98, 0x6F, 0x1F,
-    0x6D, 0x75, 0x16, 0x76, 0xB1, 0xE4, 0x70, 0x4E, 0xC4, 0xD8, 0x74, 0x2B, 0xA3, 0x96, 0x7A, 0x94,
-    0xB6, 0x8A, 0x7E, 0x45, 0xB4, 0xE6, 0x86, 0x07, 0xA6, 0x98, 0x90, 0x01, 0x38, 0x92, 0x2C, 0x72,
-    0x58, 0x91, 0x1E, 0x60, 0x51, 0x97, 0x76, 0x90, 0x6F, 0x8D, 0x69, 0x45, 0x3F, 0xBB, 0x27, 0x1F,
-    0x55, 0xAE, 0x73, 0x22, 0x7D, 0x7B, 0x2F, 0x13, 0x94, 0x80, 0x17, 0x25, 0x8D, 0x55, 0x1D, 0x82,
-    0xF9, 0x7A, 0x9D, 0x3D, 0x7D, 0xA6, 0x4C, 0x3D, 0x72, 0x42, 0x3E, 0x3D, 0x5A, 0x86, 0x71, 0xC0,
-    0xF9, 0xB1, 0x97, 0xC1, 0xD5, 0xF4, 0xD1, 0xC0, 0x63, 0x72, 0x73, 0x74, 0x6E, 0x64, 0x30, 0x34,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x98, 0xD4, 0x66, 0x8A, 0x93, 0xEE, 0x59,
-    0x9E, 0x82, 0xE3, 0x59, 0x70, 0x95, 0xDA, 0x7D, 0x83, 0x8F, 0xFE, 0x83, 0xA3, 0x74, 0xEE, 0x68,
-    0x76, 0xA9, 0xD6, 0x17, 0x89, 0xA2, 0xFA, 0x25, 0xA9, 0x87, 0xEA, 0x4B, 0xDE, 0x43, 0x60, 0x26,
-    0xDA, 0x36, 0x63, 0x79, 0xDD, 0x3D, 0x69, 0x0D, 0xDA, 0x3C, 0x5A, 0x57, 0xF7, 0x1E, 0x54, 0x69,
-    0xFA, 0x24, 0x5A, 0x8B, 0xFB, 0x2B, 0x51, 0x33, 0xF7, 0x24, 0x4B, 0x55, 0xD8, 0x58, 0x8A, 0x26,
-    0xCF, 0x3D, 0x90, 0x79, 0xD4, 0x44, 0x9C, 0x86, 0xD8, 0x52, 0x99, 0x2D, 0xD3, 0x51, 0x7E, 0x53,
-    0xCF, 0x43, 0x81, 0x9F, 0xF0, 0x21, 0x7F, 0x69, 0xF5, 0x29, 0x8B, 0x8A, 0xF9, 0x36, 0x88, 0x31,
-    0xF9, 0x3D, 0x79, 0x3F, 0xF4, 0x35, 0x6D, 0x4A, 0xF0, 0x28, 0x70, 0x5E, 0x49, 0x95, 0x76, 0xA1,
-    0xDC, 0x03, 0x51, 0x6B, 0x5E, 0x99, 0xDF, 0x83, 0xD0, 0x32, 0xA5, 0x6C, 0x54, 0xB9, 0x6E, 0x1C,
-    0xF7, 0x57, 0x3F, 0x29, 0x69, 0xBE, 0xD7, 0x23, 0xE0, 0x63, 0x9A, 0x29, 0xD8, 0x16, 0x2E, 0x58,
-    0xE7, 0x47, 0x23, 0x54, 0xEA, 0x00, 0x3F, 0x63, 0xFF, 0x44, 0x30, 0x34, 0x4B, 0xAB, 0xD1, 0x78,
-    0x3D, 0xA9, 0x89, 0xA1, 0x44, 0xC2, 0x83, 0x4D, 0x53, 0xC5, 0xCB, 0x24, 0x0D, 0xD5, 0xF5, 0x7D,
-    0x00, 0xE6, 0x90, 0x93, 0x1A, 0xFF, 0xEC, 0x22, 0xDC, 0x3E, 0xB3, 0x6F, 0x67, 0xAC, 0xEE, 0x0E,
-    0xE3, 0x54, 0xAF, 0x30, 0x52, 0xB9, 0xDD, 0x04, 0x16, 0xEB, 0xFF, 0x09, 0x23, 0xCD, 0x94, 0x52,
-    0xC0, 0x71, 0x37, 0x48, 0xAC, 0x31, 0x45, 0x5B, 0xB8, 0x78, 0x3B, 0x1D, 0xA4, 0x38, 0x49, 0x76,
-    0x94, 0x46, 0x19, 0x7C, 0xA8, 0x6E, 0x05, 0x41, 0xA2, 0x74, 0x0F, 0x24, 0x9A, 0x40, 0x0F, 0x5A,
-    0x9A, 0x72, 0x00, 0x4F, 0x8E, 0x4C, 0x08, 0x9F, 0x74, 0x7E, 0x76, 0x82, 0x6C, 0x8B, 0x18, 0x1D,
-    0x7B, 0x94, 0x71, 0x1F, 0x67, 0x7A, 0x1B, 0x7B, 0xB9, 0xC8, 0x6A, 0x4E, 0xCC, 0xBB, 0x6C, 0x3D,
-    0xA6, 0x8B, 0x77, 0x93, 0xB9, 0x7D, 0x79, 0x45, 0xBD, 0xC9, 0x7F, 0x07, 0xAA, 0x8C, 0x8C, 0x04,
-    0x32, 0x9C, 0x37, 0x75, 0x53, 0x95, 0x26, 0x60, 0x50, 0x9C, 0x7C, 0x90, 0x6E, 0x8E, 0x6C, 0x45,
-    0x3C, 0xBC, 0x30, 0x1F, 0x55, 0xAE, 0x78, 0x21, 0x79, 0x7C, 0x32, 0x13, 0x91, 0x7B, 0x18, 0x25,
-    0x86, 0x59, 0x1F, 0x82, 0x04, 0x94, 0x96, 0x3D, 0x6D, 0x06, 0x61, 0x3D, 0xBE, 0x33, 0x43, 0x3D,
-    0x48, 0x2C, 0x85, 0xC0, 0x28, 0x96, 0xA0, 0xC1, 0xAC, 0x0A, 0xE1, 0xC0, 0x63, 0x72, 0x73, 0x74,
-    0x6E, 0x64, 0x30, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x97, 0xCF, 0x66,
-    0x8E, 0x91, 0xE8, 0x59, 0xA2, 0x80, 0xDD, 0x59, 0x73, 0x96, 0xD7, 0x7D, 0x87, 0x8E, 0xF9, 0x7D,
-    0xA7, 0x72, 0xE7, 0x68, 0x7A, 0xA7, 0xD2, 0x17, 0x8E, 0x9F, 0xF4, 0x2A, 0xAE, 0x83, 0xE2, 0x48,
-    0xDD, 0x3E, 0x5A, 0x26, 0xD9, 0x33, 0x5D, 0x79, 0xDD, 0x39, 0x63, 0x32, 0xD9, 0x38, 0x54, 0x57,
-    0xF5, 0x1A, 0x4D, 0x67, 0xFA, 0x20, 0x53, 0x8B, 0xFA, 0x25, 0x4A, 0x3F, 0xF6, 0x1F, 0x45, 0x55,
-    0xD9, 0x53, 0x83, 0x28, 0xCF, 0x3B, 0x89, 0x78, 0xD5, 0x41, 0x95, 0x86, 0xDA, 0x4D, 0x91, 0x2F,
-    0xD4, 0x4C, 0x77, 0x53, 0xCF, 0x40, 0x7B, 0xA1, 0xF0, 0x1E, 0x77, 0x67, 0xF6, 0x25, 0x83, 0x8A,
-    0xFB, 0x31, 0x7F, 0x31, 0xFA, 0x36, 0x71, 0x3F, 0xF4, 0x30, 0x65, 0x4A, 0xEF, 0x24, 0x69, 0x5D,
-    0x47, 0x98, 0x78, 0xA1, 0xD9, 0x04, 0x4C, 0x6B, 0x60, 0x9B, 0xDC, 0x83, 0xD1, 0x31, 0x9E, 0x6A,
-    0x54, 0xB8, 0x6E, 0x1C, 0xF8, 0x4E, 0x37, 0x3D, 0x6D, 0xBB, 0xD3, 0x24, 0xE3, 0x5C, 0x92, 0x29,
-    0xD4, 0x16, 0x2A, 0x58, 0xE6, 0x40, 0x1E, 0x54, 0xE6, 0x00, 0x3A, 0x5C, 0xFF, 0x3C, 0x29, 0x34,
-    0x4D, 0xAE, 0xCF, 0x83, 0x3C, 0xAC, 0x8A, 0x96, 0x45, 0xC2, 0x84, 0x4D, 0x56, 0xC4, 0xC9, 0x2C,
-    0x0F, 0xDB, 0xF6, 0x80, 0x00, 0xEA, 0x95, 0x93, 0x1E, 0xFF, 0xEB, 0x20, 0xDE, 0x3B, 0xAB, 0x6F,
-    0x6B, 0xAC, 0xEA, 0x0E, 0xE6, 0x4E, 0xA6, 0x3C, 0x55, 0xB9, 0xDB, 0x05, 0x1A, 0xED, 0xFF, 0x0A,
-    0x24, 0xD0, 0x96, 0x50, 0xBF, 0x6B, 0x33, 0x48, 0xA8, 0x33, 0x43, 0x5B, 0xB8, 0x72, 0x37, 0x1D,
-    0xA0, 0x3A, 0x47, 0x76, 0x8F, 0x48, 0x19, 0x7C, 0xA5, 0x6A, 0x04, 0x41, 0xA0, 0x70, 0x0E, 0x24,
-    0x95, 0x42, 0x10, 0x71, 0x97, 0x6F, 0x00, 0x48, 0x89, 0x4E, 0x09, 0x9F, 0x73, 0x7F, 0x75, 0x82,
-    0x69, 0x8B, 0x1A, 0x1D, 0x7B, 0x93, 0x70, 0x1F, 0x62, 0x7C, 0x1E, 0x7B, 0xBE, 0xBB, 0x64, 0x4E,
-    0xD1, 0xAD, 0x64, 0x3D, 0xA7, 0x86, 0x73, 0x93, 0xBB, 0x77, 0x74, 0x45, 0xC3, 0xBC, 0x78, 0x09,
-    0xAC, 0x86, 0x87, 0x04, 0x2E, 0xA1, 0x3C, 0x75, 0x4F, 0x97, 0x29, 0x60, 0x4F, 0x9E, 0x7D, 0x90,
-    0x6E, 0x8E, 0x6C, 0x65, 0x3A, 0xBD, 0x34, 0x1F, 0x56, 0xAE, 0x79, 0x21, 0x76, 0x7C, 0x33, 0x15,
-    0x8E, 0x78, 0x17, 0x2A, 0x81, 0x5B, 0x20, 0x81, 0xEE, 0x9F, 0x97, 0x3D, 0xC6, 0xB8, 0x60, 0x3D,
-    0xBC, 0xA1, 0x40, 0x3D, 0x66, 0x42, 0x8A, 0xC0, 0xCC, 0x91, 0xA0, 0xC1, 0x84, 0xFA, 0xE3, 0xC0,
-    0x63, 0x72, 0x73, 0x74, 0x6E, 0x64, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x98, 0xD1, 0x66, 0x8E, 0x93, 0xEA, 0x59, 0xA2, 0x82, 0xDF, 0x59, 0x73, 0x97, 0xD8, 0x7D,
-    0x87, 0x90, 0xFB, 0x7D, 0xA7, 0x75, 0xEA, 0x68, 0x7A, 0xA8, 0xD3, 0x17, 0x8E, 0xA1, 0xF6, 0x2A,
-    0xAE, 0x86, 0xE5, 0x4B, 0xDE, 0x3F, 0x5C, 0x49, 0xD9, 0x33, 0x60, 0x79, 0xDD, 0x39, 0x65, 0x0D,
-    0xDA, 0x39, 0x57, 0x57, 0xF6, 0x1B, 0x51, 0x67, 0xFA, 0x20, 0x56, 0x8B, 0xFA, 0x26, 0x4D, 0x3F,
-    0xF6, 0x20, 0x48, 0x54, 0xD9, 0x54, 0x85, 0x28, 0xD0, 0x3C, 0x8D, 0x78, 0xD5, 0x43, 0x98, 0x86,
-    0xDA, 0x4E, 0x94, 0x2D, 0xD4, 0x4D, 0x7A, 0x53, 0xCF, 0x41, 0x7E, 0xA1, 0xF0, 0x20, 0x7B, 0x68,
-    0xF6, 0x26, 0x86, 0x8A, 0xFB, 0x32, 0x83, 0x31, 0xFA, 0x37, 0x74, 0x3F, 0xF4, 0x31, 0x68, 0x4A,
-    0xF0, 0x25, 0x6C, 0x5D, 0x47, 0x97, 0x78, 0xA1, 0xD9, 0x04, 0x50, 0x6B, 0x60, 0x9C, 0xDE, 0x83,
-    0xD1, 0x32, 0xA2, 0x6A, 0x54, 0xB7, 0x6E, 0x1C, 0xF8, 0x4E, 0x39, 0x3D, 0x6D, 0xBC, 0xD4, 0x24,
-    0xE3, 0x5E, 0x94, 0x29, 0xD5, 0x15, 0x2D, 0x58, 0xE6, 0x40, 0x20, 0x54, 0xE7, 0x00, 0x3E, 0x5C,
-    0xFF, 0x3C, 0x2B, 0x34, 0x4D, 0xAE, 0xD1, 0x83, 0x3C, 0xAB, 0x8B, 0x96, 0x45, 0xC0, 0x84, 0x4D,
-    0x56, 0xC4, 0xCA, 0x24, 0x0F, 0xDB, 0xF6, 0x80, 0x00, 0xE8, 0x93, 0x93, 0x1E, 0xFF, 0xEB, 0x20,
-    0xDE, 0x3D, 0xAF, 0x8C, 0x6B, 0xAD, 0xEC, 0x0E, 0xE5, 0x50, 0xA9, 0x3C, 0x55, 0xBA, 0xDC, 0x04,
-    0x1A, 0xEE, 0xFF, 0x0A, 0x24, 0xCE, 0x96, 0x50, 0xBF, 0x6A, 0x34, 0x48, 0xA9, 0x32, 0x45, 0x5B,
-    0xB8, 0x71, 0x38, 0x1D, 0xA1, 0x39, 0x49, 0x76, 0x8F, 0x46, 0x1A, 0x7C, 0xA6, 0x68, 0x05, 0x41,
-    0xA0, 0x6E, 0x0E, 0x24, 0x95, 0x40, 0x11, 0x71, 0x97, 0x6D, 0x00, 0x48, 0x89, 0x4C, 0x0A, 0x9F,
-    0x73, 0x7F, 0x76, 0x82, 0x69, 0x88, 0x19, 0x1D, 0x7B, 0x92, 0x70, 0x1F, 0x63, 0x79, 0x1E, 0x7B,
-    0xBD, 0xBB, 0x63, 0x4E, 0xD0, 0xAD, 0x64, 0x3D, 0xA7, 0x86, 0x74, 0x93, 0xBA, 0x78, 0x75, 0x45,
-    0xC2, 0xBC, 0x78, 0x08, 0xAC, 0x87, 0x88, 0x04, 0x2E, 0x9E, 0x3B, 0x75, 0x4F, 0x94, 0x28, 0x60,
-    0x4F, 0x9D, 0x7E, 0x90, 0x6E, 0x8D, 0x6D, 0x65, 0x3A, 0xBA, 0x33, 0x1F, 0x56, 0xAD, 0x79, 0x21,
-    0x76, 0x7A, 0x33, 0x15, 0x8E, 0x76, 0x18, 0x2A, 0x82, 0x59, 0x21, 0x81, 0x79, 0x2C, 0x9F, 0x3D,
-    0x5D, 0xE3, 0x4D, 0x3D, 0x5D, 0xF0, 0x3B, 0x3D, 0xE3, 0x7D, 0x78, 0xC0, 0xD7, 0x58, 0x97, 0xC1,
-    0xE2, 0xEC, 0xD5, 0xC0, 0x63, 0x72, 0x73, 0x74, 0x6E, 0x64, 0x30, 0x37, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x9B, 0xD3, 0x66, 0x89, 0x98, 0xEE, 0x59, 0x9E, 0x87, 0xE5, 0x59,
-    0x70, 0x98, 0xDA, 0x7D, 0x82, 0x95, 0xFF, 0x83, 0xA3, 0x7A, 0xF1, 0x68, 0x76, 0xAC, 0xD4, 0x17,
-    0x88, 0xA8, 0xF9, 0x25, 0xA9, 0x8E, 0xEB, 0x4A, 0xDE, 0x44, 0x65, 0x26, 0xDA, 0x37, 0x68, 0x79,
-    0xDD, 0x3E, 0x6E, 0x0D, 0xDB, 0x3C, 0x5F, 0x57, 0xF7, 0x1F, 0x5B, 0x69, 0xFB, 0x26, 0x61, 0x8B,
-    0xFB, 0x2C, 0x58, 0x33, 0xF8, 0x25, 0x52, 0x55, 0xD8, 0x5B, 0x8D, 0x26, 0xD0, 0x40, 0x95, 0x79,
-    0xD4, 0x48, 0xA1, 0x86, 0xD8, 0x56, 0x9D, 0x2D, 0xD3, 0x53, 0x82, 0x53, 0xCF, 0x45, 0x86, 0x9F,
-    0xF1, 0x25, 0x86, 0x69, 0xF5, 0x2D, 0x92, 0x8A, 0xF9, 0x3B, 0x8E, 0x31, 0xF9, 0x40, 0x7F, 0x3F,
-    0xF4, 0x38, 0x73, 0x4A, 0xF0, 0x2A, 0x77, 0x5E, 0x49, 0x91, 0x74, 0xA1, 0xDE, 0x03, 0x5A, 0x6B,
-    0x5E, 0x9C, 0xDE, 0x83, 0xD1, 0x36, 0xAB, 0x6C, 0x54, 0xB5, 0x6A, 0x4D, 0xF6, 0x57, 0x42, 0x29,
-    0x68, 0xC0, 0xD4, 0x24, 0xDF, 0x67, 0x9D, 0x29, 0xD9, 0x15, 0x35, 0x5B, 0xE7, 0x44, 0x27, 0x54,
-    0xEB, 0x00, 0x48, 0x63, 0xFF, 0x44, 0x34, 0x34, 0x4B, 0xAC, 0xCF, 0x83, 0x3D, 0xA5, 0x86, 0xA1,
-    0x44, 0xBE, 0x7F, 0x4D, 0x52, 0xC5, 0xC7, 0x24, 0x0D, 0xD6, 0xF0, 0x80, 0x00, 0xE0, 0x89, 0x93,
-    0x19, 0xFF, 0xE4, 0x20, 0xDC, 0x43, 0xB9, 0x8C, 0x67, 0xB0, 0xEC, 0x0E, 0xE2, 0x59, 0xB3, 0x30,
-    0x51, 0xBA, 0xDA, 0x04, 0x16, 0xEC, 0xF9, 0x09, 0x23, 0xC9, 0x8F, 0x52, 0xC0, 0x6E, 0x38, 0x48,
-    0xAD, 0x2F, 0x4A, 0x5B, 0xB8, 0x75, 0x3B, 0x1D, 0xA5, 0x35, 0x4D, 0x76, 0x95, 0x40, 0x1C, 0x7C,
-    0xA9, 0x67, 0x06, 0x41, 0xA2, 0x6E, 0x0F, 0x24, 0x9B, 0x3A, 0x13, 0x5A, 0x9A, 0x6B, 0x00, 0x4F,
-    0x8F, 0x45, 0x0B, 0x9F, 0x74, 0x7C, 0x76, 0x82, 0x6C, 0x83, 0x16, 0x1D, 0x7B, 0x92, 0x70, 0x1F,
-    0x67, 0x72, 0x1B, 0x7B, 0xB7, 0xC7, 0x65, 0x53, 0xCA, 0xBA, 0x68, 0x3D, 0xA5, 0x8B, 0x77, 0x93,
-    0xB8, 0x7E, 0x7A, 0x45, 0xBB, 0xC9, 0x7B, 0x07, 0xA9, 0x8D, 0x8C, 0x04, 0x33, 0x94, 0x35, 0x75,
-    0x53, 0x8D, 0x23, 0x60, 0x50, 0x98, 0x7B, 0x90, 0x6F, 0x8B, 0x6B, 0x45, 0x3C, 0xB3, 0x2B, 0x1F,
-    0x55, 0xAA, 0x75, 0x22, 0x79, 0x76, 0x32, 0x13, 0x91, 0x74, 0x17, 0x25, 0x87, 0x53, 0x21, 0x81,
-    0xF6, 0x31, 0xA7, 0x3D, 0x4A, 0x71, 0x2F, 0x3D, 0x75, 0xAB, 0x38, 0x3D, 0xB0, 0x53, 0x28, 0xC0,
-    0x4A, 0x18, 0x87, 0xC1, 0x6D, 0x86, 0xB8, 0xC0, 0x63, 0x72, 0x73, 0x74, 0x6E, 0x64, 0x30, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xA0, 0xD2, 0x44, 0x83, 0xA0, 0xEE, 0x60,
-    0x98, 0x91, 0xE7, 0x60, 0x6C, 0x9B, 0xD7, 0x7D, 0x7D, 0x9B, 0xFF, 0x83, 0x9E, 0x83, 0xF4, 0x6D,
-    0x71, 0xB2, 0xD2, 0x16, 0x81, 0xB3, 0xF9, 0x25, 0xA2, 0x9B, 0xEF, 0x48, 0xDE, 0x4D, 0x6E, 0x26,
-    0xDB, 0x3D, 0x72, 0x79, 0xDE, 0x46, 0x78, 0x0A, 0xDC, 0x43, 0x69, 0x58, 0xF9, 0x28, 0x69, 0x69,
-    0xFC, 0x31, 0x6E, 0x85, 0xFC, 0x37, 0x65, 0x29, 0xFA, 0x2E, 0x5F, 0x55, 0xD5, 0x68, 0x96, 0x26,
-    0xCF, 0x47, 0x9E, 0x79, 0xD3, 0x52, 0xAA, 0x86, 0xD6, 0x62, 0xA6, 0x2D, 0xD2, 0x5D, 0x8A, 0x53,
-    0xCF, 0x4C, 0x8E, 0x9F, 0xF1, 0x2E, 0x94, 0x69, 0xF4, 0x39, 0xA0, 0x8B, 0xF7, 0x4A, 0x9B, 0x32,
-    0xF7, 0x4F, 0x8B, 0x3F, 0xF3, 0x44, 0x7F, 0x4A, 0xF1, 0x34, 0x83, 0x5E, 0x4C, 0x86, 0x6D, 0x72,
-    0xE3, 0x01, 0x66, 0x6C, 0x5A, 0x9B, 0xDA, 0x83, 0xD1, 0x3C, 0xB5, 0x88, 0x53, 0xB2, 0x62, 0x4D,
-    0xF5, 0x68, 0x4C, 0x2B, 0x62, 0xC7, 0xCF, 0x21, 0xDB, 0x78, 0xA7, 0x2A, 0xDF, 0x13, 0x3F, 0x5B,
-    0xE9, 0x4E, 0x31, 0x54, 0xF1, 0x00, 0x55, 0x63, 0xFF, 0x53, 0x41, 0x33, 0x48, 0xA9, 0xC8, 0x83,
-    0x3E, 0x9B, 0x7D, 0xA1, 0x43, 0xBA, 0x75, 0x4E, 0x4D, 0xC8, 0xC0, 0x24, 0x09, 0xCD, 0xE1, 0x7D,
-    0x00, 0xD3, 0x78, 0x94, 0x12, 0xFF, 0xD5, 0x22, 0xD9, 0x4E, 0xC4, 0x8C, 0x61, 0xB5, 0xE8, 0x0E,
-    0xDE, 0x69, 0xBD, 0x30, 0x4D, 0xBB, 0xD3, 0x04, 0x10, 0xE9, 0xEB, 0x09, 0x23, 0xC0, 0x82, 0x52,
-    0xC0, 0x76, 0x3C, 0x48, 0xB2, 0x29, 0x4F, 0x5A, 0xB8, 0x7C, 0x3F, 0x1D, 0xAA, 0x2F, 0x52, 0x77,
-    0x9C, 0x36, 0x1D, 0x7D, 0xAC, 0x67, 0x07, 0x41, 0xA6, 0x6E, 0x10, 0x21, 0xA3, 0x30, 0x15, 0x5A,
-    0x9F, 0x68, 0x00, 0x4F, 0x97, 0x3A, 0x0B, 0x9F, 0x76, 0x77, 0x74, 0x82, 0x71, 0x7B, 0x11, 0x9E,
-    0x7A, 0x92, 0x6D, 0x1F, 0x6D, 0x66, 0x16, 0x7B, 0xB0, 0xDD, 0x66, 0x53, 0xC3, 0xD3, 0x6C, 0x2B,
-    0xA3, 0x93, 0x79, 0x94, 0xB6, 0x89, 0x7E, 0x45, 0xB3, 0xE1, 0x7C, 0x07, 0xA6, 0x97, 0x8E, 0x01,
-    0x38, 0x82, 0x2A, 0x77, 0x58, 0x81, 0x1C, 0x60, 0x51, 0x91, 0x73, 0x90, 0x70, 0x87, 0x68, 0x45,
-    0x3F, 0xA9, 0x20, 0x1F, 0x55, 0xA7, 0x6E, 0x22, 0x7D, 0x70, 0x2F, 0x13, 0x95, 0x72, 0x16, 0x25,
-    0x8D, 0x49, 0x20, 0x82, 0x6E, 0xDA, 0xAC, 0x3D, 0xDB, 0x65, 0x0F, 0x3D, 0x58, 0x9C, 0x33, 0x3D,
-    0x46, 0xB4, 0x55, 0xBF, 0x80, 0xC7, 0x62, 0xC1, 0x05, 0xD2, 0x92, 0xC0, 0x63, 0x72, 0x73, 0x74,
-    0x6E, 0x64, 0x30, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x9F, 0xD0, 0x44,
-    0x7C, 0xA4, 0xEE, 0x60, 0x92, 0x99, 0xEB, 0x60, 0x68, 0x95, 0xD4, 0x78, 0x76, 0x9C, 0xFF, 0x83,
-    0x97, 0x8A, 0xF9, 0x6D, 0x6A, 0xB2, 0xCE, 0x15, 0x78, 0xBA, 0xF9, 0x24, 0x9A, 0xA8, 0xF3, 0x48,
-    0xDE, 0x59, 0x7A, 0x1C, 0xDD, 0x46, 0x7E, 0x6A, 0xDE, 0x52, 0x84, 0x0A, 0xDD, 0x4D, 0x74, 0x58,
-    0xFB, 0x36, 0x79, 0x70, 0xFC, 0x42, 0x7F, 0x85, 0xFD, 0x49, 0x75, 0x29, 0xFB, 0x3D, 0x6F, 0x55,
-    0xD2, 0x78, 0xA1, 0x26, 0xCF, 0x4F, 0xAA, 0x79, 0xD1, 0x5E, 0xB6, 0x05, 0xD2, 0x72, 0xB2, 0x23,
-    0xD0, 0x6A, 0x95, 0x54, 0xCE, 0x55, 0x99, 0x71, 0xF1, 0x3D, 0xA4, 0x70, 0xF3, 0x4B, 0xB0, 0x8B,
-    0xF5, 0x60, 0xAC, 0x32, 0xF4, 0x66, 0x9B, 0x33, 0xF3, 0x57, 0x8F, 0x4A, 0xF1, 0x43, 0x93, 0x63,
-    0x4E, 0x6C, 0x64, 0x71, 0xE9, 0x00, 0x75, 0x6C, 0x57, 0x8F, 0xD5, 0x83, 0xD0, 0x44, 0xC2, 0x8A,
-    0x53, 0xA4, 0x58, 0x4D, 0xF3, 0x81, 0x59, 0x2B, 0x5B, 0xC6, 0xC9, 0x21, 0xD6, 0x8F, 0xB2, 0x2C,
-    0xE5, 0x13, 0x4C, 0x5C, 0xEB, 0x5C, 0x3C, 0x55, 0xF7, 0x02, 0x66, 0x65, 0xFF, 0x6A, 0x4F, 0x33,
-    0x45, 0x99, 0xBF, 0x79, 0x3F, 0x82, 0x71, 0x72, 0x42, 0xA8, 0x69, 0x4E, 0x48, 0xC0, 0xB7, 0x20,
-    0x05, 0xAF, 0xD0, 0x83, 0x00, 0xB0, 0x62, 0x9B, 0x0A, 0xEF, 0xC2, 0x1B, 0xD6, 0x5D, 0xD1, 0x3A,
-    0x5A, 0xB1, 0xE3, 0x04, 0xD9, 0x7F, 0xCA, 0x32, 0x47, 0xB1, 0xCB, 0x04, 0x09, 0xD4, 0xD9, 0x09,
-    0x22, 0xA5, 0x72, 0x59, 0xC0, 0x80, 0x41, 0x48, 0xB8, 0x1E, 0x56, 0x5C, 0xB8, 0x84, 0x42, 0x1D,
-    0xB0, 0x22, 0x57, 0x77, 0xA4, 0x25, 0x20, 0x7D, 0xB1, 0x65, 0x09, 0x41, 0xAA, 0x6B, 0x11, 0x22,
-    0xAB, 0x1F, 0x18, 0x61, 0xA4, 0x61, 0x00, 0x4F, 0xA0, 0x27, 0x0C, 0x71, 0x77, 0x6A, 0x71, 0x89,
-    0x76, 0x69, 0x0B, 0x9E, 0x7A, 0x8B, 0x6A, 0x1A, 0x74, 0x4F, 0x10, 0x76, 0xA8, 0xF8, 0x66, 0x53,
-    0xBA, 0xF2, 0x6F, 0x2B, 0xA0, 0x9B, 0x7A, 0x9B, 0xB3, 0x95, 0x83, 0x37, 0xA9, 0xFF, 0x7D, 0x18,
-    0xA2, 0xA2, 0x91, 0x01, 0x3F, 0x5F, 0x1D, 0x77, 0x5E, 0x68, 0x12, 0x5F, 0x53, 0x7B, 0x6B, 0x7C,
-    0x71, 0x7A, 0x63, 0x46, 0x43, 0x90, 0x12, 0x1A, 0x55, 0x97, 0x65, 0x22, 0x82, 0x60, 0x2B, 0x8E,
-    0x99, 0x6A, 0x15, 0x24, 0x95, 0x36, 0x20, 0x82, 0x2E, 0xAA, 0xAD, 0x3D, 0x9E, 0x5A, 0xFE, 0x3C,
-    0x0B, 0xAC, 0x2C, 0x3D, 0x4E, 0xD2, 0x99, 0x3F, 0x17, 0x6F, 0x2F, 0xC1, 0x7E, 0x80, 0x58, 0xC0,
-    0x63, 0x72, 0x73, 0x74, 0x6E, 0x64, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6C, 0x7E, 0xCD, 0x46, 0x75, 0x8A, 0xEF, 0x60, 0x8A, 0x87, 0xEE, 0x5F, 0x63, 0x6F, 0xD1, 0x78,
-    0x6E, 0x7F, 0xFF, 0x79, 0x90, 0x7A, 0xFF, 0x6D, 0x63, 0x91, 0xCA, 0x14, 0x6E, 0xA1, 0xF8, 0x21,
-    0x91, 0x9C, 0xF8, 0x48, 0xDE, 0x5F, 0x88, 0x1C, 0xDE, 0x49, 0x8D, 0x6A, 0xDE, 0x57, 0x92, 0x09,
-    0xDE, 0x51, 0x82, 0x5D, 0xFD, 0x44, 0x8D, 0x70, 0xFD, 0x53, 0x92, 0x0C, 0xFD, 0x5A, 0x88, 0x2A,
-    0xFD, 0x4C, 0x82, 0x40, 0xCF, 0x7D, 0xAD, 0x1C, 0xCE, 0x4E, 0xB7, 0x6A, 0xCE, 0x60, 0xC4, 0x05,
-    0xCF, 0x77, 0xBF, 0x06, 0xCE, 0x6C, 0xA0, 0x54, 0xCE, 0x54, 0xA5, 0x5A, 0xF1, 0x49, 0xB7, 0x70,
-    0xF1, 0x5B, 0xC4, 0x8B, 0xF2, 0x72, 0xBE, 0x0A, 0xF2, 0x78, 0xAD, 0x29, 0xF1, 0x67, 0xA0, 0x48,
-    0xF1, 0x4F, 0xA5, 0x66, 0x51, 0x32, 0x5A, 0x71, 0xEF, 0x00, 0x87, 0x8A, 0x52, 0x60, 0xCF, 0x83,
-    0xCE, 0x43, 0xD1, 0x8A, 0x52, 0x71, 0x4C, 0x4D, 0xF2, 0x93, 0x68, 0x2C, 0x53, 0x9F, 0xC1, 0x22,
-    0xD0, 0x99, 0xBE, 0x2C, 0xEC, 0x12, 0x5B, 0x5C, 0xED, 0x65, 0x4A, 0x55, 0xFD, 0x08, 0x79, 0x65,
-    0xFF, 0x7F, 0x60, 0x2E, 0x41, 0x63, 0xB5, 0x79, 0x40, 0x44, 0x65, 0x71, 0x41, 0x6F, 0x5C, 0x4E,
-    0x42, 0x8F, 0xAC, 0x20, 0x00, 0x5F, 0xBC, 0x83, 0x00, 0x59, 0x4A, 0x9B, 0x02, 0xA8, 0xAD, 0x1B,
-    0xD2, 0x63, 0xE1, 0x3A, 0x53, 0x88, 0xDD, 0x04, 0xD3, 0x89, 0xD9, 0x2D, 0x41, 0x7F, 0xC1, 0x01,
-    0x01, 0x8A, 0xC5, 0x03, 0x22, 0x5D, 0x5F, 0x59, 0xC1, 0x7A, 0x47, 0x48, 0xBF, 0x0A, 0x5F, 0x63,
-    0xB8, 0x7B, 0x47, 0x9E, 0xB6, 0x0B, 0x5F, 0x7A, 0xAD, 0x06, 0x23, 0x7D, 0xB6, 0x52, 0x0C, 0x4B,
-    0xAE, 0x56, 0x12, 0x22, 0xB5, 0x03, 0x1D, 0x62, 0xAA, 0x48, 0x00, 0x4F, 0xA9, 0x06, 0x0E, 0x5A,
-    0x79, 0x42, 0x6E, 0x89, 0x7C, 0x3C, 0x04, 0x9E, 0x7A, 0x68, 0x65, 0x1A, 0x7C, 0x1F, 0x0A, 0x76,
-    0x9F, 0xF6, 0x65, 0x53, 0xB1, 0xF8, 0x71, 0x28, 0x9D, 0x8B, 0x7C, 0x9B, 0xAF, 0x8D, 0x88, 0x34,
-    0x9F, 0xFF, 0x7D, 0x18, 0x9D, 0x95, 0x94, 0x01, 0x46, 0x19, 0x0E, 0x73, 0x64, 0x31, 0x08, 0x5F,
-    0x54, 0x45, 0x61, 0x7C, 0x72, 0x51, 0x5E, 0x34, 0x47, 0x51, 0x02, 0x1A, 0x55, 0x65, 0x5A, 0x1B,
-    0x86, 0x39, 0x28, 0x8F, 0x9D, 0x4E, 0x14, 0x21, 0x9C, 0x13, 0x20, 0x82, 0x9C, 0x3B, 0xB0, 0x3D,
-    0xBB, 0x05, 0x09, 0x3D, 0x1E, 0xBD, 0x31, 0x3D, 0x57, 0x5D, 0x1D, 0x40, 0x6B, 0x7B, 0x15, 0xC1,
-    0x97, 0x38, 0x40, 0xC0, 0x63, 0x72, 0x73, 0x74, 0x6E, 0x64, 0x31, 0x31, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x68, 0x74, 0xC9, 0x46, 0x6E, 0x84, 0xEA, 0x5F, 0x83, 0x8B, 0xEE, 0x5F,
-    0x60, 0x62, 0xCC, 0x79, 0x68, 0x78, 0xF9, 0x79, 0x89, 0x83, 0xFF, 0x6E, 0x5F, 0x81, 0xC4, 0x13,
-    0x66, 0x96, 0xF1, 0x21, 0x88, 0xA1, 0xF7, 0x48, 0xDB, 0x88, 0x99, 0x1C, 0xDC, 0x74, 0x9E, 0x6A,
-    0xDB, 0x81, 0xA3, 0x09, 0xDC, 0x7B, 0x94, 0x5D, 0xFB, 0x7E, 0xA3, 0x6F, 0xFA, 0x8B, 0xA8, 0x0C,
-    0xFA, 0x92, 0x9E, 0x2C, 0xFB, 0x85, 0x99, 0x40, 0xC9, 0x9E, 0xB9, 0x1C, 0xCA, 0x73, 0xC4, 0x6A,
-    0xC9, 0x84, 0xD0, 0x05, 0xC8, 0x9A, 0xCB, 0x17, 0xCA, 0x8E, 0xAE, 0x54, 0xCB, 0x78, 0xB3, 0x61,
-    0xED, 0x7E, 0xCA, 0x6F, 0xEB, 0x8F, 0xD6, 0x85, 0xEB, 0xA5, 0xD0, 0x0A, 0xEB, 0xAA, 0xBF, 0x2B,
-    0xEC, 0x99, 0xB3, 0x48, 0xED, 0x83, 0xB9, 0x66, 0x58, 0x1E, 0x57, 0x5A, 0xF2, 0x39, 0x9E, 0x8A,
-    0x51, 0x4D, 0xC7, 0x82, 0xCB, 0x6A, 0xDE, 0x87, 0x56, 0x58, 0x48, 0x4E, 0xEC, 0xC0, 0x7B, 0x27,
-    0x4F, 0x87, 0xB9, 0x1B, 0xC8, 0xB9, 0xCA, 0x24, 0xEF, 0x46, 0x72, 0x63, 0xEC, 0x93, 0x5F, 0x55,
-    0xFF, 0x46, 0x92, 0x45, 0xFB, 0xB3, 0x76, 0x2A, 0x41, 0x47, 0xAC, 0x6A, 0x46, 0x27, 0x5F, 0x71,
-    0x44, 0x4F, 0x55, 0x4E, 0x40, 0x6F, 0xA1, 0x1F, 0x03, 0x27, 0xA9, 0x83, 0x08, 0x1D, 0x3A, 0x98,
-    0x00, 0x69, 0x98, 0x19, 0xCC, 0x8A, 0xED, 0x3C, 0x4E, 0x73, 0xD4, 0x01, 0xCB, 0xAD, 0xE4, 0x2D,
-    0x3F, 0x62, 0xB6, 0x01, 0x00, 0x4F, 0xB0, 0x11, 0x27, 0x31, 0x54, 0x60, 0xC0, 0x91, 0x54, 0x47,
-    0xC4, 0x2B, 0x6F, 0x63, 0xB8, 0x8F, 0x53, 0x9E, 0xBC, 0x29, 0x6D, 0x7A, 0xB5, 0x1E, 0x32, 0x7D,
-    0xBB, 0x67, 0x1B, 0x4B, 0xB3, 0x67, 0x1F, 0x1B, 0xBD, 0x1E, 0x2D, 0x62, 0xB0, 0x57, 0x0E, 0x56,
-    0xB3, 0x1B, 0x1D, 0x61, 0x7C, 0x3F, 0x70, 0x89, 0x85, 0x38, 0x0B, 0x9D, 0x7B, 0x62, 0x67, 0x9C,
-    0x86, 0x1D, 0x12, 0x78, 0x96, 0xF5, 0x69, 0x53, 0xA7, 0xFF, 0x77, 0x28, 0x9A, 0x93, 0x82, 0x98,
-    0xAB, 0x9E, 0x90, 0x34, 0x95, 0xFE, 0x7F, 0x15, 0x99, 0x9D, 0x98, 0x0F, 0x52, 0x00, 0x0D, 0x68,
-    0x6E, 0x23, 0x0B, 0x42, 0x59, 0x31, 0x5E, 0x7B, 0x75, 0x49, 0x5F, 0x34, 0x50, 0x33, 0x00, 0x9C,
-    0x58, 0x4E, 0x57, 0x19, 0x8D, 0x3B, 0x2F, 0x8F, 0xA3, 0x58, 0x1F, 0x21, 0xA5, 0x22, 0x2D, 0x89,
-    0x5B, 0x97, 0xAE, 0x3D, 0x0F, 0xF5, 0x1F, 0x3D, 0xF3, 0xB7, 0x35, 0x3D, 0x68, 0xCC, 0x59, 0x40,
-    0x07, 0xCC, 0x00, 0xC1, 0xEF, 0x9D, 0x3C, 0xC0, 0x63, 0x72, 0x73, 0x74, 0x6E, 0x64, 0x31, 0x32,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x73, 0xC6, 0x3F, 0x68, 0x84, 0xE7, 0x5F,
-    0x7C, 0x92, 0xED, 0x5F, 0x5D, 0x60, 0xC7, 0x79, 0x61, 0x77, 0xF5, 0x79, 0x81, 0x8E, 0xFF, 0x8C,
-    0x5A, 0x7A, 0xBF, 0x8D, 0x5E, 0x91, 0xEC, 0x22, 0x7F, 0xA7, 0xF6, 0x48, 0xD7, 0xB1, 0xA8, 0x4D,
-    0xD9, 0xA0, 0xAE, 0x88, 0xD7, 0xAB, 0xB3, 0x03, 0xD9, 0xA6, 0xA4, 0x5E, 0xF6, 0xB4, 0xB7, 0x36,
-    0xF4, 0xC0, 0xBC, 0x0C, 0xF4, 0xC5, 0xB1, 0x2C, 0xF6, 0xBA, 0xAD, 0x40, 0xC2, 0xBD, 0xC4, 0x1D,
-    0xC6, 0x99, 0xD1, 0x6C, 0xC3, 0xA7, 0xDB, 0x02, 0xC1, 0xB9, 0xD5, 0x17, 0xC5, 0xAF, 0xBA, 0x55,
-    0xC7, 0x9D, 0xC0, 0x61, 0xE7, 0xB0, 0xDB, 0x38, 0xE4, 0xBE, 0xE6, 0x0B, 0xE2, 0xD0, 0xE0, 0x08,
-    0xE2, 0xD4, 0xCF, 0x2C, 0xE5, 0xC6, 0xC4, 0x48, 0xE8, 0xB4, 0xCA, 0x44, 0x5F, 0x21, 0x57, 0x61,
-    0xF2, 0x77, 0xB3, 0x8A, 0x50, 0x49, 0xC2, 0x82, 0xC6, 0x93, 0xEA, 0x87, 0x59, 0x51, 0x46, 0x4E,
-    0xE5, 0xE5, 0x8C, 0x27, 0x4A, 0x78, 0xB1, 0x1B, 0xBE, 0xD3, 0xD3, 0x20, 0xF1, 0x80, 0x88, 0x63,
-    0xE9, 0xBF, 0x72, 0x4A, 0xFF, 0x87, 0xA9, 0x46, 0xF5, 0xE0, 0x8A, 0x25, 0x42, 0x3D, 0xA4, 0x6A,
-    0x4C, 0x22, 0x5B, 0x5A, 0x48, 0x43, 0x50, 0x53, 0x3E, 0x5E, 0x99, 0x1B, 0x06, 0x09, 0x98, 0x79,
-    0x11, 0x00, 0x2E, 0xA0, 0x00, 0x3F, 0x86, 0x19, 0xC4, 0xAE, 0xF8, 0x31, 0x4A, 0x68, 0xCD, 0x01,
-    0xC0, 0xCB, 0xEE, 0x08, 0x3E, 0x53, 0xAE, 0x00, 0x01, 0x2A, 0x9E, 0x11, 0x2E, 0x1E, 0x4B, 0x60,
-    0xBE, 0xAC, 0x61, 0x47, 0xC8, 0x58, 0x7E, 0x65, 0xB6, 0xA6, 0x5E, 0x9D, 0xC0, 0x52, 0x7C, 0x68,
-    0xBD, 0x45, 0x41, 0x78, 0xBE, 0x84, 0x29, 0x4B, 0xB6, 0x81, 0x2C, 0x1B, 0xC5, 0x48, 0x3E, 0x64,
-    0xB6, 0x73, 0x1C, 0x56, 0xBC, 0x41, 0x2D, 0x61, 0x80, 0x4C, 0x74, 0x89, 0x8D, 0x47, 0x13, 0x9D,
-    0x7C, 0x69, 0x6A, 0x9C, 0x90, 0x31, 0x1A, 0x7A, 0x8D, 0xEF, 0x6C, 0x54, 0x9D, 0xFF, 0x7C, 0x27,
-    0x97, 0x9F, 0x87, 0xA0, 0xA6, 0xAF, 0x97, 0x33, 0x8A, 0xF7, 0x81, 0x10, 0x94, 0xA7, 0x9D, 0x0F,
-    0x5E, 0x03, 0x0F, 0x68, 0x77, 0x2C, 0x10, 0x42, 0x5F, 0x32, 0x5E, 0x7D, 0x79, 0x51, 0x62, 0x33,
-    0x59, 0x2D, 0x00, 0x9C, 0x5C, 0x4A, 0x55, 0x19, 0x93, 0x4E, 0x37, 0x91, 0xA8, 0x6E, 0x2A, 0x22,
-    0xAD, 0x42, 0x39, 0x89, 0xBD, 0x73, 0xA6, 0x3D, 0x7E, 0x4A, 0x42, 0x3D, 0x5B, 0x0A, 0x38, 0x3D,
-    0xED, 0xB9, 0x8D, 0x40, 0xC3, 0xE4, 0xE0, 0xC0, 0x47, 0xFF, 0x3D, 0xC0, 0x63, 0x72, 0x73, 0x74,
-    0x6E, 0x64, 0x31, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x7B, 0xC2, 0x3D,
-    0x61, 0x8A, 0xE2, 0x42, 0x74, 0x9C, 0xEB, 0x42, 0x5A, 0x69, 0xC3, 0x6A, 0x5B, 0x7E, 0xF0, 0x6A,
-    0x79, 0x9B, 0xFE, 0x8C, 0x55, 0x7D, 0xB9, 0x8F, 0x56, 0x91, 0xE6, 0x1B, 0x75, 0xAE, 0xF4, 0x47,
-    0xD2, 0xD0, 0xB4, 0x4D, 0xD5, 0xC3, 0xBA, 0x88, 0xD2, 0xCC, 0xBE, 0x11, 0xD6, 0xC8, 0xB0, 0x66,
-    0xF1, 0xDD, 0xC7, 0x38, 0xEE, 0xE6, 0xCB, 0x0E, 0xEE, 0xEA, 0xC0, 0x24, 0xF1, 0xE2, 0xBC, 0x4A,
-    0xBA, 0xD4, 0xCC, 0x1D, 0xC1, 0xB8, 0xDA, 0x6C, 0xBC, 0xC3, 0xE3, 0x02, 0xB9, 0xD1, 0xDC, 0x16,
-    0xBF, 0xC9, 0xC2, 0x55, 0xC2, 0xBB, 0xC9, 0x62, 0xE0, 0xD6, 0xE8, 0x38, 0xDC, 0xE0, 0xF2, 0x0B,
-    0xD8, 0xEE, 0xEB, 0x07, 0xDA, 0xF1, 0xDA, 0x2C, 0xDE, 0xE6, 0xD0, 0x48, 0xE2, 0xD9, 0xD7, 0x43,
-    0x66, 0x34, 0x57, 0x61, 0xF3, 0xAA, 0xC4, 0x8B, 0x4F, 0x52, 0xBC, 0x82, 0xC0, 0xB3, 0xF2, 0x85,
-    0x5D, 0x59, 0x44, 0x4E, 0xDE, 0xFF, 0x99, 0x20, 0x46, 0x76, 0xAA, 0x19, 0xB4, 0xE5, 0xD9, 0x20,
-    0xF2, 0xB0, 0x99, 0x65, 0xE7, 0xE0, 0x80, 0x4A, 0xFF, 0xBB, 0xBC, 0x46, 0xEE, 0xFF, 0x99, 0x25,
-    0x43, 0x43, 0x9E, 0x6A, 0x53, 0x2F, 0x58, 0x61, 0x4D, 0x48, 0x4C, 0x53, 0x3C, 0x5C, 0x91, 0x19,
-    0x0A, 0x06, 0x8B, 0x79, 0x1B, 0x00, 0x24, 0xA0, 0x00, 0x30, 0x76, 0x93, 0xBB, 0xCA, 0xFF, 0x31,
-    0x46, 0x6A, 0xC5, 0x01, 0xB6, 0xE0, 0xF4, 0x06, 0x3C, 0x54, 0xA6, 0x00, 0x02, 0x1F, 0x8F, 0x10,
-    0x34, 0x22, 0x44, 0x60, 0xBD, 0xC3, 0x6A, 0x47, 0xCC, 0x83, 0x8B, 0x45, 0xB5, 0xBC, 0x67, 0x9D,
-    0xC5, 0x7C, 0x87, 0x6D, 0xC5, 0x6F, 0x4E, 0x79, 0xC2, 0xA1, 0x34, 0x49, 0xBA, 0x9C, 0x37, 0x19,
-    0xCE, 0x74, 0x4C, 0x45, 0xBC, 0x90, 0x26, 0x56, 0xC5, 0x6B, 0x3A, 0x62, 0x83, 0x62, 0x77, 0x89,
-    0x96, 0x60, 0x19, 0x51, 0x7E, 0x78, 0x6B, 0x95, 0x9A, 0x4F, 0x22, 0x7A, 0x84, 0xEA, 0x6B, 0x54,
-    0x92, 0xFC, 0x7D, 0x27, 0x93, 0xAD, 0x8A, 0xA0, 0xA1, 0xBF, 0x9C, 0x2E, 0x7F, 0xF0, 0x80, 0x10,
-    0x8E, 0xB3, 0x9F, 0x90, 0x6B, 0x1A, 0x10, 0x6D, 0x82, 0x43, 0x14, 0x42, 0x64, 0x42, 0x5D, 0x76,
-    0x7D, 0x64, 0x64, 0x2E, 0x63, 0x3A, 0x00, 0x9D, 0x60, 0x54, 0x53, 0x93, 0x9A, 0x68, 0x3E, 0x96,
-    0xAD, 0x89, 0x33, 0x1B, 0xB5, 0x67, 0x44, 0x89, 0x65, 0x82, 0x99, 0x3D, 0xFE, 0x36, 0x6E, 0x3D,
-    0xCE, 0x02, 0x3C, 0x3D, 0x09, 0xC4, 0xAF, 0x40, 0x0F, 0xF8, 0xB4, 0xC0, 0xDF, 0x89, 0x40, 0xC0,
-    0x63, 0x72, 0x73, 0x74, 0x6E, 0x64, 0x31, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x5C, 0x75, 0xBB, 0x29, 0x59, 0x82, 0xDA, 0x42, 0x6C, 0x95, 0xE4, 0x42, 0x57, 0x65, 0xBC, 0x6A,
-    0x53, 0x77, 0xE7, 0x6A, 0x71, 0x95, 0xF7, 0x3A, 0x50, 0x74, 0xB1, 0x8F, 0x4D, 0x85, 0xDC, 0x1B,
-    0x6A, 0xA4, 0xEC, 0x47, 0xCE, 0xD3, 0xB8, 0x4D, 0xD2, 0xCA, 0xBF, 0x88, 0xCD, 0xD0, 0xC2, 0x11,
-    0xD2, 0xCD, 0xB5, 0x66, 0xEC, 0xE5, 0xCE, 0x39, 0xE8, 0xEB, 0xD1, 0x0E, 0xE8, 0xEF, 0xC7, 0x20,
-    0xEC, 0xE9, 0xC4, 0x41, 0xB2, 0xD1, 0xCC, 0x9E, 0xBC, 0xBD, 0xDC, 0x8A, 0xB5, 0xC4, 0xE4, 0x02,
-    0xB0, 0xCF, 0xDD, 0x15, 0xB9, 0xC9, 0xC4, 0x55, 0xBD, 0xBF, 0xCC, 0x65, 0xDA, 0xDC, 0xEC, 0x39,
-    0xD3, 0xE3, 0xF5, 0x0D, 0xCE, 0xEE, 0xED, 0x07, 0xD0, 0xF0, 0xDD, 0x24, 0xD7, 0xE8, 0xD5, 0x48,
-    0xDB, 0xDE, 0xDC, 0x46, 0x6E, 0x3C, 0x55, 0x62, 0xF3, 0xBC, 0xCD, 0x8B, 0x4E, 0x50, 0xB5, 0x6A,
-    0xBA, 0xB9, 0xF4, 0x85, 0x62, 0x57, 0x41, 0x53, 0xD6, 0xFB, 0x9D, 0x1F, 0x41, 0x6B, 0xA0, 0x12,
-    0xA9, 0xDE, 0xD8, 0x22, 0xF4, 0xC0, 0xA3, 0x44, 0xE4, 0xE4, 0x88, 0x4A, 0xFF, 0xCC, 0xC6, 0x34,
-    0xE8, 0xFF, 0xA0, 0x24, 0x43, 0x41, 0x96, 0x88, 0x5A, 0x33, 0x54, 0x62, 0x51, 0x46, 0x47, 0x53,
-    0x3B, 0x54, 0x88, 0x19, 0x0E, 0x03, 0x7F, 0x6A, 0x25, 0x00, 0x1C, 0x9F, 0x00, 0x22, 0x68, 0x95,
-    0xB2, 0xCA, 0xFF, 0x32, 0x41, 0x61, 0xBC, 0x0F, 0xAB, 0xDA, 0xF3, 0x07, 0x3B, 0x4D, 0x9C, 0x7E,
-    0x02, 0x15, 0x81, 0x10, 0x3B, 0x21, 0x3E, 0x5F, 0xBB, 0xC3, 0x6E, 0x4F, 0xD1, 0x93, 0x92, 0x45,
-    0xB4, 0xBB, 0x6A, 0x51, 0xCA, 0x8C, 0x8E, 0x6D, 0xCE, 0x81, 0x56, 0x79, 0xC7, 0xA8, 0x3B, 0x49,
-    0xBE, 0xA2, 0x3D, 0x93, 0xD6, 0x86, 0x55, 0x36, 0xC2, 0x99, 0x2D, 0x4F, 0xCF, 0x7D, 0x42, 0x65,
-    0x87, 0x68, 0x76, 0x89, 0x9F, 0x69, 0x1D, 0x51, 0x7F, 0x78, 0x6A, 0x95, 0xA5, 0x5C, 0x27, 0x6B,
-    0x7A, 0xD5, 0x67, 0x54, 0x86, 0xE7, 0x79, 0x1E, 0x8F, 0xA8, 0x89, 0x9F, 0x9B, 0xBA, 0x9B, 0x2A,
-    0x74, 0xD9, 0x7A, 0x8E, 0x89, 0xAC, 0x9C, 0x7C, 0x79, 0x27, 0x12, 0x70, 0x8D, 0x4D, 0x17, 0x43,
-    0x6A, 0x47, 0x5A, 0x78, 0x80, 0x68, 0x63, 0x2A, 0x6E, 0x3F, 0x00, 0x99, 0x64, 0x54, 0x50, 0x94,
-    0xA1, 0x71, 0x41, 0x75, 0xB2, 0x8F, 0x38, 0x1B, 0xBE, 0x76, 0x4B, 0x89, 0x0D, 0x6F, 0x8A, 0x3D,
-    0x62, 0x68, 0x87, 0x3D, 0x93, 0x2B, 0x3D, 0x3D, 0x8A, 0xF2, 0xCF, 0x40, 0xA0, 0x0C, 0x8C, 0xC0,
-    0x3F, 0x89, 0x41, 0xC0, 0x63, 0x72, 0x73, 0x74, 0x6E, 0x64, 0x31, 0x35, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x57, 0x70, 0xB6, 0x29, 0x52, 0x7C, 0xD4, 0x41, 0x63, 0x8F, 0xE0, 0x41,
-    0x54, 0x62, 0xB7, 0x6C, 0x4C, 0x71, 0xE1, 0x88, 0x68, 0x91, 0xF3, 0x3A, 0x4B, 0x6E, 0xAB, 0x97,
-    0x43, 0x7D, 0xD5, 0x19, 0x5F, 0x9C, 0xE7, 0x47, 0xC8, 0xD5, 0xBB, 0x9E, 0xCE, 0xCE, 0xC2, 0x87,
-    0xC8, 0xD2, 0xC5, 0x11, 0xCE, 0xD0, 0xB8, 0x66, 0xE7, 0xEA, 0xD3, 0x3C, 0xE1, 0xEE, 0xD5, 0x04,
-    0xE2, 0xF1, 0xCB, 0x20, 0xE7, 0xED, 0xC8, 0x4B, 0xAA, 0xCF, 0xCD, 0x9E, 0xB6, 0xBF, 0xDD, 0x8A,
-    0xAE, 0xC5, 0xE5, 0x02, 0xA8, 0xCD, 0xDD, 0x15, 0xB2, 0xC9, 0xC5, 0x55, 0xB8, 0xC1, 0xCD, 0x65,
-    0xD3, 0xDF, 0xF0, 0x3C, 0xCA, 0xE5, 0xF7, 0x0D, 0xC4, 0xED, 0xEF, 0x18, 0xC6, 0xEF, 0xDF, 0x24,
-    0xCF, 0xE9, 0xD7, 0x48, 0xD5, 0xE1, 0xE0, 0x3F, 0x76, 0x41, 0x54, 0x64, 0xF4, 0xC7, 0xD3, 0x85,
-    0x4C, 0x4E, 0xB0, 0x88, 0xB4, 0xBC, 0xF5, 0x85, 0x66, 0x56, 0x3E, 0x53, 0xCE, 0xF9, 0xA0, 0x1F,
-    0x3C, 0x63, 0x9A, 0x93, 0x9E, 0xD9, 0xD7, 0x1F, 0xF6, 0xCB, 0xAA, 0x44, 0xE1, 0xE7, 0x8C, 0x4A,
-    0xFF, 0xD7, 0xCD, 0x33, 0xE1, 0xFF, 0xA4, 0x21, 0x44, 0x3F, 0x91, 0x88, 0x61, 0x36, 0x52, 0x62,
-    0x56, 0x45, 0x43, 0x53, 0x39, 0x4E, 0x82, 0x93, 0x12, 0x00, 0x77, 0x6A, 0x2F, 0x00, 0x17, 0x9F,
-    0x00, 0x18, 0x5E, 0x95, 0xA9, 0xC9, 0xFF, 0x0A, 0x3D, 0x5B, 0xB5, 0x7E, 0x9F, 0xD6, 0xF2, 0x18,
-    0x39, 0x48, 0x96, 0x7E, 0x03, 0x0E, 0x77, 0x90, 0x43, 0x21, 0x3A, 0x5F, 0xB9, 0xC3, 0x70, 0x4F,
-    0xD5, 0x9D, 0x97, 0x46, 0xB2, 0xBB, 0x6C, 0x51, 0xCF, 0x96, 0x92, 0x6E, 0xD7, 0x8C, 0x5C, 0x79,
-    0xCB, 0xAD, 0x40, 0x49, 0xC3, 0xA7, 0x40, 0x93, 0xDF, 0x92, 0x5B, 0x37, 0xC8, 0x9F, 0x32, 0x4F,
-    0xD9, 0x89, 0x49, 0x45, 0x8B, 0x6C, 0x77, 0x86, 0xA8, 0x6F, 0x20, 0x50, 0x81, 0x78, 0x69, 0x9B,
-    0xB0, 0x65, 0x2A, 0x6B, 0x70, 0xC9, 0x63, 0x54, 0x7B, 0xDA, 0x76, 0x1E, 0x8B, 0xA5, 0x88, 0x5B,
-    0x96, 0xB7, 0x9B, 0x2A, 0x68, 0xCB, 0x75, 0x8E, 0x83, 0xA7, 0x9A, 0x7C, 0x87, 0x30, 0x13, 0x70,
-    0x98, 0x54, 0x19, 0x3E, 0x70, 0x4A, 0x59, 0x78, 0x84, 0x6A, 0x63, 0x2A, 0x79, 0x43, 0x00, 0x99,
-    0x68, 0x54, 0x4E, 0x94, 0xA8, 0x77, 0x44, 0x75, 0xB8, 0x94, 0x3B, 0x14, 0xC7, 0x80, 0x50, 0x89,
-    0x24, 0xA2, 0x78, 0x3D, 0x43, 0x6E, 0x93, 0x3D, 0xDF, 0xBB, 0x3C, 0x3D, 0x45, 0x8F, 0xEA, 0x40,
-    0x26, 0x52, 0x75, 0xC0, 0xA7, 0xC8, 0x3E, 0xC0, 0x63, 0x72, 0x73, 0x74, 0x6E, 0x64, 0x31, 0x36,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x6E, 0xB4, 0x2B, 0x4A, 0x78, 0xD1, 0x41,
-    0x5B, 0x8C, 0xDD, 0x41, 0x51, 0x61, 0xB5, 0x6C, 0x45, 0x6E, 0xDE, 0x88, 0x60, 0x8E, 0xF1, 0x3A,
-    0x46, 0x6A, 0xA8, 0x97, 0x3B, 0x78, 0xD1, 0x19, 0x55, 0x97, 0xE4, 0x47, 0xC4, 0xD6, 0xBC, 0x4E,
-    0xCB, 0xD0, 0xC4, 0x87, 0xC4, 0xD4, 0xC6, 0x10, 0xCB, 0xD3, 0xBA, 0x44, 0xE2, 0xED, 0xD5, 0x35,
-    0xDB, 0xF0, 0xD7, 0x04, 0xDB, 0xF3, 0xCD, 0x22, 0xE2, 0xEF, 0xCB, 0x4B, 0xA2, 0xCE, 0xCC, 0x9E,
-    0xB1, 0xC0, 0xDE, 0x8A, 0xA7, 0xC5, 0xE5, 0x02, 0x9F, 0xCB, 0xDC, 0x13, 0xAC, 0xC9, 0xC5, 0x55,
-    0xB4, 0xC3, 0xCE, 0x45, 0xCC, 0xE1, 0xF1, 0x3C, 0xC2, 0xE5, 0xF8, 0x0E, 0xBA, 0xEC, 0xF0, 0x11,
-    0xBD, 0xEE, 0xE0, 0x20, 0xC7, 0xEA, 0xD9, 0x48, 0xCF, 0xE3, 0xE2, 0x3F, 0x7E, 0x46, 0x54, 0x64,
-    0xF4, 0xCF, 0xD7, 0x85, 0x4B, 0x4E, 0xAD, 0x88, 0xAE, 0xBD, 0xF6, 0x85, 0x6A, 0x57, 0x3D, 0x53,
-    0xC6, 0xF7, 0xA1, 0x1F, 0x37, 0x5F, 0x96, 0x93, 0x93, 0xD5, 0xD6, 0x1B, 0xF8, 0xD1, 0xAE, 0x46,
-    0xDD, 0xE9, 0x8F, 0x4A, 0xFF, 0xDE, 0xD1, 0x33, 0xDA, 0xFF, 0xA5, 0x21, 0x45, 0x3F, 0x8E, 0x8A,
-    0x68, 0x39, 0x51, 0x62, 0x5A, 0x45, 0x41, 0x53, 0x37, 0x4B, 0x7E, 0x93, 0x17, 0x00, 0x73, 0x6A,
-    0x39, 0x03, 0x14, 0x5B, 0x00, 0x14, 0x58, 0x9B, 0xA0, 0xC9, 0xFF, 0x0A, 0x38, 0x58, 0xB1, 0x7E,
-    0x94, 0xD3, 0xF1, 0x18, 0x37, 0x46, 0x93, 0x7E, 0x04, 0x0B, 0x72, 0x90, 0x4A, 0x23, 0x38, 0x5F,
-    0xB7, 0xC3, 0x71, 0x4F, 0xDA, 0xA4, 0x9A, 0x46, 0xB0, 0xBB, 0x6C, 0x50, 0xD3, 0x9D, 0x96, 0x6E,
-    0xDF, 0x94, 0x60, 0x6A, 0xCF, 0xB1, 0x42, 0x26, 0xC6, 0xAA, 0x42, 0x93, 0xE8, 0x9B, 0x5F, 0x37,
-    0xCE, 0xA4, 0x34, 0x4F, 0xE3, 0x92, 0x4D, 0x45, 0x8E, 0x6F, 0x77, 0x86, 0xB1, 0x75, 0x22, 0x50,
-    0x82, 0x79, 0x69, 0x9B, 0xBA, 0x6D, 0x2D, 0x6D, 0x66, 0xC1, 0x5F, 0x55, 0x6F, 0xD2, 0x72, 0x1F,
-    0x87, 0xA3, 0x87, 0x5B, 0x90, 0xB5, 0x9A, 0x25, 0x5C, 0xC2, 0x71, 0x92, 0x7D, 0xA5, 0x99, 0x7C,
-    0x95, 0x37, 0x15, 0x6F, 0xA3, 0x5A, 0x1B, 0x3E, 0x76, 0x4D, 0x59, 0x7A, 0x88, 0x6D, 0x63, 0x2A,
-    0x84, 0x47, 0x00, 0x99, 0x6C, 0x56, 0x4D, 0x9B, 0xAF, 0x7C, 0x45, 0x72, 0xBD, 0x98, 0x3D, 0x12,
-    0xD0, 0x88, 0x53, 0x89, 0xDF, 0xF2, 0x86, 0x3D, 0x1A, 0x82, 0x8D, 0x3D, 0x7F, 0x37, 0x3D, 0x3D,
-    0xE1, 0xDD, 0xC1, 0x40, 0xBD, 0xF1, 0xAF, 0xC0, 0x5E, 0x22, 0x4F, 0xC0, 0x63, 0x72, 0x73, 0x74,
-    0x6E, 0x64, 0x31, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x6E, 0xBB, 0x2B,
-    0x54, 0x78, 0xDB, 0x41, 0x65, 0x8C, 0xE5, 0x41, 0x56, 0x61, 0xBC, 0x6C, 0x4F, 0x6E, 0xE7, 0x6C,
-    0x6B, 0x8D, 0xF8, 0x3A, 0x4C, 0x6B, 0xB2, 0x91, 0x45, 0x78, 0xDD, 0x14, 0x61, 0x98, 0xED, 0x47,
-    0xC6, 0xD5, 0xB8, 0x9E, 0xCD, 0xCE, 0xBF, 0x8A, 0xC7, 0xD2, 0xC2, 0x11, 0xCC, 0xD1, 0xB5, 0x66,
-    0xE6, 0xEA, 0xCE, 0x35, 0xE0, 0xEE, 0xD1, 0x04, 0xDF, 0xF1, 0xC7, 0x22, 0xE5, 0xED, 0xC3, 0x4B,
-    0xA9, 0xCD, 0xCD, 0x9E, 0xB7, 0xBE, 0xDB, 0x8A, 0xAE, 0xC3, 0xE4, 0x02, 0xA7, 0xCA, 0xDD, 0x15,
-    0xB1, 0xC8, 0xC4, 0x55, 0xB8, 0xC1, 0xCB, 0x65, 0xD3, 0xDE, 0xEC, 0x39, 0xCA, 0xE3, 0xF5, 0x0D,
-    0xC3, 0xEA, 0xEE, 0x03, 0xC5, 0xED, 0xDE, 0x20, 0xCD, 0xE8, 0xD5, 0x48, 0xD4, 0xE1, 0xDC, 0x3F,
-    0x76, 0x45, 0x54, 0x65, 0xF5, 0xCA, 0xCB, 0x3B, 0x4F, 0x4D, 0xB4, 0x88, 0xB6, 0xBB, 0xF3, 0x85,
-    0x63, 0x58, 0x41, 0x51, 0xC9, 0xF8, 0x9E, 0x1F, 0x3C, 0x61, 0xA1, 0x8D, 0x9D, 0xD5, 0xD9, 0x1B,
-    0xF5, 0xCE, 0xA2, 0x44, 0xDC, 0xE8, 0x88, 0x4A, 0xFF, 0xDA, 0xC4, 0x33, 0xDC, 0xFF, 0xA0, 0x21,
-    0x46, 0x3F, 0x96, 0x8A, 0x60, 0x39, 0x54, 0x62, 0x53, 0x46, 0x47, 0x53, 0x39, 0x4C, 0x89, 0x93,
-    0x16, 0x00, 0x7F, 0x6A, 0x2E, 0x04, 0x1C, 0x5B, 0x00, 0x17, 0x69, 0x9B, 0xAB, 0xC7, 0xFF, 0x32,
-    0x3F, 0x58, 0xBC, 0x7E, 0x9F, 0xD3, 0xF3, 0x18, 0x3A, 0x47, 0x9D, 0x7E, 0x05, 0x0C, 0x81, 0x90,
-    0x42, 0x24, 0x3E, 0x5F, 0xB4, 0xC4, 0x6F, 0x4D, 0xD5, 0xA1, 0x90, 0x46, 0xAD, 0xBC, 0x6B, 0x99,
-    0xCE, 0x9A, 0x8C, 0x6E, 0xD4, 0x92, 0x55, 0x6A, 0xC5, 0xB1, 0x3B, 0x26, 0xBD, 0xAB, 0x3D, 0x93,
-    0xDD, 0x99, 0x54, 0x37, 0xC2, 0xA4, 0x2D, 0x4F, 0xD6, 0x8F, 0x41, 0x65, 0x8A, 0x6E, 0x76, 0x87,
-    0xA3, 0x75, 0x1D, 0x50, 0x7E, 0x7A, 0x6A, 0x9B, 0xAC, 0x6C, 0x26, 0x6D, 0x68, 0xC5, 0x6A, 0x54,
-    0x73, 0xD7, 0x7C, 0x1F, 0x88, 0xA4, 0x8A, 0x9F, 0x93, 0xB6, 0x9C, 0x25, 0x61, 0xC7, 0x7D, 0x92,
-    0x80, 0xA6, 0x9D, 0x7C, 0x85, 0x37, 0x11, 0x70, 0x94, 0x5A, 0x17, 0x3E, 0x70, 0x4C, 0x5A, 0x7A,
-    0x83, 0x6C, 0x63, 0x2A, 0x74, 0x48, 0x00, 0x99, 0x66, 0x56, 0x50, 0x94, 0xA5, 0x7C, 0x41, 0x75,
-    0xB3, 0x98, 0x38, 0x14, 0xC4, 0x86, 0x4A, 0x89, 0xFD, 0x34, 0xA2, 0x3D, 0x36, 0x09, 0x5D, 0x3D,
-    0x07, 0x93, 0x38, 0x3D, 0x00, 0xC4, 0x4C, 0x40, 0xC1, 0xEF, 0x00, 0xC1, 0x8E, 0x96, 0x57, 0xC0,
-    0x63, 0x72, 0x73, 0x74, 0x6E, 0x64, 0x31, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x63, 0x70, 0xC7, 0x3D, 0x66, 0x7A, 0xE8, 0x40, 0x79, 0x8C, 0xEE, 0x40, 0x5E, 0x5F, 0xC8, 0x6B,
-    0x61, 0x6D, 0xF6, 0x6C, 0x80, 0x8B, 0xFF, 0x38, 0x57, 0x70, 0xC2, 0x8F, 0x5B, 0x7E, 0xF0, 0x16,
-    0x79, 0x9B, 0xF9, 0x47, 0xD0, 0xCF, 0xA6, 0x9E, 0xD4, 0xC4, 0xAA, 0x8A, 0xD1, 0xCA, 0xB0, 0x03,
-    0xD3, 0xC9, 0xA0, 0x5F, 0xF0, 0xDE, 0xB2, 0x37, 0xED, 0xE5, 0xB8, 0x0C, 0xEC, 0xE9, 0xAF, 0x24,
-    0xEF, 0xE3, 0xA9, 0x4A, 0xB9, 0xCC, 0xC4, 0x1A, 0xC3, 0xB4, 0xCD, 0x6E, 0xBF, 0xBC, 0xD9, 0x84,
-    0xBA, 0xC7, 0xD5, 0x18, 0xBE, 0xC4, 0xB8, 0x56, 0xC3, 0xB8, 0xBD, 0x63, 0xE2, 0xD2, 0xD6, 0x38,
-    0xDE, 0xD9, 0xE2, 0x0B, 0xD9, 0xE5, 0xDE, 0x09, 0xD9, 0xEA, 0xCE, 0x24, 0xDD, 0xE2, 0xC2, 0x48,
-    0xE2, 0xD6, 0xC6, 0x43, 0x64, 0x3D, 0x53, 0x63, 0xF4, 0xB2, 0xA9, 0x8B, 0x54, 0x4A, 0xC1, 0x6A,
-    0xC5, 0xAD, 0xE5, 0x8B, 0x57, 0x5D, 0x48, 0x9D, 0xD6, 0xFC, 0x8F, 0x20, 0x47, 0x69, 0xB6, 0x14,
-    0xB3, 0xD8, 0xD5, 0x22, 0xF0, 0xBB, 0x7F, 0x66, 0xDF, 0xE5, 0x71, 0x56, 0xFF, 0xC4, 0xA0, 0x3F,
-    0xE7, 0xFF, 0x8B, 0x25, 0x46, 0x3D, 0xA4, 0x6C, 0x51, 0x35, 0x59, 0x61, 0x48, 0x4A, 0x52, 0x51,
-    0x3D, 0x53, 0x9C, 0x14, 0x0F, 0x00, 0x99, 0x6B, 0x16, 0x07, 0x2F, 0xA0, 0x00, 0x24, 0x8C, 0x93,
-    0xC0, 0xBF, 0xF5, 0x31, 0x4A, 0x5C, 0xCF, 0x00, 0xB8, 0xD2, 0xEE, 0x08, 0x3F, 0x4A, 0xB0, 0x7F,
-    0x05, 0x14, 0xA2, 0x0F, 0x31, 0x25, 0x4C, 0x60, 0xB4, 0xC6, 0x62, 0x4D, 0xCB, 0x8E, 0x76, 0x44,
-    0xAD, 0xBF, 0x60, 0x95, 0xC3, 0x87, 0x73, 0x69, 0xC0, 0x81, 0x39, 0x79, 0xB7, 0xAF, 0x28, 0x49,
-    0xAF, 0xA9, 0x2B, 0x14, 0xC7, 0x87, 0x36, 0x45, 0xB0, 0xA0, 0x1A, 0x4F, 0xBE, 0x7F, 0x25, 0x63,
-    0x81, 0x67, 0x71, 0x87, 0x8C, 0x71, 0x10, 0x99, 0x7A, 0x7A, 0x6A, 0x94, 0x92, 0x62, 0x15, 0x68,
-    0x79, 0xDE, 0x77, 0x53, 0x87, 0xEF, 0x87, 0x20, 0x8E, 0xA9, 0x8A, 0xA0, 0x9D, 0xBA, 0x9A, 0x2E,
-    0x76, 0xE1, 0x8D, 0x90, 0x8B, 0xAC, 0xA0, 0x7E, 0x64, 0x2D, 0x0A, 0x69, 0x79, 0x54, 0x0D, 0x41,
-    0x62, 0x48, 0x5B, 0x78, 0x79, 0x69, 0x61, 0x29, 0x59, 0x49, 0x00, 0x95, 0x5B, 0x58, 0x56, 0x8D,
-    0x93, 0x75, 0x34, 0x74, 0xA3, 0x96, 0x28, 0x16, 0xAF, 0x78, 0x33, 0x88, 0xEE, 0x9F, 0xAD, 0x3D,
-    0x23, 0xB6, 0xF6, 0x3C, 0xC5, 0xEB, 0x32, 0x3D, 0xA8, 0xAA, 0x1C, 0x3F, 0xD5, 0x2D, 0x25, 0xC1,
-    0x6E, 0x3B, 0x54, 0xC0, 0x63, 0x72, 0x73, 0x74, 0x6E, 0x64, 0x31, 0x39, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0x64, 0xD0, 0x43, 0x79, 0x69, 0xF0, 0x55, 0x8E, 0x67, 0xED, 0x55,
-    0x66, 0x53, 0xD2, 0x78, 0x73, 0x59, 0xFF, 0x79, 0x95, 0x57, 0xFB, 0x70, 0x66, 0x77, 0xD0, 0x15,
-    0x73, 0x7D, 0xFC, 0x21, 0x95, 0x7B, 0xF8, 0x49, 0xE0, 0x5F, 0x7E, 0x1E, 0xE0, 0x47, 0x80, 0x6B,
-    0xE0, 0x54, 0x87, 0x09, 0xDF, 0x52, 0x77, 0x5D, 0xFF, 0x45, 0x7C, 0x64, 0xFF, 0x52, 0x84, 0x85,
-    0xFF, 0x5D, 0x7B, 0x2A, 0xFE, 0x50, 0x73, 0x4A, 0xD1, 0x73, 0xA7, 0x1E, 0xD1, 0x40, 0xAB, 0x6B,
-    0xD1, 0x4F, 0xB9, 0x86, 0xD1, 0x69, 0xB7, 0x08, 0xD0, 0x64, 0x99, 0x53, 0xD0, 0x4B, 0x9B, 0x5B,
-    0xF4, 0x3E, 0xA6, 0x70, 0xF4, 0x4D, 0xB4, 0x8B, 0xF4, 0x66, 0xB3, 0x0D, 0xF4, 0x71, 0xA3, 0x29,
-    0xF3, 0x62, 0x94, 0x48, 0xF3, 0x49, 0x96, 0x66, 0x52, 0x32, 0x5B, 0x5B, 0xF1, 0x00, 0x70, 0x6E,
-    0x56, 0x43, 0xD0, 0x79, 0xD2, 0x2F, 0xC2, 0x8A, 0x52, 0x75, 0x56, 0x9E, 0xF2, 0x9D, 0x65, 0x2C,
-    0x56, 0x87, 0xCB, 0x17, 0xD3, 0x8B, 0xBB, 0x25, 0xEC, 0x1D, 0x49, 0x5E, 0xED, 0x76, 0x43, 0x56,
-    0xFE, 0x0D, 0x62, 0x44, 0xFF, 0x8C, 0x59, 0x2E, 0x44, 0x4B, 0xBA, 0x79, 0x41, 0x40, 0x6A, 0x9F,
-    0x41, 0x6E, 0x67, 0x4E, 0x44, 0x7A, 0xB7, 0x22, 0x03, 0x41, 0xC7, 0x78, 0x00, 0x58, 0x59, 0x9B,
-    0x04, 0x8E, 0xC1, 0x1B, 0xD6, 0x4C, 0xD4, 0x3A, 0x57, 0x69, 0xE3, 0x04, 0xD7, 0x75, 0xD1, 0x32,
-    0x44, 0x65, 0xC9, 0x02, 0x04, 0x6A, 0xD5, 0x03, 0x22, 0x59, 0x6B, 0x52, 0xC0, 0x88, 0x47, 0x47,
-    0xC0, 0x11, 0x50, 0x63, 0xB8, 0x89, 0x48, 0x1A, 0xB7, 0x11, 0x51, 0x73, 0xAC, 0x1B, 0x18, 0x7D,
-    0xB4, 0x6E, 0x0B, 0x4B, 0xAC, 0x70, 0x12, 0x22, 0xB4, 0x19, 0x11, 0x63, 0xA8, 0x66, 0x00, 0x4F,
-    0xA8, 0x1F, 0x05, 0x5B, 0x7A, 0x40, 0x6C, 0x88, 0x7A, 0x55, 0x07, 0x9E, 0x7A, 0x69, 0x69, 0x19,
-    0x7A, 0x36, 0x09, 0x77, 0x9F, 0xFC, 0x78, 0x53, 0xB1, 0xFC, 0x81, 0x2C, 0x9E, 0x8A, 0x80, 0x9B,
-    0xB0, 0x8A, 0x89, 0x34, 0x9F, 0xFF, 0x8F, 0x11, 0x9F, 0x8D, 0x97, 0x00, 0x44, 0x2B, 0x12, 0x73,
-    0x62, 0x47, 0x0C, 0x5F, 0x55, 0x43, 0x65, 0x7C, 0x72, 0x52, 0x60, 0x46, 0x45, 0x66, 0x0D, 0x1A,
-    0x55, 0x65, 0x62, 0x16, 0x86, 0x4A, 0x27, 0x8F, 0x9C, 0x66, 0x15, 0x23, 0x9B, 0x27, 0x19, 0x82,
-    0x7C, 0xF6, 0xAC, 0x3D, 0xF1, 0x89, 0xE5, 0x3C, 0x52, 0xAC, 0x3D, 0x3D, 0x54, 0x04, 0x77, 0x40,
-    0xDF, 0xDD, 0x27, 0xC1, 0xF0, 0x69, 0x13, 0xC1, 0x63, 0x72, 0x77, 0x61, 0x6C, 0x6B, 0x31, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3B, 0xD4, 0x41, 0x86, 0x31, 0xEE, 0x56,
-    0x9B, 0x31, 0xE4, 0x56, 0x70, 0x28, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A, 0xA2, 0x1A, 0xEA, 0x62,
-    0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20,
-    0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63,
-    0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20,
-    0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E,
-    0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31,
-    0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58,
-    0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x19, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1A,
-    0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59,
-    0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A,
-    0x41, 0x44, 0x83, 0xA0, 0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5D, 0xD1, 0x06, 0x0D, 0x1B, 0xEB, 0x78,
-    0x00, 0x64, 0x90, 0x94, 0x0F, 0x6D, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38, 0x63, 0x37, 0xEE, 0x86,
-    0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x3F, 0xDD, 0x84, 0x10, 0x3F, 0xFF, 0x05, 0x23, 0x5D, 0x94, 0x51,
-    0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71,
-    0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E,
-    0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58, 0x79, 0x43, 0x71, 0x6C, 0x71, 0x88, 0x1B, 0x1B,
-    0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E, 0xB5, 0xFB, 0x94, 0x2C,
-    0xA0, 0x86, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x3F, 0xA5, 0xF8, 0xA7, 0x01, 0xA3, 0x7F, 0x99, 0x7F,
-    0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56, 0x54, 0x4A, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F,
-    0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6E, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08,
-    0x92, 0x4F, 0x18, 0x6A, 0x7C, 0xF6, 0xAC, 0x3D, 0xF1, 0x89, 0xE5, 0x3C, 0x5E, 0xAC, 0x3D, 0x3D,
-    0x54, 0x04, 0x77, 0x40, 0x13, 0x83, 0x1D, 0xC1, 0xC4, 0xE9, 0xE1, 0xC0, 0x63, 0x72, 0x77, 0x61,
-    0x6C, 0x6B, 0x32, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3B, 0xD4, 0x41,
-    0x86, 0x31, 0xEE, 0x56, 0x9B, 0x31, 0xE4, 0x56, 0x70, 0x28, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A,
-    0xA2, 0x1A, 0xEA, 0x62, 0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26,
-    0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52,
-    0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48,
-    0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A,
-    0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C,
-    0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F,
-    0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x19, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E,
-    0x51, 0x84, 0x76, 0x1A, 0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25,
-    0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E,
-    0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x44, 0x83, 0xA0, 0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5D, 0xD1, 0x06,
-    0x0D, 0x1B, 0xEB, 0x78, 0x00, 0x64, 0x90, 0x94, 0x0F, 0x6D, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38,
-    0x63, 0x37, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x3F, 0xDD, 0x84, 0x10, 0x3F, 0xFF, 0x05,
-    0x23, 0x5D, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B,
-    0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07,
-    0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58, 0x79, 0x43, 0x71, 0x6C,
-    0x71, 0x88, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E,
-    0xB5, 0xFB, 0x94, 0x2C, 0xA0, 0x86, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x3F, 0xA5, 0xF8, 0xA7, 0x01,
-    0xA3, 0x7F, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56, 0x54, 0x4A, 0x78, 0x7D,
-    0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6E, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E,
-    0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A, 0x7A, 0xF6, 0xAC, 0x3D, 0xF1, 0x89, 0xE5, 0x3C,
-    0x51, 0xAC, 0x3D, 0x3D, 0xC0, 0x84, 0xA9, 0x40, 0x13, 0x83, 0x1D, 0xC1, 0x19, 0xDF, 0x46, 0xC1,
-    0x63, 0x72, 0x77, 0x61, 0x6C, 0x6B, 0x33, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x79, 0x3B, 0xD4, 0x41, 0x86, 0x31, 0xEE, 0x56, 0x9B, 0x31, 0xE4, 0x56, 0x70, 0x28, 0xD6, 0x7A,
-    0x80, 0x1A, 0xFB, 0x7A, 0xA2, 0x1A, 0xEA, 0x62, 0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08,
-    0xA3, 0x40, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C,
-    0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A,
-    0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87,
-    0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62,
-    0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47,
-    0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x19, 0xD7, 0x7A,
-    0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1A, 0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07,
-    0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42,
-    0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x44, 0x83, 0xA0, 0x42, 0x75, 0x89, 0x1A,
-    0x4C, 0x5D, 0xD1, 0x06, 0x0D, 0x1B, 0xEB, 0x78, 0x00, 0x64, 0x90, 0x94, 0x0F, 0x6D, 0xF5, 0x16,
-    0xDF, 0x20, 0xAF, 0x38, 0x63, 0x37, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x3F, 0xDD, 0x84,
-    0x10, 0x3F, 0xFF, 0x05, 0x23, 0x5D, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60,
-    0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49,
-    0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58,
-    0x79, 0x43, 0x71, 0x6C, 0x71, 0x88, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77,
-    0xA2, 0xFF, 0x92, 0x9E, 0xB5, 0xFB, 0x94, 0x2C, 0xA0, 0x86, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x3F,
-    0xA5, 0xF8, 0xA7, 0x01, 0xA3, 0x7F, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56,
-    0x54, 0x4A, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6E, 0x7C, 0x18,
-    0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A, 0x7B, 0xF6, 0xAC, 0x3D,
-    0xF1, 0x89, 0xE5, 0x3C, 0x5B, 0xAC, 0x3D, 0x3D, 0x46, 0x26, 0x8B, 0x40, 0x13, 0x83, 0x1D, 0xC1,
-    0x15, 0xC8, 0xFB, 0xC0, 0x63, 0x72, 0x77, 0x61, 0x6C, 0x6B, 0x34, 0x00, 0x33, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x79, 0x3B, 0xD4, 0x41, 0x86, 0x31, 0xEE, 0x56, 0x9B, 0x31, 0xE4, 0x56,
-    0x70, 0x28, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A, 0xA2, 0x1A, 0xEA, 0x62, 0x71, 0x4F, 0xDB, 0x11,
-    0x81, 0x41, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68,
-    0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B,
-    0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x27, 0x8B, 0x68,
-    0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x39, 0x7E, 0x58,
-    0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29,
-    0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70,
-    0x5F, 0x19, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1A, 0xF1, 0xA7, 0x52, 0x25,
-    0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2E, 0x4F,
-    0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x44, 0x83, 0xA0,
-    0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5D, 0xD1, 0x06, 0x0D, 0x1B, 0xEB, 0x78, 0x00, 0x64, 0x90, 0x94,
-    0x0F, 0x6D, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38, 0x63, 0x37, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31,
-    0x4E, 0x3F, 0xDD, 0x84, 0x10, 0x3F, 0xFF, 0x05, 0x23, 0x5D, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26,
-    0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78,
-    0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9C, 0x09, 0x1C,
-    0x9C, 0x51, 0x00, 0x58, 0x79, 0x43, 0x71, 0x6C, 0x71, 0x88, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14,
-    0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E, 0xB5, 0xFB, 0x94, 0x2C, 0xA0, 0x86, 0x84, 0x94,
-    0xB3, 0x83, 0x86, 0x3F, 0xA5, 0xF8, 0xA7, 0x01, 0xA3, 0x7F, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71,
-    0x59, 0x76, 0x25, 0x56, 0x54, 0x4A, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B,
-    0x55, 0x6E, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A,
-    0x7A, 0xF6, 0xAC, 0x3D, 0xF1, 0x89, 0xE5, 0x3C, 0x51, 0xAC, 0x3D, 0x3D, 0x28, 0x83, 0xAE, 0x40,
-    0x13, 0x83, 0x1D, 0xC1, 0xD8, 0x22, 0x39, 0xC1, 0x63, 0x72, 0x77, 0x61, 0x6C, 0x6B, 0x35, 0x00,
-    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3B, 0xD4, 0x41, 0x86, 0x31, 0xEE, 0x56,
-    0x9B, 0x31, 0xE4, 0x56, 0x70, 0x28, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A, 0xA2, 0x1A, 0xEA, 0x62,
-    0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20,
-    0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63,
-    0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20,
-    0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E,
-    0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31,
-    0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58,
-    0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x19, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1A,
-    0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59,
-    0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A,
-    0x41, 0x44, 0x83, 0xA0, 0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5D, 0xD1, 0x06, 0x0D, 0x1B, 0xEB, 0x78,
-    0x00, 0x64, 0x90, 0x94, 0x0F, 0x6D, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38, 0x63, 0x37, 0xEE, 0x86,
-    0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x3F, 0xDD, 0x84, 0x10, 0x3F, 0xFF, 0x05, 0x23, 0x5D, 0x94, 0x51,
-    0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71,
-    0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E,
-    0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58, 0x79, 0x43, 0x71, 0x6C, 0x71, 0x88, 0x1B, 0x1B,
-    0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E, 0xB5, 0xFB, 0x94, 0x2C,
-    0xA0, 0x86, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x3F, 0xA5, 0xF8, 0xA7, 0x01, 0xA3, 0x7F, 0x99, 0x7F,
-    0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56, 0x54, 0x4A, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F,
-    0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6E, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08,
-    0x92, 0x4F, 0x18, 0x6A, 0x7C, 0xF6, 0xAC, 0x3D, 0xF2, 0x89, 0xE5, 0x3C, 0x51, 0xAC, 0x3D, 0x3D,
-    0xF2, 0x0A, 0x8F, 0x40, 0xFE, 0x62, 0x31, 0xC1, 0x93, 0xCA, 0x1B, 0xC1, 0x63, 0x72, 0x77, 0x61,
-    0x6C, 0x6B, 0x36, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3B, 0xD4, 0x41,
-    0x86, 0x31, 0xEE, 0x56, 0x9B, 0x31, 0xE4, 0x56, 0x70, 0x28, 0xD6, 0x7A, 0x80, 0x1A, 0xFB, 0x7A,
-    0xA2, 0x1A, 0xEA, 0x62, 0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08, 0xA3, 0x40, 0xEF, 0x26,
-    0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C, 0xDF, 0x51, 0x5B, 0x52,
-    0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A, 0xFD, 0x50, 0x4C, 0x48,
-    0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87, 0xD7, 0x4B, 0x9D, 0x0A,
-    0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62, 0xF9, 0x30, 0x89, 0x8C,
-    0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47, 0xF5, 0x39, 0x6E, 0x5F,
-    0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x19, 0xD7, 0x7A, 0xD8, 0x0B, 0x9B, 0x6E,
-    0x51, 0x84, 0x76, 0x1A, 0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07, 0xDA, 0x6C, 0xA6, 0x25,
-    0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42, 0xFC, 0x9A, 0x40, 0x2E,
-    0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x44, 0x83, 0xA0, 0x42, 0x75, 0x89, 0x1A, 0x4C, 0x5D, 0xD1, 0x06,
-    0x0D, 0x1B, 0xEB, 0x78, 0x00, 0x64, 0x90, 0x94, 0x0F, 0x6D, 0xF5, 0x16, 0xDF, 0x20, 0xAF, 0x38,
-    0x63, 0x37, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x3F, 0xDD, 0x84, 0x10, 0x3F, 0xFF, 0x05,
-    0x23, 0x5D, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60, 0xB5, 0x9E, 0x49, 0x1B,
-    0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49, 0xA4, 0x9E, 0x19, 0x07,
-    0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58, 0x79, 0x43, 0x71, 0x6C,
-    0x71, 0x88, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77, 0xA2, 0xFF, 0x92, 0x9E,
-    0xB5, 0xFB, 0x94, 0x2C, 0xA0, 0x86, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x3F, 0xA5, 0xF8, 0xA7, 0x01,
-    0xA3, 0x7F, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56, 0x54, 0x4A, 0x78, 0x7D,
-    0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6E, 0x7C, 0x18, 0x7F, 0x6D, 0x32, 0x8E,
-    0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A, 0x3B, 0x13, 0xAD, 0x3D, 0xB9, 0xA9, 0xED, 0x3C,
-    0xC8, 0x98, 0x2C, 0x3D, 0xC5, 0x55, 0x4D, 0x3F, 0x85, 0xD2, 0x20, 0xC1, 0xEA, 0x36, 0x0C, 0xBE,
-    0x63, 0x72, 0x61, 0x74, 0x74, 0x61, 0x6B, 0x31, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6C, 0x52, 0xCF, 0x43, 0x74, 0x52, 0xF1, 0x55, 0x89, 0x51, 0xF1, 0x55, 0x62, 0x3F, 0xCE, 0x7A,
-    0x6D, 0x3F, 0xFE, 0x7A, 0x90, 0x3E, 0xFF, 0x70, 0x62, 0x65, 0xCF, 0x13, 0x6D, 0x64, 0xFF, 0x06,
-    0x90, 0x64, 0xFF, 0x49, 0xDF, 0x5F, 0x8A, 0x1E, 0xDF, 0x46, 0x8A, 0x6B, 0xDF, 0x52, 0x92, 0x0E,
-    0xDF, 0x52, 0x81, 0x59, 0xFE, 0x45, 0x8A, 0x64, 0xFE, 0x52, 0x92, 0x85, 0xFE, 0x5E, 0x8A, 0x2A,
-    0xFE, 0x52, 0x81, 0x4A, 0xCE, 0x6C, 0xB3, 0x1E, 0xCE, 0x37, 0xB3, 0x6B, 0xCE, 0x44, 0xC3, 0x84,
-    0xCE, 0x5F, 0xC3, 0x09, 0xCE, 0x5F, 0xA3, 0x53, 0xCE, 0x45, 0xA3, 0x5D, 0xF2, 0x37, 0xB3, 0x64,
-    0xF2, 0x44, 0xC3, 0x8B, 0xF2, 0x5E, 0xC3, 0x0D, 0xF2, 0x6C, 0xB3, 0x29, 0xF2, 0x5F, 0xA3, 0x49,
-    0xF2, 0x44, 0xA3, 0x42, 0x52, 0x31, 0x4E, 0x5B, 0xF1, 0x00, 0x76, 0x6E, 0x52, 0x2F, 0xC9, 0x79,
-    0xCF, 0x21, 0xC9, 0x6C, 0x52, 0x78, 0x4F, 0x1D, 0xF1, 0xA4, 0x77, 0x25, 0x52, 0x76, 0xC9, 0x17,
-    0xCF, 0x81, 0xCA, 0x25, 0xEE, 0x24, 0x4F, 0x5E, 0xEE, 0x82, 0x50, 0x56, 0xFF, 0x10, 0x6B, 0x44,
-    0xFF, 0x94, 0x6C, 0x2E, 0x41, 0x3B, 0xB0, 0x7A, 0x41, 0x3C, 0x5C, 0x9F, 0x41, 0x6D, 0x5D, 0x4D,
-    0x41, 0x6B, 0xB0, 0x17, 0x00, 0x2B, 0xB4, 0x78, 0x00, 0x55, 0x44, 0x9B, 0x00, 0x7C, 0xB4, 0x1B,
-    0xD3, 0x3C, 0xDF, 0x3A, 0x52, 0x52, 0xDF, 0x02, 0xD3, 0x67, 0xE0, 0x32, 0x41, 0x53, 0xC1, 0x7F,
-    0x00, 0x53, 0xC5, 0x01, 0x22, 0x55, 0x5B, 0x54, 0xC1, 0x91, 0x50, 0x26, 0xC1, 0x15, 0x4F, 0x5E,
-    0xB8, 0x91, 0x50, 0x1A, 0xB8, 0x15, 0x4F, 0x73, 0xAF, 0x28, 0x14, 0x78, 0xB7, 0x81, 0x0F, 0x4C,
-    0xAF, 0x81, 0x15, 0x17, 0xB7, 0x28, 0x0E, 0x63, 0xAB, 0x79, 0x01, 0x47, 0xAB, 0x30, 0x00, 0x5D,
-    0x7A, 0x3E, 0x67, 0x6A, 0x7E, 0x66, 0x00, 0x1A, 0x7A, 0x69, 0x67, 0x19, 0x7E, 0x45, 0x00, 0x77,
-    0x9D, 0xFF, 0x86, 0x4E, 0xAF, 0xFF, 0x93, 0x2C, 0x9D, 0x88, 0x86, 0x9B, 0xAF, 0x88, 0x92, 0x34,
-    0x9D, 0xFF, 0x9F, 0x11, 0x9D, 0x88, 0x9E, 0x00, 0x48, 0x36, 0x00, 0x71, 0x65, 0x55, 0x01, 0x40,
-    0x55, 0x42, 0x5A, 0x7B, 0x72, 0x53, 0x5A, 0x34, 0x48, 0x74, 0x01, 0x1A, 0x55, 0x65, 0x5A, 0x16,
-    0x88, 0x54, 0x22, 0x8F, 0x9E, 0x75, 0x15, 0x06, 0x9E, 0x34, 0x14, 0x6A, 0xE4, 0x13, 0xB0, 0x3D,
-    0xEE, 0x89, 0xE5, 0x3C, 0x05, 0xE3, 0x3C, 0x3D, 0xCA, 0xF0, 0xFB, 0xC0, 0x13, 0x83, 0x1D, 0xC1,
-    0xEA, 0xA9, 0xF8, 0xBF, 0x63, 0x72, 0x61, 0x74, 0x74, 0x61, 0x6B, 0x32, 0x00, 0x31, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x67, 0x3B, 0xC6, 0x3F, 0x6C, 0x31, 0xE7, 0x4A, 0x81, 0x31, 0xEF, 0x4A,
-    0x5E, 0x28, 0xC0, 0x77, 0x64, 0x1A, 0xEE, 0x7A, 0x86, 0x1A, 0xFA, 0x70, 0x5E, 0x4F, 0xC5, 0x13,
-    0x64, 0x41, 0xF3, 0x06, 0x85, 0x40, 0xFF, 0x28, 0xDC, 0x5B, 0xB3, 0x20, 0xDC, 0x42, 0xB0, 0x68,
-    0xDC, 0x4C, 0xB9, 0x04, 0xDD, 0x51, 0xAA, 0x60, 0xFB, 0x41, 0xBB, 0x64, 0xFA, 0x4B, 0xC4, 0x87,
-    0xFA, 0x5A, 0xBE, 0x2F, 0xFB, 0x50, 0xB5, 0x4B, 0xC8, 0x5D, 0xD3, 0x20, 0xC9, 0x27, 0xCD, 0x68,
-    0xC7, 0x30, 0xDC, 0x81, 0xC7, 0x4B, 0xDF, 0x03, 0xCA, 0x54, 0xC3, 0x48, 0xCA, 0x39, 0xC0, 0x5E,
-    0xEB, 0x27, 0xD9, 0x64, 0xE9, 0x30, 0xE8, 0x8A, 0xE9, 0x4B, 0xEC, 0x0E, 0xEA, 0x5D, 0xDF, 0x2F,
-    0xEC, 0x54, 0xD0, 0x49, 0xEC, 0x39, 0xCD, 0x42, 0x5B, 0x3D, 0x48, 0x5D, 0xF1, 0x00, 0x9D, 0x6D,
-    0x4F, 0x19, 0xB3, 0x7A, 0xC8, 0x0B, 0xDE, 0x6C, 0x5A, 0x84, 0x50, 0x1D, 0xEF, 0xA7, 0xB0, 0x23,
-    0x4E, 0x61, 0xBC, 0x18, 0xC7, 0x6C, 0xEA, 0x2D, 0xF1, 0x2F, 0x7E, 0x5F, 0xF0, 0x8E, 0x89, 0x48,
-    0xFF, 0x13, 0x99, 0x44, 0xFE, 0x9A, 0xA9, 0x30, 0x41, 0x2C, 0x99, 0x7A, 0x48, 0x44, 0x4F, 0x58,
-    0x48, 0x75, 0x55, 0x4D, 0x40, 0x5D, 0x9F, 0x17, 0x02, 0x1B, 0x84, 0x77, 0x0C, 0x64, 0x27, 0x99,
-    0x01, 0x6D, 0x8D, 0x14, 0xC9, 0x20, 0xF6, 0x3A, 0x4D, 0x37, 0xCB, 0x7F, 0xC9, 0x4B, 0xFB, 0x0D,
-    0x3F, 0x3F, 0xAB, 0x7F, 0x00, 0x3F, 0x98, 0x00, 0x2A, 0x5D, 0x47, 0x56, 0xC4, 0x9E, 0x7B, 0x26,
-    0xC6, 0x20, 0x6C, 0x66, 0xBC, 0x9E, 0x78, 0x1A, 0xBD, 0x20, 0x69, 0x71, 0xBA, 0x43, 0x34, 0x77,
-    0xC1, 0x9F, 0x3C, 0x2B, 0xB9, 0x9E, 0x3F, 0x17, 0xC2, 0x45, 0x31, 0x66, 0xB7, 0x9C, 0x2B, 0x26,
-    0xB8, 0x51, 0x22, 0x5E, 0x7E, 0x43, 0x6D, 0x6A, 0x8B, 0x88, 0x18, 0x1A, 0x7E, 0x6F, 0x72, 0x19,
-    0x8B, 0x66, 0x14, 0x72, 0x9B, 0xFF, 0xAB, 0x4F, 0xAB, 0xFB, 0xBC, 0x25, 0x9C, 0x86, 0x9C, 0x99,
-    0xAD, 0x83, 0xAE, 0x35, 0x99, 0xF8, 0xC0, 0x0F, 0x9A, 0x7F, 0xB2, 0x7E, 0x57, 0x57, 0x00, 0x5A,
-    0x74, 0x76, 0x0E, 0x41, 0x5C, 0x4A, 0x55, 0x74, 0x78, 0x5C, 0x62, 0x34, 0x57, 0x96, 0x07, 0x1A,
-    0x5B, 0x6E, 0x59, 0x14, 0x92, 0x6D, 0x38, 0x8F, 0xA9, 0x92, 0x37, 0x07, 0xA9, 0x4F, 0x2F, 0x79,
-    0x95, 0xE7, 0xAF, 0x3D, 0x9E, 0x62, 0xE4, 0x3C, 0x8B, 0x41, 0x39, 0x3D, 0xB0, 0xFF, 0xFF, 0xC0,
-    0x07, 0x3D, 0x1D, 0xC1, 0x8F, 0xFB, 0x43, 0xC0, 0x63, 0x72, 0x61, 0x74, 0x74, 0x61, 0x6B, 0x33,
-    0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x39, 0xC7, 0x3F, 0x6E, 0x2E, 0xE9, 0x4A,
-    0x83, 0x2D, 0xEF, 0x4A, 0x5F, 0x26, 0xC2, 0x77, 0x66, 0x16, 0xF0, 0x73, 0x88, 0x16, 0xFA, 0x62,
-    0x5F, 0x4C, 0xC7, 0x13, 0x66, 0x3D, 0xF6, 0x07, 0x88, 0x3C, 0xFF, 0x28, 0xDD, 0x5A, 0xA9, 0x20,
-    0xDD, 0x41, 0xA6, 0x68, 0xDC, 0x4B, 0xAF, 0x04, 0xDE, 0x50, 0xA0, 0x60, 0xFB, 0x40, 0xAE, 0x65,
-    0xFB, 0x4A, 0xB8, 0x87, 0xFB, 0x5A, 0xB2, 0x2F, 0xFC, 0x50, 0xA8, 0x4B, 0xCA, 0x5B, 0xCC, 0x20,
-    0xCA, 0x26, 0xC5, 0x68, 0xC9, 0x2E, 0xD5, 0x89, 0xC9, 0x49, 0xD9, 0x09, 0xCB, 0x53, 0xBC, 0x4F,
-    0xCB, 0x38, 0xB9, 0x5D, 0xED, 0x25, 0xCE, 0x64, 0xEC, 0x2D, 0xDE, 0x8A, 0xEB, 0x48, 0xE2, 0x0C,
-    0xEC, 0x5B, 0xD6, 0x2F, 0xEE, 0x52, 0xC6, 0x49, 0xEE, 0x37, 0xC2, 0x42, 0x58, 0x3F, 0x49, 0x5D,
-    0xF1, 0x00, 0x90, 0x6D, 0x50, 0x17, 0xB7, 0x7A, 0xCA, 0x08, 0xD6, 0x6C, 0x58, 0x86, 0x52, 0x1D,
-    0xF0, 0xA7, 0xA6, 0x2D, 0x4F, 0x5F, 0xC0, 0x18, 0xC9, 0x6A, 0xE4, 0x2D, 0xF0, 0x30, 0x71, 0x5F,
-    0xEF, 0x90, 0x7E, 0x48, 0xFF, 0x14, 0x8C, 0x44, 0xFE, 0x9A, 0x9E, 0x30, 0x41, 0x2A, 0x9D, 0x73,
-    0x46, 0x46, 0x52, 0x58, 0x46, 0x77, 0x59, 0x1D, 0x40, 0x5C, 0xA4, 0x17, 0x02, 0x1A, 0x8D, 0x77,
-    0x09, 0x67, 0x2F, 0x9B, 0x01, 0x6C, 0x98, 0x14, 0xCB, 0x1C, 0xEF, 0x3A, 0x4E, 0x34, 0xCF, 0x7F,
-    0xCB, 0x48, 0xF5, 0x0D, 0x3F, 0x3E, 0xB0, 0x7F, 0x00, 0x3E, 0xA3, 0x00, 0x28, 0x5F, 0x4C, 0x56,
-    0xC3, 0xA0, 0x74, 0x26, 0xC4, 0x22, 0x63, 0x66, 0xBB, 0xA0, 0x72, 0x1A, 0xBC, 0x22, 0x61, 0x71,
-    0xB7, 0x47, 0x2C, 0x77, 0xBE, 0xA3, 0x34, 0x2B, 0xB6, 0xA1, 0x38, 0x18, 0xBF, 0x49, 0x28, 0x66,
-    0xB4, 0xA0, 0x24, 0x26, 0xB4, 0x55, 0x1A, 0x5D, 0x7D, 0x45, 0x6B, 0x6A, 0x88, 0x8C, 0x14, 0x1A,
-    0x7D, 0x70, 0x70, 0x1B, 0x88, 0x6B, 0x10, 0x72, 0x9B, 0xFF, 0xAA, 0x4D, 0xAC, 0xFB, 0xBA, 0x25,
-    0x9C, 0x86, 0x99, 0x9B, 0xAD, 0x82, 0xA9, 0x34, 0x9A, 0xF7, 0xC0, 0x0F, 0x9B, 0x7E, 0xAF, 0x7E,
-    0x53, 0x5C, 0x00, 0x5B, 0x70, 0x7B, 0x0C, 0x41, 0x5A, 0x4C, 0x56, 0x74, 0x77, 0x5E, 0x60, 0x34,
-    0x53, 0x9B, 0x08, 0x1B, 0x5A, 0x70, 0x5B, 0x15, 0x8F, 0x70, 0x34, 0x8F, 0xA6, 0x96, 0x31, 0x07,
-    0xA7, 0x53, 0x28, 0x79, 0xDF, 0xA9, 0xAE, 0x3D, 0x54, 0xAC, 0xE3, 0x3C, 0xED, 0xAE, 0x32, 0x3D,
-    0x5B, 0x78, 0xE7, 0xC0, 0x36, 0xF0, 0x1C, 0xC1, 0x53, 0x16, 0x87, 0xC0, 0x63, 0x72, 0x61, 0x74,
-    0x74, 0x61, 0x6B, 0x34, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x38, 0xCB, 0x3F,
-    0x71, 0x2C, 0xEC, 0x4A, 0x87, 0x2C, 0xEF, 0x4A, 0x61, 0x25, 0xC7, 0x77, 0x6A, 0x14, 0xF5, 0x7A,
-    0x8C, 0x14, 0xF9, 0x62, 0x61, 0x4B, 0xCC, 0x10, 0x6A, 0x3B, 0xFB, 0x08, 0x8C, 0x3A, 0xFF, 0x28,
-    0xDE, 0x5A, 0x99, 0x20, 0xDE, 0x41, 0x96, 0x68, 0xDE, 0x4B, 0x9F, 0x05, 0xDE, 0x50, 0x8F, 0x54,
-    0xFD, 0x40, 0x99, 0x65, 0xFD, 0x4A, 0xA3, 0x87, 0xFD, 0x5A, 0x9D, 0x2F, 0xFD, 0x50, 0x93, 0x48,
-    0xCC, 0x5B, 0xC0, 0x20, 0xCD, 0x25, 0xB8, 0x68, 0xCC, 0x2D, 0xC9, 0x89, 0xCC, 0x48, 0xCD, 0x09,
-    0xCD, 0x52, 0xAF, 0x4F, 0xCD, 0x38, 0xAC, 0x5D, 0xF0, 0x24, 0xBD, 0x62, 0xEF, 0x2C, 0xCD, 0x8C,
-    0xEF, 0x47, 0xD1, 0x0C, 0xEF, 0x5A, 0xC4, 0x2E, 0xF0, 0x52, 0xB4, 0x49, 0xF0, 0x37, 0xB0, 0x42,
-    0x55, 0x3F, 0x4A, 0x5D, 0xF1, 0x00, 0x7B, 0x6D, 0x51, 0x16, 0xBD, 0x7A, 0xCD, 0x07, 0xCA, 0x6E,
-    0x55, 0x87, 0x55, 0x1D, 0xF1, 0xA7, 0x93, 0x25, 0x51, 0x5E, 0xC7, 0x18, 0xCD, 0x69, 0xD9, 0x2D,
-    0xEF, 0x31, 0x5C, 0x5F, 0xEE, 0x90, 0x6A, 0x48, 0xFF, 0x14, 0x75, 0x44, 0xFF, 0x9B, 0x88, 0x30,
-    0x41, 0x29, 0xA5, 0x7A, 0x43, 0x46, 0x57, 0x58, 0x43, 0x77, 0x5E, 0x1D, 0x41, 0x5B, 0xAC, 0x17,
-    0x01, 0x19, 0x9F, 0x77, 0x04, 0x68, 0x3C, 0x9B, 0x00, 0x6B, 0xAB, 0x16, 0xD0, 0x1B, 0xE3, 0x3A,
-    0x50, 0x33, 0xD7, 0x84, 0xCF, 0x47, 0xEA, 0x0D, 0x40, 0x3D, 0xB9, 0x7F, 0x00, 0x3C, 0xB5, 0x02,
-    0x25, 0x5F, 0x56, 0x53, 0xC2, 0xA1, 0x66, 0x26, 0xC2, 0x22, 0x54, 0x5F, 0xBA, 0xA1, 0x65, 0x1A,
-    0xBA, 0x22, 0x53, 0x71, 0xB2, 0x48, 0x1D, 0x77, 0xBA, 0xA5, 0x25, 0x4C, 0xB2, 0xA3, 0x2A, 0x17,
-    0xBA, 0x4A, 0x18, 0x66, 0xAF, 0xA1, 0x16, 0x47, 0xAF, 0x57, 0x0B, 0x5D, 0x7B, 0x45, 0x67, 0x6B,
-    0x82, 0x8E, 0x0D, 0x1A, 0x7B, 0x70, 0x6E, 0x14, 0x82, 0x6C, 0x08, 0x72, 0x9C, 0xFF, 0xA5, 0x4D,
-    0xAE, 0xFB, 0xB2, 0x25, 0x9C, 0x86, 0x93, 0x9B, 0xAE, 0x82, 0xA1, 0x34, 0x9B, 0xF7, 0xBC, 0x0F,
-    0x9C, 0x7E, 0xAA, 0x7E, 0x4D, 0x5D, 0x00, 0x5B, 0x6A, 0x7C, 0x08, 0x4A, 0x57, 0x4C, 0x58, 0x74,
-    0x74, 0x5E, 0x5E, 0x34, 0x4D, 0x9C, 0x09, 0x1B, 0x57, 0x70, 0x5D, 0x15, 0x8B, 0x71, 0x2C, 0x8F,
-    0xA2, 0x97, 0x26, 0x08, 0xA2, 0x54, 0x1D, 0x79, 0xF7, 0x58, 0xAD, 0x3D, 0x59, 0x9E, 0xE3, 0x3C,
-    0x6F, 0xF6, 0x2F, 0x3D, 0xB9, 0x02, 0xC0, 0xC0, 0x45, 0xCF, 0x1C, 0xC1, 0xA6, 0x51, 0xB0, 0xC0,
-    0x63, 0x72, 0x61, 0x74, 0x74, 0x61, 0x6B, 0x35, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6D, 0x38, 0xCE, 0x43, 0x76, 0x2C, 0xEF, 0x56, 0x8B, 0x2C, 0xEE, 0x56, 0x64, 0x25, 0xCC, 0x77,
-    0x6F, 0x14, 0xF9, 0x7A, 0x92, 0x14, 0xF8, 0x62, 0x64, 0x4B, 0xD2, 0x10, 0x6F, 0x3B, 0xFF, 0x08,
-    0x92, 0x3B, 0xFD, 0x26, 0xDF, 0x5A, 0x87, 0x20, 0xDF, 0x41, 0x84, 0x68, 0xDF, 0x4B, 0x8E, 0x05,
-    0xDF, 0x50, 0x7D, 0x54, 0xFE, 0x41, 0x82, 0x65, 0xFE, 0x4A, 0x8C, 0x87, 0xFE, 0x5A, 0x86, 0x2F,
-    0xFE, 0x50, 0x7C, 0x48, 0xCF, 0x5B, 0xB2, 0x20, 0xCF, 0x25, 0xAA, 0x68, 0xCF, 0x2D, 0xBB, 0x89,
-    0xD0, 0x48, 0xBF, 0x09, 0xCF, 0x53, 0xA1, 0x4F, 0xCF, 0x38, 0x9D, 0x5D, 0xF2, 0x25, 0xA8, 0x62,
-    0xF3, 0x2D, 0xB9, 0x8C, 0xF3, 0x48, 0xBD, 0x0C, 0xF3, 0x5A, 0xB0, 0x2E, 0xF2, 0x52, 0x9F, 0x49,
-    0xF2, 0x37, 0x9B, 0x40, 0x52, 0x3E, 0x50, 0x58, 0xF1, 0x00, 0x66, 0x6D, 0x53, 0x16, 0xC5, 0x7A,
-    0xD0, 0x07, 0xBC, 0x6E, 0x52, 0x86, 0x5B, 0x1D, 0xF2, 0xA7, 0x7E, 0x25, 0x54, 0x5E, 0xD0, 0x07,
-    0xD1, 0x69, 0xCB, 0x2D, 0xED, 0x31, 0x46, 0x60, 0xED, 0x90, 0x54, 0x48, 0xFF, 0x14, 0x5C, 0x42,
-    0xFF, 0x9B, 0x70, 0x2E, 0x42, 0x29, 0xB0, 0x7A, 0x41, 0x45, 0x60, 0x58, 0x41, 0x77, 0x68, 0x1D,
-    0x42, 0x5B, 0xB7, 0x17, 0x01, 0x18, 0xB5, 0x77, 0x00, 0x66, 0x51, 0x9B, 0x02, 0x6B, 0xC1, 0x16,
-    0xD4, 0x1C, 0xD5, 0x38, 0x54, 0x33, 0xE0, 0x84, 0xD4, 0x47, 0xDC, 0x0D, 0x42, 0x3C, 0xC4, 0x7F,
-    0x02, 0x3C, 0xCC, 0x02, 0x22, 0x5E, 0x65, 0x53, 0xC1, 0xA0, 0x59, 0x26, 0xC0, 0x22, 0x46, 0x5E,
-    0xB8, 0xA0, 0x59, 0x1B, 0xB8, 0x22, 0x47, 0x71, 0xAE, 0x47, 0x12, 0x77, 0xB6, 0xA4, 0x18, 0x4C,
-    0xAE, 0xA2, 0x1F, 0x17, 0xB5, 0x49, 0x0B, 0x5E, 0xAA, 0xA1, 0x0B, 0x1C, 0xAA, 0x56, 0x00, 0x5D,
-    0x7A, 0x44, 0x67, 0x6B, 0x7C, 0x8D, 0x0A, 0x1A, 0x7A, 0x70, 0x6D, 0x14, 0x7C, 0x6B, 0x05, 0x72,
-    0x9D, 0xFF, 0x9F, 0x4D, 0xB0, 0xFB, 0xA9, 0x25, 0x9D, 0x86, 0x8D, 0x9B, 0xAF, 0x82, 0x98, 0x34,
-    0x9E, 0xF7, 0xB6, 0x01, 0x9D, 0x7E, 0xA4, 0x7E, 0x46, 0x5C, 0x07, 0x71, 0x64, 0x7B, 0x0A, 0x4A,
-    0x55, 0x4C, 0x5E, 0x7B, 0x72, 0x5D, 0x5F, 0x34, 0x46, 0x9B, 0x10, 0x1B, 0x55, 0x70, 0x63, 0x15,
-    0x87, 0x70, 0x28, 0x8F, 0x9D, 0x96, 0x1E, 0x08, 0x9D, 0x53, 0x14, 0x6B, 0x9F, 0xF1, 0xAD, 0x3D,
-    0x9F, 0x4E, 0xE4, 0x3C, 0xD2, 0xE8, 0x35, 0x3D, 0xCD, 0x3D, 0x99, 0xC0, 0xA7, 0x02, 0x1D, 0xC1,
-    0x1B, 0x95, 0xDB, 0xC0, 0x63, 0x72, 0x61, 0x74, 0x74, 0x61, 0x6B, 0x36, 0x00, 0x35, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x72, 0x39, 0xD1, 0x43, 0x7C, 0x2E, 0xEF, 0x56, 0x91, 0x2E, 0xEA, 0x56,
-    0x68, 0x26, 0xD0, 0x77, 0x76, 0x17, 0xFA, 0x7A, 0x98, 0x16, 0xF3, 0x62, 0x69, 0x4C, 0xD5, 0x10,
-    0x76, 0x3D, 0xFF, 0x08, 0x98, 0x3D, 0xF8, 0x26, 0xE0, 0x5A, 0x7A, 0x20, 0xE0, 0x41, 0x77, 0x68,
-    0xE0, 0x4B, 0x80, 0x05, 0xDF, 0x50, 0x71, 0x59, 0xFE, 0x41, 0x70, 0x65, 0xFF, 0x4B, 0x7A, 0x8B,
-    0xFF, 0x5A, 0x74, 0x2F, 0xFE, 0x50, 0x6A, 0x48, 0xD2, 0x5C, 0xA6, 0x20, 0xD2, 0x26, 0x9F, 0x68,
-    0xD2, 0x2F, 0xAF, 0x89, 0xD3, 0x49, 0xB2, 0x09, 0xD1, 0x53, 0x95, 0x4F, 0xD1, 0x38, 0x92, 0x5D,
-    0xF4, 0x26, 0x97, 0x62, 0xF5, 0x2E, 0xA8, 0x8C, 0xF6, 0x49, 0xAB, 0x0D, 0xF5, 0x5B, 0x9E, 0x2E,
-    0xF4, 0x53, 0x8E, 0x49, 0xF4, 0x38, 0x8A, 0x40, 0x51, 0x3D, 0x5B, 0x58, 0xF0, 0x00, 0x58, 0x70,
-    0x58, 0x17, 0xCC, 0x7A, 0xD3, 0x09, 0xB0, 0x6E, 0x52, 0x85, 0x65, 0x1D, 0xF2, 0xA7, 0x6E, 0x25,
-    0x58, 0x5F, 0xD5, 0x07, 0xD4, 0x6B, 0xBD, 0x25, 0xEB, 0x30, 0x3A, 0x60, 0xEC, 0x8F, 0x46, 0x48,
-    0xFD, 0x14, 0x4D, 0x42, 0xFF, 0x9A, 0x5E, 0x2E, 0x45, 0x2A, 0xBA, 0x7A, 0x41, 0x45, 0x6D, 0x58,
-    0x41, 0x76, 0x74, 0x1D, 0x46, 0x5C, 0xC1, 0x06, 0x06, 0x19, 0xC9, 0x77, 0x00, 0x65, 0x68, 0x94,
-    0x06, 0x6B, 0xD4, 0x16, 0xD8, 0x1D, 0xC7, 0x38, 0x59, 0x34, 0xE5, 0x84, 0xD9, 0x49, 0xCD, 0x31,
-    0x46, 0x3D, 0xCD, 0x84, 0x07, 0x3D, 0xDF, 0x02, 0x23, 0x5E, 0x76, 0x53, 0xC0, 0x9F, 0x52, 0x26,
-    0xBF, 0x21, 0x41, 0x5E, 0xB7, 0xA0, 0x53, 0x1A, 0xB6, 0x21, 0x43, 0x71, 0xAA, 0x46, 0x11, 0x76,
-    0xB2, 0xA2, 0x15, 0x4C, 0xAB, 0xA0, 0x1D, 0x17, 0xB1, 0x47, 0x09, 0x5E, 0xA6, 0x9E, 0x0A, 0x1C,
-    0xA5, 0x54, 0x00, 0x5D, 0x7A, 0x44, 0x6B, 0x6B, 0x78, 0x8B, 0x10, 0x1A, 0x7A, 0x6F, 0x71, 0x14,
-    0x78, 0x69, 0x0C, 0x75, 0xA0, 0xFF, 0x9A, 0x4D, 0xB2, 0xFB, 0xA1, 0x2C, 0x9E, 0x86, 0x8A, 0x94,
-    0xB1, 0x82, 0x91, 0x34, 0xA1, 0xF7, 0xB0, 0x01, 0xA0, 0x7F, 0xA0, 0x7F, 0x43, 0x5A, 0x16, 0x71,
-    0x60, 0x79, 0x14, 0x4A, 0x55, 0x4B, 0x67, 0x7B, 0x72, 0x5D, 0x64, 0x3F, 0x43, 0x99, 0x1E, 0x1B,
-    0x55, 0x6F, 0x6C, 0x18, 0x84, 0x6F, 0x2C, 0x92, 0x9A, 0x95, 0x1E, 0x08, 0x99, 0x52, 0x15, 0x6B,
-    0x95, 0x0F, 0xAE, 0x3D, 0xF2, 0x89, 0xE5, 0x3C, 0xBF, 0x09, 0x39, 0x3D, 0xA7, 0x14, 0x64, 0xC0,
-    0x15, 0x83, 0x1D, 0xC1, 0x2C, 0xF7, 0xEF, 0xC0, 0x63, 0x72, 0x61, 0x74, 0x74, 0x61, 0x6B, 0x37,
-    0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x3B, 0xD2, 0x43, 0x7F, 0x31, 0xEF, 0x56,
-    0x94, 0x31, 0xE8, 0x56, 0x6B, 0x28, 0xD2, 0x7A, 0x79, 0x1A, 0xFA, 0x7A, 0x9B, 0x1A, 0xF0, 0x62,
-    0x6B, 0x4F, 0xD7, 0x10, 0x7A, 0x41, 0xFF, 0x08, 0x9C, 0x40, 0xF5, 0x26, 0xE0, 0x5B, 0x72, 0x20,
-    0xE0, 0x42, 0x6F, 0x68, 0xE0, 0x4C, 0x79, 0x0E, 0xDF, 0x51, 0x69, 0x59, 0xFE, 0x41, 0x66, 0x65,
-    0xFF, 0x4B, 0x6F, 0x8B, 0xFE, 0x5A, 0x69, 0x2A, 0xFE, 0x50, 0x60, 0x48, 0xD3, 0x5D, 0x9E, 0x20,
-    0xD3, 0x27, 0x98, 0x68, 0xD4, 0x30, 0xA8, 0x89, 0xD4, 0x4B, 0xAB, 0x09, 0xD2, 0x54, 0x8F, 0x4F,
-    0xD2, 0x39, 0x8B, 0x5D, 0xF5, 0x27, 0x8D, 0x62, 0xF7, 0x30, 0x9D, 0x8C, 0xF7, 0x4B, 0xA1, 0x0D,
-    0xF6, 0x5D, 0x94, 0x29, 0xF5, 0x54, 0x84, 0x47, 0xF4, 0x39, 0x81, 0x5F, 0x51, 0x3D, 0x62, 0x58,
-    0xEF, 0x00, 0x50, 0x70, 0x5A, 0x19, 0xD0, 0x7A, 0xD5, 0x0B, 0xA9, 0x6E, 0x52, 0x84, 0x6A, 0x1D,
-    0xF1, 0xA7, 0x64, 0x25, 0x5B, 0x61, 0xD9, 0x07, 0xD6, 0x6C, 0xB5, 0x25, 0xE9, 0x2F, 0x32, 0x60,
-    0xEB, 0x8E, 0x3E, 0x4F, 0xFC, 0x13, 0x43, 0x42, 0xFE, 0x9A, 0x54, 0x2E, 0x47, 0x2C, 0xC0, 0x7A,
-    0x41, 0x44, 0x75, 0x58, 0x42, 0x75, 0x7B, 0x1D, 0x48, 0x5D, 0xC6, 0x06, 0x08, 0x1B, 0xD5, 0x78,
-    0x00, 0x64, 0x75, 0x94, 0x09, 0x6D, 0xDF, 0x16, 0xDA, 0x20, 0xC0, 0x38, 0x5C, 0x37, 0xE8, 0x84,
-    0xDB, 0x4B, 0xC5, 0x31, 0x49, 0x3F, 0xD3, 0x84, 0x0A, 0x3F, 0xEA, 0x02, 0x23, 0x5D, 0x80, 0x53,
-    0xBF, 0x9E, 0x4D, 0x26, 0xBD, 0x20, 0x3E, 0x5E, 0xB6, 0x9E, 0x4F, 0x1B, 0xB5, 0x20, 0x40, 0x71,
-    0xA7, 0x43, 0x10, 0x78, 0xB0, 0x9F, 0x13, 0x4C, 0xA8, 0x9E, 0x1B, 0x17, 0xAE, 0x45, 0x08, 0x5E,
-    0xA3, 0x9C, 0x09, 0x1C, 0xA2, 0x51, 0x00, 0x5D, 0x7A, 0x43, 0x6D, 0x6C, 0x76, 0x88, 0x14, 0x1A,
-    0x7A, 0x6F, 0x72, 0x14, 0x76, 0x66, 0x10, 0x75, 0xA0, 0xFF, 0x96, 0x4E, 0xB3, 0xFB, 0x9B, 0x2C,
-    0x9F, 0x86, 0x87, 0x94, 0xB2, 0x83, 0x8D, 0x34, 0xA2, 0xF8, 0xAC, 0x01, 0xA1, 0x7F, 0x9D, 0x7F,
-    0x40, 0x57, 0x1F, 0x71, 0x5E, 0x76, 0x1A, 0x4A, 0x54, 0x4A, 0x6D, 0x7B, 0x72, 0x5C, 0x66, 0x3F,
-    0x41, 0x96, 0x26, 0x1B, 0x55, 0x6E, 0x71, 0x18, 0x82, 0x6D, 0x2E, 0x92, 0x98, 0x92, 0x1E, 0x08,
-    0x97, 0x4F, 0x16, 0x6B, 0x2C, 0xF0, 0xAD, 0x3D, 0x02, 0xEC, 0xE8, 0x3C, 0xFE, 0xF8, 0x35, 0x3D,
-    0xF0, 0x69, 0xF1, 0xBF, 0x97, 0xF0, 0x1E, 0xC1, 0x3E, 0xB1, 0xB9, 0xC0, 0x63, 0x72, 0x61, 0x74,
-    0x74, 0x61, 0x6B, 0x38, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x42, 0xD1, 0x43,
-    0x7B, 0x3A, 0xF0, 0x55, 0x91, 0x3A, 0xEB, 0x55, 0x68, 0x2F, 0xD1, 0x7A, 0x75, 0x25, 0xFB, 0x7A,
-    0x98, 0x24, 0xF5, 0x62, 0x68, 0x55, 0xD4, 0x15, 0x76, 0x4B, 0xFF, 0x08, 0x98, 0x4A, 0xF8, 0x26,
-    0xE0, 0x5C, 0x7A, 0x1E, 0xE0, 0x43, 0x78, 0x6B, 0xE0, 0x4D, 0x81, 0x0E, 0xDF, 0x51, 0x71, 0x59,
-    0xFE, 0x42, 0x72, 0x62, 0xFF, 0x4D, 0x7B, 0x8B, 0xFF, 0x5B, 0x74, 0x2A, 0xFE, 0x50, 0x6B, 0x48,
-    0xD2, 0x61, 0xA5, 0x20, 0xD2, 0x2C, 0xA0, 0x68, 0xD2, 0x36, 0xB0, 0x89, 0xD3, 0x50, 0xB3, 0x09,
-    0xD1, 0x57, 0x95, 0x4F, 0xD1, 0x3C, 0x93, 0x5D, 0xF4, 0x2B, 0x99, 0x62, 0xF5, 0x35, 0xA9, 0x8C,
-    0xF6, 0x50, 0xAC, 0x0D, 0xF5, 0x60, 0x9E, 0x29, 0xF4, 0x56, 0x8E, 0x49, 0xF4, 0x3C, 0x8C, 0x5F,
-    0x51, 0x3B, 0x5B, 0x58, 0xF0, 0x00, 0x5B, 0x6D, 0x58, 0x20, 0xCD, 0x7A, 0xD3, 0x11, 0xB3, 0x6E,
-    0x52, 0x82, 0x62, 0x1D, 0xF2, 0xA6, 0x6B, 0x25, 0x58, 0x67, 0xD4, 0x07, 0xD4, 0x72, 0xBC, 0x25,
-    0xEB, 0x2C, 0x3B, 0x60, 0xEC, 0x8B, 0x44, 0x48, 0xFE, 0x12, 0x4F, 0x42, 0xFF, 0x98, 0x5C, 0x2E,
-    0x45, 0x31, 0xBB, 0x7A, 0x41, 0x43, 0x6D, 0x58, 0x41, 0x74, 0x72, 0x9E, 0x46, 0x62, 0xBF, 0x17,
-    0x05, 0x21, 0xCA, 0x78, 0x00, 0x62, 0x66, 0x94, 0x06, 0x72, 0xD2, 0x16, 0xD8, 0x27, 0xC9, 0x38,
-    0x59, 0x3F, 0xE5, 0x84, 0xD8, 0x53, 0xCD, 0x32, 0x46, 0x46, 0xCD, 0x84, 0x07, 0x46, 0xDE, 0x04,
-    0x23, 0x5C, 0x74, 0x53, 0xC0, 0x9B, 0x4F, 0x26, 0xBF, 0x1D, 0x43, 0x5E, 0xB7, 0x9B, 0x50, 0x1A,
-    0xB6, 0x1E, 0x45, 0x71, 0xAA, 0x3C, 0x11, 0x78, 0xB2, 0x97, 0x12, 0x4C, 0xAB, 0x96, 0x1A, 0x17,
-    0xB2, 0x3E, 0x0A, 0x5E, 0xA6, 0x93, 0x07, 0x47, 0xA5, 0x49, 0x00, 0x5D, 0x7A, 0x43, 0x6B, 0x6A,
-    0x79, 0x7F, 0x0E, 0x1A, 0x7A, 0x6E, 0x6F, 0x14, 0x78, 0x5E, 0x0B, 0x77, 0x9F, 0xFF, 0x93, 0x4E,
-    0xB2, 0xFC, 0x9A, 0x2C, 0x9E, 0x87, 0x87, 0x94, 0xB1, 0x84, 0x8F, 0x34, 0xA1, 0xFA, 0xA9, 0x01,
-    0xA0, 0x82, 0x9E, 0x7F, 0x43, 0x4F, 0x15, 0x71, 0x60, 0x6E, 0x12, 0x4A, 0x55, 0x49, 0x67, 0x7B,
-    0x72, 0x5A, 0x63, 0x3F, 0x43, 0x8E, 0x1B, 0x1B, 0x55, 0x6D, 0x6A, 0x16, 0x84, 0x67, 0x2A, 0x8E,
-    0x9A, 0x8B, 0x1C, 0x08, 0x9A, 0x48, 0x15, 0x6A, 0x38, 0x13, 0xAD, 0x3D, 0x67, 0x7F, 0xEB, 0x3C,
-    0x3F, 0xAF, 0x2D, 0x3D, 0xB7, 0x9B, 0xF0, 0x3E, 0xB3, 0xC9, 0x1F, 0xC1, 0x0C, 0x91, 0xF7, 0xBF,
-    0x63, 0x72, 0x61, 0x74, 0x74, 0x61, 0x6B, 0x39, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6C, 0x4A, 0xCE, 0x43, 0x74, 0x45, 0xF1, 0x55, 0x89, 0x45, 0xF1, 0x55, 0x62, 0x37, 0xCD, 0x77,
-    0x6D, 0x31, 0xFD, 0x7A, 0x90, 0x31, 0xFD, 0x69, 0x62, 0x5D, 0xCF, 0x15, 0x6D, 0x57, 0xFF, 0x06,
-    0x90, 0x57, 0xFF, 0x49, 0xDF, 0x5D, 0x8B, 0x1E, 0xDF, 0x44, 0x89, 0x6B, 0xDF, 0x50, 0x92, 0x04,
-    0xDF, 0x52, 0x81, 0x60, 0xFE, 0x44, 0x89, 0x65, 0xFE, 0x4F, 0x92, 0x85, 0xFE, 0x5D, 0x8B, 0x2F,
-    0xFE, 0x51, 0x82, 0x4A, 0xCE, 0x66, 0xB4, 0x20, 0xCE, 0x31, 0xB1, 0x68, 0xCE, 0x3D, 0xC2, 0x89,
-    0xCE, 0x57, 0xC3, 0x09, 0xCE, 0x5B, 0xA4, 0x4F, 0xCE, 0x40, 0xA2, 0x5D, 0xF2, 0x31, 0xB1, 0x62,
-    0xF2, 0x3C, 0xC2, 0x8C, 0xF2, 0x57, 0xC3, 0x0D, 0xF2, 0x66, 0xB4, 0x2E, 0xF2, 0x5B, 0xA4, 0x49,
-    0xF2, 0x40, 0xA3, 0x42, 0x52, 0x35, 0x4E, 0x5B, 0xF1, 0x00, 0x72, 0x6D, 0x52, 0x27, 0xC7, 0x7A,
-    0xCF, 0x19, 0xC6, 0x6E, 0x52, 0x7C, 0x51, 0x1D, 0xF1, 0xA5, 0x7B, 0x25, 0x52, 0x6E, 0xCA, 0x17,
-    0xCF, 0x79, 0xCC, 0x25, 0xEE, 0x28, 0x4E, 0x5E, 0xEE, 0x86, 0x53, 0x48, 0xFF, 0x11, 0x68, 0x44,
-    0xFF, 0x96, 0x6F, 0x2E, 0x41, 0x35, 0xAF, 0x7A, 0x41, 0x3F, 0x5C, 0x58, 0x41, 0x70, 0x5F, 0x9E,
-    0x41, 0x66, 0xB1, 0x17, 0x00, 0x25, 0xB1, 0x78, 0x00, 0x5B, 0x45, 0x9B, 0x00, 0x76, 0xB6, 0x16,
-    0xD3, 0x31, 0xDE, 0x3A, 0x52, 0x48, 0xDE, 0x02, 0xD3, 0x5D, 0xE0, 0x32, 0x41, 0x4C, 0xC1, 0x7F,
-    0x00, 0x4C, 0xC5, 0x01, 0x22, 0x58, 0x5C, 0x54, 0xC1, 0x96, 0x54, 0x26, 0xC1, 0x19, 0x4D, 0x5E,
-    0xB8, 0x96, 0x54, 0x1A, 0xB8, 0x19, 0x4D, 0x73, 0xAF, 0x32, 0x13, 0x78, 0xB7, 0x8C, 0x12, 0x4C,
-    0xAF, 0x8B, 0x18, 0x17, 0xB7, 0x33, 0x0D, 0x63, 0xAB, 0x86, 0x04, 0x47, 0xAB, 0x3C, 0x00, 0x5D,
-    0x7A, 0x40, 0x66, 0x6A, 0x7E, 0x72, 0x03, 0x1A, 0x7A, 0x6B, 0x68, 0x19, 0x7E, 0x51, 0x01, 0x77,
-    0x9D, 0xFF, 0x8F, 0x4F, 0xAF, 0xFD, 0x9B, 0x2C, 0x9D, 0x88, 0x88, 0x9B, 0xAF, 0x86, 0x95, 0x34,
-    0x9D, 0xFC, 0xA7, 0x11, 0x9D, 0x85, 0xA1, 0x00, 0x48, 0x42, 0x00, 0x71, 0x65, 0x61, 0x02, 0x40,
-    0x55, 0x45, 0x5A, 0x7B, 0x72, 0x56, 0x5B, 0x34, 0x48, 0x81, 0x04, 0x1B, 0x55, 0x69, 0x5C, 0x16,
-    0x88, 0x5E, 0x23, 0x8F, 0x9E, 0x80, 0x17, 0x06, 0x9E, 0x3E, 0x14, 0x6A, 0xDA, 0xEB, 0x91, 0x3D,
-    0xFD, 0x71, 0x12, 0x3D, 0xCC, 0xAD, 0x7A, 0x3D, 0x7A, 0x97, 0xA0, 0xC0, 0x09, 0x6D, 0x9D, 0xC1,
-    0xAD, 0xB2, 0x4E, 0xC1, 0x63, 0x72, 0x70, 0x61, 0x69, 0x6E, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x86, 0x73, 0xB0, 0x40, 0x97, 0x5D, 0xBD, 0x53, 0xAA, 0x4D, 0xAC, 0x53,
-    0x7A, 0x6C, 0xB6, 0x76, 0x90, 0x4F, 0xC8, 0x78, 0xB0, 0x35, 0xAD, 0x71, 0x81, 0x87, 0xB9, 0x03,
-    0x98, 0x69, 0xCB, 0x2F, 0xB7, 0x50, 0xB0, 0x49, 0xDF, 0x48, 0x30, 0x27, 0xDA, 0x36, 0x2F, 0x7A,
-    0xDF, 0x3B, 0x34, 0x0B, 0xDA, 0x43, 0x2B, 0x50, 0xF6, 0x20, 0x16, 0x5C, 0xFB, 0x24, 0x1C, 0x6E,
-    0xFB, 0x31, 0x18, 0x33, 0xF6, 0x2C, 0x13, 0x4F, 0xDD, 0x4B, 0x55, 0x2C, 0xD3, 0x25, 0x51, 0x77,
-    0xDA, 0x28, 0x5B, 0x88, 0xDF, 0x3A, 0x5D, 0x32, 0xD7, 0x48, 0x4C, 0x4D, 0xD2, 0x36, 0x4A, 0x9A,
-    0xF3, 0x0C, 0x36, 0x5A, 0xFA, 0x0E, 0x40, 0x70, 0xFF, 0x21, 0x42, 0x3A, 0xFD, 0x31, 0x3A, 0x3F,
-    0xF7, 0x2F, 0x30, 0x47, 0xF2, 0x1C, 0x2E, 0x54, 0x46, 0xA6, 0x7A, 0x98, 0xD8, 0x00, 0x10, 0x68,
-    0x67, 0x6F, 0xBE, 0x78, 0xD6, 0x0B, 0x5C, 0x68, 0x54, 0xD8, 0x7F, 0x1E, 0xF7, 0x74, 0x1C, 0x29,
-    0x74, 0xA1, 0xC3, 0x2D, 0xE8, 0x4F, 0x63, 0x2E, 0xD2, 0x2D, 0x00, 0x57, 0xE3, 0x6F, 0x07, 0x4F,
-    0xE5, 0x06, 0x00, 0x60, 0xFE, 0x64, 0x0A, 0x34, 0x52, 0x8E, 0xBF, 0x77, 0x3C, 0xB4, 0x90, 0x98,
-    0x46, 0xD6, 0x94, 0x1F, 0x5C, 0xB1, 0xC2, 0x2D, 0x16, 0xB0, 0xF2, 0x7D, 0x00, 0xFE, 0xB7, 0x12,
-    0x25, 0xE9, 0xF8, 0x06, 0xE4, 0x12, 0x67, 0x64, 0x73, 0x7E, 0xCD, 0x86, 0xEC, 0x30, 0x6A, 0x39,
-    0x5C, 0x97, 0xCA, 0x86, 0x22, 0xC4, 0xFF, 0x0C, 0x25, 0xDC, 0xAA, 0x9D, 0xBE, 0x9A, 0x2B, 0x26,
-    0xA6, 0x42, 0x22, 0x59, 0xB6, 0xA1, 0x32, 0x20, 0x9E, 0x49, 0x28, 0x75, 0x8A, 0x77, 0x10, 0x7D,
-    0xA0, 0xB3, 0x0D, 0x4B, 0x9A, 0xB5, 0x17, 0x2D, 0x8F, 0x74, 0x07, 0x58, 0x90, 0xBC, 0x0E, 0x1C,
-    0x82, 0x88, 0x09, 0xA0, 0x73, 0x88, 0x6A, 0x6B, 0x63, 0xCF, 0x30, 0x22, 0x7B, 0xA6, 0x6D, 0x17,
-    0x5D, 0xB7, 0x2E, 0x7B, 0xBF, 0xEA, 0x6E, 0x1D, 0xD3, 0xD8, 0x66, 0x2B, 0xA9, 0x96, 0x65, 0x13,
-    0xBD, 0x84, 0x5D, 0x44, 0xC6, 0xDF, 0x7B, 0x0E, 0xAF, 0x8B, 0x72, 0x84, 0x29, 0xD3, 0x57, 0xA1,
-    0x4A, 0xD4, 0x42, 0x53, 0x4F, 0xAB, 0x80, 0x7E, 0x6D, 0xA2, 0x6A, 0x42, 0x35, 0xFF, 0x5C, 0x21,
-    0x56, 0xC4, 0x82, 0x08, 0x72, 0xAC, 0x3A, 0x0F, 0x89, 0xB9, 0x23, 0x2F, 0x7D, 0x8B, 0x1E, 0x79,
-    0xAF, 0x37, 0xA0, 0x3D, 0xBF, 0x4F, 0x02, 0x3D, 0x17, 0x53, 0x60, 0x3D, 0x38, 0xCB, 0x80, 0xC0,
-    0x27, 0x7C, 0x78, 0xC1, 0x2A, 0x4D, 0x31, 0xC1, 0x63, 0x72, 0x70, 0x61, 0x69, 0x6E, 0x32, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x69, 0xBA, 0x42, 0x90, 0x57, 0xCC, 0x53,
-    0xA5, 0x4B, 0xBD, 0x53, 0x77, 0x5E, 0xBF, 0x78, 0x8B, 0x45, 0xD8, 0x78, 0xAB, 0x33, 0xC0, 0x67,
-    0x7B, 0x7E, 0xC3, 0x03, 0x8F, 0x65, 0xDB, 0x2D, 0xB0, 0x53, 0xC3, 0x49, 0xE1, 0x53, 0x3D, 0x27,
-    0xDE, 0x3D, 0x3B, 0x7A, 0xE1, 0x45, 0x42, 0x0B, 0xDE, 0x4B, 0x36, 0x50, 0xFB, 0x2D, 0x25, 0x5C,
-    0xFF, 0x34, 0x2C, 0x8C, 0xFE, 0x42, 0x28, 0x29, 0xFB, 0x3B, 0x21, 0x4F, 0xDC, 0x57, 0x66, 0x24,
-    0xD6, 0x2A, 0x60, 0x73, 0xDA, 0x2F, 0x6C, 0x87, 0xDD, 0x45, 0x6F, 0x0D, 0xD7, 0x52, 0x5A, 0x4E,
-    0xD4, 0x3B, 0x57, 0xA0, 0xF7, 0x17, 0x48, 0x61, 0xFC, 0x1C, 0x54, 0x6F, 0xFF, 0x33, 0x56, 0x3B,
-    0xFD, 0x44, 0x4D, 0x3F, 0xF8, 0x3F, 0x41, 0x47, 0xF5, 0x29, 0x3F, 0x60, 0x4B, 0x8B, 0x73, 0xA0,
-    0xE4, 0x00, 0x1A, 0x69, 0x64, 0x5B, 0xC5, 0x78, 0xD9, 0x0E, 0x6D, 0x6D, 0x53, 0xC7, 0x7A, 0x1F,
-    0xF6, 0x8C, 0x2A, 0x2A, 0x6C, 0x97, 0xCC, 0x08, 0xE4, 0x5F, 0x76, 0x2A, 0xDC, 0x2F, 0x06, 0x59,
-    0xE7, 0x7F, 0x0F, 0x4F, 0xF0, 0x0B, 0x0A, 0x5F, 0xFF, 0x7B, 0x17, 0x33, 0x50, 0x77, 0xC1, 0x7A,
-    0x3F, 0x98, 0x89, 0x98, 0x45, 0xC1, 0x8E, 0x1D, 0x56, 0xA0, 0xC6, 0x23, 0x12, 0x8A, 0xEF, 0x78,
-    0x00, 0xD8, 0xA8, 0x8D, 0x1C, 0xCE, 0xF7, 0x17, 0xE4, 0x1A, 0x7C, 0x36, 0x6D, 0x70, 0xD7, 0x86,
-    0xE8, 0x3F, 0x80, 0x3C, 0x57, 0x85, 0xCF, 0x84, 0x1B, 0xA5, 0xFF, 0x05, 0x24, 0xBD, 0xA0, 0x51,
-    0xBF, 0xA4, 0x30, 0x26, 0xB0, 0x3A, 0x23, 0x59, 0xB7, 0xA8, 0x36, 0x22, 0xA8, 0x3E, 0x29, 0x72,
-    0x95, 0x6A, 0x0A, 0x7D, 0xA6, 0xB4, 0x09, 0x4B, 0x9F, 0xB5, 0x13, 0x08, 0x9B, 0x68, 0x00, 0x5D,
-    0x97, 0xB9, 0x07, 0x1C, 0x8F, 0x7A, 0x00, 0xA0, 0x77, 0x79, 0x69, 0x6B, 0x6A, 0xC0, 0x25, 0x1B,
-    0x7C, 0x9D, 0x6D, 0x17, 0x66, 0xA3, 0x21, 0x76, 0xB4, 0xFF, 0x78, 0x9E, 0xC8, 0xF1, 0x73, 0x2B,
-    0xA6, 0x9A, 0x6C, 0x8D, 0xBA, 0x8C, 0x68, 0x44, 0xB9, 0xF5, 0x88, 0x04, 0xAB, 0x90, 0x7D, 0x02,
-    0x31, 0xB3, 0x46, 0xA1, 0x51, 0xBD, 0x34, 0x56, 0x52, 0x93, 0x7A, 0x7C, 0x70, 0x93, 0x67, 0x44,
-    0x39, 0xE8, 0x4C, 0x22, 0x56, 0xB2, 0x7E, 0x07, 0x78, 0x9F, 0x33, 0x10, 0x8E, 0xB4, 0x1D, 0x2D,
-    0x87, 0x7C, 0x17, 0x79, 0x3A, 0x31, 0xAA, 0x3D, 0x16, 0xAA, 0xF2, 0x3C, 0x79, 0x8E, 0x4A, 0x3D,
-    0xE2, 0x16, 0x3E, 0xC0, 0x45, 0xE6, 0x3C, 0xC1, 0xB5, 0x00, 0x1E, 0xC1, 0x63, 0x72, 0x70, 0x61,
-    0x69, 0x6E, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x4E, 0xCA, 0x41,
-    0x89, 0x41, 0xE1, 0x56, 0x9E, 0x3C, 0xD5, 0x56, 0x72, 0x3E, 0xCD, 0x77, 0x84, 0x2C, 0xED, 0x7A,
-    0xA5, 0x25, 0xDA, 0x61, 0x74, 0x62, 0xD2, 0x11, 0x86, 0x50, 0xF1, 0x2D, 0xA7, 0x49, 0xDE, 0x26,
-    0xE0, 0x58, 0x55, 0x20, 0xDF, 0x40, 0x52, 0x68, 0xE1, 0x49, 0x5A, 0x0C, 0xDF, 0x4F, 0x4D, 0x52,
-    0xFD, 0x39, 0x41, 0x63, 0xFF, 0x43, 0x49, 0x8B, 0xFE, 0x51, 0x44, 0x2A, 0xFC, 0x48, 0x3C, 0x4F,
-    0xD8, 0x5B, 0x80, 0x20, 0xD5, 0x29, 0x7A, 0x68, 0xD8, 0x30, 0x88, 0x87, 0xDA, 0x49, 0x8B, 0x0A,
-    0xD5, 0x54, 0x72, 0x4E, 0xD3, 0x3A, 0x6F, 0x58, 0xF7, 0x21, 0x67, 0x63, 0xFA, 0x29, 0x75, 0x6F,
-    0xFB, 0x42, 0x78, 0x31, 0xFA, 0x54, 0x6D, 0x29, 0xF7, 0x4C, 0x5F, 0x47, 0xF5, 0x33, 0x5C, 0x55,
-    0x4E, 0x5B, 0x70, 0xA0, 0xEB, 0x00, 0x31, 0x69, 0x61, 0x33, 0xD0, 0x7A, 0xD8, 0x0D, 0x89, 0x6D,
-    0x52, 0x9E, 0x78, 0x1F, 0xF3, 0x9C, 0x43, 0x2A, 0x65, 0x77, 0xD8, 0x07, 0xDD, 0x68, 0x94, 0x25,
-    0xE3, 0x2F, 0x18, 0x59, 0xE8, 0x88, 0x23, 0x4F, 0xF7, 0x10, 0x22, 0x5F, 0xFD, 0x8E, 0x31, 0x33,
-    0x4D, 0x49, 0xC7, 0x7A, 0x40, 0x65, 0x86, 0xA0, 0x43, 0x93, 0x8B, 0x1D, 0x50, 0x78, 0xCD, 0x06,
-    0x0F, 0x47, 0xED, 0x78, 0x00, 0x91, 0x99, 0x94, 0x13, 0x93, 0xF6, 0x18, 0xE0, 0x1F, 0x9C, 0x36,
-    0x66, 0x4E, 0xE5, 0x86, 0xE3, 0x47, 0xA0, 0x30, 0x51, 0x5B, 0xD8, 0x84, 0x14, 0x68, 0xFF, 0x05,
-    0x24, 0x83, 0x99, 0x51, 0xBD, 0xA0, 0x3D, 0x26, 0xB7, 0x2A, 0x2F, 0x60, 0xB5, 0xA2, 0x42, 0x1B,
-    0xAF, 0x2B, 0x34, 0x72, 0x9E, 0x51, 0x0D, 0x78, 0xA9, 0xA6, 0x0D, 0x49, 0xA2, 0xA6, 0x17, 0x06,
-    0xA4, 0x52, 0x03, 0x5D, 0x9B, 0xA6, 0x08, 0x1C, 0x98, 0x60, 0x00, 0x58, 0x79, 0x58, 0x6E, 0x6C,
-    0x6E, 0x9C, 0x1F, 0x1B, 0x7B, 0x81, 0x73, 0x16, 0x6D, 0x7D, 0x1B, 0x75, 0xA8, 0xFF, 0x88, 0x9E,
-    0xBC, 0xF7, 0x88, 0x2C, 0xA2, 0x8E, 0x7B, 0x94, 0xB6, 0x86, 0x7B, 0x46, 0xAC, 0xF7, 0x9C, 0x04,
-    0xA6, 0x86, 0x8E, 0x02, 0x38, 0x7A, 0x38, 0x72, 0x56, 0x91, 0x2B, 0x56, 0x53, 0x67, 0x79, 0x7D,
-    0x71, 0x71, 0x6A, 0x43, 0x3B, 0xB5, 0x3F, 0x1B, 0x55, 0x88, 0x7D, 0x18, 0x7C, 0x7F, 0x33, 0x90,
-    0x92, 0x9F, 0x1F, 0x2D, 0x8E, 0x60, 0x17, 0x6B, 0x7B, 0xF6, 0xAC, 0x3D, 0xEF, 0x89, 0xE5, 0x3C,
-    0x52, 0xAC, 0x3D, 0x3D, 0xD0, 0xD3, 0x12, 0xC0, 0x12, 0x83, 0x1D, 0xC1, 0xF0, 0x69, 0x13, 0xC1,
-    0x63, 0x72, 0x70, 0x61, 0x69, 0x6E, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x79, 0x3B, 0xD4, 0x41, 0x86, 0x31, 0xEE, 0x56, 0x9B, 0x31, 0xE4, 0x56, 0x70, 0x28, 0xD6, 0x7A,
-    0x80, 0x1A, 0xFB, 0x7A, 0xA2, 0x1A, 0xEA, 0x62, 0x71, 0x4F, 0xDB, 0x11, 0x81, 0x41, 0xFF, 0x08,
-    0xA3, 0x40, 0xEF, 0x26, 0xE0, 0x5B, 0x64, 0x20, 0xE0, 0x42, 0x61, 0x68, 0xE1, 0x4C, 0x6A, 0x0C,
-    0xDF, 0x51, 0x5B, 0x52, 0xFE, 0x41, 0x52, 0x63, 0xFF, 0x4B, 0x5B, 0x8B, 0xFE, 0x5A, 0x55, 0x2A,
-    0xFD, 0x50, 0x4C, 0x48, 0xD6, 0x5D, 0x91, 0x20, 0xD5, 0x27, 0x8B, 0x68, 0xD7, 0x30, 0x9A, 0x87,
-    0xD7, 0x4B, 0x9D, 0x0A, 0xD3, 0x54, 0x82, 0x4E, 0xD3, 0x39, 0x7E, 0x58, 0xF7, 0x27, 0x7A, 0x62,
-    0xF9, 0x30, 0x89, 0x8C, 0xFA, 0x4B, 0x8C, 0x31, 0xF8, 0x5D, 0x80, 0x29, 0xF6, 0x54, 0x71, 0x47,
-    0xF5, 0x39, 0x6E, 0x5F, 0x50, 0x3D, 0x6E, 0x58, 0xEE, 0x00, 0x3F, 0x70, 0x5F, 0x19, 0xD7, 0x7A,
-    0xD8, 0x0B, 0x9B, 0x6E, 0x51, 0x84, 0x76, 0x1A, 0xF1, 0xA7, 0x52, 0x25, 0x61, 0x61, 0xDF, 0x07,
-    0xDA, 0x6C, 0xA6, 0x25, 0xE6, 0x2F, 0x24, 0x59, 0xE8, 0x8E, 0x2E, 0x4F, 0xFA, 0x13, 0x31, 0x42,
-    0xFC, 0x9A, 0x40, 0x2E, 0x4C, 0x2C, 0xCB, 0x7A, 0x41, 0x44, 0x83, 0xA0, 0x42, 0x75, 0x89, 0x1A,
-    0x4C, 0x5D, 0xD1, 0x06, 0x0D, 0x1B, 0xEB, 0x78, 0x00, 0x64, 0x90, 0x94, 0x0F, 0x6D, 0xF5, 0x16,
-    0xDF, 0x20, 0xAF, 0x38, 0x63, 0x37, 0xEE, 0x86, 0xDF, 0x4B, 0xB4, 0x31, 0x4E, 0x3F, 0xDD, 0x84,
-    0x10, 0x3F, 0xFF, 0x05, 0x23, 0x5D, 0x94, 0x51, 0xBD, 0x9E, 0x45, 0x26, 0xBA, 0x20, 0x37, 0x60,
-    0xB5, 0x9E, 0x49, 0x1B, 0xB2, 0x20, 0x3B, 0x71, 0xA2, 0x43, 0x0F, 0x78, 0xAA, 0x9F, 0x10, 0x49,
-    0xA4, 0x9E, 0x19, 0x07, 0xA9, 0x45, 0x05, 0x5E, 0x9D, 0x9C, 0x09, 0x1C, 0x9C, 0x51, 0x00, 0x58,
-    0x79, 0x43, 0x71, 0x6C, 0x71, 0x88, 0x1B, 0x1B, 0x7A, 0x6F, 0x76, 0x14, 0x70, 0x66, 0x18, 0x77,
-    0xA2, 0xFF, 0x92, 0x9E, 0xB5, 0xFB, 0x94, 0x2C, 0xA0, 0x86, 0x84, 0x94, 0xB3, 0x83, 0x86, 0x3F,
-    0xA5, 0xF8, 0xA7, 0x01, 0xA3, 0x7F, 0x99, 0x7F, 0x3C, 0x57, 0x30, 0x71, 0x59, 0x76, 0x25, 0x56,
-    0x54, 0x4A, 0x78, 0x7D, 0x71, 0x5C, 0x6C, 0x3F, 0x3D, 0x96, 0x37, 0x1B, 0x55, 0x6E, 0x7C, 0x18,
-    0x7F, 0x6D, 0x32, 0x8E, 0x93, 0x92, 0x1F, 0x08, 0x92, 0x4F, 0x18, 0x6A, 0xF8, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x04, 0x3E, 0x00, 0x00, 0xCA, 0x3E, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x3D,
-    0x00, 0x00, 0x0B, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x3D, 0x00, 0x00, 0x0B, 0x3F,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3B, 0x00, 0x00, 0xFE, 0x3E, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xC8, 0x3D, 0x00, 0x00, 0xBA, 0x3E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x3E,
-    0x00, 0x00, 0xCA, 0x3E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x3E, 0x00, 0x00, 0xE6, 0x3E,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x3D, 0x00, 0x00, 0x0B, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xFA, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x24, 0x3E, 0x00, 0x00, 0xE6, 0x3E, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA2, 0x3E, 0x00, 0x00, 0xCA, 0x3E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x3E,
-    0x00, 0x00, 0xE6, 0x3E, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x3E, 0x00, 0x00, 0xCA, 0x3E,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3E, 0x00, 0x00, 0xCA, 0x3E, 0x07, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xE8, 0x3D, 0x00, 0x00, 0x0B, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x04, 0x3E, 0x00, 0x00, 0xCA, 0x3E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x3D,
-    0x00, 0x00, 0x0B, 0x3F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x3D, 0x00, 0x00, 0x0B, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xA2, 0x3E, 0x00, 0x00, 0xCA, 0x3E,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x3E, 0x00, 0x00, 0xE6, 0x3E, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB6, 0x3E, 0x00, 0x00, 0xE6, 0x3E, 0x08, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0xC8, 0x3D, 0x00, 0x00, 0xBA, 0x3E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3E,
-    0x00, 0x00, 0xBA, 0x3E, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x3E, 0x00, 0x00, 0xCA, 0x3E,
-    0x05, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2C, 0x3E, 0x00, 0x00, 0x10, 0x3D,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x3E, 0x00, 0x00, 0x40, 0x3C, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA6, 0x3E, 0x00, 0x00, 0x10, 0x3D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x3E,
-    0x00, 0x00, 0x70, 0x3D, 0x0C, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2C, 0x3E,
-    0x00, 0x00, 0x10, 0x3D, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x3E, 0x00, 0x00, 0x40, 0x3C,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x3E, 0x00, 0x00, 0x40, 0x3C, 0x0E, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3B, 0x00, 0x00, 0x40, 0x3C, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x24, 0x3E, 0x00, 0x00, 0x40, 0x3C, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3B,
-    0x00, 0x00, 0x10, 0x3D, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x3E, 0x00, 0x00, 0x10, 0x3D,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3B, 0x00, 0x00, 0x70, 0x3D, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x24, 0x3E, 0x00, 0x00, 0x70, 0x3D, 0x0C, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x2C, 0x3E, 0x00, 0x00, 0x70, 0x3D, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x3E,
-    0x00, 0x00, 0x10, 0x3D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x3E, 0x00, 0x00, 0x70, 0x3D,
-    0x10, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0x3B, 0x00, 0x00, 0x19, 0x3F,
-    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x3D, 0x00, 0x00, 0x0F, 0x3F, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA8, 0x3D, 0x00, 0x00, 0x19, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x3D,
-    0x00, 0x00, 0x23, 0x3F, 0x10, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBA, 0x3E,
-    0x00, 0x00, 0x63, 0x3F, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3F, 0x00, 0x00, 0x57, 0x3F,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3F, 0x00, 0x00, 0x63, 0x3F, 0x17, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBA, 0x3E, 0x00, 0x00, 0x71, 0x3F, 0x16, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0xBA, 0x3E, 0x00, 0x00, 0x63, 0x3F, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x3E,
-    0x00, 0x00, 0x57, 0x3F, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3F, 0x00, 0x00, 0x57, 0x3F,
-    0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x3E, 0x00, 0x00, 0x35, 0x3F,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3F, 0x00, 0x00, 0x35, 0x3F, 0x13, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBA, 0x3E, 0x00, 0x00, 0x3F, 0x3F, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3F,
-    0x00, 0x00, 0x3F, 0x3F, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x3E, 0x00, 0x00, 0x4B, 0x3F,
-    0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3F, 0x00, 0x00, 0x4B, 0x3F, 0x11, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBA, 0x3E, 0x00, 0x00, 0x55, 0x3F, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3F,
-    0x00, 0x00, 0x55, 0x3F, 0x15, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x05, 0x3F,
-    0x00, 0x00, 0x71, 0x3F, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3F, 0x00, 0x00, 0x7D, 0x3F,
-    0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x3E, 0x00, 0x00, 0x7D, 0x3F, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBA, 0x3E, 0x00, 0x00, 0x71, 0x3F, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3F,
-    0x00, 0x00, 0x63, 0x3F, 0x17, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x9E, 0x3E,
-    0x00, 0x00, 0x41, 0x3F, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x3E, 0x00, 0x00, 0x41, 0x3F,
-    0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x3E, 0x00, 0x00, 0x35, 0x3F, 0x18, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x8E, 0x3E, 0x00, 0x00, 0x35, 0x3F, 0x19, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x9E, 0x3E, 0x00, 0x00, 0x41, 0x3F, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3E,
-    0x00, 0x00, 0x4B, 0x3F, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x3E, 0x00, 0x00, 0x4B, 0x3F,
-    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x3E, 0x00, 0x00, 0x41, 0x3F, 0x17, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x3F, 0x00, 0x00, 0x04, 0x3E, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xC2, 0x3E, 0x00, 0x00, 0xB6, 0x3E, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x3E,
-    0x00, 0x00, 0x04, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x3E, 0x00, 0x00, 0xA2, 0x3E,
-    0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x3E, 0x00, 0x00, 0x2C, 0x3E, 0x29, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x44, 0x3E, 0x00, 0x00, 0xA2, 0x3E, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x3D,
-    0x00, 0x00, 0x2C, 0x3E, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x3D, 0x00, 0x00, 0xB6, 0x3E,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3B, 0x00, 0x00, 0xB6, 0x3E, 0x2E, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x3E, 0x00, 0x00, 0xB6, 0x3E, 0x1D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x51, 0x3F, 0x00, 0x00, 0x04, 0x3E, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x3F,
-    0x00, 0x00, 0xB6, 0x3E, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x3F, 0x00, 0x00, 0x92, 0x3E,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x3F, 0x00, 0x00, 0xB6, 0x3E, 0x37, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x65, 0x3F, 0x00, 0x00, 0xB6, 0x3E, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x3F,
-    0x00, 0x00, 0xEA, 0x3E, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x3F, 0x00, 0x00, 0x9A, 0x3E,
-    0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x3F, 0x00, 0x00, 0xEA, 0x3E, 0x28, 0x00, 0x00, 0x00,
-    0xFA, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0x1F, 0x3F, 0x22, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x74, 0x3E, 0x00, 0x00, 0xEE, 0x3E, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0x3E,
-    0x00, 0x00, 0x31, 0x3F, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3E, 0x00, 0x00, 0x31, 0x3F,
-    0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3E, 0x00, 0x00, 0x31, 0x3F, 0x26, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x98, 0x3D, 0x00, 0x00, 0x25, 0x3F, 0x28, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x74, 0x3E, 0x00, 0x00, 0xEE, 0x3E, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x3F,
-    0x00, 0x00, 0xEE, 0x3E, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x3F, 0x00, 0x00, 0x31, 0x3F,
-    0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x3F, 0x00, 0x00, 0xFE, 0x3E, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x39, 0x3F, 0x00, 0x00, 0x29, 0x3F, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x3F,
-    0x00, 0x00, 0x29, 0x3F, 0x35, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x3F,
-    0x00, 0x00, 0x37, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x3F, 0x00, 0x00, 0x5B, 0x3F,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x3F, 0x00, 0x00, 0x33, 0x3F, 0x42, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x4D, 0x3F, 0x00, 0x00, 0x61, 0x3F, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x3F,
-    0x00, 0x00, 0x2F, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x3F, 0x00, 0x00, 0x51, 0x3F,
-    0x52, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x98, 0x3D, 0x00, 0x00, 0x35, 0x3F,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3E, 0x00, 0x00, 0x35, 0x3F, 0x32, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2C, 0x3E, 0x00, 0x00, 0x41, 0x3F, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x3D,
-    0x00, 0x00, 0x41, 0x3F, 0x20, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xC2, 0x3E,
-    0x00, 0x00, 0x88, 0x3D, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x3F, 0x00, 0x00, 0x10, 0x3D,
-    0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x3F, 0x00, 0x00, 0xC8, 0x3D, 0x30, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x51, 0x3F, 0x00, 0x00, 0x04, 0x3E, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x3E,
-    0x00, 0x00, 0x04, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x3E, 0x00, 0x00, 0x04, 0x3E,
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x3E, 0x00, 0x00, 0xE0, 0x3C, 0x23, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x51, 0x3F, 0x00, 0x00, 0x80, 0x3B, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x3F,
-    0x00, 0x00, 0x10, 0x3D, 0x32, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x30, 0x3D,
-    0x00, 0x00, 0x41, 0x3F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x3E, 0x00, 0x00, 0x41, 0x3F,
-    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x3E, 0x00, 0x00, 0x6F, 0x3F, 0x22, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x3B, 0x00, 0x00, 0x6F, 0x3F, 0x1E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x3B, 0x00, 0x00, 0x2C, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x3D,
-    0x00, 0x00, 0x04, 0x3E, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x3D, 0x00, 0x00, 0x2C, 0x3E,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x3E, 0x00, 0x00, 0x04, 0x3E, 0x33, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA2, 0x3E, 0x00, 0x00, 0x2C, 0x3E, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x3E,
-    0x00, 0x00, 0x04, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0x3B,
-    0x00, 0x00, 0x2C, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x3D, 0x00, 0x00, 0x2C, 0x3E,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3B, 0x00, 0x00, 0xB6, 0x3E, 0x2E, 0x00, 0x00, 0x00,
-    0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0x3B, 0x00, 0x00, 0x6F, 0x3F, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x5C, 0x3E, 0x00, 0x00, 0x6F, 0x3F, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x3E,
-    0x00, 0x00, 0x7B, 0x3F, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x3C, 0x00, 0x00, 0x7B, 0x3F,
-    0x27, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x65, 0x3F, 0x00, 0x00, 0xB6, 0x3E,
-    0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x3F, 0x00, 0x00, 0x92, 0x3E, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7B, 0x3F, 0x00, 0x00, 0x9A, 0x3E, 0x27, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0xA2, 0x3E, 0x00, 0x00, 0xA2, 0x3E, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x3E,
-    0x00, 0x00, 0xB6, 0x3E, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x3E, 0x00, 0x00, 0xDA, 0x3E,
-    0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x3E, 0x00, 0x00, 0xBE, 0x3E, 0x2B, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x44, 0x3E, 0x00, 0x00, 0xA2, 0x3E, 0x35, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0xA2, 0x3E, 0x00, 0x00, 0xA8, 0x3D, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x3E,
-    0x00, 0x00, 0xE0, 0x3C, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x3E, 0x00, 0x00, 0x04, 0x3E,
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x3D, 0x00, 0x00, 0x04, 0x3E, 0x34, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x88, 0x3D, 0x00, 0x00, 0xA8, 0x3D, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x57, 0x3F, 0x00, 0x00, 0x29, 0x3F, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x3F,
-    0x00, 0x00, 0xFE, 0x3E, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3F, 0x00, 0x00, 0xFE, 0x3E,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x3F, 0x00, 0x00, 0x31, 0x3F, 0x2E, 0x00, 0x00, 0x00,
-    0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x65, 0x3F, 0x00, 0x00, 0xEA, 0x3E, 0x26, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x47, 0x3F, 0x00, 0x00, 0xEA, 0x3E, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x3F,
-    0x00, 0x00, 0xB6, 0x3E, 0x37, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x67, 0x3F,
-    0x00, 0x00, 0x5B, 0x3F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x3F, 0x00, 0x00, 0x6B, 0x3F,
-    0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x3F, 0x00, 0x00, 0x6D, 0x3F, 0x41, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x4D, 0x3F, 0x00, 0x00, 0x61, 0x3F, 0x51, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x3B, 0x3F, 0x00, 0x00, 0xEA, 0x3E, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x3E,
-    0x00, 0x00, 0xDA, 0x3E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x3E, 0x00, 0x00, 0xB6, 0x3E,
-    0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x3F, 0x00, 0x00, 0xB6, 0x3E, 0x39, 0x00, 0x00, 0x00,
-    0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x74, 0x3E, 0x00, 0x00, 0xEE, 0x3E, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2B, 0x3F, 0x00, 0x00, 0x31, 0x3F, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0x3E,
-    0x00, 0x00, 0x31, 0x3F, 0x38, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x37, 0x3F,
-    0x00, 0x00, 0x61, 0x3F, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x35, 0x3F,
-    0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x3F, 0x00, 0x00, 0x35, 0x3F, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x41, 0x3F, 0x00, 0x00, 0x51, 0x3F, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x3F,
-    0x00, 0x00, 0x51, 0x3F, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x3F, 0x00, 0x00, 0x61, 0x3F,
-    0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x3F, 0x00, 0x00, 0x6D, 0x3F, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2D, 0x3F, 0x00, 0x00, 0x63, 0x3F, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x3F,
-    0x00, 0x00, 0x35, 0x3F, 0x36, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2B, 0x3F,
-    0x00, 0x00, 0x35, 0x3F, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x3F, 0x00, 0x00, 0x2D, 0x3F,
-    0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x3F, 0x00, 0x00, 0x51, 0x3F, 0x3A, 0x00, 0x00, 0x00,
-    0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2B, 0x3F, 0x00, 0x00, 0x35, 0x3F, 0x39, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x35, 0x3F, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x3F,
-    0x00, 0x00, 0x63, 0x3F, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x3F, 0x00, 0x00, 0x61, 0x3F,
-    0x3A, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x3F, 0x00, 0x00, 0x49, 0x3F,
-    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x35, 0x3F, 0x36, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2D, 0x3F, 0x00, 0x00, 0x63, 0x3F, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x3F,
-    0x00, 0x00, 0x71, 0x3F, 0x3D, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x37, 0x3F,
-    0x00, 0x00, 0x61, 0x3F, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x3F, 0x00, 0x00, 0x63, 0x3F,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x3F, 0x00, 0x00, 0x6D, 0x3F, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x4D, 0x3F, 0x00, 0x00, 0x61, 0x3F, 0x52, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x15, 0x3F, 0x00, 0x00, 0x71, 0x3F, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x3F,
-    0x00, 0x00, 0x63, 0x3F, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x3F, 0x00, 0x00, 0x6D, 0x3F,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x7D, 0x3F, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x39, 0x3F, 0x00, 0x00, 0x6D, 0x3F, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x4D, 0x3F, 0x00, 0x00, 0x61, 0x3F, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x3F,
-    0x00, 0x00, 0x6D, 0x3F, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x7D, 0x3F,
-    0x3F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x4D, 0x3F, 0x00, 0x00, 0x61, 0x3F,
-    0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x3F, 0x00, 0x00, 0x6D, 0x3F, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6D, 0x3F, 0x00, 0x00, 0x6D, 0x3F, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x3F,
-    0x00, 0x00, 0x5B, 0x3F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x3F, 0x00, 0x00, 0x33, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x6D, 0x3F, 0x00, 0x00, 0x6D, 0x3F,
-    0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x3F, 0x00, 0x00, 0x7D, 0x3F, 0x43, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x7D, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x71, 0x3F, 0x00, 0x00, 0x50, 0x3D, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x3F,
-    0x00, 0x00, 0x3C, 0x3E, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x3F, 0x00, 0x00, 0x3C, 0x3E,
-    0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x3F, 0x00, 0x00, 0x40, 0x3C, 0x45, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7B, 0x3F, 0x00, 0x00, 0x40, 0x3C, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x3F,
-    0x00, 0x00, 0x3C, 0x3E, 0x46, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x71, 0x3F,
-    0x00, 0x00, 0x50, 0x3D, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x3F, 0x00, 0x00, 0x40, 0x3C,
-    0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x3F, 0x00, 0x00, 0x3C, 0x3E, 0x47, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x71, 0x3F, 0x00, 0x00, 0x3C, 0x3E, 0x49, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x7B, 0x3F, 0x00, 0x00, 0x40, 0x3C, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x3F,
-    0x00, 0x00, 0x3C, 0x3E, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x3F, 0x00, 0x00, 0x3C, 0x3E,
-    0x46, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xA2, 0x3E, 0x00, 0x00, 0x6F, 0x3F,
-    0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3E, 0x00, 0x00, 0x4D, 0x3F, 0x4C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x3E, 0x00, 0x00, 0x4D, 0x3F, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x3E,
-    0x00, 0x00, 0x6F, 0x3F, 0x4B, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xA2, 0x3E,
-    0x00, 0x00, 0x6F, 0x3F, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x3E, 0x00, 0x00, 0x6F, 0x3F,
-    0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x3E, 0x00, 0x00, 0x4D, 0x3F, 0x4D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x92, 0x3E, 0x00, 0x00, 0x4D, 0x3F, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x3E,
-    0x00, 0x00, 0x4D, 0x3F, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0x3E, 0x00, 0x00, 0x6F, 0x3F,
-    0x4A, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x6C, 0x3E, 0x00, 0x00, 0x6F, 0x3F,
-    0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x3E, 0x00, 0x00, 0x6F, 0x3F, 0x4E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x96, 0x3E, 0x00, 0x00, 0x7B, 0x3F, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
@@ -1,3078 +0,0 @@
-/* Generated by bin2c, do not edit manually */
-const unsigned char buf1_ppm[49190] = {
-    0x50, 0x36, 0x0A, 0x23, 0x20, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
-    0x49, 0x72, 0x66, 0x61, 0x6E, 0x56, 0x69, 0x65, 0x77, 0x0A, 0x31, 0x32, 0x38, 0x20, 0x31, 0x32,
-    0x38, 0x0A, 0x32, 0x35, 0x35, 0x0A, 0x29, 0x25, 0x2E, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x2A,
-    0x2A, 0x29, 0x1F, 0x1E, 0x1E, 0x27, 0x26, 0x24, 0x29, 0x25, 0x2E, 0x22, 0x23, 0x22, 0x2A, 0x2A,
-    0x29, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x29, 0x25, 0x2E, 0x1F, 0x1E, 0x1E, 0x2A, 0x2A, 0x29,
-    0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x27,
-    0x26, 0x28, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x22, 0x23, 0x22, 0x29, 0x25, 0x2E, 0x22, 0x23,
-    0x22, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28,
-    0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x29, 0x25, 0x2E, 0x27, 0x26, 0x28, 0x29, 0x25, 0x2E, 0x22,
-    0x23, 0x22, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x27, 0x26,
-    0x28, 0x29, 0x25, 0x2E, 0x29, 0x25, 0x2E, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28, 0x39, 0x39, 0x3A, 0x32,
-    0x33, 0x32, 0x35, 0x34, 0x3A, 0x37, 0x36, 0x34, 0x39, 0x39, 0x3A, 0x3D, 0x3D, 0x3B, 0x35, 0x34,
-    0x3A, 0x3E, 0x3E, 0x3F, 0x35, 0x34, 0x3A, 0x32, 0x33, 0x32, 0x35, 0x34, 0x3A, 0x37, 0x36, 0x34,
-    0x35, 0x34, 0x3A, 0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0x32, 0x33, 0x32, 0x32, 0x33, 0x32, 0x03,
-    0x01, 0x02, 0x39, 0x39, 0x3A, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x35, 0x34, 0x3A, 0x32, 0x33,
-    0x32, 0x37, 0x36, 0x34, 0x37, 0x33, 0x32, 0x37, 0x36, 0x34, 0x3D, 0x3A, 0x35, 0x57, 0x56, 0x54,
-    0x63, 0x62, 0x5B, 0x3D, 0x36, 0x2C, 0x37, 0x36, 0x34, 0x3D, 0x3A, 0x35, 0x32, 0x32, 0x2D, 0x9B,
-    0x9A, 0x95, 0x61, 0x5F, 0x64, 0x5B, 0x5A, 0x5B, 0x38, 0x39, 0x35, 0x96, 0x95, 0x94, 0x5F, 0x5E,
-    0x5D, 0x5F, 0x5E, 0x5D, 0x38, 0x39, 0x35, 0x95, 0x93, 0x8D, 0x5F, 0x5E, 0x5D, 0x63, 0x62, 0x61,
-    0x39, 0x39, 0x3A, 0x3D, 0x3D, 0x3B, 0x35, 0x34, 0x3A, 0x2F, 0x2E, 0x30, 0x32, 0x33, 0x32, 0x32,
-    0x33, 0x32, 0x65, 0x65, 0x66, 0x32, 0x33, 0x32, 0x32, 0x33, 0x32, 0x5F, 0x5E, 0x5D, 0x97, 0x96,
-    0x99, 0xE0, 0xDF, 0xDE, 0xFE, 0xFE, 0xFC, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x1E, 0x01, 0x01, 0x0F, 0x02, 0x01, 0x0F,
-    0x02, 0x01, 0x0F, 0x02, 0x01, 0x1E, 0x01, 0x01, 0x1E, 0x01, 0x01, 0x1E, 0x01, 0x01, 0x1E, 0x01,
-    0x01, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01,
-    0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x97, 0x96, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x90,
-    0x8F, 0x8E, 0x65, 0x65, 0x66, 0x5B, 0x5A, 0x5B, 0x5B, 0x5A, 0x5B, 0x5F, 0x5E, 0x5D, 0x5B, 0x5A,
-    0x5B, 0x61, 0x5F, 0x64, 0x61, 0x5F, 0x64, 0x5F, 0x5E, 0x5D, 0x39, 0x39, 0x3A, 0x29, 0x25, 0x2E,
-    0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x22,
-    0x23, 0x22, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x27, 0x26,
-    0x28, 0x22, 0x23, 0x22, 0x1F, 0x1E, 0x1E, 0x27, 0x26, 0x28, 0x3D, 0x3D, 0x3B, 0x57, 0x56, 0x54,
-    0x63, 0x62, 0x61, 0x5F, 0x5E, 0x5D, 0x96, 0x95, 0x94, 0x61, 0x5F, 0x64, 0x90, 0x8F, 0x8E, 0x65,
-    0x65, 0x66, 0x96, 0x95, 0x94, 0xD8, 0xD6, 0xD2, 0x9F, 0x9E, 0x9D, 0xD8, 0xD6, 0xD9, 0xD8, 0xD6,
-    0xD9, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x05, 0x05, 0x08, 0x27, 0x26, 0x24, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24, 0x37, 0x36, 0x34, 0x44,
-    0x43, 0x43, 0x57, 0x56, 0x54, 0x27, 0x26, 0x28, 0x39, 0x39, 0x3A, 0x3E, 0x3E, 0x3F, 0x5B, 0x5A,
-    0x5B, 0x39, 0x39, 0x3A, 0x32, 0x33, 0x32, 0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x5F, 0x5E, 0x5D,
-    0x32, 0x33, 0x32, 0x37, 0x36, 0x34, 0x32, 0x33, 0x32, 0x65, 0x65, 0x66, 0x3D, 0x3D, 0x3B, 0x03,
-    0x01, 0x02, 0x32, 0x33, 0x32, 0x5B, 0x5A, 0x5B, 0x37, 0x36, 0x34, 0x32, 0x33, 0x32, 0x3D, 0x3D,
-    0x3B, 0x63, 0x62, 0x61, 0x37, 0x36, 0x34, 0x2C, 0x2D, 0x24, 0x4E, 0x44, 0x40, 0x43, 0x43, 0x3F,
-    0x2F, 0x2E, 0x2B, 0x39, 0x33, 0x2C, 0x37, 0x36, 0x34, 0x2F, 0x2E, 0x2B, 0x20, 0x1D, 0x19, 0x5C,
-    0x5C, 0x55, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x37, 0x36, 0x34, 0x62, 0x5E, 0x55, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x34, 0x35, 0x2E, 0x63, 0x62, 0x5B, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x46, 0x45, 0x47, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x3A, 0x32, 0x33, 0x32, 0x35, 0x34, 0x3A, 0x38,
-    0x39, 0x35, 0x57, 0x56, 0x54, 0x3E, 0x3E, 0x3F, 0x32, 0x32, 0x2D, 0x3D, 0x3D, 0x3B, 0x61, 0x5F,
-    0x64, 0x90, 0x8F, 0x8E, 0xE0, 0xDF, 0xDE, 0xFE, 0xFE, 0xFC, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x4A, 0x3D, 0x34, 0x3D, 0x36, 0x2C, 0x4A, 0x38, 0x30, 0x4D, 0x36, 0x21, 0x78,
-    0x59, 0x42, 0x9B, 0x77, 0x61, 0xA2, 0x83, 0x6E, 0xA2, 0x83, 0x6E, 0x9B, 0x77, 0x61, 0x78, 0x59,
-    0x42, 0x4B, 0x3D, 0x2C, 0x4A, 0x38, 0x30, 0x3D, 0x3A, 0x35, 0x39, 0x33, 0x2C, 0x37, 0x2A, 0x1C,
-    0x35, 0x26, 0x1F, 0x03, 0x01, 0x02, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x3D, 0x3D, 0x3B, 0x44,
-    0x43, 0x43, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E, 0x3F, 0x44, 0x43, 0x43, 0x42, 0x3D, 0x45, 0x39, 0x39,
-    0x3A, 0x44, 0x43, 0x43, 0x3B, 0x36, 0x43, 0x46, 0x45, 0x47, 0x32, 0x33, 0x32, 0x22, 0x23, 0x22,
-    0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x29, 0x25, 0x2E, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x27,
-    0x26, 0x28, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x2A, 0x2A,
-    0x29, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x28, 0x29, 0x23, 0x32, 0x33, 0x32, 0x43, 0x43, 0x3F,
-    0x48, 0x48, 0x41, 0x3D, 0x3D, 0x3B, 0x44, 0x43, 0x43, 0x43, 0x43, 0x3F, 0x3D, 0x3D, 0x3B, 0x3D,
-    0x3D, 0x3B, 0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E,
-    0x3F, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02,
-    0x2E, 0x26, 0x1A, 0x2D, 0x2A, 0x23, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28, 0x32, 0x32, 0x2D, 0x39,
-    0x39, 0x3A, 0x39, 0x39, 0x3A, 0x22, 0x23, 0x22, 0x39, 0x39, 0x3A, 0x2F, 0x2E, 0x30, 0x65, 0x65,
-    0x66, 0x22, 0x23, 0x22, 0x37, 0x36, 0x34, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x5F, 0x5E, 0x5D,
-    0x2F, 0x2E, 0x30, 0x32, 0x33, 0x32, 0x37, 0x36, 0x34, 0x3E, 0x3E, 0x3F, 0x61, 0x5F, 0x64, 0x03,
-    0x01, 0x02, 0x3E, 0x3E, 0x3F, 0x32, 0x33, 0x32, 0x27, 0x26, 0x28, 0x39, 0x39, 0x3A, 0x38, 0x39,
-    0x35, 0x90, 0x8F, 0x8E, 0x38, 0x39, 0x35, 0x5B, 0x5A, 0x5B, 0x23, 0x22, 0x1B, 0x3D, 0x3A, 0x35,
-    0x62, 0x5E, 0x55, 0x3D, 0x3A, 0x35, 0x3D, 0x36, 0x2C, 0x3D, 0x3A, 0x35, 0x3E, 0x3E, 0x36, 0x20,
-    0x1D, 0x19, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x2C, 0x2D, 0x24, 0x28, 0x26, 0x20, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x20, 0x1D, 0x19, 0x63, 0x62, 0x5B, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x39, 0x39, 0x3A, 0x3E, 0x3E, 0x3F, 0x65, 0x65, 0x66, 0x27, 0x26, 0x28, 0x37, 0x36, 0x34, 0x32,
-    0x33, 0x32, 0x39, 0x39, 0x3A, 0x23, 0x22, 0x1B, 0x3E, 0x3E, 0x3F, 0x32, 0x33, 0x32, 0x3E, 0x3E,
-    0x3F, 0x7E, 0x7E, 0x7D, 0x96, 0x95, 0x94, 0xD8, 0xD6, 0xD2, 0xFE, 0xFE, 0xFC, 0x05, 0x06, 0x03,
-    0x0F, 0x02, 0x01, 0x37, 0x33, 0x32, 0x4A, 0x3D, 0x34, 0x47, 0x2F, 0x20, 0x3C, 0x1E, 0x06, 0x3C,
-    0x25, 0x10, 0x3F, 0x23, 0x08, 0x46, 0x2E, 0x19, 0x3C, 0x25, 0x10, 0x3C, 0x1E, 0x06, 0x38, 0x29,
-    0x18, 0x2D, 0x1E, 0x10, 0x30, 0x1F, 0x18, 0x1C, 0x1A, 0x13, 0x24, 0x1A, 0x11, 0x2E, 0x26, 0x1A,
-    0x2B, 0x22, 0x18, 0x0F, 0x02, 0x01, 0x37, 0x36, 0x34, 0x32, 0x32, 0x2D, 0x32, 0x32, 0x2D, 0x37,
-    0x36, 0x34, 0x32, 0x32, 0x2D, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x32, 0x33, 0x32, 0x39, 0x39,
-    0x3A, 0x35, 0x34, 0x3A, 0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x35, 0x34, 0x3A, 0x2F, 0x2E, 0x30,
-    0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x2A,
-    0x2A, 0x29, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x22, 0x23,
-    0x22, 0x27, 0x26, 0x24, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x2C, 0x2D, 0x24,
-    0x37, 0x36, 0x34, 0x34, 0x35, 0x2E, 0x32, 0x32, 0x2D, 0x32, 0x33, 0x32, 0x38, 0x39, 0x35, 0x38,
-    0x39, 0x35, 0x2F, 0x2E, 0x2B, 0x28, 0x26, 0x20, 0x3E, 0x3E, 0x36, 0x37, 0x36, 0x34, 0x22, 0x23,
-    0x22, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x2D, 0x29, 0x1A, 0x49, 0x38, 0x29, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x32, 0x33, 0x32, 0x39,
-    0x39, 0x3A, 0x38, 0x39, 0x35, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x3A, 0x5B, 0x5A,
-    0x5B, 0x22, 0x23, 0x22, 0x38, 0x39, 0x35, 0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x37, 0x36, 0x34,
-    0x32, 0x33, 0x32, 0x3D, 0x3D, 0x3B, 0x32, 0x33, 0x32, 0x37, 0x36, 0x34, 0x95, 0x93, 0x8D, 0x05,
-    0x06, 0x03, 0x2A, 0x2A, 0x29, 0x39, 0x39, 0x3A, 0x37, 0x36, 0x34, 0x3D, 0x3D, 0x3B, 0x37, 0x36,
-    0x34, 0x32, 0x32, 0x2D, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x2D, 0x2A, 0x23, 0x26, 0x23, 0x21,
-    0x35, 0x26, 0x1F, 0x26, 0x23, 0x21, 0x20, 0x1D, 0x19, 0x2B, 0x22, 0x18, 0x20, 0x1D, 0x19, 0x3E,
-    0x3E, 0x36, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x3D, 0x3A, 0x35, 0x38, 0x39, 0x35, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x23, 0x22, 0x1B, 0x3E, 0x3A, 0x2D, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08,
-    0x3E, 0x3E, 0x3F, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x3A, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x3E,
-    0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E,
-    0x3F, 0x61, 0x5F, 0x64, 0x83, 0x83, 0x82, 0xB3, 0xB2, 0xB1, 0xD8, 0xD6, 0xD2, 0xD3, 0xD2, 0xD1,
-    0x0F, 0x02, 0x01, 0x2E, 0x26, 0x1A, 0x38, 0x29, 0x18, 0x4D, 0x36, 0x21, 0x4D, 0x36, 0x21, 0x55,
-    0x35, 0x19, 0x3C, 0x1E, 0x06, 0x3C, 0x1E, 0x06, 0x3C, 0x25, 0x10, 0x3C, 0x25, 0x10, 0x3C, 0x25,
-    0x10, 0x35, 0x26, 0x17, 0x20, 0x1D, 0x19, 0x1B, 0x14, 0x0A, 0x31, 0x22, 0x12, 0x37, 0x2A, 0x1C,
-    0x2E, 0x26, 0x1A, 0x03, 0x01, 0x02, 0x2D, 0x29, 0x1A, 0x28, 0x29, 0x23, 0x2C, 0x2D, 0x24, 0x28,
-    0x29, 0x23, 0x28, 0x29, 0x23, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x28, 0x29, 0x23, 0x28, 0x29,
-    0x23, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x27, 0x26, 0x28,
-    0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x22,
-    0x23, 0x22, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x28, 0x29, 0x23, 0x27, 0x26, 0x28, 0x28, 0x29,
-    0x23, 0x28, 0x26, 0x20, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x2C, 0x2D, 0x24, 0x28, 0x29, 0x23,
-    0x28, 0x29, 0x23, 0x28, 0x26, 0x20, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x28, 0x29, 0x23, 0x1F,
-    0x1E, 0x1E, 0x2A, 0x2A, 0x29, 0x28, 0x29, 0x23, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x28, 0x29,
-    0x23, 0x2C, 0x2D, 0x24, 0x2D, 0x29, 0x1A, 0x03, 0x01, 0x02, 0x09, 0x0A, 0x03, 0x34, 0x26, 0x12,
-    0x3E, 0x2A, 0x12, 0x42, 0x33, 0x22, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x3E, 0x3E, 0x3F, 0x46,
-    0x45, 0x47, 0x5B, 0x5A, 0x5B, 0x32, 0x33, 0x32, 0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x37, 0x36,
-    0x34, 0x2F, 0x2E, 0x30, 0x32, 0x33, 0x32, 0x27, 0x26, 0x28, 0x32, 0x33, 0x32, 0x37, 0x36, 0x34,
-    0x35, 0x34, 0x3A, 0x37, 0x36, 0x34, 0x39, 0x39, 0x3A, 0x32, 0x33, 0x32, 0x63, 0x62, 0x61, 0x03,
-    0x01, 0x02, 0x38, 0x39, 0x35, 0x39, 0x39, 0x3A, 0x32, 0x33, 0x32, 0x3E, 0x3E, 0x3F, 0x39, 0x39,
-    0x3A, 0x2F, 0x2E, 0x30, 0x38, 0x39, 0x35, 0x48, 0x48, 0x41, 0x5F, 0x5E, 0x5D, 0x44, 0x3F, 0x3B,
-    0x3D, 0x3A, 0x35, 0x43, 0x43, 0x39, 0x20, 0x1D, 0x19, 0x1C, 0x1A, 0x13, 0x4A, 0x3D, 0x34, 0x5F,
-    0x5E, 0x5D, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x44, 0x3F, 0x3B, 0x37, 0x36, 0x34, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x38, 0x39, 0x35, 0x3E, 0x3E, 0x36, 0x05, 0x06, 0x03, 0x05, 0x06, 0x03,
-    0x35, 0x34, 0x3A, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x61, 0x5F, 0x64, 0x5F, 0x5E, 0x5D, 0x3E,
-    0x3E, 0x3F, 0x5C, 0x5C, 0x55, 0x3E, 0x3E, 0x3F, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x5B, 0x5A,
-    0x5B, 0x5B, 0x5A, 0x5B, 0x83, 0x83, 0x82, 0x96, 0x95, 0x94, 0xB9, 0xB8, 0xB8, 0xDC, 0xDB, 0xD9,
-    0x03, 0x01, 0x02, 0x37, 0x2C, 0x21, 0x31, 0x22, 0x12, 0x4F, 0x3A, 0x23, 0x7A, 0x56, 0x3A, 0x7A,
-    0x56, 0x3A, 0x57, 0x3B, 0x23, 0x46, 0x2E, 0x19, 0x3C, 0x25, 0x10, 0x3C, 0x1E, 0x06, 0x2C, 0x1A,
-    0x09, 0x1C, 0x0E, 0x02, 0x24, 0x1A, 0x11, 0x2D, 0x2A, 0x23, 0x2D, 0x29, 0x1A, 0x2E, 0x26, 0x1A,
-    0x37, 0x2A, 0x1C, 0x03, 0x01, 0x02, 0x46, 0x47, 0x39, 0x41, 0x42, 0x34, 0x41, 0x42, 0x34, 0x41,
-    0x42, 0x34, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x43, 0x43, 0x39, 0x43, 0x43,
-    0x39, 0x3E, 0x3A, 0x2D, 0x43, 0x43, 0x39, 0x41, 0x42, 0x34, 0x43, 0x43, 0x3F, 0x38, 0x39, 0x35,
-    0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x2F,
-    0x2E, 0x2B, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x28, 0x29,
-    0x23, 0x28, 0x29, 0x23, 0x2C, 0x2D, 0x24, 0x34, 0x35, 0x2E, 0x41, 0x42, 0x34, 0x3D, 0x3D, 0x3B,
-    0x3E, 0x3E, 0x36, 0x38, 0x39, 0x35, 0x34, 0x35, 0x2E, 0x2C, 0x2D, 0x24, 0x3E, 0x3A, 0x2D, 0x33,
-    0x32, 0x23, 0x3E, 0x3A, 0x2D, 0x34, 0x35, 0x2E, 0x37, 0x36, 0x34, 0x34, 0x35, 0x2E, 0x43, 0x43,
-    0x39, 0x23, 0x22, 0x1B, 0x3E, 0x3A, 0x2D, 0x03, 0x01, 0x02, 0x36, 0x29, 0x13, 0x3C, 0x25, 0x10,
-    0x4E, 0x34, 0x1A, 0x4B, 0x3D, 0x2C, 0x0F, 0x02, 0x01, 0x22, 0x23, 0x22, 0x39, 0x39, 0x3A, 0x5B,
-    0x5A, 0x5B, 0x5F, 0x5E, 0x5D, 0x44, 0x43, 0x43, 0x5F, 0x5E, 0x5D, 0x43, 0x43, 0x3F, 0x5B, 0x5A,
-    0x5B, 0x39, 0x39, 0x3A, 0x3D, 0x3D, 0x3B, 0x5F, 0x5E, 0x5D, 0x44, 0x43, 0x43, 0x3E, 0x3E, 0x3F,
-    0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0x32, 0x32, 0x2D, 0x3D, 0x3D, 0x3B, 0x5B, 0x5A, 0x5B, 0x03,
-    0x01, 0x02, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x65, 0x65, 0x66, 0x39, 0x39, 0x3A, 0x48, 0x48,
-    0x41, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x39, 0x39, 0x3A, 0x62, 0x5E, 0x55, 0x3D, 0x3A, 0x35,
-    0x3D, 0x3A, 0x35, 0x3D, 0x3A, 0x35, 0x63, 0x62, 0x5B, 0x4A, 0x38, 0x30, 0x63, 0x62, 0x5B, 0x4A,
-    0x3D, 0x34, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x3D, 0x3A, 0x35, 0x3E, 0x3E, 0x36, 0x0F, 0x02,
-    0x01, 0x03, 0x01, 0x02, 0x62, 0x5E, 0x55, 0x95, 0x93, 0x8D, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x3E, 0x3E, 0x3F, 0x5B, 0x5A, 0x5B, 0x39, 0x39, 0x3A, 0x5B, 0x5A, 0x5B, 0x5B, 0x5A, 0x5B, 0x5F,
-    0x5E, 0x5D, 0x65, 0x65, 0x66, 0x57, 0x56, 0x54, 0x5C, 0x5C, 0x55, 0x65, 0x65, 0x66, 0x61, 0x5F,
-    0x64, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x9A, 0x9A, 0x9A, 0x90, 0x8F, 0x8E, 0xBA, 0xB6, 0xB1,
-    0x0F, 0x02, 0x01, 0x2E, 0x26, 0x1A, 0x3C, 0x25, 0x10, 0x4E, 0x34, 0x1A, 0x7E, 0x55, 0x32, 0x82,
-    0x5F, 0x44, 0x6B, 0x4D, 0x33, 0x57, 0x3B, 0x23, 0x4E, 0x34, 0x1A, 0x4F, 0x3A, 0x23, 0x22, 0x13,
-    0x04, 0x22, 0x13, 0x04, 0x24, 0x1A, 0x11, 0x2D, 0x2A, 0x23, 0x37, 0x2A, 0x1C, 0x34, 0x26, 0x12,
-    0x2E, 0x26, 0x1A, 0x0F, 0x02, 0x01, 0x86, 0x85, 0x6F, 0x89, 0x89, 0x6F, 0x8A, 0x8A, 0x76, 0x83,
-    0x84, 0x6A, 0x86, 0x85, 0x75, 0x83, 0x84, 0x6A, 0x86, 0x85, 0x6F, 0x86, 0x85, 0x75, 0x86, 0x85,
-    0x6F, 0x5D, 0x5E, 0x4C, 0x46, 0x47, 0x39, 0x3B, 0x3F, 0x2E, 0x41, 0x42, 0x34, 0x3E, 0x3A, 0x2D,
-    0x34, 0x35, 0x2E, 0x3E, 0x3A, 0x2D, 0x2A, 0x2A, 0x29, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x26,
-    0x23, 0x21, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2C, 0x2D, 0x24, 0x34, 0x35, 0x2E, 0x3E, 0x3A,
-    0x2D, 0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E, 0x38, 0x39, 0x35, 0x41, 0x42, 0x34, 0x43, 0x43, 0x39,
-    0x4B, 0x4B, 0x42, 0x53, 0x53, 0x44, 0x61, 0x62, 0x4A, 0x61, 0x62, 0x4A, 0x5C, 0x5D, 0x43, 0x61,
-    0x62, 0x4A, 0x59, 0x57, 0x44, 0x5B, 0x5A, 0x4C, 0x8A, 0x8A, 0x76, 0x86, 0x85, 0x75, 0x63, 0x62,
-    0x5B, 0x5C, 0x5C, 0x55, 0x03, 0x01, 0x02, 0x1E, 0x01, 0x01, 0x35, 0x26, 0x1F, 0x4D, 0x36, 0x21,
-    0x47, 0x2F, 0x20, 0x49, 0x38, 0x29, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x3E, 0x3E, 0x3F, 0x63,
-    0x62, 0x61, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x96, 0x95, 0x94, 0x5F, 0x5E, 0x5D, 0x65, 0x65,
-    0x66, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x39, 0x39, 0x3A, 0x46, 0x45, 0x47,
-    0x57, 0x56, 0x54, 0x35, 0x34, 0x3A, 0x37, 0x36, 0x34, 0x65, 0x65, 0x66, 0x7E, 0x7E, 0x7D, 0x03,
-    0x01, 0x02, 0x5B, 0x5A, 0x5B, 0x5B, 0x5A, 0x5B, 0x5B, 0x5A, 0x5B, 0x63, 0x62, 0x61, 0x5B, 0x5A,
-    0x5B, 0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0x34, 0x35, 0x2E, 0x5B, 0x5A, 0x5B, 0x5C, 0x5C, 0x55,
-    0x6A, 0x6A, 0x69, 0x2B, 0x22, 0x18, 0x3D, 0x36, 0x2C, 0x4A, 0x3D, 0x34, 0x42, 0x33, 0x22, 0x9B,
-    0x9A, 0x95, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x5C, 0x5C, 0x55, 0x4A, 0x3D, 0x34, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x5C, 0x5C, 0x55, 0x84, 0x84, 0x7B, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x57, 0x56, 0x54, 0x5F, 0x5E, 0x5D, 0x61, 0x5F, 0x64, 0x5B, 0x5A, 0x5B, 0x83, 0x83, 0x82, 0x7E,
-    0x7E, 0x7D, 0x78, 0x78, 0x78, 0x83, 0x83, 0x82, 0x9A, 0x9A, 0x9A, 0x78, 0x78, 0x78, 0x7E, 0x7E,
-    0x7D, 0x7E, 0x7E, 0x7D, 0x9A, 0x9A, 0x9A, 0x9B, 0x9A, 0x95, 0xB3, 0xB2, 0xB1, 0xE0, 0xDF, 0xDE,
-    0x03, 0x01, 0x02, 0x2E, 0x26, 0x1A, 0x3C, 0x25, 0x10, 0x4E, 0x34, 0x1A, 0x7E, 0x55, 0x32, 0x85,
-    0x5A, 0x39, 0x7A, 0x56, 0x3A, 0x4E, 0x34, 0x1A, 0x3E, 0x2A, 0x12, 0x47, 0x2F, 0x20, 0x22, 0x13,
-    0x04, 0x24, 0x1A, 0x11, 0x16, 0x0F, 0x09, 0x21, 0x16, 0x0F, 0x2D, 0x29, 0x1A, 0x37, 0x2A, 0x1C,
-    0x35, 0x26, 0x17, 0x03, 0x01, 0x02, 0x86, 0x85, 0x6F, 0x83, 0x84, 0x6A, 0x83, 0x84, 0x6A, 0x83,
-    0x84, 0x6A, 0x8A, 0x8A, 0x76, 0x86, 0x85, 0x6F, 0x86, 0x85, 0x6F, 0x86, 0x85, 0x6F, 0x86, 0x85,
-    0x6F, 0x68, 0x59, 0x4B, 0x43, 0x47, 0x2F, 0x58, 0x48, 0x38, 0x46, 0x47, 0x39, 0x33, 0x32, 0x23,
-    0x3B, 0x3F, 0x2E, 0x32, 0x32, 0x2D, 0x33, 0x32, 0x23, 0x3E, 0x3E, 0x36, 0x3D, 0x36, 0x2C, 0x23,
-    0x22, 0x1B, 0x09, 0x0A, 0x03, 0x3E, 0x3E, 0x36, 0x86, 0x85, 0x75, 0x84, 0x84, 0x7B, 0x86, 0x85,
-    0x75, 0x84, 0x84, 0x7B, 0x86, 0x85, 0x75, 0x86, 0x85, 0x75, 0x86, 0x85, 0x75, 0x86, 0x85, 0x75,
-    0x86, 0x85, 0x75, 0x86, 0x85, 0x6F, 0x83, 0x84, 0x6A, 0x83, 0x84, 0x6A, 0x86, 0x8B, 0x69, 0x83,
-    0x84, 0x6A, 0x89, 0x89, 0x6F, 0x83, 0x84, 0x6A, 0x86, 0x85, 0x75, 0x86, 0x85, 0x75, 0x86, 0x85,
-    0x75, 0x2B, 0x22, 0x18, 0x2D, 0x2A, 0x23, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x49, 0x38, 0x29,
-    0x4D, 0x36, 0x21, 0x47, 0x2F, 0x20, 0x0F, 0x02, 0x01, 0x27, 0x26, 0x28, 0x3E, 0x3E, 0x3F, 0x5B,
-    0x5A, 0x5B, 0xBD, 0xBB, 0xBA, 0x9B, 0x9A, 0x95, 0x78, 0x78, 0x78, 0x5F, 0x5E, 0x5D, 0x5C, 0x5C,
-    0x55, 0x5F, 0x5E, 0x5D, 0x5B, 0x5A, 0x5B, 0x63, 0x62, 0x61, 0x7E, 0x7E, 0x7D, 0x5B, 0x5A, 0x5B,
-    0x83, 0x83, 0x82, 0x7E, 0x7E, 0x7D, 0x78, 0x78, 0x78, 0x5F, 0x5E, 0x5D, 0xB5, 0xB5, 0xB5, 0x05,
-    0x06, 0x03, 0x5F, 0x5E, 0x5D, 0x7E, 0x7E, 0x7D, 0x63, 0x62, 0x61, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E,
-    0x7D, 0x83, 0x83, 0x82, 0x78, 0x78, 0x78, 0x7E, 0x7E, 0x7D, 0x9B, 0x9A, 0x95, 0x3D, 0x3A, 0x35,
-    0x37, 0x33, 0x32, 0x44, 0x3F, 0x3B, 0x4A, 0x3D, 0x34, 0x31, 0x22, 0x12, 0x9B, 0x9A, 0x95, 0xBA,
-    0xB6, 0xB1, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x62, 0x5E, 0x55, 0x95, 0x93, 0x8D, 0x03, 0x01,
-    0x02, 0x05, 0x06, 0x03, 0x86, 0x85, 0x75, 0xB3, 0xB2, 0xB1, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02,
-    0x83, 0x83, 0x82, 0x7E, 0x7E, 0x7D, 0x97, 0x96, 0x99, 0x83, 0x83, 0x82, 0x97, 0x96, 0x99, 0x97,
-    0x96, 0x99, 0x9B, 0x9A, 0x95, 0x96, 0x95, 0x94, 0x96, 0x95, 0x94, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
-    0x9A, 0x97, 0x96, 0x99, 0xB5, 0xB5, 0xB5, 0xD8, 0xD6, 0xD2, 0xD8, 0xD6, 0xD9, 0xFE, 0xFE, 0xFC,
-    0x03, 0x01, 0x02, 0x37, 0x2A, 0x1C, 0x3C, 0x25, 0x10, 0x53, 0x32, 0x12, 0x88, 0x5A, 0x33, 0x7E,
-    0x55, 0x32, 0x7A, 0x56, 0x3A, 0x54, 0x39, 0x1D, 0x3C, 0x25, 0x10, 0x36, 0x29, 0x13, 0x22, 0x15,
-    0x09, 0x16, 0x0F, 0x09, 0x24, 0x1A, 0x11, 0x2E, 0x26, 0x1A, 0x2D, 0x29, 0x1A, 0x34, 0x26, 0x12,
-    0x37, 0x2C, 0x21, 0x03, 0x01, 0x02, 0x83, 0x84, 0x6A, 0x89, 0x89, 0x6F, 0x86, 0x85, 0x6F, 0x83,
-    0x84, 0x6A, 0x86, 0x85, 0x6F, 0x86, 0x85, 0x6F, 0x86, 0x85, 0x6F, 0x83, 0x84, 0x6A, 0x86, 0x85,
-    0x6F, 0x83, 0x84, 0x6A, 0x86, 0x85, 0x6F, 0x86, 0x85, 0x6F, 0x8A, 0x7D, 0x69, 0x8A, 0x8A, 0x76,
-    0x86, 0x85, 0x75, 0x86, 0x85, 0x75, 0x86, 0x85, 0x6F, 0x7E, 0x7E, 0x7D, 0x8F, 0x8B, 0x7F, 0x86,
-    0x85, 0x75, 0x86, 0x85, 0x75, 0x86, 0x85, 0x75, 0x84, 0x84, 0x7B, 0x86, 0x85, 0x75, 0x86, 0x85,
-    0x75, 0x86, 0x85, 0x75, 0x86, 0x85, 0x6F, 0x86, 0x85, 0x75, 0x86, 0x85, 0x75, 0x86, 0x85, 0x75,
-    0x86, 0x85, 0x6F, 0x86, 0x85, 0x75, 0x83, 0x84, 0x6A, 0x86, 0x85, 0x6F, 0x89, 0x89, 0x6F, 0x8A,
-    0x8A, 0x76, 0x86, 0x85, 0x75, 0x86, 0x85, 0x6F, 0x86, 0x85, 0x75, 0x86, 0x85, 0x6F, 0x03, 0x01,
-    0x02, 0x35, 0x26, 0x17, 0x34, 0x26, 0x12, 0x3C, 0x25, 0x10, 0x47, 0x2F, 0x20, 0x54, 0x39, 0x1D,
-    0x61, 0x45, 0x2B, 0x4E, 0x34, 0x1A, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x3E, 0x3E, 0x3F, 0x63,
-    0x62, 0x61, 0xB3, 0xB2, 0xB1, 0x96, 0x95, 0x94, 0x84, 0x84, 0x7B, 0x7E, 0x7E, 0x7D, 0x9B, 0x9A,
-    0x95, 0x84, 0x84, 0x7B, 0x78, 0x78, 0x78, 0x7E, 0x7E, 0x7D, 0x9A, 0x9A, 0x9A, 0x7E, 0x7E, 0x7D,
-    0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x83, 0x83, 0x82, 0x78, 0x78, 0x78, 0xFE, 0xFE, 0xFC, 0x03,
-    0x01, 0x02, 0x78, 0x78, 0x78, 0x9A, 0x9A, 0x9A, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0xB5, 0xB5,
-    0xB5, 0x9A, 0x9A, 0x9A, 0x90, 0x8F, 0x8E, 0xC3, 0xC3, 0xC2, 0xD3, 0xD2, 0xD1, 0xFE, 0xFE, 0xFC,
-    0xBA, 0xB6, 0xB1, 0x95, 0x93, 0x8D, 0xBA, 0xB6, 0xB1, 0x95, 0x93, 0x8D, 0xBA, 0xB6, 0xB1, 0xD8,
-    0xD6, 0xD2, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x95, 0x93, 0x8D, 0xD8, 0xD6, 0xD2, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x95, 0x93, 0x8D, 0xD8, 0xD6, 0xD2, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0xBD, 0xBB, 0xBA, 0xB3, 0xB2, 0xB1, 0x97, 0x96, 0x99, 0x9A, 0x9A, 0x9A, 0x97, 0x96, 0x99, 0xBD,
-    0xBB, 0xBA, 0xD8, 0xD6, 0xD2, 0xB5, 0xB5, 0xB5, 0xD3, 0xD2, 0xD1, 0xFE, 0xFE, 0xFC, 0xDC, 0xDB,
-    0xD9, 0xD8, 0xD6, 0xD9, 0xD8, 0xD6, 0xD9, 0xD8, 0xD6, 0xD2, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC,
-    0x0F, 0x02, 0x01, 0x2E, 0x26, 0x1A, 0x3C, 0x25, 0x10, 0x53, 0x32, 0x12, 0x89, 0x56, 0x32, 0xA2,
-    0x71, 0x4B, 0x7E, 0x55, 0x32, 0x4E, 0x34, 0x1A, 0x34, 0x26, 0x12, 0x35, 0x26, 0x17, 0x22, 0x15,
-    0x09, 0x19, 0x13, 0x0E, 0x1A, 0x16, 0x11, 0x24, 0x1A, 0x11, 0x2D, 0x29, 0x1A, 0x31, 0x22, 0x12,
-    0x2E, 0x26, 0x1A, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05,
-    0x06, 0x03, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x2C, 0x1A,
-    0x09, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x1E, 0x01, 0x01, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01,
-    0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01,
-    0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x34, 0x26,
-    0x12, 0x34, 0x26, 0x12, 0x36, 0x29, 0x13, 0x4F, 0x3A, 0x23, 0x53, 0x32, 0x12, 0x6C, 0x47, 0x27,
-    0x99, 0x74, 0x56, 0x55, 0x35, 0x19, 0x0F, 0x02, 0x01, 0x21, 0x1E, 0x26, 0x3E, 0x3E, 0x3F, 0x5B,
-    0x5A, 0x5B, 0x9A, 0x9A, 0x9A, 0x83, 0x83, 0x82, 0x74, 0x74, 0x6F, 0x63, 0x62, 0x61, 0x5C, 0x5C,
-    0x55, 0x5F, 0x5E, 0x5D, 0x83, 0x83, 0x82, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x9A, 0x9A, 0x9A,
-    0x65, 0x65, 0x66, 0x5B, 0x5A, 0x5B, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0xB3, 0xB2, 0xB1, 0x03,
-    0x01, 0x02, 0x6A, 0x6A, 0x69, 0x78, 0x78, 0x78, 0x65, 0x65, 0x66, 0x5F, 0x5E, 0x5D, 0x7E, 0x7E,
-    0x7D, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x96, 0x95, 0x94, 0xFE, 0xFE, 0xFC, 0x5B, 0x5A, 0x5B,
-    0x96, 0x95, 0x94, 0x63, 0x62, 0x5B, 0x63, 0x62, 0x5B, 0x62, 0x5E, 0x55, 0x9B, 0x9A, 0x95, 0xBA,
-    0xB6, 0xB1, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x62, 0x5E, 0x55, 0x9B, 0x9A, 0x95, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x5F, 0x5E, 0x5D, 0xBA, 0xB6, 0xB1, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x78, 0x78, 0x78, 0x83, 0x83, 0x82, 0x9A, 0x9A, 0x9A, 0x83, 0x83, 0x82, 0x96, 0x95, 0x94, 0x96,
-    0x95, 0x94, 0x96, 0x95, 0x94, 0x96, 0x95, 0x94, 0x9B, 0x9A, 0x95, 0x96, 0x95, 0x94, 0x90, 0x8F,
-    0x8E, 0x9F, 0x9E, 0x9D, 0xB5, 0xB5, 0xB5, 0xDC, 0xDB, 0xD9, 0xD3, 0xD2, 0xD1, 0xFE, 0xFE, 0xFC,
-    0x03, 0x01, 0x02, 0x37, 0x2A, 0x1C, 0x3F, 0x23, 0x08, 0x53, 0x32, 0x12, 0x88, 0x5A, 0x33, 0xAC,
-    0x72, 0x49, 0x86, 0x5E, 0x3C, 0x54, 0x39, 0x1D, 0x34, 0x26, 0x12, 0x35, 0x26, 0x17, 0x22, 0x15,
-    0x09, 0x2B, 0x15, 0x13, 0x21, 0x16, 0x0F, 0x2E, 0x26, 0x1A, 0x36, 0x29, 0x13, 0x38, 0x29, 0x18,
-    0x35, 0x26, 0x1F, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x22, 0x13, 0x04, 0x35, 0x26,
-    0x17, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x37, 0x2A, 0x1C, 0x46, 0x2E, 0x19, 0x35, 0x26, 0x17,
-    0x39, 0x33, 0x2C, 0x0F, 0x02, 0x01, 0x42, 0x33, 0x22, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x34,
-    0x26, 0x12, 0x36, 0x29, 0x13, 0x36, 0x29, 0x13, 0x24, 0x2B, 0x11, 0x34, 0x26, 0x12, 0x24, 0x2B,
-    0x11, 0x36, 0x29, 0x13, 0x36, 0x29, 0x13, 0x34, 0x26, 0x12, 0x34, 0x26, 0x12, 0x34, 0x26, 0x12,
-    0x31, 0x22, 0x12, 0x3C, 0x25, 0x10, 0x2E, 0x26, 0x1A, 0x36, 0x29, 0x13, 0x38, 0x29, 0x18, 0x34,
-    0x26, 0x12, 0x3A, 0x2D, 0x1C, 0x36, 0x29, 0x13, 0x36, 0x29, 0x13, 0x34, 0x26, 0x12, 0x36, 0x29,
-    0x13, 0x30, 0x1D, 0x09, 0x4D, 0x36, 0x21, 0x4F, 0x3A, 0x23, 0x50, 0x2C, 0x0E, 0x61, 0x45, 0x2B,
-    0x85, 0x5A, 0x39, 0x55, 0x35, 0x19, 0x03, 0x01, 0x02, 0x2F, 0x2E, 0x30, 0x37, 0x36, 0x34, 0x63,
-    0x62, 0x61, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x63, 0x62, 0x5B, 0x5C, 0x5C, 0x55, 0x63, 0x62,
-    0x5B, 0x5F, 0x5E, 0x5D, 0x57, 0x56, 0x54, 0x9A, 0x9A, 0x9A, 0x5F, 0x5E, 0x5D, 0x21, 0x1E, 0x26,
-    0xCD, 0xCD, 0xCB, 0x9A, 0x9A, 0x9A, 0x78, 0x78, 0x78, 0x63, 0x62, 0x5B, 0x7E, 0x7E, 0x7D, 0x03,
-    0x01, 0x02, 0x5F, 0x5E, 0x5D, 0x57, 0x56, 0x54, 0x63, 0x62, 0x61, 0x35, 0x34, 0x3A, 0x5B, 0x5A,
-    0x5B, 0x65, 0x65, 0x66, 0x57, 0x56, 0x54, 0x9A, 0x9A, 0x9A, 0xB3, 0xB2, 0xB1, 0x5C, 0x5C, 0x55,
-    0x9A, 0x9A, 0x9A, 0x37, 0x33, 0x32, 0x39, 0x33, 0x2C, 0x4A, 0x3D, 0x34, 0x57, 0x57, 0x4C, 0x62,
-    0x5E, 0x55, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x57, 0x56, 0x54, 0x63, 0x62, 0x5B, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x3B, 0x3F, 0x2E, 0x95, 0x93, 0x8D, 0x0A, 0x0A, 0x09, 0x03, 0x01, 0x02,
-    0x61, 0x5F, 0x64, 0x5F, 0x5E, 0x5D, 0x78, 0x78, 0x78, 0x61, 0x5F, 0x64, 0x5F, 0x5E, 0x5D, 0x83,
-    0x83, 0x82, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E,
-    0x7D, 0x97, 0x96, 0x99, 0x97, 0x96, 0x99, 0x90, 0x8F, 0x8E, 0xBD, 0xBB, 0xBA, 0xD8, 0xD6, 0xD2,
-    0x0F, 0x02, 0x01, 0x2D, 0x29, 0x1A, 0x3C, 0x25, 0x10, 0x55, 0x35, 0x19, 0x83, 0x51, 0x2C, 0x88,
-    0x5A, 0x33, 0x7E, 0x55, 0x32, 0x53, 0x32, 0x12, 0x3C, 0x25, 0x10, 0x35, 0x26, 0x17, 0x1B, 0x14,
-    0x0A, 0x2B, 0x15, 0x13, 0x19, 0x13, 0x0E, 0x2B, 0x22, 0x18, 0x2D, 0x29, 0x1A, 0x37, 0x2A, 0x1C,
-    0x2E, 0x26, 0x1A, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x16, 0x0F, 0x09, 0x35, 0x26,
-    0x1F, 0x49, 0x38, 0x29, 0x4D, 0x36, 0x21, 0x47, 0x2F, 0x20, 0x47, 0x2F, 0x20, 0x4B, 0x3D, 0x2C,
-    0x5F, 0x4B, 0x47, 0x0F, 0x02, 0x01, 0x49, 0x38, 0x29, 0x4D, 0x36, 0x21, 0x49, 0x38, 0x29, 0x4D,
-    0x36, 0x21, 0x4D, 0x36, 0x21, 0x41, 0x38, 0x23, 0x4F, 0x3A, 0x23, 0x41, 0x38, 0x23, 0x4E, 0x34,
-    0x1A, 0x41, 0x38, 0x23, 0x54, 0x39, 0x1D, 0x4D, 0x36, 0x21, 0x4D, 0x36, 0x21, 0x54, 0x39, 0x1D,
-    0x57, 0x3B, 0x23, 0x4D, 0x36, 0x21, 0x4D, 0x36, 0x21, 0x47, 0x2F, 0x20, 0x49, 0x38, 0x29, 0x4E,
-    0x34, 0x1A, 0x4D, 0x36, 0x21, 0x47, 0x2F, 0x20, 0x54, 0x39, 0x1D, 0x4D, 0x36, 0x21, 0x4E, 0x34,
-    0x1A, 0x4F, 0x3A, 0x23, 0x54, 0x39, 0x1D, 0x61, 0x45, 0x2B, 0x6B, 0x4D, 0x33, 0x6C, 0x47, 0x27,
-    0x6C, 0x47, 0x27, 0x46, 0x2E, 0x19, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x3E, 0x3E, 0x3F, 0x46,
-    0x45, 0x47, 0x3D, 0x3D, 0x3B, 0x38, 0x39, 0x35, 0x3E, 0x3E, 0x36, 0x43, 0x43, 0x3F, 0x3D, 0x3D,
-    0x3B, 0x5C, 0x5C, 0x55, 0x65, 0x65, 0x66, 0xCD, 0xCD, 0xCB, 0xFE, 0xFE, 0xFC, 0x2A, 0x2A, 0x29,
-    0x96, 0x95, 0x94, 0x65, 0x65, 0x66, 0x46, 0x45, 0x47, 0x5F, 0x5E, 0x5D, 0x83, 0x83, 0x82, 0x03,
-    0x01, 0x02, 0x65, 0x65, 0x66, 0x3E, 0x3E, 0x3F, 0x39, 0x39, 0x3A, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E,
-    0x3F, 0x38, 0x39, 0x35, 0x63, 0x62, 0x61, 0x63, 0x62, 0x61, 0x97, 0x96, 0x99, 0x9A, 0x9A, 0x9A,
-    0x63, 0x62, 0x61, 0x5C, 0x5C, 0x55, 0x63, 0x62, 0x5B, 0x43, 0x43, 0x39, 0x26, 0x1E, 0x12, 0x44,
-    0x3F, 0x3B, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x28, 0x26, 0x20, 0x37, 0x33, 0x32, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x63, 0x62, 0x5B, 0x3E, 0x3E, 0x36, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03,
-    0x39, 0x39, 0x3A, 0x5F, 0x5E, 0x5D, 0x65, 0x65, 0x66, 0x57, 0x56, 0x54, 0x44, 0x43, 0x43, 0x3E,
-    0x3E, 0x3F, 0x57, 0x56, 0x54, 0x6A, 0x6A, 0x69, 0x5C, 0x5C, 0x55, 0x5B, 0x5A, 0x5B, 0x61, 0x5F,
-    0x64, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x9F, 0x9E, 0x9D, 0xB3, 0xB2, 0xB1, 0xDC, 0xDB, 0xD9,
-    0x0F, 0x02, 0x01, 0x2E, 0x26, 0x1A, 0x3C, 0x25, 0x10, 0x53, 0x32, 0x12, 0x89, 0x56, 0x32, 0xA4,
-    0x68, 0x3C, 0x85, 0x5A, 0x39, 0x54, 0x39, 0x1D, 0x34, 0x26, 0x12, 0x35, 0x26, 0x17, 0x22, 0x15,
-    0x09, 0x24, 0x0E, 0x13, 0x22, 0x15, 0x09, 0x21, 0x16, 0x0F, 0x36, 0x29, 0x13, 0x34, 0x26, 0x12,
-    0x28, 0x26, 0x20, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x05,
-    0x05, 0x08, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x3C, 0x25,
-    0x10, 0x47, 0x2F, 0x20, 0x4D, 0x36, 0x21, 0x4E, 0x34, 0x1A, 0x4D, 0x36, 0x21, 0x49, 0x38, 0x29,
-    0x58, 0x48, 0x38, 0x1E, 0x01, 0x01, 0x47, 0x2F, 0x20, 0x55, 0x35, 0x19, 0x4E, 0x34, 0x1A, 0x55,
-    0x35, 0x19, 0x46, 0x2E, 0x19, 0x4E, 0x34, 0x1A, 0x54, 0x39, 0x1D, 0x4E, 0x34, 0x1A, 0x54, 0x39,
-    0x1D, 0x54, 0x39, 0x1D, 0x4D, 0x36, 0x21, 0x4D, 0x36, 0x21, 0x4D, 0x36, 0x21, 0x4D, 0x36, 0x21,
-    0x47, 0x2F, 0x20, 0x55, 0x35, 0x19, 0x4D, 0x36, 0x21, 0x47, 0x2F, 0x20, 0x4D, 0x36, 0x21, 0x4D,
-    0x36, 0x21, 0x4D, 0x36, 0x21, 0x4E, 0x34, 0x1A, 0x55, 0x35, 0x19, 0x55, 0x35, 0x19, 0x4E, 0x34,
-    0x1A, 0x54, 0x39, 0x1D, 0x57, 0x3B, 0x23, 0x6B, 0x4D, 0x33, 0x6C, 0x47, 0x27, 0x6F, 0x44, 0x20,
-    0x72, 0x48, 0x22, 0x54, 0x39, 0x1D, 0x03, 0x01, 0x02, 0x2F, 0x2E, 0x30, 0x32, 0x33, 0x32, 0x3D,
-    0x3D, 0x3B, 0x57, 0x56, 0x54, 0x3E, 0x3E, 0x3F, 0x23, 0x22, 0x1B, 0x20, 0x1D, 0x19, 0x23, 0x22,
-    0x1B, 0x43, 0x43, 0x39, 0x5C, 0x5C, 0x55, 0x96, 0x95, 0x94, 0x9F, 0x9E, 0x9D, 0x96, 0x95, 0x94,
-    0x96, 0x95, 0x94, 0x5B, 0x5A, 0x5B, 0x3D, 0x3D, 0x3B, 0x32, 0x33, 0x32, 0x5F, 0x5E, 0x5D, 0x03,
-    0x01, 0x02, 0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x3A, 0x3E, 0x3E,
-    0x3F, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x37, 0x36, 0x34, 0x5F, 0x5E, 0x5D, 0x9A, 0x9A, 0x9A,
-    0x38, 0x39, 0x35, 0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x36, 0x20, 0x1D, 0x19, 0x1C, 0x1A, 0x13, 0x3E,
-    0x3E, 0x36, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x1C, 0x1A, 0x13, 0x3E, 0x3E, 0x36, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x3E, 0x3E, 0x36, 0x5C, 0x5C, 0x55, 0x05, 0x06, 0x03, 0x05, 0x05, 0x08,
-    0x39, 0x39, 0x3A, 0x35, 0x34, 0x3A, 0x5F, 0x5E, 0x5D, 0x63, 0x62, 0x61, 0x27, 0x26, 0x28, 0x44,
-    0x43, 0x43, 0x5F, 0x5E, 0x5D, 0x37, 0x36, 0x34, 0x5F, 0x5E, 0x5D, 0x63, 0x62, 0x61, 0x61, 0x5F,
-    0x64, 0x5B, 0x5A, 0x5B, 0x7E, 0x7E, 0x7D, 0x97, 0x96, 0x99, 0xBA, 0xB6, 0xB1, 0xD8, 0xD6, 0xD2,
-    0x03, 0x01, 0x02, 0x2E, 0x26, 0x1A, 0x34, 0x26, 0x12, 0x4E, 0x34, 0x1A, 0x89, 0x56, 0x32, 0xAC,
-    0x72, 0x49, 0x88, 0x5A, 0x33, 0x55, 0x35, 0x19, 0x34, 0x26, 0x12, 0x35, 0x26, 0x17, 0x22, 0x15,
-    0x09, 0x24, 0x0E, 0x13, 0x24, 0x0E, 0x13, 0x24, 0x1B, 0x0C, 0x36, 0x29, 0x13, 0x35, 0x26, 0x17,
-    0x35, 0x26, 0x1F, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x31, 0x22,
-    0x12, 0x66, 0x48, 0x33, 0x68, 0x48, 0x2D, 0x61, 0x45, 0x2B, 0x68, 0x48, 0x2D, 0x61, 0x45, 0x2B,
-    0x54, 0x44, 0x36, 0x1E, 0x01, 0x01, 0x61, 0x45, 0x2B, 0x54, 0x39, 0x1D, 0x55, 0x35, 0x19, 0x54,
-    0x39, 0x1D, 0x55, 0x35, 0x19, 0x55, 0x35, 0x19, 0x4E, 0x34, 0x1A, 0x4E, 0x34, 0x1A, 0x54, 0x39,
-    0x1D, 0x55, 0x35, 0x19, 0x4E, 0x34, 0x1A, 0x54, 0x39, 0x1D, 0x55, 0x35, 0x19, 0x55, 0x35, 0x19,
-    0x55, 0x35, 0x19, 0x47, 0x2F, 0x20, 0x55, 0x35, 0x19, 0x4E, 0x34, 0x1A, 0x53, 0x32, 0x12, 0x53,
-    0x32, 0x12, 0x53, 0x32, 0x12, 0x53, 0x32, 0x12, 0x53, 0x32, 0x12, 0x53, 0x32, 0x12, 0x68, 0x48,
-    0x2D, 0x68, 0x48, 0x2D, 0x7B, 0x5A, 0x3A, 0x61, 0x45, 0x2B, 0x53, 0x32, 0x12, 0x57, 0x3B, 0x23,
-    0x53, 0x32, 0x12, 0x4D, 0x36, 0x21, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28, 0x37, 0x36, 0x34, 0x44,
-    0x43, 0x43, 0x38, 0x39, 0x35, 0x38, 0x39, 0x35, 0x23, 0x22, 0x1B, 0x23, 0x22, 0x1B, 0x23, 0x22,
-    0x1B, 0x32, 0x32, 0x2D, 0x43, 0x43, 0x39, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D,
-    0x3E, 0x3E, 0x3F, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x3A, 0x38, 0x39, 0x35, 0x43, 0x43, 0x3F, 0x05,
-    0x06, 0x03, 0x32, 0x33, 0x32, 0x32, 0x33, 0x32, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x35, 0x34,
-    0x3A, 0x5B, 0x5A, 0x5B, 0x38, 0x39, 0x35, 0x39, 0x39, 0x3A, 0x43, 0x43, 0x3F, 0x39, 0x39, 0x3A,
-    0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x37, 0x36, 0x34, 0x34, 0x35, 0x2E, 0x44, 0x3F, 0x3B, 0x5F,
-    0x5E, 0x5D, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x1F, 0x1E, 0x1E, 0x5F, 0x5E, 0x5D, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x23, 0x22, 0x1B, 0x57, 0x57, 0x4C, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x37, 0x36, 0x34, 0x4C, 0x4B, 0x49, 0x39, 0x39, 0x3A, 0x61, 0x5F, 0x64, 0x1F, 0x1E, 0x1E, 0x2A,
-    0x2A, 0x29, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E, 0x3F, 0x3D, 0x3A, 0x35, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E,
-    0x3F, 0x7E, 0x7E, 0x7D, 0x9F, 0x9E, 0x9D, 0xB5, 0xB5, 0xB5, 0xD3, 0xD2, 0xD1, 0xD8, 0xD6, 0xD2,
-    0x03, 0x01, 0x02, 0x37, 0x2C, 0x21, 0x3A, 0x2D, 0x1C, 0x53, 0x32, 0x12, 0x83, 0x51, 0x2C, 0xAC,
-    0x72, 0x49, 0x83, 0x51, 0x2C, 0x53, 0x32, 0x12, 0x36, 0x29, 0x13, 0x38, 0x29, 0x18, 0x22, 0x15,
-    0x09, 0x2B, 0x15, 0x13, 0x22, 0x13, 0x04, 0x30, 0x1F, 0x18, 0x34, 0x26, 0x12, 0x3A, 0x2D, 0x1C,
-    0x28, 0x26, 0x20, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x3A, 0x2D,
-    0x1C, 0x99, 0x74, 0x56, 0x7B, 0x5A, 0x3A, 0x72, 0x48, 0x22, 0x61, 0x45, 0x2B, 0x6C, 0x47, 0x27,
-    0x6B, 0x4D, 0x33, 0x1E, 0x01, 0x01, 0x6C, 0x4B, 0x2D, 0x61, 0x3E, 0x22, 0x55, 0x35, 0x19, 0x61,
-    0x3E, 0x22, 0x55, 0x35, 0x19, 0x54, 0x39, 0x1D, 0x53, 0x32, 0x12, 0x54, 0x39, 0x1D, 0x4E, 0x34,
-    0x1A, 0x53, 0x32, 0x12, 0x55, 0x35, 0x19, 0x54, 0x39, 0x1D, 0x54, 0x39, 0x1D, 0x61, 0x3E, 0x22,
-    0x5F, 0x3E, 0x27, 0x68, 0x48, 0x2D, 0x6C, 0x47, 0x27, 0x72, 0x48, 0x22, 0x6F, 0x42, 0x1C, 0x72,
-    0x48, 0x22, 0x6F, 0x44, 0x20, 0x72, 0x48, 0x22, 0x72, 0x48, 0x22, 0x6C, 0x47, 0x27, 0x6F, 0x44,
-    0x20, 0x61, 0x45, 0x2B, 0x46, 0x2E, 0x19, 0x4E, 0x34, 0x1A, 0x4D, 0x36, 0x21, 0x4D, 0x36, 0x21,
-    0x46, 0x2E, 0x19, 0x49, 0x38, 0x29, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x39, 0x39, 0x3A, 0x32,
-    0x33, 0x32, 0x38, 0x39, 0x35, 0x32, 0x32, 0x2D, 0x22, 0x23, 0x22, 0x1C, 0x1A, 0x13, 0x38, 0x39,
-    0x35, 0x20, 0x1D, 0x19, 0x38, 0x39, 0x35, 0x37, 0x36, 0x34, 0x3D, 0x3D, 0x3B, 0x5F, 0x5E, 0x5D,
-    0x39, 0x39, 0x3A, 0x37, 0x36, 0x34, 0x32, 0x33, 0x32, 0x44, 0x43, 0x43, 0x37, 0x36, 0x34, 0x03,
-    0x01, 0x02, 0x32, 0x32, 0x2D, 0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x61, 0x5F, 0x64, 0x27, 0x26,
-    0x28, 0x44, 0x43, 0x43, 0x57, 0x56, 0x54, 0x3E, 0x3E, 0x3F, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E, 0x3F,
-    0x5F, 0x5E, 0x5D, 0x43, 0x43, 0x3F, 0x34, 0x35, 0x2E, 0x5F, 0x5E, 0x5D, 0x34, 0x35, 0x2E, 0x63,
-    0x62, 0x61, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x3D, 0x3D, 0x3B, 0x57, 0x57, 0x4C, 0x05, 0x06,
-    0x03, 0x03, 0x01, 0x02, 0x38, 0x39, 0x35, 0x63, 0x62, 0x5B, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08,
-    0x32, 0x33, 0x32, 0x32, 0x33, 0x32, 0x46, 0x45, 0x47, 0x9A, 0x9A, 0x9A, 0x65, 0x65, 0x66, 0x57,
-    0x56, 0x54, 0x37, 0x36, 0x34, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x3A, 0x5B, 0x5A, 0x5B, 0x83, 0x83,
-    0x82, 0xB3, 0xB2, 0xB1, 0xB9, 0xB8, 0xB8, 0xD8, 0xD6, 0xD2, 0xDC, 0xDB, 0xD9, 0x0F, 0x02, 0x01,
-    0x03, 0x01, 0x02, 0x2D, 0x2A, 0x23, 0x35, 0x26, 0x17, 0x4E, 0x34, 0x1A, 0x89, 0x56, 0x32, 0xAC,
-    0x72, 0x49, 0x88, 0x5A, 0x33, 0x53, 0x32, 0x12, 0x36, 0x29, 0x13, 0x34, 0x26, 0x12, 0x16, 0x0F,
-    0x09, 0x2B, 0x15, 0x13, 0x16, 0x0F, 0x09, 0x2D, 0x1E, 0x10, 0x31, 0x22, 0x12, 0x3A, 0x2D, 0x1C,
-    0x35, 0x26, 0x1F, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x3C, 0x1E,
-    0x06, 0x9B, 0x7B, 0x5A, 0x7B, 0x5A, 0x3A, 0x6C, 0x47, 0x27, 0x72, 0x48, 0x22, 0x6C, 0x47, 0x27,
-    0x7B, 0x5A, 0x3A, 0x1E, 0x01, 0x01, 0x6C, 0x47, 0x27, 0x68, 0x48, 0x2D, 0x68, 0x48, 0x2D, 0x6C,
-    0x4B, 0x2D, 0x5F, 0x3E, 0x27, 0x68, 0x48, 0x2D, 0x6C, 0x47, 0x27, 0x68, 0x48, 0x2D, 0x68, 0x48,
-    0x2D, 0x61, 0x45, 0x2B, 0x68, 0x48, 0x2D, 0x66, 0x48, 0x33, 0x6C, 0x4B, 0x2D, 0x61, 0x45, 0x2B,
-    0x66, 0x48, 0x33, 0x85, 0x5A, 0x39, 0x72, 0x48, 0x22, 0x86, 0x54, 0x2A, 0x85, 0x5A, 0x39, 0xA4,
-    0x77, 0x51, 0xA2, 0x71, 0x4B, 0xA4, 0x77, 0x51, 0x7E, 0x55, 0x32, 0x6C, 0x47, 0x27, 0x68, 0x48,
-    0x2D, 0x55, 0x35, 0x19, 0x4E, 0x34, 0x1A, 0x49, 0x38, 0x29, 0x4D, 0x36, 0x21, 0x42, 0x33, 0x22,
-    0x2D, 0x1E, 0x10, 0x3D, 0x36, 0x2C, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24, 0x37, 0x36, 0x34, 0x39,
-    0x39, 0x3A, 0x1F, 0x1E, 0x1E, 0x3E, 0x3E, 0x36, 0x38, 0x39, 0x35, 0x32, 0x33, 0x32, 0x38, 0x39,
-    0x35, 0x37, 0x36, 0x34, 0x34, 0x35, 0x2E, 0x3D, 0x3D, 0x3B, 0x43, 0x43, 0x3F, 0x39, 0x39, 0x3A,
-    0x3E, 0x3E, 0x3F, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x32, 0x32, 0x2D, 0x03,
-    0x01, 0x02, 0x27, 0x26, 0x24, 0x39, 0x39, 0x3A, 0x35, 0x34, 0x3A, 0x3E, 0x3E, 0x3F, 0x32, 0x33,
-    0x32, 0x35, 0x34, 0x3A, 0x3E, 0x3E, 0x3F, 0x65, 0x65, 0x66, 0x2F, 0x2E, 0x30, 0x38, 0x39, 0x35,
-    0x5B, 0x5A, 0x5B, 0x5F, 0x5E, 0x5D, 0x96, 0x95, 0x94, 0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0xD8,
-    0xD6, 0xD2, 0x5F, 0x5E, 0x5D, 0x61, 0x5F, 0x64, 0x1F, 0x1E, 0x1E, 0xDC, 0xDB, 0xD9, 0x96, 0x95,
-    0x94, 0x5F, 0x5E, 0x5D, 0x32, 0x33, 0x32, 0xDC, 0xDB, 0xD9, 0x5B, 0x5A, 0x5B, 0x5F, 0x5E, 0x5D,
-    0x39, 0x39, 0x3A, 0x3E, 0x3E, 0x3F, 0x35, 0x34, 0x3A, 0x39, 0x39, 0x3A, 0x3E, 0x3E, 0x3F, 0x3D,
-    0x3D, 0x3B, 0x32, 0x32, 0x2D, 0x3D, 0x3D, 0x3B, 0x5F, 0x5E, 0x5D, 0x97, 0x96, 0x99, 0xFE, 0xFE,
-    0xFC, 0xE0, 0xDF, 0xDE, 0xD3, 0xD2, 0xD1, 0xD8, 0xD6, 0xD2, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x2E, 0x26, 0x1A, 0x38, 0x29, 0x18, 0x4E, 0x34, 0x1A, 0x83, 0x51, 0x2C, 0x97,
-    0x5B, 0x35, 0x86, 0x54, 0x2A, 0x53, 0x32, 0x12, 0x3C, 0x25, 0x10, 0x38, 0x29, 0x18, 0x21, 0x16,
-    0x0F, 0x2B, 0x15, 0x13, 0x1B, 0x14, 0x0A, 0x22, 0x13, 0x04, 0x34, 0x26, 0x12, 0x34, 0x26, 0x12,
-    0x2D, 0x2A, 0x23, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x22, 0x13, 0x04, 0x34, 0x26,
-    0x12, 0x68, 0x48, 0x2D, 0x6C, 0x4B, 0x2D, 0x6C, 0x47, 0x27, 0x6C, 0x47, 0x27, 0x6C, 0x47, 0x27,
-    0x78, 0x59, 0x42, 0x1E, 0x01, 0x01, 0x66, 0x48, 0x33, 0x61, 0x45, 0x2B, 0x57, 0x3B, 0x23, 0x4E,
-    0x34, 0x1A, 0x4E, 0x34, 0x1A, 0x4E, 0x34, 0x1A, 0x4E, 0x34, 0x1A, 0x54, 0x39, 0x1D, 0x54, 0x39,
-    0x1D, 0x4E, 0x34, 0x1A, 0x57, 0x3B, 0x23, 0x46, 0x2E, 0x19, 0x55, 0x35, 0x19, 0x66, 0x48, 0x33,
-    0x68, 0x48, 0x2D, 0x66, 0x48, 0x33, 0x68, 0x48, 0x2D, 0x61, 0x45, 0x2B, 0x6C, 0x47, 0x27, 0x68,
-    0x48, 0x2D, 0x68, 0x48, 0x2D, 0x68, 0x48, 0x2D, 0x61, 0x45, 0x2B, 0x54, 0x39, 0x1D, 0x54, 0x39,
-    0x1D, 0x42, 0x33, 0x22, 0x41, 0x38, 0x23, 0x4D, 0x36, 0x21, 0x2C, 0x1A, 0x09, 0x30, 0x1D, 0x09,
-    0x2C, 0x1A, 0x09, 0x49, 0x38, 0x29, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x37, 0x36, 0x34, 0x44,
-    0x43, 0x43, 0x5B, 0x5A, 0x5B, 0x2A, 0x2A, 0x29, 0x2F, 0x2E, 0x30, 0x3D, 0x3D, 0x3B, 0x37, 0x36,
-    0x34, 0x32, 0x32, 0x2D, 0x3D, 0x3A, 0x35, 0x1C, 0x1A, 0x13, 0x20, 0x1D, 0x19, 0x23, 0x22, 0x1B,
-    0x28, 0x21, 0x11, 0x23, 0x22, 0x1B, 0x32, 0x32, 0x2D, 0x43, 0x43, 0x39, 0x37, 0x36, 0x34, 0x03,
-    0x01, 0x02, 0x22, 0x23, 0x22, 0x38, 0x39, 0x35, 0x39, 0x39, 0x3A, 0x32, 0x33, 0x32, 0x39, 0x39,
-    0x3A, 0x39, 0x39, 0x3A, 0x32, 0x33, 0x32, 0x5F, 0x5E, 0x5D, 0x37, 0x36, 0x34, 0x63, 0x62, 0x61,
-    0x32, 0x33, 0x32, 0x3E, 0x3E, 0x3F, 0x63, 0x62, 0x5B, 0x32, 0x33, 0x32, 0x32, 0x33, 0x32, 0x39,
-    0x39, 0x3A, 0x37, 0x36, 0x34, 0x32, 0x33, 0x32, 0x37, 0x36, 0x34, 0x32, 0x33, 0x32, 0x3D, 0x3D,
-    0x3B, 0x61, 0x5F, 0x64, 0x38, 0x39, 0x35, 0x3E, 0x3E, 0x3F, 0x38, 0x39, 0x35, 0x35, 0x34, 0x3A,
-    0x32, 0x33, 0x32, 0x63, 0x62, 0x61, 0x39, 0x39, 0x3A, 0x2F, 0x2E, 0x30, 0x3E, 0x3E, 0x3F, 0x39,
-    0x39, 0x3A, 0x37, 0x36, 0x34, 0x44, 0x43, 0x43, 0x63, 0x62, 0x61, 0x90, 0x8F, 0x8E, 0xFE, 0xFE,
-    0xFC, 0xDC, 0xDB, 0xD9, 0xDC, 0xDB, 0xD9, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x35, 0x26, 0x1F, 0x35, 0x26, 0x17, 0x4E, 0x34, 0x1A, 0x88, 0x5A, 0x33, 0xAC,
-    0x72, 0x49, 0x88, 0x5A, 0x33, 0x53, 0x32, 0x12, 0x3F, 0x23, 0x08, 0x2D, 0x29, 0x1A, 0x1C, 0x1A,
-    0x13, 0x1C, 0x1A, 0x13, 0x1C, 0x12, 0x04, 0x2C, 0x1A, 0x09, 0x34, 0x26, 0x12, 0x35, 0x26, 0x17,
-    0x37, 0x2A, 0x1C, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x1C, 0x12, 0x04, 0x1C, 0x12, 0x04, 0x34, 0x26,
-    0x12, 0x66, 0x48, 0x33, 0x6C, 0x4B, 0x2D, 0x66, 0x48, 0x33, 0x68, 0x48, 0x2D, 0x61, 0x45, 0x2B,
-    0x7A, 0x56, 0x3A, 0x1E, 0x01, 0x01, 0x61, 0x45, 0x2B, 0x49, 0x38, 0x29, 0x46, 0x2E, 0x19, 0x4E,
-    0x34, 0x1A, 0x4D, 0x36, 0x21, 0x4F, 0x3A, 0x23, 0x4D, 0x36, 0x21, 0x4D, 0x36, 0x21, 0x4D, 0x36,
-    0x21, 0x4E, 0x34, 0x1A, 0x4D, 0x36, 0x21, 0x4D, 0x36, 0x21, 0x4E, 0x34, 0x1A, 0x4D, 0x36, 0x21,
-    0x4D, 0x36, 0x21, 0x4D, 0x36, 0x21, 0x4E, 0x34, 0x1A, 0x4E, 0x34, 0x1A, 0x4E, 0x34, 0x1A, 0x4E,
-    0x34, 0x1A, 0x4E, 0x34, 0x1A, 0x4E, 0x34, 0x1A, 0x4D, 0x36, 0x21, 0x4E, 0x34, 0x1A, 0x42, 0x33,
-    0x22, 0x46, 0x2E, 0x19, 0x35, 0x26, 0x17, 0x2D, 0x1E, 0x10, 0x31, 0x22, 0x12, 0x2C, 0x1A, 0x09,
-    0x30, 0x1D, 0x09, 0x5B, 0x4D, 0x3F, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x38,
-    0x39, 0x35, 0x37, 0x36, 0x34, 0x3E, 0x3E, 0x3F, 0x39, 0x39, 0x3A, 0x32, 0x33, 0x32, 0x27, 0x26,
-    0x28, 0x22, 0x23, 0x22, 0x3D, 0x3D, 0x3B, 0x20, 0x1D, 0x19, 0x23, 0x22, 0x1B, 0x2B, 0x22, 0x18,
-    0x1C, 0x1A, 0x13, 0x23, 0x22, 0x1B, 0x2C, 0x2D, 0x24, 0x1C, 0x1A, 0x13, 0x38, 0x39, 0x35, 0x09,
-    0x0A, 0x03, 0x32, 0x33, 0x32, 0x1F, 0x1E, 0x1E, 0x37, 0x36, 0x34, 0x39, 0x39, 0x3A, 0x32, 0x33,
-    0x32, 0x39, 0x39, 0x3A, 0x37, 0x36, 0x34, 0x63, 0x62, 0x61, 0x9B, 0x9A, 0x95, 0x32, 0x33, 0x32,
-    0x03, 0x01, 0x02, 0x32, 0x33, 0x32, 0x5B, 0x5A, 0x5B, 0x3E, 0x3E, 0x3F, 0x44, 0x43, 0x43, 0x32,
-    0x33, 0x32, 0x39, 0x39, 0x3A, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x35, 0x34, 0x3A, 0x32, 0x33,
-    0x32, 0x3D, 0x3D, 0x3B, 0x37, 0x36, 0x34, 0x5F, 0x5E, 0x5D, 0x37, 0x36, 0x34, 0x2A, 0x2A, 0x29,
-    0x39, 0x39, 0x3A, 0x5F, 0x5E, 0x5D, 0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x2F, 0x2E, 0x2B, 0x3E,
-    0x3E, 0x3F, 0x65, 0x65, 0x66, 0x39, 0x39, 0x3A, 0x5B, 0x5A, 0x5B, 0x61, 0x5F, 0x64, 0x96, 0x95,
-    0x94, 0xBD, 0xBB, 0xBA, 0xD8, 0xD6, 0xD2, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x2B, 0x22, 0x18, 0x38, 0x29, 0x18, 0x55, 0x35, 0x19, 0x7E, 0x55, 0x32, 0x89,
-    0x56, 0x32, 0x89, 0x56, 0x32, 0x50, 0x2C, 0x0E, 0x3C, 0x25, 0x10, 0x35, 0x26, 0x1F, 0x19, 0x13,
-    0x0E, 0x1A, 0x16, 0x11, 0x21, 0x16, 0x0F, 0x31, 0x22, 0x12, 0x38, 0x29, 0x18, 0x38, 0x29, 0x18,
-    0x35, 0x26, 0x1F, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x05, 0x06, 0x03, 0x16, 0x0F, 0x09, 0x1B, 0x1A, 0x0B, 0x2C, 0x1A, 0x09, 0x36, 0x29,
-    0x13, 0x4F, 0x3A, 0x23, 0x46, 0x2E, 0x19, 0x4E, 0x34, 0x1A, 0x4D, 0x36, 0x21, 0x57, 0x3B, 0x23,
-    0x6B, 0x4D, 0x33, 0x0F, 0x02, 0x01, 0x4D, 0x36, 0x21, 0x3E, 0x2A, 0x12, 0x3C, 0x25, 0x10, 0x34,
-    0x26, 0x12, 0x3C, 0x25, 0x10, 0x34, 0x26, 0x12, 0x34, 0x26, 0x12, 0x30, 0x1D, 0x09, 0x36, 0x29,
-    0x13, 0x3C, 0x25, 0x10, 0x36, 0x29, 0x13, 0x3E, 0x2A, 0x12, 0x35, 0x26, 0x17, 0x3C, 0x25, 0x10,
-    0x30, 0x1D, 0x09, 0x3C, 0x25, 0x10, 0x3C, 0x25, 0x10, 0x3C, 0x25, 0x10, 0x34, 0x26, 0x12, 0x3F,
-    0x23, 0x08, 0x3C, 0x25, 0x10, 0x3F, 0x23, 0x08, 0x3C, 0x25, 0x10, 0x38, 0x29, 0x18, 0x31, 0x22,
-    0x12, 0x31, 0x22, 0x12, 0x22, 0x13, 0x04, 0x2C, 0x1A, 0x09, 0x22, 0x13, 0x04, 0x2D, 0x1E, 0x10,
-    0x2C, 0x1A, 0x09, 0x5B, 0x4D, 0x3F, 0x05, 0x06, 0x03, 0x27, 0x26, 0x24, 0x28, 0x29, 0x23, 0x22,
-    0x23, 0x22, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x39, 0x39, 0x3A, 0x27, 0x26,
-    0x28, 0x2F, 0x2E, 0x2B, 0x1C, 0x1A, 0x13, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20, 0x23, 0x22, 0x1B,
-    0x3E, 0x3A, 0x2D, 0x28, 0x26, 0x20, 0x20, 0x1D, 0x19, 0x2A, 0x2A, 0x29, 0x32, 0x33, 0x32, 0x03,
-    0x01, 0x02, 0x5F, 0x5E, 0x5D, 0x2F, 0x2E, 0x30, 0x27, 0x26, 0x28, 0x1F, 0x1E, 0x1E, 0x2A, 0x2A,
-    0x29, 0x3E, 0x3E, 0x3F, 0x65, 0x65, 0x66, 0x5B, 0x5A, 0x5B, 0x96, 0x95, 0x94, 0x38, 0x39, 0x35,
-    0x2A, 0x2A, 0x29, 0x37, 0x36, 0x34, 0x5B, 0x5A, 0x5B, 0x6A, 0x6A, 0x69, 0x5F, 0x5E, 0x5D, 0x35,
-    0x34, 0x3A, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x27, 0x26,
-    0x28, 0x32, 0x33, 0x32, 0x2A, 0x2A, 0x29, 0x35, 0x34, 0x3A, 0x5F, 0x5E, 0x5D, 0x39, 0x39, 0x3A,
-    0x39, 0x39, 0x3A, 0x5F, 0x5E, 0x5D, 0x27, 0x26, 0x28, 0x32, 0x33, 0x32, 0x44, 0x43, 0x43, 0x5B,
-    0x5A, 0x5B, 0x3E, 0x3E, 0x3F, 0x39, 0x39, 0x3A, 0x3D, 0x3D, 0x3B, 0x43, 0x43, 0x3F, 0x5F, 0x5E,
-    0x5D, 0x96, 0x95, 0x94, 0xB3, 0xB2, 0xB1, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02,
-    0x0A, 0x0A, 0x09, 0x2A, 0x2A, 0x29, 0x3C, 0x25, 0x10, 0x47, 0x2F, 0x20, 0x89, 0x56, 0x32, 0xAC,
-    0x72, 0x49, 0x89, 0x56, 0x32, 0x55, 0x35, 0x19, 0x35, 0x26, 0x17, 0x30, 0x1F, 0x18, 0x1D, 0x18,
-    0x18, 0x1D, 0x18, 0x18, 0x21, 0x16, 0x0F, 0x24, 0x1A, 0x11, 0x30, 0x1F, 0x18, 0x35, 0x26, 0x1F,
-    0x2D, 0x2A, 0x23, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x19,
-    0x13, 0x0E, 0x19, 0x13, 0x0E, 0x1A, 0x16, 0x11, 0x1B, 0x14, 0x0A, 0x1B, 0x1A, 0x0B, 0x38, 0x29,
-    0x18, 0x49, 0x38, 0x29, 0x4D, 0x36, 0x21, 0x46, 0x2E, 0x19, 0x31, 0x22, 0x12, 0x2D, 0x1E, 0x10,
-    0x54, 0x44, 0x36, 0x1E, 0x01, 0x01, 0x37, 0x2A, 0x1C, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x35,
-    0x26, 0x17, 0x31, 0x22, 0x12, 0x34, 0x26, 0x12, 0x38, 0x29, 0x18, 0x28, 0x21, 0x11, 0x34, 0x26,
-    0x12, 0x2D, 0x1E, 0x10, 0x31, 0x22, 0x12, 0x34, 0x26, 0x12, 0x35, 0x26, 0x17, 0x28, 0x21, 0x11,
-    0x31, 0x22, 0x12, 0x38, 0x29, 0x18, 0x36, 0x29, 0x13, 0x38, 0x29, 0x18, 0x34, 0x26, 0x12, 0x36,
-    0x29, 0x13, 0x36, 0x29, 0x13, 0x36, 0x29, 0x13, 0x28, 0x21, 0x11, 0x36, 0x29, 0x13, 0x22, 0x15,
-    0x09, 0x24, 0x1B, 0x0C, 0x22, 0x15, 0x09, 0x2B, 0x22, 0x18, 0x1C, 0x0E, 0x02, 0x2C, 0x1A, 0x09,
-    0x2C, 0x1A, 0x09, 0x49, 0x38, 0x29, 0x03, 0x01, 0x02, 0x2C, 0x2D, 0x24, 0x22, 0x23, 0x22, 0x23,
-    0x22, 0x1B, 0x27, 0x26, 0x28, 0x39, 0x39, 0x3A, 0x27, 0x26, 0x28, 0x2F, 0x2E, 0x30, 0x5B, 0x5A,
-    0x5B, 0x22, 0x23, 0x22, 0x3D, 0x3D, 0x3B, 0x27, 0x26, 0x24, 0x2D, 0x2A, 0x23, 0x28, 0x26, 0x20,
-    0x39, 0x33, 0x2C, 0x63, 0x62, 0x5B, 0x3D, 0x3A, 0x35, 0x27, 0x26, 0x24, 0x2F, 0x2E, 0x2B, 0x03,
-    0x01, 0x02, 0x44, 0x43, 0x43, 0x5B, 0x5A, 0x5B, 0x22, 0x23, 0x22, 0x2F, 0x2E, 0x30, 0x35, 0x34,
-    0x3A, 0x35, 0x34, 0x3A, 0x3E, 0x3E, 0x3F, 0x3D, 0x3D, 0x3B, 0x9F, 0x9E, 0x9D, 0xFE, 0xFE, 0xFC,
-    0x3D, 0x3D, 0x3B, 0x5C, 0x5C, 0x55, 0x3E, 0x3E, 0x3F, 0x39, 0x39, 0x3A, 0x22, 0x23, 0x22, 0x4C,
-    0x4B, 0x49, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x32, 0x33, 0x32, 0x27, 0x26,
-    0x28, 0x27, 0x26, 0x28, 0x32, 0x33, 0x32, 0x37, 0x36, 0x34, 0x3E, 0x3E, 0x3F, 0x6A, 0x6A, 0x69,
-    0x32, 0x33, 0x32, 0x63, 0x62, 0x61, 0x32, 0x33, 0x32, 0x3E, 0x3E, 0x3F, 0x5F, 0x5E, 0x5D, 0x44,
-    0x43, 0x43, 0x2F, 0x2E, 0x30, 0x27, 0x26, 0x28, 0x2F, 0x2E, 0x30, 0x39, 0x39, 0x3A, 0x4C, 0x4B,
-    0x49, 0x5C, 0x5C, 0x55, 0x9F, 0x9E, 0x9D, 0xB3, 0xB2, 0xB1, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03,
-    0x03, 0x01, 0x02, 0x2E, 0x26, 0x1A, 0x35, 0x26, 0x17, 0x55, 0x35, 0x19, 0x85, 0x5A, 0x39, 0x88,
-    0x5A, 0x33, 0x85, 0x5A, 0x39, 0x50, 0x2C, 0x0E, 0x3C, 0x1E, 0x06, 0x37, 0x2C, 0x21, 0x19, 0x13,
-    0x0E, 0x1A, 0x16, 0x11, 0x21, 0x16, 0x0F, 0x26, 0x1E, 0x12, 0x35, 0x26, 0x1F, 0x35, 0x26, 0x1F,
-    0x27, 0x26, 0x24, 0x03, 0x01, 0x02, 0x16, 0x0F, 0x09, 0x19, 0x13, 0x0E, 0x19, 0x13, 0x0E, 0x24,
-    0x1A, 0x11, 0x1C, 0x1A, 0x13, 0x26, 0x1E, 0x12, 0x22, 0x15, 0x09, 0x21, 0x16, 0x0F, 0x2D, 0x1E,
-    0x10, 0x2D, 0x1E, 0x10, 0x2C, 0x1A, 0x09, 0x2C, 0x1A, 0x09, 0x2D, 0x1E, 0x10, 0x30, 0x1F, 0x18,
-    0x51, 0x48, 0x41, 0x0F, 0x02, 0x01, 0x2D, 0x1E, 0x10, 0x24, 0x1B, 0x0C, 0x30, 0x1D, 0x09, 0x24,
-    0x1B, 0x0C, 0x2C, 0x1A, 0x09, 0x24, 0x1B, 0x0C, 0x22, 0x26, 0x11, 0x30, 0x1D, 0x09, 0x28, 0x21,
-    0x11, 0x28, 0x21, 0x11, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x35, 0x26, 0x17, 0x34, 0x26, 0x12,
-    0x35, 0x26, 0x17, 0x2D, 0x29, 0x1A, 0x28, 0x21, 0x11, 0x22, 0x26, 0x11, 0x30, 0x1D, 0x09, 0x28,
-    0x21, 0x11, 0x22, 0x26, 0x11, 0x30, 0x1D, 0x09, 0x22, 0x13, 0x04, 0x24, 0x1B, 0x0C, 0x22, 0x13,
-    0x04, 0x1B, 0x14, 0x0A, 0x2E, 0x26, 0x1A, 0x30, 0x1F, 0x18, 0x2D, 0x1E, 0x10, 0x22, 0x13, 0x04,
-    0x30, 0x1F, 0x18, 0x3D, 0x36, 0x2C, 0x05, 0x06, 0x03, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x2A,
-    0x2A, 0x29, 0x22, 0x23, 0x22, 0x35, 0x34, 0x3A, 0x2F, 0x2E, 0x30, 0x2F, 0x2E, 0x30, 0x39, 0x39,
-    0x3A, 0x35, 0x34, 0x3A, 0x37, 0x36, 0x34, 0x32, 0x32, 0x2D, 0x28, 0x26, 0x20, 0x38, 0x39, 0x35,
-    0x32, 0x32, 0x2D, 0x28, 0x26, 0x20, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x1F, 0x1E, 0x1E, 0x03,
-    0x01, 0x02, 0x27, 0x26, 0x28, 0x65, 0x65, 0x66, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x2A, 0x2A,
-    0x29, 0x1F, 0x1E, 0x1E, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x3A, 0x57, 0x56, 0x54, 0x96, 0x95, 0x94,
-    0x97, 0x96, 0x99, 0x5F, 0x5E, 0x5D, 0x63, 0x62, 0x61, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x27,
-    0x26, 0x28, 0x2A, 0x2A, 0x29, 0x1F, 0x1E, 0x1E, 0x2F, 0x2E, 0x2B, 0x5F, 0x5E, 0x5D, 0x27, 0x26,
-    0x28, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x1F, 0x1E, 0x1E, 0x35, 0x34, 0x3A, 0x32, 0x33, 0x32,
-    0x63, 0x62, 0x61, 0x63, 0x62, 0x61, 0x63, 0x62, 0x61, 0x97, 0x96, 0x99, 0x44, 0x43, 0x43, 0x32,
-    0x33, 0x32, 0x2A, 0x2A, 0x29, 0x1F, 0x1E, 0x1E, 0x28, 0x26, 0x20, 0x5F, 0x5E, 0x5D, 0x32, 0x33,
-    0x32, 0x44, 0x43, 0x43, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0xBD, 0xBB, 0xBA, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x2D, 0x2A, 0x23, 0x3E, 0x2A, 0x12, 0x53, 0x32, 0x12, 0x74, 0x4C, 0x28, 0xA4,
-    0x77, 0x51, 0x89, 0x50, 0x24, 0x54, 0x39, 0x1D, 0x3F, 0x23, 0x08, 0x35, 0x26, 0x17, 0x21, 0x16,
-    0x0F, 0x1C, 0x1A, 0x13, 0x1C, 0x12, 0x04, 0x2D, 0x1E, 0x10, 0x35, 0x26, 0x17, 0x37, 0x2A, 0x1C,
-    0x35, 0x26, 0x1F, 0x03, 0x01, 0x02, 0x22, 0x15, 0x09, 0x2B, 0x15, 0x13, 0x1B, 0x14, 0x0A, 0x19,
-    0x13, 0x0E, 0x16, 0x0F, 0x09, 0x24, 0x1A, 0x11, 0x1B, 0x14, 0x0A, 0x1C, 0x12, 0x04, 0x24, 0x1A,
-    0x11, 0x24, 0x1B, 0x0C, 0x24, 0x1B, 0x0C, 0x22, 0x15, 0x09, 0x1C, 0x12, 0x04, 0x1B, 0x14, 0x0A,
-    0x4A, 0x38, 0x30, 0x03, 0x01, 0x02, 0x28, 0x21, 0x11, 0x1B, 0x1A, 0x0B, 0x1B, 0x1A, 0x0B, 0x24,
-    0x1B, 0x0C, 0x1B, 0x1A, 0x0B, 0x24, 0x1B, 0x0C, 0x26, 0x1E, 0x12, 0x1B, 0x1A, 0x0B, 0x1B, 0x1A,
-    0x0B, 0x1B, 0x1A, 0x0B, 0x1B, 0x1A, 0x0B, 0x1B, 0x1A, 0x0B, 0x24, 0x1B, 0x0C, 0x1B, 0x1A, 0x0B,
-    0x24, 0x1B, 0x0C, 0x1C, 0x12, 0x04, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x1B, 0x1A, 0x0B, 0x30,
-    0x1D, 0x09, 0x1B, 0x1A, 0x0B, 0x1C, 0x12, 0x04, 0x1B, 0x1A, 0x0B, 0x1B, 0x1A, 0x0B, 0x1B, 0x14,
-    0x0A, 0x26, 0x1E, 0x12, 0x30, 0x1F, 0x18, 0x24, 0x1A, 0x11, 0x2B, 0x22, 0x18, 0x22, 0x13, 0x04,
-    0x35, 0x26, 0x17, 0x5B, 0x4D, 0x3F, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x34, 0x35, 0x2E, 0x37,
-    0x36, 0x34, 0x3D, 0x3D, 0x3B, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x32, 0x33, 0x32, 0x42, 0x3D,
-    0x45, 0x39, 0x39, 0x3A, 0x3E, 0x3E, 0x3F, 0x38, 0x39, 0x35, 0x37, 0x36, 0x34, 0x23, 0x22, 0x1B,
-    0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0x22, 0x23, 0x22, 0x2F, 0x2E, 0x2B, 0x35, 0x34, 0x3A, 0x03,
-    0x01, 0x02, 0x27, 0x26, 0x28, 0x17, 0x18, 0x18, 0x39, 0x39, 0x3A, 0x27, 0x26, 0x24, 0x22, 0x23,
-    0x22, 0x42, 0x3D, 0x45, 0x39, 0x39, 0x3A, 0x2F, 0x2E, 0x30, 0x3E, 0x3E, 0x3F, 0x43, 0x43, 0x3F,
-    0x63, 0x62, 0x61, 0x32, 0x33, 0x32, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x27,
-    0x26, 0x28, 0x3E, 0x3E, 0x3F, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x1F, 0x1E, 0x1E, 0x27, 0x26,
-    0x24, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x39, 0x39, 0x3A, 0x3E, 0x3E, 0x3F,
-    0x3E, 0x3E, 0x3F, 0x96, 0x95, 0x94, 0x03, 0x01, 0x02, 0x5B, 0x5A, 0x5B, 0x38, 0x39, 0x35, 0x17,
-    0x18, 0x18, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x5F, 0x5E, 0x5D, 0x17, 0x18, 0x18, 0x28, 0x26,
-    0x20, 0x32, 0x33, 0x32, 0x4C, 0x4B, 0x49, 0x90, 0x8F, 0x8E, 0x9B, 0x9A, 0x95, 0x38, 0x39, 0x35,
-    0x03, 0x01, 0x02, 0x2E, 0x26, 0x1A, 0x30, 0x1D, 0x09, 0x54, 0x39, 0x1D, 0x86, 0x5E, 0x3C, 0xA2,
-    0x71, 0x4B, 0x86, 0x5E, 0x3C, 0x53, 0x32, 0x12, 0x3C, 0x1E, 0x06, 0x38, 0x29, 0x18, 0x1B, 0x1A,
-    0x0B, 0x21, 0x16, 0x0F, 0x1C, 0x0E, 0x02, 0x22, 0x15, 0x09, 0x28, 0x21, 0x11, 0x35, 0x26, 0x17,
-    0x2D, 0x29, 0x1A, 0x0F, 0x02, 0x01, 0x16, 0x0F, 0x09, 0x22, 0x15, 0x09, 0x22, 0x15, 0x09, 0x21,
-    0x16, 0x0F, 0x21, 0x16, 0x0F, 0x22, 0x15, 0x09, 0x21, 0x16, 0x0F, 0x22, 0x15, 0x09, 0x22, 0x13,
-    0x04, 0x1C, 0x0E, 0x02, 0x1C, 0x0E, 0x02, 0x2C, 0x1A, 0x09, 0x1B, 0x14, 0x0A, 0x2B, 0x22, 0x18,
-    0x3E, 0x3E, 0x36, 0x03, 0x01, 0x02, 0x22, 0x15, 0x09, 0x1B, 0x1A, 0x0B, 0x22, 0x15, 0x09, 0x1B,
-    0x1A, 0x0B, 0x1C, 0x1A, 0x13, 0x22, 0x26, 0x11, 0x2B, 0x22, 0x18, 0x24, 0x1B, 0x0C, 0x26, 0x1E,
-    0x12, 0x26, 0x1E, 0x12, 0x1B, 0x1A, 0x0B, 0x24, 0x1B, 0x0C, 0x26, 0x1E, 0x12, 0x1B, 0x14, 0x0A,
-    0x1B, 0x1A, 0x0B, 0x1B, 0x14, 0x0A, 0x1B, 0x1A, 0x0B, 0x1B, 0x1A, 0x0B, 0x1B, 0x1A, 0x0B, 0x1B,
-    0x1A, 0x0B, 0x1B, 0x14, 0x0A, 0x1C, 0x12, 0x04, 0x1B, 0x14, 0x0A, 0x1B, 0x14, 0x0A, 0x1B, 0x1A,
-    0x0B, 0x28, 0x21, 0x11, 0x1C, 0x1A, 0x13, 0x26, 0x1E, 0x12, 0x24, 0x1B, 0x0C, 0x2C, 0x1A, 0x09,
-    0x2D, 0x1E, 0x10, 0x5B, 0x4D, 0x3F, 0x03, 0x01, 0x02, 0x28, 0x29, 0x23, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x35, 0x34, 0x3A, 0x27, 0x26, 0x28, 0x39, 0x39, 0x3A, 0x03,
-    0x01, 0x02, 0x61, 0x5F, 0x64, 0x22, 0x23, 0x22, 0x2F, 0x2E, 0x30, 0x35, 0x34, 0x3A, 0x32, 0x33,
-    0x32, 0x37, 0x36, 0x34, 0x2F, 0x2E, 0x30, 0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0x37, 0x36, 0x34,
-    0x2F, 0x2E, 0x2B, 0x3D, 0x3D, 0x3B, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x2F, 0x2E, 0x2B, 0x5B,
-    0x5A, 0x5B, 0x63, 0x62, 0x61, 0x90, 0x8F, 0x8E, 0x2F, 0x2E, 0x30, 0x39, 0x39, 0x3A, 0x39, 0x39,
-    0x3A, 0x63, 0x62, 0x61, 0x2F, 0x2E, 0x30, 0x63, 0x62, 0x61, 0x5B, 0x5A, 0x5B, 0x5B, 0x5A, 0x5B,
-    0x9F, 0x9E, 0x9D, 0xFE, 0xFE, 0xFC, 0x97, 0x96, 0x99, 0x63, 0x62, 0x61, 0x22, 0x23, 0x22, 0x35,
-    0x34, 0x3A, 0x23, 0x22, 0x1B, 0x9A, 0x9A, 0x9A, 0x1F, 0x1E, 0x1E, 0x22, 0x23, 0x22, 0x37, 0x36,
-    0x34, 0x1D, 0x18, 0x18, 0x38, 0x39, 0x35, 0x63, 0x62, 0x61, 0x57, 0x56, 0x54, 0x9B, 0x9A, 0x95,
-    0x03, 0x01, 0x02, 0x2D, 0x2A, 0x23, 0x31, 0x22, 0x12, 0x54, 0x39, 0x1D, 0x7B, 0x5A, 0x3A, 0xA4,
-    0x77, 0x51, 0x7E, 0x55, 0x32, 0x54, 0x39, 0x1D, 0x34, 0x26, 0x12, 0x35, 0x26, 0x17, 0x22, 0x15,
-    0x09, 0x1B, 0x1A, 0x0B, 0x24, 0x1B, 0x0C, 0x31, 0x22, 0x12, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17,
-    0x2D, 0x29, 0x1A, 0x03, 0x01, 0x02, 0x35, 0x26, 0x1F, 0x35, 0x26, 0x1F, 0x39, 0x33, 0x2C, 0x4A,
-    0x38, 0x30, 0x3E, 0x3A, 0x2D, 0x35, 0x26, 0x1F, 0x2B, 0x22, 0x18, 0x35, 0x26, 0x1F, 0x37, 0x2A,
-    0x1C, 0x49, 0x38, 0x29, 0x4B, 0x3D, 0x2C, 0x51, 0x48, 0x41, 0x35, 0x26, 0x17, 0x37, 0x2C, 0x21,
-    0x4A, 0x38, 0x30, 0x03, 0x01, 0x02, 0x24, 0x1A, 0x11, 0x28, 0x21, 0x11, 0x2B, 0x22, 0x18, 0x28,
-    0x21, 0x11, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x28, 0x21,
-    0x11, 0x28, 0x21, 0x11, 0x1C, 0x1A, 0x13, 0x2B, 0x22, 0x18, 0x28, 0x21, 0x11, 0x1B, 0x1A, 0x0B,
-    0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x1C, 0x1A, 0x13, 0x28, 0x21, 0x11, 0x28,
-    0x21, 0x11, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x2B, 0x22, 0x18, 0x1B, 0x1A, 0x0B, 0x1A, 0x16,
-    0x11, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x23, 0x22, 0x1B, 0x24, 0x1B, 0x0C, 0x2C, 0x1A, 0x09,
-    0x38, 0x29, 0x18, 0x3D, 0x36, 0x2C, 0x03, 0x01, 0x02, 0x23, 0x22, 0x1B, 0x20, 0x1D, 0x19, 0x2A,
-    0x2A, 0x29, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x22, 0x23,
-    0x22, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24,
-    0x1F, 0x1E, 0x1E, 0x1F, 0x1E, 0x1E, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x39, 0x39, 0x3A, 0x03,
-    0x01, 0x02, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x5B, 0x5A, 0x5B, 0x5F, 0x5E, 0x5D, 0x39, 0x39,
-    0x3A, 0x37, 0x36, 0x34, 0x2A, 0x2A, 0x29, 0x32, 0x33, 0x32, 0x38, 0x39, 0x35, 0x32, 0x33, 0x32,
-    0x5F, 0x5E, 0x5D, 0x5C, 0x5C, 0x55, 0x39, 0x39, 0x3A, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x39,
-    0x39, 0x3A, 0x3D, 0x3D, 0x3B, 0x44, 0x43, 0x43, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x32, 0x33,
-    0x32, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x35, 0x34, 0x3A, 0x37, 0x36, 0x34, 0x44, 0x43, 0x43,
-    0x39, 0x39, 0x3A, 0x9A, 0x9A, 0x9A, 0x5F, 0x5E, 0x5D, 0x27, 0x26, 0x28, 0x32, 0x33, 0x32, 0x63,
-    0x62, 0x61, 0x27, 0x26, 0x24, 0x5F, 0x5E, 0x5D, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x5F, 0x5E,
-    0x5D, 0x37, 0x36, 0x34, 0x39, 0x39, 0x3A, 0x5F, 0x5E, 0x5D, 0x3D, 0x3A, 0x35, 0x95, 0x93, 0x8D,
-    0x5F, 0x5E, 0x5D, 0x2D, 0x2A, 0x23, 0x38, 0x29, 0x18, 0x31, 0x22, 0x12, 0x3C, 0x25, 0x10, 0x3F,
-    0x23, 0x08, 0x3C, 0x25, 0x10, 0x3F, 0x23, 0x08, 0x31, 0x22, 0x12, 0x2E, 0x26, 0x1A, 0x28, 0x29,
-    0x23, 0x2D, 0x2A, 0x23, 0x2E, 0x26, 0x1A, 0x37, 0x2A, 0x1C, 0x37, 0x2A, 0x1C, 0x2E, 0x26, 0x1A,
-    0x2E, 0x26, 0x1A, 0x03, 0x01, 0x02, 0x22, 0x15, 0x09, 0x22, 0x15, 0x09, 0x22, 0x15, 0x09, 0x21,
-    0x16, 0x0F, 0x21, 0x16, 0x0F, 0x1B, 0x14, 0x0A, 0x21, 0x16, 0x0F, 0x22, 0x15, 0x09, 0x35, 0x26,
-    0x17, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x3C, 0x25, 0x10, 0x49, 0x38, 0x29, 0x38, 0x29, 0x18,
-    0x49, 0x38, 0x29, 0x0F, 0x02, 0x01, 0x2D, 0x29, 0x1A, 0x26, 0x1E, 0x12, 0x24, 0x1B, 0x0C, 0x26,
-    0x1E, 0x12, 0x2E, 0x26, 0x1A, 0x31, 0x22, 0x12, 0x2B, 0x22, 0x18, 0x37, 0x2A, 0x1C, 0x26, 0x1E,
-    0x12, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x28, 0x21, 0x11, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12,
-    0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x35, 0x26, 0x17, 0x26, 0x1E, 0x12, 0x37, 0x2A, 0x1C, 0x26,
-    0x1E, 0x12, 0x2D, 0x1E, 0x10, 0x28, 0x21, 0x11, 0x1B, 0x14, 0x0A, 0x22, 0x15, 0x09, 0x1B, 0x1A,
-    0x0B, 0x1C, 0x1A, 0x13, 0x28, 0x21, 0x11, 0x28, 0x21, 0x11, 0x24, 0x1B, 0x0C, 0x22, 0x13, 0x04,
-    0x34, 0x26, 0x12, 0x41, 0x38, 0x23, 0x03, 0x01, 0x02, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x5F,
-    0x5E, 0x5D, 0x96, 0x95, 0x94, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x2A, 0x2A,
-    0x29, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x21, 0x1E, 0x26, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28,
-    0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28, 0x39, 0x39, 0x3A, 0x03,
-    0x01, 0x02, 0x39, 0x39, 0x3A, 0x35, 0x34, 0x3A, 0x37, 0x36, 0x34, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A,
-    0x2A, 0x29, 0x3E, 0x3E, 0x3F, 0x3D, 0x3D, 0x3B, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x39, 0x39, 0x3A, 0x32, 0x33, 0x32, 0x32, 0x33, 0x32, 0x27, 0x26, 0x24,
-    0x2A, 0x2A, 0x29, 0x5B, 0x5A, 0x5B, 0x27, 0x26, 0x24, 0x5B, 0x5A, 0x5B, 0x9A, 0x9A, 0x9A, 0xFE,
-    0xFE, 0xFC, 0x5C, 0x5C, 0x55, 0x2A, 0x2A, 0x29, 0x96, 0x95, 0x94, 0x03, 0x01, 0x02, 0x63, 0x62,
-    0x61, 0x27, 0x26, 0x24, 0x28, 0x29, 0x23, 0x38, 0x39, 0x35, 0x43, 0x43, 0x3F, 0x63, 0x62, 0x5B,
-    0x5F, 0x5E, 0x5D, 0x28, 0x26, 0x20, 0x27, 0x26, 0x24, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x03,
-    0x01, 0x02, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x21, 0x16, 0x0F, 0x1B, 0x14, 0x0A, 0x1B, 0x14, 0x0A, 0x22,
-    0x15, 0x09, 0x1B, 0x14, 0x0A, 0x21, 0x16, 0x0F, 0x22, 0x15, 0x09, 0x22, 0x15, 0x09, 0x38, 0x29,
-    0x18, 0x38, 0x29, 0x18, 0x3C, 0x25, 0x10, 0x38, 0x29, 0x18, 0x22, 0x13, 0x04, 0x2D, 0x1E, 0x10,
-    0x49, 0x38, 0x29, 0x0F, 0x02, 0x01, 0x28, 0x21, 0x11, 0x31, 0x22, 0x12, 0x37, 0x2A, 0x1C, 0x2B,
-    0x22, 0x18, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x2D, 0x1E, 0x10, 0x35, 0x26,
-    0x17, 0x35, 0x26, 0x1F, 0x35, 0x26, 0x17, 0x2D, 0x1E, 0x10, 0x2D, 0x1E, 0x10, 0x35, 0x26, 0x17,
-    0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x30, 0x1F, 0x18, 0x26, 0x1E, 0x12, 0x2B, 0x22, 0x18, 0x2D,
-    0x1E, 0x10, 0x24, 0x1A, 0x11, 0x2D, 0x1E, 0x10, 0x22, 0x15, 0x09, 0x1B, 0x1A, 0x0B, 0x22, 0x15,
-    0x09, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x23, 0x22, 0x1B, 0x24, 0x1B, 0x0C, 0x1B, 0x1A, 0x0B,
-    0x36, 0x29, 0x13, 0x41, 0x38, 0x23, 0x03, 0x01, 0x02, 0x28, 0x26, 0x20, 0x27, 0x26, 0x24, 0x63,
-    0x62, 0x61, 0x63, 0x62, 0x61, 0x1F, 0x1E, 0x1E, 0x2F, 0x2E, 0x2B, 0x5B, 0x5A, 0x5B, 0x5F, 0x5E,
-    0x5D, 0x90, 0x8F, 0x8E, 0x5F, 0x5E, 0x5D, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x5F, 0x5E, 0x5D,
-    0x2F, 0x2E, 0x30, 0x27, 0x26, 0x24, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28, 0x44, 0x43, 0x43, 0x03,
-    0x01, 0x02, 0x5B, 0x5A, 0x5B, 0x37, 0x36, 0x34, 0x32, 0x33, 0x32, 0x05, 0x06, 0x03, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x09, 0x0A, 0x03, 0x03, 0x01, 0x02,
-    0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x2F, 0x2E, 0x30, 0x3D, 0x3D, 0x3B, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28,
-    0x27, 0x26, 0x28, 0x3E, 0x3E, 0x3F, 0x32, 0x33, 0x32, 0x63, 0x62, 0x5B, 0x96, 0x95, 0x94, 0x9B,
-    0x9A, 0x95, 0x61, 0x5F, 0x64, 0x96, 0x95, 0x94, 0xFE, 0xFE, 0xFC, 0x96, 0x95, 0x94, 0x57, 0x56,
-    0x54, 0x63, 0x62, 0x5B, 0x03, 0x01, 0x02, 0x5C, 0x5C, 0x55, 0x37, 0x36, 0x34, 0x48, 0x48, 0x41,
-    0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x21, 0x1E, 0x26, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x08, 0x06, 0x0F, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x03,
-    0x01, 0x02, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x22, 0x13,
-    0x04, 0x22, 0x13, 0x04, 0x1C, 0x0E, 0x02, 0x1C, 0x0E, 0x02, 0x38, 0x29, 0x18, 0x38, 0x29, 0x18,
-    0x49, 0x38, 0x29, 0x0F, 0x02, 0x01, 0x2D, 0x1E, 0x10, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x35,
-    0x26, 0x17, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x35, 0x26, 0x1F, 0x31, 0x22, 0x12, 0x31, 0x22,
-    0x12, 0x2D, 0x1E, 0x10, 0x2D, 0x1E, 0x10, 0x37, 0x2A, 0x1C, 0x3A, 0x2D, 0x1C, 0x35, 0x26, 0x17,
-    0x28, 0x21, 0x11, 0x2D, 0x1E, 0x10, 0x2E, 0x26, 0x1A, 0x35, 0x26, 0x17, 0x2D, 0x1E, 0x10, 0x22,
-    0x15, 0x09, 0x22, 0x15, 0x09, 0x1B, 0x1A, 0x0B, 0x22, 0x15, 0x09, 0x1B, 0x1A, 0x0B, 0x1C, 0x1A,
-    0x13, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x30, 0x1D, 0x09, 0x2C, 0x1A, 0x09,
-    0x34, 0x26, 0x12, 0x49, 0x38, 0x29, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x09, 0x0A, 0x03, 0x28, 0x26, 0x20, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02,
-    0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x38, 0x39, 0x35, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x2C, 0x2D, 0x24, 0x5F, 0x5E, 0x5D, 0x32, 0x33, 0x32, 0x38, 0x39,
-    0x35, 0x38, 0x39, 0x35, 0x32, 0x33, 0x32, 0x1F, 0x1E, 0x1E, 0x1F, 0x1E, 0x1E, 0x57, 0x56, 0x54,
-    0x9B, 0x9A, 0x95, 0x63, 0x62, 0x61, 0x2F, 0x2E, 0x30, 0x61, 0x5F, 0x64, 0x22, 0x23, 0x22, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x35, 0x34, 0x3A, 0x37, 0x36, 0x34, 0x37, 0x36,
-    0x34, 0x63, 0x62, 0x61, 0x2A, 0x2A, 0x29, 0x1F, 0x1E, 0x1E, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28,
-    0x1F, 0x1E, 0x1E, 0x37, 0x36, 0x34, 0x2A, 0x2A, 0x29, 0x96, 0x95, 0x94, 0x63, 0x62, 0x61, 0x95,
-    0x93, 0x8D, 0x37, 0x36, 0x34, 0x32, 0x33, 0x32, 0x63, 0x62, 0x61, 0x5F, 0x5E, 0x5D, 0x2D, 0x2A,
-    0x23, 0xFE, 0xFE, 0xFC, 0x90, 0x8F, 0x8E, 0x28, 0x29, 0x23, 0x17, 0x18, 0x18, 0x37, 0x36, 0x34,
-    0x43, 0x43, 0x3F, 0x96, 0x95, 0x94, 0x61, 0x5F, 0x64, 0x08, 0x06, 0x0F, 0x05, 0x05, 0x08, 0x03,
-    0x01, 0x02, 0x08, 0x06, 0x0F, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x21, 0x16, 0x0F, 0x30, 0x1F, 0x18, 0x2D, 0x2A, 0x23, 0x35,
-    0x26, 0x1F, 0x26, 0x1E, 0x12, 0x21, 0x16, 0x0F, 0x21, 0x16, 0x0F, 0x21, 0x16, 0x0F, 0x38, 0x29,
-    0x18, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x46, 0x2E, 0x19, 0x30, 0x1D, 0x09, 0x35, 0x26, 0x17,
-    0x49, 0x38, 0x29, 0x0F, 0x02, 0x01, 0x2D, 0x1E, 0x10, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x35,
-    0x26, 0x17, 0x38, 0x29, 0x18, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x31, 0x22,
-    0x12, 0x2C, 0x1A, 0x09, 0x2C, 0x1A, 0x09, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x31, 0x22, 0x12,
-    0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x2B, 0x22, 0x18, 0x2C, 0x1A, 0x09, 0x22,
-    0x15, 0x09, 0x22, 0x13, 0x04, 0x22, 0x13, 0x04, 0x21, 0x16, 0x0F, 0x22, 0x15, 0x09, 0x1B, 0x1A,
-    0x0B, 0x28, 0x21, 0x11, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x24, 0x1B, 0x0C, 0x22, 0x13, 0x04,
-    0x3C, 0x25, 0x10, 0x41, 0x38, 0x23, 0x0F, 0x02, 0x01, 0x20, 0x1D, 0x19, 0x2A, 0x2A, 0x29, 0x22,
-    0x23, 0x22, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x2F, 0x2E, 0x2B, 0x28, 0x29,
-    0x23, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x28, 0x29, 0x23,
-    0x27, 0x26, 0x24, 0x28, 0x29, 0x23, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28, 0x3D, 0x3D, 0x3B, 0x03,
-    0x01, 0x02, 0x2F, 0x2E, 0x2B, 0x1F, 0x1E, 0x1E, 0x27, 0x26, 0x28, 0x23, 0x22, 0x1B, 0x28, 0x29,
-    0x23, 0x1A, 0x16, 0x11, 0x27, 0x26, 0x28, 0x23, 0x22, 0x1B, 0x17, 0x18, 0x18, 0x2A, 0x2A, 0x29,
-    0x27, 0x26, 0x24, 0x2F, 0x2E, 0x30, 0x37, 0x36, 0x34, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x2A,
-    0x2A, 0x29, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x39, 0x39, 0x3A, 0x35, 0x34,
-    0x3A, 0x2A, 0x2A, 0x29, 0x19, 0x13, 0x0E, 0x27, 0x26, 0x28, 0x1F, 0x1E, 0x1E, 0x38, 0x39, 0x35,
-    0x2F, 0x2E, 0x2B, 0x39, 0x39, 0x3A, 0x5F, 0x5E, 0x5D, 0x32, 0x33, 0x32, 0x32, 0x33, 0x32, 0x63,
-    0x62, 0x61, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x2A, 0x2A, 0x29, 0x1F, 0x1E, 0x1E, 0x23, 0x22,
-    0x1B, 0x5B, 0x5A, 0x5B, 0x28, 0x26, 0x20, 0x23, 0x22, 0x1B, 0x9F, 0x9E, 0x9D, 0x34, 0x35, 0x2E,
-    0x37, 0x36, 0x34, 0x4C, 0x4B, 0x49, 0x5B, 0x5A, 0x5B, 0x39, 0x39, 0x3A, 0x05, 0x05, 0x08, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x35, 0x26, 0x1F, 0x33, 0x32, 0x23, 0x37, 0x33, 0x32, 0x4A,
-    0x38, 0x30, 0x2F, 0x2E, 0x2B, 0x28, 0x26, 0x20, 0x2E, 0x26, 0x1A, 0x35, 0x26, 0x1F, 0x37, 0x2A,
-    0x1C, 0x42, 0x33, 0x22, 0x49, 0x38, 0x29, 0x58, 0x48, 0x38, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17,
-    0x42, 0x33, 0x22, 0x0F, 0x02, 0x01, 0x2D, 0x1E, 0x10, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x37,
-    0x2A, 0x1C, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x3C, 0x25, 0x10, 0x31, 0x22, 0x12, 0x2C, 0x1A,
-    0x09, 0x2D, 0x1E, 0x10, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17,
-    0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x24, 0x1B, 0x0C, 0x2D, 0x1E, 0x10, 0x24, 0x1B, 0x0C, 0x2D,
-    0x1E, 0x10, 0x24, 0x1B, 0x0C, 0x2C, 0x1A, 0x09, 0x1B, 0x1A, 0x0B, 0x1B, 0x14, 0x0A, 0x1A, 0x16,
-    0x11, 0x28, 0x21, 0x11, 0x24, 0x1A, 0x11, 0x26, 0x1E, 0x12, 0x30, 0x1D, 0x09, 0x22, 0x13, 0x04,
-    0x3C, 0x25, 0x10, 0x4B, 0x3D, 0x2C, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x32, 0x33, 0x32, 0x43,
-    0x43, 0x3F, 0x37, 0x36, 0x34, 0x2F, 0x2E, 0x2B, 0x34, 0x35, 0x2E, 0x5F, 0x5E, 0x5D, 0x5C, 0x5C,
-    0x55, 0x63, 0x62, 0x5B, 0x63, 0x62, 0x61, 0x34, 0x35, 0x2E, 0x57, 0x56, 0x54, 0x38, 0x39, 0x35,
-    0x2F, 0x2E, 0x2B, 0x3E, 0x3E, 0x36, 0x2A, 0x2A, 0x29, 0x32, 0x33, 0x32, 0x34, 0x35, 0x2E, 0x03,
-    0x01, 0x02, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x2C, 0x2D, 0x24, 0x20, 0x1D, 0x19, 0x28, 0x29,
-    0x23, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x23, 0x22, 0x1B, 0x27, 0x26, 0x24, 0x32, 0x33, 0x32,
-    0x5F, 0x5E, 0x5D, 0x9F, 0x9E, 0x9D, 0x5F, 0x5E, 0x5D, 0x32, 0x33, 0x32, 0x27, 0x26, 0x24, 0x1F,
-    0x1E, 0x1E, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x22, 0x23,
-    0x22, 0x39, 0x39, 0x3A, 0x2A, 0x2A, 0x29, 0x35, 0x34, 0x3A, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22,
-    0x39, 0x39, 0x3A, 0x63, 0x62, 0x61, 0x39, 0x39, 0x3A, 0x22, 0x23, 0x22, 0x20, 0x1D, 0x19, 0x22,
-    0x23, 0x22, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x27, 0x26,
-    0x24, 0x23, 0x22, 0x1B, 0x63, 0x62, 0x5B, 0x28, 0x29, 0x23, 0x57, 0x56, 0x54, 0x28, 0x26, 0x20,
-    0x32, 0x33, 0x32, 0x96, 0x95, 0x94, 0x48, 0x48, 0x41, 0x5B, 0x5A, 0x5B, 0x38, 0x39, 0x35, 0x0A,
-    0x0A, 0x09, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x0A, 0x0A, 0x09, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x1B, 0x14, 0x0A, 0x19, 0x13, 0x0E, 0x21, 0x16, 0x0F, 0x1A,
-    0x16, 0x11, 0x1C, 0x1A, 0x13, 0x21, 0x16, 0x0F, 0x21, 0x16, 0x0F, 0x1B, 0x14, 0x0A, 0x2B, 0x22,
-    0x18, 0x38, 0x29, 0x18, 0x35, 0x26, 0x1F, 0x38, 0x29, 0x18, 0x49, 0x38, 0x29, 0x38, 0x29, 0x18,
-    0x49, 0x38, 0x29, 0x0F, 0x02, 0x01, 0x30, 0x1D, 0x09, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x35,
-    0x26, 0x17, 0x28, 0x21, 0x11, 0x38, 0x29, 0x18, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x2C, 0x1A,
-    0x09, 0x31, 0x22, 0x12, 0x3A, 0x2D, 0x1C, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18,
-    0x38, 0x29, 0x18, 0x34, 0x26, 0x12, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x28, 0x21, 0x11, 0x28,
-    0x21, 0x11, 0x2D, 0x1E, 0x10, 0x24, 0x1A, 0x11, 0x21, 0x16, 0x0F, 0x1B, 0x14, 0x0A, 0x22, 0x15,
-    0x09, 0x26, 0x1E, 0x12, 0x1C, 0x1A, 0x13, 0x26, 0x1E, 0x12, 0x2D, 0x1E, 0x10, 0x22, 0x15, 0x09,
-    0x3C, 0x25, 0x10, 0x58, 0x48, 0x38, 0x0F, 0x02, 0x01, 0x27, 0x26, 0x24, 0x26, 0x23, 0x21, 0x20,
-    0x1D, 0x19, 0x28, 0x29, 0x23, 0x2A, 0x2A, 0x29, 0x28, 0x29, 0x23, 0x2C, 0x2D, 0x24, 0x22, 0x23,
-    0x22, 0x22, 0x23, 0x22, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x32, 0x32, 0x2D, 0x28, 0x29, 0x23,
-    0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x2F, 0x2E, 0x2B, 0x38, 0x39, 0x35, 0x03,
-    0x01, 0x02, 0x3D, 0x3A, 0x35, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x23, 0x22, 0x1B, 0x23, 0x22,
-    0x1B, 0x23, 0x22, 0x1B, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x32, 0x33, 0x32, 0x43, 0x43, 0x3F,
-    0x5B, 0x5A, 0x5B, 0x5F, 0x5E, 0x5D, 0x9A, 0x9A, 0x9A, 0x5F, 0x5E, 0x5D, 0x3E, 0x3E, 0x3F, 0x2F,
-    0x2E, 0x2B, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x27, 0x26,
-    0x28, 0x22, 0x23, 0x22, 0x37, 0x36, 0x34, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x3E, 0x3E, 0x3F,
-    0x39, 0x39, 0x3A, 0x3E, 0x3E, 0x3F, 0x27, 0x26, 0x24, 0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0x2A,
-    0x2A, 0x29, 0x43, 0x43, 0x3F, 0x22, 0x23, 0x22, 0x44, 0x3F, 0x3B, 0x28, 0x29, 0x23, 0x28, 0x29,
-    0x23, 0x20, 0x1D, 0x19, 0x17, 0x18, 0x18, 0x23, 0x22, 0x1B, 0x20, 0x1D, 0x19, 0x20, 0x1D, 0x19,
-    0x32, 0x32, 0x2D, 0x38, 0x39, 0x35, 0x48, 0x48, 0x41, 0x63, 0x62, 0x61, 0x5C, 0x5C, 0x55, 0x39,
-    0x39, 0x3A, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x21, 0x16, 0x0F, 0x19, 0x13, 0x0E, 0x19, 0x13, 0x0E, 0x21,
-    0x16, 0x0F, 0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x21, 0x16, 0x0F, 0x1A, 0x16, 0x11, 0x37, 0x2A,
-    0x1C, 0x2E, 0x26, 0x1A, 0x28, 0x21, 0x11, 0x35, 0x26, 0x17, 0x22, 0x15, 0x09, 0x31, 0x22, 0x12,
-    0x3E, 0x3A, 0x2D, 0x03, 0x01, 0x02, 0x28, 0x21, 0x11, 0x2E, 0x26, 0x1A, 0x34, 0x26, 0x12, 0x34,
-    0x26, 0x12, 0x30, 0x1D, 0x09, 0x34, 0x26, 0x12, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x35, 0x26,
-    0x17, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x34, 0x26, 0x12,
-    0x35, 0x26, 0x17, 0x2D, 0x29, 0x1A, 0x3A, 0x2D, 0x1C, 0x2E, 0x26, 0x1A, 0x37, 0x2A, 0x1C, 0x28,
-    0x21, 0x11, 0x24, 0x1B, 0x0C, 0x26, 0x1E, 0x12, 0x1B, 0x1A, 0x0B, 0x21, 0x16, 0x0F, 0x19, 0x13,
-    0x0E, 0x30, 0x1F, 0x18, 0x24, 0x1A, 0x11, 0x30, 0x1F, 0x18, 0x2D, 0x1E, 0x10, 0x22, 0x13, 0x04,
-    0x35, 0x26, 0x17, 0x58, 0x48, 0x38, 0x03, 0x01, 0x02, 0x2F, 0x2E, 0x2B, 0x3E, 0x3E, 0x3F, 0x3D,
-    0x3D, 0x3B, 0x46, 0x45, 0x47, 0x3D, 0x3A, 0x35, 0x44, 0x3F, 0x3B, 0x3D, 0x3A, 0x35, 0x43, 0x43,
-    0x3F, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x39, 0x38, 0x39, 0x35, 0x22, 0x23, 0x22, 0x34, 0x35, 0x2E,
-    0x28, 0x29, 0x23, 0x3D, 0x3D, 0x3B, 0x38, 0x39, 0x35, 0x4C, 0x4B, 0x49, 0x37, 0x36, 0x34, 0x03,
-    0x01, 0x02, 0x32, 0x32, 0x2D, 0x38, 0x39, 0x35, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x38, 0x39,
-    0x35, 0x23, 0x22, 0x1B, 0x32, 0x32, 0x2D, 0x43, 0x43, 0x3F, 0x44, 0x3F, 0x3B, 0x5F, 0x5E, 0x5D,
-    0x5F, 0x5E, 0x5D, 0x96, 0x95, 0x94, 0x63, 0x62, 0x61, 0x96, 0x95, 0x94, 0x3E, 0x3E, 0x3F, 0x22,
-    0x23, 0x22, 0x27, 0x26, 0x28, 0x35, 0x34, 0x3A, 0x32, 0x33, 0x32, 0x2A, 0x2A, 0x29, 0x2F, 0x2E,
-    0x2B, 0x1F, 0x1E, 0x1E, 0x27, 0x26, 0x28, 0x32, 0x33, 0x32, 0x32, 0x33, 0x32, 0x37, 0x36, 0x34,
-    0x3E, 0x3E, 0x3F, 0x32, 0x33, 0x32, 0x27, 0x26, 0x24, 0x38, 0x39, 0x35, 0x34, 0x35, 0x2E, 0x27,
-    0x26, 0x24, 0x32, 0x33, 0x32, 0x38, 0x39, 0x35, 0x5F, 0x5E, 0x5D, 0x32, 0x32, 0x2D, 0x32, 0x33,
-    0x32, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x38, 0x39, 0x35,
-    0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x39, 0x33, 0x2C, 0x5C, 0x5C, 0x55, 0x65, 0x65, 0x66, 0x35,
-    0x34, 0x3A, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x0F, 0x02,
-    0x01, 0x1C, 0x12, 0x04, 0x30, 0x1D, 0x09, 0x1C, 0x12, 0x04, 0x38, 0x29, 0x18, 0x2B, 0x22, 0x18,
-    0x4A, 0x38, 0x30, 0x0F, 0x02, 0x01, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x3A,
-    0x2D, 0x1C, 0x28, 0x21, 0x11, 0x22, 0x13, 0x04, 0x22, 0x13, 0x04, 0x31, 0x22, 0x12, 0x35, 0x26,
-    0x17, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x38, 0x29, 0x18,
-    0x38, 0x29, 0x18, 0x30, 0x1D, 0x09, 0x28, 0x2E, 0x19, 0x34, 0x26, 0x12, 0x28, 0x2E, 0x19, 0x28,
-    0x21, 0x11, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x1B, 0x14, 0x0A, 0x21, 0x16, 0x0F, 0x1B, 0x1A,
-    0x0B, 0x2B, 0x22, 0x18, 0x24, 0x1A, 0x11, 0x24, 0x1A, 0x11, 0x2D, 0x1E, 0x10, 0x22, 0x13, 0x04,
-    0x3C, 0x25, 0x10, 0x5B, 0x4D, 0x3F, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x43,
-    0x43, 0x3F, 0x44, 0x3F, 0x3B, 0x46, 0x45, 0x47, 0x44, 0x3F, 0x3B, 0x46, 0x45, 0x47, 0x4E, 0x44,
-    0x40, 0x44, 0x43, 0x43, 0x44, 0x3F, 0x3B, 0x65, 0x65, 0x66, 0x5B, 0x5A, 0x5B, 0x5F, 0x5E, 0x5D,
-    0x5C, 0x5C, 0x55, 0x43, 0x43, 0x3F, 0x63, 0x62, 0x5B, 0x3E, 0x3E, 0x36, 0x34, 0x35, 0x2E, 0x03,
-    0x01, 0x02, 0x48, 0x48, 0x41, 0x32, 0x32, 0x2D, 0x48, 0x48, 0x41, 0x63, 0x62, 0x5B, 0x3E, 0x3E,
-    0x36, 0x65, 0x65, 0x66, 0x5C, 0x5C, 0x55, 0x90, 0x8F, 0x8E, 0x5F, 0x5E, 0x5D, 0x9B, 0x9A, 0x95,
-    0x97, 0x96, 0x99, 0x3E, 0x3E, 0x3F, 0x32, 0x33, 0x32, 0x63, 0x62, 0x61, 0x3D, 0x3D, 0x3B, 0x32,
-    0x33, 0x32, 0x3E, 0x3E, 0x36, 0x32, 0x32, 0x2D, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x32, 0x32,
-    0x2D, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x3F,
-    0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x36, 0x44, 0x3F, 0x3B, 0x38, 0x39, 0x35, 0x37, 0x36, 0x34, 0x34,
-    0x35, 0x2E, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x34, 0x35, 0x2E, 0x3D, 0x3D, 0x3B, 0x34, 0x35,
-    0x2E, 0x38, 0x39, 0x35, 0x22, 0x23, 0x22, 0x23, 0x22, 0x1B, 0x23, 0x22, 0x1B, 0x1C, 0x1A, 0x13,
-    0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x38, 0x39, 0x35, 0x43, 0x43, 0x3F, 0x57, 0x56, 0x54, 0x63,
-    0x62, 0x61, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x22, 0x13, 0x04, 0x38, 0x29, 0x18, 0x37, 0x2A, 0x1C, 0x30,
-    0x1F, 0x18, 0x21, 0x16, 0x0F, 0x24, 0x0E, 0x13, 0x22, 0x15, 0x09, 0x22, 0x13, 0x04, 0x34, 0x26,
-    0x12, 0x34, 0x26, 0x12, 0x3E, 0x2A, 0x12, 0x3C, 0x25, 0x10, 0x3C, 0x25, 0x10, 0x3C, 0x25, 0x10,
-    0x4A, 0x3D, 0x34, 0x0F, 0x02, 0x01, 0x31, 0x22, 0x12, 0x3A, 0x2D, 0x1C, 0x36, 0x29, 0x13, 0x22,
-    0x13, 0x04, 0x3A, 0x2D, 0x1C, 0x22, 0x13, 0x04, 0x2C, 0x1A, 0x09, 0x31, 0x22, 0x12, 0x35, 0x26,
-    0x17, 0x35, 0x26, 0x17, 0x34, 0x26, 0x12, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x34, 0x26, 0x12,
-    0x22, 0x13, 0x04, 0x22, 0x13, 0x04, 0x22, 0x15, 0x09, 0x24, 0x1B, 0x0C, 0x2B, 0x22, 0x18, 0x28,
-    0x21, 0x11, 0x24, 0x1A, 0x11, 0x26, 0x1E, 0x12, 0x1B, 0x14, 0x0A, 0x1C, 0x1A, 0x13, 0x19, 0x13,
-    0x0E, 0x20, 0x1D, 0x19, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x2D, 0x1E, 0x10, 0x22, 0x13, 0x04,
-    0x35, 0x26, 0x17, 0x49, 0x38, 0x29, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27,
-    0x26, 0x28, 0x27, 0x26, 0x28, 0x2C, 0x1F, 0x25, 0x26, 0x23, 0x21, 0x35, 0x26, 0x1F, 0x35, 0x26,
-    0x1F, 0x23, 0x22, 0x1B, 0x29, 0x25, 0x2E, 0x29, 0x25, 0x2E, 0x21, 0x1E, 0x26, 0x29, 0x25, 0x2E,
-    0x28, 0x29, 0x23, 0x2D, 0x29, 0x1A, 0x28, 0x26, 0x20, 0x26, 0x23, 0x21, 0x03, 0x01, 0x02, 0x0F,
-    0x02, 0x01, 0x44, 0x43, 0x43, 0x43, 0x43, 0x3F, 0x46, 0x45, 0x47, 0x3E, 0x3E, 0x36, 0x43, 0x43,
-    0x39, 0x32, 0x32, 0x2D, 0x28, 0x26, 0x20, 0x3D, 0x3A, 0x35, 0x3E, 0x3E, 0x3F, 0x97, 0x96, 0x99,
-    0xDC, 0xDB, 0xD9, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x63, 0x62, 0x5B, 0x3E, 0x3E, 0x3F, 0x43,
-    0x43, 0x3F, 0x44, 0x43, 0x43, 0x34, 0x35, 0x2E, 0x48, 0x48, 0x41, 0x43, 0x43, 0x3F, 0x44, 0x3F,
-    0x3B, 0x3E, 0x3E, 0x36, 0x48, 0x48, 0x41, 0x43, 0x43, 0x39, 0x44, 0x3F, 0x3B, 0x3D, 0x3A, 0x35,
-    0x46, 0x47, 0x39, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x39, 0x3E, 0x3E, 0x36, 0x41, 0x42, 0x34, 0x43,
-    0x43, 0x3F, 0x46, 0x47, 0x39, 0x3E, 0x3E, 0x36, 0x46, 0x47, 0x39, 0x41, 0x42, 0x34, 0x3E, 0x3E,
-    0x36, 0x3E, 0x3A, 0x2D, 0x3B, 0x3F, 0x2E, 0x34, 0x35, 0x2E, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20,
-    0x2C, 0x2D, 0x24, 0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E, 0x48, 0x48, 0x41, 0x63,
-    0x62, 0x5B, 0x57, 0x56, 0x54, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x36, 0x29, 0x13, 0x42, 0x33, 0x22, 0x3D, 0x36, 0x2C, 0x37,
-    0x2A, 0x1C, 0x35, 0x26, 0x1F, 0x35, 0x26, 0x1F, 0x35, 0x26, 0x1F, 0x30, 0x1F, 0x18, 0x38, 0x29,
-    0x18, 0x4E, 0x34, 0x1A, 0x41, 0x38, 0x23, 0x65, 0x53, 0x3B, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17,
-    0x58, 0x48, 0x38, 0x0F, 0x02, 0x01, 0x37, 0x2A, 0x1C, 0x2D, 0x1E, 0x10, 0x38, 0x29, 0x18, 0x28,
-    0x21, 0x11, 0x31, 0x22, 0x12, 0x6D, 0x5E, 0x4C, 0x22, 0x13, 0x04, 0x38, 0x29, 0x18, 0x35, 0x26,
-    0x17, 0x30, 0x1D, 0x09, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x47, 0x2F, 0x20,
-    0x2D, 0x1E, 0x10, 0x4B, 0x3D, 0x2C, 0x31, 0x22, 0x12, 0x34, 0x26, 0x12, 0x35, 0x26, 0x17, 0x2D,
-    0x1E, 0x10, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x1A, 0x16, 0x11, 0x1B, 0x1A, 0x0B, 0x1B, 0x1A,
-    0x0B, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x24, 0x1B, 0x0C, 0x30, 0x1D, 0x09, 0x22, 0x13, 0x04,
-    0x34, 0x26, 0x12, 0x49, 0x38, 0x29, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x05,
-    0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x08, 0x06, 0x0F, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x44, 0x3F, 0x3B, 0x4E, 0x44, 0x40, 0x48, 0x48, 0x41, 0x44, 0x3F, 0x3B, 0x43, 0x43,
-    0x39, 0x41, 0x42, 0x34, 0x43, 0x43, 0x3F, 0x3D, 0x3A, 0x35, 0x5C, 0x5C, 0x55, 0x5B, 0x5A, 0x5B,
-    0x97, 0x96, 0x99, 0x9F, 0x9E, 0x9D, 0x5F, 0x5E, 0x5D, 0x43, 0x43, 0x3F, 0x5C, 0x5C, 0x55, 0x44,
-    0x3F, 0x3B, 0x43, 0x43, 0x3F, 0x32, 0x32, 0x2D, 0x48, 0x48, 0x41, 0x46, 0x47, 0x39, 0x4A, 0x3D,
-    0x34, 0x3E, 0x3A, 0x2D, 0x3B, 0x3F, 0x2E, 0x46, 0x47, 0x39, 0x43, 0x43, 0x39, 0x3B, 0x3F, 0x2E,
-    0x43, 0x43, 0x3F, 0x46, 0x47, 0x39, 0x43, 0x43, 0x3F, 0x4E, 0x44, 0x40, 0x43, 0x43, 0x39, 0x46,
-    0x47, 0x39, 0x41, 0x42, 0x34, 0x53, 0x53, 0x44, 0x46, 0x47, 0x39, 0x43, 0x43, 0x39, 0x3B, 0x3F,
-    0x2E, 0x41, 0x42, 0x34, 0x34, 0x35, 0x2E, 0x41, 0x42, 0x34, 0x4B, 0x4B, 0x42, 0x32, 0x32, 0x2D,
-    0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E, 0x4B, 0x4B, 0x42, 0x32, 0x32, 0x2D, 0x3E, 0x3E, 0x36, 0x43,
-    0x43, 0x3F, 0x63, 0x62, 0x5B, 0x63, 0x62, 0x5B, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x22, 0x15, 0x09, 0x24, 0x1B, 0x0C, 0x21, 0x16, 0x0F, 0x16,
-    0x0F, 0x09, 0x24, 0x0E, 0x13, 0x2B, 0x15, 0x13, 0x19, 0x13, 0x0E, 0x1B, 0x14, 0x0A, 0x2D, 0x1E,
-    0x10, 0x42, 0x33, 0x22, 0x31, 0x22, 0x12, 0x2D, 0x1E, 0x10, 0x49, 0x38, 0x29, 0x38, 0x29, 0x18,
-    0x5F, 0x4B, 0x47, 0x0F, 0x02, 0x01, 0x31, 0x22, 0x12, 0x37, 0x2A, 0x1C, 0x3A, 0x2D, 0x1C, 0x24,
-    0x1B, 0x0C, 0x3A, 0x2D, 0x1C, 0x49, 0x38, 0x29, 0x42, 0x33, 0x22, 0x38, 0x29, 0x18, 0x38, 0x29,
-    0x18, 0x35, 0x26, 0x17, 0x3A, 0x2D, 0x1C, 0x35, 0x26, 0x17, 0x2D, 0x1E, 0x10, 0x35, 0x26, 0x17,
-    0x37, 0x2A, 0x1C, 0x68, 0x59, 0x4B, 0x37, 0x2A, 0x1C, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x2D,
-    0x1E, 0x10, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x22, 0x15, 0x09, 0x1B, 0x14, 0x0A, 0x26, 0x1E,
-    0x12, 0x2B, 0x22, 0x18, 0x26, 0x1E, 0x12, 0x2D, 0x1E, 0x10, 0x31, 0x22, 0x12, 0x22, 0x15, 0x09,
-    0x38, 0x29, 0x18, 0x49, 0x38, 0x29, 0x03, 0x01, 0x02, 0x44, 0x43, 0x43, 0x22, 0x26, 0x11, 0x34,
-    0x35, 0x2E, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0x22, 0x23, 0x22, 0x26, 0x23,
-    0x21, 0x22, 0x23, 0x22, 0x39, 0x39, 0x3A, 0x35, 0x34, 0x3A, 0x3B, 0x36, 0x43, 0x42, 0x3D, 0x45,
-    0x3E, 0x3E, 0x36, 0x3B, 0x3F, 0x2E, 0x3E, 0x3E, 0x36, 0x43, 0x43, 0x3F, 0x5C, 0x5C, 0x55, 0x05,
-    0x06, 0x03, 0x48, 0x48, 0x41, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x46, 0x47, 0x39, 0x41, 0x42,
-    0x34, 0x4B, 0x4B, 0x42, 0x3B, 0x3F, 0x2E, 0x63, 0x62, 0x5B, 0x48, 0x48, 0x41, 0x51, 0x48, 0x41,
-    0x37, 0x33, 0x32, 0x5B, 0x5A, 0x5B, 0x5F, 0x5E, 0x5D, 0x5C, 0x5C, 0x55, 0x43, 0x43, 0x3F, 0x46,
-    0x47, 0x39, 0x43, 0x43, 0x39, 0x47, 0x4C, 0x39, 0x4B, 0x4B, 0x42, 0x41, 0x42, 0x34, 0x57, 0x57,
-    0x4C, 0x4D, 0x4F, 0x41, 0x62, 0x5E, 0x55, 0x62, 0x62, 0x52, 0x59, 0x57, 0x44, 0x62, 0x62, 0x52,
-    0x5D, 0x5E, 0x4C, 0x5C, 0x5C, 0x55, 0x5B, 0x5A, 0x4C, 0x62, 0x5E, 0x55, 0x5C, 0x5C, 0x55, 0x34,
-    0x35, 0x2E, 0x3E, 0x3A, 0x2D, 0x57, 0x57, 0x4C, 0x53, 0x53, 0x44, 0x4B, 0x4B, 0x42, 0x46, 0x47,
-    0x39, 0x4B, 0x4B, 0x42, 0x43, 0x43, 0x39, 0x43, 0x43, 0x39, 0x43, 0x43, 0x39, 0x48, 0x48, 0x41,
-    0x48, 0x48, 0x41, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x48, 0x48, 0x41, 0x38,
-    0x39, 0x35, 0x43, 0x43, 0x3F, 0x5C, 0x5C, 0x55, 0x03, 0x01, 0x02, 0x09, 0x0A, 0x03, 0x03, 0x01,
-    0x02, 0x09, 0x0A, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0A, 0x0A, 0x09, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x15, 0x09, 0x1B, 0x14, 0x0A, 0x1B, 0x14, 0x0A, 0x2B,
-    0x15, 0x13, 0x1D, 0x18, 0x18, 0x2B, 0x15, 0x13, 0x24, 0x0E, 0x13, 0x24, 0x1A, 0x11, 0x37, 0x2C,
-    0x21, 0x2B, 0x22, 0x18, 0x34, 0x26, 0x12, 0x36, 0x29, 0x13, 0x2D, 0x1E, 0x10, 0x30, 0x1F, 0x18,
-    0x5F, 0x4B, 0x47, 0x0F, 0x02, 0x01, 0x38, 0x29, 0x18, 0x38, 0x29, 0x18, 0x31, 0x22, 0x12, 0x30,
-    0x1D, 0x09, 0x28, 0x21, 0x11, 0x28, 0x21, 0x11, 0x3A, 0x2D, 0x1C, 0x35, 0x26, 0x17, 0x34, 0x26,
-    0x12, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x3A, 0x2D, 0x1C, 0x38, 0x29, 0x18,
-    0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x38, 0x29, 0x18, 0x38, 0x29, 0x18, 0x34, 0x26, 0x12, 0x24,
-    0x1B, 0x0C, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x22, 0x15, 0x09, 0x1B, 0x14, 0x0A, 0x22, 0x15,
-    0x09, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x24, 0x1A, 0x11, 0x2D, 0x1E, 0x10, 0x22, 0x13, 0x04,
-    0x31, 0x22, 0x12, 0x4A, 0x38, 0x30, 0x03, 0x01, 0x02, 0x1C, 0x1A, 0x13, 0x28, 0x2E, 0x19, 0x28,
-    0x2E, 0x19, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x37, 0x36, 0x34, 0x03, 0x01, 0x02, 0x1E, 0x01,
-    0x01, 0x1E, 0x01, 0x01, 0x1E, 0x01, 0x01, 0x1E, 0x01, 0x01, 0x1E, 0x01, 0x01, 0x1E, 0x01, 0x01,
-    0x1E, 0x01, 0x01, 0x1E, 0x01, 0x01, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x47, 0x2F, 0x20, 0x03,
-    0x01, 0x02, 0x34, 0x35, 0x2E, 0x5C, 0x5C, 0x55, 0x57, 0x57, 0x4C, 0x5C, 0x5C, 0x55, 0x28, 0x29,
-    0x23, 0x2D, 0x29, 0x1A, 0x3E, 0x3A, 0x2D, 0x28, 0x29, 0x23, 0x52, 0x52, 0x4C, 0x34, 0x35, 0x2E,
-    0x38, 0x39, 0x35, 0x37, 0x33, 0x32, 0x5F, 0x5E, 0x5D, 0x57, 0x56, 0x54, 0x34, 0x35, 0x2E, 0x5C,
-    0x5C, 0x55, 0x5F, 0x5E, 0x5D, 0x57, 0x57, 0x4C, 0x2F, 0x2E, 0x2B, 0x62, 0x5E, 0x55, 0x5D, 0x5E,
-    0x4C, 0x57, 0x57, 0x4C, 0x5B, 0x5A, 0x4C, 0x62, 0x5E, 0x55, 0x39, 0x33, 0x2C, 0x23, 0x22, 0x1B,
-    0x2D, 0x2A, 0x23, 0x23, 0x22, 0x1B, 0x2D, 0x2A, 0x23, 0x23, 0x22, 0x1B, 0x38, 0x39, 0x35, 0x34,
-    0x35, 0x2E, 0x5F, 0x5E, 0x5D, 0x5C, 0x5C, 0x55, 0x63, 0x62, 0x5B, 0x57, 0x57, 0x4C, 0x5C, 0x5C,
-    0x55, 0x52, 0x52, 0x4C, 0x63, 0x62, 0x5B, 0x5C, 0x5C, 0x55, 0x5F, 0x5E, 0x5D, 0x52, 0x52, 0x4C,
-    0x5F, 0x5E, 0x5D, 0x5C, 0x5C, 0x55, 0x57, 0x56, 0x54, 0x62, 0x5E, 0x55, 0x5C, 0x5C, 0x55, 0x5C,
-    0x5C, 0x55, 0x5C, 0x5C, 0x55, 0x65, 0x65, 0x66, 0x57, 0x57, 0x4C, 0x5C, 0x5C, 0x55, 0x0A, 0x0A,
-    0x09, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x1C, 0x12,
-    0x04, 0x2C, 0x1A, 0x09, 0x22, 0x13, 0x04, 0x2C, 0x1A, 0x09, 0x24, 0x1B, 0x0C, 0x35, 0x26, 0x17,
-    0x4A, 0x38, 0x30, 0x0F, 0x02, 0x01, 0x38, 0x29, 0x18, 0x28, 0x21, 0x11, 0x31, 0x22, 0x12, 0x3A,
-    0x2D, 0x1C, 0x30, 0x1D, 0x09, 0x46, 0x2E, 0x19, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x3A, 0x2D,
-    0x1C, 0x38, 0x29, 0x18, 0x34, 0x26, 0x12, 0x38, 0x29, 0x18, 0x31, 0x22, 0x12, 0x31, 0x22, 0x12,
-    0x38, 0x29, 0x18, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x34, 0x26, 0x12, 0x35, 0x26, 0x17, 0x30,
-    0x1D, 0x09, 0x2D, 0x1E, 0x10, 0x24, 0x1B, 0x0C, 0x22, 0x15, 0x09, 0x1B, 0x14, 0x0A, 0x1C, 0x12,
-    0x04, 0x24, 0x1A, 0x11, 0x2D, 0x1E, 0x10, 0x24, 0x1A, 0x11, 0x26, 0x1E, 0x12, 0x22, 0x13, 0x04,
-    0x35, 0x26, 0x17, 0x4A, 0x38, 0x30, 0x03, 0x01, 0x02, 0x28, 0x26, 0x20, 0x28, 0x29, 0x23, 0x2A,
-    0x2A, 0x29, 0x2C, 0x1F, 0x25, 0x2C, 0x1F, 0x25, 0x38, 0x39, 0x35, 0x0F, 0x02, 0x01, 0x9D, 0x2F,
-    0x17, 0xDA, 0x4E, 0x21, 0xCA, 0x56, 0x09, 0xE3, 0x75, 0x23, 0xF0, 0x76, 0x33, 0xD3, 0x5B, 0x27,
-    0xC1, 0x5B, 0x35, 0xAD, 0x59, 0x41, 0x87, 0x43, 0x39, 0x1E, 0x01, 0x01, 0x30, 0x1F, 0x18, 0x0F,
-    0x02, 0x01, 0x05, 0x06, 0x03, 0x05, 0x06, 0x03, 0x05, 0x06, 0x03, 0x05, 0x06, 0x03, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x09, 0x0A, 0x03, 0x05, 0x06, 0x03, 0x05, 0x06, 0x03,
-    0x09, 0x0A, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x05, 0x05, 0x08, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01,
-    0x02, 0x09, 0x0A, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x23, 0x22,
-    0x1B, 0x3E, 0x3E, 0x36, 0x34, 0x35, 0x2E, 0x3D, 0x3D, 0x3B, 0x32, 0x33, 0x32, 0x37, 0x36, 0x34,
-    0x0A, 0x0A, 0x09, 0x03, 0x01, 0x02, 0x24, 0x1B, 0x0C, 0x2E, 0x26, 0x1A, 0x2E, 0x26, 0x1A, 0x1B,
-    0x1A, 0x0B, 0x19, 0x13, 0x0E, 0x24, 0x1A, 0x11, 0x24, 0x1A, 0x11, 0x1B, 0x14, 0x0A, 0x3A, 0x2D,
-    0x1C, 0x24, 0x2B, 0x11, 0x36, 0x29, 0x13, 0x36, 0x29, 0x13, 0x34, 0x26, 0x12, 0x3A, 0x2D, 0x1C,
-    0x41, 0x38, 0x23, 0x0F, 0x02, 0x01, 0x31, 0x22, 0x12, 0x36, 0x29, 0x13, 0x3E, 0x2A, 0x12, 0x42,
-    0x33, 0x22, 0x28, 0x21, 0x11, 0x30, 0x1D, 0x09, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x31, 0x22,
-    0x12, 0x22, 0x13, 0x04, 0x38, 0x29, 0x18, 0x3A, 0x2D, 0x1C, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17,
-    0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x2D,
-    0x1E, 0x10, 0x24, 0x1B, 0x0C, 0x2D, 0x1E, 0x10, 0x22, 0x15, 0x09, 0x22, 0x15, 0x09, 0x22, 0x15,
-    0x09, 0x26, 0x1E, 0x12, 0x2B, 0x22, 0x18, 0x2D, 0x1E, 0x10, 0x2D, 0x1E, 0x10, 0x22, 0x15, 0x09,
-    0x37, 0x2C, 0x21, 0x4E, 0x44, 0x40, 0x0F, 0x02, 0x01, 0x29, 0x25, 0x2E, 0x2F, 0x2E, 0x2B, 0x32,
-    0x33, 0x32, 0x61, 0x5F, 0x64, 0x29, 0x25, 0x2E, 0x35, 0x34, 0x3A, 0x1E, 0x01, 0x01, 0xC1, 0x51,
-    0x39, 0xDA, 0x4E, 0x21, 0xCA, 0x56, 0x09, 0xF3, 0x83, 0x2F, 0xF0, 0x76, 0x33, 0xA5, 0x2D, 0x01,
-    0x83, 0x19, 0x01, 0x7B, 0x21, 0x0F, 0xA3, 0x59, 0x53, 0x1E, 0x01, 0x01, 0x30, 0x1F, 0x18, 0x0F,
-    0x02, 0x01, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x32, 0x33, 0x32, 0x22, 0x23, 0x22, 0x29, 0x25,
-    0x2E, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x2F, 0x2E, 0x2B,
-    0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x29,
-    0x25, 0x2E, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x26, 0x23, 0x21, 0x1F, 0x1E, 0x1E, 0x27, 0x26,
-    0x24, 0x27, 0x26, 0x28, 0x1F, 0x1E, 0x1E, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x26, 0x23, 0x21,
-    0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x44, 0x3F, 0x3B, 0x3D,
-    0x3D, 0x3B, 0x2A, 0x2A, 0x29, 0x1F, 0x1E, 0x1E, 0x33, 0x32, 0x23, 0x20, 0x1D, 0x19, 0x28, 0x29,
-    0x23, 0x1F, 0x1E, 0x1E, 0x2F, 0x2E, 0x2B, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28,
-    0x22, 0x23, 0x22, 0x2F, 0x2E, 0x30, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x22,
-    0x23, 0x22, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x23, 0x22,
-    0x1B, 0x34, 0x35, 0x2E, 0x38, 0x39, 0x35, 0x38, 0x39, 0x35, 0x37, 0x36, 0x34, 0x35, 0x34, 0x3A,
-    0x35, 0x34, 0x3A, 0x03, 0x01, 0x02, 0x2D, 0x29, 0x1A, 0x41, 0x38, 0x23, 0x33, 0x32, 0x23, 0x2E,
-    0x26, 0x1A, 0x2B, 0x22, 0x18, 0x2D, 0x2A, 0x23, 0x37, 0x2C, 0x21, 0x22, 0x26, 0x11, 0x34, 0x26,
-    0x12, 0x42, 0x33, 0x22, 0x41, 0x38, 0x23, 0x57, 0x4C, 0x39, 0x36, 0x29, 0x13, 0x3E, 0x2A, 0x12,
-    0x3A, 0x2D, 0x1C, 0x0F, 0x02, 0x01, 0x36, 0x29, 0x13, 0x3C, 0x25, 0x10, 0x31, 0x22, 0x12, 0x4E,
-    0x34, 0x1A, 0x30, 0x1D, 0x09, 0x34, 0x26, 0x12, 0x31, 0x22, 0x12, 0x34, 0x26, 0x12, 0x46, 0x2E,
-    0x19, 0x22, 0x13, 0x04, 0x1C, 0x0E, 0x02, 0x1C, 0x0E, 0x02, 0x3C, 0x25, 0x10, 0x3A, 0x2D, 0x1C,
-    0x34, 0x26, 0x12, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x2D, 0x29, 0x1A, 0x35, 0x26, 0x17, 0x2D,
-    0x1E, 0x10, 0x2D, 0x1E, 0x10, 0x26, 0x1E, 0x12, 0x22, 0x15, 0x09, 0x1B, 0x14, 0x0A, 0x22, 0x13,
-    0x04, 0x26, 0x1E, 0x12, 0x2D, 0x1E, 0x10, 0x24, 0x1A, 0x11, 0x24, 0x1A, 0x11, 0x1B, 0x14, 0x0A,
-    0x35, 0x26, 0x17, 0x4A, 0x3D, 0x34, 0x05, 0x05, 0x08, 0x29, 0x25, 0x2E, 0x1F, 0x1E, 0x1E, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x35, 0x34, 0x3A, 0x0F, 0x02, 0x01, 0x1E, 0x01,
-    0x01, 0x1E, 0x01, 0x01, 0x1E, 0x01, 0x01, 0x1E, 0x01, 0x01, 0x1E, 0x01, 0x01, 0x1E, 0x01, 0x01,
-    0x1E, 0x01, 0x01, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x23, 0x22, 0x1B, 0x03,
-    0x01, 0x02, 0x27, 0x26, 0x24, 0x37, 0x36, 0x34, 0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x44, 0x43,
-    0x43, 0x5F, 0x5E, 0x5D, 0x61, 0x5F, 0x64, 0x61, 0x5F, 0x64, 0x5B, 0x5A, 0x5B, 0x42, 0x3D, 0x45,
-    0x97, 0x96, 0x99, 0x42, 0x3D, 0x45, 0x3E, 0x3E, 0x3F, 0x5F, 0x5E, 0x5D, 0x2F, 0x2E, 0x2B, 0x63,
-    0x62, 0x61, 0x5C, 0x5C, 0x55, 0x5F, 0x5E, 0x5D, 0x63, 0x62, 0x61, 0x63, 0x62, 0x5B, 0x9B, 0x9A,
-    0x95, 0x9B, 0x9A, 0x95, 0x3D, 0x3A, 0x35, 0x63, 0x62, 0x5B, 0x9F, 0x9E, 0x9D, 0x63, 0x62, 0x5B,
-    0x57, 0x56, 0x54, 0x5C, 0x5C, 0x55, 0x63, 0x62, 0x61, 0x5C, 0x5C, 0x55, 0x96, 0x95, 0x94, 0x9A,
-    0x9A, 0x9A, 0x32, 0x32, 0x2D, 0x5F, 0x5E, 0x5D, 0x38, 0x39, 0x35, 0x65, 0x65, 0x66, 0x32, 0x33,
-    0x32, 0x39, 0x39, 0x3A, 0x63, 0x62, 0x61, 0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x37, 0x36, 0x34,
-    0x61, 0x5F, 0x64, 0x32, 0x33, 0x32, 0x32, 0x33, 0x32, 0x3E, 0x3E, 0x3F, 0x32, 0x33, 0x32, 0x34,
-    0x35, 0x2E, 0x38, 0x39, 0x35, 0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E, 0x38, 0x39,
-    0x35, 0x3E, 0x3E, 0x36, 0x38, 0x39, 0x35, 0x34, 0x35, 0x2E, 0x46, 0x45, 0x47, 0x37, 0x36, 0x34,
-    0x39, 0x39, 0x3A, 0x03, 0x01, 0x02, 0x22, 0x15, 0x09, 0x1B, 0x1A, 0x0B, 0x22, 0x13, 0x04, 0x22,
-    0x15, 0x09, 0x24, 0x1A, 0x11, 0x21, 0x16, 0x0F, 0x22, 0x15, 0x09, 0x22, 0x15, 0x09, 0x2D, 0x29,
-    0x1A, 0x36, 0x29, 0x13, 0x38, 0x29, 0x18, 0x36, 0x29, 0x13, 0x41, 0x38, 0x23, 0x31, 0x22, 0x12,
-    0x4B, 0x3D, 0x2C, 0x0F, 0x02, 0x01, 0x3C, 0x25, 0x10, 0x36, 0x29, 0x13, 0x3C, 0x25, 0x10, 0x4F,
-    0x3A, 0x23, 0x35, 0x26, 0x17, 0x2C, 0x1A, 0x09, 0x36, 0x29, 0x13, 0x34, 0x26, 0x12, 0x35, 0x26,
-    0x17, 0x42, 0x33, 0x22, 0x30, 0x1D, 0x09, 0x22, 0x13, 0x04, 0x38, 0x29, 0x18, 0x31, 0x22, 0x12,
-    0x38, 0x29, 0x18, 0x31, 0x22, 0x12, 0x37, 0x2A, 0x1C, 0x37, 0x2A, 0x1C, 0x2E, 0x26, 0x1A, 0x26,
-    0x1E, 0x12, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x22, 0x15, 0x09, 0x22, 0x15, 0x09, 0x21, 0x16,
-    0x0F, 0x26, 0x1E, 0x12, 0x2B, 0x22, 0x18, 0x2D, 0x1E, 0x10, 0x31, 0x22, 0x12, 0x22, 0x15, 0x09,
-    0x35, 0x26, 0x17, 0x3D, 0x36, 0x2C, 0x0F, 0x02, 0x01, 0x29, 0x25, 0x2E, 0x29, 0x25, 0x2E, 0x28,
-    0x29, 0x23, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x5F, 0x5E, 0x5D, 0x5B, 0x5A, 0x5B, 0x39, 0x39,
-    0x3A, 0x34, 0x35, 0x2E, 0x32, 0x33, 0x32, 0x3E, 0x3E, 0x3F, 0x5B, 0x5A, 0x5B, 0x27, 0x26, 0x28,
-    0x23, 0x22, 0x1B, 0x2D, 0x29, 0x1A, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x23, 0x22, 0x1B, 0x03,
-    0x01, 0x02, 0x28, 0x29, 0x23, 0x39, 0x39, 0x3A, 0x35, 0x34, 0x3A, 0x35, 0x34, 0x3A, 0x35, 0x34,
-    0x3A, 0x35, 0x34, 0x3A, 0x2F, 0x2E, 0x30, 0x42, 0x3D, 0x45, 0x44, 0x43, 0x43, 0x97, 0x96, 0x99,
-    0xD8, 0xD6, 0xD9, 0xD8, 0xD6, 0xD9, 0x5B, 0x5A, 0x5B, 0x63, 0x62, 0x5B, 0x63, 0x62, 0x5B, 0x43,
-    0x43, 0x39, 0x3D, 0x3D, 0x3B, 0x3E, 0x3A, 0x2D, 0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E, 0x3D, 0x3A,
-    0x35, 0x1B, 0x14, 0x0A, 0x26, 0x23, 0x21, 0x20, 0x1D, 0x19, 0x2C, 0x2D, 0x24, 0x44, 0x3F, 0x3B,
-    0x43, 0x43, 0x39, 0x3D, 0x3D, 0x3B, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x37,
-    0x36, 0x34, 0x05, 0x06, 0x03, 0x32, 0x33, 0x32, 0x3E, 0x3E, 0x3F, 0x03, 0x01, 0x02, 0x39, 0x39,
-    0x3A, 0x37, 0x36, 0x34, 0x03, 0x01, 0x02, 0x43, 0x43, 0x3F, 0x38, 0x39, 0x35, 0x03, 0x01, 0x02,
-    0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x3F, 0x39, 0x39, 0x3A, 0x32, 0x32, 0x2D, 0x38, 0x39, 0x35, 0x34,
-    0x35, 0x2E, 0x38, 0x39, 0x35, 0x38, 0x39, 0x35, 0x34, 0x35, 0x2E, 0x38, 0x39, 0x35, 0x43, 0x43,
-    0x3F, 0x43, 0x43, 0x39, 0x43, 0x43, 0x3F, 0x4C, 0x4B, 0x49, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24,
-    0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x1B, 0x14, 0x0A, 0x1B, 0x14, 0x0A, 0x21, 0x16, 0x0F, 0x19,
-    0x13, 0x0E, 0x21, 0x16, 0x0F, 0x19, 0x13, 0x0E, 0x21, 0x16, 0x0F, 0x1B, 0x14, 0x0A, 0x2E, 0x26,
-    0x1A, 0x37, 0x2C, 0x21, 0x37, 0x2A, 0x1C, 0x35, 0x26, 0x17, 0x22, 0x15, 0x09, 0x35, 0x26, 0x17,
-    0x49, 0x38, 0x29, 0x0F, 0x02, 0x01, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x42,
-    0x33, 0x22, 0x49, 0x38, 0x29, 0x30, 0x1D, 0x09, 0x2E, 0x26, 0x1A, 0x35, 0x26, 0x17, 0x35, 0x26,
-    0x17, 0x4B, 0x3D, 0x2C, 0x3D, 0x36, 0x2C, 0x1C, 0x0E, 0x02, 0x3A, 0x2D, 0x1C, 0x28, 0x21, 0x11,
-    0x3A, 0x2D, 0x1C, 0x35, 0x26, 0x17, 0x2D, 0x29, 0x1A, 0x35, 0x26, 0x1F, 0x26, 0x1E, 0x12, 0x26,
-    0x1E, 0x12, 0x24, 0x1A, 0x11, 0x2E, 0x26, 0x1A, 0x16, 0x0F, 0x09, 0x1B, 0x1A, 0x0B, 0x19, 0x13,
-    0x0E, 0x28, 0x21, 0x11, 0x24, 0x1A, 0x11, 0x24, 0x1A, 0x11, 0x2D, 0x1E, 0x10, 0x22, 0x13, 0x04,
-    0x37, 0x2A, 0x1C, 0x3D, 0x36, 0x2C, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x32, 0x33, 0x32, 0x32,
-    0x33, 0x32, 0x2F, 0x2E, 0x30, 0x37, 0x36, 0x34, 0x32, 0x32, 0x2D, 0x28, 0x29, 0x23, 0x28, 0x26,
-    0x20, 0x37, 0x36, 0x34, 0x35, 0x34, 0x3A, 0x29, 0x25, 0x2E, 0x3D, 0x3D, 0x3B, 0x22, 0x26, 0x11,
-    0x7F, 0x97, 0x5A, 0xC4, 0xD7, 0x97, 0xC7, 0xD2, 0xAD, 0x24, 0x2B, 0x11, 0x2E, 0x26, 0x1A, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x21, 0x1E, 0x26, 0x29, 0x25, 0x2E, 0x29, 0x25,
-    0x2E, 0x29, 0x25, 0x2E, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x3E, 0x3E, 0x36,
-    0x5C, 0x5C, 0x55, 0x9B, 0x9A, 0x95, 0x63, 0x62, 0x5B, 0x5C, 0x5C, 0x55, 0x3E, 0x3E, 0x36, 0x28,
-    0x29, 0x23, 0x23, 0x22, 0x1B, 0x2D, 0x2A, 0x23, 0x3D, 0x36, 0x2C, 0x2E, 0x26, 0x1A, 0x20, 0x1D,
-    0x19, 0x2E, 0x26, 0x1A, 0x26, 0x1E, 0x12, 0x23, 0x22, 0x1B, 0x3E, 0x3A, 0x2D, 0x37, 0x2C, 0x21,
-    0x23, 0x22, 0x1B, 0x35, 0x26, 0x1F, 0x3D, 0x3A, 0x35, 0x26, 0x23, 0x21, 0x26, 0x23, 0x21, 0x28,
-    0x29, 0x23, 0x03, 0x01, 0x02, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x03, 0x01, 0x02, 0x28, 0x26,
-    0x20, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x03, 0x01, 0x02,
-    0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x32, 0x33, 0x32, 0x28, 0x29, 0x23, 0x38,
-    0x39, 0x35, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x36, 0x3E, 0x3E, 0x36, 0x43, 0x43, 0x39, 0x43, 0x43,
-    0x39, 0x48, 0x48, 0x41, 0x48, 0x48, 0x41, 0x23, 0x22, 0x1B, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29,
-    0x21, 0x1E, 0x26, 0x27, 0x26, 0x28, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x0F,
-    0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x21, 0x16,
-    0x0F, 0x1B, 0x14, 0x0A, 0x22, 0x13, 0x04, 0x22, 0x15, 0x09, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12,
-    0x49, 0x38, 0x29, 0x1E, 0x01, 0x01, 0x35, 0x26, 0x17, 0x37, 0x2A, 0x1C, 0x35, 0x26, 0x17, 0x35,
-    0x26, 0x17, 0x4A, 0x3D, 0x34, 0x39, 0x33, 0x2C, 0x2B, 0x22, 0x18, 0x2B, 0x22, 0x18, 0x2E, 0x26,
-    0x1A, 0x2B, 0x22, 0x18, 0x37, 0x2C, 0x21, 0x37, 0x2A, 0x1C, 0x2E, 0x26, 0x1A, 0x37, 0x2A, 0x1C,
-    0x30, 0x1F, 0x18, 0x37, 0x2A, 0x1C, 0x21, 0x16, 0x0F, 0x28, 0x21, 0x11, 0x37, 0x2C, 0x21, 0x24,
-    0x1A, 0x11, 0x26, 0x1E, 0x12, 0x1C, 0x1A, 0x13, 0x21, 0x16, 0x0F, 0x21, 0x16, 0x0F, 0x1B, 0x14,
-    0x0A, 0x24, 0x1A, 0x11, 0x24, 0x1A, 0x11, 0x2B, 0x22, 0x18, 0x2B, 0x22, 0x18, 0x22, 0x13, 0x04,
-    0x35, 0x26, 0x17, 0x49, 0x38, 0x29, 0x03, 0x01, 0x02, 0x28, 0x26, 0x20, 0x38, 0x39, 0x35, 0x38,
-    0x39, 0x35, 0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0x38, 0x39, 0x35, 0x34, 0x35, 0x2E, 0x3E, 0x3E,
-    0x36, 0x3E, 0x3E, 0x3F, 0x42, 0x3D, 0x45, 0x21, 0x1E, 0x26, 0x2F, 0x2E, 0x2B, 0x28, 0x34, 0x0F,
-    0x7C, 0x99, 0x51, 0xBD, 0xDD, 0x8D, 0xC1, 0xD1, 0xA1, 0x28, 0x34, 0x0F, 0x22, 0x26, 0x11, 0x5C,
-    0x5C, 0x55, 0x96, 0x95, 0x94, 0x0F, 0x02, 0x01, 0x29, 0x25, 0x2E, 0x21, 0x1E, 0x26, 0x35, 0x34,
-    0x3A, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x3A, 0x32, 0x32, 0x2D, 0x2D, 0x2A, 0x23, 0x28, 0x29, 0x23,
-    0x28, 0x2E, 0x19, 0x43, 0x43, 0x39, 0x5C, 0x5C, 0x55, 0x48, 0x48, 0x41, 0x23, 0x22, 0x1B, 0x20,
-    0x1D, 0x19, 0x2C, 0x2D, 0x24, 0x3D, 0x36, 0x2C, 0x3E, 0x3A, 0x2D, 0x2D, 0x2A, 0x23, 0x2B, 0x22,
-    0x18, 0x3D, 0x3A, 0x35, 0x3E, 0x3A, 0x2D, 0x1C, 0x1A, 0x13, 0x3D, 0x3A, 0x35, 0x23, 0x22, 0x1B,
-    0x2B, 0x22, 0x18, 0x27, 0x26, 0x24, 0x3E, 0x3E, 0x36, 0x2A, 0x2A, 0x29, 0x3D, 0x3A, 0x35, 0x23,
-    0x22, 0x1B, 0x05, 0x06, 0x03, 0x34, 0x35, 0x2E, 0x20, 0x1D, 0x19, 0x09, 0x0A, 0x03, 0x39, 0x39,
-    0x3A, 0x32, 0x32, 0x2D, 0x05, 0x06, 0x03, 0x37, 0x36, 0x34, 0x32, 0x32, 0x2D, 0x03, 0x01, 0x02,
-    0x32, 0x32, 0x2D, 0x2C, 0x2D, 0x24, 0x32, 0x33, 0x32, 0x38, 0x39, 0x35, 0x3D, 0x3D, 0x3B, 0x43,
-    0x43, 0x3F, 0x46, 0x47, 0x39, 0x48, 0x48, 0x41, 0x43, 0x43, 0x39, 0x48, 0x48, 0x41, 0x46, 0x47,
-    0x39, 0x22, 0x23, 0x22, 0x23, 0x22, 0x1B, 0x0A, 0x0A, 0x09, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28,
-    0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x35, 0x26, 0x1F, 0x27, 0x26, 0x24, 0x30, 0x1F, 0x18, 0x2E,
-    0x26, 0x1A, 0x1C, 0x1A, 0x13, 0x26, 0x1E, 0x12, 0x21, 0x16, 0x0F, 0x21, 0x16, 0x0F, 0x37, 0x2C,
-    0x21, 0x2E, 0x26, 0x1A, 0x37, 0x2C, 0x21, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x2D, 0x1E, 0x10,
-    0x4B, 0x3D, 0x2C, 0x0F, 0x02, 0x01, 0x30, 0x1F, 0x18, 0x37, 0x2A, 0x1C, 0x2B, 0x22, 0x18, 0x2B,
-    0x22, 0x18, 0x37, 0x2C, 0x21, 0x03, 0x01, 0x02, 0x30, 0x1F, 0x18, 0x0F, 0x02, 0x01, 0x03, 0x01,
-    0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x2E, 0x26, 0x1A, 0x35, 0x26, 0x1F, 0x2E, 0x26, 0x1A,
-    0x24, 0x1A, 0x11, 0x31, 0x22, 0x12, 0x37, 0x2A, 0x1C, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x37,
-    0x2A, 0x1C, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x16, 0x0F, 0x09, 0x1C, 0x1A, 0x13, 0x1B, 0x14,
-    0x0A, 0x21, 0x16, 0x0F, 0x21, 0x16, 0x0F, 0x2B, 0x22, 0x18, 0x35, 0x26, 0x17, 0x22, 0x15, 0x09,
-    0x35, 0x26, 0x17, 0x49, 0x38, 0x29, 0x03, 0x01, 0x02, 0x23, 0x22, 0x1B, 0x3B, 0x3F, 0x2E, 0x3B,
-    0x3F, 0x2E, 0x41, 0x42, 0x34, 0x38, 0x39, 0x35, 0x3D, 0x3D, 0x3B, 0x44, 0x3F, 0x3B, 0x37, 0x33,
-    0x32, 0x44, 0x43, 0x43, 0x42, 0x3D, 0x45, 0x44, 0x43, 0x43, 0x39, 0x33, 0x2C, 0x28, 0x34, 0x0F,
-    0x7F, 0x97, 0x5A, 0x7C, 0x99, 0x51, 0x8B, 0x9B, 0x75, 0x1B, 0x1A, 0x0B, 0x46, 0x47, 0x39, 0x41,
-    0x42, 0x34, 0x3B, 0x3F, 0x2E, 0x03, 0x01, 0x02, 0x28, 0x26, 0x20, 0x3B, 0x3F, 0x2E, 0x41, 0x42,
-    0x34, 0x3E, 0x3E, 0x36, 0x3E, 0x3E, 0x36, 0x33, 0x32, 0x23, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23,
-    0x34, 0x35, 0x2E, 0x3E, 0x3E, 0x36, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E, 0x36, 0x38, 0x39, 0x35, 0x44,
-    0x3F, 0x3B, 0x37, 0x36, 0x34, 0x23, 0x22, 0x1B, 0x26, 0x23, 0x21, 0x23, 0x22, 0x1B, 0x1C, 0x1A,
-    0x13, 0x3D, 0x3D, 0x3B, 0x39, 0x33, 0x2C, 0x23, 0x22, 0x1B, 0x39, 0x33, 0x2C, 0x3D, 0x3D, 0x3B,
-    0x32, 0x32, 0x2D, 0x2A, 0x2A, 0x29, 0x37, 0x36, 0x34, 0x2E, 0x26, 0x1A, 0x2D, 0x2A, 0x23, 0x28,
-    0x26, 0x20, 0x03, 0x01, 0x02, 0x44, 0x3F, 0x3B, 0x3E, 0x3E, 0x36, 0x03, 0x01, 0x02, 0x3E, 0x3E,
-    0x36, 0x43, 0x43, 0x3F, 0x03, 0x01, 0x02, 0x3E, 0x3E, 0x36, 0x48, 0x48, 0x41, 0x03, 0x01, 0x02,
-    0x37, 0x36, 0x34, 0x3D, 0x3D, 0x3B, 0x48, 0x48, 0x41, 0x48, 0x48, 0x41, 0x4B, 0x4B, 0x42, 0x46,
-    0x47, 0x39, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x39, 0x52, 0x52, 0x4C, 0x3D, 0x3D, 0x3B, 0x28, 0x26,
-    0x20, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22,
-    0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x21, 0x16, 0x0F, 0x21, 0x16, 0x0F, 0x21, 0x16, 0x0F, 0x21,
-    0x16, 0x0F, 0x21, 0x16, 0x0F, 0x21, 0x16, 0x0F, 0x1B, 0x14, 0x0A, 0x1B, 0x14, 0x0A, 0x37, 0x2A,
-    0x1C, 0x2B, 0x22, 0x18, 0x2E, 0x26, 0x1A, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x36, 0x29, 0x13,
-    0x34, 0x26, 0x12, 0x34, 0x26, 0x12, 0x3A, 0x2D, 0x1C, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x0F,
-    0x02, 0x01, 0x03, 0x01, 0x02, 0x2D, 0x1E, 0x10, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x03, 0x01,
-    0x02, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x31, 0x22, 0x12,
-    0x37, 0x2A, 0x1C, 0x31, 0x22, 0x12, 0x3F, 0x23, 0x08, 0x3F, 0x23, 0x08, 0x38, 0x29, 0x18, 0x22,
-    0x13, 0x04, 0x31, 0x22, 0x12, 0x22, 0x15, 0x09, 0x26, 0x1E, 0x12, 0x16, 0x0F, 0x09, 0x1C, 0x1A,
-    0x13, 0x1A, 0x16, 0x11, 0x21, 0x16, 0x0F, 0x24, 0x1A, 0x11, 0x2B, 0x22, 0x18, 0x22, 0x15, 0x09,
-    0x35, 0x26, 0x17, 0x4A, 0x38, 0x30, 0x03, 0x01, 0x02, 0x28, 0x29, 0x23, 0x46, 0x47, 0x39, 0x40,
-    0x4C, 0x33, 0x47, 0x4C, 0x39, 0x43, 0x43, 0x39, 0x4E, 0x44, 0x40, 0x44, 0x43, 0x43, 0x4C, 0x4B,
-    0x49, 0x3E, 0x3E, 0x36, 0x57, 0x56, 0x54, 0x3E, 0x3E, 0x36, 0x3E, 0x3E, 0x36, 0x43, 0x47, 0x2F,
-    0x1F, 0x2B, 0x04, 0x25, 0x33, 0x03, 0x1F, 0x2B, 0x04, 0x40, 0x4C, 0x33, 0x43, 0x47, 0x2F, 0x41,
-    0x42, 0x34, 0x46, 0x47, 0x39, 0x05, 0x06, 0x03, 0x22, 0x26, 0x11, 0x43, 0x43, 0x39, 0x40, 0x4C,
-    0x33, 0x46, 0x47, 0x39, 0x4D, 0x4F, 0x41, 0x4A, 0x3D, 0x34, 0x3B, 0x3F, 0x2E, 0x4A, 0x3D, 0x34,
-    0x46, 0x47, 0x39, 0x48, 0x48, 0x41, 0x43, 0x43, 0x39, 0x4B, 0x4B, 0x42, 0x43, 0x43, 0x3F, 0x46,
-    0x47, 0x39, 0x3E, 0x3E, 0x36, 0x3D, 0x36, 0x2C, 0x3D, 0x3A, 0x35, 0x3E, 0x3A, 0x2D, 0x44, 0x3F,
-    0x3B, 0x3E, 0x3A, 0x2D, 0x39, 0x33, 0x2C, 0x3D, 0x3A, 0x35, 0x3E, 0x3E, 0x36, 0x43, 0x43, 0x3F,
-    0x51, 0x48, 0x41, 0x44, 0x3F, 0x3B, 0x3E, 0x3E, 0x36, 0x3E, 0x3E, 0x36, 0x44, 0x3F, 0x3B, 0x3E,
-    0x3E, 0x36, 0x03, 0x01, 0x02, 0x4B, 0x4B, 0x42, 0x44, 0x43, 0x43, 0x05, 0x06, 0x03, 0x43, 0x43,
-    0x3F, 0x5C, 0x5C, 0x55, 0x03, 0x01, 0x02, 0x48, 0x48, 0x41, 0x57, 0x56, 0x54, 0x03, 0x01, 0x02,
-    0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x43, 0x43, 0x39, 0x43, 0x43, 0x39, 0x43, 0x43, 0x39, 0x57,
-    0x56, 0x54, 0x4B, 0x4B, 0x42, 0x3E, 0x3E, 0x36, 0x23, 0x22, 0x1B, 0x2C, 0x2D, 0x24, 0x05, 0x06,
-    0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x39, 0x39, 0x3A, 0x2A, 0x2A, 0x29,
-    0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x1B, 0x14, 0x0A, 0x16, 0x0F, 0x09, 0x21, 0x16, 0x0F, 0x1B,
-    0x14, 0x0A, 0x1B, 0x1A, 0x0B, 0x1B, 0x14, 0x0A, 0x1B, 0x1A, 0x0B, 0x21, 0x16, 0x0F, 0x2E, 0x26,
-    0x1A, 0x37, 0x2C, 0x21, 0x2E, 0x26, 0x1A, 0x35, 0x26, 0x17, 0x0F, 0x02, 0x01, 0x36, 0x29, 0x13,
-    0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x1E, 0x01, 0x01, 0x0F, 0x02, 0x01, 0x1E,
-    0x01, 0x01, 0x0F, 0x02, 0x01, 0x2B, 0x15, 0x13, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x1E, 0x01,
-    0x01, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01, 0x1E, 0x01, 0x01,
-    0x0F, 0x02, 0x01, 0x3C, 0x25, 0x10, 0x3F, 0x23, 0x08, 0x3F, 0x23, 0x08, 0x3F, 0x23, 0x08, 0x3E,
-    0x2A, 0x12, 0x34, 0x26, 0x12, 0x22, 0x13, 0x04, 0x1C, 0x0E, 0x02, 0x26, 0x1E, 0x12, 0x1A, 0x16,
-    0x11, 0x1A, 0x16, 0x11, 0x19, 0x13, 0x0E, 0x1B, 0x14, 0x0A, 0x21, 0x16, 0x0F, 0x22, 0x13, 0x04,
-    0x30, 0x1F, 0x18, 0x37, 0x2C, 0x21, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x3B, 0x43, 0x2B, 0x40,
-    0x4C, 0x33, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x48, 0x48,
-    0x41, 0x47, 0x4C, 0x39, 0x62, 0x62, 0x52, 0x5C, 0x5D, 0x43, 0x46, 0x47, 0x39, 0x54, 0x44, 0x36,
-    0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x43, 0x47, 0x2F, 0x43, 0x55, 0x39, 0x3B, 0x43, 0x2B, 0x46,
-    0x47, 0x39, 0x46, 0x47, 0x39, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24, 0x48, 0x48, 0x41, 0x43, 0x43,
-    0x3F, 0x43, 0x43, 0x39, 0x46, 0x47, 0x39, 0x4B, 0x4B, 0x42, 0x59, 0x57, 0x44, 0x57, 0x57, 0x4C,
-    0x62, 0x62, 0x52, 0x59, 0x57, 0x44, 0x62, 0x5E, 0x55, 0x57, 0x57, 0x4C, 0x46, 0x47, 0x39, 0x41,
-    0x42, 0x34, 0x4B, 0x4B, 0x42, 0x59, 0x57, 0x44, 0x62, 0x5E, 0x55, 0x5B, 0x5A, 0x4C, 0x68, 0x59,
-    0x4B, 0x62, 0x62, 0x52, 0x46, 0x47, 0x39, 0x4A, 0x3D, 0x34, 0x26, 0x1E, 0x12, 0x43, 0x43, 0x39,
-    0x47, 0x4C, 0x39, 0x43, 0x43, 0x39, 0x48, 0x48, 0x41, 0x51, 0x48, 0x41, 0x43, 0x43, 0x3F, 0x5B,
-    0x5A, 0x4C, 0x03, 0x01, 0x02, 0x44, 0x3F, 0x3B, 0x5C, 0x5C, 0x55, 0x03, 0x01, 0x02, 0x43, 0x43,
-    0x3F, 0x44, 0x43, 0x43, 0x05, 0x06, 0x03, 0x44, 0x43, 0x43, 0x44, 0x3F, 0x3B, 0x03, 0x01, 0x02,
-    0x48, 0x48, 0x41, 0x3E, 0x3E, 0x36, 0x47, 0x4C, 0x39, 0x46, 0x47, 0x39, 0x62, 0x62, 0x52, 0x5B,
-    0x5A, 0x4C, 0x4B, 0x4B, 0x42, 0x28, 0x29, 0x23, 0x63, 0x62, 0x5B, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x32, 0x33, 0x32, 0x27, 0x26, 0x28,
-    0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x24, 0x1A, 0x11, 0x21, 0x16, 0x0F, 0x24, 0x1A, 0x11, 0x19,
-    0x13, 0x0E, 0x1C, 0x1A, 0x13, 0x1B, 0x14, 0x0A, 0x21, 0x16, 0x0F, 0x1B, 0x14, 0x0A, 0x33, 0x32,
-    0x23, 0x24, 0x1A, 0x11, 0x37, 0x2C, 0x21, 0x37, 0x2A, 0x1C, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x01,
-    0x6D, 0x5E, 0x4C, 0x6D, 0x5E, 0x4C, 0x82, 0x5F, 0x44, 0x79, 0x5D, 0x48, 0x78, 0x59, 0x42, 0x78,
-    0x59, 0x42, 0x78, 0x59, 0x42, 0x78, 0x59, 0x42, 0x78, 0x61, 0x4A, 0x78, 0x59, 0x42, 0x5B, 0x4D,
-    0x3F, 0x82, 0x5F, 0x44, 0x78, 0x59, 0x42, 0x78, 0x59, 0x42, 0x7A, 0x56, 0x3A, 0x78, 0x59, 0x42,
-    0x7B, 0x5A, 0x3A, 0x85, 0x5A, 0x39, 0x7E, 0x55, 0x32, 0x88, 0x5A, 0x33, 0x74, 0x4C, 0x28, 0x3F,
-    0x23, 0x08, 0x3E, 0x2A, 0x12, 0x1C, 0x0E, 0x02, 0x24, 0x1B, 0x0C, 0x16, 0x0F, 0x09, 0x1A, 0x16,
-    0x11, 0x1A, 0x16, 0x11, 0x1C, 0x1A, 0x13, 0x19, 0x13, 0x0E, 0x21, 0x16, 0x0F, 0x1C, 0x12, 0x04,
-    0x24, 0x1A, 0x11, 0x26, 0x1E, 0x12, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x3B, 0x3F, 0x2E, 0x41,
-    0x42, 0x34, 0x3B, 0x3F, 0x2E, 0x46, 0x47, 0x39, 0x44, 0x43, 0x43, 0x43, 0x43, 0x3F, 0x41, 0x42,
-    0x34, 0x47, 0x4C, 0x39, 0x3B, 0x43, 0x2B, 0x3B, 0x3F, 0x2E, 0x4B, 0x4B, 0x42, 0x44, 0x3F, 0x3B,
-    0x3D, 0x3D, 0x3B, 0x4E, 0x44, 0x40, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x46,
-    0x47, 0x39, 0x38, 0x39, 0x35, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x2F, 0x2E, 0x30, 0x4E, 0x44,
-    0x40, 0x43, 0x43, 0x3F, 0x4A, 0x3D, 0x34, 0x41, 0x42, 0x34, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39,
-    0x51, 0x48, 0x41, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x43,
-    0x43, 0x39, 0x41, 0x42, 0x34, 0x41, 0x42, 0x34, 0x46, 0x47, 0x39, 0x58, 0x48, 0x38, 0x43, 0x43,
-    0x39, 0x41, 0x42, 0x34, 0x46, 0x47, 0x39, 0x43, 0x43, 0x39, 0x46, 0x47, 0x39, 0x2E, 0x26, 0x1A,
-    0x2E, 0x26, 0x1A, 0x2E, 0x26, 0x1A, 0x28, 0x26, 0x20, 0x26, 0x1E, 0x12, 0x28, 0x26, 0x20, 0x2B,
-    0x22, 0x18, 0x03, 0x01, 0x02, 0x2F, 0x2E, 0x2B, 0x23, 0x22, 0x1B, 0x03, 0x01, 0x02, 0x27, 0x26,
-    0x24, 0x28, 0x26, 0x20, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20, 0x03, 0x01, 0x02,
-    0x28, 0x26, 0x20, 0x2C, 0x2D, 0x24, 0x43, 0x43, 0x39, 0x41, 0x42, 0x34, 0x46, 0x47, 0x39, 0x4B,
-    0x4B, 0x42, 0x38, 0x39, 0x35, 0x28, 0x26, 0x20, 0x38, 0x39, 0x35, 0x05, 0x06, 0x03, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24,
-    0x27, 0x26, 0x24, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x5B, 0x5A,
-    0x5B, 0x9F, 0x9E, 0x9D, 0xBA, 0xB6, 0xB1, 0xB3, 0xB2, 0xB1, 0x62, 0x5E, 0x55, 0x2B, 0x22, 0x18,
-    0x4A, 0x38, 0x30, 0x61, 0x45, 0x2B, 0x78, 0x59, 0x42, 0x7E, 0x55, 0x32, 0x89, 0x56, 0x32, 0x82,
-    0x5F, 0x44, 0x7E, 0x55, 0x32, 0x7A, 0x56, 0x3A, 0x7A, 0x56, 0x3A, 0x85, 0x5A, 0x39, 0x86, 0x5E,
-    0x3C, 0x7A, 0x56, 0x3A, 0x85, 0x5A, 0x39, 0x89, 0x56, 0x32, 0x86, 0x5E, 0x3C, 0xAC, 0x72, 0x49,
-    0x86, 0x54, 0x2A, 0xAD, 0x77, 0x4B, 0xAD, 0x77, 0x4B, 0xAD, 0x77, 0x4B, 0x88, 0x5A, 0x33, 0x6F,
-    0x42, 0x1C, 0x4E, 0x34, 0x1A, 0x3C, 0x1E, 0x06, 0x22, 0x13, 0x04, 0x22, 0x15, 0x09, 0x1A, 0x16,
-    0x11, 0x1C, 0x1A, 0x13, 0x1C, 0x1A, 0x13, 0x1A, 0x16, 0x11, 0x24, 0x1A, 0x11, 0x19, 0x13, 0x0E,
-    0x22, 0x15, 0x09, 0x24, 0x1A, 0x11, 0x03, 0x01, 0x02, 0x1F, 0x1E, 0x1E, 0x27, 0x26, 0x24, 0x37,
-    0x2C, 0x21, 0x2D, 0x2A, 0x23, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x2E, 0x26,
-    0x1A, 0x2D, 0x29, 0x1A, 0x28, 0x29, 0x23, 0x28, 0x2E, 0x19, 0x28, 0x29, 0x23, 0x28, 0x26, 0x20,
-    0x28, 0x26, 0x20, 0x35, 0x26, 0x1F, 0x2C, 0x1F, 0x25, 0x2C, 0x1F, 0x25, 0x27, 0x26, 0x28, 0x27,
-    0x26, 0x28, 0x27, 0x26, 0x28, 0x0A, 0x0A, 0x09, 0x17, 0x18, 0x18, 0x2F, 0x2E, 0x30, 0x26, 0x23,
-    0x21, 0x2F, 0x2E, 0x2B, 0x27, 0x26, 0x24, 0x2D, 0x2A, 0x23, 0x28, 0x26, 0x20, 0x23, 0x22, 0x1B,
-    0x23, 0x22, 0x1B, 0x26, 0x23, 0x21, 0x28, 0x26, 0x20, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x2D,
-    0x2A, 0x23, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x27, 0x26,
-    0x24, 0x2D, 0x2A, 0x23, 0x30, 0x1F, 0x18, 0x28, 0x26, 0x20, 0x2D, 0x2A, 0x23, 0x27, 0x26, 0x24,
-    0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x1A, 0x16, 0x11, 0x21, 0x16, 0x0F, 0x20, 0x1D, 0x19, 0x27,
-    0x26, 0x24, 0x03, 0x01, 0x02, 0x16, 0x0F, 0x09, 0x26, 0x23, 0x21, 0x03, 0x01, 0x02, 0x1A, 0x16,
-    0x11, 0x27, 0x26, 0x24, 0x03, 0x01, 0x02, 0x1A, 0x16, 0x11, 0x27, 0x26, 0x24, 0x03, 0x01, 0x02,
-    0x1A, 0x16, 0x11, 0x28, 0x26, 0x20, 0x2D, 0x29, 0x1A, 0x40, 0x4C, 0x33, 0x3B, 0x3F, 0x2E, 0x47,
-    0x4C, 0x39, 0x3B, 0x3F, 0x2E, 0x22, 0x23, 0x22, 0x38, 0x39, 0x35, 0x03, 0x01, 0x02, 0x05, 0x05,
-    0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x37, 0x33, 0x32, 0x27, 0x26, 0x28,
-    0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x61, 0x5F,
-    0x64, 0x5B, 0x5A, 0x5B, 0xB5, 0xB5, 0xB5, 0x9A, 0x9A, 0x9A, 0x96, 0x95, 0x94, 0x62, 0x5E, 0x55,
-    0x37, 0x2C, 0x21, 0x49, 0x38, 0x29, 0x61, 0x45, 0x2B, 0x72, 0x48, 0x22, 0x6C, 0x47, 0x27, 0x69,
-    0x3C, 0x17, 0x6C, 0x47, 0x27, 0x72, 0x48, 0x22, 0x6F, 0x42, 0x1C, 0x72, 0x48, 0x22, 0x6F, 0x44,
-    0x20, 0x6F, 0x44, 0x20, 0x6F, 0x42, 0x1C, 0x6F, 0x44, 0x20, 0x69, 0x3C, 0x17, 0x72, 0x48, 0x22,
-    0x6F, 0x42, 0x1C, 0x86, 0x54, 0x2A, 0x89, 0x50, 0x24, 0xB1, 0x73, 0x45, 0xB1, 0x73, 0x45, 0x88,
-    0x5A, 0x33, 0x86, 0x54, 0x2A, 0x53, 0x32, 0x12, 0x3F, 0x23, 0x08, 0x36, 0x29, 0x13, 0x1C, 0x12,
-    0x04, 0x1B, 0x14, 0x0A, 0x1A, 0x16, 0x11, 0x19, 0x13, 0x0E, 0x1C, 0x1A, 0x13, 0x1B, 0x14, 0x0A,
-    0x1C, 0x12, 0x04, 0x21, 0x16, 0x0F, 0x03, 0x01, 0x02, 0x17, 0x18, 0x18, 0x2C, 0x1F, 0x25, 0x2C,
-    0x1F, 0x25, 0x2C, 0x1F, 0x25, 0x1D, 0x18, 0x18, 0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x1C, 0x1A,
-    0x13, 0x16, 0x0F, 0x09, 0x1C, 0x1A, 0x13, 0x19, 0x13, 0x0E, 0x17, 0x18, 0x18, 0x17, 0x18, 0x18,
-    0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x24, 0x0E, 0x13, 0x24, 0x0E, 0x13, 0x2C, 0x1F, 0x25, 0x27,
-    0x26, 0x28, 0x32, 0x33, 0x32, 0x03, 0x01, 0x02, 0x17, 0x18, 0x18, 0x22, 0x23, 0x22, 0x1D, 0x18,
-    0x18, 0x27, 0x26, 0x24, 0x19, 0x13, 0x0E, 0x1A, 0x16, 0x11, 0x17, 0x18, 0x18, 0x1D, 0x18, 0x18,
-    0x17, 0x18, 0x18, 0x1D, 0x18, 0x18, 0x17, 0x18, 0x18, 0x1A, 0x16, 0x11, 0x17, 0x18, 0x18, 0x19,
-    0x13, 0x0E, 0x1A, 0x16, 0x11, 0x1C, 0x1A, 0x13, 0x1A, 0x16, 0x11, 0x19, 0x13, 0x0E, 0x1A, 0x16,
-    0x11, 0x1A, 0x16, 0x11, 0x19, 0x13, 0x0E, 0x1D, 0x18, 0x18, 0x1A, 0x16, 0x11, 0x26, 0x23, 0x21,
-    0x2D, 0x2A, 0x23, 0x1D, 0x18, 0x18, 0x19, 0x13, 0x0E, 0x1C, 0x1A, 0x13, 0x16, 0x0F, 0x09, 0x2D,
-    0x2A, 0x23, 0x03, 0x01, 0x02, 0x1A, 0x16, 0x11, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x1C, 0x1A,
-    0x13, 0x2F, 0x2E, 0x2B, 0x03, 0x01, 0x02, 0x1F, 0x1E, 0x1E, 0x2D, 0x2A, 0x23, 0x03, 0x01, 0x02,
-    0x1C, 0x1A, 0x13, 0x1A, 0x16, 0x11, 0x22, 0x26, 0x11, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x41,
-    0x42, 0x34, 0x32, 0x32, 0x2D, 0x2C, 0x2D, 0x24, 0x32, 0x33, 0x32, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x3E, 0x3E, 0x3F, 0x22, 0x23, 0x22,
-    0x27, 0x26, 0x24, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E,
-    0x3F, 0x5B, 0x5A, 0x5B, 0x5F, 0x5E, 0x5D, 0x9A, 0x9A, 0x9A, 0x97, 0x96, 0x99, 0x96, 0x95, 0x94,
-    0x63, 0x62, 0x61, 0x26, 0x23, 0x21, 0x4F, 0x3A, 0x23, 0x6C, 0x4B, 0x2D, 0x61, 0x45, 0x2B, 0x6C,
-    0x47, 0x27, 0x72, 0x48, 0x22, 0x6F, 0x42, 0x1C, 0x72, 0x48, 0x22, 0x6F, 0x44, 0x20, 0x6F, 0x44,
-    0x20, 0x72, 0x48, 0x22, 0x6F, 0x44, 0x20, 0x72, 0x48, 0x22, 0x72, 0x48, 0x22, 0x6F, 0x42, 0x1C,
-    0x72, 0x48, 0x22, 0x6F, 0x42, 0x1C, 0x6F, 0x42, 0x1C, 0x89, 0x50, 0x24, 0x86, 0x54, 0x2A, 0xB1,
-    0x73, 0x45, 0xB1, 0x73, 0x45, 0x86, 0x54, 0x2A, 0x72, 0x48, 0x22, 0x53, 0x32, 0x12, 0x3F, 0x23,
-    0x08, 0x2C, 0x1A, 0x09, 0x1B, 0x14, 0x0A, 0x1C, 0x1A, 0x13, 0x16, 0x0F, 0x09, 0x24, 0x1B, 0x0C,
-    0x22, 0x15, 0x09, 0x22, 0x15, 0x09, 0x03, 0x01, 0x02, 0x1A, 0x16, 0x11, 0x27, 0x26, 0x28, 0x2A,
-    0x2A, 0x29, 0x27, 0x26, 0x28, 0x2F, 0x2E, 0x2B, 0x27, 0x26, 0x28, 0x28, 0x26, 0x20, 0x32, 0x32,
-    0x2D, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x17, 0x18, 0x18,
-    0x17, 0x18, 0x18, 0x19, 0x13, 0x0E, 0x1A, 0x16, 0x11, 0x2B, 0x15, 0x13, 0x1D, 0x18, 0x18, 0x26,
-    0x23, 0x21, 0x2F, 0x2E, 0x30, 0x03, 0x01, 0x02, 0x1D, 0x18, 0x18, 0x27, 0x26, 0x28, 0x2C, 0x1F,
-    0x25, 0x29, 0x25, 0x2E, 0x26, 0x23, 0x21, 0x29, 0x25, 0x2E, 0x1D, 0x18, 0x18, 0x22, 0x23, 0x22,
-    0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x17, 0x18, 0x18, 0x28, 0x26, 0x20, 0x1D, 0x18, 0x18, 0x1A,
-    0x16, 0x11, 0x1D, 0x18, 0x18, 0x1D, 0x18, 0x18, 0x24, 0x0E, 0x13, 0x19, 0x13, 0x0E, 0x1A, 0x16,
-    0x11, 0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x1C, 0x1A, 0x13, 0x26, 0x23, 0x21,
-    0x28, 0x26, 0x20, 0x1C, 0x1A, 0x13, 0x1C, 0x1A, 0x13, 0x26, 0x23, 0x21, 0x21, 0x16, 0x0F, 0x28,
-    0x26, 0x20, 0x03, 0x01, 0x02, 0x19, 0x13, 0x0E, 0x28, 0x29, 0x23, 0x03, 0x01, 0x02, 0x19, 0x13,
-    0x0E, 0x2D, 0x2A, 0x23, 0x03, 0x01, 0x02, 0x19, 0x13, 0x0E, 0x2D, 0x2A, 0x23, 0x03, 0x01, 0x02,
-    0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x2D, 0x29, 0x1A, 0x43, 0x43, 0x39, 0x5D, 0x5E, 0x4C, 0x47,
-    0x4C, 0x39, 0x32, 0x32, 0x2D, 0x28, 0x29, 0x23, 0x3E, 0x3E, 0x3F, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x39, 0x39, 0x3A, 0x2F, 0x2E, 0x2B,
-    0x27, 0x26, 0x24, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x05, 0x06, 0x03, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x3D, 0x3D, 0x3B, 0x39, 0x39,
-    0x3A, 0x46, 0x45, 0x47, 0x63, 0x62, 0x61, 0x57, 0x56, 0x54, 0x9A, 0x9A, 0x9A, 0xBD, 0xBB, 0xBA,
-    0x96, 0x95, 0x94, 0x62, 0x5E, 0x55, 0x35, 0x26, 0x17, 0x46, 0x2E, 0x19, 0x68, 0x48, 0x2D, 0x7B,
-    0x5A, 0x3A, 0x7A, 0x56, 0x3A, 0x85, 0x5A, 0x39, 0x85, 0x5A, 0x39, 0x7E, 0x55, 0x32, 0x83, 0x51,
-    0x2C, 0x7E, 0x55, 0x32, 0x7E, 0x55, 0x32, 0x85, 0x5A, 0x39, 0x89, 0x56, 0x32, 0x7E, 0x55, 0x32,
-    0x89, 0x56, 0x32, 0x85, 0x5A, 0x39, 0x88, 0x5A, 0x33, 0x89, 0x56, 0x32, 0xAC, 0x72, 0x49, 0x89,
-    0x50, 0x24, 0xA4, 0x68, 0x3C, 0xB1, 0x73, 0x45, 0xB1, 0x73, 0x45, 0xA4, 0x77, 0x51, 0x3F, 0x23,
-    0x08, 0x35, 0x26, 0x17, 0x1B, 0x14, 0x0A, 0x19, 0x13, 0x0E, 0x1F, 0x1E, 0x1E, 0x1B, 0x14, 0x0A,
-    0x1C, 0x12, 0x04, 0x22, 0x13, 0x04, 0x03, 0x01, 0x02, 0x1D, 0x18, 0x18, 0x27, 0x26, 0x24, 0x2F,
-    0x2E, 0x30, 0x2A, 0x2A, 0x29, 0x2F, 0x2E, 0x2B, 0x2F, 0x2E, 0x2B, 0x27, 0x26, 0x24, 0x2F, 0x2E,
-    0x2B, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24,
-    0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x20, 0x1D, 0x19, 0x1C, 0x1A, 0x13, 0x1A, 0x16, 0x11, 0x26,
-    0x23, 0x21, 0x2F, 0x2E, 0x2B, 0x03, 0x01, 0x02, 0x1D, 0x18, 0x18, 0x2F, 0x2E, 0x30, 0x37, 0x33,
-    0x32, 0x2F, 0x2E, 0x30, 0x29, 0x25, 0x2E, 0x2F, 0x2E, 0x30, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28,
-    0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x20,
-    0x1D, 0x19, 0x35, 0x26, 0x1F, 0x1A, 0x16, 0x11, 0x1D, 0x18, 0x18, 0x2B, 0x15, 0x13, 0x20, 0x1D,
-    0x19, 0x19, 0x13, 0x0E, 0x1C, 0x1A, 0x13, 0x16, 0x0F, 0x09, 0x1C, 0x1A, 0x13, 0x28, 0x26, 0x20,
-    0x28, 0x26, 0x20, 0x26, 0x23, 0x21, 0x23, 0x22, 0x1B, 0x35, 0x26, 0x1F, 0x1D, 0x18, 0x18, 0x28,
-    0x26, 0x20, 0x03, 0x01, 0x02, 0x1A, 0x16, 0x11, 0x2F, 0x2E, 0x2B, 0x03, 0x01, 0x02, 0x1C, 0x1A,
-    0x13, 0x2F, 0x2E, 0x2B, 0x03, 0x01, 0x02, 0x1A, 0x16, 0x11, 0x2A, 0x2A, 0x29, 0x0F, 0x02, 0x01,
-    0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x2D, 0x29, 0x1A, 0x46, 0x47, 0x39, 0x5C, 0x5C, 0x55, 0x4B,
-    0x4B, 0x42, 0x34, 0x35, 0x2E, 0x2C, 0x2D, 0x24, 0x5C, 0x5C, 0x55, 0x05, 0x06, 0x03, 0x0A, 0x0A,
-    0x09, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x39, 0x39, 0x3A, 0x1F, 0x1E, 0x1E,
-    0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x44, 0x43, 0x43, 0x3E, 0x3E, 0x3F, 0x3D, 0x3D,
-    0x3B, 0x39, 0x39, 0x3A, 0x3E, 0x3E, 0x3F, 0x63, 0x62, 0x61, 0x5B, 0x5A, 0x5B, 0x9A, 0x9A, 0x9A,
-    0xB5, 0xB5, 0xB5, 0xBD, 0xBB, 0xBA, 0x68, 0x59, 0x4B, 0x46, 0x2E, 0x19, 0x4F, 0x3A, 0x23, 0x66,
-    0x48, 0x33, 0x6C, 0x47, 0x27, 0x61, 0x45, 0x2B, 0x6C, 0x47, 0x27, 0x74, 0x4C, 0x28, 0x6C, 0x4B,
-    0x2D, 0x6C, 0x4B, 0x2D, 0x6C, 0x47, 0x27, 0x6C, 0x47, 0x27, 0x68, 0x48, 0x2D, 0x6C, 0x47, 0x27,
-    0x68, 0x48, 0x2D, 0x6F, 0x44, 0x20, 0x61, 0x45, 0x2B, 0x6C, 0x47, 0x27, 0x6C, 0x47, 0x27, 0x6F,
-    0x42, 0x1C, 0x86, 0x54, 0x2A, 0x69, 0x3C, 0x17, 0x74, 0x4C, 0x28, 0x3C, 0x1E, 0x06, 0x34, 0x26,
-    0x12, 0x37, 0x2C, 0x21, 0x03, 0x01, 0x02, 0x19, 0x13, 0x0E, 0x1A, 0x16, 0x11, 0x19, 0x13, 0x0E,
-    0x19, 0x13, 0x0E, 0x20, 0x1D, 0x19, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x32,
-    0x33, 0x32, 0x2F, 0x2E, 0x2B, 0x2A, 0x2A, 0x29, 0x2F, 0x2E, 0x2B, 0x28, 0x26, 0x20, 0x22, 0x23,
-    0x22, 0x2F, 0x2E, 0x2B, 0x2C, 0x2D, 0x24, 0x28, 0x26, 0x20, 0x17, 0x18, 0x18, 0x2C, 0x2D, 0x24,
-    0x28, 0x26, 0x20, 0x1A, 0x16, 0x11, 0x20, 0x1D, 0x19, 0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x2E,
-    0x26, 0x1A, 0x2F, 0x2E, 0x2B, 0x03, 0x01, 0x02, 0x1A, 0x16, 0x11, 0x2F, 0x2E, 0x30, 0x2F, 0x2E,
-    0x2B, 0x2F, 0x2E, 0x30, 0x32, 0x33, 0x32, 0x2A, 0x2A, 0x29, 0x2F, 0x2E, 0x30, 0x2F, 0x2E, 0x30,
-    0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x28, 0x29, 0x23, 0x27, 0x26, 0x24, 0x2A,
-    0x2A, 0x29, 0x1F, 0x1E, 0x1E, 0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x21, 0x16, 0x0F, 0x20, 0x1D,
-    0x19, 0x35, 0x26, 0x1F, 0x19, 0x13, 0x0E, 0x20, 0x1D, 0x19, 0x1A, 0x16, 0x11, 0x28, 0x26, 0x20,
-    0x2D, 0x2A, 0x23, 0x27, 0x26, 0x24, 0x26, 0x23, 0x21, 0x27, 0x26, 0x28, 0x1D, 0x18, 0x18, 0x27,
-    0x26, 0x28, 0x03, 0x01, 0x02, 0x1D, 0x18, 0x18, 0x32, 0x32, 0x2D, 0x03, 0x01, 0x02, 0x17, 0x18,
-    0x18, 0x2F, 0x2E, 0x2B, 0x03, 0x01, 0x02, 0x1D, 0x18, 0x18, 0x2F, 0x2E, 0x2B, 0x03, 0x01, 0x02,
-    0x17, 0x18, 0x18, 0x1A, 0x16, 0x11, 0x23, 0x22, 0x1B, 0x41, 0x42, 0x34, 0x5D, 0x5E, 0x4C, 0x43,
-    0x43, 0x39, 0x34, 0x35, 0x2E, 0x22, 0x23, 0x22, 0x63, 0x62, 0x5B, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x39, 0x39, 0x3A, 0x27, 0x26, 0x28,
-    0x26, 0x23, 0x21, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x0A, 0x0A, 0x09, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x3E, 0x3E, 0x3F, 0x32, 0x33, 0x32, 0x32, 0x33,
-    0x32, 0x35, 0x34, 0x3A, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E, 0x3F, 0x65, 0x65, 0x66, 0x57, 0x56, 0x54,
-    0xC3, 0xC3, 0xC2, 0x57, 0x56, 0x54, 0x68, 0x59, 0x4B, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x4D,
-    0x36, 0x21, 0x4D, 0x36, 0x21, 0x55, 0x35, 0x19, 0x55, 0x35, 0x19, 0x55, 0x35, 0x19, 0x53, 0x32,
-    0x12, 0x55, 0x35, 0x19, 0x53, 0x32, 0x12, 0x55, 0x35, 0x19, 0x4E, 0x34, 0x1A, 0x53, 0x32, 0x12,
-    0x55, 0x35, 0x19, 0x55, 0x35, 0x19, 0x4D, 0x36, 0x21, 0x57, 0x3B, 0x23, 0x53, 0x32, 0x12, 0x53,
-    0x32, 0x12, 0x53, 0x32, 0x12, 0x3C, 0x1E, 0x06, 0x3F, 0x23, 0x08, 0x3C, 0x25, 0x10, 0x38, 0x29,
-    0x18, 0x23, 0x22, 0x1B, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x17, 0x18, 0x18,
-    0x1D, 0x18, 0x18, 0x1A, 0x16, 0x11, 0x03, 0x01, 0x02, 0x1A, 0x16, 0x11, 0x17, 0x18, 0x18, 0x23,
-    0x22, 0x1B, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x27, 0x26,
-    0x24, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x28, 0x26, 0x20, 0x20, 0x1D, 0x19, 0x28, 0x26, 0x20,
-    0x1F, 0x1E, 0x1E, 0x1C, 0x1A, 0x13, 0x19, 0x13, 0x0E, 0x1A, 0x16, 0x11, 0x1C, 0x1A, 0x13, 0x28,
-    0x26, 0x20, 0x2C, 0x2D, 0x24, 0x03, 0x01, 0x02, 0x19, 0x13, 0x0E, 0x2A, 0x2A, 0x29, 0x27, 0x26,
-    0x24, 0x2F, 0x2E, 0x2B, 0x37, 0x36, 0x34, 0x28, 0x29, 0x23, 0x32, 0x32, 0x2D, 0x28, 0x29, 0x23,
-    0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x23, 0x22, 0x1B, 0x22, 0x23, 0x22, 0x23, 0x22, 0x1B, 0x2F,
-    0x2E, 0x2B, 0x28, 0x26, 0x20, 0x35, 0x26, 0x1F, 0x27, 0x26, 0x24, 0x35, 0x26, 0x1F, 0x26, 0x23,
-    0x21, 0x20, 0x1D, 0x19, 0x26, 0x23, 0x21, 0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x27, 0x26, 0x24,
-    0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x1D, 0x18, 0x18, 0x2F,
-    0x2E, 0x30, 0x03, 0x01, 0x02, 0x1D, 0x18, 0x18, 0x2F, 0x2E, 0x30, 0x03, 0x01, 0x02, 0x1A, 0x16,
-    0x11, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x1D, 0x18, 0x18, 0x2F, 0x2E, 0x2B, 0x03, 0x01, 0x02,
-    0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x28, 0x26, 0x20, 0x48, 0x48, 0x41, 0x62, 0x5E, 0x55, 0x46,
-    0x47, 0x39, 0x38, 0x39, 0x35, 0x27, 0x26, 0x24, 0x5C, 0x5C, 0x55, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x1F, 0x1E, 0x1E,
-    0x2A, 0x2A, 0x29, 0x26, 0x23, 0x21, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x39, 0x39, 0x3A, 0x38, 0x39,
-    0x35, 0x38, 0x39, 0x35, 0x32, 0x32, 0x2D, 0x3E, 0x3E, 0x3F, 0x3D, 0x3A, 0x35, 0x5B, 0x5A, 0x5B,
-    0x5C, 0x5C, 0x55, 0x43, 0x43, 0x3F, 0x4A, 0x38, 0x30, 0x2F, 0x2E, 0x2B, 0x37, 0x2C, 0x21, 0x4D,
-    0x36, 0x21, 0x49, 0x38, 0x29, 0x4D, 0x36, 0x21, 0x57, 0x3B, 0x23, 0x46, 0x2E, 0x19, 0x4E, 0x34,
-    0x1A, 0x4D, 0x36, 0x21, 0x4D, 0x36, 0x21, 0x4D, 0x36, 0x21, 0x4E, 0x34, 0x1A, 0x4D, 0x36, 0x21,
-    0x4E, 0x34, 0x1A, 0x4D, 0x36, 0x21, 0x4F, 0x3A, 0x23, 0x3A, 0x2D, 0x1C, 0x4F, 0x3A, 0x23, 0x4E,
-    0x34, 0x1A, 0x3C, 0x25, 0x10, 0x3E, 0x2A, 0x12, 0x31, 0x22, 0x12, 0x31, 0x22, 0x12, 0x37, 0x2A,
-    0x1C, 0x35, 0x26, 0x1F, 0x27, 0x26, 0x24, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x24, 0x0E, 0x13,
-    0x1F, 0x1E, 0x1E, 0x0E, 0x0D, 0x0D, 0x03, 0x01, 0x02, 0x1C, 0x1A, 0x13, 0x17, 0x18, 0x18, 0x1C,
-    0x1A, 0x13, 0x1A, 0x16, 0x11, 0x20, 0x1D, 0x19, 0x19, 0x13, 0x0E, 0x1C, 0x1A, 0x13, 0x1A, 0x16,
-    0x11, 0x19, 0x13, 0x0E, 0x1A, 0x16, 0x11, 0x19, 0x13, 0x0E, 0x1C, 0x1A, 0x13, 0x17, 0x18, 0x18,
-    0x20, 0x1D, 0x19, 0x1C, 0x1A, 0x13, 0x1B, 0x14, 0x0A, 0x1C, 0x1A, 0x13, 0x26, 0x1E, 0x12, 0x28,
-    0x26, 0x20, 0x2F, 0x2E, 0x2B, 0x03, 0x01, 0x02, 0x1C, 0x1A, 0x13, 0x27, 0x26, 0x24, 0x2F, 0x2E,
-    0x2B, 0x23, 0x22, 0x1B, 0x22, 0x23, 0x22, 0x28, 0x26, 0x20, 0x2A, 0x2A, 0x29, 0x1A, 0x16, 0x11,
-    0x1C, 0x1A, 0x13, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x23,
-    0x22, 0x1B, 0x26, 0x23, 0x21, 0x1C, 0x1A, 0x13, 0x23, 0x22, 0x1B, 0x1A, 0x16, 0x11, 0x1A, 0x16,
-    0x11, 0x35, 0x26, 0x1F, 0x19, 0x13, 0x0E, 0x27, 0x26, 0x24, 0x19, 0x13, 0x0E, 0x27, 0x26, 0x24,
-    0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x1F, 0x1E, 0x1E, 0x1A, 0x16, 0x11, 0x27,
-    0x26, 0x24, 0x03, 0x01, 0x02, 0x1A, 0x16, 0x11, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x17, 0x18,
-    0x18, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x1D, 0x18, 0x18, 0x2F, 0x2E, 0x2B, 0x03, 0x01, 0x02,
-    0x19, 0x13, 0x0E, 0x1A, 0x16, 0x11, 0x23, 0x22, 0x1B, 0x43, 0x43, 0x39, 0x5B, 0x5A, 0x4C, 0x43,
-    0x43, 0x39, 0x34, 0x35, 0x2E, 0x28, 0x26, 0x20, 0x43, 0x43, 0x3F, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x35, 0x34, 0x3A, 0x22, 0x23, 0x22,
-    0x29, 0x25, 0x2E, 0x27, 0x26, 0x28, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x39, 0x39, 0x3A, 0x3D, 0x3D, 0x3B, 0x32, 0x33, 0x32, 0x27, 0x26,
-    0x28, 0x37, 0x36, 0x34, 0x3D, 0x3A, 0x35, 0x2F, 0x2E, 0x2B, 0x44, 0x43, 0x43, 0x65, 0x65, 0x66,
-    0x3E, 0x3E, 0x36, 0x3D, 0x3A, 0x35, 0x3D, 0x36, 0x2C, 0x3D, 0x36, 0x2C, 0x35, 0x26, 0x1F, 0x35,
-    0x26, 0x17, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x38, 0x29, 0x18, 0x3C, 0x25, 0x10, 0x31, 0x22,
-    0x12, 0x3C, 0x25, 0x10, 0x37, 0x2A, 0x1C, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17,
-    0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x3A, 0x2D, 0x1C, 0x22, 0x13, 0x04, 0x22,
-    0x15, 0x09, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x3A, 0x2D, 0x1C, 0x35, 0x26, 0x17, 0x2E, 0x26,
-    0x1A, 0x37, 0x2A, 0x1C, 0x2D, 0x2A, 0x23, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x0F, 0x02, 0x01, 0x1D, 0x18, 0x18, 0x03, 0x01, 0x02, 0x28, 0x26, 0x20, 0x44, 0x3F, 0x3B, 0x43,
-    0x43, 0x3F, 0x44, 0x3F, 0x3B, 0x48, 0x48, 0x41, 0x3D, 0x3D, 0x3B, 0x48, 0x48, 0x41, 0x43, 0x43,
-    0x3F, 0x43, 0x43, 0x3F, 0x4B, 0x4B, 0x42, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x3D, 0x3A, 0x35,
-    0x38, 0x39, 0x35, 0x28, 0x26, 0x20, 0x2D, 0x2A, 0x23, 0x2D, 0x2A, 0x23, 0x2E, 0x26, 0x1A, 0x28,
-    0x26, 0x20, 0x2D, 0x2A, 0x23, 0x03, 0x01, 0x02, 0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x26, 0x23,
-    0x21, 0x1C, 0x1A, 0x13, 0x19, 0x13, 0x0E, 0x1C, 0x1A, 0x13, 0x20, 0x1D, 0x19, 0x19, 0x13, 0x0E,
-    0x19, 0x13, 0x0E, 0x1A, 0x16, 0x11, 0x19, 0x13, 0x0E, 0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x1A,
-    0x16, 0x11, 0x1C, 0x1A, 0x13, 0x1A, 0x16, 0x11, 0x21, 0x16, 0x0F, 0x19, 0x13, 0x0E, 0x21, 0x16,
-    0x0F, 0x16, 0x0F, 0x09, 0x20, 0x1D, 0x19, 0x19, 0x13, 0x0E, 0x17, 0x18, 0x18, 0x28, 0x29, 0x23,
-    0x28, 0x29, 0x23, 0x27, 0x26, 0x24, 0x17, 0x18, 0x18, 0x1A, 0x16, 0x11, 0x17, 0x18, 0x18, 0x28,
-    0x26, 0x20, 0x03, 0x01, 0x02, 0x1A, 0x16, 0x11, 0x28, 0x29, 0x23, 0x03, 0x01, 0x02, 0x1A, 0x16,
-    0x11, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x1A, 0x16, 0x11, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02,
-    0x1A, 0x16, 0x11, 0x1C, 0x1A, 0x13, 0x28, 0x26, 0x20, 0x47, 0x4C, 0x39, 0x57, 0x57, 0x4C, 0x44,
-    0x43, 0x43, 0x34, 0x35, 0x2E, 0x2A, 0x2A, 0x29, 0x38, 0x39, 0x35, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28, 0x29, 0x25, 0x2E,
-    0x27, 0x26, 0x28, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x08, 0x06, 0x0F, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x3E, 0x3E, 0x3F, 0x3D, 0x3D, 0x3B, 0x37, 0x36, 0x34, 0x27, 0x26, 0x24, 0x26, 0x23,
-    0x21, 0x2A, 0x2A, 0x29, 0x39, 0x39, 0x3A, 0x3D, 0x3A, 0x35, 0x44, 0x3F, 0x3B, 0x5C, 0x5C, 0x55,
-    0x27, 0x26, 0x24, 0x37, 0x33, 0x32, 0x32, 0x32, 0x2D, 0x2D, 0x2A, 0x23, 0x26, 0x23, 0x21, 0x2D,
-    0x2A, 0x23, 0x37, 0x2A, 0x1C, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x37, 0x2A, 0x1C, 0x2C, 0x1A,
-    0x09, 0x22, 0x15, 0x09, 0x26, 0x1E, 0x12, 0x31, 0x22, 0x12, 0x2E, 0x26, 0x1A, 0x3A, 0x2D, 0x1C,
-    0x35, 0x26, 0x17, 0x37, 0x2A, 0x1C, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x37,
-    0x2A, 0x1C, 0x37, 0x2A, 0x1C, 0x26, 0x1E, 0x12, 0x37, 0x2C, 0x21, 0x35, 0x26, 0x1F, 0x2E, 0x26,
-    0x1A, 0x35, 0x26, 0x1F, 0x35, 0x26, 0x1F, 0x30, 0x1F, 0x18, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02,
-    0x0F, 0x02, 0x01, 0x26, 0x23, 0x21, 0x03, 0x01, 0x02, 0x2C, 0x2D, 0x24, 0x44, 0x3F, 0x3B, 0x48,
-    0x48, 0x41, 0x48, 0x48, 0x41, 0x48, 0x48, 0x41, 0x41, 0x42, 0x34, 0x43, 0x43, 0x3F, 0x43, 0x43,
-    0x3F, 0x43, 0x43, 0x39, 0x4B, 0x4B, 0x42, 0x57, 0x57, 0x4C, 0x63, 0x62, 0x5B, 0x5C, 0x5C, 0x55,
-    0x5C, 0x5C, 0x55, 0x5C, 0x5C, 0x55, 0x5C, 0x5C, 0x55, 0x52, 0x52, 0x4C, 0x4B, 0x4B, 0x42, 0x43,
-    0x43, 0x39, 0x41, 0x42, 0x34, 0x03, 0x01, 0x02, 0x2C, 0x2D, 0x24, 0x28, 0x26, 0x20, 0x28, 0x26,
-    0x20, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x26, 0x23, 0x21, 0x26, 0x23, 0x21, 0x2C, 0x2D, 0x24,
-    0x2D, 0x2A, 0x23, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x2C, 0x2D, 0x24, 0x26, 0x23, 0x21, 0x2C,
-    0x2D, 0x24, 0x23, 0x22, 0x1B, 0x23, 0x22, 0x1B, 0x1B, 0x1A, 0x0B, 0x1C, 0x1A, 0x13, 0x19, 0x13,
-    0x0E, 0x1C, 0x1A, 0x13, 0x19, 0x13, 0x0E, 0x1C, 0x1A, 0x13, 0x1A, 0x16, 0x11, 0x23, 0x22, 0x1B,
-    0x22, 0x23, 0x22, 0x1C, 0x1A, 0x13, 0x19, 0x13, 0x0E, 0x19, 0x13, 0x0E, 0x1C, 0x1A, 0x13, 0x28,
-    0x29, 0x23, 0x03, 0x01, 0x02, 0x1C, 0x1A, 0x13, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x1A, 0x16,
-    0x11, 0x2D, 0x2A, 0x23, 0x03, 0x01, 0x02, 0x1C, 0x1A, 0x13, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02,
-    0x1C, 0x1A, 0x13, 0x1C, 0x1A, 0x13, 0x28, 0x26, 0x20, 0x43, 0x43, 0x39, 0x4B, 0x4B, 0x42, 0x43,
-    0x43, 0x39, 0x32, 0x32, 0x2D, 0x22, 0x23, 0x22, 0x3D, 0x3D, 0x3B, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22,
-    0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05,
-    0x05, 0x08, 0x3E, 0x3E, 0x3F, 0x35, 0x34, 0x3A, 0x32, 0x33, 0x32, 0x2A, 0x2A, 0x29, 0x2A, 0x2A,
-    0x29, 0x26, 0x23, 0x21, 0x37, 0x36, 0x34, 0x44, 0x3F, 0x3B, 0x5C, 0x5C, 0x55, 0x44, 0x3F, 0x3B,
-    0x2D, 0x2A, 0x23, 0x3D, 0x3A, 0x35, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x2D, 0x2A, 0x23, 0x28,
-    0x26, 0x20, 0x22, 0x15, 0x09, 0x1B, 0x14, 0x0A, 0x21, 0x16, 0x0F, 0x28, 0x21, 0x11, 0x1B, 0x14,
-    0x0A, 0x1B, 0x14, 0x0A, 0x24, 0x1B, 0x0C, 0x21, 0x16, 0x0F, 0x24, 0x1A, 0x11, 0x2B, 0x22, 0x18,
-    0x21, 0x16, 0x0F, 0x22, 0x13, 0x04, 0x1C, 0x12, 0x04, 0x22, 0x15, 0x09, 0x22, 0x15, 0x09, 0x1B,
-    0x14, 0x0A, 0x1B, 0x14, 0x0A, 0x1B, 0x1A, 0x0B, 0x22, 0x15, 0x09, 0x1B, 0x14, 0x0A, 0x22, 0x13,
-    0x04, 0x22, 0x15, 0x09, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01,
-    0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x35, 0x26, 0x1F, 0x23, 0x22, 0x1B, 0x2E,
-    0x26, 0x1A, 0x28, 0x26, 0x20, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x2D, 0x29, 0x1A, 0x28, 0x26,
-    0x20, 0x28, 0x29, 0x23, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x44, 0x3F, 0x3B,
-    0x48, 0x48, 0x41, 0x43, 0x43, 0x39, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x43,
-    0x43, 0x3F, 0x43, 0x43, 0x3F, 0x03, 0x01, 0x02, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x39, 0x43, 0x43,
-    0x3F, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x4B, 0x4B, 0x42, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F,
-    0x44, 0x43, 0x43, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x46, 0x47, 0x39, 0x43,
-    0x43, 0x39, 0x4E, 0x44, 0x40, 0x2D, 0x2A, 0x23, 0x2B, 0x22, 0x18, 0x28, 0x26, 0x20, 0x2D, 0x2A,
-    0x23, 0x2E, 0x26, 0x1A, 0x27, 0x26, 0x24, 0x26, 0x23, 0x21, 0x28, 0x26, 0x20, 0x2A, 0x2A, 0x29,
-    0x28, 0x26, 0x20, 0x17, 0x18, 0x18, 0x1C, 0x1A, 0x13, 0x1C, 0x1A, 0x13, 0x1C, 0x1A, 0x13, 0x23,
-    0x22, 0x1B, 0x03, 0x01, 0x02, 0x1B, 0x1A, 0x0B, 0x23, 0x22, 0x1B, 0x05, 0x06, 0x03, 0x19, 0x13,
-    0x0E, 0x28, 0x29, 0x23, 0x03, 0x01, 0x02, 0x1B, 0x1A, 0x0B, 0x2C, 0x2D, 0x24, 0x03, 0x01, 0x02,
-    0x1C, 0x1A, 0x13, 0x28, 0x26, 0x20, 0x2D, 0x29, 0x1A, 0x43, 0x43, 0x39, 0x48, 0x48, 0x41, 0x43,
-    0x43, 0x3F, 0x34, 0x35, 0x2E, 0x2A, 0x2A, 0x29, 0x52, 0x52, 0x4C, 0x05, 0x06, 0x03, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29,
-    0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x39,
-    0x39, 0x3A, 0x35, 0x34, 0x3A, 0x39, 0x39, 0x3A, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x27, 0x26,
-    0x24, 0x37, 0x36, 0x34, 0x44, 0x3F, 0x3B, 0x63, 0x62, 0x5B, 0x5F, 0x5E, 0x5D, 0x19, 0x13, 0x0E,
-    0x3D, 0x36, 0x2C, 0x28, 0x26, 0x20, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x23,
-    0x22, 0x1B, 0x1C, 0x1A, 0x13, 0x19, 0x13, 0x0E, 0x1C, 0x12, 0x04, 0x21, 0x16, 0x0F, 0x21, 0x16,
-    0x0F, 0x19, 0x13, 0x0E, 0x21, 0x16, 0x0F, 0x19, 0x13, 0x0E, 0x21, 0x16, 0x0F, 0x21, 0x16, 0x0F,
-    0x19, 0x13, 0x0E, 0x22, 0x15, 0x09, 0x22, 0x15, 0x09, 0x1C, 0x12, 0x04, 0x21, 0x16, 0x0F, 0x19,
-    0x13, 0x0E, 0x1A, 0x16, 0x11, 0x17, 0x18, 0x18, 0x1A, 0x16, 0x11, 0x1B, 0x14, 0x0A, 0x24, 0x1B,
-    0x0C, 0x1C, 0x12, 0x04, 0x35, 0x26, 0x17, 0x22, 0x13, 0x04, 0x35, 0x26, 0x1F, 0x0F, 0x02, 0x01,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x44, 0x43, 0x43, 0x43, 0x43,
-    0x3F, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x44, 0x3F, 0x3B,
-    0x48, 0x48, 0x41, 0x43, 0x43, 0x39, 0x43, 0x43, 0x3F, 0x5C, 0x5C, 0x55, 0x5C, 0x5C, 0x55, 0x5C,
-    0x5C, 0x55, 0x5C, 0x5C, 0x55, 0x57, 0x57, 0x4C, 0x62, 0x5E, 0x55, 0x68, 0x59, 0x4B, 0x43, 0x43,
-    0x39, 0x4E, 0x44, 0x40, 0x43, 0x43, 0x39, 0x43, 0x43, 0x3F, 0x44, 0x43, 0x43, 0x48, 0x48, 0x41,
-    0x1F, 0x1E, 0x1E, 0x2A, 0x2A, 0x29, 0x28, 0x29, 0x23, 0x2C, 0x2D, 0x24, 0x28, 0x26, 0x20, 0x23,
-    0x22, 0x1B, 0x03, 0x01, 0x02, 0x28, 0x29, 0x23, 0x28, 0x26, 0x20, 0x03, 0x01, 0x02, 0x28, 0x26,
-    0x20, 0x28, 0x26, 0x20, 0x03, 0x01, 0x02, 0x28, 0x29, 0x23, 0x28, 0x26, 0x20, 0x05, 0x06, 0x03,
-    0x22, 0x23, 0x22, 0x28, 0x26, 0x20, 0x4B, 0x4B, 0x42, 0x41, 0x42, 0x34, 0x48, 0x48, 0x41, 0x43,
-    0x43, 0x39, 0x34, 0x35, 0x2E, 0x28, 0x26, 0x20, 0x23, 0x22, 0x1B, 0x2F, 0x2E, 0x2B, 0x28, 0x29,
-    0x23, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x2F, 0x2E, 0x2B, 0x44, 0x43, 0x43, 0x22, 0x23, 0x22,
-    0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x39, 0x39, 0x3A, 0x46,
-    0x45, 0x47, 0x39, 0x39, 0x3A, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x28, 0x29, 0x23, 0x37, 0x33,
-    0x32, 0x44, 0x3F, 0x3B, 0x37, 0x33, 0x32, 0x5B, 0x5A, 0x5B, 0x44, 0x3F, 0x3B, 0x1A, 0x16, 0x11,
-    0x2A, 0x2A, 0x29, 0x2F, 0x2E, 0x2B, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x28,
-    0x29, 0x23, 0x16, 0x0F, 0x09, 0x21, 0x16, 0x0F, 0x24, 0x1A, 0x11, 0x21, 0x16, 0x0F, 0x26, 0x1E,
-    0x12, 0x16, 0x0F, 0x09, 0x1A, 0x16, 0x11, 0x2D, 0x2A, 0x23, 0x28, 0x26, 0x20, 0x21, 0x16, 0x0F,
-    0x2D, 0x2A, 0x23, 0x21, 0x16, 0x0F, 0x21, 0x16, 0x0F, 0x21, 0x16, 0x0F, 0x19, 0x13, 0x0E, 0x19,
-    0x13, 0x0E, 0x1F, 0x1E, 0x1E, 0x1A, 0x16, 0x11, 0x22, 0x23, 0x22, 0x1C, 0x1A, 0x13, 0x16, 0x0F,
-    0x09, 0x22, 0x15, 0x09, 0x22, 0x15, 0x09, 0x22, 0x15, 0x09, 0x37, 0x2A, 0x1C, 0x2D, 0x2A, 0x23,
-    0x03, 0x01, 0x02, 0x1A, 0x16, 0x11, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x05, 0x06, 0x03, 0x20, 0x1D, 0x19, 0x05, 0x06, 0x03, 0x26, 0x1E, 0x12, 0x23, 0x22,
-    0x1B, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x3D,
-    0x3A, 0x35, 0x54, 0x44, 0x36, 0x48, 0x48, 0x41, 0x4A, 0x3D, 0x34, 0x48, 0x48, 0x41, 0x4E, 0x44,
-    0x40, 0x43, 0x43, 0x39, 0x44, 0x3F, 0x3B, 0x4E, 0x44, 0x40, 0x51, 0x48, 0x41, 0x43, 0x43, 0x3F,
-    0x46, 0x45, 0x47, 0x44, 0x3F, 0x3B, 0x43, 0x43, 0x39, 0x3D, 0x3D, 0x3B, 0x43, 0x43, 0x3F, 0x4C,
-    0x4B, 0x49, 0x03, 0x01, 0x02, 0x44, 0x43, 0x43, 0x51, 0x48, 0x41, 0x03, 0x01, 0x02, 0x48, 0x48,
-    0x41, 0x48, 0x48, 0x41, 0x03, 0x01, 0x02, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x03, 0x01, 0x02,
-    0x48, 0x48, 0x41, 0x48, 0x48, 0x41, 0x38, 0x39, 0x35, 0x4D, 0x4F, 0x41, 0x5C, 0x5C, 0x55, 0x5C,
-    0x5C, 0x55, 0x48, 0x48, 0x41, 0x4B, 0x4B, 0x42, 0x48, 0x48, 0x41, 0x44, 0x3F, 0x3B, 0x43, 0x43,
-    0x3F, 0x48, 0x48, 0x41, 0x46, 0x45, 0x47, 0x3E, 0x3E, 0x36, 0x44, 0x3F, 0x3B, 0x2A, 0x2A, 0x29,
-    0x2D, 0x2A, 0x23, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x3E, 0x3E, 0x3F, 0x35,
-    0x34, 0x3A, 0x37, 0x33, 0x32, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x26, 0x23, 0x21, 0x3D, 0x3D,
-    0x3B, 0x44, 0x3F, 0x3B, 0x27, 0x26, 0x24, 0x2D, 0x2A, 0x23, 0x26, 0x23, 0x21, 0x21, 0x16, 0x0F,
-    0x2C, 0x2D, 0x24, 0x20, 0x1D, 0x19, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x27,
-    0x26, 0x24, 0x35, 0x26, 0x1F, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0xFE, 0xFE, 0xFC,
-    0xF5, 0xF1, 0xEE, 0xB9, 0xB8, 0xB8, 0x37, 0x33, 0x32, 0x37, 0x33, 0x32, 0x35, 0x34, 0x3A, 0x3E,
-    0x3E, 0x3F, 0x1F, 0x1E, 0x1E, 0x65, 0x65, 0x66, 0x39, 0x39, 0x3A, 0x38, 0x39, 0x35, 0x34, 0x35,
-    0x2E, 0x38, 0x39, 0x35, 0x28, 0x29, 0x23, 0x95, 0x93, 0x8D, 0x57, 0x56, 0x54, 0x63, 0x62, 0x61,
-    0x43, 0x43, 0x3F, 0x2C, 0x2D, 0x24, 0x23, 0x22, 0x1B, 0x20, 0x1D, 0x19, 0x20, 0x1D, 0x19, 0x3E,
-    0x3A, 0x2D, 0x3D, 0x36, 0x2C, 0x20, 0x1D, 0x19, 0x1C, 0x1A, 0x13, 0x20, 0x1D, 0x19, 0x20, 0x1D,
-    0x19, 0x38, 0x39, 0x35, 0x34, 0x35, 0x2E, 0x27, 0x26, 0x24, 0x28, 0x29, 0x23, 0x2A, 0x2A, 0x29,
-    0x2C, 0x2D, 0x24, 0x43, 0x43, 0x3F, 0x65, 0x65, 0x66, 0x03, 0x01, 0x02, 0x35, 0x34, 0x3A, 0x3E,
-    0x3E, 0x3F, 0x37, 0x36, 0x34, 0x2A, 0x2A, 0x29, 0x63, 0x62, 0x61, 0x39, 0x39, 0x3A, 0x43, 0x43,
-    0x3F, 0x32, 0x32, 0x2D, 0x32, 0x32, 0x2D, 0x37, 0x33, 0x32, 0x37, 0x36, 0x34, 0x3D, 0x3A, 0x35,
-    0x2A, 0x2A, 0x29, 0x2D, 0x2A, 0x23, 0x57, 0x56, 0x54, 0x51, 0x48, 0x41, 0x2F, 0x2E, 0x2B, 0x2D,
-    0x2A, 0x23, 0x09, 0x0A, 0x03, 0x39, 0x33, 0x2C, 0x2E, 0x26, 0x1A, 0x1B, 0x14, 0x0A, 0x22, 0x15,
-    0x09, 0x19, 0x13, 0x0E, 0x2D, 0x2A, 0x23, 0x23, 0x22, 0x1B, 0x26, 0x23, 0x21, 0x23, 0x22, 0x1B,
-    0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x2F, 0x2E, 0x2B, 0x3E,
-    0x3E, 0x3F, 0x05, 0x06, 0x03, 0x44, 0x43, 0x43, 0x39, 0x39, 0x3A, 0x0A, 0x0A, 0x09, 0x44, 0x43,
-    0x43, 0x3E, 0x3E, 0x3F, 0x05, 0x06, 0x03, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02,
-    0x2A, 0x2A, 0x29, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x46, 0x47, 0x39, 0x3E, 0x3E, 0x36, 0x47,
-    0x4C, 0x39, 0x28, 0x29, 0x23, 0x26, 0x1E, 0x12, 0x2F, 0x2E, 0x2B, 0x28, 0x26, 0x20, 0x28, 0x26,
-    0x20, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x28, 0x26, 0x20, 0x39, 0x33, 0x2C, 0x23, 0x22, 0x1B,
-    0x20, 0x1D, 0x19, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x3E, 0x3E, 0x3F, 0x42, 0x3D, 0x45, 0x39,
-    0x39, 0x3A, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x37, 0x36,
-    0x34, 0x5C, 0x5C, 0x55, 0x2F, 0x2E, 0x2B, 0x4A, 0x3D, 0x34, 0x3D, 0x3A, 0x35, 0x27, 0x26, 0x24,
-    0x16, 0x0F, 0x09, 0x2F, 0x2E, 0x2B, 0x2A, 0x2A, 0x29, 0x17, 0x18, 0x18, 0x22, 0x23, 0x22, 0x1F,
-    0x1E, 0x1E, 0x09, 0x0A, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0xF5, 0xF1, 0xEE,
-    0xDC, 0xDB, 0xD9, 0x95, 0x93, 0x8D, 0x32, 0x33, 0x32, 0x35, 0x34, 0x3A, 0x32, 0x33, 0x32, 0x35,
-    0x34, 0x3A, 0x3E, 0x3E, 0x3F, 0x39, 0x39, 0x3A, 0x3E, 0x3E, 0x3F, 0x35, 0x34, 0x3A, 0x39, 0x39,
-    0x3A, 0x22, 0x23, 0x22, 0x5C, 0x5C, 0x55, 0x63, 0x62, 0x5B, 0x44, 0x43, 0x43, 0x32, 0x32, 0x2D,
-    0x17, 0x18, 0x18, 0x21, 0x1E, 0x26, 0x20, 0x1D, 0x19, 0x20, 0x1D, 0x19, 0x23, 0x22, 0x1B, 0x1C,
-    0x1A, 0x13, 0x37, 0x36, 0x34, 0x3D, 0x3A, 0x35, 0x37, 0x33, 0x32, 0x38, 0x39, 0x35, 0x2C, 0x2D,
-    0x24, 0x2F, 0x2E, 0x2B, 0x44, 0x43, 0x43, 0x5C, 0x5C, 0x55, 0x63, 0x62, 0x5B, 0x57, 0x56, 0x54,
-    0x39, 0x39, 0x3A, 0x32, 0x33, 0x32, 0x2A, 0x2A, 0x29, 0x05, 0x05, 0x08, 0x3E, 0x3E, 0x3F, 0x3E,
-    0x3E, 0x3F, 0x35, 0x34, 0x3A, 0x32, 0x32, 0x2D, 0x43, 0x43, 0x3F, 0x3D, 0x3D, 0x3B, 0x32, 0x32,
-    0x2D, 0x27, 0x26, 0x24, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x27, 0x26, 0x24, 0x39, 0x39, 0x3A,
-    0x43, 0x43, 0x3F, 0x57, 0x56, 0x54, 0x3D, 0x3D, 0x3B, 0x34, 0x35, 0x2E, 0x39, 0x33, 0x2C, 0x2D,
-    0x2A, 0x23, 0x03, 0x01, 0x02, 0x3D, 0x3A, 0x35, 0x2D, 0x2A, 0x23, 0x21, 0x16, 0x0F, 0x16, 0x0F,
-    0x09, 0x26, 0x1E, 0x12, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x43, 0x43, 0x3F, 0x32, 0x33, 0x32, 0x37,
-    0x36, 0x34, 0x22, 0x23, 0x22, 0x1F, 0x1E, 0x1E, 0x2A, 0x2A, 0x29, 0x37, 0x36, 0x34, 0x44, 0x3F,
-    0x3B, 0x3D, 0x3D, 0x3B, 0x26, 0x23, 0x21, 0x2F, 0x2E, 0x30, 0x39, 0x33, 0x2C, 0x2F, 0x2E, 0x2B,
-    0x28, 0x26, 0x20, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0xFE, 0xFE, 0xFC, 0xB9, 0xB8, 0xB8,
-    0x96, 0x95, 0x94, 0x63, 0x62, 0x61, 0x2A, 0x2A, 0x29, 0x61, 0x5F, 0x64, 0x35, 0x34, 0x3A, 0x35,
-    0x34, 0x3A, 0x35, 0x34, 0x3A, 0x22, 0x23, 0x22, 0x32, 0x33, 0x32, 0x2A, 0x2A, 0x29, 0x35, 0x34,
-    0x3A, 0x44, 0x43, 0x43, 0x3E, 0x3E, 0x3F, 0x35, 0x34, 0x3A, 0x27, 0x26, 0x28, 0x39, 0x39, 0x3A,
-    0x1A, 0x16, 0x11, 0x19, 0x13, 0x0E, 0x27, 0x26, 0x28, 0x35, 0x26, 0x1F, 0x37, 0x36, 0x34, 0x5C,
-    0x5C, 0x55, 0x44, 0x3F, 0x3B, 0x32, 0x32, 0x2D, 0x3E, 0x3E, 0x36, 0x32, 0x32, 0x2D, 0x2A, 0x2A,
-    0x29, 0x32, 0x32, 0x2D, 0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x3F,
-    0x27, 0x26, 0x24, 0x39, 0x39, 0x3A, 0x3E, 0x3E, 0x3F, 0x03, 0x01, 0x02, 0x35, 0x34, 0x3A, 0x44,
-    0x43, 0x43, 0x27, 0x26, 0x24, 0x32, 0x32, 0x2D, 0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0x34, 0x35,
-    0x2E, 0x28, 0x29, 0x23, 0x32, 0x32, 0x2D, 0x34, 0x35, 0x2E, 0x2F, 0x2E, 0x2B, 0x38, 0x39, 0x35,
-    0x32, 0x32, 0x2D, 0x3E, 0x3E, 0x36, 0x2A, 0x2A, 0x29, 0x2C, 0x1F, 0x25, 0x3D, 0x3A, 0x35, 0x37,
-    0x33, 0x32, 0x0F, 0x02, 0x01, 0x3D, 0x36, 0x2C, 0x2E, 0x26, 0x1A, 0x1C, 0x12, 0x04, 0x24, 0x1A,
-    0x11, 0x1B, 0x14, 0x0A, 0x37, 0x2C, 0x21, 0x03, 0x01, 0x02, 0x09, 0x0A, 0x03, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x4A, 0x3D, 0x34, 0x4A, 0x3D, 0x34, 0x4A, 0x38,
-    0x30, 0x3D, 0x36, 0x2C, 0x3D, 0x36, 0x2C, 0x37, 0x2C, 0x21, 0x3D, 0x36, 0x2C, 0x43, 0x43, 0x39,
-    0x2E, 0x26, 0x1A, 0x0F, 0x02, 0x01, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x35, 0x34, 0x3A, 0x2A,
-    0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x37, 0x33, 0x32, 0x3D, 0x3D, 0x3B, 0x5B, 0x5A,
-    0x5B, 0xBA, 0xB6, 0xB1, 0x27, 0x26, 0x24, 0x37, 0x36, 0x34, 0x2D, 0x2A, 0x23, 0x19, 0x13, 0x0E,
-    0x1A, 0x16, 0x11, 0x26, 0x23, 0x21, 0x2A, 0x2A, 0x29, 0x21, 0x1E, 0x26, 0x2A, 0x2A, 0x29, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0xE0, 0xDF, 0xDE, 0xB3, 0xB2, 0xB1, 0x96, 0x95, 0x94,
-    0x63, 0x62, 0x61, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x3A, 0x2F, 0x2E, 0x30, 0x37, 0x36, 0x34, 0x32,
-    0x33, 0x32, 0x39, 0x39, 0x3A, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x37, 0x36, 0x34, 0x22, 0x23,
-    0x22, 0x2F, 0x2E, 0x30, 0x44, 0x43, 0x43, 0x35, 0x34, 0x3A, 0x22, 0x23, 0x22, 0x35, 0x34, 0x3A,
-    0x20, 0x1D, 0x19, 0x1A, 0x16, 0x11, 0x26, 0x23, 0x21, 0x2D, 0x2A, 0x23, 0x63, 0x62, 0x5B, 0x4E,
-    0x44, 0x40, 0x2F, 0x2E, 0x2B, 0x3D, 0x3A, 0x35, 0x26, 0x23, 0x21, 0x2A, 0x2A, 0x29, 0x37, 0x36,
-    0x34, 0x39, 0x39, 0x3A, 0x37, 0x36, 0x34, 0x32, 0x33, 0x32, 0x32, 0x33, 0x32, 0x37, 0x36, 0x34,
-    0x27, 0x26, 0x28, 0x5F, 0x5E, 0x5D, 0x32, 0x33, 0x32, 0x03, 0x01, 0x02, 0x39, 0x39, 0x3A, 0x37,
-    0x36, 0x34, 0x39, 0x39, 0x3A, 0x28, 0x29, 0x23, 0x57, 0x56, 0x54, 0x3E, 0x3E, 0x36, 0x38, 0x39,
-    0x35, 0x23, 0x22, 0x1B, 0x20, 0x1D, 0x19, 0x20, 0x1D, 0x19, 0x28, 0x26, 0x20, 0x34, 0x35, 0x2E,
-    0x32, 0x32, 0x2D, 0x34, 0x35, 0x2E, 0x2F, 0x2E, 0x30, 0x2D, 0x2A, 0x23, 0x37, 0x36, 0x34, 0x35,
-    0x26, 0x1F, 0x03, 0x01, 0x02, 0x3D, 0x36, 0x2C, 0x33, 0x32, 0x23, 0x21, 0x16, 0x0F, 0x1C, 0x0E,
-    0x02, 0x21, 0x16, 0x0F, 0x2D, 0x29, 0x1A, 0x23, 0x22, 0x1B, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02,
-    0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2E, 0x26, 0x1A, 0x2B, 0x22, 0x18, 0x37, 0x2C,
-    0x21, 0x4A, 0x38, 0x30, 0x4A, 0x38, 0x30, 0x37, 0x2A, 0x1C, 0x2E, 0x26, 0x1A, 0x47, 0x2F, 0x20,
-    0x2D, 0x2A, 0x23, 0x35, 0x26, 0x17, 0x44, 0x43, 0x43, 0x2F, 0x2E, 0x30, 0x37, 0x36, 0x34, 0x2C,
-    0x1F, 0x25, 0x2A, 0x2A, 0x29, 0x2F, 0x2E, 0x2B, 0x43, 0x43, 0x3F, 0x5F, 0x5E, 0x5D, 0x5C, 0x5C,
-    0x55, 0x44, 0x43, 0x43, 0x35, 0x26, 0x1F, 0x3D, 0x3A, 0x35, 0x20, 0x1D, 0x19, 0x28, 0x26, 0x20,
-    0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x05, 0x05, 0x08, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x0A, 0x0A, 0x09, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0xFE, 0xFE, 0xFC, 0xB5, 0xB5, 0xB5, 0x97, 0x96, 0x99, 0x5F, 0x5E, 0x5D,
-    0x44, 0x43, 0x43, 0x44, 0x43, 0x43, 0x3E, 0x3E, 0x3F, 0x2A, 0x2A, 0x29, 0x32, 0x32, 0x2D, 0x2F,
-    0x2E, 0x2B, 0x23, 0x22, 0x1B, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x2F, 0x2E,
-    0x30, 0x27, 0x26, 0x28, 0x32, 0x33, 0x32, 0x22, 0x23, 0x22, 0x35, 0x34, 0x3A, 0x35, 0x26, 0x1F,
-    0x19, 0x13, 0x0E, 0x24, 0x0E, 0x13, 0x2A, 0x2A, 0x29, 0x23, 0x22, 0x1B, 0x3D, 0x3D, 0x3B, 0x32,
-    0x32, 0x2D, 0x37, 0x33, 0x32, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x22, 0x23,
-    0x22, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x21, 0x1E, 0x26,
-    0x27, 0x26, 0x28, 0x9A, 0x9A, 0x9A, 0x35, 0x34, 0x3A, 0x05, 0x05, 0x08, 0x32, 0x33, 0x32, 0x22,
-    0x23, 0x22, 0x2A, 0x2A, 0x29, 0x95, 0x93, 0x8D, 0x44, 0x3F, 0x3B, 0x32, 0x32, 0x2D, 0x20, 0x1D,
-    0x19, 0x20, 0x1D, 0x19, 0x23, 0x22, 0x1B, 0x23, 0x22, 0x1B, 0x20, 0x1D, 0x19, 0x20, 0x1D, 0x19,
-    0x27, 0x26, 0x24, 0x2D, 0x2A, 0x23, 0x27, 0x26, 0x28, 0x26, 0x23, 0x21, 0x2F, 0x2E, 0x2B, 0x2F,
-    0x2E, 0x2B, 0x0F, 0x02, 0x01, 0x37, 0x36, 0x34, 0x2B, 0x22, 0x18, 0x1B, 0x14, 0x0A, 0x24, 0x1A,
-    0x11, 0x1C, 0x0E, 0x02, 0x1C, 0x1A, 0x13, 0x26, 0x1E, 0x12, 0x21, 0x16, 0x0F, 0x2A, 0x2A, 0x29,
-    0x2D, 0x2A, 0x23, 0x28, 0x29, 0x23, 0x2D, 0x29, 0x1A, 0x3A, 0x2D, 0x1C, 0x2D, 0x29, 0x1A, 0x2D,
-    0x29, 0x1A, 0x37, 0x2C, 0x21, 0x2E, 0x26, 0x1A, 0x2B, 0x22, 0x18, 0x2D, 0x29, 0x1A, 0x2E, 0x26,
-    0x1A, 0x2E, 0x26, 0x1A, 0x37, 0x2C, 0x21, 0x22, 0x26, 0x11, 0x2E, 0x26, 0x1A, 0x33, 0x32, 0x23,
-    0x2E, 0x26, 0x1A, 0x2E, 0x26, 0x1A, 0x2D, 0x2A, 0x23, 0x2D, 0x2A, 0x23, 0x2B, 0x22, 0x18, 0x23,
-    0x22, 0x1B, 0x0F, 0x02, 0x01, 0x1E, 0x01, 0x01, 0x24, 0x1A, 0x11, 0x31, 0x22, 0x12, 0x2B, 0x15,
-    0x13, 0x31, 0x22, 0x12, 0x2B, 0x15, 0x13, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x31, 0x22, 0x12,
-    0x2D, 0x1E, 0x10, 0x3A, 0x2D, 0x1C, 0x2F, 0x2E, 0x30, 0x39, 0x39, 0x3A, 0x2A, 0x2A, 0x29, 0x26,
-    0x23, 0x21, 0x2A, 0x2A, 0x29, 0x3D, 0x3A, 0x35, 0x3D, 0x3D, 0x3B, 0x5F, 0x5E, 0x5D, 0x44, 0x3F,
-    0x3B, 0x37, 0x33, 0x32, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20,
-    0x26, 0x23, 0x21, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x29, 0x25, 0x2E, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0xFE, 0xFE, 0xFC, 0xB5, 0xB5, 0xB5, 0x97, 0x96, 0x99, 0x65, 0x65, 0x66, 0x3D, 0x3D, 0x3B,
-    0x3D, 0x3D, 0x3B, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x3D, 0x3D, 0x3B, 0x28, 0x26, 0x20, 0x28,
-    0x26, 0x20, 0x23, 0x22, 0x1B, 0x2D, 0x2A, 0x23, 0x28, 0x26, 0x20, 0x5C, 0x5C, 0x55, 0x32, 0x33,
-    0x32, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x37, 0x36, 0x34, 0x26, 0x23, 0x21,
-    0x26, 0x23, 0x21, 0x1C, 0x1A, 0x13, 0x26, 0x23, 0x21, 0x39, 0x39, 0x3A, 0x37, 0x36, 0x34, 0x32,
-    0x32, 0x2D, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x32, 0x32, 0x2D, 0x38, 0x39, 0x35, 0x39, 0x39,
-    0x3A, 0x32, 0x33, 0x32, 0x61, 0x5F, 0x64, 0x5F, 0x5E, 0x5D, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29,
-    0x35, 0x34, 0x3A, 0x5F, 0x5E, 0x5D, 0x39, 0x39, 0x3A, 0x03, 0x01, 0x02, 0x3E, 0x3E, 0x3F, 0x2A,
-    0x2A, 0x29, 0x5B, 0x5A, 0x5B, 0x38, 0x39, 0x35, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x28, 0x26,
-    0x20, 0x28, 0x29, 0x23, 0x33, 0x32, 0x23, 0x28, 0x29, 0x23, 0x28, 0x26, 0x20, 0x20, 0x1D, 0x19,
-    0x28, 0x26, 0x20, 0x23, 0x22, 0x1B, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x30,
-    0x1F, 0x18, 0x03, 0x01, 0x02, 0x3E, 0x3A, 0x2D, 0x37, 0x2A, 0x1C, 0x21, 0x16, 0x0F, 0x1B, 0x14,
-    0x0A, 0x24, 0x1A, 0x11, 0x1C, 0x12, 0x04, 0x1A, 0x16, 0x11, 0x1B, 0x14, 0x0A, 0x1A, 0x16, 0x11,
-    0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x26, 0x1E, 0x12, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x24,
-    0x1B, 0x0C, 0x2D, 0x29, 0x1A, 0x34, 0x26, 0x12, 0x37, 0x2A, 0x1C, 0x34, 0x26, 0x12, 0x35, 0x26,
-    0x17, 0x28, 0x21, 0x11, 0x30, 0x1D, 0x09, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x24, 0x1B, 0x0C,
-    0x28, 0x21, 0x11, 0x28, 0x21, 0x11, 0x2B, 0x22, 0x18, 0x21, 0x16, 0x0F, 0x2E, 0x26, 0x1A, 0x26,
-    0x1E, 0x12, 0x03, 0x01, 0x02, 0x58, 0x48, 0x38, 0x21, 0x16, 0x0F, 0x22, 0x13, 0x04, 0x22, 0x13,
-    0x04, 0x2C, 0x1A, 0x09, 0x1C, 0x0E, 0x02, 0x2C, 0x1A, 0x09, 0x22, 0x13, 0x04, 0x22, 0x13, 0x04,
-    0x2C, 0x1A, 0x09, 0x34, 0x26, 0x12, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x26, 0x23, 0x21, 0x27,
-    0x26, 0x28, 0x38, 0x39, 0x35, 0x3D, 0x3D, 0x3B, 0x5C, 0x5C, 0x55, 0x63, 0x62, 0x61, 0x3D, 0x3A,
-    0x35, 0x38, 0x39, 0x35, 0x28, 0x29, 0x23, 0x26, 0x23, 0x21, 0x2A, 0x2A, 0x29, 0x26, 0x23, 0x21,
-    0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x0A, 0x0A, 0x09, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0xFE, 0xFE,
-    0xFC, 0xD8, 0xD6, 0xD2, 0x9A, 0x9A, 0x9A, 0x5F, 0x5E, 0x5D, 0x43, 0x43, 0x3F, 0x42, 0x3D, 0x45,
-    0x2F, 0x2E, 0x30, 0x3D, 0x3A, 0x35, 0x2A, 0x2A, 0x29, 0x5F, 0x5E, 0x5D, 0x22, 0x23, 0x22, 0x28,
-    0x29, 0x23, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20, 0x38, 0x39, 0x35, 0x37, 0x36, 0x34, 0x22, 0x23,
-    0x22, 0x22, 0x23, 0x22, 0x38, 0x39, 0x35, 0x2A, 0x2A, 0x29, 0x1F, 0x1E, 0x1E, 0x2A, 0x2A, 0x29,
-    0x1F, 0x1E, 0x1E, 0x27, 0x26, 0x28, 0x28, 0x29, 0x23, 0x32, 0x33, 0x32, 0x35, 0x34, 0x3A, 0x2A,
-    0x2A, 0x29, 0x05, 0x06, 0x03, 0x57, 0x56, 0x54, 0x35, 0x34, 0x3A, 0x2A, 0x2A, 0x29, 0x27, 0x26,
-    0x28, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x5B, 0x5A, 0x5B, 0x37, 0x36, 0x34,
-    0x39, 0x39, 0x3A, 0x32, 0x33, 0x32, 0x65, 0x65, 0x66, 0x03, 0x01, 0x02, 0x3E, 0x3E, 0x3F, 0x37,
-    0x36, 0x34, 0x32, 0x33, 0x32, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x28, 0x29,
-    0x23, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x20, 0x1D, 0x19, 0x22, 0x23, 0x22, 0x2D, 0x2A, 0x23,
-    0x2F, 0x2E, 0x2B, 0x2A, 0x2A, 0x29, 0x28, 0x26, 0x20, 0x27, 0x26, 0x28, 0x26, 0x23, 0x21, 0x26,
-    0x23, 0x21, 0x0F, 0x02, 0x01, 0x4B, 0x3D, 0x2C, 0x30, 0x1F, 0x18, 0x1B, 0x1A, 0x0B, 0x21, 0x16,
-    0x0F, 0x24, 0x1B, 0x0C, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x21, 0x16, 0x0F, 0x1C, 0x1A, 0x13,
-    0x21, 0x16, 0x0F, 0x22, 0x15, 0x09, 0x1B, 0x1A, 0x0B, 0x22, 0x15, 0x09, 0x26, 0x1E, 0x12, 0x24,
-    0x1B, 0x0C, 0x30, 0x1F, 0x18, 0x1C, 0x12, 0x04, 0x28, 0x21, 0x11, 0x22, 0x15, 0x09, 0x2C, 0x1A,
-    0x09, 0x1B, 0x1A, 0x0B, 0x1C, 0x12, 0x04, 0x2E, 0x26, 0x1A, 0x1C, 0x12, 0x04, 0x2C, 0x1A, 0x09,
-    0x1B, 0x14, 0x0A, 0x21, 0x16, 0x0F, 0x1B, 0x1A, 0x0B, 0x22, 0x15, 0x09, 0x24, 0x1A, 0x11, 0x1C,
-    0x12, 0x04, 0x0F, 0x02, 0x01, 0x5B, 0x4D, 0x3F, 0x30, 0x1F, 0x18, 0x22, 0x13, 0x04, 0x2C, 0x1A,
-    0x09, 0x22, 0x13, 0x04, 0x22, 0x13, 0x04, 0x22, 0x13, 0x04, 0x22, 0x15, 0x09, 0x22, 0x15, 0x09,
-    0x22, 0x15, 0x09, 0x22, 0x15, 0x09, 0x03, 0x01, 0x02, 0x21, 0x1E, 0x26, 0x2F, 0x2E, 0x30, 0x21,
-    0x1E, 0x26, 0x37, 0x36, 0x34, 0x44, 0x43, 0x43, 0x63, 0x62, 0x61, 0x28, 0x26, 0x20, 0x2F, 0x2E,
-    0x2B, 0x32, 0x32, 0x2D, 0x2A, 0x2A, 0x29, 0x23, 0x22, 0x1B, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24,
-    0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05,
-    0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0xD8, 0xD6,
-    0xD9, 0x97, 0x96, 0x99, 0x5B, 0x5A, 0x5B, 0x5B, 0x5A, 0x5B, 0x2C, 0x1F, 0x25, 0x39, 0x33, 0x2C,
-    0x3D, 0x3D, 0x3B, 0x26, 0x23, 0x21, 0x27, 0x26, 0x24, 0x5F, 0x5E, 0x5D, 0x28, 0x29, 0x23, 0x22,
-    0x23, 0x22, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x37, 0x36, 0x34, 0x2A, 0x2A, 0x29, 0x28, 0x29,
-    0x23, 0x38, 0x39, 0x35, 0x1F, 0x1E, 0x1E, 0x22, 0x23, 0x22, 0x2F, 0x2E, 0x2B, 0x19, 0x13, 0x0E,
-    0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x37, 0x36, 0x34, 0x27,
-    0x26, 0x28, 0x5B, 0x5A, 0x5B, 0x9A, 0x9A, 0x9A, 0x39, 0x39, 0x3A, 0x27, 0x26, 0x28, 0x27, 0x26,
-    0x28, 0x1F, 0x1E, 0x1E, 0x27, 0x26, 0x28, 0x29, 0x25, 0x2E, 0x32, 0x33, 0x32, 0x5B, 0x5A, 0x5B,
-    0x05, 0x05, 0x08, 0x27, 0x26, 0x28, 0x5B, 0x5A, 0x5B, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x61,
-    0x5F, 0x64, 0x43, 0x43, 0x3F, 0x22, 0x23, 0x22, 0x2F, 0x2E, 0x2B, 0x37, 0x36, 0x34, 0x3E, 0x3E,
-    0x36, 0x39, 0x39, 0x3A, 0x43, 0x43, 0x3F, 0x37, 0x36, 0x34, 0x32, 0x32, 0x2D, 0x37, 0x33, 0x32,
-    0x38, 0x39, 0x35, 0x3D, 0x3A, 0x35, 0x32, 0x32, 0x2D, 0x34, 0x35, 0x2E, 0x2A, 0x2A, 0x29, 0x3D,
-    0x3A, 0x35, 0x03, 0x01, 0x02, 0x42, 0x33, 0x22, 0x37, 0x2A, 0x1C, 0x22, 0x15, 0x09, 0x26, 0x1E,
-    0x12, 0x26, 0x1E, 0x12, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x1B, 0x14, 0x0A, 0x24, 0x1A, 0x11,
-    0x24, 0x1A, 0x11, 0x24, 0x1B, 0x0C, 0x26, 0x1E, 0x12, 0x1B, 0x1A, 0x0B, 0x24, 0x1A, 0x11, 0x1B,
-    0x1A, 0x0B, 0x24, 0x1B, 0x0C, 0x22, 0x13, 0x04, 0x28, 0x21, 0x11, 0x24, 0x1B, 0x0C, 0x28, 0x21,
-    0x11, 0x26, 0x1E, 0x12, 0x24, 0x1B, 0x0C, 0x2D, 0x1E, 0x10, 0x1C, 0x12, 0x04, 0x1B, 0x1A, 0x0B,
-    0x24, 0x1B, 0x0C, 0x22, 0x13, 0x04, 0x26, 0x1E, 0x12, 0x21, 0x16, 0x0F, 0x22, 0x15, 0x09, 0x1B,
-    0x14, 0x0A, 0x0F, 0x02, 0x01, 0x58, 0x48, 0x38, 0x38, 0x29, 0x18, 0x30, 0x1F, 0x18, 0x54, 0x44,
-    0x36, 0x49, 0x38, 0x29, 0x49, 0x38, 0x29, 0x35, 0x26, 0x17, 0x5B, 0x4D, 0x3F, 0x4D, 0x36, 0x21,
-    0x2E, 0x26, 0x1A, 0x22, 0x15, 0x09, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x39,
-    0x39, 0x3A, 0x38, 0x39, 0x35, 0x5B, 0x5A, 0x5B, 0x3D, 0x3A, 0x35, 0x37, 0x36, 0x34, 0x32, 0x32,
-    0x2D, 0x2D, 0x2A, 0x23, 0x28, 0x29, 0x23, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24,
-    0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0xCD, 0xCD, 0xCB, 0x97, 0x96,
-    0x99, 0x63, 0x62, 0x61, 0x63, 0x62, 0x61, 0x44, 0x3F, 0x3B, 0x3D, 0x3A, 0x35, 0x37, 0x33, 0x32,
-    0x44, 0x3F, 0x3B, 0x26, 0x23, 0x21, 0x2A, 0x2A, 0x29, 0x9A, 0x9A, 0x9A, 0x1F, 0x1E, 0x1E, 0x2A,
-    0x2A, 0x29, 0x1F, 0x1E, 0x1E, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x22, 0x23,
-    0x22, 0x39, 0x39, 0x3A, 0x27, 0x26, 0x24, 0x28, 0x29, 0x23, 0x17, 0x18, 0x18, 0x27, 0x26, 0x24,
-    0x2A, 0x2A, 0x29, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x3D, 0x3D, 0x3B, 0x32, 0x33, 0x32, 0x2F,
-    0x2E, 0x2B, 0x3E, 0x3E, 0x3F, 0x32, 0x33, 0x32, 0x32, 0x32, 0x2D, 0x27, 0x26, 0x28, 0x32, 0x33,
-    0x32, 0x2F, 0x2E, 0x30, 0x32, 0x33, 0x32, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x05, 0x05, 0x08,
-    0x21, 0x1E, 0x26, 0x22, 0x23, 0x22, 0x5B, 0x5A, 0x5B, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24, 0x22,
-    0x23, 0x22, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02, 0x0E, 0x0D, 0x0D, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x1C, 0x1A, 0x13, 0x22, 0x23, 0x22,
-    0x23, 0x22, 0x1B, 0x23, 0x22, 0x1B, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F,
-    0x02, 0x01, 0x03, 0x01, 0x02, 0x59, 0x57, 0x44, 0x35, 0x26, 0x17, 0x22, 0x15, 0x09, 0x26, 0x1E,
-    0x12, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x26, 0x1E, 0x12, 0x19, 0x13, 0x0E, 0x24, 0x1A, 0x11,
-    0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x2B, 0x22, 0x18, 0x1C, 0x1A, 0x13, 0x26, 0x1E, 0x12, 0x24,
-    0x1A, 0x11, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x24, 0x1B, 0x0C, 0x22, 0x15, 0x09, 0x24, 0x1B,
-    0x0C, 0x2C, 0x1A, 0x09, 0x31, 0x22, 0x12, 0x24, 0x1B, 0x0C, 0x2D, 0x1E, 0x10, 0x2B, 0x22, 0x18,
-    0x2D, 0x29, 0x1A, 0x24, 0x1B, 0x0C, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x31, 0x22, 0x12, 0x24,
-    0x1A, 0x11, 0x0F, 0x02, 0x01, 0x49, 0x38, 0x29, 0x35, 0x26, 0x1F, 0x4D, 0x36, 0x21, 0x37, 0x2A,
-    0x1C, 0x31, 0x22, 0x12, 0x30, 0x1F, 0x18, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17,
-    0x37, 0x2A, 0x1C, 0x35, 0x26, 0x17, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x32,
-    0x33, 0x32, 0x65, 0x65, 0x66, 0x63, 0x62, 0x61, 0x3D, 0x3D, 0x3B, 0x3D, 0x3A, 0x35, 0x38, 0x39,
-    0x35, 0x27, 0x26, 0x24, 0x26, 0x23, 0x21, 0x28, 0x26, 0x20, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22,
-    0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0xD3, 0xD2, 0xD1, 0x9B, 0x9A, 0x95, 0x62, 0x5E,
-    0x55, 0x57, 0x56, 0x54, 0x44, 0x3F, 0x3B, 0x39, 0x33, 0x2C, 0x3D, 0x3D, 0x3B, 0x3D, 0x3A, 0x35,
-    0x35, 0x26, 0x1F, 0x63, 0x62, 0x61, 0x95, 0x93, 0x8D, 0x9A, 0x9A, 0x9A, 0x37, 0x36, 0x34, 0x63,
-    0x62, 0x5B, 0x43, 0x43, 0x3F, 0x17, 0x18, 0x18, 0x1A, 0x16, 0x11, 0x22, 0x23, 0x22, 0x22, 0x23,
-    0x22, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x19, 0x13, 0x0E, 0x1F, 0x1E, 0x1E, 0x2F, 0x2E, 0x2B,
-    0x22, 0x23, 0x22, 0x32, 0x32, 0x2D, 0x3E, 0x3E, 0x3F, 0x22, 0x23, 0x22, 0x2F, 0x2E, 0x30, 0x27,
-    0x26, 0x28, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x2A, 0x2A,
-    0x29, 0x27, 0x26, 0x28, 0x5B, 0x5A, 0x5B, 0x5B, 0x5A, 0x5B, 0xB9, 0xB8, 0xB8, 0x22, 0x23, 0x22,
-    0x22, 0x23, 0x22, 0x2F, 0x2E, 0x30, 0x9A, 0x9A, 0x9A, 0x03, 0x01, 0x02, 0x1F, 0x1E, 0x1E, 0x2F,
-    0x2E, 0x30, 0x03, 0x01, 0x02, 0x20, 0x1D, 0x19, 0x1F, 0x1E, 0x1E, 0x1F, 0x1E, 0x1E, 0x27, 0x26,
-    0x24, 0x37, 0x36, 0x34, 0x34, 0x35, 0x2E, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24,
-    0x1C, 0x1A, 0x13, 0x22, 0x23, 0x22, 0x2C, 0x2D, 0x24, 0x1A, 0x16, 0x11, 0x27, 0x26, 0x24, 0x20,
-    0x1D, 0x19, 0x0F, 0x02, 0x01, 0x57, 0x4C, 0x39, 0x38, 0x29, 0x18, 0x1B, 0x14, 0x0A, 0x24, 0x1A,
-    0x11, 0x26, 0x1E, 0x12, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x22, 0x15, 0x09, 0x1C, 0x1A, 0x13,
-    0x24, 0x1B, 0x0C, 0x2D, 0x1E, 0x10, 0x28, 0x21, 0x11, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x28,
-    0x21, 0x11, 0x28, 0x21, 0x11, 0x2E, 0x26, 0x1A, 0x2D, 0x1E, 0x10, 0x24, 0x1B, 0x0C, 0x35, 0x26,
-    0x17, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x2D, 0x1E, 0x10, 0x24, 0x1B, 0x0C, 0x2D, 0x1E, 0x10,
-    0x31, 0x22, 0x12, 0x2E, 0x26, 0x1A, 0x22, 0x15, 0x09, 0x1B, 0x1A, 0x0B, 0x24, 0x1B, 0x0C, 0x2D,
-    0x1E, 0x10, 0x0F, 0x02, 0x01, 0x49, 0x38, 0x29, 0x31, 0x22, 0x12, 0x22, 0x15, 0x09, 0x3C, 0x25,
-    0x10, 0x46, 0x2E, 0x19, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x37, 0x2A, 0x1C, 0x35, 0x26, 0x17,
-    0x2D, 0x1E, 0x10, 0x37, 0x2A, 0x1C, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03,
-    0x01, 0x02, 0x5B, 0x5A, 0x5B, 0x44, 0x3F, 0x3B, 0x37, 0x33, 0x32, 0x32, 0x33, 0x32, 0x26, 0x23,
-    0x21, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x2F, 0x2E, 0x30,
-    0x22, 0x23, 0x22, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x96, 0x95, 0x94, 0x95, 0x93, 0x8D, 0x63, 0x62, 0x61, 0x44, 0x3F,
-    0x3B, 0x28, 0x26, 0x20, 0x2A, 0x2A, 0x29, 0x2D, 0x2A, 0x23, 0x27, 0x26, 0x24, 0x37, 0x2C, 0x21,
-    0x63, 0x62, 0x5B, 0x57, 0x57, 0x4C, 0x28, 0x26, 0x20, 0x9F, 0x9E, 0x9D, 0x27, 0x26, 0x24, 0x17,
-    0x18, 0x18, 0x17, 0x18, 0x18, 0x1A, 0x16, 0x11, 0x17, 0x18, 0x18, 0x05, 0x06, 0x03, 0x27, 0x26,
-    0x24, 0x22, 0x23, 0x22, 0x5C, 0x5C, 0x55, 0x96, 0x95, 0x94, 0x63, 0x62, 0x61, 0x22, 0x23, 0x22,
-    0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x21, 0x1E, 0x26, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x29,
-    0x25, 0x2E, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x3D, 0x3D, 0x3B, 0x39, 0x39, 0x3A, 0x61, 0x5F,
-    0x64, 0x5F, 0x5E, 0x5D, 0x61, 0x5F, 0x64, 0x44, 0x43, 0x43, 0x5F, 0x5E, 0x5D, 0x21, 0x1E, 0x26,
-    0x2A, 0x2A, 0x29, 0xD3, 0xD2, 0xD1, 0xB3, 0xB2, 0xB1, 0x03, 0x01, 0x02, 0x3D, 0x3D, 0x3B, 0x22,
-    0x23, 0x22, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x28, 0x29, 0x23, 0x22, 0x23,
-    0x22, 0x27, 0x26, 0x28, 0x28, 0x29, 0x23, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x28, 0x29, 0x23,
-    0x28, 0x26, 0x20, 0x2A, 0x2A, 0x29, 0x96, 0x95, 0x94, 0x65, 0x65, 0x66, 0x2C, 0x1F, 0x25, 0x26,
-    0x23, 0x21, 0x0F, 0x02, 0x01, 0x33, 0x32, 0x23, 0x37, 0x2A, 0x1C, 0x22, 0x15, 0x09, 0x26, 0x1E,
-    0x12, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x28, 0x21, 0x11, 0x1B, 0x14, 0x0A, 0x21, 0x16, 0x0F,
-    0x1B, 0x1A, 0x0B, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x24, 0x1B, 0x0C, 0x2B, 0x22, 0x18, 0x24,
-    0x1B, 0x0C, 0x24, 0x1B, 0x0C, 0x2D, 0x29, 0x1A, 0x34, 0x26, 0x12, 0x31, 0x22, 0x12, 0x2D, 0x29,
-    0x1A, 0x30, 0x1D, 0x09, 0x31, 0x22, 0x12, 0x31, 0x22, 0x12, 0x2C, 0x1A, 0x09, 0x34, 0x26, 0x12,
-    0x35, 0x26, 0x17, 0x3A, 0x2D, 0x1C, 0x2D, 0x29, 0x1A, 0x28, 0x21, 0x11, 0x1B, 0x1A, 0x0B, 0x1B,
-    0x1A, 0x0B, 0x0F, 0x02, 0x01, 0x49, 0x38, 0x29, 0x37, 0x2A, 0x1C, 0x31, 0x22, 0x12, 0x22, 0x13,
-    0x04, 0x22, 0x15, 0x09, 0x1C, 0x0E, 0x02, 0x1C, 0x0E, 0x02, 0x22, 0x13, 0x04, 0x22, 0x15, 0x09,
-    0x2C, 0x1A, 0x09, 0x38, 0x29, 0x18, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x2F, 0x2E, 0x30, 0x3D, 0x3D, 0x3B, 0x2A, 0x2A,
-    0x29, 0x26, 0x23, 0x21, 0x28, 0x26, 0x20, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28,
-    0x20, 0x1D, 0x19, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x09,
-    0x0A, 0x03, 0x9B, 0x9A, 0x95, 0x63, 0x62, 0x5B, 0x5F, 0x5E, 0x5D, 0x43, 0x43, 0x3F, 0x34, 0x35,
-    0x2E, 0x20, 0x1D, 0x19, 0x23, 0x22, 0x1B, 0x2D, 0x2A, 0x23, 0x37, 0x2C, 0x21, 0x30, 0x1F, 0x18,
-    0x2D, 0x2A, 0x23, 0x37, 0x36, 0x34, 0x9B, 0x9A, 0x95, 0xCD, 0xCD, 0xCB, 0x63, 0x62, 0x61, 0x2F,
-    0x2E, 0x2B, 0x27, 0x26, 0x24, 0x17, 0x18, 0x18, 0x1F, 0x1E, 0x1E, 0x2A, 0x2A, 0x29, 0x27, 0x26,
-    0x24, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x63, 0x62, 0x61, 0x20, 0x1D, 0x19, 0x27, 0x26, 0x28,
-    0x2F, 0x2E, 0x2B, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x21, 0x1E, 0x26, 0x2F,
-    0x2E, 0x30, 0x2A, 0x2A, 0x29, 0x21, 0x1E, 0x26, 0x27, 0x26, 0x28, 0x21, 0x1E, 0x26, 0x27, 0x26,
-    0x28, 0x1F, 0x1E, 0x1E, 0x2A, 0x2A, 0x29, 0x1F, 0x1E, 0x1E, 0x35, 0x34, 0x3A, 0x65, 0x65, 0x66,
-    0x96, 0x95, 0x94, 0x97, 0x96, 0x99, 0x9A, 0x9A, 0x9A, 0x0A, 0x0A, 0x09, 0x32, 0x33, 0x32, 0x1F,
-    0x1E, 0x1E, 0x0A, 0x0A, 0x09, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x5F, 0x5E, 0x5D, 0x28, 0x26,
-    0x20, 0x2F, 0x2E, 0x2B, 0x57, 0x56, 0x54, 0x5F, 0x5E, 0x5D, 0x32, 0x32, 0x2D, 0x28, 0x26, 0x20,
-    0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x5F, 0x5E, 0x5D, 0x5B, 0x5A, 0x5B, 0x26, 0x23, 0x21, 0x2D,
-    0x2A, 0x23, 0x0F, 0x02, 0x01, 0x57, 0x4C, 0x39, 0x35, 0x26, 0x1F, 0x24, 0x1B, 0x0C, 0x26, 0x1E,
-    0x12, 0x26, 0x1E, 0x12, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x1B, 0x14, 0x0A, 0x21, 0x16, 0x0F,
-    0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x28, 0x21, 0x11, 0x24, 0x1B, 0x0C, 0x22, 0x26, 0x11, 0x28,
-    0x21, 0x11, 0x28, 0x21, 0x11, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x31, 0x22,
-    0x12, 0x2D, 0x1E, 0x10, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x2D, 0x1E, 0x10, 0x38, 0x29, 0x18,
-    0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x28, 0x21, 0x11, 0x34, 0x26, 0x12, 0x3A, 0x2D, 0x1C, 0x37,
-    0x2A, 0x1C, 0x03, 0x01, 0x02, 0x49, 0x38, 0x29, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x35, 0x26,
-    0x1F, 0x31, 0x22, 0x12, 0x37, 0x2A, 0x1C, 0x47, 0x2F, 0x20, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17,
-    0x2D, 0x1E, 0x10, 0x22, 0x15, 0x09, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x39, 0x39, 0x3A, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x22, 0x23,
-    0x22, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x63, 0x62, 0x61, 0x90,
-    0x8F, 0x8E, 0x96, 0x95, 0x94, 0x5F, 0x5E, 0x5D, 0x51, 0x48, 0x41, 0x27, 0x26, 0x24, 0x1A, 0x16,
-    0x11, 0x19, 0x13, 0x0E, 0x26, 0x1E, 0x12, 0x1C, 0x1A, 0x13, 0x30, 0x1F, 0x18, 0x2F, 0x2E, 0x2B,
-    0x35, 0x26, 0x1F, 0x3D, 0x3A, 0x35, 0x5C, 0x5C, 0x55, 0x63, 0x62, 0x5B, 0x23, 0x22, 0x1B, 0x22,
-    0x23, 0x22, 0x27, 0x26, 0x28, 0x19, 0x13, 0x0E, 0x2F, 0x2E, 0x2B, 0x27, 0x26, 0x24, 0x27, 0x26,
-    0x24, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x28, 0x26, 0x20, 0x2A, 0x2A, 0x29, 0x28, 0x26, 0x20,
-    0x1F, 0x1E, 0x1E, 0x5C, 0x5C, 0x55, 0x61, 0x5F, 0x64, 0x39, 0x39, 0x3A, 0x44, 0x43, 0x43, 0x39,
-    0x39, 0x3A, 0x35, 0x34, 0x3A, 0x2F, 0x2E, 0x30, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x27, 0x26,
-    0x28, 0x2A, 0x2A, 0x29, 0x2F, 0x2E, 0x30, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x37, 0x36, 0x34,
-    0x35, 0x34, 0x3A, 0x9A, 0x9A, 0x9A, 0x5B, 0x5A, 0x5B, 0x03, 0x01, 0x02, 0x3D, 0x3D, 0x3B, 0x2A,
-    0x2A, 0x29, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x28, 0x29, 0x23, 0x2A, 0x2A,
-    0x29, 0x23, 0x22, 0x1B, 0x2F, 0x2E, 0x2B, 0x37, 0x36, 0x34, 0x23, 0x22, 0x1B, 0x27, 0x26, 0x24,
-    0x2D, 0x2A, 0x23, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x27,
-    0x26, 0x24, 0x03, 0x01, 0x02, 0x65, 0x53, 0x3B, 0x37, 0x2C, 0x21, 0x1C, 0x0E, 0x02, 0x26, 0x1E,
-    0x12, 0x28, 0x21, 0x11, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x1B, 0x14, 0x0A, 0x1B, 0x14, 0x0A,
-    0x24, 0x1B, 0x0C, 0x24, 0x1B, 0x0C, 0x24, 0x1B, 0x0C, 0x22, 0x26, 0x11, 0x35, 0x26, 0x17, 0x28,
-    0x21, 0x11, 0x36, 0x29, 0x13, 0x31, 0x22, 0x12, 0x2D, 0x29, 0x1A, 0x2C, 0x1A, 0x09, 0x2C, 0x1A,
-    0x09, 0x1C, 0x0E, 0x02, 0x31, 0x22, 0x12, 0x2D, 0x1E, 0x10, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18,
-    0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x3A, 0x2D, 0x1C, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x28,
-    0x21, 0x11, 0x0F, 0x02, 0x01, 0x49, 0x38, 0x29, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x66, 0x48,
-    0x33, 0x4A, 0x38, 0x30, 0x47, 0x2F, 0x20, 0x2D, 0x1E, 0x10, 0x5B, 0x4D, 0x3F, 0x49, 0x38, 0x29,
-    0x47, 0x2F, 0x20, 0x31, 0x22, 0x12, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x05,
-    0x05, 0x08, 0x35, 0x34, 0x3A, 0x32, 0x33, 0x32, 0x35, 0x34, 0x3A, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x96, 0x95, 0x94, 0x9A,
-    0x9A, 0x9A, 0x5F, 0x5E, 0x5D, 0x63, 0x62, 0x5B, 0x32, 0x32, 0x2D, 0x43, 0x43, 0x3F, 0x3D, 0x36,
-    0x2C, 0x28, 0x26, 0x20, 0x2B, 0x22, 0x18, 0x35, 0x26, 0x1F, 0x2D, 0x2A, 0x23, 0x35, 0x26, 0x1F,
-    0x35, 0x26, 0x1F, 0x2D, 0x2A, 0x23, 0x44, 0x3F, 0x3B, 0x5F, 0x5E, 0x5D, 0x63, 0x62, 0x61, 0x22,
-    0x23, 0x22, 0x5F, 0x5E, 0x5D, 0x20, 0x1D, 0x19, 0x57, 0x56, 0x54, 0x5F, 0x5E, 0x5D, 0x27, 0x26,
-    0x24, 0x28, 0x29, 0x23, 0x27, 0x26, 0x24, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x3E, 0x3E, 0x3F, 0x27,
-    0x26, 0x28, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x35, 0x34, 0x3A, 0x2A, 0x2A, 0x29, 0x5F, 0x5E, 0x5D, 0x03, 0x01, 0x02, 0x39, 0x39, 0x3A, 0x22,
-    0x23, 0x22, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x26, 0x23,
-    0x21, 0x2D, 0x2A, 0x23, 0x28, 0x26, 0x20, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x32, 0x32, 0x2D,
-    0x23, 0x22, 0x1B, 0x23, 0x22, 0x1B, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x30,
-    0x1F, 0x18, 0x0F, 0x02, 0x01, 0x3E, 0x3A, 0x2D, 0x35, 0x26, 0x17, 0x22, 0x15, 0x09, 0x30, 0x1F,
-    0x18, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x28, 0x21, 0x11, 0x1B, 0x14, 0x0A, 0x1B, 0x14, 0x0A,
-    0x2C, 0x1A, 0x09, 0x28, 0x21, 0x11, 0x28, 0x21, 0x11, 0x28, 0x21, 0x11, 0x28, 0x21, 0x11, 0x1B,
-    0x1A, 0x0B, 0x31, 0x22, 0x12, 0x2C, 0x1A, 0x09, 0x34, 0x26, 0x12, 0x1C, 0x12, 0x04, 0x6D, 0x5E,
-    0x4C, 0x49, 0x38, 0x29, 0x49, 0x38, 0x29, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x22, 0x13, 0x04,
-    0x22, 0x13, 0x04, 0x22, 0x13, 0x04, 0x37, 0x2A, 0x1C, 0x2C, 0x1A, 0x09, 0x2D, 0x29, 0x1A, 0x35,
-    0x26, 0x17, 0x03, 0x01, 0x02, 0x49, 0x38, 0x29, 0x38, 0x29, 0x18, 0x49, 0x38, 0x29, 0x38, 0x29,
-    0x18, 0x35, 0x26, 0x17, 0x3C, 0x25, 0x10, 0x35, 0x26, 0x1F, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17,
-    0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x39,
-    0x39, 0x3A, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x03, 0x01,
-    0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x96, 0x95, 0x94, 0x5F,
-    0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x48, 0x48, 0x41, 0x39, 0x33, 0x2C, 0x2D, 0x2A, 0x23, 0x21, 0x16,
-    0x0F, 0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x19, 0x13, 0x0E, 0x24, 0x1A, 0x11,
-    0x1D, 0x18, 0x18, 0x19, 0x13, 0x0E, 0x1A, 0x16, 0x11, 0x63, 0x62, 0x61, 0x1A, 0x16, 0x11, 0x2D,
-    0x2A, 0x23, 0x9B, 0x9A, 0x95, 0x5C, 0x5C, 0x55, 0x3E, 0x3E, 0x36, 0x3E, 0x3E, 0x3F, 0x28, 0x29,
-    0x23, 0x28, 0x26, 0x20, 0x27, 0x26, 0x24, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x43, 0x43, 0x3F, 0x5B, 0x5A, 0x5B, 0x43,
-    0x43, 0x3F, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02,
-    0x39, 0x39, 0x3A, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x3D, 0x3D, 0x3B, 0x39,
-    0x39, 0x3A, 0x22, 0x23, 0x22, 0x3D, 0x3A, 0x35, 0x2F, 0x2E, 0x2B, 0x38, 0x39, 0x35, 0x34, 0x35,
-    0x2E, 0x3D, 0x3D, 0x3B, 0x37, 0x36, 0x34, 0x57, 0x56, 0x54, 0x62, 0x5E, 0x55, 0x28, 0x26, 0x20,
-    0x38, 0x39, 0x35, 0x38, 0x39, 0x35, 0x5F, 0x5E, 0x5D, 0x38, 0x39, 0x35, 0x2F, 0x2E, 0x30, 0x37,
-    0x36, 0x34, 0x0F, 0x02, 0x01, 0x3E, 0x3A, 0x2D, 0x2B, 0x22, 0x18, 0x22, 0x15, 0x09, 0x26, 0x1E,
-    0x12, 0x28, 0x21, 0x11, 0x24, 0x1B, 0x0C, 0x26, 0x1E, 0x12, 0x21, 0x16, 0x0F, 0x24, 0x1A, 0x11,
-    0x1B, 0x1A, 0x0B, 0x24, 0x1B, 0x0C, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x34, 0x26, 0x12, 0x38,
-    0x29, 0x18, 0x22, 0x26, 0x11, 0x3A, 0x2D, 0x1C, 0x2D, 0x1E, 0x10, 0x38, 0x29, 0x18, 0x41, 0x38,
-    0x23, 0x42, 0x33, 0x22, 0x4D, 0x36, 0x21, 0x47, 0x2F, 0x20, 0x31, 0x22, 0x12, 0x22, 0x13, 0x04,
-    0x4B, 0x3D, 0x2C, 0x2D, 0x1E, 0x10, 0x34, 0x26, 0x12, 0x28, 0x21, 0x11, 0x31, 0x22, 0x12, 0x35,
-    0x26, 0x17, 0x0F, 0x02, 0x01, 0x49, 0x38, 0x29, 0x35, 0x26, 0x17, 0x22, 0x13, 0x04, 0x35, 0x26,
-    0x17, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x31, 0x22, 0x12, 0x38, 0x29, 0x18,
-    0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x35, 0x34, 0x3A, 0x3E,
-    0x3E, 0x3F, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x3E, 0x3E, 0x3F, 0x35, 0x34, 0x3A, 0x37, 0x36,
-    0x34, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x96, 0x95, 0x94, 0x5F, 0x5E, 0x5D, 0x5B,
-    0x5A, 0x5B, 0x4C, 0x4B, 0x49, 0x32, 0x32, 0x2D, 0x43, 0x43, 0x3F, 0x1F, 0x1E, 0x1E, 0x28, 0x26,
-    0x20, 0x23, 0x22, 0x1B, 0x35, 0x26, 0x1F, 0x2D, 0x2A, 0x23, 0x30, 0x1F, 0x18, 0x27, 0x26, 0x24,
-    0x2B, 0x22, 0x18, 0x26, 0x23, 0x21, 0x23, 0x22, 0x1B, 0x3D, 0x3A, 0x35, 0x28, 0x26, 0x20, 0x95,
-    0x93, 0x8D, 0xDC, 0xDB, 0xD9, 0x28, 0x26, 0x20, 0x5C, 0x5C, 0x55, 0x5C, 0x5C, 0x55, 0x63, 0x62,
-    0x61, 0x38, 0x39, 0x35, 0x2F, 0x2E, 0x2B, 0x2F, 0x2E, 0x2B, 0x63, 0x62, 0x61, 0x38, 0x39, 0x35,
-    0x22, 0x23, 0x22, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x22,
-    0x23, 0x22, 0x2A, 0x2A, 0x29, 0x32, 0x32, 0x2D, 0x39, 0x39, 0x3A, 0x38, 0x39, 0x35, 0x37, 0x36,
-    0x34, 0x63, 0x62, 0x61, 0x5B, 0x5A, 0x5B, 0x5B, 0x5A, 0x5B, 0x5F, 0x5E, 0x5D, 0x32, 0x33, 0x32,
-    0x5B, 0x5A, 0x5B, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24, 0x35,
-    0x34, 0x3A, 0x27, 0x26, 0x24, 0x1F, 0x1E, 0x1E, 0x2A, 0x2A, 0x29, 0x26, 0x23, 0x21, 0x27, 0x26,
-    0x24, 0x23, 0x22, 0x1B, 0x2A, 0x2A, 0x29, 0x43, 0x43, 0x3F, 0x2F, 0x2E, 0x2B, 0x38, 0x39, 0x35,
-    0x28, 0x29, 0x23, 0x20, 0x1D, 0x19, 0x28, 0x29, 0x23, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x26,
-    0x23, 0x21, 0x0F, 0x02, 0x01, 0x41, 0x38, 0x23, 0x31, 0x22, 0x12, 0x24, 0x1B, 0x0C, 0x24, 0x1A,
-    0x11, 0x26, 0x1E, 0x12, 0x30, 0x1D, 0x09, 0x28, 0x21, 0x11, 0x19, 0x13, 0x0E, 0x24, 0x1A, 0x11,
-    0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x28, 0x21, 0x11, 0x24, 0x1B, 0x0C, 0x2D, 0x1E, 0x10, 0x28,
-    0x21, 0x11, 0x2C, 0x1A, 0x09, 0x34, 0x26, 0x12, 0x28, 0x21, 0x11, 0x38, 0x29, 0x18, 0x34, 0x26,
-    0x12, 0x34, 0x26, 0x12, 0x3A, 0x2D, 0x1C, 0x2D, 0x1E, 0x10, 0x2D, 0x1E, 0x10, 0x31, 0x22, 0x12,
-    0x4B, 0x3D, 0x2C, 0x35, 0x26, 0x17, 0x36, 0x29, 0x13, 0x28, 0x21, 0x11, 0x34, 0x26, 0x12, 0x37,
-    0x2A, 0x1C, 0x0F, 0x02, 0x01, 0x42, 0x33, 0x22, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x22, 0x15,
-    0x09, 0x1C, 0x0E, 0x02, 0x1C, 0x0E, 0x02, 0x22, 0x13, 0x04, 0x22, 0x15, 0x09, 0x1C, 0x0E, 0x02,
-    0x2C, 0x1A, 0x09, 0x35, 0x26, 0x17, 0x03, 0x01, 0x02, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x3A, 0x2A,
-    0x2A, 0x29, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28, 0x3E, 0x3E, 0x3F, 0x39, 0x39,
-    0x3A, 0x32, 0x32, 0x2D, 0x03, 0x01, 0x02, 0x0A, 0x0A, 0x09, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x61, 0x5F, 0x64, 0x65, 0x65, 0x66, 0x61, 0x5F, 0x64, 0x48,
-    0x48, 0x41, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x16, 0x0F, 0x09, 0x1C, 0x1A, 0x13, 0x1A, 0x16,
-    0x11, 0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x23, 0x22, 0x1B, 0x2D, 0x2A, 0x23, 0x20, 0x1D, 0x19,
-    0x44, 0x3F, 0x3B, 0x44, 0x3F, 0x3B, 0x44, 0x43, 0x43, 0x3B, 0x3F, 0x2E, 0x34, 0x35, 0x2E, 0x5C,
-    0x5C, 0x55, 0x9B, 0x9A, 0x95, 0x2D, 0x2A, 0x23, 0x28, 0x29, 0x23, 0x9B, 0x9A, 0x95, 0x5C, 0x5C,
-    0x55, 0x43, 0x43, 0x3F, 0x23, 0x22, 0x1B, 0x2F, 0x2E, 0x2B, 0x28, 0x26, 0x20, 0x20, 0x1D, 0x19,
-    0x28, 0x29, 0x23, 0x26, 0x23, 0x21, 0x28, 0x29, 0x23, 0x1C, 0x1A, 0x13, 0x2A, 0x2A, 0x29, 0x27,
-    0x26, 0x24, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20, 0x1F, 0x1E,
-    0x1E, 0x27, 0x26, 0x24, 0x2F, 0x2E, 0x2B, 0x22, 0x23, 0x22, 0x32, 0x33, 0x32, 0x38, 0x39, 0x35,
-    0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x2F, 0x2E, 0x2B, 0x0A, 0x0A, 0x09, 0x03, 0x01, 0x02, 0x3D,
-    0x3D, 0x3B, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x3D, 0x3D, 0x3B, 0x43, 0x43, 0x3F, 0x48, 0x48,
-    0x41, 0x28, 0x26, 0x20, 0x3D, 0x3A, 0x35, 0x34, 0x35, 0x2E, 0x37, 0x36, 0x34, 0x43, 0x43, 0x3F,
-    0x37, 0x36, 0x34, 0x43, 0x43, 0x3F, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x44, 0x3F, 0x3B, 0x28,
-    0x26, 0x20, 0x03, 0x01, 0x02, 0x49, 0x38, 0x29, 0x37, 0x2A, 0x1C, 0x21, 0x16, 0x0F, 0x26, 0x1E,
-    0x12, 0x28, 0x21, 0x11, 0x28, 0x21, 0x11, 0x2D, 0x1E, 0x10, 0x19, 0x13, 0x0E, 0x21, 0x16, 0x0F,
-    0x22, 0x15, 0x09, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x28, 0x21, 0x11, 0x28, 0x21, 0x11, 0x28,
-    0x21, 0x11, 0x1B, 0x1A, 0x0B, 0x34, 0x26, 0x12, 0x35, 0x26, 0x17, 0x34, 0x26, 0x12, 0x35, 0x26,
-    0x17, 0x37, 0x2A, 0x1C, 0x42, 0x33, 0x22, 0x2D, 0x1E, 0x10, 0x2C, 0x1A, 0x09, 0x34, 0x26, 0x12,
-    0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x28, 0x21, 0x11, 0x28, 0x21, 0x11, 0x34, 0x26, 0x12, 0x35,
-    0x26, 0x17, 0x0F, 0x02, 0x01, 0x49, 0x38, 0x29, 0x35, 0x26, 0x17, 0x37, 0x2A, 0x1C, 0x35, 0x26,
-    0x17, 0x38, 0x29, 0x18, 0x3A, 0x2D, 0x1C, 0x2D, 0x1E, 0x10, 0x47, 0x2F, 0x20, 0x31, 0x22, 0x12,
-    0x2D, 0x1E, 0x10, 0x22, 0x13, 0x04, 0x3D, 0x3D, 0x3B, 0x39, 0x39, 0x3A, 0x2A, 0x2A, 0x29, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x27, 0x26, 0x28, 0x39, 0x39,
-    0x3A, 0x32, 0x33, 0x32, 0x37, 0x36, 0x34, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03,
-    0x03, 0x01, 0x02, 0x96, 0x95, 0x94, 0x5B, 0x5A, 0x5B, 0x5B, 0x5A, 0x5B, 0x43, 0x43, 0x3F, 0x32,
-    0x33, 0x32, 0x27, 0x26, 0x24, 0x3D, 0x3A, 0x35, 0x43, 0x43, 0x3F, 0x44, 0x3F, 0x3B, 0x41, 0x42,
-    0x34, 0x44, 0x3F, 0x3B, 0x2D, 0x2A, 0x23, 0x28, 0x29, 0x23, 0x26, 0x23, 0x21, 0x44, 0x3F, 0x3B,
-    0x3D, 0x3D, 0x3B, 0x3D, 0x3A, 0x35, 0x3E, 0x3E, 0x36, 0x4B, 0x4B, 0x42, 0x57, 0x56, 0x54, 0x46,
-    0x47, 0x39, 0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x36, 0x95, 0x93, 0x8D, 0xE0, 0xDF, 0xDE, 0x63, 0x62,
-    0x5B, 0x43, 0x43, 0x3F, 0x44, 0x3F, 0x3B, 0x5F, 0x5E, 0x5D, 0x28, 0x29, 0x23, 0x43, 0x43, 0x3F,
-    0x46, 0x45, 0x47, 0x28, 0x29, 0x23, 0x44, 0x43, 0x43, 0x4B, 0x4B, 0x42, 0x26, 0x23, 0x21, 0x28,
-    0x26, 0x20, 0x28, 0x26, 0x20, 0x63, 0x62, 0x5B, 0x28, 0x26, 0x20, 0x23, 0x22, 0x1B, 0x2C, 0x2D,
-    0x24, 0x43, 0x43, 0x3F, 0x23, 0x22, 0x1B, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x39, 0x43, 0x43, 0x39,
-    0x43, 0x43, 0x39, 0x32, 0x32, 0x2D, 0x38, 0x39, 0x35, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24, 0x48,
-    0x48, 0x41, 0x3D, 0x3D, 0x3B, 0x46, 0x45, 0x47, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x52, 0x52,
-    0x4C, 0x2F, 0x2E, 0x2B, 0x57, 0x56, 0x54, 0x62, 0x5E, 0x55, 0x57, 0x56, 0x54, 0x43, 0x43, 0x39,
-    0x4C, 0x4B, 0x49, 0x3E, 0x3E, 0x36, 0x5C, 0x5C, 0x55, 0x48, 0x48, 0x41, 0x44, 0x43, 0x43, 0x35,
-    0x26, 0x1F, 0x0F, 0x02, 0x01, 0x41, 0x38, 0x23, 0x2D, 0x29, 0x1A, 0x1C, 0x12, 0x04, 0x24, 0x1A,
-    0x11, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x1B, 0x14, 0x0A, 0x21, 0x16, 0x0F,
-    0x21, 0x16, 0x0F, 0x2D, 0x1E, 0x10, 0x24, 0x1B, 0x0C, 0x24, 0x1B, 0x0C, 0x35, 0x26, 0x17, 0x22,
-    0x26, 0x11, 0x2C, 0x1A, 0x09, 0x31, 0x22, 0x12, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x34, 0x26,
-    0x12, 0x38, 0x29, 0x18, 0x42, 0x33, 0x22, 0x2C, 0x1A, 0x09, 0x2C, 0x1A, 0x09, 0x22, 0x15, 0x09,
-    0x1C, 0x12, 0x04, 0x30, 0x1D, 0x09, 0x30, 0x1D, 0x09, 0x34, 0x26, 0x12, 0x38, 0x29, 0x18, 0x35,
-    0x26, 0x17, 0x0F, 0x02, 0x01, 0x49, 0x38, 0x29, 0x31, 0x22, 0x12, 0x3C, 0x25, 0x10, 0x58, 0x48,
-    0x38, 0x4A, 0x38, 0x30, 0x4D, 0x36, 0x21, 0x3A, 0x2D, 0x1C, 0x58, 0x48, 0x38, 0x49, 0x38, 0x29,
-    0x3A, 0x2D, 0x1C, 0x35, 0x26, 0x17, 0x32, 0x33, 0x32, 0x32, 0x32, 0x2D, 0x22, 0x23, 0x22, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x32, 0x33,
-    0x32, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x3A, 0x37, 0x36, 0x34, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x05, 0x06, 0x03, 0x5F, 0x5E, 0x5D, 0x63, 0x62, 0x5B, 0x5F, 0x5E, 0x5D, 0x3D, 0x3D, 0x3B, 0x4D,
-    0x4F, 0x41, 0x48, 0x48, 0x41, 0x43, 0x43, 0x39, 0x43, 0x43, 0x39, 0x43, 0x43, 0x39, 0x43, 0x43,
-    0x39, 0x43, 0x43, 0x39, 0x3E, 0x3A, 0x2D, 0x43, 0x43, 0x39, 0x43, 0x43, 0x3F, 0x20, 0x1D, 0x19,
-    0x3D, 0x3D, 0x3B, 0x48, 0x48, 0x41, 0x46, 0x47, 0x39, 0x43, 0x43, 0x39, 0x43, 0x43, 0x39, 0x41,
-    0x42, 0x34, 0x4B, 0x4B, 0x42, 0x48, 0x48, 0x41, 0x43, 0x43, 0x39, 0x23, 0x22, 0x1B, 0x23, 0x22,
-    0x1B, 0x63, 0x62, 0x5B, 0x2C, 0x2D, 0x24, 0x96, 0x95, 0x94, 0x5C, 0x5C, 0x55, 0x48, 0x48, 0x41,
-    0x43, 0x43, 0x39, 0x22, 0x23, 0x22, 0x3E, 0x3E, 0x36, 0x43, 0x43, 0x3F, 0x35, 0x26, 0x1F, 0x2D,
-    0x2A, 0x23, 0x5C, 0x5C, 0x55, 0x95, 0x93, 0x8D, 0x3D, 0x3A, 0x35, 0x28, 0x26, 0x20, 0x3E, 0x3E,
-    0x36, 0x43, 0x43, 0x39, 0x3E, 0x3E, 0x36, 0x3B, 0x3F, 0x2E, 0x32, 0x32, 0x2D, 0x48, 0x48, 0x41,
-    0x48, 0x48, 0x41, 0x4B, 0x4B, 0x42, 0x43, 0x43, 0x3F, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05,
-    0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x09, 0x0A, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x4B, 0x3D, 0x2C, 0x35, 0x26, 0x17, 0x24, 0x1A, 0x11, 0x26, 0x1E,
-    0x12, 0x28, 0x21, 0x11, 0x28, 0x21, 0x11, 0x26, 0x1E, 0x12, 0x19, 0x13, 0x0E, 0x19, 0x13, 0x0E,
-    0x1B, 0x14, 0x0A, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x28,
-    0x21, 0x11, 0x22, 0x15, 0x09, 0x24, 0x1B, 0x0C, 0x38, 0x29, 0x18, 0x2D, 0x29, 0x1A, 0x38, 0x29,
-    0x18, 0x28, 0x21, 0x11, 0x34, 0x26, 0x12, 0x1B, 0x1A, 0x0B, 0x42, 0x33, 0x22, 0x35, 0x26, 0x17,
-    0x26, 0x1E, 0x12, 0x30, 0x1D, 0x09, 0x30, 0x1D, 0x09, 0x38, 0x29, 0x18, 0x4D, 0x36, 0x21, 0x38,
-    0x29, 0x18, 0x0F, 0x02, 0x01, 0x4B, 0x3D, 0x2C, 0x38, 0x29, 0x18, 0x49, 0x38, 0x29, 0x38, 0x29,
-    0x18, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x2D, 0x1E, 0x10, 0x3A, 0x2D, 0x1C, 0x31, 0x22, 0x12,
-    0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x37, 0x36, 0x34, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E, 0x3F, 0x28,
-    0x29, 0x23, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x39, 0x39, 0x3A, 0x39, 0x39,
-    0x3A, 0x37, 0x36, 0x34, 0x2F, 0x2E, 0x2B, 0x03, 0x01, 0x02, 0x09, 0x0A, 0x03, 0x03, 0x01, 0x02,
-    0x34, 0x35, 0x2E, 0x63, 0x62, 0x61, 0x5F, 0x5E, 0x5D, 0x43, 0x43, 0x39, 0x43, 0x43, 0x3F, 0x38,
-    0x39, 0x35, 0x43, 0x43, 0x39, 0x46, 0x47, 0x39, 0x4B, 0x4B, 0x42, 0x41, 0x42, 0x34, 0x43, 0x43,
-    0x39, 0x47, 0x4C, 0x39, 0x43, 0x43, 0x39, 0x43, 0x43, 0x39, 0x41, 0x42, 0x34, 0x52, 0x52, 0x4C,
-    0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x63, 0x62, 0x5B, 0x5D, 0x5E, 0x4C, 0x62,
-    0x5E, 0x55, 0x43, 0x43, 0x39, 0x3B, 0x3F, 0x2E, 0x62, 0x5E, 0x55, 0x62, 0x5E, 0x55, 0x5C, 0x5C,
-    0x55, 0x5B, 0x5A, 0x4C, 0xD3, 0xD2, 0xD1, 0x96, 0x95, 0x94, 0x63, 0x62, 0x5B, 0x1A, 0x16, 0x11,
-    0x20, 0x1D, 0x19, 0x2C, 0x2D, 0x24, 0x33, 0x32, 0x23, 0x2C, 0x2D, 0x24, 0x28, 0x29, 0x23, 0x43,
-    0x43, 0x39, 0x62, 0x5E, 0x55, 0x3E, 0x3E, 0x36, 0x3E, 0x3A, 0x2D, 0x43, 0x43, 0x39, 0x48, 0x48,
-    0x41, 0x3E, 0x3E, 0x36, 0x4B, 0x4B, 0x42, 0x48, 0x48, 0x41, 0x43, 0x43, 0x39, 0x43, 0x43, 0x39,
-    0x48, 0x48, 0x41, 0x3E, 0x3E, 0x36, 0x43, 0x43, 0x3F, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x09,
-    0x0A, 0x03, 0x0F, 0x02, 0x01, 0x46, 0x47, 0x39, 0x38, 0x29, 0x18, 0x22, 0x15, 0x09, 0x24, 0x1A,
-    0x11, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11,
-    0x21, 0x16, 0x0F, 0x26, 0x1E, 0x12, 0x2D, 0x1E, 0x10, 0x26, 0x1E, 0x12, 0x35, 0x26, 0x17, 0x2E,
-    0x26, 0x1A, 0x30, 0x1D, 0x09, 0x1B, 0x1A, 0x0B, 0x36, 0x29, 0x13, 0x35, 0x26, 0x17, 0x34, 0x26,
-    0x12, 0x22, 0x13, 0x04, 0x22, 0x13, 0x04, 0x22, 0x13, 0x04, 0x41, 0x38, 0x23, 0x2D, 0x29, 0x1A,
-    0x35, 0x26, 0x17, 0x2D, 0x1E, 0x10, 0x68, 0x59, 0x4B, 0x4D, 0x36, 0x21, 0x31, 0x22, 0x12, 0x31,
-    0x22, 0x12, 0x0F, 0x02, 0x01, 0x5B, 0x4D, 0x3F, 0x2D, 0x1E, 0x10, 0x22, 0x15, 0x09, 0x2D, 0x1E,
-    0x10, 0x3A, 0x2D, 0x1C, 0x3A, 0x2D, 0x1C, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18,
-    0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x05, 0x06, 0x03, 0x2F, 0x2E, 0x2B, 0x48, 0x48, 0x41, 0x5B,
-    0x5A, 0x5B, 0x7E, 0x7E, 0x7D, 0xDC, 0xDB, 0xD9, 0x7E, 0x7E, 0x7D, 0x35, 0x34, 0x3A, 0x32, 0x33,
-    0x32, 0x37, 0x36, 0x34, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x63, 0x62, 0x61,
-    0x5C, 0x5C, 0x55, 0x5C, 0x5C, 0x55, 0x57, 0x57, 0x4C, 0x62, 0x5E, 0x55, 0x62, 0x62, 0x52, 0x63,
-    0x62, 0x5B, 0x5D, 0x5E, 0x4C, 0x62, 0x62, 0x52, 0x57, 0x57, 0x4C, 0x61, 0x62, 0x4A, 0x62, 0x62,
-    0x52, 0x63, 0x62, 0x5B, 0x62, 0x62, 0x52, 0x5C, 0x5C, 0x55, 0x6C, 0x6E, 0x60, 0x63, 0x62, 0x5B,
-    0x74, 0x74, 0x6F, 0x6C, 0x6E, 0x60, 0x5B, 0x5A, 0x4C, 0x5D, 0x5E, 0x4C, 0x62, 0x5E, 0x55, 0x53,
-    0x53, 0x44, 0x6C, 0x6E, 0x60, 0x62, 0x5E, 0x55, 0x63, 0x62, 0x5B, 0x3E, 0x3E, 0x36, 0x41, 0x42,
-    0x34, 0x2C, 0x2D, 0x24, 0x28, 0x29, 0x23, 0x23, 0x22, 0x1B, 0x19, 0x13, 0x0E, 0x1B, 0x14, 0x0A,
-    0x1C, 0x1A, 0x13, 0x1B, 0x14, 0x0A, 0x16, 0x0F, 0x09, 0x1C, 0x12, 0x04, 0x5B, 0x5A, 0x4C, 0x2D,
-    0x29, 0x1A, 0x57, 0x57, 0x4C, 0x33, 0x32, 0x23, 0x23, 0x22, 0x1B, 0x62, 0x62, 0x52, 0x62, 0x62,
-    0x52, 0x5B, 0x5A, 0x4C, 0x5D, 0x5E, 0x4C, 0x63, 0x62, 0x5B, 0x6C, 0x6E, 0x60, 0x5D, 0x5E, 0x4C,
-    0x6C, 0x6E, 0x60, 0x63, 0x62, 0x5B, 0x43, 0x43, 0x39, 0x03, 0x01, 0x02, 0x65, 0x65, 0x66, 0x38,
-    0x39, 0x35, 0x32, 0x33, 0x32, 0x32, 0x32, 0x2D, 0x37, 0x36, 0x34, 0x27, 0x26, 0x24, 0x28, 0x29,
-    0x23, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x1C, 0x1A, 0x13, 0x3E, 0x3E, 0x36, 0x1C, 0x1A, 0x13,
-    0x28, 0x29, 0x23, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x26, 0x23, 0x21, 0x1F, 0x1E, 0x1E, 0x2E,
-    0x26, 0x1A, 0x03, 0x01, 0x02, 0x5B, 0x4D, 0x3F, 0x37, 0x2C, 0x21, 0x1C, 0x12, 0x04, 0x26, 0x1E,
-    0x12, 0x26, 0x1E, 0x12, 0x24, 0x1B, 0x0C, 0x2B, 0x22, 0x18, 0x21, 0x16, 0x0F, 0x1A, 0x16, 0x11,
-    0x22, 0x15, 0x09, 0x24, 0x1A, 0x11, 0x26, 0x1E, 0x12, 0x2B, 0x22, 0x18, 0x35, 0x26, 0x17, 0x2D,
-    0x29, 0x1A, 0x38, 0x29, 0x18, 0x2D, 0x1E, 0x10, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x34, 0x26,
-    0x12, 0x24, 0x1B, 0x0C, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x3A, 0x2D, 0x1C, 0x31, 0x22, 0x12,
-    0x38, 0x29, 0x18, 0x38, 0x29, 0x18, 0x4B, 0x3D, 0x2C, 0x3E, 0x2A, 0x12, 0x3C, 0x25, 0x10, 0x35,
-    0x26, 0x17, 0x1E, 0x01, 0x01, 0x58, 0x48, 0x38, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x2D, 0x1E,
-    0x10, 0x1C, 0x0E, 0x02, 0x1C, 0x0E, 0x02, 0x22, 0x13, 0x04, 0x2C, 0x1A, 0x09, 0x1C, 0x12, 0x04,
-    0x2C, 0x1A, 0x09, 0x31, 0x22, 0x12, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x32, 0x33, 0x32, 0x38,
-    0x39, 0x35, 0x39, 0x39, 0x3A, 0x32, 0x33, 0x32, 0x35, 0x34, 0x3A, 0x37, 0x36, 0x34, 0x37, 0x36,
-    0x34, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x23, 0x22, 0x1B,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05,
-    0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x32, 0x32, 0x2D, 0x03,
-    0x01, 0x02, 0x05, 0x06, 0x03, 0x05, 0x06, 0x03, 0x24, 0x2B, 0x11, 0x05, 0x06, 0x03, 0x05, 0x06,
-    0x03, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2D, 0x29, 0x1A, 0x03, 0x01, 0x02,
-    0x34, 0x35, 0x2E, 0x28, 0x29, 0x23, 0x28, 0x26, 0x20, 0x2C, 0x2D, 0x24, 0x20, 0x1D, 0x19, 0x26,
-    0x23, 0x21, 0x0F, 0x02, 0x01, 0x5B, 0x4D, 0x3F, 0x31, 0x22, 0x12, 0x22, 0x15, 0x09, 0x26, 0x1E,
-    0x12, 0x26, 0x1E, 0x12, 0x24, 0x1B, 0x0C, 0x26, 0x1E, 0x12, 0x24, 0x1A, 0x11, 0x21, 0x16, 0x0F,
-    0x21, 0x16, 0x0F, 0x24, 0x1A, 0x11, 0x26, 0x1E, 0x12, 0x24, 0x1B, 0x0C, 0x24, 0x1B, 0x0C, 0x28,
-    0x21, 0x11, 0x35, 0x26, 0x17, 0x24, 0x1B, 0x0C, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x35, 0x26,
-    0x17, 0x24, 0x1B, 0x0C, 0x38, 0x29, 0x18, 0x38, 0x29, 0x18, 0x28, 0x21, 0x11, 0x31, 0x22, 0x12,
-    0x31, 0x22, 0x12, 0x38, 0x29, 0x18, 0x34, 0x26, 0x12, 0x2D, 0x1E, 0x10, 0x38, 0x29, 0x18, 0x38,
-    0x29, 0x18, 0x0F, 0x02, 0x01, 0x58, 0x48, 0x38, 0x37, 0x2A, 0x1C, 0x35, 0x26, 0x17, 0x35, 0x26,
-    0x17, 0x3C, 0x25, 0x10, 0x37, 0x2A, 0x1C, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17,
-    0x31, 0x22, 0x12, 0x2C, 0x1A, 0x09, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x32,
-    0x33, 0x32, 0x39, 0x39, 0x3A, 0x3D, 0x3D, 0x3B, 0x32, 0x33, 0x32, 0x34, 0x35, 0x2E, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E,
-    0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x28,
-    0x26, 0x20, 0x28, 0x26, 0x20, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x23, 0x22, 0x1B, 0x27, 0x26,
-    0x24, 0x26, 0x23, 0x21, 0x28, 0x26, 0x20, 0x2B, 0x22, 0x18, 0x37, 0x2C, 0x21, 0x35, 0x26, 0x1F,
-    0x30, 0x1F, 0x18, 0x37, 0x2C, 0x21, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F,
-    0x02, 0x01, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x28, 0x26, 0x20, 0x28, 0x29,
-    0x23, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x27, 0x26, 0x24, 0x35, 0x26, 0x1F, 0x5F, 0x5E, 0x5D,
-    0x28, 0x26, 0x20, 0x35, 0x26, 0x1F, 0x26, 0x23, 0x21, 0x35, 0x26, 0x1F, 0x27, 0x26, 0x24, 0x28,
-    0x26, 0x20, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x22, 0x23,
-    0x22, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x26, 0x23, 0x21, 0x27, 0x26, 0x24,
-    0x35, 0x26, 0x1F, 0x1F, 0x1E, 0x1E, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02, 0x22, 0x26, 0x11, 0x05,
-    0x06, 0x03, 0xDB, 0xE7, 0xB9, 0xD4, 0xDF, 0xAA, 0xCF, 0xDD, 0x9D, 0xC4, 0xD7, 0x97, 0xC4, 0xD7,
-    0x97, 0xD9, 0xE7, 0xA9, 0xD4, 0xDF, 0xAA, 0xD5, 0xDB, 0xB7, 0x28, 0x2E, 0x19, 0x41, 0x42, 0x34,
-    0x3E, 0x3A, 0x2D, 0x23, 0x22, 0x1B, 0x2D, 0x2A, 0x23, 0x35, 0x26, 0x1F, 0x2D, 0x2A, 0x23, 0x30,
-    0x1F, 0x18, 0x03, 0x01, 0x02, 0x5B, 0x4D, 0x3F, 0x2B, 0x22, 0x18, 0x24, 0x1B, 0x0C, 0x2D, 0x1E,
-    0x10, 0x26, 0x1E, 0x12, 0x24, 0x1B, 0x0C, 0x26, 0x1E, 0x12, 0x21, 0x16, 0x0F, 0x24, 0x1A, 0x11,
-    0x21, 0x16, 0x0F, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x35, 0x26, 0x17, 0x2D,
-    0x29, 0x1A, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x2D, 0x29, 0x1A, 0x36, 0x29, 0x13, 0x34, 0x26,
-    0x12, 0x2D, 0x1E, 0x10, 0x38, 0x29, 0x18, 0x34, 0x26, 0x12, 0x2D, 0x1E, 0x10, 0x35, 0x26, 0x17,
-    0x31, 0x22, 0x12, 0x31, 0x22, 0x12, 0x34, 0x26, 0x12, 0x34, 0x26, 0x12, 0x3E, 0x2A, 0x12, 0x31,
-    0x22, 0x12, 0x0F, 0x02, 0x01, 0x4A, 0x38, 0x30, 0x37, 0x2A, 0x1C, 0x3C, 0x25, 0x10, 0x58, 0x48,
-    0x38, 0x4B, 0x3D, 0x2C, 0x42, 0x33, 0x22, 0x3E, 0x2A, 0x12, 0x57, 0x4C, 0x39, 0x4D, 0x36, 0x21,
-    0x38, 0x29, 0x18, 0x34, 0x26, 0x12, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x38, 0x39, 0x35, 0x2F, 0x2E, 0x30, 0x38, 0x39, 0x35, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x39, 0x43, 0x43, 0x3F, 0x38, 0x39, 0x35, 0x43, 0x43, 0x39,
-    0x3E, 0x3E, 0x36, 0x3E, 0x3E, 0x36, 0x3D, 0x3D, 0x3B, 0x48, 0x48, 0x41, 0x3E, 0x3E, 0x3F, 0x63,
-    0x62, 0x61, 0x39, 0x39, 0x3A, 0x43, 0x43, 0x3F, 0x38, 0x39, 0x35, 0x4C, 0x4B, 0x49, 0x2D, 0x2A,
-    0x23, 0x62, 0x5E, 0x55, 0x9A, 0x9A, 0x9A, 0x62, 0x5E, 0x55, 0x26, 0x23, 0x21, 0x37, 0x2C, 0x21,
-    0x39, 0x33, 0x2C, 0x2B, 0x22, 0x18, 0x2B, 0x22, 0x18, 0x4A, 0x3D, 0x34, 0x27, 0x26, 0x24, 0x3D,
-    0x36, 0x2C, 0x63, 0x62, 0x61, 0x28, 0x26, 0x20, 0x5C, 0x5C, 0x55, 0x27, 0x26, 0x24, 0x1F, 0x1E,
-    0x1E, 0x5F, 0x5E, 0x5D, 0x57, 0x56, 0x54, 0x63, 0x62, 0x5B, 0x5C, 0x5C, 0x55, 0x95, 0x93, 0x8D,
-    0xD8, 0xD6, 0xD2, 0x37, 0x2C, 0x21, 0x5B, 0x5A, 0x5B, 0x62, 0x5E, 0x55, 0x5F, 0x5E, 0x5D, 0x5F,
-    0x5E, 0x5D, 0x62, 0x5E, 0x55, 0x35, 0x34, 0x3A, 0x3D, 0x3D, 0x3B, 0x2F, 0x2E, 0x30, 0x61, 0x5F,
-    0x64, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x3A, 0x27, 0x26, 0x24, 0x2D, 0x2A, 0x23, 0x3D, 0x3A, 0x35,
-    0x2F, 0x2E, 0x2B, 0x44, 0x3F, 0x3B, 0x29, 0x25, 0x2E, 0x03, 0x01, 0x02, 0x33, 0x32, 0x23, 0x05,
-    0x06, 0x03, 0x25, 0x33, 0x03, 0x1F, 0x2B, 0x04, 0x28, 0x38, 0x01, 0x28, 0x38, 0x01, 0x28, 0x38,
-    0x01, 0x28, 0x38, 0x01, 0x1F, 0x2B, 0x04, 0x28, 0x34, 0x0F, 0x28, 0x2E, 0x19, 0x3E, 0x3A, 0x2D,
-    0x28, 0x29, 0x23, 0x28, 0x26, 0x20, 0x23, 0x22, 0x1B, 0x39, 0x33, 0x2C, 0x35, 0x26, 0x1F, 0x2E,
-    0x26, 0x1A, 0x0F, 0x02, 0x01, 0x3D, 0x36, 0x2C, 0x35, 0x26, 0x17, 0x1C, 0x12, 0x04, 0x24, 0x1B,
-    0x0C, 0x28, 0x21, 0x11, 0x24, 0x1B, 0x0C, 0x26, 0x1E, 0x12, 0x22, 0x15, 0x09, 0x1B, 0x1A, 0x0B,
-    0x24, 0x1A, 0x11, 0x26, 0x1E, 0x12, 0x24, 0x1A, 0x11, 0x2D, 0x1E, 0x10, 0x26, 0x1E, 0x12, 0x28,
-    0x21, 0x11, 0x28, 0x21, 0x11, 0x2B, 0x22, 0x18, 0x28, 0x21, 0x11, 0x22, 0x15, 0x09, 0x37, 0x2A,
-    0x1C, 0x24, 0x1B, 0x0C, 0x2D, 0x1E, 0x10, 0x2D, 0x1E, 0x10, 0x31, 0x22, 0x12, 0x34, 0x26, 0x12,
-    0x35, 0x26, 0x17, 0x2D, 0x1E, 0x10, 0x3C, 0x25, 0x10, 0x36, 0x29, 0x13, 0x35, 0x26, 0x17, 0x38,
-    0x29, 0x18, 0x0F, 0x02, 0x01, 0x42, 0x33, 0x22, 0x35, 0x26, 0x17, 0x4A, 0x38, 0x30, 0x37, 0x2A,
-    0x1C, 0x31, 0x22, 0x12, 0x38, 0x29, 0x18, 0x34, 0x26, 0x12, 0x38, 0x29, 0x18, 0x31, 0x22, 0x12,
-    0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x37, 0x36, 0x34, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06,
-    0x03, 0x43, 0x43, 0x39, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x38, 0x39, 0x35,
-    0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x36, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x44,
-    0x43, 0x43, 0x38, 0x39, 0x35, 0x44, 0x3F, 0x3B, 0x44, 0x43, 0x43, 0x37, 0x36, 0x34, 0x27, 0x26,
-    0x24, 0x3D, 0x3D, 0x3B, 0x4A, 0x3D, 0x34, 0x44, 0x3F, 0x3B, 0x4A, 0x38, 0x30, 0x37, 0x2C, 0x21,
-    0x44, 0x3F, 0x3B, 0x2E, 0x26, 0x1A, 0x35, 0x26, 0x1F, 0x2C, 0x2D, 0x24, 0x35, 0x26, 0x1F, 0x3E,
-    0x3E, 0x36, 0x3D, 0x3D, 0x3B, 0x2F, 0x2E, 0x2B, 0x3E, 0x3E, 0x3F, 0x38, 0x39, 0x35, 0x3D, 0x3D,
-    0x3B, 0x3D, 0x3D, 0x3B, 0x4E, 0x44, 0x40, 0x3D, 0x3A, 0x35, 0x23, 0x22, 0x1B, 0x1A, 0x16, 0x11,
-    0x19, 0x13, 0x0E, 0x19, 0x13, 0x0E, 0x1C, 0x1A, 0x13, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20, 0x2A,
-    0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x39, 0x39, 0x3A, 0x3E, 0x3E, 0x3F, 0x32, 0x33,
-    0x32, 0x43, 0x43, 0x3F, 0x3D, 0x3D, 0x3B, 0x44, 0x43, 0x43, 0x37, 0x33, 0x32, 0x2A, 0x2A, 0x29,
-    0x4A, 0x38, 0x30, 0x3D, 0x3D, 0x3B, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x28, 0x29, 0x23, 0x03,
-    0x01, 0x02, 0x05, 0x06, 0x03, 0x09, 0x0A, 0x03, 0x09, 0x0A, 0x03, 0x09, 0x0A, 0x03, 0x05, 0x06,
-    0x03, 0x05, 0x06, 0x03, 0x09, 0x0A, 0x03, 0x05, 0x06, 0x03, 0x23, 0x22, 0x1B, 0x46, 0x47, 0x39,
-    0x34, 0x35, 0x2E, 0x2D, 0x2A, 0x23, 0x0F, 0x02, 0x01, 0x2B, 0x22, 0x18, 0x2B, 0x22, 0x18, 0x35,
-    0x26, 0x1F, 0x09, 0x0A, 0x03, 0x3D, 0x36, 0x2C, 0x3A, 0x2D, 0x1C, 0x1B, 0x1A, 0x0B, 0x24, 0x1B,
-    0x0C, 0x28, 0x21, 0x11, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x1B, 0x14, 0x0A, 0x1B, 0x14, 0x0A,
-    0x21, 0x16, 0x0F, 0x28, 0x21, 0x11, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x34, 0x26, 0x12, 0x24,
-    0x1B, 0x0C, 0x2C, 0x1A, 0x09, 0x28, 0x21, 0x11, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x38, 0x29,
-    0x18, 0x30, 0x1D, 0x09, 0x2D, 0x1E, 0x10, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x2D, 0x1E, 0x10,
-    0x31, 0x22, 0x12, 0x2C, 0x1A, 0x09, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x31, 0x22, 0x12, 0x37,
-    0x2C, 0x21, 0x0F, 0x02, 0x01, 0x4A, 0x38, 0x30, 0x30, 0x1F, 0x18, 0x22, 0x13, 0x04, 0x35, 0x26,
-    0x17, 0x3A, 0x2D, 0x1C, 0x31, 0x22, 0x12, 0x3C, 0x25, 0x10, 0x35, 0x26, 0x17, 0x3A, 0x2D, 0x1C,
-    0x30, 0x1F, 0x18, 0x37, 0x2A, 0x1C, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x2F, 0x2E, 0x2B, 0x3E, 0x3E, 0x36, 0x48, 0x48, 0x41, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x39,
-    0x38, 0x39, 0x35, 0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x36, 0x32, 0x33, 0x32, 0x37, 0x36, 0x34, 0x37,
-    0x36, 0x34, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x2D, 0x2A,
-    0x23, 0x26, 0x23, 0x21, 0x20, 0x1D, 0x19, 0x3D, 0x3A, 0x35, 0x2D, 0x2A, 0x23, 0x20, 0x1D, 0x19,
-    0x37, 0x2C, 0x21, 0x35, 0x26, 0x1F, 0x2D, 0x2A, 0x23, 0x2E, 0x26, 0x1A, 0x23, 0x22, 0x1B, 0x2D,
-    0x2A, 0x23, 0x23, 0x22, 0x1B, 0x23, 0x22, 0x1B, 0x27, 0x26, 0x24, 0x2C, 0x2D, 0x24, 0x2F, 0x2E,
-    0x2B, 0x23, 0x22, 0x1B, 0x1C, 0x1A, 0x13, 0x23, 0x22, 0x1B, 0x21, 0x16, 0x0F, 0x23, 0x22, 0x1B,
-    0x26, 0x1E, 0x12, 0x20, 0x1D, 0x19, 0x26, 0x1E, 0x12, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x2D,
-    0x2A, 0x23, 0x2A, 0x2A, 0x29, 0x20, 0x1D, 0x19, 0x2F, 0x2E, 0x2B, 0x2F, 0x2E, 0x30, 0x2A, 0x2A,
-    0x29, 0x23, 0x22, 0x1B, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20, 0x2A, 0x2A, 0x29, 0x2D, 0x2A, 0x23,
-    0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x28,
-    0x29, 0x23, 0x2C, 0x2D, 0x24, 0x22, 0x26, 0x11, 0x24, 0x2B, 0x11, 0x28, 0x26, 0x20, 0x38, 0x39,
-    0x35, 0x39, 0x39, 0x3A, 0x32, 0x33, 0x32, 0x5B, 0x5A, 0x5B, 0x63, 0x62, 0x5B, 0xBA, 0xB6, 0xB1,
-    0x3E, 0x3E, 0x36, 0x23, 0x22, 0x1B, 0x2E, 0x26, 0x1A, 0x37, 0x2A, 0x1C, 0x2D, 0x2A, 0x23, 0x26,
-    0x1E, 0x12, 0x03, 0x01, 0x02, 0x49, 0x38, 0x29, 0x2E, 0x26, 0x1A, 0x1C, 0x12, 0x04, 0x28, 0x21,
-    0x11, 0x30, 0x1D, 0x09, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x22, 0x15, 0x09, 0x1C, 0x12, 0x04,
-    0x22, 0x15, 0x09, 0x26, 0x1E, 0x12, 0x28, 0x21, 0x11, 0x2D, 0x1E, 0x10, 0x24, 0x1B, 0x0C, 0x24,
-    0x1B, 0x0C, 0x2D, 0x1E, 0x10, 0x38, 0x29, 0x18, 0x37, 0x2A, 0x1C, 0x34, 0x26, 0x12, 0x31, 0x22,
-    0x12, 0x24, 0x1B, 0x0C, 0x34, 0x26, 0x12, 0x38, 0x29, 0x18, 0x37, 0x2A, 0x1C, 0x2C, 0x1A, 0x09,
-    0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x38, 0x29, 0x18, 0x4F, 0x3A, 0x23, 0x35, 0x26, 0x17, 0x31,
-    0x22, 0x12, 0x0F, 0x02, 0x01, 0x4A, 0x38, 0x30, 0x35, 0x26, 0x17, 0x37, 0x2C, 0x21, 0x0F, 0x02,
-    0x01, 0x22, 0x13, 0x04, 0x22, 0x13, 0x04, 0x22, 0x13, 0x04, 0x22, 0x13, 0x04, 0x22, 0x15, 0x09,
-    0x22, 0x13, 0x04, 0x38, 0x29, 0x18, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x4B, 0x4B, 0x42, 0x4C, 0x4B, 0x49,
-    0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x36, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x37, 0x36, 0x34, 0x23,
-    0x22, 0x1B, 0x22, 0x23, 0x22, 0x28, 0x26, 0x20, 0x2F, 0x2E, 0x2B, 0x28, 0x26, 0x20, 0x28, 0x29,
-    0x23, 0x2F, 0x2E, 0x2B, 0x05, 0x06, 0x03, 0x23, 0x22, 0x1B, 0x35, 0x26, 0x1F, 0x2D, 0x2A, 0x23,
-    0x2E, 0x26, 0x1A, 0x2D, 0x2A, 0x23, 0x2D, 0x2A, 0x23, 0x23, 0x22, 0x1B, 0x2D, 0x2A, 0x23, 0x28,
-    0x26, 0x20, 0x28, 0x29, 0x23, 0x05, 0x06, 0x03, 0x23, 0x22, 0x1B, 0x23, 0x22, 0x1B, 0x20, 0x1D,
-    0x19, 0x2F, 0x2E, 0x2B, 0x28, 0x26, 0x20, 0x1C, 0x1A, 0x13, 0x23, 0x22, 0x1B, 0x1B, 0x14, 0x0A,
-    0x2E, 0x26, 0x1A, 0x37, 0x2C, 0x21, 0x28, 0x26, 0x20, 0x37, 0x2C, 0x21, 0x9B, 0x9A, 0x95, 0x20,
-    0x1D, 0x19, 0x37, 0x2C, 0x21, 0x2A, 0x2A, 0x29, 0x28, 0x26, 0x20, 0x2F, 0x2E, 0x2B, 0x37, 0x36,
-    0x34, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x20, 0x1D, 0x19, 0x28, 0x26, 0x20, 0x27, 0x26, 0x24,
-    0x2D, 0x2A, 0x23, 0x27, 0x26, 0x24, 0x21, 0x1E, 0x26, 0x08, 0x06, 0x0F, 0x1F, 0x1E, 0x1E, 0x28,
-    0x26, 0x20, 0xC7, 0xD2, 0xAD, 0xC1, 0xD1, 0xA1, 0x8D, 0x98, 0x69, 0x1F, 0x2B, 0x04, 0x33, 0x32,
-    0x23, 0x2A, 0x2A, 0x29, 0x21, 0x1E, 0x26, 0x2F, 0x2E, 0x30, 0x28, 0x29, 0x23, 0x22, 0x26, 0x11,
-    0x2C, 0x2D, 0x24, 0x2E, 0x26, 0x1A, 0x23, 0x22, 0x1B, 0x2B, 0x22, 0x18, 0x2D, 0x2A, 0x23, 0x2E,
-    0x26, 0x1A, 0x0F, 0x02, 0x01, 0x4B, 0x4B, 0x42, 0x3A, 0x2D, 0x1C, 0x22, 0x15, 0x09, 0x26, 0x1E,
-    0x12, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x24, 0x1B, 0x0C, 0x1B, 0x1A, 0x0B, 0x1C, 0x12, 0x04,
-    0x1B, 0x1A, 0x0B, 0x26, 0x1E, 0x12, 0x24, 0x1B, 0x0C, 0x28, 0x21, 0x11, 0x37, 0x2A, 0x1C, 0x37,
-    0x2A, 0x1C, 0x31, 0x22, 0x12, 0x26, 0x1E, 0x12, 0x34, 0x26, 0x12, 0x38, 0x29, 0x18, 0x35, 0x26,
-    0x17, 0x2D, 0x1E, 0x10, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x22, 0x15, 0x09,
-    0x42, 0x33, 0x22, 0x4D, 0x36, 0x21, 0x5C, 0x5D, 0x43, 0x4F, 0x3A, 0x23, 0x31, 0x22, 0x12, 0x35,
-    0x26, 0x17, 0x0F, 0x02, 0x01, 0x49, 0x38, 0x29, 0x37, 0x2A, 0x1C, 0x31, 0x22, 0x12, 0x38, 0x29,
-    0x18, 0x34, 0x26, 0x12, 0x34, 0x26, 0x12, 0x36, 0x29, 0x13, 0x34, 0x26, 0x12, 0x36, 0x29, 0x13,
-    0x31, 0x22, 0x12, 0x22, 0x13, 0x04, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x43, 0x43, 0x3F,
-    0x4B, 0x4B, 0x42, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x36, 0x3E, 0x3E, 0x3F, 0x3E,
-    0x3E, 0x36, 0x3D, 0x3D, 0x3B, 0x23, 0x22, 0x1B, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20, 0x22, 0x23,
-    0x22, 0x20, 0x1D, 0x19, 0x05, 0x06, 0x03, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x28, 0x29, 0x23,
-    0x26, 0x1E, 0x12, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x23,
-    0x22, 0x1B, 0x28, 0x26, 0x20, 0x03, 0x01, 0x02, 0x3D, 0x3D, 0x3B, 0x38, 0x39, 0x35, 0x38, 0x39,
-    0x35, 0x3E, 0x3A, 0x2D, 0x32, 0x32, 0x2D, 0x2D, 0x2A, 0x23, 0x3D, 0x36, 0x2C, 0x1B, 0x1A, 0x0B,
-    0x35, 0x26, 0x1F, 0x2B, 0x22, 0x18, 0x24, 0x1A, 0x11, 0x1C, 0x1A, 0x13, 0x28, 0x26, 0x20, 0x20,
-    0x1D, 0x19, 0x23, 0x22, 0x1B, 0x37, 0x33, 0x32, 0x2F, 0x2E, 0x2B, 0x37, 0x36, 0x34, 0x27, 0x26,
-    0x24, 0x3D, 0x3A, 0x35, 0x32, 0x32, 0x2D, 0x3D, 0x3D, 0x3B, 0x2D, 0x2A, 0x23, 0x2A, 0x2A, 0x29,
-    0x34, 0x35, 0x2E, 0x2F, 0x2E, 0x2B, 0x3B, 0x36, 0x43, 0x05, 0x05, 0x08, 0x27, 0x26, 0x28, 0x3B,
-    0x3F, 0x2E, 0xC1, 0xCB, 0xA9, 0x25, 0x33, 0x03, 0x7F, 0x8B, 0x59, 0x28, 0x34, 0x0F, 0x3B, 0x43,
-    0x2B, 0x22, 0x26, 0x11, 0x39, 0x39, 0x3A, 0x28, 0x29, 0x23, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20,
-    0x37, 0x36, 0x34, 0x34, 0x35, 0x2E, 0x3E, 0x3A, 0x2D, 0x3D, 0x36, 0x2C, 0x2E, 0x26, 0x1A, 0x2E,
-    0x26, 0x1A, 0x0F, 0x02, 0x01, 0x3E, 0x3A, 0x2D, 0x37, 0x2A, 0x1C, 0x1B, 0x1A, 0x0B, 0x26, 0x1E,
-    0x12, 0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x24, 0x1B, 0x0C, 0x26, 0x1E, 0x12, 0x1B, 0x1A, 0x0B,
-    0x24, 0x1A, 0x11, 0x1C, 0x1A, 0x13, 0x28, 0x21, 0x11, 0x24, 0x1A, 0x11, 0x2D, 0x1E, 0x10, 0x2D,
-    0x29, 0x1A, 0x37, 0x2A, 0x1C, 0x35, 0x26, 0x17, 0x2E, 0x26, 0x1A, 0x35, 0x26, 0x17, 0x2D, 0x29,
-    0x1A, 0x2D, 0x1E, 0x10, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x2D, 0x1E, 0x10,
-    0x37, 0x2A, 0x1C, 0x3A, 0x2D, 0x1C, 0x36, 0x29, 0x13, 0x42, 0x33, 0x22, 0x36, 0x29, 0x13, 0x34,
-    0x26, 0x12, 0x0F, 0x02, 0x01, 0x3A, 0x2D, 0x1C, 0x35, 0x26, 0x17, 0x3A, 0x2D, 0x1C, 0x31, 0x22,
-    0x12, 0x34, 0x26, 0x12, 0x36, 0x29, 0x13, 0x34, 0x26, 0x12, 0x34, 0x26, 0x12, 0x34, 0x26, 0x12,
-    0x38, 0x29, 0x18, 0x34, 0x26, 0x12, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0A,
-    0x0A, 0x09, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06,
-    0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x39, 0x3E, 0x3E, 0x36, 0x43,
-    0x43, 0x3F, 0x3D, 0x3A, 0x35, 0x43, 0x43, 0x3F, 0x34, 0x35, 0x2E, 0x05, 0x06, 0x03, 0x44, 0x3F,
-    0x3B, 0x34, 0x35, 0x2E, 0x3D, 0x3A, 0x35, 0x03, 0x01, 0x02, 0x32, 0x32, 0x2D, 0x43, 0x43, 0x39,
-    0x05, 0x06, 0x03, 0x32, 0x32, 0x2D, 0x41, 0x42, 0x34, 0x3E, 0x3E, 0x36, 0x32, 0x32, 0x2D, 0x03,
-    0x01, 0x02, 0x05, 0x06, 0x03, 0x22, 0x23, 0x22, 0x3E, 0x3E, 0x36, 0x3E, 0x3E, 0x36, 0x44, 0x3F,
-    0x3B, 0x3D, 0x3A, 0x35, 0x3E, 0x3E, 0x36, 0x3E, 0x3E, 0x36, 0x3E, 0x3A, 0x2D, 0x2E, 0x26, 0x1A,
-    0x21, 0x16, 0x0F, 0x1B, 0x1A, 0x0B, 0x2E, 0x26, 0x1A, 0x2B, 0x22, 0x18, 0x30, 0x1F, 0x18, 0x2D,
-    0x2A, 0x23, 0x43, 0x43, 0x39, 0x3E, 0x3E, 0x36, 0x48, 0x48, 0x41, 0x3E, 0x3E, 0x36, 0x44, 0x3F,
-    0x3B, 0x3D, 0x3A, 0x35, 0x44, 0x3F, 0x3B, 0x32, 0x32, 0x2D, 0x27, 0x26, 0x24, 0x4B, 0x4B, 0x42,
-    0x37, 0x36, 0x34, 0x3D, 0x3A, 0x35, 0x39, 0x39, 0x3A, 0x0A, 0x0A, 0x09, 0x24, 0x2B, 0x11, 0x34,
-    0x35, 0x2E, 0x47, 0x4C, 0x39, 0x3B, 0x43, 0x2B, 0x3B, 0x3F, 0x2E, 0x1F, 0x2B, 0x04, 0x86, 0x8B,
-    0x69, 0x8D, 0x98, 0x69, 0x86, 0x8B, 0x69, 0x41, 0x38, 0x23, 0x37, 0x36, 0x34, 0x2F, 0x2E, 0x30,
-    0x39, 0x39, 0x3A, 0x43, 0x43, 0x3F, 0x3D, 0x3A, 0x35, 0x3E, 0x3E, 0x36, 0x2D, 0x2A, 0x23, 0x3E,
-    0x3A, 0x2D, 0x03, 0x01, 0x02, 0x3D, 0x36, 0x2C, 0x2E, 0x26, 0x1A, 0x1B, 0x14, 0x0A, 0x28, 0x21,
-    0x11, 0x20, 0x1D, 0x19, 0x28, 0x21, 0x11, 0x24, 0x1A, 0x11, 0x26, 0x1E, 0x12, 0x1C, 0x1A, 0x13,
-    0x26, 0x1E, 0x12, 0x1B, 0x1A, 0x0B, 0x19, 0x13, 0x0E, 0x22, 0x15, 0x09, 0x1B, 0x1A, 0x0B, 0x24,
-    0x1A, 0x11, 0x24, 0x1A, 0x11, 0x26, 0x1E, 0x12, 0x2E, 0x26, 0x1A, 0x37, 0x2C, 0x21, 0x35, 0x26,
-    0x1F, 0x2D, 0x1E, 0x10, 0x2E, 0x26, 0x1A, 0x37, 0x2A, 0x1C, 0x2B, 0x22, 0x18, 0x28, 0x21, 0x11,
-    0x31, 0x22, 0x12, 0x28, 0x21, 0x11, 0x36, 0x29, 0x13, 0x38, 0x29, 0x18, 0x36, 0x29, 0x13, 0x31,
-    0x22, 0x12, 0x0F, 0x02, 0x01, 0x37, 0x2A, 0x1C, 0x3A, 0x2D, 0x1C, 0x28, 0x21, 0x11, 0x38, 0x29,
-    0x18, 0x3A, 0x2D, 0x1C, 0x28, 0x21, 0x11, 0x34, 0x26, 0x12, 0x38, 0x29, 0x18, 0x3A, 0x2D, 0x1C,
-    0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x48, 0x48, 0x41, 0x43, 0x43, 0x39, 0x5C, 0x5C, 0x55, 0x48,
-    0x48, 0x41, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x46, 0x45, 0x47, 0x03, 0x01, 0x02, 0x57, 0x56,
-    0x54, 0x43, 0x43, 0x3F, 0x4C, 0x4B, 0x49, 0x03, 0x01, 0x02, 0x5F, 0x5E, 0x5D, 0x43, 0x43, 0x39,
-    0x03, 0x01, 0x02, 0x5C, 0x5C, 0x55, 0x44, 0x3F, 0x3B, 0x43, 0x43, 0x3F, 0x05, 0x06, 0x03, 0x48,
-    0x48, 0x41, 0x43, 0x43, 0x39, 0x48, 0x48, 0x41, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x43, 0x43,
-    0x39, 0x4B, 0x4B, 0x42, 0x44, 0x3F, 0x3B, 0x48, 0x48, 0x41, 0x4E, 0x44, 0x40, 0x2B, 0x22, 0x18,
-    0x33, 0x32, 0x23, 0x2E, 0x26, 0x1A, 0x2B, 0x22, 0x18, 0x2D, 0x2A, 0x23, 0x37, 0x2C, 0x21, 0x44,
-    0x3F, 0x3B, 0x4E, 0x44, 0x40, 0x44, 0x3F, 0x3B, 0x4E, 0x44, 0x40, 0x43, 0x43, 0x3F, 0x43, 0x43,
-    0x3F, 0x51, 0x48, 0x41, 0x43, 0x43, 0x3F, 0x23, 0x22, 0x1B, 0x20, 0x1D, 0x19, 0x44, 0x3F, 0x3B,
-    0x51, 0x48, 0x41, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x03, 0x01, 0x02, 0x46, 0x47, 0x39, 0x46,
-    0x47, 0x39, 0x43, 0x43, 0x39, 0x43, 0x43, 0x3F, 0x4B, 0x4B, 0x42, 0x46, 0x47, 0x39, 0x44, 0x4B,
-    0x28, 0x44, 0x4B, 0x28, 0x44, 0x4B, 0x28, 0x3B, 0x43, 0x2B, 0x38, 0x39, 0x35, 0x44, 0x43, 0x43,
-    0x46, 0x45, 0x47, 0x46, 0x45, 0x47, 0x44, 0x43, 0x43, 0x48, 0x48, 0x41, 0x32, 0x32, 0x2D, 0x43,
-    0x43, 0x39, 0x03, 0x01, 0x02, 0x3E, 0x3A, 0x2D, 0x28, 0x26, 0x20, 0x21, 0x16, 0x0F, 0x26, 0x1E,
-    0x12, 0x26, 0x1E, 0x12, 0x2B, 0x22, 0x18, 0x1C, 0x1A, 0x13, 0x23, 0x22, 0x1B, 0x23, 0x22, 0x1B,
-    0x20, 0x1D, 0x19, 0x1A, 0x16, 0x11, 0x1B, 0x1A, 0x0B, 0x1A, 0x16, 0x11, 0x21, 0x16, 0x0F, 0x24,
-    0x1A, 0x11, 0x26, 0x1E, 0x12, 0x2E, 0x26, 0x1A, 0x37, 0x2C, 0x21, 0x2E, 0x26, 0x1A, 0x2E, 0x26,
-    0x1A, 0x26, 0x1E, 0x12, 0x35, 0x26, 0x1F, 0x2E, 0x26, 0x1A, 0x28, 0x21, 0x11, 0x2B, 0x22, 0x18,
-    0x2E, 0x26, 0x1A, 0x37, 0x2C, 0x21, 0x2B, 0x22, 0x18, 0x37, 0x2A, 0x1C, 0x2D, 0x29, 0x1A, 0x2E,
-    0x26, 0x1A, 0x0F, 0x02, 0x01, 0x2B, 0x22, 0x18, 0x2E, 0x26, 0x1A, 0x37, 0x2A, 0x1C, 0x2E, 0x26,
-    0x1A, 0x31, 0x22, 0x12, 0x38, 0x29, 0x18, 0x37, 0x2C, 0x21, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17,
-    0x37, 0x2A, 0x1C, 0x35, 0x26, 0x1F, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02,
-    0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x43, 0x43, 0x3F, 0x44, 0x3F, 0x3B, 0x4C,
-    0x4B, 0x49, 0x3E, 0x3E, 0x36, 0x48, 0x48, 0x41, 0x43, 0x43, 0x39, 0x03, 0x01, 0x02, 0x5C, 0x5C,
-    0x55, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x03, 0x01, 0x02, 0x5C, 0x5C, 0x55, 0x43, 0x43, 0x3F,
-    0x09, 0x0A, 0x03, 0x43, 0x43, 0x39, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x05, 0x06, 0x03, 0x44,
-    0x3F, 0x3B, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x43, 0x43, 0x3F, 0x5C, 0x5C, 0x55, 0x57, 0x56,
-    0x54, 0x63, 0x62, 0x5B, 0x5B, 0x5A, 0x4C, 0x48, 0x48, 0x41, 0x5B, 0x5A, 0x4C, 0x3B, 0x3F, 0x2E,
-    0x4B, 0x4B, 0x42, 0x2E, 0x26, 0x1A, 0x28, 0x26, 0x20, 0x37, 0x2C, 0x21, 0x28, 0x26, 0x20, 0x37,
-    0x2C, 0x21, 0x2A, 0x2A, 0x29, 0x2D, 0x2A, 0x23, 0x2D, 0x2A, 0x23, 0x2D, 0x2A, 0x23, 0x2D, 0x2A,
-    0x23, 0x43, 0x43, 0x3F, 0x44, 0x3F, 0x3B, 0x23, 0x22, 0x1B, 0x23, 0x22, 0x1B, 0x4E, 0x44, 0x40,
-    0x5C, 0x5C, 0x55, 0x5C, 0x5C, 0x55, 0x32, 0x32, 0x2D, 0x09, 0x0A, 0x03, 0x23, 0x22, 0x1B, 0x43,
-    0x43, 0x3F, 0x4B, 0x4B, 0x42, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x43, 0x43, 0x3F, 0x46, 0x47,
-    0x39, 0x32, 0x32, 0x2D, 0x38, 0x39, 0x35, 0x38, 0x39, 0x35, 0x43, 0x43, 0x39, 0x22, 0x23, 0x22,
-    0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x23,
-    0x22, 0x1B, 0x03, 0x01, 0x02, 0x3E, 0x3E, 0x36, 0x26, 0x23, 0x21, 0x1A, 0x16, 0x11, 0x20, 0x1D,
-    0x19, 0x1C, 0x1A, 0x13, 0x20, 0x1D, 0x19, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x23, 0x22, 0x1B,
-    0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x1C, 0x1A, 0x13, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x09, 0x0A, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x0A, 0x0A, 0x09, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x2A, 0x2A,
-    0x29, 0x2A, 0x2A, 0x29, 0x1F, 0x1E, 0x1E, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x2F, 0x2E, 0x2B,
-    0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x23, 0x22, 0x1B, 0x2C, 0x2D, 0x24, 0x28, 0x29, 0x23, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05,
-    0x06, 0x03, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x05, 0x06, 0x03,
-    0x3E, 0x3A, 0x2D, 0x2D, 0x2A, 0x23, 0x2E, 0x26, 0x1A, 0x23, 0x22, 0x1B, 0x05, 0x06, 0x03, 0x3E,
-    0x3A, 0x2D, 0x23, 0x22, 0x1B, 0x2D, 0x2A, 0x23, 0x1F, 0x1E, 0x1E, 0x28, 0x26, 0x20, 0x23, 0x22,
-    0x1B, 0x2A, 0x2A, 0x29, 0x2D, 0x2A, 0x23, 0x23, 0x22, 0x1B, 0x2A, 0x2A, 0x29, 0x2D, 0x2A, 0x23,
-    0x28, 0x26, 0x20, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x05,
-    0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28, 0x28, 0x26, 0x20, 0x22, 0x23, 0x22,
-    0x28, 0x26, 0x20, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x23, 0x22, 0x1B, 0x2F, 0x2E, 0x2B, 0x2A,
-    0x2A, 0x29, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x28, 0x26, 0x20, 0x23, 0x22, 0x1B, 0x22, 0x23,
-    0x22, 0x2F, 0x2E, 0x2B, 0x27, 0x26, 0x24, 0x1F, 0x1E, 0x1E, 0x27, 0x26, 0x24, 0x46, 0x45, 0x47,
-    0x5C, 0x5C, 0x55, 0x65, 0x65, 0x66, 0x3D, 0x3D, 0x3B, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x09, 0x0A, 0x03, 0x03, 0x01, 0x02, 0x5C, 0x5C, 0x55, 0x63, 0x62, 0x5B,
-    0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E, 0x3F, 0x29, 0x25, 0x2E, 0x27, 0x26, 0x28, 0x27,
-    0x26, 0x28, 0x21, 0x1E, 0x26, 0x21, 0x1E, 0x26, 0x29, 0x25, 0x2E, 0x27, 0x26, 0x28, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08,
-    0x05, 0x05, 0x08, 0x08, 0x06, 0x0F, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x20, 0x1D,
-    0x19, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x2C, 0x2D, 0x24, 0x23, 0x22, 0x1B,
-    0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x2C, 0x2D, 0x24, 0x22, 0x23, 0x22, 0x23, 0x22, 0x1B, 0x05,
-    0x06, 0x03, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x34, 0x35, 0x2E,
-    0x43, 0x43, 0x3F, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x3D, 0x3D, 0x3B, 0x38, 0x39, 0x35, 0x22,
-    0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x05, 0x06, 0x03, 0x05, 0x06,
-    0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x20, 0x1D, 0x19,
-    0x63, 0x62, 0x5B, 0x38, 0x39, 0x35, 0x3E, 0x3E, 0x36, 0x44, 0x3F, 0x3B, 0x03, 0x01, 0x02, 0x63,
-    0x62, 0x61, 0x3D, 0x3A, 0x35, 0x44, 0x3F, 0x3B, 0x43, 0x43, 0x3F, 0x3D, 0x3D, 0x3B, 0x4E, 0x44,
-    0x40, 0x3E, 0x3A, 0x2D, 0x44, 0x3F, 0x3B, 0x44, 0x3F, 0x3B, 0x23, 0x22, 0x1B, 0x20, 0x1D, 0x19,
-    0x23, 0x22, 0x1B, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x38, 0x39, 0x35,
-    0x43, 0x43, 0x39, 0x2D, 0x29, 0x1A, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x1F, 0x1E, 0x1E, 0x2A,
-    0x2A, 0x29, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x27, 0x26,
-    0x24, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x39, 0x39, 0x3A, 0x63, 0x62, 0x61,
-    0x5B, 0x5A, 0x5B, 0x5B, 0x5A, 0x5B, 0x44, 0x43, 0x43, 0x3E, 0x3E, 0x3F, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x5B, 0x5A, 0x5B, 0x5F, 0x5E, 0x5D,
-    0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E, 0x3F, 0x22, 0x23, 0x22, 0x21, 0x1E, 0x26, 0x29,
-    0x25, 0x2E, 0x29, 0x25, 0x2E, 0x29, 0x25, 0x2E, 0x2F, 0x2E, 0x30, 0x29, 0x25, 0x2E, 0x27, 0x26,
-    0x28, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0A, 0x0A, 0x09, 0x28, 0x29, 0x23, 0x28, 0x29,
-    0x23, 0x38, 0x39, 0x35, 0x5C, 0x5C, 0x55, 0x5C, 0x5C, 0x55, 0x57, 0x56, 0x54, 0x63, 0x62, 0x5B,
-    0x5C, 0x5C, 0x55, 0x34, 0x35, 0x2E, 0x28, 0x29, 0x23, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x28,
-    0x26, 0x20, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x37, 0x36, 0x34,
-    0x3D, 0x3D, 0x3B, 0x48, 0x48, 0x41, 0x38, 0x39, 0x35, 0x4C, 0x4B, 0x49, 0x2F, 0x2E, 0x2B, 0x2F,
-    0x2E, 0x2B, 0x27, 0x26, 0x24, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x28, 0x29, 0x23,
-    0x9B, 0x9A, 0x95, 0x5F, 0x5E, 0x5D, 0x63, 0x62, 0x5B, 0x5C, 0x5C, 0x55, 0x03, 0x01, 0x02, 0x9B,
-    0x9A, 0x95, 0x57, 0x56, 0x54, 0x62, 0x5E, 0x55, 0x5C, 0x5C, 0x55, 0x63, 0x62, 0x5B, 0x5F, 0x5E,
-    0x5D, 0x57, 0x56, 0x54, 0x62, 0x5E, 0x55, 0x2D, 0x2A, 0x23, 0x63, 0x62, 0x5B, 0x62, 0x5E, 0x55,
-    0x4E, 0x44, 0x40, 0x26, 0x23, 0x21, 0x28, 0x29, 0x23, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x03,
-    0x01, 0x02, 0x09, 0x0A, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x27, 0x26, 0x28, 0x29, 0x25, 0x2E, 0x2A, 0x2A, 0x29, 0x32, 0x32, 0x2D, 0x43, 0x43, 0x39,
-    0x47, 0x4C, 0x39, 0x28, 0x29, 0x23, 0x2C, 0x2D, 0x24, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x22,
-    0x23, 0x22, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E,
-    0x3F, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x3E, 0x3E, 0x3F, 0x61, 0x5F, 0x64, 0x7E, 0x7E, 0x7D,
-    0x61, 0x5F, 0x64, 0x61, 0x5F, 0x64, 0x5B, 0x5A, 0x5B, 0x3E, 0x3E, 0x3F, 0x05, 0x05, 0x08, 0x05,
-    0x05, 0x08, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x0E, 0x0D, 0x0D, 0x5F, 0x5E, 0x5D, 0x5B, 0x5A, 0x5B,
-    0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x2A,
-    0x2A, 0x29, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x27, 0x26,
-    0x28, 0x2C, 0x2D, 0x24, 0x1F, 0x1E, 0x1E, 0x27, 0x26, 0x24, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x09, 0x0A, 0x03, 0x03, 0x01, 0x02, 0x1F, 0x1E, 0x1E, 0x28, 0x29, 0x23, 0x3D, 0x3D,
-    0x3B, 0x52, 0x52, 0x4C, 0x48, 0x48, 0x41, 0x4B, 0x4B, 0x42, 0x43, 0x43, 0x39, 0x43, 0x43, 0x39,
-    0x32, 0x32, 0x2D, 0x5D, 0x5E, 0x4C, 0x38, 0x39, 0x35, 0x22, 0x23, 0x22, 0x2C, 0x2D, 0x24, 0x22,
-    0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05,
-    0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x39, 0x39, 0x3A, 0x2F, 0x2E, 0x2B,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28, 0x32,
-    0x33, 0x32, 0x2F, 0x2E, 0x2B, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29,
-    0xD8, 0xD6, 0xD9, 0xD3, 0xD2, 0xD1, 0xD3, 0xD2, 0xD1, 0xDC, 0xDB, 0xD9, 0x03, 0x01, 0x02, 0xDC,
-    0xDB, 0xD9, 0x9A, 0x9A, 0x9A, 0xDC, 0xDB, 0xD9, 0xD8, 0xD6, 0xD9, 0x95, 0x93, 0x8D, 0x96, 0x95,
-    0x94, 0x9F, 0x9E, 0x9D, 0x27, 0x26, 0x24, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D,
-    0x52, 0x52, 0x4C, 0x2F, 0x2E, 0x2B, 0x28, 0x29, 0x23, 0x27, 0x26, 0x24, 0x29, 0x25, 0x2E, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x29, 0x25,
-    0x2E, 0x21, 0x1E, 0x26, 0x2F, 0x2E, 0x30, 0x39, 0x39, 0x3A, 0x3B, 0x3F, 0x2E, 0x4D, 0x4F, 0x41,
-    0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x36, 0x1F, 0x1E, 0x1E, 0x38, 0x39, 0x35, 0x38, 0x39, 0x35, 0x38,
-    0x39, 0x35, 0x39, 0x39, 0x3A, 0x5F, 0x5E, 0x5D, 0x5B, 0x5A, 0x5B, 0x5F, 0x5E, 0x5D, 0x39, 0x39,
-    0x3A, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x44, 0x43, 0x43, 0x61, 0x5F, 0x64, 0x78, 0x78, 0x78,
-    0x65, 0x65, 0x66, 0x5B, 0x5A, 0x5B, 0x63, 0x62, 0x61, 0x39, 0x39, 0x3A, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x5C, 0x5C, 0x55, 0x63, 0x62, 0x61,
-    0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x22,
-    0x23, 0x22, 0x27, 0x26, 0x28, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x2C, 0x2D, 0x24, 0x22, 0x23,
-    0x22, 0x23, 0x22, 0x1B, 0x2C, 0x2D, 0x24, 0x28, 0x26, 0x20, 0x28, 0x29, 0x23, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x1F, 0x1E, 0x1E, 0x28, 0x29, 0x23, 0x38, 0x39, 0x35, 0x43, 0x43,
-    0x3F, 0x43, 0x43, 0x39, 0x38, 0x39, 0x35, 0x33, 0x32, 0x23, 0x28, 0x29, 0x23, 0x47, 0x4C, 0x39,
-    0x46, 0x47, 0x39, 0x43, 0x43, 0x39, 0x48, 0x48, 0x41, 0x34, 0x35, 0x2E, 0x2A, 0x2A, 0x29, 0x22,
-    0x23, 0x22, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A,
-    0x2A, 0x29, 0x17, 0x18, 0x18, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x27, 0x26, 0x28,
-    0x96, 0x95, 0x94, 0x65, 0x65, 0x66, 0x61, 0x5F, 0x64, 0x63, 0x62, 0x61, 0x05, 0x05, 0x08, 0x95,
-    0x93, 0x8D, 0x5F, 0x5E, 0x5D, 0x57, 0x56, 0x54, 0x5F, 0x5E, 0x5D, 0x63, 0x62, 0x61, 0x63, 0x62,
-    0x5B, 0x28, 0x26, 0x20, 0x5C, 0x5C, 0x55, 0x5B, 0x5A, 0x5B, 0x5C, 0x5C, 0x55, 0x5F, 0x5E, 0x5D,
-    0x2F, 0x2E, 0x2B, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x1F, 0x1E, 0x1E, 0x27, 0x26, 0x28, 0x05,
-    0x05, 0x08, 0x03, 0x01, 0x02, 0x0A, 0x0A, 0x09, 0x21, 0x1E, 0x26, 0x2A, 0x2A, 0x29, 0x2A, 0x2A,
-    0x29, 0x3B, 0x36, 0x43, 0x2F, 0x2E, 0x30, 0x43, 0x43, 0x3F, 0x53, 0x53, 0x44, 0x34, 0x35, 0x2E,
-    0x34, 0x35, 0x2E, 0x4B, 0x4B, 0x42, 0x2F, 0x2E, 0x30, 0x34, 0x35, 0x2E, 0x3E, 0x3E, 0x3F, 0x43,
-    0x43, 0x3F, 0x5C, 0x5C, 0x55, 0x3E, 0x3E, 0x3F, 0x63, 0x62, 0x61, 0x5F, 0x5E, 0x5D, 0x44, 0x43,
-    0x43, 0x39, 0x39, 0x3A, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x3E, 0x3E, 0x3F, 0x65, 0x65, 0x66,
-    0x78, 0x78, 0x78, 0x61, 0x5F, 0x64, 0x61, 0x5F, 0x64, 0x3E, 0x3E, 0x3F, 0x44, 0x43, 0x43, 0x03,
-    0x01, 0x02, 0x05, 0x05, 0x08, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x0A, 0x0A, 0x09, 0x03, 0x01,
-    0x02, 0x0A, 0x0A, 0x09, 0x03, 0x01, 0x02, 0x5F, 0x5E, 0x5D, 0x65, 0x65, 0x66, 0x5F, 0x5E, 0x5D,
-    0x38, 0x39, 0x35, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x32,
-    0x32, 0x2D, 0x38, 0x39, 0x35, 0x38, 0x39, 0x35, 0x2C, 0x2D, 0x24, 0x38, 0x39, 0x35, 0x3B, 0x3F,
-    0x2E, 0x34, 0x35, 0x2E, 0x23, 0x22, 0x1B, 0x23, 0x22, 0x1B, 0x23, 0x22, 0x1B, 0x2F, 0x2E, 0x2B,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x32, 0x32, 0x2D, 0x32, 0x32, 0x2D, 0x43, 0x43, 0x3F, 0x43, 0x43,
-    0x39, 0x3E, 0x3E, 0x36, 0x43, 0x43, 0x39, 0x28, 0x26, 0x20, 0x2D, 0x29, 0x1A, 0x33, 0x32, 0x23,
-    0x3B, 0x3F, 0x2E, 0x43, 0x43, 0x39, 0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x3F, 0x2F, 0x2E, 0x30, 0x27,
-    0x26, 0x24, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x0A, 0x0A, 0x09, 0x03, 0x01, 0x02,
-    0x0A, 0x0A, 0x09, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x05, 0x05, 0x08, 0x03, 0x01,
-    0x02, 0x05, 0x05, 0x08, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22,
-    0x61, 0x5F, 0x64, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x39, 0x39, 0x3A, 0x03, 0x01, 0x02, 0x63,
-    0x62, 0x61, 0x39, 0x39, 0x3A, 0x46, 0x45, 0x47, 0x32, 0x33, 0x32, 0x43, 0x43, 0x3F, 0x3E, 0x3E,
-    0x3F, 0x27, 0x26, 0x24, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x43, 0x43, 0x3F, 0x28, 0x26, 0x20,
-    0x23, 0x22, 0x1B, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x03,
-    0x01, 0x02, 0x05, 0x05, 0x08, 0x21, 0x1E, 0x26, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x2F, 0x2E,
-    0x2B, 0x3B, 0x3F, 0x2E, 0x41, 0x42, 0x34, 0x47, 0x4C, 0x39, 0x2C, 0x2D, 0x24, 0x34, 0x35, 0x2E,
-    0x37, 0x36, 0x34, 0x48, 0x48, 0x41, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x3E, 0x3E, 0x36, 0x43,
-    0x43, 0x3F, 0x3E, 0x3E, 0x3F, 0x34, 0x35, 0x2E, 0x65, 0x65, 0x66, 0x7E, 0x7E, 0x7D, 0x3D, 0x3D,
-    0x3B, 0x3E, 0x3E, 0x3F, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x3E, 0x3E, 0x3F, 0x5B, 0x5A, 0x5B,
-    0x83, 0x83, 0x82, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x65, 0x65, 0x66, 0x5F, 0x5E, 0x5D, 0x5C, 0x5C, 0x55, 0x65, 0x65, 0x66,
-    0x44, 0x43, 0x43, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x32, 0x33, 0x32, 0x3D,
-    0x3D, 0x3B, 0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x38, 0x39, 0x35, 0x43, 0x43, 0x3F, 0x43, 0x43,
-    0x3F, 0x48, 0x48, 0x41, 0x48, 0x48, 0x41, 0x2C, 0x2D, 0x24, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x2A, 0x2A, 0x29, 0x32, 0x33, 0x32, 0x3E, 0x3E, 0x3F, 0x39, 0x39, 0x3A, 0x38, 0x39,
-    0x35, 0x3D, 0x3D, 0x3B, 0x4C, 0x4B, 0x49, 0x41, 0x42, 0x34, 0x48, 0x48, 0x41, 0x48, 0x48, 0x41,
-    0x41, 0x42, 0x34, 0x48, 0x48, 0x41, 0x3E, 0x3E, 0x36, 0x3D, 0x3D, 0x3B, 0x46, 0x45, 0x47, 0x3E,
-    0x3E, 0x3F, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x29, 0x25, 0x2E,
-    0x3E, 0x3E, 0x3F, 0x35, 0x34, 0x3A, 0x35, 0x34, 0x3A, 0x3D, 0x3D, 0x3B, 0x03, 0x01, 0x02, 0x39,
-    0x39, 0x3A, 0x2A, 0x2A, 0x29, 0x38, 0x39, 0x35, 0x37, 0x36, 0x34, 0x34, 0x35, 0x2E, 0x38, 0x39,
-    0x35, 0x28, 0x29, 0x23, 0x38, 0x39, 0x35, 0x38, 0x39, 0x35, 0x2C, 0x2D, 0x24, 0x32, 0x32, 0x2D,
-    0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x27, 0x26, 0x28, 0x28, 0x29, 0x23, 0x23,
-    0x22, 0x1B, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x37, 0x36, 0x34, 0x43, 0x43,
-    0x39, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x34, 0x35, 0x2E, 0x38, 0x39, 0x35, 0x28, 0x26, 0x20,
-    0x38, 0x39, 0x35, 0x34, 0x35, 0x2E, 0x4B, 0x4B, 0x42, 0x23, 0x22, 0x1B, 0x38, 0x39, 0x35, 0x3D,
-    0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x43, 0x43, 0x3F, 0x5B, 0x5A, 0x5B, 0x7E, 0x7E, 0x7D, 0x3E, 0x3E,
-    0x3F, 0x3E, 0x3E, 0x3F, 0x27, 0x26, 0x28, 0x2F, 0x2E, 0x30, 0x3D, 0x3D, 0x3B, 0x43, 0x43, 0x3F,
-    0x7E, 0x7E, 0x7D, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x61, 0x5F, 0x64, 0x3E, 0x3E, 0x3F, 0x03,
-    0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06,
-    0x03, 0x03, 0x01, 0x02, 0x5B, 0x5A, 0x5B, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x38, 0x39, 0x35,
-    0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x32, 0x33, 0x32, 0x39,
-    0x39, 0x3A, 0x38, 0x39, 0x35, 0x5F, 0x5E, 0x5D, 0x63, 0x62, 0x5B, 0x48, 0x48, 0x41, 0x43, 0x43,
-    0x3F, 0x43, 0x43, 0x39, 0x43, 0x43, 0x3F, 0x22, 0x23, 0x22, 0x2C, 0x2D, 0x24, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05,
-    0x05, 0x08, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x4C, 0x4B, 0x49, 0x52, 0x52, 0x4C, 0x4C, 0x4B,
-    0x49, 0x3E, 0x3E, 0x3F, 0x43, 0x43, 0x3F, 0x57, 0x56, 0x54, 0x5B, 0x5A, 0x5B, 0x52, 0x52, 0x4C,
-    0x46, 0x45, 0x47, 0x46, 0x45, 0x47, 0x37, 0x36, 0x34, 0x4C, 0x4B, 0x49, 0x37, 0x36, 0x34, 0x35,
-    0x34, 0x3A, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26,
-    0x28, 0x1F, 0x1E, 0x1E, 0x27, 0x26, 0x28, 0x2F, 0x2E, 0x30, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28,
-    0x3D, 0x3D, 0x3B, 0x35, 0x34, 0x3A, 0x37, 0x36, 0x34, 0x35, 0x34, 0x3A, 0x03, 0x01, 0x02, 0x3D,
-    0x3D, 0x3B, 0x5F, 0x5E, 0x5D, 0x38, 0x39, 0x35, 0x38, 0x39, 0x35, 0x38, 0x39, 0x35, 0x34, 0x35,
-    0x2E, 0x38, 0x39, 0x35, 0x34, 0x35, 0x2E, 0x38, 0x39, 0x35, 0x22, 0x23, 0x22, 0x38, 0x39, 0x35,
-    0x2C, 0x2D, 0x24, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x2C, 0x2D, 0x24, 0x22,
-    0x23, 0x22, 0x2A, 0x2A, 0x29, 0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E, 0x43, 0x43, 0x3F, 0x48, 0x48,
-    0x41, 0x43, 0x43, 0x39, 0x38, 0x39, 0x35, 0x34, 0x35, 0x2E, 0x32, 0x33, 0x32, 0x2A, 0x2A, 0x29,
-    0x27, 0x26, 0x24, 0x37, 0x36, 0x34, 0x46, 0x45, 0x47, 0x26, 0x23, 0x21, 0x38, 0x39, 0x35, 0x38,
-    0x39, 0x35, 0x3E, 0x3E, 0x3F, 0x35, 0x34, 0x3A, 0x65, 0x65, 0x66, 0x78, 0x78, 0x78, 0x61, 0x5F,
-    0x64, 0x3E, 0x3E, 0x3F, 0x2F, 0x2E, 0x30, 0x22, 0x23, 0x22, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E, 0x3F,
-    0x61, 0x5F, 0x64, 0x7E, 0x7E, 0x7D, 0x61, 0x5F, 0x64, 0x63, 0x62, 0x61, 0x3E, 0x3E, 0x3F, 0x39,
-    0x39, 0x3A, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x63, 0x62, 0x61, 0x5B, 0x5A, 0x5B, 0x63, 0x62, 0x61, 0x3E, 0x3E, 0x3F, 0x1F, 0x1E, 0x1E,
-    0x2F, 0x2E, 0x30, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x32, 0x33, 0x32, 0x3D, 0x3D, 0x3B, 0x3D,
-    0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x63, 0x62, 0x61, 0x5C, 0x5C, 0x55, 0x43, 0x43, 0x3F, 0x43, 0x43,
-    0x3F, 0x43, 0x43, 0x3F, 0x28, 0x29, 0x23, 0x23, 0x22, 0x1B, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x1F,
-    0x1E, 0x1E, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x35, 0x34, 0x3A, 0x4C, 0x4B, 0x49, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0A, 0x0A, 0x09, 0x32, 0x33, 0x32, 0x22,
-    0x23, 0x22, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x32, 0x32, 0x2D, 0x27, 0x26, 0x28, 0x2F, 0x2E, 0x30, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A,
-    0x2A, 0x29, 0x34, 0x35, 0x2E, 0x28, 0x26, 0x20, 0x43, 0x43, 0x39, 0x1F, 0x1E, 0x1E, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28,
-    0x39, 0x39, 0x3A, 0x37, 0x36, 0x34, 0x35, 0x34, 0x3A, 0x3D, 0x3D, 0x3B, 0x03, 0x01, 0x02, 0x39,
-    0x39, 0x3A, 0x38, 0x39, 0x35, 0x37, 0x36, 0x34, 0x17, 0x18, 0x18, 0x22, 0x23, 0x22, 0x2C, 0x2D,
-    0x24, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x32, 0x32, 0x2D, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23,
-    0x1F, 0x1E, 0x1E, 0x28, 0x29, 0x23, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x28,
-    0x26, 0x20, 0x34, 0x35, 0x2E, 0x43, 0x43, 0x3F, 0x4B, 0x4B, 0x42, 0x48, 0x48, 0x41, 0x34, 0x35,
-    0x2E, 0x3E, 0x3E, 0x36, 0x37, 0x36, 0x34, 0x32, 0x33, 0x32, 0x2F, 0x2E, 0x2B, 0x22, 0x23, 0x22,
-    0x28, 0x29, 0x23, 0x39, 0x39, 0x3A, 0x32, 0x33, 0x32, 0x26, 0x23, 0x21, 0x27, 0x26, 0x24, 0x32,
-    0x33, 0x32, 0x39, 0x39, 0x3A, 0x3E, 0x3E, 0x3F, 0x5F, 0x5E, 0x5D, 0x83, 0x83, 0x82, 0x61, 0x5F,
-    0x64, 0x39, 0x39, 0x3A, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x3E, 0x3E, 0x3F,
-    0x5B, 0x5A, 0x5B, 0x7E, 0x7E, 0x7D, 0x5F, 0x5E, 0x5D, 0x5B, 0x5A, 0x5B, 0x3D, 0x3D, 0x3B, 0x44,
-    0x43, 0x43, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x5F, 0x5E, 0x5D, 0x5B, 0x5A, 0x5B, 0x3E, 0x3E, 0x3F, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28,
-    0x1F, 0x1E, 0x1E, 0x2F, 0x2E, 0x30, 0x3E, 0x3E, 0x3F, 0x39, 0x39, 0x3A, 0x5C, 0x5C, 0x55, 0x5F,
-    0x5E, 0x5D, 0x3E, 0x3E, 0x36, 0x38, 0x39, 0x35, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x39, 0x43, 0x43,
-    0x3F, 0x48, 0x48, 0x41, 0x28, 0x29, 0x23, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A,
-    0x2A, 0x29, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x37, 0x36, 0x34, 0x4C, 0x4B, 0x49, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x39, 0x39, 0x3A, 0x3D,
-    0x3D, 0x3B, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x44, 0x43, 0x43, 0x27, 0x26, 0x28,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x43,
-    0x43, 0x3F, 0x2F, 0x2E, 0x2B, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22,
-    0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x03, 0x01, 0x02, 0x22,
-    0x23, 0x22, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x17, 0x18, 0x18, 0x23, 0x22, 0x1B, 0x22, 0x23,
-    0x22, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28,
-    0x27, 0x26, 0x24, 0x28, 0x29, 0x23, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x38,
-    0x39, 0x35, 0x3D, 0x3D, 0x3B, 0x48, 0x48, 0x41, 0x46, 0x47, 0x39, 0x34, 0x35, 0x2E, 0x38, 0x39,
-    0x35, 0x3D, 0x3A, 0x35, 0x2F, 0x2E, 0x2B, 0x2A, 0x2A, 0x29, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22,
-    0x23, 0x22, 0x1B, 0x2D, 0x2A, 0x23, 0x32, 0x32, 0x2D, 0x2F, 0x2E, 0x2B, 0x27, 0x26, 0x24, 0x39,
-    0x39, 0x3A, 0x2F, 0x2E, 0x30, 0x3E, 0x3E, 0x3F, 0x44, 0x43, 0x43, 0x78, 0x78, 0x78, 0x61, 0x5F,
-    0x64, 0x3E, 0x3E, 0x3F, 0x39, 0x39, 0x3A, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x3E, 0x3E, 0x3F,
-    0x63, 0x62, 0x61, 0x7E, 0x7E, 0x7D, 0x5F, 0x5E, 0x5D, 0x65, 0x65, 0x66, 0x39, 0x39, 0x3A, 0x38,
-    0x39, 0x35, 0x39, 0x39, 0x3A, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x63, 0x62,
-    0x61, 0x5B, 0x5A, 0x5B, 0x46, 0x45, 0x47, 0x3E, 0x3E, 0x3F, 0x22, 0x23, 0x22, 0x2F, 0x2E, 0x2B,
-    0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x39, 0x39, 0x3A, 0x63, 0x62, 0x61, 0x5F, 0x5E, 0x5D, 0x63,
-    0x62, 0x61, 0x3D, 0x3D, 0x3B, 0x43, 0x43, 0x3F, 0x3D, 0x3D, 0x3B, 0x4B, 0x4B, 0x42, 0x4B, 0x4B,
-    0x42, 0x20, 0x1D, 0x19, 0x28, 0x26, 0x20, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A,
-    0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x35, 0x34, 0x3A, 0x32, 0x33, 0x32, 0x32, 0x32, 0x2D, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x22,
-    0x23, 0x22, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x2F, 0x2E, 0x2B, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x38, 0x39, 0x35,
-    0x63, 0x62, 0x61, 0x7E, 0x7E, 0x7D, 0x97, 0x96, 0x99, 0x5F, 0x5E, 0x5D, 0x3E, 0x3E, 0x3F, 0x26,
-    0x23, 0x21, 0x20, 0x1D, 0x19, 0x28, 0x29, 0x23, 0x0E, 0x0D, 0x0D, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24,
-    0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x05, 0x05, 0x08, 0x23,
-    0x22, 0x1B, 0x27, 0x26, 0x28, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x28, 0x29,
-    0x23, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x28, 0x29, 0x23, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28,
-    0x2A, 0x2A, 0x29, 0x21, 0x1E, 0x26, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x28, 0x29, 0x23, 0x48,
-    0x48, 0x41, 0x48, 0x48, 0x41, 0x4B, 0x4B, 0x42, 0x43, 0x43, 0x3F, 0x3E, 0x3A, 0x2D, 0x32, 0x33,
-    0x32, 0x34, 0x35, 0x2E, 0x2A, 0x2A, 0x29, 0x28, 0x26, 0x20, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20,
-    0x20, 0x1D, 0x19, 0x20, 0x1D, 0x19, 0x37, 0x33, 0x32, 0x51, 0x48, 0x41, 0x22, 0x23, 0x22, 0x2F,
-    0x2E, 0x2B, 0x3E, 0x3E, 0x3F, 0x44, 0x43, 0x43, 0x5B, 0x5A, 0x5B, 0x63, 0x62, 0x61, 0x7E, 0x7E,
-    0x7D, 0x42, 0x3D, 0x45, 0x3E, 0x3E, 0x3F, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x3E, 0x3E, 0x3F,
-    0x5F, 0x5E, 0x5D, 0x5B, 0x5A, 0x5B, 0x83, 0x83, 0x82, 0x57, 0x56, 0x54, 0x63, 0x62, 0x61, 0x46,
-    0x45, 0x47, 0x44, 0x43, 0x43, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x5B, 0x5A, 0x5B, 0x5B, 0x5A,
-    0x5B, 0x63, 0x62, 0x61, 0x39, 0x39, 0x3A, 0x1F, 0x1E, 0x1E, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28,
-    0x27, 0x26, 0x28, 0x44, 0x43, 0x43, 0x63, 0x62, 0x61, 0x5F, 0x5E, 0x5D, 0x83, 0x83, 0x82, 0x5B,
-    0x5A, 0x5B, 0x3E, 0x3E, 0x36, 0x48, 0x48, 0x41, 0x3D, 0x3D, 0x3B, 0x48, 0x48, 0x41, 0x28, 0x29,
-    0x23, 0x28, 0x29, 0x23, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27,
-    0x26, 0x24, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A,
-    0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x1F, 0x1E, 0x1E, 0x05, 0x06, 0x03, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x1F, 0x1E, 0x1E, 0x2A, 0x2A, 0x29,
-    0x26, 0x23, 0x21, 0x27, 0x26, 0x24, 0x2D, 0x2A, 0x23, 0x26, 0x23, 0x21, 0x2C, 0x1F, 0x25, 0x27,
-    0x26, 0x24, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29,
-    0x32, 0x32, 0x2D, 0x38, 0x39, 0x35, 0x38, 0x39, 0x35, 0x34, 0x35, 0x2E, 0x03, 0x01, 0x02, 0x38,
-    0x39, 0x35, 0x32, 0x32, 0x2D, 0x34, 0x35, 0x2E, 0x38, 0x39, 0x35, 0x34, 0x35, 0x2E, 0x38, 0x39,
-    0x35, 0x32, 0x32, 0x2D, 0x35, 0x34, 0x3A, 0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x27, 0x26, 0x28,
-    0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x3D,
-    0x3D, 0x3B, 0x48, 0x48, 0x41, 0x41, 0x42, 0x34, 0x38, 0x39, 0x35, 0x34, 0x35, 0x2E, 0x28, 0x26,
-    0x20, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20, 0x20, 0x1D, 0x19, 0x20, 0x1D, 0x19, 0x23, 0x22, 0x1B,
-    0x28, 0x26, 0x20, 0x23, 0x22, 0x1B, 0x37, 0x36, 0x34, 0x32, 0x32, 0x2D, 0x27, 0x26, 0x24, 0x39,
-    0x39, 0x3A, 0x38, 0x39, 0x35, 0x39, 0x39, 0x3A, 0x3E, 0x3E, 0x3F, 0x5B, 0x5A, 0x5B, 0x7E, 0x7E,
-    0x7D, 0x65, 0x65, 0x66, 0x39, 0x39, 0x3A, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x3E, 0x3E, 0x3F,
-    0x39, 0x39, 0x3A, 0x65, 0x65, 0x66, 0x78, 0x78, 0x78, 0x63, 0x62, 0x61, 0x5B, 0x5A, 0x5B, 0x3E,
-    0x3E, 0x3F, 0x37, 0x36, 0x34, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x5F, 0x5E, 0x5D, 0x63, 0x62,
-    0x61, 0x39, 0x39, 0x3A, 0x27, 0x26, 0x28, 0x2F, 0x2E, 0x30, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28,
-    0x32, 0x33, 0x32, 0x3D, 0x3D, 0x3B, 0x61, 0x5F, 0x64, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x63,
-    0x62, 0x61, 0x38, 0x39, 0x35, 0x3E, 0x3E, 0x36, 0x4C, 0x4B, 0x49, 0x43, 0x43, 0x39, 0x22, 0x23,
-    0x22, 0x23, 0x22, 0x1B, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x2A,
-    0x2A, 0x29, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x37, 0x36, 0x34, 0x35,
-    0x34, 0x3A, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02, 0x05, 0x06,
-    0x03, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x1F, 0x1E, 0x1E,
-    0x28, 0x26, 0x20, 0x26, 0x23, 0x21, 0x26, 0x23, 0x21, 0x28, 0x26, 0x20, 0x2D, 0x2A, 0x23, 0x2F,
-    0x2E, 0x2B, 0x26, 0x23, 0x21, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x34, 0x35, 0x2E,
-    0x3E, 0x3E, 0x36, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x43, 0x43, 0x39, 0x03, 0x01, 0x02, 0x43,
-    0x43, 0x3F, 0x3E, 0x3E, 0x36, 0x43, 0x43, 0x39, 0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x3F, 0x3D, 0x3D,
-    0x3B, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x39, 0x39, 0x3A, 0x35, 0x34, 0x3A, 0x27, 0x26, 0x28,
-    0x29, 0x25, 0x2E, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x28,
-    0x29, 0x23, 0x48, 0x48, 0x41, 0x37, 0x36, 0x34, 0x33, 0x32, 0x23, 0x28, 0x26, 0x20, 0x28, 0x26,
-    0x20, 0x26, 0x23, 0x21, 0x23, 0x22, 0x1B, 0x20, 0x1D, 0x19, 0x20, 0x1D, 0x19, 0x28, 0x26, 0x20,
-    0x2E, 0x26, 0x1A, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x37, 0x36, 0x34, 0x3D, 0x3A, 0x35, 0x27,
-    0x26, 0x24, 0x17, 0x18, 0x18, 0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x83, 0x83,
-    0x82, 0x57, 0x56, 0x54, 0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x3F, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29,
-    0x43, 0x43, 0x3F, 0x5B, 0x5A, 0x5B, 0x83, 0x83, 0x82, 0x61, 0x5F, 0x64, 0x5F, 0x5E, 0x5D, 0x5F,
-    0x5E, 0x5D, 0x44, 0x43, 0x43, 0x3E, 0x3E, 0x3F, 0x5B, 0x5A, 0x5B, 0x63, 0x62, 0x61, 0x3E, 0x3E,
-    0x3F, 0x39, 0x39, 0x3A, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x3D, 0x3D, 0x3B,
-    0x3E, 0x3E, 0x3F, 0x5F, 0x5E, 0x5D, 0x78, 0x78, 0x78, 0x83, 0x83, 0x82, 0x65, 0x65, 0x66, 0x3D,
-    0x3D, 0x3B, 0x43, 0x43, 0x3F, 0x3D, 0x3D, 0x3B, 0x43, 0x43, 0x3F, 0x28, 0x29, 0x23, 0x28, 0x29,
-    0x23, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03,
-    0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x22,
-    0x23, 0x22, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x1F, 0x1E, 0x1E, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x27,
-    0x26, 0x24, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x1C, 0x1A, 0x13, 0x1D, 0x18, 0x18, 0x1C, 0x1A, 0x13,
-    0x1A, 0x16, 0x11, 0x1C, 0x1A, 0x13, 0x1A, 0x16, 0x11, 0x19, 0x13, 0x0E, 0x1C, 0x1A, 0x13, 0x16,
-    0x0F, 0x09, 0x1A, 0x16, 0x11, 0x19, 0x13, 0x0E, 0x20, 0x1D, 0x19, 0x1A, 0x16, 0x11, 0x1D, 0x18,
-    0x18, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x43, 0x43, 0x3F,
-    0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x43, 0x43, 0x39, 0x05, 0x06, 0x03, 0x43,
-    0x43, 0x39, 0x43, 0x43, 0x3F, 0x38, 0x39, 0x35, 0x43, 0x43, 0x39, 0x43, 0x43, 0x39, 0x38, 0x39,
-    0x35, 0x48, 0x48, 0x41, 0x39, 0x39, 0x3A, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22,
-    0x29, 0x25, 0x2E, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x27,
-    0x26, 0x24, 0x43, 0x43, 0x39, 0x46, 0x47, 0x39, 0x38, 0x39, 0x35, 0x28, 0x29, 0x23, 0x2D, 0x2A,
-    0x23, 0x28, 0x26, 0x20, 0x1F, 0x1E, 0x1E, 0x20, 0x1D, 0x19, 0x20, 0x1D, 0x19, 0x28, 0x26, 0x20,
-    0x2B, 0x22, 0x18, 0x26, 0x1E, 0x12, 0x2D, 0x2A, 0x23, 0x3D, 0x3A, 0x35, 0x32, 0x32, 0x2D, 0x17,
-    0x18, 0x18, 0x3E, 0x3E, 0x3F, 0x37, 0x36, 0x34, 0x5F, 0x5E, 0x5D, 0x3E, 0x3E, 0x3F, 0x7E, 0x7E,
-    0x7D, 0x5F, 0x5E, 0x5D, 0x46, 0x45, 0x47, 0x39, 0x39, 0x3A, 0x2F, 0x2E, 0x2B, 0x1F, 0x1E, 0x1E,
-    0x35, 0x34, 0x3A, 0x3E, 0x3E, 0x3F, 0xB5, 0xB5, 0xB5, 0x78, 0x78, 0x78, 0x5B, 0x5A, 0x5B, 0x63,
-    0x62, 0x61, 0x5B, 0x5A, 0x5B, 0x5F, 0x5E, 0x5D, 0x5B, 0x5A, 0x5B, 0x61, 0x5F, 0x64, 0x39, 0x39,
-    0x3A, 0x2F, 0x2E, 0x30, 0x1F, 0x1E, 0x1E, 0x22, 0x23, 0x22, 0x37, 0x36, 0x34, 0x3E, 0x3E, 0x3F,
-    0x5B, 0x5A, 0x5B, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x63, 0x62, 0x61, 0x2A, 0x2A, 0x29, 0x44,
-    0x43, 0x43, 0x3D, 0x3D, 0x3B, 0x43, 0x43, 0x39, 0x48, 0x48, 0x41, 0x28, 0x29, 0x23, 0x03, 0x01,
-    0x02, 0x09, 0x0A, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x27,
-    0x26, 0x28, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x32, 0x33, 0x32, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x39, 0x39, 0x3A, 0x22,
-    0x23, 0x22, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x1A, 0x16, 0x11, 0x19, 0x13, 0x0E,
-    0x1C, 0x1A, 0x13, 0x1B, 0x14, 0x0A, 0x21, 0x16, 0x0F, 0x26, 0x1E, 0x12, 0x16, 0x0F, 0x09, 0x1B,
-    0x14, 0x0A, 0x1C, 0x1A, 0x13, 0x21, 0x16, 0x0F, 0x16, 0x0F, 0x09, 0x1D, 0x18, 0x18, 0x1A, 0x16,
-    0x11, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x41, 0x42, 0x34,
-    0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x43, 0x43, 0x39, 0x03, 0x01, 0x02, 0x41,
-    0x42, 0x34, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x48, 0x48, 0x41, 0x48, 0x48, 0x41, 0x46, 0x47,
-    0x39, 0x43, 0x43, 0x3F, 0x2C, 0x2D, 0x24, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28,
-    0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x28, 0x29, 0x23, 0x27, 0x26, 0x24, 0x28,
-    0x29, 0x23, 0x28, 0x26, 0x20, 0x43, 0x43, 0x3F, 0x3E, 0x3A, 0x2D, 0x28, 0x26, 0x20, 0x28, 0x26,
-    0x20, 0x26, 0x23, 0x21, 0x27, 0x26, 0x24, 0x2B, 0x22, 0x18, 0x24, 0x1A, 0x11, 0x26, 0x1E, 0x12,
-    0x2E, 0x26, 0x1A, 0x2D, 0x2A, 0x23, 0x28, 0x26, 0x20, 0x39, 0x33, 0x2C, 0x38, 0x39, 0x35, 0x28,
-    0x26, 0x20, 0x27, 0x26, 0x24, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x63, 0x62, 0x61, 0x5B, 0x5A,
-    0x5B, 0x83, 0x83, 0x82, 0x5B, 0x5A, 0x5B, 0x3D, 0x3D, 0x3B, 0x27, 0x26, 0x28, 0x28, 0x29, 0x23,
-    0x37, 0x36, 0x34, 0x63, 0x62, 0x61, 0x7E, 0x7E, 0x7D, 0xB9, 0xB8, 0xB8, 0x7E, 0x7E, 0x7D, 0xB9,
-    0xB8, 0xB8, 0x7E, 0x7E, 0x7D, 0x65, 0x65, 0x66, 0x7E, 0x7E, 0x7D, 0x5B, 0x5A, 0x5B, 0x3E, 0x3E,
-    0x3F, 0x22, 0x23, 0x22, 0x2F, 0x2E, 0x30, 0x2F, 0x2E, 0x30, 0x44, 0x43, 0x43, 0x5F, 0x5E, 0x5D,
-    0xB5, 0xB5, 0xB5, 0x7E, 0x7E, 0x7D, 0x63, 0x62, 0x61, 0x5B, 0x5A, 0x5B, 0x44, 0x43, 0x43, 0x3D,
-    0x3D, 0x3B, 0x32, 0x33, 0x32, 0x46, 0x45, 0x47, 0x28, 0x29, 0x23, 0x28, 0x26, 0x20, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28, 0x37,
-    0x36, 0x34, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x39, 0x39, 0x3A, 0x22, 0x23, 0x22, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x27,
-    0x26, 0x28, 0x1F, 0x1E, 0x1E, 0x1F, 0x1E, 0x1E, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x1D, 0x18, 0x18, 0x1A, 0x16, 0x11, 0x19, 0x13, 0x0E, 0x1C, 0x1A, 0x13,
-    0x1B, 0x14, 0x0A, 0x16, 0x0F, 0x09, 0x22, 0x15, 0x09, 0x1B, 0x1A, 0x0B, 0x1C, 0x12, 0x04, 0x24,
-    0x1B, 0x0C, 0x1C, 0x12, 0x04, 0x1B, 0x14, 0x0A, 0x24, 0x1A, 0x11, 0x1B, 0x14, 0x0A, 0x1D, 0x18,
-    0x18, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x5D, 0x5E, 0x4C,
-    0x5D, 0x5E, 0x4C, 0x5D, 0x5E, 0x4C, 0x2C, 0x2D, 0x24, 0x43, 0x43, 0x39, 0x05, 0x06, 0x03, 0x5C,
-    0x5C, 0x55, 0x5D, 0x5E, 0x4C, 0x5C, 0x5C, 0x55, 0x5D, 0x5E, 0x4C, 0x5C, 0x5C, 0x55, 0x5C, 0x5C,
-    0x55, 0x4C, 0x4B, 0x49, 0x23, 0x22, 0x1B, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29,
-    0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x28, 0x29, 0x23, 0x27, 0x26, 0x24, 0x03,
-    0x01, 0x02, 0x28, 0x29, 0x23, 0x48, 0x48, 0x41, 0x39, 0x33, 0x2C, 0x2D, 0x2A, 0x23, 0x26, 0x23,
-    0x21, 0x35, 0x26, 0x1F, 0x26, 0x23, 0x21, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x2B, 0x22, 0x18,
-    0x2E, 0x26, 0x1A, 0x2E, 0x26, 0x1A, 0x28, 0x26, 0x20, 0x28, 0x29, 0x23, 0x37, 0x36, 0x34, 0x28,
-    0x29, 0x23, 0x27, 0x26, 0x24, 0x38, 0x39, 0x35, 0x43, 0x43, 0x3F, 0x5B, 0x5A, 0x5B, 0x63, 0x62,
-    0x61, 0x7E, 0x7E, 0x7D, 0x5F, 0x5E, 0x5D, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E, 0x3F, 0x44, 0x43, 0x43,
-    0x2F, 0x2E, 0x30, 0x61, 0x5F, 0x64, 0x7E, 0x7E, 0x7D, 0x5F, 0x5E, 0x5D, 0x63, 0x62, 0x61, 0x5F,
-    0x5E, 0x5D, 0x61, 0x5F, 0x64, 0x5B, 0x5A, 0x5B, 0x7E, 0x7E, 0x7D, 0x63, 0x62, 0x61, 0x3E, 0x3E,
-    0x3F, 0x2A, 0x2A, 0x29, 0x37, 0x36, 0x34, 0x3D, 0x3D, 0x3B, 0x5F, 0x5E, 0x5D, 0x7E, 0x7E, 0x7D,
-    0x7E, 0x7E, 0x7D, 0x5F, 0x5E, 0x5D, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x37,
-    0x36, 0x34, 0x43, 0x43, 0x3F, 0x4C, 0x4B, 0x49, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x37, 0x36, 0x34, 0x37,
-    0x36, 0x34, 0x32, 0x33, 0x32, 0x22, 0x23, 0x22, 0x39, 0x39, 0x3A, 0x2A, 0x2A, 0x29, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x1F, 0x1E, 0x1E, 0x2A,
-    0x2A, 0x29, 0x39, 0x39, 0x3A, 0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0x32, 0x33, 0x32, 0x05, 0x06,
-    0x03, 0x03, 0x01, 0x02, 0x1A, 0x16, 0x11, 0x19, 0x13, 0x0E, 0x21, 0x16, 0x0F, 0x21, 0x16, 0x0F,
-    0x21, 0x16, 0x0F, 0x26, 0x1E, 0x12, 0x24, 0x1B, 0x0C, 0x22, 0x13, 0x04, 0x1C, 0x12, 0x04, 0x1B,
-    0x1A, 0x0B, 0x22, 0x13, 0x04, 0x22, 0x15, 0x09, 0x1B, 0x1A, 0x0B, 0x21, 0x16, 0x0F, 0x21, 0x16,
-    0x0F, 0x16, 0x0F, 0x09, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x6C, 0x6E, 0x60,
-    0x6C, 0x6E, 0x60, 0x6C, 0x6E, 0x60, 0x3B, 0x43, 0x2B, 0x62, 0x62, 0x52, 0x03, 0x01, 0x02, 0x6C,
-    0x6E, 0x60, 0x6C, 0x6E, 0x60, 0x5B, 0x5A, 0x4C, 0x6C, 0x6E, 0x60, 0x5C, 0x5C, 0x55, 0x41, 0x42,
-    0x34, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23, 0x2C, 0x2D, 0x24, 0x28, 0x29, 0x23, 0x1F, 0x1E, 0x1E,
-    0x2F, 0x2E, 0x2B, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x03,
-    0x01, 0x02, 0x28, 0x26, 0x20, 0x44, 0x3F, 0x3B, 0x3D, 0x3A, 0x35, 0x28, 0x26, 0x20, 0x28, 0x26,
-    0x20, 0x27, 0x26, 0x24, 0x35, 0x26, 0x1F, 0x35, 0x26, 0x1F, 0x35, 0x26, 0x1F, 0x28, 0x29, 0x23,
-    0x2E, 0x26, 0x1A, 0x2E, 0x26, 0x1A, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x38, 0x39, 0x35, 0x3D,
-    0x3A, 0x35, 0x2A, 0x2A, 0x29, 0x34, 0x35, 0x2E, 0x39, 0x39, 0x3A, 0x46, 0x45, 0x47, 0x3D, 0x3D,
-    0x3B, 0x5B, 0x5A, 0x5B, 0x61, 0x5F, 0x64, 0x63, 0x62, 0x61, 0x39, 0x39, 0x3A, 0x3E, 0x3E, 0x3F,
-    0x5F, 0x5E, 0x5D, 0xB5, 0xB5, 0xB5, 0x5F, 0x5E, 0x5D, 0x39, 0x39, 0x3A, 0x44, 0x43, 0x43, 0x32,
-    0x33, 0x32, 0x3E, 0x3E, 0x3F, 0x65, 0x65, 0x66, 0x96, 0x95, 0x94, 0x5F, 0x5E, 0x5D, 0x39, 0x39,
-    0x3A, 0x2F, 0x2E, 0x30, 0x3D, 0x3D, 0x3B, 0x5F, 0x5E, 0x5D, 0xB5, 0xB5, 0xB5, 0x83, 0x83, 0x82,
-    0x61, 0x5F, 0x64, 0x3E, 0x3E, 0x3F, 0x5B, 0x5A, 0x5B, 0x43, 0x43, 0x3F, 0x35, 0x34, 0x3A, 0x37,
-    0x36, 0x34, 0x3E, 0x3E, 0x3F, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24, 0x3E, 0x3E, 0x3F, 0x32,
-    0x33, 0x32, 0x5F, 0x5E, 0x5D, 0x38, 0x39, 0x35, 0x39, 0x39, 0x3A, 0x22, 0x23, 0x22, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03,
-    0x03, 0x01, 0x02, 0x09, 0x0A, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2F, 0x2E, 0x2B, 0x32,
-    0x33, 0x32, 0x5F, 0x5E, 0x5D, 0x32, 0x33, 0x32, 0x32, 0x32, 0x2D, 0x2A, 0x2A, 0x29, 0x20, 0x1D,
-    0x19, 0x16, 0x0F, 0x09, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x37, 0x2C, 0x21, 0x2E, 0x26, 0x1A,
-    0x2B, 0x22, 0x18, 0x35, 0x26, 0x1F, 0x28, 0x21, 0x11, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x36,
-    0x29, 0x13, 0x38, 0x29, 0x18, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x2E, 0x26, 0x1A, 0x2B, 0x22,
-    0x18, 0x37, 0x2C, 0x21, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x5D, 0x5E, 0x4C,
-    0x5D, 0x5E, 0x4C, 0x57, 0x57, 0x4C, 0x5C, 0x5C, 0x55, 0x5D, 0x5E, 0x4C, 0x03, 0x01, 0x02, 0x5B,
-    0x5A, 0x4C, 0x62, 0x62, 0x52, 0x5C, 0x5C, 0x55, 0x5D, 0x5E, 0x4C, 0x46, 0x47, 0x39, 0x2C, 0x2D,
-    0x24, 0x2C, 0x2D, 0x24, 0x28, 0x29, 0x23, 0x23, 0x22, 0x1B, 0x5F, 0x5E, 0x5D, 0x27, 0x26, 0x28,
-    0x22, 0x23, 0x22, 0x32, 0x33, 0x32, 0x2F, 0x2E, 0x2B, 0x5B, 0x5A, 0x5B, 0x27, 0x26, 0x24, 0x03,
-    0x01, 0x02, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x48, 0x48, 0x41, 0x37, 0x36, 0x34, 0x26, 0x23,
-    0x21, 0x2D, 0x2A, 0x23, 0x27, 0x26, 0x24, 0x26, 0x23, 0x21, 0x28, 0x26, 0x20, 0x2E, 0x26, 0x1A,
-    0x2E, 0x26, 0x1A, 0x26, 0x1E, 0x12, 0x2D, 0x29, 0x1A, 0x28, 0x26, 0x20, 0x38, 0x39, 0x35, 0x4B,
-    0x4B, 0x42, 0x28, 0x26, 0x20, 0x2A, 0x2A, 0x29, 0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0x48, 0x48,
-    0x41, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x5F, 0x5E, 0x5D, 0x3E, 0x3E, 0x3F, 0x5B, 0x5A, 0x5B,
-    0xBD, 0xBB, 0xBA, 0x5F, 0x5E, 0x5D, 0x44, 0x43, 0x43, 0x3E, 0x3E, 0x3F, 0x3D, 0x3D, 0x3B, 0x3E,
-    0x3E, 0x3F, 0x46, 0x45, 0x47, 0x57, 0x56, 0x54, 0xBD, 0xBB, 0xBA, 0x5F, 0x5E, 0x5D, 0x3E, 0x3E,
-    0x3F, 0x3D, 0x3D, 0x3B, 0x61, 0x5F, 0x64, 0xB9, 0xB8, 0xB8, 0x7E, 0x7E, 0x7D, 0x61, 0x5F, 0x64,
-    0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x2F, 0x2E, 0x30, 0x46,
-    0x45, 0x47, 0x2F, 0x2E, 0x2B, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2F, 0x2E, 0x30, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x3E,
-    0x3E, 0x3F, 0x27, 0x26, 0x28, 0x1F, 0x1E, 0x1E, 0x63, 0x62, 0x61, 0x23, 0x22, 0x1B, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24, 0x2A,
-    0x2A, 0x29, 0x38, 0x39, 0x35, 0x05, 0x05, 0x08, 0x38, 0x39, 0x35, 0x22, 0x23, 0x22, 0x22, 0x23,
-    0x22, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x15, 0x09, 0x21, 0x16, 0x0F, 0x1C, 0x12, 0x04,
-    0x22, 0x15, 0x09, 0x24, 0x1B, 0x0C, 0x22, 0x13, 0x04, 0x37, 0x2A, 0x1C, 0x35, 0x26, 0x17, 0x31,
-    0x22, 0x12, 0x31, 0x22, 0x12, 0x34, 0x26, 0x12, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x37, 0x2A,
-    0x1C, 0x37, 0x2A, 0x1C, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x3E, 0x3A, 0x2D,
-    0x3E, 0x3E, 0x36, 0x46, 0x47, 0x39, 0x43, 0x43, 0x39, 0x41, 0x42, 0x34, 0x05, 0x06, 0x03, 0x41,
-    0x42, 0x34, 0x38, 0x39, 0x35, 0x3B, 0x3F, 0x2E, 0x3B, 0x3F, 0x2E, 0x38, 0x39, 0x35, 0x2C, 0x2D,
-    0x24, 0x38, 0x39, 0x35, 0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E, 0x5F, 0x5E, 0x5D, 0x09, 0x0A, 0x03,
-    0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x37, 0x36, 0x34, 0x3E, 0x3E, 0x3F, 0x2C, 0x2D, 0x24, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x20, 0x1D, 0x19, 0x48, 0x48, 0x41, 0x32, 0x32, 0x2D, 0x2D, 0x2A,
-    0x23, 0x27, 0x26, 0x24, 0x30, 0x1F, 0x18, 0x20, 0x1D, 0x19, 0x20, 0x1D, 0x19, 0x2B, 0x22, 0x18,
-    0x28, 0x21, 0x11, 0x20, 0x1D, 0x19, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x32, 0x32, 0x2D, 0x43,
-    0x43, 0x39, 0x22, 0x23, 0x22, 0x23, 0x22, 0x1B, 0x37, 0x36, 0x34, 0x3E, 0x3E, 0x3F, 0x3D, 0x3D,
-    0x3B, 0x5B, 0x5A, 0x5B, 0x83, 0x83, 0x82, 0x5F, 0x5E, 0x5D, 0x63, 0x62, 0x61, 0x78, 0x78, 0x78,
-    0x63, 0x62, 0x61, 0x39, 0x39, 0x3A, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E, 0x3F, 0x39, 0x39, 0x3A, 0x44,
-    0x43, 0x43, 0x39, 0x39, 0x3A, 0x5F, 0x5E, 0x5D, 0x9F, 0x9E, 0x9D, 0x5B, 0x5A, 0x5B, 0x39, 0x39,
-    0x3A, 0x63, 0x62, 0x61, 0xB5, 0xB5, 0xB5, 0x7E, 0x7E, 0x7D, 0x5B, 0x5A, 0x5B, 0x63, 0x62, 0x61,
-    0x39, 0x39, 0x3A, 0x44, 0x43, 0x43, 0x61, 0x5F, 0x64, 0x63, 0x62, 0x61, 0x63, 0x62, 0x61, 0x1F,
-    0x1E, 0x1E, 0x1F, 0x1E, 0x1E, 0x27, 0x26, 0x24, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x35,
-    0x34, 0x3A, 0x37, 0x36, 0x34, 0x63, 0x62, 0x61, 0x96, 0x95, 0x94, 0x27, 0x26, 0x28, 0x44, 0x43,
-    0x43, 0x5C, 0x5C, 0x55, 0x22, 0x23, 0x22, 0x1C, 0x1A, 0x13, 0x23, 0x22, 0x1B, 0x20, 0x1D, 0x19,
-    0x32, 0x32, 0x2D, 0x37, 0x36, 0x34, 0x32, 0x33, 0x32, 0x63, 0x62, 0x61, 0x20, 0x1D, 0x19, 0x17,
-    0x18, 0x18, 0x35, 0x34, 0x3A, 0x37, 0x36, 0x34, 0x5F, 0x5E, 0x5D, 0x37, 0x36, 0x34, 0x2C, 0x2D,
-    0x24, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x33, 0x32, 0x23, 0x35, 0x26, 0x1F, 0x2E, 0x26, 0x1A,
-    0x2E, 0x26, 0x1A, 0x35, 0x26, 0x17, 0x47, 0x2F, 0x20, 0x4B, 0x3D, 0x2C, 0x37, 0x2A, 0x1C, 0x38,
-    0x29, 0x18, 0x3C, 0x25, 0x10, 0x34, 0x26, 0x12, 0x37, 0x2A, 0x1C, 0x35, 0x26, 0x17, 0x2E, 0x26,
-    0x1A, 0x2E, 0x26, 0x1A, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x28, 0x29, 0x23,
-    0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E, 0x32, 0x32, 0x2D, 0x03, 0x01, 0x02, 0x34,
-    0x35, 0x2E, 0x38, 0x39, 0x35, 0x3B, 0x3F, 0x2E, 0x38, 0x39, 0x35, 0x32, 0x32, 0x2D, 0x3E, 0x3E,
-    0x36, 0x34, 0x35, 0x2E, 0x38, 0x39, 0x35, 0x38, 0x39, 0x35, 0x3E, 0x3E, 0x3F, 0x03, 0x01, 0x02,
-    0x3E, 0x3E, 0x3F, 0x35, 0x34, 0x3A, 0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0x22, 0x23, 0x22, 0x09,
-    0x0A, 0x03, 0x03, 0x01, 0x02, 0x28, 0x29, 0x23, 0x4B, 0x4B, 0x42, 0x37, 0x36, 0x34, 0x37, 0x33,
-    0x32, 0x27, 0x26, 0x24, 0x1F, 0x1E, 0x1E, 0x23, 0x22, 0x1B, 0x20, 0x1D, 0x19, 0x20, 0x1D, 0x19,
-    0x26, 0x1E, 0x12, 0x26, 0x1E, 0x12, 0x2E, 0x26, 0x1A, 0x28, 0x26, 0x20, 0x28, 0x29, 0x23, 0x37,
-    0x36, 0x34, 0x32, 0x32, 0x2D, 0x23, 0x22, 0x1B, 0x37, 0x36, 0x34, 0x43, 0x43, 0x3F, 0x3E, 0x3E,
-    0x3F, 0x63, 0x62, 0x61, 0xBD, 0xBB, 0xBA, 0xB3, 0xB2, 0xB1, 0x78, 0x78, 0x78, 0x6A, 0x6A, 0x69,
-    0x5B, 0x5A, 0x5B, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x4C, 0x4B, 0x49, 0x32,
-    0x33, 0x32, 0x3E, 0x3E, 0x3F, 0x5F, 0x5E, 0x5D, 0x90, 0x8F, 0x8E, 0x63, 0x62, 0x61, 0x63, 0x62,
-    0x61, 0xB5, 0xB5, 0xB5, 0x7E, 0x7E, 0x7D, 0x65, 0x65, 0x66, 0x5B, 0x5A, 0x5B, 0x83, 0x83, 0x82,
-    0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x5B, 0x5A, 0x5B, 0x3E, 0x3E, 0x3F, 0x2F, 0x2E, 0x30, 0x2F,
-    0x2E, 0x30, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x1F, 0x1E, 0x1E, 0x2F, 0x2E, 0x30, 0x2F,
-    0x2E, 0x30, 0x27, 0x26, 0x24, 0x37, 0x36, 0x34, 0x57, 0x56, 0x54, 0x38, 0x39, 0x35, 0x4C, 0x4B,
-    0x49, 0x32, 0x33, 0x32, 0x3D, 0x3D, 0x3B, 0x22, 0x23, 0x22, 0x20, 0x1D, 0x19, 0x38, 0x39, 0x35,
-    0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x37, 0x36, 0x34, 0x32, 0x32, 0x2D, 0x27, 0x26, 0x28, 0x32,
-    0x33, 0x32, 0x22, 0x23, 0x22, 0x17, 0x18, 0x18, 0x39, 0x39, 0x3A, 0x38, 0x39, 0x35, 0x1F, 0x1E,
-    0x1E, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x3D, 0x36, 0x2C, 0x3D, 0x36, 0x2C, 0x49, 0x38, 0x29,
-    0x49, 0x38, 0x29, 0x41, 0x38, 0x23, 0x47, 0x2F, 0x20, 0x47, 0x2F, 0x20, 0x2D, 0x1E, 0x10, 0x38,
-    0x29, 0x18, 0x35, 0x26, 0x17, 0x3C, 0x25, 0x10, 0x31, 0x22, 0x12, 0x34, 0x26, 0x12, 0x35, 0x26,
-    0x17, 0x37, 0x2C, 0x21, 0x20, 0x1D, 0x19, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x22, 0x23, 0x22,
-    0x28, 0x29, 0x23, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x39,
-    0x39, 0x3A, 0x32, 0x32, 0x2D, 0x34, 0x35, 0x2E, 0x32, 0x32, 0x2D, 0x38, 0x39, 0x35, 0x38, 0x39,
-    0x35, 0x32, 0x33, 0x32, 0x38, 0x39, 0x35, 0x32, 0x33, 0x32, 0x3E, 0x3E, 0x3F, 0x05, 0x05, 0x08,
-    0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x35, 0x34, 0x3A, 0x38, 0x39, 0x35, 0x2A, 0x2A, 0x29, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x28, 0x26, 0x20, 0x1F, 0x1E, 0x1E, 0x43, 0x43, 0x3F, 0x37, 0x36,
-    0x34, 0x27, 0x26, 0x28, 0x26, 0x23, 0x21, 0x26, 0x23, 0x21, 0x26, 0x23, 0x21, 0x30, 0x1F, 0x18,
-    0x20, 0x1D, 0x19, 0x23, 0x22, 0x1B, 0x2E, 0x26, 0x1A, 0x28, 0x29, 0x23, 0x28, 0x26, 0x20, 0x3E,
-    0x3A, 0x2D, 0x3D, 0x3A, 0x35, 0x28, 0x29, 0x23, 0x2A, 0x2A, 0x29, 0x2F, 0x2E, 0x2B, 0x3E, 0x3E,
-    0x3F, 0x63, 0x62, 0x61, 0x5B, 0x5A, 0x5B, 0xB5, 0xB5, 0xB5, 0x9F, 0x9E, 0x9D, 0x57, 0x56, 0x54,
-    0x5F, 0x5E, 0x5D, 0x46, 0x45, 0x47, 0x3D, 0x3D, 0x3B, 0x39, 0x39, 0x3A, 0x3E, 0x3E, 0x3F, 0x44,
-    0x43, 0x43, 0x61, 0x5F, 0x64, 0x63, 0x62, 0x61, 0x7E, 0x7E, 0x7D, 0x5B, 0x5A, 0x5B, 0xB3, 0xB2,
-    0xB1, 0x7E, 0x7E, 0x7D, 0x61, 0x5F, 0x64, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x5B, 0x5A, 0x5B,
-    0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x44, 0x43, 0x43, 0x2F, 0x2E, 0x30, 0x2A, 0x2A, 0x29, 0x22,
-    0x23, 0x22, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x32, 0x33, 0x32, 0x2A,
-    0x2A, 0x29, 0x27, 0x26, 0x24, 0x32, 0x32, 0x2D, 0x39, 0x39, 0x3A, 0x37, 0x36, 0x34, 0x03, 0x01,
-    0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02,
-    0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x38, 0x39, 0x35, 0x27,
-    0x26, 0x24, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x23, 0x22, 0x1B, 0x37, 0x36,
-    0x34, 0x28, 0x26, 0x20, 0x0F, 0x02, 0x01, 0x16, 0x0F, 0x09, 0x24, 0x1B, 0x0C, 0x22, 0x13, 0x04,
-    0x2C, 0x1A, 0x09, 0x22, 0x15, 0x09, 0x22, 0x15, 0x09, 0x2B, 0x15, 0x13, 0x3C, 0x25, 0x10, 0x31,
-    0x22, 0x12, 0x38, 0x29, 0x18, 0x3E, 0x2A, 0x12, 0x34, 0x26, 0x12, 0x35, 0x26, 0x17, 0x2B, 0x22,
-    0x18, 0x35, 0x26, 0x1F, 0x2D, 0x2A, 0x23, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24,
-    0x29, 0x25, 0x2E, 0x22, 0x23, 0x22, 0x29, 0x25, 0x2E, 0x1F, 0x1E, 0x1E, 0x2A, 0x2A, 0x29, 0x27,
-    0x26, 0x28, 0x27, 0x26, 0x28, 0x2F, 0x2E, 0x30, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x27, 0x26,
-    0x28, 0x2F, 0x2E, 0x2B, 0x3D, 0x3D, 0x3B, 0x39, 0x39, 0x3A, 0x35, 0x34, 0x3A, 0x05, 0x05, 0x08,
-    0x35, 0x34, 0x3A, 0x35, 0x34, 0x3A, 0x37, 0x36, 0x34, 0x32, 0x33, 0x32, 0x2A, 0x2A, 0x29, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x43, 0x43, 0x3F, 0x35, 0x34,
-    0x3A, 0x2A, 0x2A, 0x29, 0x26, 0x23, 0x21, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x23, 0x22, 0x1B,
-    0x23, 0x22, 0x1B, 0x2B, 0x22, 0x18, 0x28, 0x29, 0x23, 0x2D, 0x29, 0x1A, 0x28, 0x29, 0x23, 0x3D,
-    0x3A, 0x35, 0x34, 0x35, 0x2E, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x27, 0x26,
-    0x24, 0x39, 0x39, 0x3A, 0x61, 0x5F, 0x64, 0x5B, 0x5A, 0x5B, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D,
-    0x7E, 0x7E, 0x7D, 0x78, 0x78, 0x78, 0x83, 0x83, 0x82, 0x78, 0x78, 0x78, 0x7E, 0x7E, 0x7D, 0x7E,
-    0x7E, 0x7D, 0x5B, 0x5A, 0x5B, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0xBD, 0xBB, 0xBA, 0x65, 0x65,
-    0x66, 0x5B, 0x5A, 0x5B, 0x95, 0x93, 0x8D, 0x97, 0x96, 0x99, 0x61, 0x5F, 0x64, 0x3E, 0x3E, 0x3F,
-    0x3E, 0x3E, 0x3F, 0x3D, 0x3D, 0x3B, 0x2F, 0x2E, 0x30, 0x39, 0x39, 0x3A, 0x2A, 0x2A, 0x29, 0x1F,
-    0x1E, 0x1E, 0x2F, 0x2E, 0x30, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x39, 0x39, 0x3A, 0x22, 0x23, 0x22, 0x22,
-    0x23, 0x22, 0x2A, 0x2A, 0x29, 0x32, 0x33, 0x32, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x05, 0x06,
-    0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22, 0x22,
-    0x23, 0x22, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x27, 0x26, 0x28, 0x28, 0x26,
-    0x20, 0x28, 0x26, 0x20, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x2E, 0x26, 0x1A, 0x35, 0x26, 0x17,
-    0x38, 0x29, 0x18, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x30, 0x1F, 0x18, 0x5B, 0x4D, 0x3F, 0x38,
-    0x29, 0x18, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x3C, 0x25, 0x10, 0x35, 0x26, 0x17, 0x38, 0x29,
-    0x18, 0x31, 0x22, 0x12, 0x37, 0x2C, 0x21, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28,
-    0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x22,
-    0x23, 0x22, 0x27, 0x26, 0x28, 0x1F, 0x1E, 0x1E, 0x2F, 0x2E, 0x30, 0x22, 0x23, 0x22, 0x22, 0x23,
-    0x22, 0x2F, 0x2E, 0x30, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x29, 0x25, 0x2E, 0x03, 0x01, 0x02,
-    0x35, 0x34, 0x3A, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x23, 0x22, 0x1B, 0x03,
-    0x01, 0x02, 0x09, 0x0A, 0x03, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x43, 0x43, 0x3F, 0x37, 0x36,
-    0x34, 0x32, 0x32, 0x2D, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20, 0x35, 0x26, 0x1F,
-    0x27, 0x26, 0x24, 0x35, 0x26, 0x1F, 0x23, 0x22, 0x1B, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x37,
-    0x36, 0x34, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x28, 0x26, 0x20, 0x3E, 0x3E, 0x36, 0x96, 0x95,
-    0x94, 0x43, 0x43, 0x3F, 0x3D, 0x3D, 0x3B, 0x5F, 0x5E, 0x5D, 0x61, 0x5F, 0x64, 0x61, 0x5F, 0x64,
-    0x61, 0x5F, 0x64, 0x61, 0x5F, 0x64, 0x5F, 0x5E, 0x5D, 0x5B, 0x5A, 0x5B, 0x63, 0x62, 0x61, 0x5F,
-    0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x57, 0x56,
-    0x54, 0x46, 0x45, 0x47, 0x63, 0x62, 0x61, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x3E, 0x3E, 0x3F,
-    0x3D, 0x3D, 0x3B, 0x2A, 0x2A, 0x29, 0x39, 0x39, 0x3A, 0x5B, 0x5A, 0x5B, 0x22, 0x23, 0x22, 0x2A,
-    0x2A, 0x29, 0x1F, 0x1E, 0x1E, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x22,
-    0x23, 0x22, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x37, 0x36, 0x34, 0x2A,
-    0x2A, 0x29, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x22, 0x23,
-    0x22, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x4A, 0x3D, 0x34, 0x3E, 0x3A, 0x2D, 0x47, 0x2F, 0x20,
-    0x4F, 0x3A, 0x23, 0x42, 0x33, 0x22, 0x4D, 0x36, 0x21, 0x4D, 0x36, 0x21, 0x38, 0x29, 0x18, 0x31,
-    0x22, 0x12, 0x34, 0x26, 0x12, 0x38, 0x29, 0x18, 0x34, 0x26, 0x12, 0x35, 0x26, 0x17, 0x34, 0x26,
-    0x12, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x22, 0x23, 0x22,
-    0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x27,
-    0x26, 0x28, 0x22, 0x23, 0x22, 0x2F, 0x2E, 0x2B, 0x1F, 0x1E, 0x1E, 0x39, 0x39, 0x3A, 0x2A, 0x2A,
-    0x29, 0x1F, 0x1E, 0x1E, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02,
-    0x27, 0x26, 0x28, 0x29, 0x25, 0x2E, 0x27, 0x26, 0x28, 0x35, 0x34, 0x3A, 0x27, 0x26, 0x24, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20, 0x48, 0x48,
-    0x41, 0x32, 0x32, 0x2D, 0x2D, 0x2A, 0x23, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20, 0x1F, 0x1E, 0x1E,
-    0x2D, 0x2A, 0x23, 0x26, 0x23, 0x21, 0x2E, 0x26, 0x1A, 0x28, 0x26, 0x20, 0x2E, 0x26, 0x1A, 0x3E,
-    0x3A, 0x2D, 0x3D, 0x3A, 0x35, 0x20, 0x1D, 0x19, 0x20, 0x1D, 0x19, 0x3E, 0x3E, 0x36, 0x9B, 0x9A,
-    0x95, 0x57, 0x56, 0x54, 0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x3F, 0x42, 0x3D, 0x45, 0x61, 0x5F, 0x64,
-    0x5B, 0x5A, 0x5B, 0x61, 0x5F, 0x64, 0x39, 0x39, 0x3A, 0x43, 0x43, 0x3F, 0x63, 0x62, 0x61, 0x5B,
-    0x5A, 0x5B, 0x44, 0x43, 0x43, 0x3D, 0x3D, 0x3B, 0x5B, 0x5A, 0x5B, 0x61, 0x5F, 0x64, 0x3E, 0x3E,
-    0x3F, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x2A, 0x2A, 0x29, 0xD3, 0xD2, 0xD1, 0x5F, 0x5E, 0x5D,
-    0x61, 0x5F, 0x64, 0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x61, 0x5F, 0x64, 0x5F, 0x5E, 0x5D, 0x27,
-    0x26, 0x28, 0x29, 0x25, 0x2E, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02,
-    0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x1F, 0x1E, 0x1E, 0x32, 0x33, 0x32, 0x22,
-    0x23, 0x22, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x35, 0x34, 0x3A, 0x37, 0x36, 0x34, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24, 0x27,
-    0x26, 0x24, 0x27, 0x26, 0x28, 0x2F, 0x2E, 0x2B, 0x32, 0x33, 0x32, 0x2F, 0x2E, 0x2B, 0x2A, 0x2A,
-    0x29, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x1C, 0x0E, 0x02, 0x2C, 0x1A, 0x09,
-    0x22, 0x13, 0x04, 0x2C, 0x1A, 0x09, 0x22, 0x13, 0x04, 0x22, 0x13, 0x04, 0x22, 0x13, 0x04, 0x47,
-    0x2F, 0x20, 0x28, 0x21, 0x11, 0x38, 0x29, 0x18, 0x31, 0x22, 0x12, 0x36, 0x29, 0x13, 0x35, 0x26,
-    0x17, 0x3C, 0x25, 0x10, 0x38, 0x29, 0x18, 0x24, 0x1A, 0x11, 0x0F, 0x02, 0x01, 0x28, 0x26, 0x20,
-    0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x27,
-    0x26, 0x28, 0x38, 0x39, 0x35, 0x32, 0x33, 0x32, 0x37, 0x36, 0x34, 0x32, 0x32, 0x2D, 0x37, 0x36,
-    0x34, 0x38, 0x39, 0x35, 0x37, 0x36, 0x34, 0x32, 0x33, 0x32, 0x35, 0x34, 0x3A, 0x03, 0x01, 0x02,
-    0x3D, 0x3D, 0x3B, 0x32, 0x33, 0x32, 0x32, 0x33, 0x32, 0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x23, 0x22, 0x1B, 0x48, 0x48,
-    0x41, 0x33, 0x32, 0x23, 0x33, 0x32, 0x23, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x2A, 0x2A, 0x29,
-    0x27, 0x26, 0x28, 0x2C, 0x1F, 0x25, 0x2D, 0x2A, 0x23, 0x26, 0x1E, 0x12, 0x23, 0x22, 0x1B, 0x2D,
-    0x2A, 0x23, 0x33, 0x32, 0x23, 0x4E, 0x44, 0x40, 0x23, 0x22, 0x1B, 0x26, 0x1E, 0x12, 0x5C, 0x5C,
-    0x55, 0x63, 0x62, 0x61, 0x43, 0x43, 0x3F, 0x37, 0x36, 0x34, 0x44, 0x43, 0x43, 0x39, 0x39, 0x3A,
-    0x42, 0x3D, 0x45, 0x42, 0x3D, 0x45, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x36, 0x37, 0x36, 0x34, 0x5F,
-    0x5E, 0x5D, 0x96, 0x95, 0x94, 0xE0, 0xDF, 0xDE, 0x97, 0x96, 0x99, 0x3E, 0x3E, 0x3F, 0x39, 0x39,
-    0x3A, 0x42, 0x3D, 0x45, 0x32, 0x33, 0x32, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x9A, 0x9A, 0x9A,
-    0x5C, 0x5C, 0x55, 0x43, 0x43, 0x3F, 0x3D, 0x3D, 0x3B, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E, 0x5D, 0x2F,
-    0x2E, 0x30, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x22, 0x23,
-    0x22, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x28, 0x29, 0x23, 0x1F, 0x1E, 0x1E, 0x2F,
-    0x2E, 0x2B, 0x22, 0x23, 0x22, 0x2F, 0x2E, 0x2B, 0x38, 0x39, 0x35, 0x96, 0x95, 0x94, 0x05, 0x06,
-    0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x38,
-    0x39, 0x35, 0x38, 0x39, 0x35, 0x32, 0x32, 0x2D, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x27, 0x26,
-    0x24, 0x27, 0x26, 0x24, 0x26, 0x23, 0x21, 0x03, 0x01, 0x02, 0x37, 0x2C, 0x21, 0x35, 0x26, 0x17,
-    0x31, 0x22, 0x12, 0x3C, 0x25, 0x10, 0x38, 0x29, 0x18, 0x34, 0x26, 0x12, 0x35, 0x26, 0x17, 0x54,
-    0x44, 0x36, 0x35, 0x26, 0x17, 0x37, 0x2A, 0x1C, 0x31, 0x22, 0x12, 0x38, 0x29, 0x18, 0x3E, 0x2A,
-    0x12, 0x31, 0x22, 0x12, 0x37, 0x2A, 0x1C, 0x3A, 0x2D, 0x1C, 0x03, 0x01, 0x02, 0x28, 0x29, 0x23,
-    0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x28,
-    0x29, 0x23, 0x38, 0x39, 0x35, 0x3D, 0x3D, 0x3B, 0x48, 0x48, 0x41, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E,
-    0x36, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x38, 0x39, 0x35, 0x43, 0x43, 0x3F, 0x03, 0x01, 0x02,
-    0x46, 0x45, 0x47, 0x3D, 0x3D, 0x3B, 0x43, 0x43, 0x3F, 0x39, 0x39, 0x3A, 0x44, 0x43, 0x43, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2C, 0x2D, 0x24, 0x3E, 0x3E,
-    0x36, 0x3E, 0x3E, 0x36, 0x32, 0x32, 0x2D, 0x2D, 0x2A, 0x23, 0x26, 0x23, 0x21, 0x2D, 0x2A, 0x23,
-    0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x1F, 0x1E, 0x1E, 0x2B, 0x22, 0x18, 0x2A, 0x2A, 0x29, 0x23,
-    0x22, 0x1B, 0x3D, 0x36, 0x2C, 0x46, 0x47, 0x39, 0x4E, 0x44, 0x40, 0x2E, 0x26, 0x1A, 0x62, 0x5E,
-    0x55, 0x57, 0x56, 0x54, 0x3E, 0x3E, 0x36, 0x3D, 0x3D, 0x3B, 0x3D, 0x3A, 0x35, 0x61, 0x5F, 0x64,
-    0x5B, 0x5A, 0x5B, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x20, 0x1D, 0x19, 0x43, 0x43, 0x3F, 0x5C,
-    0x5C, 0x55, 0x5F, 0x5E, 0x5D, 0x95, 0x93, 0x8D, 0x65, 0x65, 0x66, 0x5B, 0x5A, 0x5B, 0x3D, 0x3D,
-    0x3B, 0x57, 0x56, 0x54, 0x65, 0x65, 0x66, 0x3D, 0x3D, 0x3B, 0x5B, 0x5A, 0x5B, 0x3E, 0x3E, 0x3F,
-    0x38, 0x39, 0x35, 0x3E, 0x3E, 0x3F, 0x37, 0x36, 0x34, 0x3E, 0x3E, 0x3F, 0x44, 0x43, 0x43, 0x37,
-    0x36, 0x34, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x2F, 0x2E,
-    0x30, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x28,
-    0x26, 0x20, 0x22, 0x23, 0x22, 0x23, 0x22, 0x1B, 0x32, 0x33, 0x32, 0x63, 0x62, 0x61, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x38, 0x39, 0x35, 0x2A,
-    0x2A, 0x29, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x22, 0x23,
-    0x22, 0x22, 0x23, 0x22, 0x2F, 0x2E, 0x2B, 0x0F, 0x02, 0x01, 0x4A, 0x38, 0x30, 0x42, 0x33, 0x22,
-    0x49, 0x38, 0x29, 0x49, 0x38, 0x29, 0x4D, 0x36, 0x21, 0x47, 0x2F, 0x20, 0x42, 0x33, 0x22, 0x42,
-    0x33, 0x22, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x35, 0x26, 0x17, 0x34, 0x26, 0x12, 0x35, 0x26,
-    0x17, 0x36, 0x29, 0x13, 0x35, 0x26, 0x17, 0x2E, 0x26, 0x1A, 0x0F, 0x02, 0x01, 0x28, 0x26, 0x20,
-    0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x27,
-    0x26, 0x28, 0x28, 0x29, 0x23, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x39, 0x48, 0x48, 0x41, 0x3D, 0x3D,
-    0x3B, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x39, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x03, 0x01, 0x02,
-    0x44, 0x3F, 0x3B, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E, 0x36, 0x41, 0x42, 0x34, 0x43, 0x43, 0x3F, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x23, 0x22, 0x1B, 0x28, 0x29,
-    0x23, 0x48, 0x48, 0x41, 0x34, 0x35, 0x2E, 0x37, 0x33, 0x32, 0x2C, 0x2D, 0x24, 0x1F, 0x1E, 0x1E,
-    0x2A, 0x2A, 0x29, 0x26, 0x23, 0x21, 0x35, 0x26, 0x1F, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x23,
-    0x22, 0x1B, 0x3D, 0x3A, 0x35, 0x43, 0x43, 0x39, 0x57, 0x57, 0x4C, 0x51, 0x48, 0x41, 0x51, 0x48,
-    0x41, 0x33, 0x32, 0x23, 0x43, 0x43, 0x3F, 0x2C, 0x2D, 0x24, 0x43, 0x43, 0x3F, 0x5F, 0x5E, 0x5D,
-    0x5C, 0x5C, 0x55, 0x63, 0x62, 0x5B, 0x57, 0x56, 0x54, 0x62, 0x5E, 0x55, 0x37, 0x33, 0x32, 0x23,
-    0x22, 0x1B, 0x20, 0x1D, 0x19, 0x26, 0x23, 0x21, 0x2F, 0x2E, 0x30, 0x5F, 0x5E, 0x5D, 0x5F, 0x5E,
-    0x5D, 0x5F, 0x5E, 0x5D, 0x44, 0x43, 0x43, 0x5B, 0x5A, 0x5B, 0x39, 0x39, 0x3A, 0x44, 0x43, 0x43,
-    0x3E, 0x3E, 0x3F, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x36, 0x39, 0x39, 0x3A, 0x39,
-    0x39, 0x3A, 0x2F, 0x2E, 0x2B, 0x17, 0x18, 0x18, 0x17, 0x18, 0x18, 0x27, 0x26, 0x28, 0x1F, 0x1E,
-    0x1E, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E, 0x38, 0x39, 0x35, 0x38,
-    0x39, 0x35, 0x38, 0x39, 0x35, 0x2A, 0x2A, 0x29, 0x2C, 0x2D, 0x24, 0x34, 0x35, 0x2E, 0x03, 0x01,
-    0x02, 0x05, 0x06, 0x03, 0x09, 0x0A, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x23, 0x22, 0x1B, 0x34,
-    0x35, 0x2E, 0x34, 0x35, 0x2E, 0x3D, 0x3D, 0x3B, 0x32, 0x33, 0x32, 0x39, 0x39, 0x3A, 0x39, 0x39,
-    0x3A, 0x2A, 0x2A, 0x29, 0x39, 0x33, 0x2C, 0x03, 0x01, 0x02, 0x2B, 0x22, 0x18, 0x37, 0x2C, 0x21,
-    0x3A, 0x2D, 0x1C, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x37, 0x2A, 0x1C, 0x47, 0x2F, 0x20, 0x31,
-    0x22, 0x12, 0x37, 0x2A, 0x1C, 0x38, 0x29, 0x18, 0x37, 0x2A, 0x1C, 0x36, 0x29, 0x13, 0x34, 0x26,
-    0x12, 0x36, 0x29, 0x13, 0x35, 0x26, 0x17, 0x2B, 0x22, 0x18, 0x09, 0x0A, 0x03, 0x28, 0x26, 0x20,
-    0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x27,
-    0x26, 0x24, 0x28, 0x29, 0x23, 0x43, 0x43, 0x3F, 0x3D, 0x3D, 0x3B, 0x48, 0x48, 0x41, 0x46, 0x47,
-    0x39, 0x48, 0x48, 0x41, 0x23, 0x22, 0x1B, 0x34, 0x35, 0x2E, 0x38, 0x39, 0x35, 0x05, 0x06, 0x03,
-    0x48, 0x48, 0x41, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x43, 0x43, 0x39, 0x46, 0x47, 0x39, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x22, 0x23,
-    0x22, 0x48, 0x48, 0x41, 0x34, 0x35, 0x2E, 0x3E, 0x3E, 0x36, 0x37, 0x36, 0x34, 0x35, 0x26, 0x1F,
-    0x27, 0x26, 0x24, 0x23, 0x22, 0x1B, 0x27, 0x26, 0x28, 0x26, 0x23, 0x21, 0x28, 0x26, 0x20, 0x37,
-    0x2C, 0x21, 0x2F, 0x2E, 0x2B, 0x4B, 0x4B, 0x42, 0x43, 0x43, 0x39, 0x62, 0x62, 0x52, 0x57, 0x57,
-    0x4C, 0x41, 0x42, 0x34, 0x3E, 0x3A, 0x2D, 0x3E, 0x3A, 0x2D, 0x26, 0x1E, 0x12, 0x23, 0x22, 0x1B,
-    0x3D, 0x3A, 0x35, 0x5C, 0x5C, 0x55, 0x63, 0x62, 0x5B, 0x62, 0x5E, 0x55, 0x62, 0x5E, 0x55, 0x63,
-    0x62, 0x61, 0x20, 0x1D, 0x19, 0x3D, 0x3D, 0x3B, 0x63, 0x62, 0x61, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E,
-    0x3F, 0x3D, 0x3A, 0x35, 0x3E, 0x3E, 0x3F, 0x38, 0x39, 0x35, 0x2F, 0x2E, 0x2B, 0x38, 0x39, 0x35,
-    0x3E, 0x3E, 0x3F, 0x5F, 0x5E, 0x5D, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E, 0x36, 0x3D, 0x3D, 0x3B, 0x32,
-    0x33, 0x32, 0x37, 0x36, 0x34, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x2F, 0x2E, 0x2B, 0x2A, 0x2A,
-    0x29, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x43, 0x43, 0x3F, 0x32,
-    0x32, 0x2D, 0x48, 0x48, 0x41, 0x23, 0x22, 0x1B, 0x23, 0x22, 0x1B, 0x2C, 0x2D, 0x24, 0x5F, 0x5E,
-    0x5D, 0x38, 0x39, 0x35, 0x2C, 0x2D, 0x24, 0x38, 0x39, 0x35, 0x2C, 0x2D, 0x24, 0x23, 0x22, 0x1B,
-    0x38, 0x39, 0x35, 0x57, 0x56, 0x54, 0x5F, 0x5E, 0x5D, 0x3D, 0x3A, 0x35, 0x65, 0x65, 0x66, 0x32,
-    0x32, 0x2D, 0x37, 0x36, 0x34, 0x43, 0x43, 0x3F, 0x32, 0x33, 0x32, 0x48, 0x48, 0x41, 0x3E, 0x3E,
-    0x3F, 0x2F, 0x2E, 0x30, 0x3D, 0x3D, 0x3B, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x2E, 0x26, 0x1A,
-    0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x31, 0x22, 0x12, 0x38, 0x29, 0x18, 0x31, 0x22, 0x12, 0x31,
-    0x22, 0x12, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x31, 0x22, 0x12, 0x35, 0x26, 0x17, 0x35, 0x26,
-    0x17, 0x35, 0x26, 0x17, 0x2E, 0x26, 0x1A, 0x37, 0x2A, 0x1C, 0x23, 0x22, 0x1B, 0x2D, 0x2A, 0x23,
-    0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x22,
-    0x23, 0x22, 0x28, 0x29, 0x23, 0x2C, 0x2D, 0x24, 0x4B, 0x4B, 0x42, 0x5C, 0x5C, 0x55, 0x5C, 0x5C,
-    0x55, 0x5B, 0x5A, 0x4C, 0x62, 0x62, 0x52, 0x5D, 0x5E, 0x4C, 0x47, 0x4C, 0x39, 0x28, 0x26, 0x20,
-    0x3B, 0x3F, 0x2E, 0x62, 0x62, 0x52, 0x5D, 0x5E, 0x4C, 0x57, 0x57, 0x4C, 0x5D, 0x5E, 0x4C, 0x05,
-    0x06, 0x03, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2F, 0x2E,
-    0x30, 0x39, 0x39, 0x3A, 0x37, 0x36, 0x34, 0x32, 0x32, 0x2D, 0x38, 0x39, 0x35, 0x38, 0x39, 0x35,
-    0x28, 0x26, 0x20, 0x23, 0x22, 0x1B, 0x20, 0x1D, 0x19, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x32,
-    0x32, 0x2D, 0x3D, 0x36, 0x2C, 0x43, 0x43, 0x39, 0x4A, 0x3D, 0x34, 0x5B, 0x5A, 0x4C, 0x62, 0x5E,
-    0x55, 0x62, 0x62, 0x52, 0x57, 0x57, 0x4C, 0x4B, 0x3D, 0x2C, 0x34, 0x35, 0x2E, 0x24, 0x1A, 0x11,
-    0x2E, 0x26, 0x1A, 0x26, 0x1E, 0x12, 0x23, 0x22, 0x1B, 0x37, 0x36, 0x34, 0x62, 0x5E, 0x55, 0x62,
-    0x5E, 0x55, 0x44, 0x3F, 0x3B, 0x3D, 0x3D, 0x3B, 0x2F, 0x2E, 0x2B, 0x3D, 0x3D, 0x3B, 0x44, 0x3F,
-    0x3B, 0x3E, 0x3E, 0x3F, 0x44, 0x3F, 0x3B, 0x43, 0x43, 0x3F, 0x32, 0x33, 0x32, 0x4C, 0x4B, 0x49,
-    0x38, 0x39, 0x35, 0x5C, 0x5C, 0x55, 0x43, 0x43, 0x3F, 0x3D, 0x3D, 0x3B, 0x3E, 0x3E, 0x36, 0x34,
-    0x35, 0x2E, 0x3D, 0x3D, 0x3B, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x27, 0x26,
-    0x28, 0x1F, 0x1E, 0x1E, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28,
-    0x1F, 0x1E, 0x1E, 0x05, 0x06, 0x03, 0x48, 0x48, 0x41, 0x48, 0x48, 0x41, 0x43, 0x43, 0x3F, 0x4D,
-    0x4F, 0x41, 0x43, 0x43, 0x3F, 0x5C, 0x5C, 0x55, 0x4C, 0x4B, 0x49, 0x38, 0x39, 0x35, 0x43, 0x43,
-    0x39, 0x4B, 0x4B, 0x42, 0x5C, 0x5C, 0x55, 0x63, 0x62, 0x5B, 0x5C, 0x5C, 0x55, 0x5C, 0x5C, 0x55,
-    0x5C, 0x5C, 0x55, 0x4B, 0x4B, 0x42, 0x5C, 0x5C, 0x55, 0x43, 0x43, 0x3F, 0x44, 0x3F, 0x3B, 0x43,
-    0x43, 0x3F, 0x48, 0x48, 0x41, 0x4B, 0x4B, 0x42, 0x43, 0x43, 0x3F, 0x46, 0x45, 0x47, 0x4C, 0x4B,
-    0x49, 0x43, 0x43, 0x3F, 0x44, 0x43, 0x43, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x1B, 0x1A, 0x0B,
-    0x21, 0x16, 0x0F, 0x2E, 0x26, 0x1A, 0x2E, 0x26, 0x1A, 0x35, 0x26, 0x17, 0x2B, 0x22, 0x18, 0x37,
-    0x2A, 0x1C, 0x35, 0x26, 0x17, 0x38, 0x29, 0x18, 0x35, 0x26, 0x17, 0x3A, 0x2D, 0x1C, 0x35, 0x26,
-    0x17, 0x35, 0x26, 0x17, 0x37, 0x2A, 0x1C, 0x37, 0x2C, 0x21, 0x37, 0x2C, 0x21, 0x27, 0x26, 0x24,
-    0x28, 0x26, 0x20, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x23,
-    0x22, 0x1B, 0x28, 0x26, 0x20, 0x23, 0x22, 0x1B, 0x43, 0x43, 0x39, 0x5D, 0x5E, 0x4C, 0x5C, 0x5C,
-    0x55, 0x5B, 0x5A, 0x4C, 0x28, 0x29, 0x23, 0x3B, 0x3F, 0x2E, 0x53, 0x53, 0x44, 0x2D, 0x29, 0x1A,
-    0x62, 0x62, 0x52, 0x5D, 0x5E, 0x4C, 0x61, 0x62, 0x4A, 0x5C, 0x5D, 0x43, 0x62, 0x62, 0x52, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x22, 0x23,
-    0x22, 0x2F, 0x2E, 0x2B, 0x3D, 0x3A, 0x35, 0x32, 0x32, 0x2D, 0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E,
-    0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x26, 0x23, 0x21, 0x2C, 0x2D, 0x24, 0x2C, 0x2D, 0x24, 0x3D,
-    0x36, 0x2C, 0x51, 0x48, 0x41, 0x46, 0x47, 0x39, 0x4B, 0x4B, 0x42, 0x43, 0x43, 0x39, 0x5B, 0x5A,
-    0x4C, 0x5B, 0x5A, 0x4C, 0x5D, 0x5E, 0x4C, 0x41, 0x42, 0x34, 0x2E, 0x26, 0x1A, 0x2D, 0x29, 0x1A,
-    0x2D, 0x2A, 0x23, 0x2E, 0x26, 0x1A, 0x33, 0x32, 0x23, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x34,
-    0x35, 0x2E, 0x37, 0x33, 0x32, 0x34, 0x35, 0x2E, 0x44, 0x3F, 0x3B, 0x2F, 0x2E, 0x2B, 0x32, 0x32,
-    0x2D, 0x37, 0x36, 0x34, 0x32, 0x33, 0x32, 0x32, 0x33, 0x32, 0x3E, 0x3E, 0x3F, 0x32, 0x32, 0x2D,
-    0x2A, 0x2A, 0x29, 0x3D, 0x3D, 0x3B, 0x38, 0x39, 0x35, 0x32, 0x32, 0x2D, 0x38, 0x39, 0x35, 0x38,
-    0x39, 0x35, 0x37, 0x36, 0x34, 0x28, 0x26, 0x20, 0x2C, 0x2D, 0x24, 0x23, 0x22, 0x1B, 0x22, 0x23,
-    0x22, 0x2F, 0x2E, 0x2B, 0x27, 0x26, 0x24, 0x1F, 0x1E, 0x1E, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28,
-    0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x09, 0x0A, 0x03, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x21, 0x16, 0x0F,
-    0x1B, 0x14, 0x0A, 0x1B, 0x1A, 0x0B, 0x21, 0x16, 0x0F, 0x1C, 0x12, 0x04, 0x22, 0x15, 0x09, 0x22,
-    0x15, 0x09, 0x22, 0x13, 0x04, 0x1C, 0x0E, 0x02, 0x2C, 0x1A, 0x09, 0x1C, 0x12, 0x04, 0x35, 0x26,
-    0x17, 0x35, 0x26, 0x17, 0x37, 0x2C, 0x21, 0x2E, 0x26, 0x1A, 0x26, 0x23, 0x21, 0x28, 0x26, 0x20,
-    0x2D, 0x2A, 0x23, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x28,
-    0x29, 0x23, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x22, 0x26, 0x11, 0x48, 0x48, 0x41, 0x5D, 0x5E,
-    0x4C, 0x5D, 0x5E, 0x4C, 0x5D, 0x5E, 0x4C, 0x53, 0x53, 0x44, 0x62, 0x62, 0x52, 0x28, 0x2E, 0x19,
-    0x59, 0x57, 0x44, 0x61, 0x62, 0x4A, 0x59, 0x57, 0x44, 0x61, 0x62, 0x4A, 0x5C, 0x5D, 0x43, 0x03,
-    0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01,
-    0x02, 0x27, 0x26, 0x28, 0x3E, 0x3E, 0x3F, 0x43, 0x43, 0x3F, 0x38, 0x39, 0x35, 0x28, 0x26, 0x20,
-    0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x2C, 0x2D, 0x24, 0x33, 0x32, 0x23, 0x4D, 0x4F, 0x41, 0x48,
-    0x48, 0x41, 0x41, 0x42, 0x34, 0x46, 0x47, 0x39, 0x41, 0x42, 0x34, 0x46, 0x47, 0x39, 0x68, 0x59,
-    0x4B, 0x62, 0x62, 0x52, 0x5B, 0x5A, 0x4C, 0x41, 0x42, 0x34, 0x46, 0x47, 0x39, 0x2B, 0x22, 0x18,
-    0x1B, 0x1A, 0x0B, 0x4E, 0x44, 0x40, 0x37, 0x2C, 0x21, 0x2B, 0x22, 0x18, 0x2B, 0x22, 0x18, 0x4E,
-    0x44, 0x40, 0x4A, 0x3D, 0x34, 0x51, 0x48, 0x41, 0x44, 0x3F, 0x3B, 0x48, 0x48, 0x41, 0x44, 0x43,
-    0x43, 0x48, 0x48, 0x41, 0x44, 0x43, 0x43, 0x43, 0x43, 0x3F, 0x44, 0x43, 0x43, 0x44, 0x43, 0x43,
-    0x46, 0x45, 0x47, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x48, 0x48, 0x41, 0x43,
-    0x43, 0x3F, 0x28, 0x29, 0x23, 0x28, 0x26, 0x20, 0x22, 0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29, 0x28, 0x26, 0x20, 0x27, 0x26, 0x24, 0x22,
-    0x23, 0x22, 0x28, 0x29, 0x23, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x2A, 0x2A,
-    0x29, 0x28, 0x26, 0x20, 0x22, 0x23, 0x22, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22,
-    0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x1F, 0x1E, 0x1E, 0x27, 0x26, 0x24, 0x28,
-    0x29, 0x23, 0x28, 0x29, 0x23, 0x28, 0x26, 0x20, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x27, 0x26,
-    0x28, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x16, 0x0F, 0x09, 0x26, 0x1E, 0x12, 0x21, 0x16, 0x0F, 0x21, 0x16, 0x0F, 0x22, 0x15, 0x09, 0x22,
-    0x15, 0x09, 0x1C, 0x12, 0x04, 0x24, 0x1B, 0x0C, 0x22, 0x15, 0x09, 0x35, 0x26, 0x1F, 0x31, 0x22,
-    0x12, 0x2F, 0x2E, 0x2B, 0x2E, 0x26, 0x1A, 0x2E, 0x26, 0x1A, 0x03, 0x01, 0x02, 0x28, 0x26, 0x20,
-    0x1F, 0x1E, 0x1E, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x28,
-    0x29, 0x23, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x46, 0x47, 0x39, 0x5D, 0x5E,
-    0x4C, 0x5D, 0x5E, 0x4C, 0x59, 0x57, 0x44, 0x61, 0x62, 0x4A, 0x5D, 0x5E, 0x4C, 0x36, 0x29, 0x13,
-    0x5C, 0x5D, 0x43, 0x5C, 0x5D, 0x43, 0x5C, 0x5D, 0x43, 0x5C, 0x5D, 0x43, 0x5D, 0x5E, 0x4C, 0x03,
-    0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x2F, 0x2E, 0x30, 0x22, 0x23, 0x22, 0x48, 0x48, 0x41, 0x34, 0x35, 0x2E, 0x32, 0x32, 0x2D,
-    0x3B, 0x3F, 0x2E, 0x34, 0x35, 0x2E, 0x3E, 0x3A, 0x2D, 0x41, 0x42, 0x34, 0x43, 0x43, 0x39, 0x46,
-    0x47, 0x39, 0x5D, 0x5E, 0x4C, 0x41, 0x42, 0x34, 0x54, 0x44, 0x36, 0x41, 0x42, 0x34, 0x46, 0x47,
-    0x39, 0x43, 0x43, 0x39, 0x2E, 0x26, 0x1A, 0x3E, 0x3A, 0x2D, 0x3D, 0x36, 0x2C, 0x3D, 0x36, 0x2C,
-    0x30, 0x1F, 0x18, 0x3D, 0x36, 0x2C, 0x37, 0x36, 0x34, 0x39, 0x33, 0x2C, 0x2F, 0x2E, 0x2B, 0x37,
-    0x33, 0x32, 0x39, 0x33, 0x2C, 0x37, 0x36, 0x34, 0x39, 0x33, 0x2C, 0x38, 0x39, 0x35, 0x34, 0x35,
-    0x2E, 0x34, 0x35, 0x2E, 0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34,
-    0x37, 0x36, 0x34, 0x34, 0x35, 0x2E, 0x38, 0x39, 0x35, 0x28, 0x26, 0x20, 0x48, 0x48, 0x41, 0x43,
-    0x43, 0x39, 0x22, 0x23, 0x22, 0x28, 0x26, 0x20, 0x09, 0x0A, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x37, 0x36, 0x34, 0x46, 0x45, 0x47, 0x39, 0x39, 0x3A, 0x46,
-    0x45, 0x47, 0x3E, 0x3E, 0x3F, 0x5C, 0x5C, 0x55, 0x6A, 0x6A, 0x69, 0x57, 0x56, 0x54, 0x61, 0x5F,
-    0x64, 0x78, 0x78, 0x78, 0x96, 0x95, 0x94, 0x96, 0x95, 0x94, 0x97, 0x96, 0x99, 0xDC, 0xDB, 0xD9,
-    0x97, 0x96, 0x99, 0x9A, 0x9A, 0x9A, 0x96, 0x95, 0x94, 0x83, 0x83, 0x82, 0x63, 0x62, 0x61, 0x5C,
-    0x5C, 0x55, 0x3E, 0x3E, 0x36, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x63, 0x62, 0x5B, 0x39, 0x39,
-    0x3A, 0x46, 0x45, 0x47, 0x44, 0x43, 0x43, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x16, 0x0F, 0x09, 0x1A, 0x16, 0x11, 0x21, 0x16, 0x0F, 0x1B, 0x14, 0x0A, 0x1B,
-    0x14, 0x0A, 0x21, 0x16, 0x0F, 0x24, 0x1B, 0x0C, 0x1C, 0x12, 0x04, 0x2E, 0x26, 0x1A, 0x33, 0x32,
-    0x23, 0x26, 0x1E, 0x12, 0x0F, 0x02, 0x01, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29,
-    0x28, 0x26, 0x20, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x28,
-    0x29, 0x23, 0x22, 0x23, 0x22, 0x28, 0x26, 0x20, 0x2D, 0x29, 0x1A, 0x46, 0x47, 0x39, 0x57, 0x57,
-    0x4C, 0x5C, 0x5D, 0x43, 0x62, 0x62, 0x52, 0x86, 0x85, 0x6F, 0x83, 0x84, 0x6A, 0x36, 0x29, 0x13,
-    0x5C, 0x5D, 0x43, 0x61, 0x62, 0x4A, 0x86, 0x8B, 0x69, 0x89, 0x89, 0x6F, 0x8A, 0x7D, 0x69, 0x09,
-    0x0A, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05,
-    0x08, 0x21, 0x1E, 0x26, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x63, 0x62, 0x61, 0x63, 0x62, 0x5B,
-    0x3B, 0x3F, 0x2E, 0x43, 0x43, 0x39, 0x41, 0x42, 0x34, 0x46, 0x47, 0x39, 0x43, 0x47, 0x2F, 0x62,
-    0x5E, 0x55, 0x5D, 0x5E, 0x4C, 0x41, 0x42, 0x34, 0x46, 0x47, 0x39, 0x2C, 0x2D, 0x24, 0x28, 0x2E,
-    0x19, 0x2D, 0x2A, 0x23, 0x2B, 0x22, 0x18, 0x23, 0x22, 0x1B, 0x28, 0x26, 0x20, 0x23, 0x22, 0x1B,
-    0x20, 0x1D, 0x19, 0x27, 0x26, 0x24, 0x2B, 0x22, 0x18, 0x23, 0x22, 0x1B, 0x20, 0x1D, 0x19, 0x2E,
-    0x26, 0x1A, 0x27, 0x26, 0x24, 0x2D, 0x2A, 0x23, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x28, 0x29,
-    0x23, 0x28, 0x29, 0x23, 0x32, 0x32, 0x2D, 0x32, 0x32, 0x2D, 0x32, 0x33, 0x32, 0x37, 0x36, 0x34,
-    0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x22,
-    0x23, 0x22, 0x2C, 0x2D, 0x24, 0x27, 0x26, 0x24, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x42, 0x3D, 0x45, 0x3E, 0x3E, 0x3F, 0x39, 0x39, 0x3A, 0x57,
-    0x56, 0x54, 0x61, 0x5F, 0x64, 0x39, 0x39, 0x3A, 0x35, 0x34, 0x3A, 0x65, 0x65, 0x66, 0x5F, 0x5E,
-    0x5D, 0x65, 0x65, 0x66, 0x83, 0x83, 0x82, 0x7E, 0x7E, 0x7D, 0x97, 0x96, 0x99, 0xD8, 0xD6, 0xD9,
-    0x96, 0x95, 0x94, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x5F, 0x5E, 0x5D, 0x63, 0x62, 0x61, 0x38,
-    0x39, 0x35, 0x63, 0x62, 0x5B, 0x5F, 0x5E, 0x5D, 0x38, 0x39, 0x35, 0x3E, 0x3E, 0x3F, 0x46, 0x45,
-    0x47, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x3A, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x1A, 0x16, 0x11, 0x19, 0x13, 0x0E, 0x1C, 0x1A, 0x13, 0x21,
-    0x16, 0x0F, 0x22, 0x15, 0x09, 0x16, 0x0F, 0x09, 0x37, 0x2C, 0x21, 0x37, 0x2A, 0x1C, 0x20, 0x1D,
-    0x19, 0x09, 0x0A, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29,
-    0x26, 0x23, 0x21, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x28,
-    0x29, 0x23, 0x28, 0x26, 0x20, 0x28, 0x29, 0x23, 0x2E, 0x26, 0x1A, 0x46, 0x47, 0x39, 0x5D, 0x5E,
-    0x4C, 0x62, 0x62, 0x52, 0x86, 0x85, 0x6F, 0x8A, 0x7D, 0x69, 0x8A, 0x8A, 0x76, 0x24, 0x2B, 0x11,
-    0x8A, 0x7D, 0x69, 0x83, 0x84, 0x6A, 0x83, 0x84, 0x6A, 0x83, 0x84, 0x6A, 0x86, 0x85, 0x6F, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x2F, 0x2E, 0x2B, 0x22, 0x23, 0x22, 0x44, 0x3F, 0x3B, 0x5B, 0x5A, 0x4C,
-    0x5C, 0x5C, 0x55, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x46, 0x47, 0x39, 0x5B, 0x5A, 0x4C, 0x46,
-    0x47, 0x39, 0x41, 0x42, 0x34, 0x43, 0x43, 0x39, 0x2D, 0x29, 0x1A, 0x1B, 0x1A, 0x0B, 0x1A, 0x16,
-    0x11, 0x2C, 0x2D, 0x24, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x2C, 0x2D, 0x24, 0x28, 0x26, 0x20,
-    0x1D, 0x18, 0x18, 0x28, 0x26, 0x20, 0x2D, 0x2A, 0x23, 0x26, 0x23, 0x21, 0x23, 0x22, 0x1B, 0x28,
-    0x26, 0x20, 0x2D, 0x2A, 0x23, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x23, 0x22, 0x1B, 0x20, 0x1D,
-    0x19, 0x20, 0x1D, 0x19, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23,
-    0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x28, 0x29, 0x23, 0x28,
-    0x26, 0x20, 0x22, 0x23, 0x22, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x44, 0x43, 0x43, 0x5F, 0x5E, 0x5D, 0x42, 0x3D, 0x45, 0x44,
-    0x43, 0x43, 0x3E, 0x3E, 0x3F, 0x61, 0x5F, 0x64, 0x61, 0x5F, 0x64, 0x3B, 0x36, 0x43, 0x5F, 0x5E,
-    0x5D, 0x5B, 0x5A, 0x5B, 0x61, 0x5F, 0x64, 0x78, 0x78, 0x78, 0x9F, 0x9E, 0x9D, 0x97, 0x96, 0x99,
-    0x97, 0x96, 0x99, 0x7E, 0x7E, 0x7D, 0x61, 0x5F, 0x64, 0x57, 0x56, 0x54, 0x39, 0x39, 0x3A, 0x43,
-    0x43, 0x3F, 0x5F, 0x5E, 0x5D, 0x3E, 0x3E, 0x36, 0x3E, 0x3E, 0x3F, 0x43, 0x43, 0x3F, 0x57, 0x56,
-    0x54, 0x3E, 0x3E, 0x3F, 0x42, 0x3D, 0x45, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x1C, 0x1A, 0x13, 0x16, 0x0F, 0x09, 0x1A,
-    0x16, 0x11, 0x1B, 0x14, 0x0A, 0x21, 0x16, 0x0F, 0x2E, 0x26, 0x1A, 0x2E, 0x26, 0x1A, 0x0F, 0x02,
-    0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x28, 0x26, 0x20,
-    0x26, 0x23, 0x21, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x22,
-    0x23, 0x22, 0x27, 0x26, 0x24, 0x28, 0x29, 0x23, 0x23, 0x22, 0x1B, 0x46, 0x47, 0x39, 0x5D, 0x5E,
-    0x4C, 0x59, 0x57, 0x44, 0x86, 0x85, 0x75, 0x8A, 0x8A, 0x76, 0x83, 0x84, 0x6A, 0x28, 0x2E, 0x19,
-    0x61, 0x62, 0x4A, 0x83, 0x84, 0x6A, 0x83, 0x84, 0x6A, 0x89, 0x89, 0x6F, 0x8A, 0x8A, 0x76, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05,
-    0x08, 0x05, 0x05, 0x08, 0x1F, 0x1E, 0x1E, 0x28, 0x29, 0x23, 0x27, 0x26, 0x24, 0x43, 0x43, 0x3F,
-    0x63, 0x62, 0x5B, 0x5D, 0x5E, 0x4C, 0x43, 0x43, 0x39, 0x40, 0x4C, 0x33, 0x43, 0x43, 0x39, 0x41,
-    0x42, 0x34, 0x43, 0x43, 0x39, 0x3B, 0x3F, 0x2E, 0x34, 0x35, 0x2E, 0x3E, 0x3A, 0x2D, 0x43, 0x43,
-    0x39, 0x32, 0x32, 0x2D, 0x3E, 0x3E, 0x36, 0x32, 0x33, 0x32, 0x38, 0x39, 0x35, 0x17, 0x18, 0x18,
-    0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x23, 0x22, 0x1B, 0x27, 0x26, 0x24, 0x2A,
-    0x2A, 0x29, 0x37, 0x33, 0x32, 0x32, 0x32, 0x2D, 0x34, 0x35, 0x2E, 0x32, 0x33, 0x32, 0x32, 0x33,
-    0x32, 0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E, 0x32, 0x33, 0x32, 0x34, 0x35, 0x2E, 0x32, 0x32, 0x2D,
-    0x32, 0x33, 0x32, 0x2A, 0x2A, 0x29, 0x44, 0x43, 0x43, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x2A,
-    0x2A, 0x29, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x5B, 0x5A, 0x5B, 0x61, 0x5F, 0x64, 0x7E, 0x7E, 0x7D, 0x5B,
-    0x5A, 0x5B, 0x5F, 0x5E, 0x5D, 0x83, 0x83, 0x82, 0x7E, 0x7E, 0x7D, 0x5F, 0x5E, 0x5D, 0x65, 0x65,
-    0x66, 0x97, 0x96, 0x99, 0x7E, 0x7E, 0x7D, 0x9A, 0x9A, 0x9A, 0xD3, 0xD2, 0xD1, 0xE0, 0xDF, 0xDE,
-    0xD8, 0xD6, 0xD9, 0x97, 0x96, 0x99, 0x83, 0x83, 0x82, 0x97, 0x96, 0x99, 0x63, 0x62, 0x61, 0x7E,
-    0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x84, 0x84, 0x7B, 0x78, 0x78, 0x78, 0x5B, 0x5A, 0x5B, 0x63, 0x62,
-    0x61, 0x65, 0x65, 0x66, 0x5B, 0x5A, 0x5B, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x1C, 0x1A, 0x13, 0x1B,
-    0x14, 0x0A, 0x1C, 0x1A, 0x13, 0x37, 0x2A, 0x1C, 0x2B, 0x22, 0x18, 0x09, 0x0A, 0x03, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24,
-    0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x27, 0x26, 0x24, 0x27,
-    0x26, 0x24, 0x28, 0x26, 0x20, 0x2D, 0x29, 0x1A, 0x28, 0x26, 0x20, 0x46, 0x47, 0x39, 0x5D, 0x5E,
-    0x4C, 0x5D, 0x5E, 0x4C, 0x5C, 0x5D, 0x43, 0x62, 0x62, 0x52, 0x83, 0x84, 0x6A, 0x30, 0x1D, 0x09,
-    0x89, 0x89, 0x6F, 0x83, 0x84, 0x6A, 0x89, 0x89, 0x6F, 0x83, 0x84, 0x6A, 0x83, 0x84, 0x6A, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01,
-    0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x28, 0x29, 0x23,
-    0x38, 0x39, 0x35, 0x62, 0x5E, 0x55, 0x62, 0x5E, 0x55, 0x57, 0x57, 0x4C, 0x62, 0x5E, 0x55, 0x47,
-    0x4C, 0x39, 0x43, 0x43, 0x39, 0x4B, 0x4B, 0x42, 0x43, 0x43, 0x39, 0x20, 0x1D, 0x19, 0x17, 0x18,
-    0x18, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x4C, 0x4B, 0x49,
-    0x37, 0x36, 0x34, 0x32, 0x33, 0x32, 0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0x3D, 0x3D, 0x3B, 0x43,
-    0x43, 0x3F, 0x48, 0x48, 0x41, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x48, 0x48, 0x41, 0x4B, 0x4B,
-    0x42, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41, 0x48, 0x48, 0x41, 0x43, 0x43, 0x3F, 0x48, 0x48, 0x41,
-    0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x22,
-    0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x3E, 0x3E, 0x3F, 0x43, 0x43, 0x3F, 0x3E, 0x3E, 0x3F, 0x44,
-    0x43, 0x43, 0x35, 0x34, 0x3A, 0x43, 0x43, 0x3F, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x39, 0x39,
-    0x3A, 0x46, 0x45, 0x47, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x3A, 0x44, 0x43, 0x43, 0x3D, 0x3D, 0x3B,
-    0x3E, 0x3E, 0x3F, 0x3E, 0x3E, 0x3F, 0x44, 0x43, 0x43, 0x3B, 0x36, 0x43, 0x3D, 0x3D, 0x3B, 0x3D,
-    0x3D, 0x3B, 0x43, 0x43, 0x3F, 0x3D, 0x3D, 0x3B, 0x43, 0x43, 0x3F, 0x43, 0x43, 0x3F, 0x39, 0x39,
-    0x3A, 0x3D, 0x3D, 0x3B, 0x3D, 0x3D, 0x3B, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0E, 0x0D, 0x0D, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x37, 0x2C, 0x21, 0x2B, 0x22, 0x18, 0x2D, 0x2A, 0x23, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29,
-    0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x29, 0x25, 0x2E, 0x27, 0x26, 0x28, 0x27,
-    0x26, 0x24, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x2E, 0x26, 0x1A, 0x43, 0x43, 0x39, 0x5C, 0x5C,
-    0x55, 0x5D, 0x5E, 0x4C, 0x5B, 0x5A, 0x4C, 0x5C, 0x5D, 0x43, 0x59, 0x57, 0x44, 0x28, 0x2E, 0x19,
-    0x61, 0x62, 0x4A, 0x5C, 0x5D, 0x43, 0x61, 0x62, 0x4A, 0x61, 0x62, 0x4A, 0x62, 0x62, 0x52, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x28, 0x26, 0x20, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23,
-    0x2D, 0x2A, 0x23, 0x46, 0x47, 0x39, 0x63, 0x62, 0x5B, 0x3B, 0x3F, 0x2E, 0x43, 0x43, 0x3F, 0x2D,
-    0x2A, 0x23, 0x32, 0x32, 0x2D, 0x34, 0x35, 0x2E, 0x32, 0x32, 0x2D, 0x39, 0x39, 0x3A, 0x3E, 0x3E,
-    0x36, 0x32, 0x32, 0x2D, 0x3E, 0x3E, 0x36, 0x38, 0x39, 0x35, 0x37, 0x36, 0x34, 0x2F, 0x2E, 0x2B,
-    0x38, 0x39, 0x35, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x37, 0x36, 0x34, 0x38, 0x39, 0x35, 0x37,
-    0x36, 0x34, 0x37, 0x36, 0x34, 0x32, 0x32, 0x2D, 0x32, 0x33, 0x32, 0x34, 0x35, 0x2E, 0x38, 0x39,
-    0x35, 0x34, 0x35, 0x2E, 0x34, 0x35, 0x2E, 0x38, 0x39, 0x35, 0x34, 0x35, 0x2E, 0x37, 0x36, 0x34,
-    0x38, 0x39, 0x35, 0x37, 0x36, 0x34, 0x27, 0x26, 0x28, 0x1F, 0x1E, 0x1E, 0x32, 0x33, 0x32, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x0A, 0x0A, 0x09, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x24, 0x22,
-    0x23, 0x22, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x0A, 0x0A, 0x09, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x08, 0x06, 0x0F, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06,
-    0x03, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x37, 0x2C, 0x21, 0x0F, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x2A, 0x2A, 0x29,
-    0x27, 0x26, 0x28, 0x22, 0x23, 0x22, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x27,
-    0x26, 0x24, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x46, 0x47, 0x39, 0x62, 0x62,
-    0x52, 0x59, 0x57, 0x44, 0x62, 0x62, 0x52, 0x61, 0x62, 0x4A, 0x61, 0x62, 0x4A, 0x28, 0x21, 0x11,
-    0x59, 0x57, 0x44, 0x5C, 0x5D, 0x43, 0x59, 0x57, 0x44, 0x68, 0x59, 0x4B, 0x5B, 0x5A, 0x4C, 0x03,
-    0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x23, 0x22, 0x1B, 0x28, 0x29, 0x23,
-    0x26, 0x23, 0x21, 0x27, 0x26, 0x24, 0x20, 0x1D, 0x19, 0x32, 0x32, 0x2D, 0x28, 0x29, 0x23, 0x20,
-    0x1D, 0x19, 0x2F, 0x2E, 0x2B, 0x28, 0x26, 0x20, 0x28, 0x29, 0x23, 0x27, 0x26, 0x24, 0x28, 0x26,
-    0x20, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x28, 0x26, 0x20, 0x27, 0x26, 0x24, 0x28, 0x29, 0x23,
-    0x23, 0x22, 0x1B, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x27,
-    0x26, 0x28, 0x27, 0x26, 0x24, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x28, 0x29, 0x23, 0x28, 0x26,
-    0x20, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x28, 0x29, 0x23, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24,
-    0x28, 0x29, 0x23, 0x27, 0x26, 0x24, 0x2F, 0x2E, 0x2B, 0x21, 0x1E, 0x26, 0x22, 0x23, 0x22, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x05,
-    0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
-    0x01, 0x02, 0x0A, 0x0A, 0x09, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01,
-    0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x05, 0x06, 0x03, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x27, 0x26, 0x28,
-    0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x27, 0x26, 0x28, 0x29, 0x25, 0x2E, 0x27, 0x26, 0x28, 0x27,
-    0x26, 0x24, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x28, 0x26, 0x20, 0x46, 0x47, 0x39, 0x5B, 0x5A,
-    0x4C, 0x62, 0x62, 0x52, 0x59, 0x57, 0x44, 0x5D, 0x5E, 0x4C, 0x5D, 0x5E, 0x4C, 0x22, 0x26, 0x11,
-    0x61, 0x62, 0x4A, 0x5C, 0x5D, 0x43, 0x5D, 0x5E, 0x4C, 0x61, 0x62, 0x4A, 0x5B, 0x5A, 0x4C, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x05, 0x05, 0x08, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x28, 0x29, 0x23, 0x28, 0x26, 0x20, 0x28, 0x29, 0x23, 0x26, 0x23, 0x21, 0x26, 0x23, 0x21, 0x27,
-    0x26, 0x24, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x22, 0x23, 0x22, 0x27, 0x26, 0x24, 0x27, 0x26,
-    0x24, 0x22, 0x23, 0x22, 0x2D, 0x2A, 0x23, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x28, 0x26, 0x20,
-    0x2A, 0x2A, 0x29, 0x27, 0x26, 0x24, 0x27, 0x26, 0x28, 0x2A, 0x2A, 0x29, 0x22, 0x23, 0x22, 0x2A,
-    0x2A, 0x29, 0x22, 0x23, 0x22, 0x28, 0x29, 0x23, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20, 0x28, 0x26,
-    0x20, 0x28, 0x26, 0x20, 0x28, 0x29, 0x23, 0x2D, 0x2A, 0x23, 0x28, 0x26, 0x20, 0x28, 0x26, 0x20,
-    0x28, 0x29, 0x23, 0x27, 0x26, 0x24, 0x27, 0x26, 0x24, 0x2A, 0x2A, 0x29, 0x27, 0x26, 0x28, 0x03,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x02, 0x03, 0x01, 0x02
-};
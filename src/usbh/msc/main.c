@@ -4,6 +4,11 @@
 #include "ff.h"
 #include "usbh_msc.h"
 
+void __attribute__((interrupt("IRQ"))) irq_handler (void)
+{
+  usbh_isr();
+}
+
 static int file_read (unsigned char **fbuf, char *name)
 {
   FIL fil;
@@ -15,6 +20,7 @@ static int file_read (unsigned char **fbuf, char *name)
     *fbuf = malloc(fsize);
     printf("(%d): ", fsize);
     ctr_ms = 0;
+    usbh_stat.wait = 0;
     for(i = 0; i < fsize; )
     {
       usbh_handler();
@@ -24,8 +30,9 @@ static int file_read (unsigned char **fbuf, char *name)
       i += j;
       printf("%3d%%\b\b\b\b", i * 100 / fsize);
     }
-    if(dev_usb) printf("OK (%dmS %d.%dMB/S)\n", ctr_ms,
-      (fsize >> 10) / ctr_ms, ((fsize >> 10) % ctr_ms) * 1000 / ctr_ms);
+    if(dev_usb) printf("OK (%dmS %d.%dMB/S, CPU idle %d%%)\n", ctr_ms,
+      (fsize >> 10) / ctr_ms, ((fsize >> 10) % ctr_ms) * 1000 / ctr_ms,
+      usbh_stat.wait / 10 / ctr_ms);
     f_close(&fil);
   }
   else puts(": error");
@@ -41,6 +48,7 @@ static int file_write (unsigned char **fbuf, char *name, int fsize)
   {
     printf("(%d): ", fsize);
     ctr_ms = 0;
+    usbh_stat.wait = 0;
     for(i = 0; i < fsize; )
     {
       usbh_handler();
@@ -50,8 +58,9 @@ static int file_write (unsigned char **fbuf, char *name, int fsize)
       i += j;
       printf("%3d%%\b\b\b\b", i * 100 / fsize);
     }
-    if(dev_usb) printf("OK (%dmS %d.%dMB/S)\n", ctr_ms,
-      (fsize >> 10) / ctr_ms, ((fsize >> 10) % ctr_ms) * 1000 / ctr_ms);
+    if(dev_usb) printf("OK (%dmS %d.%dMB/S, CPU idle %d%%)\n", ctr_ms,
+      (fsize >> 10) / ctr_ms, ((fsize >> 10) % ctr_ms) * 1000 / ctr_ms,
+      usbh_stat.wait / 10 / ctr_ms);
     f_close(&fil);
   }
   else puts(": error");
@@ -67,6 +76,7 @@ int main (void)
   printf("Press any key\r"); getchar(); printf(CLR_EOL);
   usb_mux(USB_MUX_HOST);
   usbh_init();
+  usbh_irq(1);
   while(1)
   {
     usbh_handler();
@@ -74,6 +84,7 @@ int main (void)
     {
       printf("USB disk: ");
       disk_init(0, &usbh_msc_read, &usbh_msc_write);
+      disk_sync(0, &usbh_msc_sync);
       if(f_mount(&fs, (TCHAR*)"0:", 1) != FR_OK) puts("not support or error");
       else
       {
@@ -0,0 +1,123 @@
+/* Packs files into the SPI flash asset archive of drv/asset.h and reads
+   every asset back through drv/asset.c against a flash image in memory. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sys.h"
+#include "lz4.h"
+#include "asset.h"
+
+static u8 *flash;
+static u32 flash_size;
+
+/* Host stand-ins for the SPI flash driver used by drv/asset.c */
+void spi_init (void) {}
+
+int spi_flash_read (u32 addr, void *buf, u32 len)
+{
+  if(!buf || !len) return 1;
+  memset(buf, 0xFF, len);
+  if(addr < flash_size)
+    memcpy(buf, flash + addr, len < flash_size - addr ? len : flash_size - addr);
+  return 0;
+}
+
+static u8 **files;
+
+static int cmp_ent (const void *a, const void *b)
+{
+  return strncmp(((struct ASSET_ENT*)a)->name, ((struct ASSET_ENT*)b)->name, ASSET_NAME);
+}
+
+static u8 *load (const char *path, u32 *size)
+{
+  FILE *f = fopen(path, "rb");
+  u8 *buf;
+  if(!f) return NULL;
+  fseek(f, 0, SEEK_END);
+  *size = ftell(f);
+  rewind(f);
+  if((buf = malloc(*size + 1)) && fread(buf, 1, *size, f) != *size)
+  {
+    free(buf);
+    buf = NULL;
+  }
+  fclose(f);
+  return buf;
+}
+
+static int verify (struct ASSET_ENT *ent, u32 num)
+{
+  struct ASSET a;
+  u8 *buf, *ptr;
+  u32 i, j, n;
+  if(asset_init() != num) return puts("Index check failed"), KO;
+  for(i = 0; i < num; i++)
+  {
+    if(asset_open(&a, ent[i].name) != OK || a.idx != i || a.size != ent[i].size)
+      return printf("%s: open failed\n", ent[i].name), KO;
+    if(!(buf = malloc(a.size + 1))) return KO;
+    for(n = 0; (j = asset_read(&a, buf + n, 1000)); n += j);  // odd chunk size
+    ptr = asset_map(&a);
+    if(n != a.size || !ptr || memcmp(buf, ptr, n) || memcmp(buf, files[i], n))
+      return printf("%s: read back failed\n", ent[i].name), KO;
+    asset_unmap(&a);
+    free(buf);
+  }
+  return asset_open(&a, "no such asset") == KO ? OK : KO;
+}
+
+int main (int argc, char *argv[])
+{
+  struct ASSET_HDR hdr = { ASSET_MAGIC };
+  struct ASSET_ENT *ent;
+  const char *name;
+  u32 i, j, ofs;
+  FILE *f;
+  if(argc < 3)
+  {
+    puts("Usage: assetpack archive.bin file...");
+    return 1;
+  }
+  hdr.num = argc - 2;
+  ent = calloc(hdr.num, sizeof(*ent));
+  files = calloc(hdr.num, sizeof(*files));
+  for(i = 0; i < hdr.num; i++)
+  {
+    name = strrchr(argv[i + 2], '/');
+    name = name ? name + 1 : argv[i + 2];
+    if(strlen(name) >= ASSET_NAME) return printf("%s: name too long\n", name), 1;
+    strcpy(ent[i].name, name);
+  }
+  qsort(ent, hdr.num, sizeof(*ent), cmp_ent);
+  ofs = sizeof(hdr) + hdr.num * sizeof(*ent);
+  for(i = 0; i < hdr.num; i++)
+  {
+    if(i && !strcmp(ent[i].name, ent[i - 1].name)) return printf("%s: duplicate\n", ent[i].name), 1;
+    for(j = 2; j < argc; j++)
+    {
+      name = strrchr(argv[j], '/');
+      if(!strcmp(name ? name + 1 : argv[j], ent[i].name)) break;
+    }
+    if(!(files[i] = load(argv[j], &ent[i].size))) return printf("%s: can't read\n", argv[j]), 1;
+    ent[i].crc = lz4_crc(files[i], ent[i].size);
+    ofs = (ofs + ASSET_ALIGN - 1) & -ASSET_ALIGN;
+    ent[i].ofs = ofs;
+    ofs += ent[i].size;
+  }
+  hdr.size = ofs;
+  hdr.crc = lz4_crc(ent, hdr.num * sizeof(*ent));
+  /* The archive as it sits in flash */
+  flash_size = ASSET_ADDR + hdr.size;
+  if(!(flash = malloc(flash_size))) return 1;
+  memset(flash, 0xFF, flash_size);
+  memcpy(flash + ASSET_ADDR, &hdr, sizeof(hdr));
+  memcpy(flash + ASSET_ADDR + sizeof(hdr), ent, hdr.num * sizeof(*ent));
+  for(i = 0; i < hdr.num; i++) memcpy(flash + ASSET_ADDR + ent[i].ofs, files[i], ent[i].size);
+  if(verify(ent, hdr.num) != OK) return puts("Round-trip check failed"), 1;
+  if(!(f = fopen(argv[1], "wb")) || fwrite(flash + ASSET_ADDR, 1, hdr.size, f) != hdr.size)
+    return printf("%s: write error\n", argv[1]), 1;
+  fclose(f);
+  printf("%s: %u assets, %u bytes at flash 0x%X\n", argv[1], hdr.num, hdr.size, ASSET_ADDR);
+  return 0;
+}
@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+"""Renders the boot trace printed by boot_trace_dump() (drv/trace.c).
+
+Usage: timeline.py [uart.log] [-w width]
+
+Every "trace <us> <delta> <tag>" line is one event; the bar of an event
+covers the time from the previous event, i.e. the step named by the tag.
+"""
+import re
+import sys
+
+
+def main():
+    args = sys.argv[1:]
+    width = 60
+    if '-w' in args:
+        i = args.index('-w')
+        width = int(args[i + 1])
+        del args[i:i + 2]
+    src = open(args[0], errors='replace') if args else sys.stdin
+    events = []
+    for line in src:
+        m = re.search(r'trace\s+(\d+)\s+(\d+)\s+(\S+)', line)
+        if m:
+            events.append((int(m.group(1)), m.group(3)))
+    if not events:
+        sys.exit('no trace lines found')
+    total = max(events[-1][0], 1)
+    prev = 0
+    print('%-12s %10s %10s  %s' % ('step', 'end, us', 'step, us', 'timeline'))
+    for us, tag in events:
+        start = prev * width // total
+        end = max(us * width // total, start + (us > prev))
+        bar = ' ' * start + '#' * (end - start)
+        print('%-12s %10u %10u %5.1f%% |%-*s|' % (tag, us, us - prev,
+              (us - prev) * 100.0 / total, width, bar))
+        prev = us
+    print('total %u us' % total)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,378 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include "sys.h"
+#include "arm.h"
+
+#define ARM_MAX   256       // instructions of a routine
+#define ARM_STEPS 1000000   // a call that runs longer does not return
+
+enum { OP_MOV, OP_AND, OP_ORR, OP_ADD, OP_ADC, OP_SUB, OP_CMP, OP_TST,
+  OP_LDR, OP_LDRH, OP_LDRB, OP_LDM, OP_PUSH, OP_POP, OP_B, OP_BX };
+
+static const char *ops[] = { "mov", "and", "orr", "add", "adc", "sub", "cmp", "tst",
+  "ldrb", "ldrh", "ldmia", "ldr", "push", "pop", "bx", "b" };
+static const u8 op_id[] = { OP_MOV, OP_AND, OP_ORR, OP_ADD, OP_ADC, OP_SUB, OP_CMP, OP_TST,
+  OP_LDRB, OP_LDRH, OP_LDM, OP_LDR, OP_PUSH, OP_POP, OP_BX, OP_B };
+static const char *conds[] = { "eq", "ne", "cs", "cc", "mi", "pl", "vs", "vc",
+  "hi", "ls", "ge", "lt", "gt", "le", "al" };
+
+struct INSN {
+  u8  op, cond, s;
+  u8  rd, rn, rm;
+  u8  imm_op;         // operand 2 is #imm
+  u8  lsr;            // rm lsr #sh, else lsl
+  u8  sh;
+  u8  wb;             // post-index or !
+  u16 list;           // LDM, PUSH, POP
+  u32 imm;            // operand 2 or the offset
+  int line;           // of the asm, from 1
+};
+
+static struct INSN code[ARM_MAX];
+static int code_n;
+static int lbl_at[10][ARM_MAX];   // numeric labels: instruction index
+static int lbl_n[10];
+
+static int err_at (int line, const char *str)
+{
+  printf("ARM: line %d of the asm: %s\n", line, str);
+  return -1;
+}
+
+static int reg (const char *s)
+{
+  while(isspace(*s)) s++;
+  if(!strncmp(s, "sp", 2)) return 13;
+  if(!strncmp(s, "lr", 2)) return 14;
+  if(!strncmp(s, "pc", 2)) return 15;
+  if(*s != 'r' || !isdigit(s[1])) return -1;
+  return atoi(s + 1) < 16 ? atoi(s + 1) : -1;
+}
+
+static u16 reglist (const char *s)
+{
+  u16 list = 0;
+  int a, b;
+  s = strchr(s, '{');
+  while(s && *s && *s != '}')
+  {
+    a = b = reg(++s);
+    while(*s && *s != ',' && *s != '-' && *s != '}') s++;
+    if(*s == '-')
+    {
+      b = reg(++s);
+      while(*s && *s != ',' && *s != '}') s++;
+    }
+    if(a < 0 || b < a) return 0;
+    while(a <= b) list |= 1 << a++;
+  }
+  return list;
+}
+
+/* rm, rm, lsl #n, rm, lsr #n or #imm */
+static int operand2 (struct INSN *i, char *arg[], int n)
+{
+  if(n < 1) return -1;
+  if(*arg[0] == '#')
+  {
+    i->imm_op = 1;
+    i->imm = strtoul(arg[0] + 1, NULL, 0);
+    return n == 1 ? 0 : -1;
+  }
+  i->rm = reg(arg[0]);
+  if(n == 1) return i->rm > 15 ? -1 : 0;
+  if(n != 2 || (strncmp(arg[1], "lsl #", 5) && strncmp(arg[1], "lsr #", 5))) return -1;
+  i->lsr = arg[1][2] == 'r';
+  i->sh = atoi(arg[1] + 5);
+  return i->rm > 15 || !i->sh || i->sh > 31 ? -1 : 0;
+}
+
+static int parse (char *s, int line)
+{
+  struct INSN *i = &code[code_n];
+  char *arg[6], *p, *end;
+  int n = 0, k, d = 0;
+  while(isspace(*s)) s++;
+  if(!*s) return 0;
+  if(isdigit(*s) && s[1] == ':')
+  {
+    lbl_at[*s - '0'][lbl_n[*s - '0']++] = code_n;
+    return 0;
+  }
+  if(code_n == ARM_MAX) return err_at(line, "too many instructions");
+  memset(i, 0, sizeof(*i));
+  i->line = line;
+  i->cond = 14;
+  for(k = 0; k < sizeof(ops) / sizeof(ops[0]) && strncmp(s, ops[k], strlen(ops[k])); k++) ;
+  if(k == sizeof(ops) / sizeof(ops[0])) return err_at(line, "unknown instruction");
+  i->op = op_id[k];
+  s += strlen(ops[k]);
+  if(*s == 's' && i->op <= OP_SUB) i->s = 1, s++;
+  if(!isspace(*s))
+  {
+    for(i->cond = 0; i->cond < 15 && strncmp(s, conds[i->cond], 2); i->cond++) ;
+    if(i->cond == 15 || !isspace(s[2])) return err_at(line, "unknown condition");
+    s += 2;
+  }
+  /* the arguments, split at the commas outside [] and {} */
+  end = s + strlen(s);
+  for(p = s; *p; p++)
+  {
+    if(*p == '[' || *p == '{') d++;
+    if(*p == ']' || *p == '}') d--;
+    if(*p == ',' && !d) *p = 0;
+  }
+  for(p = s; p < end && n < 6; )
+  {
+    while(isspace(*p)) p++;
+    if(!*p) break;
+    arg[n++] = p;
+    p += strlen(p) + 1;
+  }
+  for(k = n; k < 6; k++) arg[k] = "";
+  for(k = 0; k < n; k++)
+    for(p = arg[k] + strlen(arg[k]); p > arg[k] && isspace(p[-1]); ) *--p = 0;
+  switch(i->op)
+  {
+    case OP_MOV:
+      i->rd = reg(arg[0]);
+      if(n < 2 || i->rd > 15 || operand2(i, arg + 1, n - 1)) return err_at(line, "bad operands");
+      break;
+    case OP_CMP:
+    case OP_TST:
+      i->s = 1;
+      i->rn = reg(arg[0]);
+      if(n < 2 || i->rn > 15 || operand2(i, arg + 1, n - 1)) return err_at(line, "bad operands");
+      break;
+    case OP_AND: case OP_ORR: case OP_ADD: case OP_ADC: case OP_SUB:
+      i->rd = reg(arg[0]);
+      i->rn = n > 1 ? reg(arg[1]) : -1;
+      if(n < 3 || i->rd > 15 || i->rn > 15 || operand2(i, arg + 2, n - 2)) return err_at(line, "bad operands");
+      break;
+    case OP_LDR: case OP_LDRH: case OP_LDRB:
+      i->rd = reg(arg[0]);
+      i->rn = n > 1 && *arg[1] == '[' ? reg(arg[1] + 1) : -1;
+      if(n == 3 && *arg[2] == '#') i->wb = 1, i->imm = strtoul(arg[2] + 1, NULL, 0);
+      if(n < 2 || n > 3 || i->rd > 15 || i->rn > 15 || (n == 3 && !i->wb) || strchr(arg[1], ',') ||
+        arg[1][strlen(arg[1]) - 1] != ']')
+        return err_at(line, "only [rn] and [rn], #imm are known");
+      break;
+    case OP_LDM:
+      i->rn = reg(arg[0]);
+      i->wb = n > 0 && arg[0][strlen(arg[0]) - 1] == '!';
+      i->list = n == 2 ? reglist(arg[1]) : 0;
+      if(i->rn > 15 || !i->list || i->list >> i->rn & 1) return err_at(line, "bad operands");
+      break;
+    case OP_PUSH:
+    case OP_POP:
+      i->list = n == 1 ? reglist(arg[0]) : 0;
+      if(!i->list || i->list >> 13 & 1 || i->list >> 15 & 1) return err_at(line, "bad register list");
+      break;
+    case OP_B:
+      if(n != 1 || !isdigit(*arg[0]) || (arg[0][1] != 'f' && arg[0][1] != 'b'))
+        return err_at(line, "only numeric local labels are known");
+      i->rd = *arg[0] - '0';
+      i->lsr = arg[0][1] == 'f';
+      break;
+    case OP_BX:
+      i->rm = n == 1 ? reg(arg[0]) : -1;
+      if(i->rm != 14) return err_at(line, "only BX LR is known");
+      break;
+  }
+  code_n++;
+  return 0;
+}
+
+/* Branch targets: the next label of the number forward, or the last one back */
+static int resolve (void)
+{
+  struct INSN *i;
+  int k, t;
+  for(int n = 0; n < code_n; n++)
+  {
+    i = &code[n];
+    if(i->op != OP_B) continue;
+    t = -1;
+    for(k = 0; k < lbl_n[i->rd]; k++)
+      if(i->lsr ? lbl_at[i->rd][k] > n && t < 0 : lbl_at[i->rd][k] <= n) t = lbl_at[i->rd][k];
+    if(t < 0 || t >= code_n) return err_at(i->line, "label not found");
+    i->imm = t;
+  }
+  return 0;
+}
+
+/* The string literals of the first __asm__ statement of a C source */
+int arm_load (const char *path)
+{
+  static char src[65536], body[16384];
+  char *s, *e, *b = body;
+  int line = 1;
+  FILE *f = fopen(path, "rb");
+  size_t n = f ? fread(src, 1, sizeof(src) - 1, f) : 0;
+  if(f) fclose(f);
+  src[n] = 0;
+  code_n = 0;
+  memset(lbl_n, 0, sizeof(lbl_n));
+  if(!(s = strstr(src, "__asm__")) || !(e = strstr(s, ");")))
+  {
+    printf("ARM: no __asm__ in %s\n", path);
+    return -1;
+  }
+  for(; s < e; s++)
+  {
+    if(*s == '/' && s[1] == '/') s = strchr(s, '\n');
+    if(*s != '"') continue;
+    for(s++; *s != '"' && b < body + sizeof(body) - 1; s++)
+      *b++ = *s == '\\' && s[1] == 'n' ? s++, '\n' : *s;
+  }
+  *b = 0;
+  for(s = body; *s; s = e + 1, line++)
+  {
+    e = strchr(s, '\n');
+    if(!e) e = s + strlen(s) - 1;
+    else *e = 0;
+    if(parse(s, line)) return -1;
+  }
+  return resolve() ? -1 : code_n;
+}
+
+static int cond_ok (struct ARM *c, int cond)
+{
+  switch(cond)
+  {
+    case 0: return c->z;
+    case 1: return !c->z;
+    case 2: return c->c;
+    case 3: return !c->c;
+    case 4: return c->n;
+    case 5: return !c->n;
+    case 6: return c->v;
+    case 7: return !c->v;
+    case 8: return c->c && !c->z;
+    case 9: return !c->c || c->z;
+    case 10: return c->n == c->v;
+    case 11: return c->n != c->v;
+    case 12: return !c->z && c->n == c->v;
+    case 13: return c->z || c->n != c->v;
+  }
+  return 1;
+}
+
+static void nz (struct ARM *c, u32 x)
+{
+  c->n = x >> 31;
+  c->z = !x;
+}
+
+/* Sum with the carry and overflow of the ALU: a - b is a + ~b + 1 */
+static u32 alu_add (struct ARM *c, u32 a, u32 b, u32 cin, int s)
+{
+  uint64_t x = (uint64_t)a + b + cin;
+  if(!s) return x;
+  nz(c, x);
+  c->c = x >> 32;
+  c->v = (~(a ^ b) & (a ^ (u32)x)) >> 31;
+  return x;
+}
+
+static int run_err (struct INSN *i, const char *str, u32 a)
+{
+  static u32 errors;
+  if(errors++ < 10) printf("ARM: line %d of the asm: %s %08X\n", i->line, str, a);
+  return -1;
+}
+
+int arm_call (struct ARM *c)
+{
+  u32 ready[16] = { 0 };      // cycle a register can be read at
+  u32 sh_c, b, a, x = 0;
+  int pc = 0, n;
+  struct INSN *i;
+  for(int steps = 0; steps < ARM_STEPS; steps++)
+  {
+    if(pc >= code_n) return run_err(&code[code_n - 1], "ran past the end", pc);
+    i = &code[pc++];
+    c->insns++;
+    if(!cond_ok(c, i->cond))
+    {
+      c->cycles++;
+      continue;
+    }
+    /* interlock on the registers read */
+    a = c->cycles;
+    if(i->op <= OP_TST && !i->imm_op && ready[i->rm] > a) a = ready[i->rm];
+    if(i->op != OP_MOV && i->op < OP_PUSH && ready[i->rn] > a) a = ready[i->rn];
+    if(i->op == OP_BX && ready[14] > a) a = ready[14];
+    c->cycles = a;
+    b = i->imm;
+    sh_c = b > 0xFF ? b >> 31 : c->c;       // a rotated immediate
+    if(i->op <= OP_TST && !i->imm_op && (b = c->r[i->rm], i->sh))
+    {
+      sh_c = i->lsr ? b >> (i->sh - 1) & 1 : b >> (32 - i->sh) & 1;
+      b = i->lsr ? b >> i->sh : b << i->sh;
+    }
+    a = c->r[i->rn];
+    switch(i->op)
+    {
+      case OP_MOV: x = b; break;
+      case OP_AND: case OP_TST: x = a & b; break;
+      case OP_ORR: x = a | b; break;
+      case OP_ADD: x = alu_add(c, a, b, 0, i->s); break;
+      case OP_ADC: x = alu_add(c, a, b, c->c, i->s); break;
+      case OP_SUB: case OP_CMP: x = alu_add(c, a, ~b, 1, i->s); break;
+      case OP_LDR: case OP_LDRH: case OP_LDRB:
+        n = i->op == OP_LDR ? 4 : i->op == OP_LDRH ? 2 : 1;
+        if(a & (n - 1)) return run_err(i, "unaligned load at", a);
+        if(c->hi && (a < c->lo || a + n > c->hi)) return run_err(i, "load outside the data at", a);
+        c->r[i->rd] = n == 4 ? *(u32*)(uintptr_t)a : n == 2 ? *(u16*)(uintptr_t)a : *(u8*)(uintptr_t)a;
+        if(i->wb) c->r[i->rn] = a + i->imm;
+        ready[i->rd] = c->cycles + (n == 4 ? 2 : 3);
+        c->cycles++;
+        continue;
+      case OP_LDM:
+      case OP_POP:
+        if(i->op == OP_POP) a = c->r[13];
+        if(a & 3) return run_err(i, "unaligned LDM at", a);
+        n = __builtin_popcount(i->list);
+        if(i->op == OP_LDM && c->hi && (a < c->lo || a + 4 * n > c->hi))
+          return run_err(i, "LDM outside the data at", a);
+        n = 0;
+        for(int r = 0; r < 16; r++)
+          if(i->list >> r & 1)
+          {
+            c->r[r] = *(u32*)(uintptr_t)(a + 4 * n++);
+            ready[r] = c->cycles + n + 1;
+          }
+        if(i->op == OP_POP) c->r[13] = a + 4 * n;
+        else if(i->wb) c->r[i->rn] = a + 4 * n;
+        c->cycles += n < 2 ? 2 : n;
+        continue;
+      case OP_PUSH:
+        n = __builtin_popcount(i->list);
+        a = c->r[13] - 4 * n;
+        if(a & 3) return run_err(i, "unaligned STM at", a);
+        c->r[13] = a;
+        for(int r = 0; r < 16; r++)
+          if(i->list >> r & 1) *(u32*)(uintptr_t)a = c->r[r], a += 4;
+        c->cycles += n < 2 ? 2 : n;
+        continue;
+      case OP_B:
+        pc = i->imm;
+        c->cycles += 3;
+        continue;
+      case OP_BX:
+        c->cycles += 3;
+        return 0;
+    }
+    if(i->op <= OP_ORR || i->op == OP_TST)
+    {
+      if(i->s) nz(c, x), c->c = sh_c;
+    }
+    if(i->op != OP_CMP && i->op != OP_TST) c->r[i->rd] = x;
+    c->cycles++;
+  }
+  return run_err(i, "no return after a million instructions at", pc);
+}
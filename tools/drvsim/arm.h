@@ -0,0 +1,25 @@
+#ifndef ARM_H
+#define ARM_H
+
+/* The ARM routines of the tree, run on the host: the __asm__ strings of a
+   naked function are read from its source and interpreted. Only the
+   instructions those routines use are known, anything else fails the load.
+   Memory is the host's, which the non-PIE build keeps below 4GB.
+
+   Cycles are counted with the ARM9EJ-S timing of the ARM926EJ-S, all
+   accesses hitting the caches: 1 per instruction or condition failed, 3 per
+   branch taken, 1 per register of LDM/STM (at least 2), the result of LDR one
+   cycle and of LDRB/LDRH two cycles behind, the last register of LDM one. */
+
+struct ARM {
+  u32 r[16];
+  u8  n, z, c, v;
+  u32 lo, hi;         // LDR and LDM outside fail, hi 0 - anywhere
+  u32 insns;          // executed, conditions failed included
+  u32 cycles;
+};
+
+int arm_load (const char *path);          // the routine, its instruction count or -1
+int arm_call (struct ARM *cpu);           // from r0.. until BX LR, 0 - returned
+
+#endif
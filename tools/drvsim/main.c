@@ -0,0 +1,1176 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sys.h"
+#include "reg.h"
+#include "sdc.h"
+#include "musb.h"
+#include "mscdev.h"
+#include "usbh_msc.h"
+#include "rtldev.h"
+#include "spinor.h"
+#include "usbh_net.h"
+#include "r8152.h"
+#include "arm.h"
+#include "lwip/init.h"
+#include "lwip/timeouts.h"
+#include "lwip/udp.h"
+#include "lwip/tcp.h"
+#include "netif/ethernet.h"
+
+u8 ip_addr[4] = { 192, 168, 1, 10 };
+u8 ip_mask[4] = { 255, 255, 255, 0 };
+u8 ip_gate[4] = { 192, 168, 1, 1 };
+u8 ip_mac[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x10 };
+
+static int fails;
+
+static void check (int ok, char *fmt, u32 a, u32 b)
+{
+  if(ok) return;
+  if(fails++ < 10)
+  {
+    printf("FAIL: ");
+    printf(fmt, a, b);
+    printf("\n");
+  }
+}
+
+static void print_time (char *str, uint64_t bytes, uint64_t ns)
+{
+  printf("%s: %llu bytes, modelled %llu.%03llums", str, (unsigned long long)bytes,
+    (unsigned long long)ns / 1000000, (unsigned long long)ns / 1000 % 1000);
+  if(ns) printf(" %.2fMB/s", (double)bytes * 1000 / ns);
+  printf("\n");
+}
+
+static void fill (u8 *ptr, u32 len)
+{
+  while(len--) *ptr++ = rand();
+}
+
+/*******************************************************************************
+                                  SD (drv/sd.c)
+*******************************************************************************/
+/* Aligned and unaligned buffers against block counts around the bounce
+   pool limit: the card has to hold what was written, reads must not touch the
+   bytes around the buffer, writes must leave the buffer as it was */
+static int cmd_sd (void)
+{
+  static const u32 cnt[] = { 1, 2, 4, 5, 9, 17 };
+  static u8 buf[32 * 512 + 64], ref[32 * 512 + 64];
+  u32 off, i, n, lba, len, bounce, acc[2];
+  uint64_t t;
+  u8 *card;
+  sdc_init();
+  sd_init();
+  if(!sd_card_detect() || sd_card_init() != SDC_BLKS)
+  {
+    puts("SD: no card");
+    return 1;
+  }
+  printf("SD: %u blocks, AU %u sectors\n", SDC_BLKS, sd_card_au());
+  check(sd_card_au() == SDC_AU, "AU %u, expected %u", sd_card_au(), SDC_AU);
+  card = sdc_mem();
+  for(off = 0; off < 5; off++)
+    for(i = 0; i < sizeof(cnt) / sizeof(cnt[0]); i++)
+    {
+      n = cnt[i];
+      len = n * 512;
+      lba = rand() % (SDC_BLKS - n);
+      memset(buf, 0x5A, sizeof(buf));
+      fill(buf + off, len);
+      memcpy(ref, buf, sizeof(buf));
+      bounce = sd_stat.bounce;
+      sd_write(buf + off, lba, n);
+      check(!memcmp(card + lba * 512, buf + off, len), "write offset %u, %u blocks: card differs", off, n);
+      check(!memcmp(buf, ref, sizeof(buf)), "write offset %u, %u blocks: buffer changed", off, n);
+      check(sd_stat.bounce - bounce == (!(off & 3) ? 0 : n <= 4 ? len : 4),
+        "write offset %u: %u bytes bounced", off, sd_stat.bounce - bounce);
+      memset(buf, 0xA5, sizeof(buf));
+      bounce = sd_stat.bounce;
+      sd_read(buf + off, lba, n);
+      check(!memcmp(card + lba * 512, buf + off, len), "read offset %u, %u blocks: data differs", off, n);
+      for(u32 j = 0; j < sizeof(buf); j++)
+        if(j < off || j >= off + len) check(buf[j] == 0xA5, "read offset %u: byte %u outside the buffer written", off, j);
+      check(sd_stat.bounce - bounce == (!(off & 3) ? 0 : n <= 4 ? len : 4),
+        "read offset %u: %u bytes bounced", off, sd_stat.bounce - bounce);
+    }
+  printf("SD: %u blocks written, %u read at offsets 0..4, %u bytes bounced or merged\n",
+    sd_stat.wr_blks, sd_stat.rd_blks, sd_stat.bounce);
+  printf("SD model: %u commands, %u blocks written, %u read, %u polls on an empty "
+    "FIFO, %u on a full one, %u protocol errors\n", sdc_stat.cmds, sdc_stat.wr_blks,
+    sdc_stat.rd_blks, sdc_stat.empty, sdc_stat.full, sdc_stat.errors);
+  check(sdc_stat.wr_blks == sd_stat.wr_blks && sdc_stat.rd_blks == sd_stat.rd_blks,
+    "%u blocks counted by the driver, %u by the card", sd_stat.wr_blks + sd_stat.rd_blks,
+    sdc_stat.wr_blks + sdc_stat.rd_blks);
+  check(!sdc_stat.errors, "%u protocol errors", sdc_stat.errors, 0);
+  for(off = 0; off < 2; off++)        // the merge costs no FIFO accesses
+  {
+    acc[off] = reg_acc;
+    t = sim_ns;
+    sd_read(buf + off, 0, 32);
+    print_time(off ? "Read 32 blocks, offset 1" : "Read 32 blocks, aligned", 32 * 512, sim_ns - t);
+    acc[off] = reg_acc - acc[off];
+  }
+  printf("Register accesses: %u aligned, %u at offset 1\n", acc[0], acc[1]);
+  return fails != 0;
+}
+
+/*******************************************************************************
+                           USB host (drv/usb/usbh*.c)
+*******************************************************************************/
+/* irq_handler of the applications, taken when the CPU waits */
+static void usb_irq (void)
+{
+  if(musb_irq()) usbh_isr();
+}
+
+/* usbh_init(), usbh_irq(1) and usbh_handler() until the class driver took the
+   device, as the applications do */
+static int usb_attach (const struct USB_DEV *dev)
+{
+  uint64_t t = sim_ns;
+  musb_init();
+  irq_hook = usb_irq;
+  usbh_init();
+  usbh_irq(1);
+  musb_attach(dev);
+  while(!dev_usb && sim_ns - t < 3000000000ULL) usbh_handler();
+  print_time("USB: attached", 0, sim_ns - t);
+  return dev_usb;
+}
+
+/* Share of the time the CPU sleeps in usbh_wait() */
+static void print_idle (char *str, uint64_t bytes, uint64_t ns, u32 wait)
+{
+  print_time(str, bytes, ns);
+  printf("  CPU idle %u%%, %u URBs, %u interrupts, %u bytes by DDMA0, %u by PIO\n",
+    ns ? (u32)(wait * 100000ULL / ns) : 0, usbh_stat.urbs, usbh_stat.irqs, usbh_stat.dma,
+    usbh_stat.pio);
+}
+
+#define MSC_BLKS  130                 // largest transfer checked
+
+static u8 mbuf[MSC_BLKS * 512 + 64] __attribute__((aligned(32)));
+
+/* Reads through the driver: the data has to be the reference, the bytes
+   around the buffer must stay */
+static void msc_read (u8 *ref, u32 off, u32 lba, u32 cnt)
+{
+  memset(mbuf, 0xA5, sizeof(mbuf));
+  check(usbh_msc_read(mbuf + off, lba, cnt) == cnt, "read of %u blocks at %u failed", cnt, lba);
+  check(!memcmp(mbuf + off, ref + lba * 512, cnt * 512), "read of %u blocks at %u differs", cnt, lba);
+  for(u32 j = 0; j < sizeof(mbuf); j++)
+    if(j < off || j >= off + cnt * 512) check(mbuf[j] == 0xA5, "read offset %u: byte %u outside the buffer written", off, j);
+}
+
+static void msc_write (u8 *ref, u32 off, u32 lba, u32 cnt)
+{
+  fill(mbuf + off, cnt * 512);
+  memcpy(ref + lba * 512, mbuf + off, cnt * 512);
+  check(usbh_msc_write(mbuf + off, lba, cnt) == cnt, "write of %u blocks at %u failed", cnt, lba);
+}
+
+/* Random reads and writes of random sizes at random offsets against a
+   reference image, then the medium against it */
+static void msc_random (u8 *ref, int ops)
+{
+  static const u32 cnt[] = { 1, 2, 3, 8, 63, 64, 65, MSC_BLKS };
+  u32 n, lba, off;
+  for(int i = 0; i < ops; i++)
+  {
+    n = cnt[rand() % (sizeof(cnt) / sizeof(cnt[0]))];
+    lba = rand() % (DISK_BLKS - n);
+    off = rand() % 4;
+    if(rand() & 1) msc_write(ref, off, lba, n);
+    else msc_read(ref, off, lba, n);
+  }
+  check(usbh_msc_sync() == OK, "sync failed", 0, 0);
+  for(u32 b = 0; b < DISK_BLKS; b++)
+    check(!memcmp(disk_mem() + b * 512, ref + b * 512, 512), "block %u of the medium differs", b, 0);
+}
+
+/* Sequential single blocks as FatFs reads and writes them: the read-ahead
+   window and the gathered writes have to cut them to a command per window.
+   The writes cover the window left by the reads, which must not be served
+   stale when its blocks are read again */
+static void msc_small (u8 *ref)
+{
+  struct MSC_STAT s = msc_stat;
+  u32 i, rd, wr;
+  for(i = 0; i < 256; i++) msc_read(ref, 0, 12288 + i, 1);
+  rd = msc_stat.cmds - s.cmds;
+  check(rd <= 1 + 256 / 64, "%u commands for 256 sequential 1-block reads", rd, 0);
+  for(i = 0; i < 256; i++) msc_write(ref, 0, 12416 + i, 1);
+  check(usbh_msc_sync() == OK, "sync failed", 0, 0);
+  wr = msc_stat.cmds - s.cmds - rd;
+  check(wr == 256 / 64, "%u commands for 256 sequential 1-block writes", wr, 0);
+  check(!memcmp(disk_mem() + 12416 * 512, ref + 12416 * 512, 256 * 512), "gathered writes differ on the medium", 0, 0);
+  for(i = 256; i-- > 192; ) msc_read(ref, 0, 12288 + i, 1);
+  printf("MSC: 256 1-block reads in %u commands, %u blocks from the read-ahead window; "
+    "256 1-block writes in %u commands, %u blocks gathered\n", rd, msc_stat.ra - s.ra, wr, msc_stat.wc - s.wc);
+}
+
+/* A READ(10) and a WRITE(10) failing once: the driver resets the device,
+   asks for the sense and repeats the command, the data toggles start again
+   from DATA0 on both sides */
+static void msc_fail (u8 *ref)
+{
+  struct DISK_STAT s = disk_stat;
+  disk_fail();
+  msc_read(ref, 1, 20000, 8);
+  disk_fail();
+  msc_write(ref, 1, 20100, 100);
+  check(usbh_msc_sync() == OK, "sync failed", 0, 0);
+  check(!memcmp(disk_mem() + 20100 * 512, ref + 20100 * 512, 100 * 512), "write retried after a failure differs", 0, 0);
+  printf("MSC: 2 failed commands, %u resets, %u REQUEST SENSE\n", disk_stat.resets - s.resets,
+    disk_stat.sense - s.sense);
+  check(disk_stat.resets - s.resets == 2 && disk_stat.sense - s.sense == 2,
+    "failed commands: %u resets, %u REQUEST SENSE", disk_stat.resets - s.resets, disk_stat.sense - s.sense);
+}
+
+/* 16 x 64KB read and written from a buffer at off: the modelled MB/s and
+   the share the CPU sleeps; aligned runs have to go by DDMA0 if it is on */
+static void msc_speed (u8 *ref, char *str, u32 off, int dma)
+{
+  char s[64];
+  uint64_t t;
+  usbh_msc_dma(dma);
+  for(int wr = 0; wr < 2; wr++)
+  {
+    memset(&usbh_stat, 0, sizeof(usbh_stat));
+    t = sim_ns;
+    for(u32 i = 0; i < 16; i++)
+      if(wr) msc_write(ref, off, 8192 + i * 128, 128);
+      else msc_read(ref, off, 4096 + i * 128, 128);
+    sprintf(s, "MSC: %s 16 x 64KB %s", wr ? "write" : "read", str);
+    print_idle(s, 16 * 65536, sim_ns - t, usbh_stat.wait);
+    check(usbh_stat.dma == (dma && !(off & 3) ? 16 * 65536 : 0),
+      wr ? "64KB writes at offset %u: %u bytes by DDMA0" : "64KB reads at offset %u: %u bytes by DDMA0",
+      off, usbh_stat.dma);
+  }
+}
+
+static int cmd_msc (void)
+{
+  static u8 ref[DISK_BLKS * 512];
+  u32 naks, resets, runs;
+  fill(disk_mem(), DISK_BLKS * 512);
+  memcpy(ref, disk_mem(), sizeof(ref));
+  if(usb_attach(&disk_dev) != 1)
+  {
+    puts("MSC: no disk");
+    return 1;
+  }
+  for(int dma = 1; dma >= 0; dma--)
+  {
+    memset(&usbh_stat, 0, sizeof(usbh_stat));
+    usbh_msc_dma(dma);
+    msc_random(ref, 100);
+    printf("MSC %s: %u URBs, %u NAK limits, %u bytes by DDMA0, %u by PIO\n", dma ? "DMA" : "PIO",
+      usbh_stat.urbs, usbh_stat.naks, usbh_stat.dma, usbh_stat.pio);
+    check(!dma == !usbh_stat.dma, "%u bytes by DDMA0, DMA enabled %u", usbh_stat.dma, dma);
+  }
+  /* A data phase held past the NAK limit is asked for again */
+  naks = usbh_stat.naks;
+  disk_hold(300000000);
+  msc_read(ref, 0, 1000, 8);
+  check(usbh_stat.naks > naks, "NAK limit not retried (%u)", usbh_stat.naks - naks, 0);
+  msc_small(ref);
+  msc_fail(ref);
+  msc_speed(ref, "by DDMA0", 0, 1);
+  msc_speed(ref, "by PIO", 0, 0);
+  msc_speed(ref, "at offset 1", 1, 1);
+  /* Last, DMA stays off after it: DDMA0 without its DMA requests. The run
+     times out with a packet in the FIFO, the command is retried after a
+     reset and the driver goes on by PIO */
+  memset(&usbh_stat, 0, sizeof(usbh_stat));
+  resets = disk_stat.resets;
+  runs = musb_stat.dma_runs;
+  musb_dma_stall(1);
+  usbh_msc_dma(1);
+  msc_read(ref, 0, 2048, 64);
+  msc_write(ref, 0, 2048, 64);
+  usbh_msc_sync();
+  check(!memcmp(disk_mem() + 2048 * 512, ref + 2048 * 512, 64 * 512), "write after the DMA stall differs", 0, 0);
+  printf("MSC DMA stall: %u DDMA0 runs, %u resets, %u bytes by DDMA0, %u by PIO\n",
+    musb_stat.dma_runs - runs, disk_stat.resets - resets, usbh_stat.dma, usbh_stat.pio);
+  check(musb_stat.dma_runs - runs == 1 && disk_stat.resets > resets && usbh_stat.pio >= 2 * 64 * 512,
+    "no PIO fallback after the DMA stall (%u runs, %u resets)", musb_stat.dma_runs - runs, disk_stat.resets - resets);
+  musb_dma_stall(0);
+  printf("USB model: %u SETUPs, %u packets, %u NAKs, %u NAK limits, %u STALLs, "
+    "%u DDMA0 runs, %u bytes, %u protocol errors\n", musb_stat.setups, musb_stat.pkts,
+    musb_stat.naks, musb_stat.nakto, musb_stat.stalls, musb_stat.dma_runs, musb_stat.dma_bytes,
+    musb_stat.errors);
+  printf("MSC: %u commands, %u bytes per command, %u blocks read ahead, %u gathered\n",
+    msc_stat.cmds, msc_stat.data / msc_stat.cmds, msc_stat.ra, msc_stat.wc);
+  printf("MSC device: %u commands, %u blocks read, %u written, %u resets, "
+    "%u protocol errors\n", disk_stat.cmds, disk_stat.rd_blks, disk_stat.wr_blks,
+    disk_stat.resets, disk_stat.errors);
+  check(!musb_stat.errors && !disk_stat.errors, "%u protocol errors on the bus, %u by the device",
+    musb_stat.errors, disk_stat.errors);
+  return fails != 0;
+}
+
+/*******************************************************************************
+                     USB Ethernet (drv/usb/usbh_net.c, r8152.c)
+*******************************************************************************/
+extern struct netif netif;
+extern u32 lan_con;
+
+/* The other end of the cable answers ARP for its address and counts what the
+   board sends */
+static const u8 peer_mac[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 };
+static const u8 peer_ip[4] = { 192, 168, 1, 2 };
+
+static struct {
+  u32 arp;          // ARP requests answered
+  u32 echo;         // echo replies
+  u32 rst;          // TCP RSTs
+  u32 synack;       // SYN-ACKs, answered by a RST
+  u32 udp;          // UDP datagrams
+  u32 bytes;        // their payload
+  u32 bad;          // payloads that differ from udp_data()
+} peer;
+
+static u16 ip_id, icmp_seq;
+
+static u32 be16 (const u8 *p)
+{
+  return p[0] << 8 | p[1];
+}
+
+static void put16 (u8 *p, u32 v)
+{
+  p[0] = v >> 8;
+  p[1] = v;
+}
+
+/* One's complement sum of big-endian halfwords, not complemented */
+static u32 sum16 (const u8 *p, u32 n, u32 sum)
+{
+  for(; n > 1; p += 2, n -= 2) sum += be16(p);
+  if(n) sum += p[0] << 8;
+  while(sum >> 16) sum = (sum & 0xFFFF) + (sum >> 16);
+  return sum;
+}
+
+/* Ethernet and IPv4 header of a datagram of len bytes from the peer */
+static u32 ip_frame (u8 *f, u8 proto, u32 len)
+{
+  memcpy(f, ip_mac, 6);
+  memcpy(f + 6, peer_mac, 6);
+  put16(f + 12, 0x0800);
+  f[14] = 0x45;
+  f[15] = 0;
+  put16(f + 16, 20 + len);
+  put16(f + 18, ++ip_id);
+  put16(f + 20, 0);
+  f[22] = 64;
+  f[23] = proto;
+  put16(f + 24, 0);
+  memcpy(f + 26, peer_ip, 4);
+  memcpy(f + 30, ip_addr, 4);
+  put16(f + 24, ~sum16(f + 14, 20, 0));
+  return 34 + len;
+}
+
+/* TCP or UDP checksum at off in the segment, with the pseudo header */
+static void l4_csum (u8 *f, u32 off)
+{
+  u32 len = be16(f + 16) - 20;
+  put16(f + 34 + off, 0);
+  put16(f + 34 + off, ~sum16(f + 34, len, sum16(f + 26, 8, f[23] + len)));
+}
+
+/* Echo request with len bytes of data */
+static u32 ping (u8 *f, u32 len)
+{
+  u8 *p = f + 34;
+  u32 n = ip_frame(f, 1, 8 + len);
+  p[0] = 8;
+  p[1] = 0;
+  put16(p + 2, 0);
+  put16(p + 4, 0x1234);
+  put16(p + 6, ++icmp_seq);
+  fill(p + 8, len);
+  put16(p + 2, ~sum16(p, 8 + len, 0));
+  return n;
+}
+
+/* UDP datagram with len bytes of data to port */
+static u32 udp (u8 *f, u16 port, u32 len)
+{
+  u8 *p = f + 34;
+  u32 n = ip_frame(f, 17, 8 + len);
+  put16(p, 40000);
+  put16(p + 2, port);
+  put16(p + 4, 8 + len);
+  fill(p + 8, len);
+  l4_csum(f, 6);
+  return n;
+}
+
+/* TCP segment without data from port 40000 */
+static u32 tcp_seg (u8 *f, u16 port, u32 seq, u8 flags)
+{
+  u8 *p = f + 34;
+  u32 n = ip_frame(f, 6, 20);
+  memset(p, 0, 20);
+  put16(p, 40000);
+  put16(p + 2, port);
+  put16(p + 4, seq >> 16);
+  put16(p + 6, seq);
+  p[12] = 0x50;
+  p[13] = flags;
+  put16(p + 14, 8192);
+  l4_csum(f, 16);
+  return n;
+}
+
+/* Payload of the datagrams the board sends, from their length */
+static void udp_data (u8 *p, u32 len)
+{
+  for(u32 i = 0; i < len; i++) p[i] = len + i * 7;
+}
+
+static int udp_check (const u8 *p, u32 len)
+{
+  for(u32 i = 0; i < len; i++) if(p[i] != (u8)(len + i * 7)) return 0;
+  return 1;
+}
+
+/* Frames the board sent: ARP requests for the peer are answered */
+static void peer_poll (void)
+{
+  u8 f[1536], r[60];
+  u32 n;
+  while((n = rtl_tx(f)) != 0)
+  {
+    if(be16(f + 12) == 0x0806)
+    {
+      if(be16(f + 20) != 1 || memcmp(f + 38, peer_ip, 4)) continue;
+      memset(r, 0, sizeof(r));
+      memcpy(r, f + 6, 6);
+      memcpy(r + 6, peer_mac, 6);
+      memcpy(r + 12, f + 12, 8);
+      put16(r + 20, 2);
+      memcpy(r + 22, peer_mac, 6);
+      memcpy(r + 28, peer_ip, 4);
+      memcpy(r + 32, f + 22, 10);
+      rtl_rx(r, sizeof(r), 0);
+      peer.arp++;
+    }
+    else if(be16(f + 12) != 0x0800 || memcmp(f + 30, peer_ip, 4)) continue;
+    else if(f[23] == 1 && f[34] == 0) peer.echo++;
+    else if(f[23] == 6 && f[34 + 13] & 4) peer.rst++;
+    else if(f[23] == 6 && (f[34 + 13] & 0x12) == 0x12)
+    {
+      peer.synack++;
+      rtl_rx(r, tcp_seg(r, be16(f + 34), be16(f + 42) << 16 | be16(f + 44), 4), 0);
+    }
+    else if(f[23] == 17)
+    {
+      peer.udp++;
+      peer.bytes += be16(f + 38) - 8;
+      if(n < 42 + be16(f + 38) - 8 || !udp_check(f + 42, be16(f + 38) - 8)) peer.bad++;
+    }
+  }
+}
+
+/* A pass of the main loop of the applications, the USB interrupt is taken
+   between passes */
+static void net_pass (void)
+{
+  usbh_handler();
+  sys_check_timeouts();
+  usb_irq();
+  peer_poll();
+}
+
+static void net_run (u32 ms)
+{
+  uint64_t t = sim_ns + ms * 1000000ULL;
+  while(sim_ns < t) net_pass();
+}
+
+/* Frames handed to lwIP: in place or copied. An application queue keeps
+   the first hold of them instead of passing them on */
+static struct {
+  u32 inplace, copied;
+  u32 hold, held;
+  struct pbuf *p[128];
+} rxin;
+
+static err_t net_input (struct pbuf *p, struct netif *inp)
+{
+  if(p->flags & PBUF_FLAG_IS_CUSTOM) rxin.inplace++;
+  else rxin.copied++;
+  if(rxin.held < rxin.hold)
+  {
+    rxin.p[rxin.held++] = p;
+    return ERR_OK;
+  }
+  return ethernet_input(p, inp);
+}
+
+static u32 udp_rcvd;
+
+static void udp_rcv (void *arg, struct udp_pcb *pcb, struct pbuf *p, const ip_addr_t *addr, u16_t port)
+{
+  udp_rcvd += p->tot_len;
+  pbuf_free(p);
+}
+
+/* Echo requests of random sizes queued on the wire at once: the number of
+   replies */
+static u32 net_ping (u32 n, u32 max, int flags)
+{
+  u8 f[1536];
+  u32 echo = peer.echo;
+  for(u32 i = 0; i < n; i++) rtl_rx(f, ping(f, 18 + rand() % (max - 17)), flags);
+  net_run(20 + n / 4);
+  return peer.echo - echo;
+}
+
+/* The RX parser: frames aggregated by the device are split, lent in place
+   or copied, frames with a CRC error and one cut by the end of its transfer
+   are dropped, the frames ahead of it delivered. Frames lwIP holds must not
+   starve the endpoint */
+static void net_rx (void)
+{
+  struct NET_STAT s = net_stat;
+  struct RTL_STAT r = rtl_stat;
+  u32 n, i, len;
+  uint64_t t;
+  u8 f[1536];
+  n = net_ping(1, 1472, 0);
+  check(n == 1 && peer.arp == 1, "first echo request: %u replies, %u ARP requests", n, peer.arp);
+  for(i = 0; i < 40; i++)
+  {
+    n = net_ping(1, 1472, 0);
+    check(n == 1, "echo request %u: %u replies", i, n);
+  }
+  n = net_ping(200, 1472, 0);
+  check(n == 200, "%u of 200 echo requests of 18 to 1472 bytes answered", n, 0);
+  n = net_ping(100, 64, 0);
+  check(n == 100, "%u of 100 small echo requests answered", n, 0);
+  printf("NET RX: %u frames in %u transfers, %u in place, %u copied\n", rtl_stat.rx_frames - r.rx_frames,
+    rtl_stat.rx_xfers - r.rx_xfers, rxin.inplace, rxin.copied);
+  check(rtl_stat.rx_xfers - r.rx_xfers < (rtl_stat.rx_frames - r.rx_frames) / 2, "%u frames in %u transfers, not aggregated",
+    rtl_stat.rx_frames - r.rx_frames, rtl_stat.rx_xfers - r.rx_xfers);
+  check(!rxin.copied, "%u frames copied with every buffer queued", rxin.copied, 0);
+  check(net_stat.rx_csum - s.rx_csum == rtl_stat.rx_frames - r.rx_frames - peer.arp,
+    "%u of %u IPv4 frames verified by the device", net_stat.rx_csum - s.rx_csum, rtl_stat.rx_frames - r.rx_frames - peer.arp);
+  /* CRC errors, then a transfer cut inside its last frame */
+  s = net_stat;
+  n = net_ping(8, 1472, RTL_RX_CRC);
+  check(!n && net_stat.rx_drop - s.rx_drop == 8, "8 frames with CRC errors: %u replies, %u dropped", n, net_stat.rx_drop - s.rx_drop);
+  r = rtl_stat;
+  rtl_rx_cut();
+  n = net_ping(16, 64, 0);
+  check(n == 15, "transfer cut inside its last frame: %u of 16 echo requests answered", n, 0);
+  check(rtl_stat.rx_xfers - r.rx_xfers == 1, "16 small frames in %u transfers", rtl_stat.rx_xfers - r.rx_xfers, 0);
+  /* lwIP holding more frames than are lent: the rest is copied, the
+     endpoint keeps going and the buffers come back when they are freed */
+  rxin.inplace = rxin.copied = 0;
+  rxin.held = 0;
+  rxin.hold = 32;
+  n = net_ping(200, 1472, 0);
+  check(n == 168, "%u of 168 echo requests answered with 32 frames held", n, 0);
+  printf("NET RX: 32 frames held, %u in place, %u copied\n", rxin.inplace, rxin.copied);
+  check(rxin.copied && rxin.inplace, "frames held: %u in place, %u copied", rxin.inplace, rxin.copied);
+  for(i = 0; i < rxin.held; i++) pbuf_free(rxin.p[i]);
+  rxin.inplace = rxin.copied = rxin.held = rxin.hold = 0;
+  n = net_ping(100, 1472, 0);
+  check(n == 100 && !rxin.copied, "frames released: %u of 100 answered, %u copied", n, rxin.copied);
+  /* UDP at the wire rate, no more than 128 frames ahead of the board */
+  udp_rcvd = 0;
+  len = 1000 * 1472;
+  t = sim_ns;
+  for(i = 0; i < 1000; )
+    if(i - udp_rcvd / 1472 < 128) rtl_rx(f, udp(f, 9, 1472), 0), i++;
+    else net_pass();
+  while(udp_rcvd < len && sim_ns - t < 1000000000) net_pass();
+  print_time("NET RX: 1000 UDP datagrams", udp_rcvd, sim_ns - t);
+  check(udp_rcvd == len, "%u of %u UDP bytes received", udp_rcvd, len);
+}
+
+/* A datagram in pieces of 1 to 300 bytes at odd and even addresses, which
+   the TX path gathers at the FIFO */
+static struct pbuf *udp_chain (u32 len)
+{
+  static u8 d[1472];
+  struct pbuf *p = NULL, *q;
+  u32 n, off;
+  udp_data(d, len);
+  for(u32 i = 0; i < len; i += n)
+  {
+    n = 1 + rand() % 300;
+    if(n > len - i) n = len - i;
+    off = rand() % 4;
+    q = pbuf_alloc(PBUF_RAW, n + off, PBUF_RAM);
+    pbuf_remove_header(q, off);
+    memcpy(q->payload, d + i, n);
+    if(p) pbuf_cat(p, q);
+    else p = q;
+  }
+  return p;
+}
+
+/* n datagrams of min to max bytes sent by the board as fast as lwIP takes
+   them, ERR_MEM is retried after a pass of the main loop */
+static void udp_burst (char *str, u32 n, u32 min, u32 max, int split)
+{
+  struct NET_STAT s = net_stat;
+  struct udp_pcb *pcb = udp_new();
+  struct pbuf *p;
+  ip_addr_t dst;
+  u32 i, len, bytes = 0, udp = peer.udp;
+  uint64_t t = sim_ns;
+  err_t e;
+  IP_ADDR4(&dst, peer_ip[0], peer_ip[1], peer_ip[2], peer_ip[3]);
+  for(i = 0; i < n; i++)
+  {
+    len = min + rand() % (max - min + 1);
+    for(e = ERR_MEM; e == ERR_MEM; pbuf_free(p))    // the headers stay on a pbuf refused
+    {
+      if(e != ERR_OK) net_pass();
+      if(split) p = udp_chain(len);
+      else udp_data((p = pbuf_alloc(PBUF_TRANSPORT, len, PBUF_RAM))->payload, len);
+      e = udp_sendto(pcb, p, &dst, 9);
+    }
+    check(e == ERR_OK, "udp_sendto() error %u", -e, 0);
+    bytes += len;
+  }
+  while(peer.udp - udp < n && sim_ns - t < 1000000000) net_pass();
+  udp_remove(pcb);
+  print_time(str, bytes, sim_ns - t);
+  printf("  %u frames in %u transfers, %u refused\n", net_stat.tx_frames - s.tx_frames,
+    net_stat.tx_urbs - s.tx_urbs, net_stat.tx_drop - s.tx_drop);
+  check(peer.udp - udp == n, "%u of %u datagrams on the wire", peer.udp - udp, n);
+  check(net_stat.tx_urbs - s.tx_urbs < (net_stat.tx_frames - s.tx_frames) / 2,
+    "%u frames in %u transfers, not aggregated", net_stat.tx_frames - s.tx_frames, net_stat.tx_urbs - s.tx_urbs);
+  check(net_stat.tx_drop > s.tx_drop, "no ERR_MEM with every buffer on the bus", 0, 0);
+}
+
+/* The TX framing: tx_desc records in aggregated bulk OUT transfers have to
+   carry every datagram intact, the device NAKs while its FIFO is full */
+static void net_tx (void)
+{
+  u32 bad = peer.bad, errors = rtl_stat.errors;
+  udp_burst("NET TX: 2000 UDP datagrams of 1 to 1472 bytes", 2000, 1, 1472, 0);
+  udp_burst("NET TX: 1000 UDP datagrams of 1472 bytes", 1000, 1472, 1472, 0);
+  udp_burst("NET TX: 1000 UDP datagrams of 1 to 1472 bytes in pieces", 1000, 1, 1472, 1);
+  check(peer.bad == bad, "%u datagrams differ on the wire", peer.bad - bad, 0);
+  check(rtl_stat.errors == errors, "%u framing errors", rtl_stat.errors - errors, 0);
+}
+
+/* Frames from the peer, a reply to each is expected when good */
+static u32 net_csum_rx (char *str, u32 (*frame)(u8 *f), u32 cs, int flags, u32 *cnt)
+{
+  struct NET_STAT s = net_stat;
+  u32 n = *cnt;
+  u8 f[1536];
+  for(u32 i = 0; i < 8; i++)
+  {
+    u32 len = frame(f);
+    if(cs) f[cs] ^= 0x5A;
+    rtl_rx(f, len, flags);
+  }
+  net_run(20);
+  printf("NET RX %s: %u answered, %u verified by the device, %u dropped by it\n", str, *cnt - n,
+    net_stat.rx_csum - s.rx_csum, net_stat.rx_drop - s.rx_drop);
+  check(*cnt - n == (cs ? 0 : 8), "%u of 8 frames answered", *cnt - n, 0);
+  check(net_stat.rx_csum - s.rx_csum == (flags & RTL_RX_NOCS || cs ? 0 : 8),
+    "%u of 8 frames verified by the device", net_stat.rx_csum - s.rx_csum, 0);
+  check(net_stat.rx_drop - s.rx_drop == (flags & RTL_RX_NOCS || !cs ? 0 : 8),
+    "%u of 8 frames dropped by the driver", net_stat.rx_drop - s.rx_drop, 0);
+  return *cnt - n;
+}
+
+static u32 csum_ping (u8 *f)
+{
+  return ping(f, 100);
+}
+
+static u32 csum_syn (u8 *f)
+{
+  return tcp_seg(f, 7, rand(), 2);
+}
+
+static u32 csum_udp (u8 *f)
+{
+  return udp(f, 9, 1);
+}
+
+/* The checksums: the device fills the TCP and IPv4 header checksums of the
+   segments lwIP sends and is checked on the wire; its RX results decide
+   which frames are dropped by the driver and which lwIP checks again */
+static void net_csum (void)
+{
+  struct NET_STAT s = net_stat;
+  struct RTL_STAT r = rtl_stat;
+  struct tcp_pcb *pcb = tcp_new();
+  u32 rst = peer.rst, synack = peer.synack, i;
+  u8 f[64];
+  tcp_bind(pcb, IP_ADDR_ANY, 80);
+  pcb = tcp_listen(pcb);
+  for(i = 0; i < 20; i++) rtl_rx(f, tcp_seg(f, 7, rand(), 2), 0);   // closed port
+  rtl_rx(f, tcp_seg(f, 80, rand(), 2), 0);
+  net_run(20);
+  printf("NET TX: %u RSTs, %u SYN-ACKs, %u TCP checksums by the device, %u inserted by it\n",
+    peer.rst - rst, peer.synack - synack, net_stat.tx_csum - s.tx_csum, rtl_stat.tx_csum - r.tx_csum);
+  check(peer.rst - rst == 20 && peer.synack - synack == 1, "%u RSTs, %u SYN-ACKs", peer.rst - rst, peer.synack - synack);
+  check(net_stat.tx_csum - s.tx_csum == 21 && rtl_stat.tx_csum - r.tx_csum == 42,
+    "%u TCP segments offloaded, %u checksums inserted", net_stat.tx_csum - s.tx_csum, rtl_stat.tx_csum - r.tx_csum);
+  tcp_close(pcb);
+  /* Good frames verified by the device, then broken IPv4, ICMP, TCP and UDP
+     checksums. Without its results lwIP has to check them */
+  net_csum_rx("echo", csum_ping, 0, 0, &peer.echo);
+  net_csum_rx("echo, IPv4 header broken", csum_ping, 24, 0, &peer.echo);
+  net_csum_rx("SYN, TCP checksum broken", csum_syn, 34 + 16, 0, &peer.rst);
+  net_csum_rx("UDP, checksum broken", csum_udp, 34 + 6, 0, &udp_rcvd);
+  net_csum_rx("echo, not verified", csum_ping, 0, RTL_RX_NOCS, &peer.echo);
+  net_csum_rx("echo, ICMP checksum broken, not verified", csum_ping, 34 + 2, RTL_RX_NOCS, &peer.echo);
+  net_csum_rx("echo, IPv4 header broken, not verified", csum_ping, 24, RTL_RX_NOCS, &peer.echo);
+  net_csum_rx("SYN, TCP checksum broken, not verified", csum_syn, 34 + 16, RTL_RX_NOCS, &peer.rst);
+  udp_rcvd = 0;
+  net_csum_rx("UDP", csum_udp, 0, 0, &udp_rcvd);
+}
+
+/* Modelled time until the driver sees the link on or off, at most ms */
+static uint64_t net_link (u32 on, u32 ms)
+{
+  uint64_t t = sim_ns;
+  while(lan_con != on && sim_ns - t < ms * 1000000ULL) net_pass();
+  return sim_ns - t;
+}
+
+/* The link state: reported by the interrupt endpoint with no control
+   transfers while it does not change, read by a control transfer once per
+   change; with the endpoint STALLing the PHY is read every 100mS */
+static void net_lan (void)
+{
+  struct NET_STAT s = net_stat;
+  u32 setups = musb_stat.setups, ints = rtl_stat.ints, n;
+  uint64_t t;
+  net_run(2000);
+  printf("NET: 2S idle, %u SETUPs, %u PHY reads\n", musb_stat.setups - setups, net_stat.phy - s.phy);
+  check(musb_stat.setups == setups, "%u SETUPs in 2S idle", musb_stat.setups - setups, 0);
+  for(int i = 0; i < 3; i++)
+  {
+    s = net_stat;
+    rtl_link(0);
+    t = net_link(0, 100);
+    print_time("NET: link down seen", 0, t);
+    check(!lan_con && net_stat.phy - s.phy == 1, "link down: connected %u, %u PHY reads", lan_con, net_stat.phy - s.phy);
+    n = net_ping(4, 64, 0);
+    check(!n, "%u echo requests answered without a link", n, 0);
+    rtl_link(1);
+    t = net_link(1, 100);
+    net_ping(1, 64, 0);               // ARP, the table went with the netif
+    print_time("NET: link up seen", 0, t);
+    check(lan_con && net_stat.phy - s.phy == 2, "link up: connected %u, %u PHY reads", lan_con, net_stat.phy - s.phy);
+    n = net_ping(16, 1472, 0);
+    check(n == 16, "%u of 16 echo requests answered after the link came back", n, 0);
+  }
+  check(rtl_stat.ints - ints == 6, "%u link reports for 6 changes", rtl_stat.ints - ints, 0);
+  /* The interrupt endpoint fails: polled every 100mS */
+  rtl_int_stall(1);
+  net_run(100);
+  s = net_stat;
+  net_run(1000);
+  printf("NET: interrupt endpoint STALLed, %u PHY reads in 1S\n", net_stat.phy - s.phy);
+  check(net_stat.phy - s.phy >= 9 && net_stat.phy - s.phy <= 11, "%u PHY reads in 1S of polling", net_stat.phy - s.phy, 0);
+  rtl_link(0);
+  t = net_link(0, 300);
+  print_time("NET: link down seen by polling", 0, t);
+  check(!lan_con && t <= 110000000, "link down by polling: connected %u after %uuS", lan_con, t / 1000);
+  rtl_link(1);
+  t = net_link(1, 300);
+  check(lan_con && t <= 110000000, "link up by polling: connected %u after %uuS", lan_con, t / 1000);
+  net_ping(1, 64, 0);
+  n = net_ping(16, 1472, 0);
+  check(n == 16, "%u of 16 echo requests answered after polling", n, 0);
+}
+
+static int cmd_net (void)
+{
+  struct udp_pcb *pcb;
+  rtl_init();
+  rtl_link(1);
+  lwip_init();
+  if(usb_attach(&rtl_dev) != 2)
+  {
+    puts("NET: no RTL8152");
+    return 1;
+  }
+  printf("NET: probed in %u OCP transfers\n", rtl_stat.ctrl);
+  net_run(50);
+  check(lan_con, "no link after the attach", 0, 0);
+  if(!lan_con) return 1;
+  netif.input = net_input;
+  pcb = udp_new();
+  udp_bind(pcb, IP_ADDR_ANY, 9);
+  udp_recv(pcb, udp_rcv, NULL);
+  net_rx();
+  net_tx();
+  net_csum();
+  net_lan();
+  printf("NET: %u frames sent in %u transfers, %u refused, %u TCP checksums by the device, "
+    "%u frames verified by it, %u dropped, %u PHY reads\n", net_stat.tx_frames, net_stat.tx_urbs,
+    net_stat.tx_drop, net_stat.tx_csum, net_stat.rx_csum, net_stat.rx_drop, net_stat.phy);
+  printf("USB model: %u SETUPs, %u packets, %u NAKs, %u NAK limits, %u STALLs, %u protocol errors\n",
+    musb_stat.setups, musb_stat.pkts, musb_stat.naks, musb_stat.nakto, musb_stat.stalls, musb_stat.errors);
+  printf("RTL8152 model: %u OCP transfers, %u frames received in %u transfers, %u filtered, "
+    "%u sent, %u checksums inserted, %u link reports, %u protocol errors\n", rtl_stat.ctrl,
+    rtl_stat.rx_frames, rtl_stat.rx_xfers, rtl_stat.rx_filter, rtl_stat.tx_frames, rtl_stat.tx_csum,
+    rtl_stat.ints, rtl_stat.errors);
+  check(!musb_stat.errors && !rtl_stat.errors, "%u protocol errors on the bus, %u by the device",
+    musb_stat.errors, rtl_stat.errors);
+  return fails != 0;
+}
+
+/*******************************************************************************
+                     OCP access (drv/usb/r8152.c, r8152_fw.c)
+*******************************************************************************/
+extern struct r8152 tp;
+
+static u8 ocp_ref[0x10000];
+
+/* A pattern in an OCP space and the reference, the PLA bits a write acts
+   on cleared */
+static void ocp_fill (u16 type)
+{
+  u8 *m = rtl_ocp(type);
+  fill(m, 0x10000);
+  if(type == MCU_TYPE_PLA)
+  {
+    m[PLA_CR] = 0;
+    m[PLA_SFF_STS_7 + 1] &= ~(RE_INIT_LL >> 8);
+  }
+  memcpy(ocp_ref, m, 0x10000);
+}
+
+static void ocp_set (const u16 *tbl, int n)
+{
+  for(int i = 0; i < n; i += 2)
+  {
+    ocp_ref[tbl[i]] = tbl[i + 1];
+    ocp_ref[tbl[i] + 1] = tbl[i + 1] >> 8;
+  }
+}
+
+/* A table by ocp_write_words() and word by word by ocp_write_word(): the
+   OCP space has to end up as the table says both ways. The transfers */
+static u32 ocp_table (u16 type, const u16 *tbl, int n, u32 *words)
+{
+  u32 x;
+  ocp_fill(type);
+  ocp_set(tbl, n);
+  x = rtl_stat.ctrl;
+  ocp_write_words(&tp, type, tbl, n);
+  x = rtl_stat.ctrl - x;
+  check(!memcmp(rtl_ocp(type), ocp_ref, 0x10000), "%u pairs by ocp_write_words(): OCP space differs", n / 2, 0);
+  ocp_fill(type);
+  ocp_set(tbl, n);
+  *words = rtl_stat.ctrl;
+  for(int i = 0; i < n; i += 2) ocp_write_word(&tp, type, tbl[i], tbl[i + 1]);
+  *words = rtl_stat.ctrl - *words;
+  check(!memcmp(rtl_ocp(type), ocp_ref, 0x10000), "%u pairs word by word: OCP space differs", n / 2, 0);
+  check(x <= *words, "%u transfers merged, %u word by word", x, *words);
+  return x;
+}
+
+/* Runs of 1 to 48 consecutive words at odd and even word addresses */
+static void ocp_random (void)
+{
+  static u16 tbl[512];
+  u32 x = 0, words = 0, w;
+  u16 a;
+  int n;
+  for(int k = 0; k < 50; k++)
+  {
+    for(n = 0; n < 400; )
+    {
+      a = (0x1000 + rand() % 0xE000) & ~1;
+      for(int i = 1 + rand() % 48; i-- && n < 400; a += 2, n += 2)
+      {
+        tbl[n] = a;
+        tbl[n + 1] = rand();
+      }
+    }
+    x += ocp_table(MCU_TYPE_USB, tbl, n, &w);
+    words += w;
+  }
+  printf("OCP: 50 random tables of 200 words, %u transfers merged, %u word by word\n", x, words);
+}
+
+/* generic_ocp_write() with every first and last byte enable: the bytes
+   enabled have to be written, the others kept. Bursts go in 512 bytes */
+static void ocp_byteen (void)
+{
+  static const u16 size[] = { 4, 8, 12, 64, 520 };
+  u8 d[520], *m = rtl_ocp(MCU_TYPE_USB), be;
+  u32 a = 0x2000, x, n = 0;
+  ocp_fill(MCU_TYPE_USB);
+  for(int s = 0; s < 5; s++)
+    for(u32 byen = 0x11; byen <= 0xFF; byen++)
+    {
+      if(!(byen & 15) || !(byen >> 4)) continue;
+      fill(m + a - 8, size[s] + 16);
+      memcpy(ocp_ref + a - 8, m + a - 8, size[s] + 16);
+      fill(d, size[s]);
+      for(int i = 0; i < size[s]; i++)
+      {
+        be = i < 4 ? byen & 15 : i >= size[s] - 4 ? byen >> 4 : 15;
+        if(be >> (i & 3) & 1) ocp_ref[a + i] = d[i];
+      }
+      x = rtl_stat.ctrl;
+      generic_ocp_write(&tp, a, byen, size[s], d, MCU_TYPE_USB);
+      x = rtl_stat.ctrl - x;
+      check(!memcmp(m, ocp_ref, 0x10000), "generic_ocp_write() of %u bytes, byte enables %02X: OCP space differs", size[s], byen);
+      check(x == (size[s] == 4 ? 1 : 2 + (size[s] - 8 + 511) / 512), "generic_ocp_write() of %u bytes in %u transfers", size[s], x);
+      n++;
+    }
+  x = rtl_stat.ctrl;
+  check(generic_ocp_write(&tp, a + 2, BYTE_EN_DWORD, 4, d, MCU_TYPE_USB) < 0 &&
+    generic_ocp_write(&tp, a, BYTE_EN_DWORD, 6, d, MCU_TYPE_USB) < 0 && rtl_stat.ctrl == x,
+    "generic_ocp_write() not on whole dwords: %u transfers", rtl_stat.ctrl - x, 0);
+  printf("OCP: generic_ocp_write() of 4 to 520 bytes with %u byte enable pairs\n", n);
+}
+
+/* The register shadow across access widths: word and byte writes into a
+   shadowed dword have to show in dword reads, writes of the same value and
+   reads of it stay off the bus, and the bytes next to a shadowed word in its
+   dword are read from the device */
+static void ocp_widths (void)
+{
+  u8 *m = rtl_ocp(MCU_TYPE_PLA);
+  u32 rcr = ocp_read_dword(&tp, MCU_TYPE_PLA, PLA_RCR), d, x;
+  ocp_write_dword(&tp, MCU_TYPE_PLA, PLA_RCR, 0x11223344);
+  ocp_write_word(&tp, MCU_TYPE_PLA, PLA_RCR + 2, 0xAABB);
+  ocp_write_byte(&tp, MCU_TYPE_PLA, PLA_RCR + 1, 0xCC);
+  memcpy(&d, m + PLA_RCR, 4);
+  x = rtl_stat.ctrl;
+  check(ocp_read_dword(&tp, MCU_TYPE_PLA, PLA_RCR) == 0xAABBCC44 && d == 0xAABBCC44,
+    "PLA_RCR after dword, word and byte writes: %08X, device %08X", ocp_read_dword(&tp, MCU_TYPE_PLA, PLA_RCR), d);
+  check(ocp_read_word(&tp, MCU_TYPE_PLA, PLA_RCR) == 0xCC44 && ocp_read_byte(&tp, MCU_TYPE_PLA, PLA_RCR + 3) == 0xAA,
+    "PLA_RCR word %04X, byte 3 %02X", ocp_read_word(&tp, MCU_TYPE_PLA, PLA_RCR), ocp_read_byte(&tp, MCU_TYPE_PLA, PLA_RCR + 3));
+  ocp_write_word(&tp, MCU_TYPE_PLA, PLA_RCR + 2, 0xAABB);
+  ocp_write_byte(&tp, MCU_TYPE_PLA, PLA_RCR + 1, 0xCC);
+  ocp_write_dword(&tp, MCU_TYPE_PLA, PLA_RCR, 0xAABBCC44);
+  check(rtl_stat.ctrl == x, "PLA_RCR: %u transfers for shadowed reads and writes", rtl_stat.ctrl - x, 0);
+  ocp_write_dword(&tp, MCU_TYPE_PLA, PLA_RCR, rcr);
+  ocp_read_word(&tp, MCU_TYPE_PLA, PLA_MISC_1);
+  m[PLA_MISC_1 - 2] ^= 0x5A;
+  memcpy(&d, m + PLA_MISC_1 - 2, 4);
+  x = ocp_read_dword(&tp, MCU_TYPE_PLA, PLA_MISC_1 - 2);
+  check(x == d && ocp_read_word(&tp, MCU_TYPE_PLA, PLA_MISC_1 - 2) == (d & 0xFFFF),
+    "the dword of PLA_MISC_1 read as %08X, device %08X", x, d);
+  puts("OCP: dword, word and byte accesses through the register shadow");
+}
+
+/* The probe, then the breakpoint tables of r8152_fw.c and random ones by
+   ocp_write_words() against a byte-enable model of the OCP spaces */
+static int cmd_ocp (void)
+{
+  u32 x, words;
+  uint64_t t = sim_ns;
+  rtl_init();
+  if(usb_attach(&rtl_dev) != 2)
+  {
+    puts("OCP: no RTL8152");
+    return 1;
+  }
+  printf("OCP: probed in %u transfers, ", rtl_stat.ctrl);
+  print_time("with the enumeration", 0, sim_ns - t);
+  for(const struct OCP_TBL *b = ocp_bp; b->name; b++)
+  {
+    x = ocp_table(b->type, b->tbl, b->n, &words);
+    printf("OCP %s: %u words in %u transfers, %u word by word\n", b->name, b->n / 2, x, words);
+    if(b == ocp_bp) check(x == 6 && words == 11, "RTL8152B breakpoints: %u transfers, %u word by word", x, words);
+  }
+  ocp_random();
+  ocp_byteen();
+  ocp_widths();
+  printf("RTL8152 model: %u OCP transfers, %u protocol errors\n", rtl_stat.ctrl, rtl_stat.errors);
+  check(!musb_stat.errors && !rtl_stat.errors, "%u protocol errors on the bus, %u by the device",
+    musb_stat.errors, rtl_stat.errors);
+  return fails != 0;
+}
+
+/*******************************************************************************
+                              SPI flash (drv/spi.c)
+*******************************************************************************/
+static u8 spi_buf[(1 << 20) + 8] __attribute__((aligned(32)));
+
+/* Lengths around the DMA limit with every tail at offsets 0 to 3: the data
+   has to be the flash's, the bytes around the buffer must stay, and the
+   whole words of aligned reads from 512 bytes go by NDMA0, the rest by PIO */
+static void spi_reads (enum SPI_FLASH_MODE mode)
+{
+  static const u32 lens[] = { 1, 2, 3, 4, 5, 7, 64, 65, 511, 512, 513, 514, 515, 4096, 4099, 20001 };
+  u8 *nor = nor_mem();
+  u32 off, i, j, len, addr, dma, pio, n;
+  spi_flash_mode(mode);
+  for(off = 0; off < 4; off++)
+    for(i = 0; i < sizeof(lens) / sizeof(lens[0]); i++)
+    {
+      len = lens[i];
+      addr = rand() % (NOR_SIZE - len);
+      memset(spi_buf, 0xA5, len + 8);
+      dma = spi_stat.dma;
+      pio = spi_stat.pio;
+      spi_flash_read(addr, spi_buf + off, len);
+      check(!memcmp(spi_buf + off, nor + addr, len), "%u bytes at offset %u differ", len, off);
+      for(j = 0; j < len + 8; j++)
+        if(j < off || j >= off + len) check(spi_buf[j] == 0xA5, "read offset %u: byte %u outside the buffer written", off, j);
+      n = off || len < 512 ? 0 : len & ~3;
+      check(spi_stat.dma - dma == n && spi_stat.pio - pio == len - n,
+        "%u bytes at offset %u: not the whole words by NDMA0", len, off);
+    }
+}
+
+static void spi_rate (char *str, enum SPI_FLASH_MODE mode, u32 off, u32 len)
+{
+  uint64_t t = sim_ns;
+  spi_flash_mode(mode);
+  spi_flash_read(0x10000, spi_buf + off, len);
+  print_time(str, len, sim_ns - t);
+  check(!memcmp(spi_buf + off, nor_mem() + 0x10000, len), "%u bytes at offset %u differ", len, off);
+}
+
+/* The three read commands against the flash model, the boot-load rates of
+   1MB by NDMA0 and 64KB by PIO, then an RX DRQ that never reaches NDMA0: the read has to time out
+   and be done again by PIO, and DMA stays off */
+static int cmd_spi (void)
+{
+  u32 dma, pio;
+  uint64_t t;
+  nor_init();
+  fill(nor_mem(), NOR_SIZE);
+  spi_init();
+  spi_reads(SPI_FLASH_SLOW);
+  spi_reads(SPI_FLASH_FAST);
+  spi_reads(SPI_FLASH_DUAL);
+  printf("SPI: 192 reads of 1 to 20001 bytes at offsets 0..3 in each mode, %u bytes by NDMA0, "
+    "%u by PIO\n", spi_stat.dma, spi_stat.pio);
+  spi_rate("Read 0x03, NDMA0", SPI_FLASH_SLOW, 0, 1 << 20);
+  spi_rate("Read 0x0B, NDMA0", SPI_FLASH_FAST, 0, 1 << 20);
+  spi_rate("Read 0x3B, NDMA0", SPI_FLASH_DUAL, 0, 1 << 20);
+  spi_rate("Read 0x3B, PIO at offset 1", SPI_FLASH_DUAL, 1, 1 << 16);
+  dma = spi_stat.dma;
+  pio = spi_stat.pio;
+  nor_dma_stall(1);
+  t = sim_ns;
+  spi_flash_read(0x20000, spi_buf, 16384);
+  print_time("Read 0x3B, NDMA0 stalled", 16384, sim_ns - t);
+  check(!memcmp(spi_buf, nor_mem() + 0x20000, 16384), "stalled read differs", 0, 0);
+  nor_dma_stall(0);
+  spi_flash_read(0x30000, spi_buf, 16384);
+  check(!memcmp(spi_buf, nor_mem() + 0x30000, 16384), "read after the stall differs", 0, 0);
+  check(spi_stat.dma == dma && spi_stat.pio - pio == 2 * 16384,
+    "%u bytes by NDMA0 after the stall, %u by PIO", spi_stat.dma - dma, spi_stat.pio - pio);
+  printf("SPI NOR model: %u read commands, %u bytes, %u NDMA0 runs of %u bytes, %u protocol errors\n",
+    nor_stat.cmds, nor_stat.bytes, nor_stat.dma_runs, nor_stat.dma_bytes, nor_stat.errors);
+  check(nor_stat.dma_bytes == spi_stat.dma, "%u bytes moved by NDMA0, %u counted by the driver",
+    nor_stat.dma_bytes, spi_stat.dma);
+  check(!nor_stat.errors, "%u protocol errors", nor_stat.errors, 0);
+  return fails != 0;
+}
+
+/*******************************************************************************
+                  ARM checksum (src/lwip/httpd/arch/chksum.c)
+*******************************************************************************/
+#define CHKSUM_C  "../../src/lwip/httpd/arch/chksum.c"
+
+u16_t lwip_standard_chksum (const void *dataptr, int len);   // the C one of inet_chksum.c
+
+static u32 chk_stack[64];
+
+/* The ARM routine on len bytes at p, against the C LWIP_CHKSUM_ALGORITHM 2:
+   the same sum, loads inside the data only, r4-r11 and sp kept */
+static int chk_call (const u8 *p, int len, struct ARM *c)
+{
+  memset(c, 0, sizeof(*c));
+  for(int r = 0; r < 15; r++) c->r[r] = 0x01010101 * r;
+  c->r[0] = (u32)(uintptr_t)p;
+  c->r[1] = len;
+  c->r[13] = (u32)(uintptr_t)(chk_stack + 64);
+  c->lo = c->r[0];
+  c->hi = c->r[0] + len + !len;
+  if(arm_call(c)) return 0;
+  for(int r = 4; r < 12; r++)
+    if(c->r[r] != 0x01010101 * r) return 0;
+  return c->r[13] == (u32)(uintptr_t)(chk_stack + 64) && c->r[0] == lwip_standard_chksum(p, len);
+}
+
+static void chk_bench (const u8 *buf, int off, int len)
+{
+  struct ARM c;
+  chk_call(buf + off, len, &c);
+  printf("ARM checksum: %u bytes at offset %u, %u instructions, %u cycles, %.2f bytes/cycle\n",
+    len, off, c.insns, c.cycles, (double)len / c.cycles);
+}
+
+/* Every length to 256 at offsets 0 to 7, random and all 0xFF, then random
+   buffers to 2000 bytes; the cycles of a full TCP segment */
+static int cmd_chksum (const char *path)
+{
+  static u8 buf[2048 + 8] __attribute__((aligned(32)));
+  struct ARM c;
+  u32 n = 0;
+  int len, off;
+  if(arm_load(path) < 0) return 1;
+  for(int ff = 0; ff < 2; ff++)
+    for(off = 0; off < 8; off++)
+      for(len = 0; len <= 256; len++, n++)
+      {
+        if(ff) memset(buf, 0xFF, sizeof(buf));
+        else fill(buf, sizeof(buf));
+        check(chk_call(buf + off, len, &c), "ARM checksum of %u bytes at offset %u differs", len, off);
+      }
+  for(int k = 0; k < 4000; k++, n++)
+  {
+    off = rand() % 8;
+    len = rand() % 2001;
+    if(k & 3) fill(buf, sizeof(buf));
+    else memset(buf, 0xFF, sizeof(buf));
+    check(chk_call(buf + off, len, &c), "ARM checksum of %u bytes at offset %u differs", len, off);
+  }
+  printf("ARM checksum: %u buffers compared with lwip_standard_chksum()\n", n);
+  fill(buf, sizeof(buf));
+  chk_bench(buf, 0, 1460);
+  chk_bench(buf, 1, 1460);
+  chk_bench(buf, 2, 1460);
+  chk_bench(buf, 0, 20);
+  return fails != 0;
+}
+
+static void usage (void)
+{
+  puts("usage: drvsim sd|msc|net|ocp|spi|chksum [source]");
+  exit(1);
+}
+
+int main (int argc, char *argv[])
+{
+  int res = 1;
+  if(argc < 2) usage();
+  setvbuf(stdout, NULL, _IONBF, 0);
+  srand(1);
+  reg_init();
+  if(!strcmp(argv[1], "sd")) res = cmd_sd();
+  else if(!strcmp(argv[1], "msc")) res = cmd_msc();
+  else if(!strcmp(argv[1], "net")) res = cmd_net();
+  else if(!strcmp(argv[1], "ocp")) res = cmd_ocp();
+  else if(!strcmp(argv[1], "spi")) res = cmd_spi();
+  else if(!strcmp(argv[1], "chksum")) res = cmd_chksum(argc > 2 ? argv[2] : CHKSUM_C);
+  else usage();
+  printf("%u register accesses\n", reg_acc);
+  puts(res ? "Error" : "OK");
+  return res;
+}
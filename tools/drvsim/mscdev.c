@@ -0,0 +1,253 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sys.h"
+#include "reg.h"
+#include "musb.h"
+#include "mscdev.h"
+#include "usb_msc.h"
+
+#define DISK_CMD_NS   30000     // command decode, status
+#define DISK_ACC_NS   200000    // read access of the first block
+#define DISK_RD_NS    12000     // per block read, 42MB/s
+#define DISK_WR_NS    20000     // per block written, 25MB/s
+#define DISK_PRG_NS   400000    // programming before the status of a write
+
+struct DISK_STAT disk_stat;
+
+static const u8 dsc_dev[18] = {
+  18, 1, 0x00, 0x02, 0, 0, 0, 64,
+  0x81, 0x07, 0x67, 0x55, 0x00, 0x01, 1, 2, 3, 1
+};
+
+static const u8 dsc_cfg[32] = {
+  9, 2, 32, 0, 1, 1, 0, 0x80, 50,
+  9, 4, 0, 0, 2, 8, 6, 0x50, 0,     // mass storage, SCSI, Bulk-Only
+  7, 5, 0x81, 2, 0x00, 0x02, 0,     // bulk IN 512
+  7, 5, 0x02, 2, 0x00, 0x02, 0      // bulk OUT 512
+};
+
+enum { S_CBW, S_IN, S_OUT, S_CSW };
+
+static struct {
+  u8  *disk;
+  u8  state;
+  CBW cbw;
+  u8  buf[64];              // response of a non-data command
+  u8  *data;
+  u32 len, pos;             // data phase
+  uint64_t ready;           // next packet or the status
+  u8  status;
+  u8  sense;
+  u8  fail;
+  uint64_t hold;
+} dsk;
+
+static void disk_error (char *str)
+{
+  if(disk_stat.errors++ < 10) printf("MSC device: %s\n", str);
+}
+
+static void disk_reset (void)
+{
+  dsk.state = S_CBW;
+}
+
+static int str_dsc (u8 idx, u8 *data)
+{
+  static const char *str[] = { NULL, "drvsim", "BOT disk", "0001" };
+  int n = 2;
+  if(!idx)
+  {
+    memcpy(data, "\x04\x03\x09\x04", 4);
+    return 4;
+  }
+  if(idx > 3) return USB_STALL;
+  for(const char *s = str[idx]; *s; s++, n += 2) data[n] = *s, data[n + 1] = 0;
+  data[0] = n;
+  data[1] = 3;
+  return n;
+}
+
+static int disk_ctrl (const u8 *s, u8 *data, uint64_t t)
+{
+  u16 req = s[0] | s[1] << 8;
+  switch(req)
+  {
+    case 0x0680:                      // GET_DESCRIPTOR
+      if(s[3] == 1) return memcpy(data, dsc_dev, 18), 18;
+      if(s[3] == 2) return memcpy(data, dsc_cfg, 32), 32;
+      if(s[3] == 3) return str_dsc(s[2], data);
+      return USB_STALL;
+    case 0x0900: return s[2] == 1 ? 0 : USB_STALL;    // SET_CONFIGURATION
+    case 0x0102: return 0;            // CLEAR_FEATURE(ENDPOINT_HALT)
+    case 0xFEA1:                      // GET_MAX_LUN
+      data[0] = 0;
+      return 1;
+    case 0xFF21:                      // Bulk-Only Mass Storage Reset
+      disk_stat.resets++;
+      disk_reset();
+      return 0;
+  }
+  return USB_STALL;
+}
+
+/* The data phase a CBW asks for has to be the one of its command */
+static void command (uint64_t t)
+{
+  CBW *c = &dsk.cbw;
+  u32 lba = __builtin_bswap32(c->cb.rd10.lba), cnt = __builtin_bswap16(c->cb.rd10.cnt);
+  u32 exp = 0, in = 1;
+  u8  op = c->cb.raw[0];
+  disk_stat.cmds++;
+  dsk.status = 0;
+  dsk.data = dsk.buf;
+  dsk.pos = 0;
+  dsk.ready = t + DISK_CMD_NS;
+  memset(dsk.buf, 0, sizeof(dsk.buf));
+  switch(op)
+  {
+    case INQUIRY:
+      dsk.buf[1] = 0x80;              // removable
+      dsk.buf[2] = 2;
+      dsk.buf[4] = 31;
+      memcpy(dsk.buf + 8, "drvsim  BOT disk        0001", 28);
+      exp = c->cb.inquiry.alen < 36 ? c->cb.inquiry.alen : 36;
+      break;
+    case RD_CAPACITY:
+      *(u32*)dsk.buf = __builtin_bswap32(DISK_BLKS - 1);
+      *(u32*)(dsk.buf + 4) = __builtin_bswap32(512);
+      exp = 8;
+      break;
+    case REQUEST_SENSE:
+      disk_stat.sense++;
+      dsk.buf[0] = 0x70;
+      dsk.buf[2] = dsk.sense;
+      dsk.buf[7] = 10;
+      exp = c->cb.request_sense.alen < 18 ? c->cb.request_sense.alen : 18;
+      dsk.sense = 0;
+      break;
+    case TEST_UNIT_READY: break;
+    case RD10:
+    case WR10:
+      in = op == RD10;
+      exp = cnt * 512;
+      if(!cnt || lba + cnt > DISK_BLKS)
+      {
+        disk_error("READ(10)/WRITE(10) beyond the medium");
+        exp = 0;
+        break;
+      }
+      dsk.data = dsk.disk + lba * 512;
+      if(in) dsk.ready += DISK_ACC_NS, disk_stat.rd_blks += cnt;
+      else disk_stat.wr_blks += cnt;
+      if(dsk.fail)
+      {
+        dsk.fail = 0;
+        dsk.status = 1;
+        dsk.sense = 3;                // MEDIUM ERROR, the data phase is still run
+        if(!in) dsk.data = dsk.disk + DISK_BLKS * 512;
+      }
+      break;
+    default:
+      disk_error("unknown SCSI command");
+      dsk.status = 1;
+      dsk.sense = 5;
+  }
+  if(c->total_bytes != exp || (exp && !(c->dir & 0x80) != !in))
+    disk_error("CBW length or direction does not match the command");
+  dsk.ready += dsk.hold;
+  dsk.hold = 0;
+  dsk.len = exp;
+  dsk.state = !exp ? S_CSW : in ? S_IN : S_OUT;
+}
+
+static int disk_out (int ep, const u8 *pkt, u32 len, uint64_t t)
+{
+  if(ep != 2)
+  {
+    disk_error("OUT to an endpoint the device does not have");
+    return USB_STALL;
+  }
+  if(dsk.state == S_CBW)
+  {
+    memcpy(&dsk.cbw, pkt, len < sizeof(CBW) ? len : sizeof(CBW));
+    if(len != sizeof(CBW) || dsk.cbw.signature != CBW_SIGNATURE || dsk.cbw.lun ||
+      dsk.cbw.cmd_len < 6 || dsk.cbw.cmd_len > 16)
+    {
+      disk_error("CBW is not valid");
+      return USB_STALL;
+    }
+    command(t);
+    return 0;
+  }
+  if(dsk.state != S_OUT)
+  {
+    disk_error("OUT packet out of phase");
+    return USB_STALL;
+  }
+  if(t < dsk.ready) return USB_NAK;
+  if(len > dsk.len - dsk.pos || (len < 512 && dsk.pos + len < dsk.len))
+    disk_error("OUT data does not fill the CBW length");
+  else if(dsk.data < dsk.disk + DISK_BLKS * 512) memcpy(dsk.data + dsk.pos, pkt, len);
+  dsk.pos += len;
+  dsk.ready = t + DISK_WR_NS;
+  if(dsk.pos >= dsk.len)
+  {
+    dsk.state = S_CSW;
+    dsk.ready = t + DISK_PRG_NS;
+  }
+  return 0;
+}
+
+static int disk_in (int ep, u8 *pkt, u32 max, uint64_t t)
+{
+  u32 n;
+  CSW csw;
+  if(ep != 1)
+  {
+    disk_error("IN from an endpoint the device does not have");
+    return USB_STALL;
+  }
+  if(dsk.state == S_CBW || dsk.state == S_OUT || t < dsk.ready) return USB_NAK;
+  if(dsk.state == S_CSW)
+  {
+    csw.signature = CSW_SIGNATURE;
+    csw.tag = dsk.cbw.tag;
+    csw.data_residue = 0;
+    csw.status = dsk.status;
+    memcpy(pkt, &csw, sizeof(csw));
+    dsk.state = S_CBW;
+    return sizeof(csw);
+  }
+  n = dsk.len - dsk.pos < max ? dsk.len - dsk.pos : max;
+  memcpy(pkt, dsk.data + dsk.pos, n);
+  dsk.pos += n;
+  if(dsk.data != dsk.buf)             // the medium streams a block behind the bus
+    dsk.ready = (dsk.ready + DISK_RD_NS > t ? dsk.ready : t - DISK_RD_NS) + DISK_RD_NS;
+  if(dsk.pos == dsk.len) dsk.state = S_CSW;
+  return n;
+}
+
+static uint64_t disk_next (void)
+{
+  return dsk.state != S_CBW ? dsk.ready : 0;
+}
+
+const struct USB_DEV disk_dev = { disk_reset, disk_ctrl, disk_out, disk_in, disk_next };
+
+u8 *disk_mem (void)
+{
+  if(!dsk.disk) dsk.disk = calloc(DISK_BLKS + 1, 512);
+  return dsk.disk;
+}
+
+void disk_fail (void)
+{
+  dsk.fail = 1;
+}
+
+void disk_hold (uint64_t ns)
+{
+  dsk.hold = ns;
+}
@@ -0,0 +1,28 @@
+#ifndef MSCDEV_H
+#define MSCDEV_H
+
+/* A USB flash disk on the MUSB model: Bulk-Only Transport with the SCSI
+   commands of the MSC driver on a 16MB medium. The medium has a command
+   latency, an access time per read and a flash speed per block, the bulk
+   endpoints NAK until it is ready. CBWs that do not match their command and
+   transport phases out of order are protocol errors. */
+
+#define DISK_BLKS     32768
+
+struct DISK_STAT {
+  u32 cmds;
+  u32 rd_blks;
+  u32 wr_blks;
+  u32 resets;       // Bulk-Only Mass Storage Resets
+  u32 sense;        // REQUEST SENSE commands
+  u32 errors;       // protocol errors
+};
+
+extern struct DISK_STAT disk_stat;
+extern const struct USB_DEV disk_dev;
+
+u8 *disk_mem (void);
+void disk_fail (void);              // the next READ(10)/WRITE(10) fails once
+void disk_hold (uint64_t ns);       // the next data phase starts that much later
+
+#endif
@@ -0,0 +1,844 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sys.h"
+#include "reg.h"
+#include "musb.h"
+
+#define USB_PKT_NS(n)   (1000 + (n) * 17)   // token, data and handshake at 480Mbit/s
+#define USB_NAK_NS      2000                // a NAKed try and the gap to the next
+#define USB_ERR_NS      10000               // three tries without an answer
+#define USB_UFRAME_NS   125000
+#define DMA_PKT_NS      2600                // DDMA0: 128 words between DRAM and the FIFO
+
+#define OFS(r)          ((u32)(uintptr_t)&USB->r - (u32)(uintptr_t)USB)
+#define IREG8(ep, r)    usb.reg[ep][OFS(r) - 0x80]
+#define IREG16(ep, r)   (IREG8(ep, r) | usb.reg[ep][OFS(r) - 0x7F] << 8)
+
+enum { R_DATA, R_NAK, R_STALL, R_ERR, R_RETRY, R_NAKTO };
+enum { T_SETUP = 1, T_OUT, T_IN, T_STATUS_OUT, T_STATUS_IN };
+
+struct MUSB_STAT musb_stat;
+
+/* A transaction on the bus: its result takes effect at t */
+struct XFER {
+  int res;
+  uint64_t t;
+  uint64_t nak_t;           // NAK limit, 0 - not NAKed yet
+  u8  wait;                 // NAKed, until the device is ready
+};
+
+struct TXP {                // EP1 bulk OUT
+  struct XFER x;
+  u8  load[512];            // packet being loaded
+  u32 n;
+  u8  pkt[2][512];          // packets set ready, the first on the bus
+  u32 len[2];
+  u32 cnt;
+  u16 csr;                  // error and mode bits
+  u8  tog;
+};
+
+struct RXP {                // EP1 bulk IN, EP2 interrupt IN
+  struct XFER x;
+  u8  buf[512];             // packet on the bus
+  u32 blen;
+  u8  drop;                 // DATA toggle mismatch, the host drops it
+  u8  pkt[2][512];          // packets received, the first one is read
+  u32 len[2];
+  u32 cnt, pos;
+  u16 csr;
+  u16 left;                 // AutoReq packets left
+  u8  req;                  // ReqPkt
+  u8  tog;
+};
+
+static struct {
+  const struct USB_DEV *dev;
+  u8  conn;
+  u8  addr, new_addr;
+  u8  halt[2][16];          // device endpoints, [IN][ep]
+  u8  tog[2][16];
+  u8  power, devctl, idx, vend0;
+  u32 ep_is, ep_ie, bus_is;
+  u8  reg[3][32];           // indexed registers 0x80..0x9F as written
+  u8  used[3];              // pipes that moved packets, for the FIFO map
+  uint64_t bus_t;           // bus free
+  struct {
+    struct XFER x;
+    u8  tok;                // transaction on the bus
+    u8  fifo[64];           // written by the CPU
+    u32 n;
+    u8  buf[64];            // IN packet on the bus
+    u32 blen;
+    u8  rx[64];             // IN packet received
+    u32 rx_n, rx_pos;
+    u16 csr;
+    u8  setup[8];
+    u8  data[4096];         // data stage
+    int len, pos, stall;
+  } ep0;
+  struct TXP tx;
+  struct RXP rx[2];
+} usb;
+
+/* DDMA0 between DRAM and the EP1 FIFO, the DMA interrupt registers */
+static struct {
+  u32 ie, is;
+  u32 cfg, src, dst, cnt;
+  u32 done;                 // bytes moved
+  u8  in;
+  u8  stall;                // the DMA request does not reach DDMA0
+  uint64_t t;               // packet being moved
+} dma;
+
+static uint64_t now;        // time of the event being handled
+
+static void usb_error (char *str)
+{
+  if(musb_stat.errors++ < 10) printf("USB model: %s\n", str);
+}
+
+static uint64_t bus_start (void)
+{
+  return now > usb.bus_t ? now : usb.bus_t;
+}
+
+/*******************************************************************************
+                                  Pipe checks
+*******************************************************************************/
+/* FIFO RAM of a pipe, both buffers of a double-buffered one */
+static void fifo_range (int ep, int rx, u32 *start, u32 *end)
+{
+  u32 sz = rx ? IREG16(ep, RXFIFOSZ) : IREG16(ep, TXFIFOSZ);
+  *start = (rx ? IREG16(ep, RXFIFOADDR) : IREG16(ep, TXFIFOADDR)) * 8;
+  *end = *start + ((8 << (sz & 15)) << (sz & 0x10 ? 1 : 0));
+}
+
+static u32 fifo_bufs (int ep, int rx)
+{
+  return (rx ? IREG16(ep, RXFIFOSZ) : IREG16(ep, TXFIFOSZ)) & 0x10 ? 2 : 1;
+}
+
+/* Target endpoint of a pipe, -1 if no device answers it. EP1 TX is used[0],
+   EP1 RX used[1], EP2 RX used[2] */
+static int pipe_ep (int ep, int rx)
+{
+  static const u8 pep[3] = { 1, 1, 2 }, prx[3] = { 0, 1, 1 };
+  u8  type = rx ? IREG8(ep, RXTYPE) : IREG8(ep, TXTYPE);
+  u32 maxp = rx ? IREG16(ep, RXMAXP) : IREG16(ep, TXMAXP), s, e, s2, e2;
+  int i, me = ep == 2 ? 2 : rx;
+  if(((type >> 4) & 3) != (ep == 2 ? 3 : 2)) usb_error("endpoint type is not bulk on EP1, interrupt on EP2");
+  if(type >> 6 != 1) usb_error("endpoint speed is not high speed");
+  if(!maxp || maxp > (8 << ((rx ? IREG16(ep, RXFIFOSZ) : IREG16(ep, TXFIFOSZ)) & 15)))
+    usb_error("MAXP does not fit the FIFO");
+  fifo_range(ep, rx, &s, &e);
+  if(s < 64) usb_error("FIFO overlaps EP0");
+  usb.used[me] = 1;
+  for(i = 0; i < 3; i++)
+    if(i != me && usb.used[i])
+    {
+      fifo_range(pep[i], prx[i], &s2, &e2);
+      if(s < e2 && s2 < e) usb_error("FIFOs overlap");
+    }
+  if(!usb.conn || (rx ? IREG8(ep, RXFUNCADDR) : IREG8(ep, TXFUNCADDR)) != usb.addr) return -1;
+  return type & 15;
+}
+
+/*******************************************************************************
+                                     EP0
+*******************************************************************************/
+/* Standard requests the model keeps: the address, halted endpoints and the
+   data toggles of the device */
+static int std_req (const u8 *s)
+{
+  int ep = s[4] & 15, in = s[4] >> 7;
+  if(s[0] == 0x00 && s[1] == 5)
+  {
+    usb.new_addr = s[2];
+    return 0;
+  }
+  if(s[0] == 0x02 && s[1] == 1 && !s[2])    // CLEAR_FEATURE(ENDPOINT_HALT)
+    usb.halt[in][ep] = usb.tog[in][ep] = 0;
+  if(s[0] == 0x00 && s[1] == 9)             // SET_CONFIGURATION
+  {
+    memset(usb.halt, 0, sizeof(usb.halt));
+    memset(usb.tog, 0, sizeof(usb.tog));
+  }
+  return usb.dev->ctrl(s, usb.ep0.data, bus_start());
+}
+
+static void ep0_start (int tok)
+{
+  u32 n = 0, wlen;
+  int res;
+  usb.ep0.tok = tok;
+  usb.ep0.x.res = R_DATA;
+  if((IREG8(0, TXTYPE) >> 6) != 1) usb_error("EP0 speed is not high speed");
+  if(!usb.conn || IREG8(0, TXFUNCADDR) != usb.addr)
+  {
+    usb.ep0.x.res = R_ERR;
+    usb.ep0.x.t = bus_start() + USB_ERR_NS;
+    return;
+  }
+  wlen = usb.ep0.setup[6] | usb.ep0.setup[7] << 8;
+  switch(tok)
+  {
+    case T_SETUP:
+      if(usb.ep0.n != 8) usb_error("SETUP packet is not 8 bytes");
+      memcpy(usb.ep0.setup, usb.ep0.fifo, 8);
+      musb_stat.setups++;
+      n = 8;
+      wlen = usb.ep0.setup[6] | usb.ep0.setup[7] << 8;
+      usb.ep0.len = usb.ep0.pos = usb.ep0.stall = 0;
+      if(wlen > sizeof(usb.ep0.data)) usb_error("control data stage too long for the model");
+      else if(usb.ep0.setup[0] & 0x80)
+      {
+        res = usb.dev->ctrl(usb.ep0.setup, usb.ep0.data, bus_start());
+        if(res < 0) usb.ep0.stall = 1;
+        else usb.ep0.len = res < wlen ? res : wlen;
+      }
+      break;
+    case T_OUT:
+      n = usb.ep0.n;
+      if(usb.ep0.setup[0] & 0x80 || usb.ep0.len + n > wlen) usb_error("EP0 OUT data beyond wLength");
+      else memcpy(usb.ep0.data + usb.ep0.len, usb.ep0.fifo, n), usb.ep0.len += n;
+      break;
+    case T_IN:
+      if(!(usb.ep0.setup[0] & 0x80)) usb_error("EP0 IN data on a host-to-device request");
+      if(usb.ep0.stall) usb.ep0.x.res = R_STALL;
+      else
+      {
+        n = usb.ep0.len - usb.ep0.pos > 64 ? 64 : usb.ep0.len - usb.ep0.pos;
+        memcpy(usb.ep0.buf, usb.ep0.data + usb.ep0.pos, n);
+        usb.ep0.pos += n;
+        usb.ep0.blen = n;
+      }
+      break;
+    case T_STATUS_IN:                 // end of a no-data or OUT request
+      if(usb.ep0.setup[0] & 0x80) usb_error("IN status of a device-to-host request");
+      else if(std_req(usb.ep0.setup) < 0) usb.ep0.x.res = R_STALL;
+      usb.ep0.blen = 0;
+      break;
+    case T_STATUS_OUT:
+      if(!(usb.ep0.setup[0] & 0x80)) usb_error("OUT status of a host-to-device request");
+      if(usb.ep0.n) usb_error("OUT status with data in the FIFO");
+      break;
+  }
+  if(tok == T_SETUP || tok == T_OUT || tok == T_STATUS_OUT) usb.ep0.n = 0;
+  usb.ep0.x.t = bus_start() + USB_PKT_NS(n);
+  usb.bus_t = usb.ep0.x.t;
+}
+
+static void ep0_event (void)
+{
+  u8  tok = usb.ep0.tok;
+  usb.ep0.x.t = 0;
+  usb.ep0.tok = 0;
+  usb.ep_is |= 1;
+  usb.ep0.csr &= ~0x2A;               // TxPktRdy, SetupPkt, ReqPkt
+  if(usb.ep0.x.res == R_ERR) usb.ep0.csr |= 0x10;
+  else if(usb.ep0.x.res == R_STALL)
+  {
+    usb.ep0.csr |= 4;
+    musb_stat.stalls++;
+  }
+  else if(tok == T_IN || tok == T_STATUS_IN)
+  {
+    memcpy(usb.ep0.rx, usb.ep0.buf, usb.ep0.blen);
+    usb.ep0.rx_n = usb.ep0.blen;
+    usb.ep0.rx_pos = 0;
+    usb.ep0.csr |= 1;                 // RxPktRdy
+    if(tok == T_STATUS_IN && usb.new_addr)
+    {
+      usb.addr = usb.new_addr;
+      usb.new_addr = 0;
+    }
+  }
+}
+
+static void ep0_csr (u16 v)
+{
+  if(v & 0x100)                       // FlushFIFO
+  {
+    usb.ep0.n = 0;
+    usb.ep0.rx_n = usb.ep0.rx_pos = 0;
+  }
+  if(!(v & 1)) usb.ep0.rx_n = usb.ep0.rx_pos = 0;
+  if(usb.ep0.tok && !(v & 0x22))      // the transaction on the bus is dropped
+    usb.ep0.tok = usb.ep0.x.t = 0;
+  usb.ep0.csr = (usb.ep0.csr & 0x95 & (v | ~0x95)) | (v & 0x6A);
+  if(usb.ep0.tok) return;
+  if(v & 2) ep0_start(v & 8 ? T_SETUP : v & 0x40 ? T_STATUS_OUT : T_OUT);
+  else if(v & 0x20) ep0_start(v & 0x40 ? T_STATUS_IN : T_IN);
+}
+
+/*******************************************************************************
+                                 EP1 and EP2
+*******************************************************************************/
+static void wake_all (void);
+
+/* The device is asked again when it says it is ready; the NAK limit of
+   interval ends the tries, without a limit the pipe waits for musb_wake() */
+static void nak (struct XFER *x, u32 interval)
+{
+  uint64_t r = usb.dev && usb.dev->next ? usb.dev->next() : 0;
+  uint64_t lim = interval > 1 ? (uint64_t)USB_UFRAME_NS << (interval - 1) : 0;
+  musb_stat.naks++;
+  if(lim && !x->nak_t) x->nak_t = now - USB_NAK_NS + lim;
+  if(r && r < now + USB_NAK_NS) r = now + USB_NAK_NS;  // ready while the NAK was sent
+  if(lim && (!r || r >= x->nak_t))
+  {
+    x->res = R_NAKTO;
+    x->t = x->nak_t > now ? x->nak_t : now;
+  }
+  else if(r)
+  {
+    x->res = R_RETRY;
+    x->t = r;
+  }
+  else x->wait = 1;
+}
+
+static void tx_kick (void)
+{
+  struct TXP *p = &usb.tx;
+  int ep, res;
+  if(p->x.t || p->x.wait || !p->cnt || p->csr & 0xA4) return;
+  if((ep = pipe_ep(1, 0)) < 0) res = R_ERR;
+  else if(usb.halt[0][ep]) res = R_STALL;
+  else if(p->tog != usb.tog[0][ep])
+  {                                   // the device takes it for a resend
+    usb_error("OUT data toggle mismatch");
+    res = R_DATA;
+  }
+  else
+  {
+    res = usb.dev->out(ep, p->pkt[0], p->len[0], bus_start());
+    res = res == USB_NAK ? R_NAK : res == USB_STALL ? R_STALL : R_DATA;
+    if(res == R_STALL) usb.halt[0][ep] = 1;
+    if(res == R_DATA) usb.tog[0][ep] ^= 1;
+  }
+  p->x.res = res;
+  p->x.t = bus_start() + (res == R_DATA ? USB_PKT_NS(p->len[0]) : res == R_ERR ? USB_ERR_NS : USB_NAK_NS);
+  if(res == R_DATA) usb.bus_t = p->x.t;
+}
+
+static void tx_pop (void)
+{
+  struct TXP *p = &usb.tx;
+  if(!p->cnt) return;
+  memcpy(p->pkt[0], p->pkt[1], p->len[1]);
+  p->len[0] = p->len[1];
+  p->cnt--;
+}
+
+static void tx_event (void)
+{
+  struct TXP *p = &usb.tx;
+  p->x.t = 0;
+  switch(p->x.res)
+  {
+    case R_DATA:
+      tx_pop();
+      p->tog ^= 1;
+      p->x.nak_t = 0;
+      musb_stat.pkts++;
+      if((p->csr & 0x1400) != 0x1400) usb.ep_is |= 2;  // DMA mode 1: no interrupt per packet
+      wake_all();
+      break;
+    case R_NAK: nak(&p->x, IREG8(1, TXINTERVAL)); break;
+    case R_NAKTO:
+      p->csr |= 0x80;
+      musb_stat.nakto++;
+      usb.ep_is |= 2;
+      break;
+    case R_STALL:
+      p->csr |= 0x20;
+      musb_stat.stalls++;
+      usb.ep_is |= 2;
+      break;
+    case R_ERR:
+      p->csr |= 4;
+      usb.ep_is |= 2;
+      break;
+  }
+  tx_kick();
+}
+
+/* TxPktRdy: the loaded bytes are a packet */
+static void tx_load (void)
+{
+  struct TXP *p = &usb.tx;
+  if(p->n > IREG16(1, TXMAXP)) usb_error("OUT packet longer than MAXP");
+  memcpy(p->pkt[p->cnt], p->load, p->n);
+  p->len[p->cnt++] = p->n;
+  p->n = 0;
+  tx_kick();
+}
+
+static void tx_csr (u16 v)
+{
+  struct TXP *p = &usb.tx;
+  if(v & 8)                           // FlushFIFO: the next packet
+  {
+    if(p->cnt && (p->x.t || p->x.wait)) p->x.t = p->x.wait = 0;
+    tx_pop();
+    p->n = 0;
+  }
+  if(v & 0x40) p->tog = 0;            // ClrDataTog
+  if(p->csr & 0x80 & ~v) p->x.nak_t = 0;
+  p->csr = (p->csr & 0xA4 & v) | (v & 0xFC00);
+  if(v & 1 && p->cnt < fifo_bufs(1, 0)) tx_load();
+  tx_kick();
+}
+
+static void rx_kick (int i)
+{
+  struct RXP *p = &usb.rx[i];
+  int ep, n, res;
+  u32 maxp = IREG16(i + 1, RXMAXP);
+  if(p->x.t || p->x.wait || p->csr & 0x14C || p->cnt == fifo_bufs(i + 1, 1) ||
+    !(p->req || (p->csr & 0x4000 && p->left))) return;
+  p->drop = 0;
+  if((ep = pipe_ep(i + 1, 1)) < 0) res = R_ERR;
+  else if(usb.halt[1][ep]) res = R_STALL;
+  else
+  {
+    n = usb.dev->in(ep, p->buf, maxp, bus_start());
+    res = n == USB_NAK ? R_NAK : n == USB_STALL ? R_STALL : R_DATA;
+    if(res == R_STALL) usb.halt[1][ep] = 1;
+    if(res == R_DATA)
+    {
+      if(n > maxp) usb_error("IN packet longer than MAXP");
+      p->blen = n > maxp ? maxp : n;
+      if(p->tog != usb.tog[1][ep])    // the host takes it for a resend
+      {
+        usb_error("IN data toggle mismatch");
+        p->drop = 1;
+      }
+      usb.tog[1][ep] ^= 1;
+    }
+  }
+  p->x.res = res;
+  p->x.t = bus_start() + (res == R_DATA ? USB_PKT_NS(p->blen) : res == R_ERR ? USB_ERR_NS : USB_NAK_NS);
+  if(res == R_DATA) usb.bus_t = p->x.t;
+}
+
+static void rx_pop (struct RXP *p)
+{
+  if(!p->cnt) return;
+  memcpy(p->pkt[0], p->pkt[1], p->len[1]);
+  p->len[0] = p->len[1];
+  p->cnt--;
+  p->pos = 0;
+}
+
+static void rx_event (int i)
+{
+  struct RXP *p = &usb.rx[i];
+  u32 is = i ? 0x40000 : 0x20000;
+  p->x.t = 0;
+  switch(p->x.res)
+  {
+    case R_DATA:
+      if(!p->drop)
+      {
+        memcpy(p->pkt[p->cnt], p->buf, p->blen);
+        p->len[p->cnt++] = p->blen;
+        p->tog ^= 1;
+        p->req = 0;
+        if(p->csr & 0x4000 && p->left) p->left--;
+        if(i || (p->csr & 0x2800) != 0x2800 || p->blen < IREG16(1, RXMAXP))
+          usb.ep_is |= is;              // DMA mode 1: short packets only
+      }
+      p->x.nak_t = 0;
+      musb_stat.pkts++;
+      wake_all();
+      break;
+    case R_NAK:
+      if(!i) nak(&p->x, IREG8(1, RXINTERVAL));
+      else                            // polled again the next interval
+      {
+        musb_stat.naks++;
+        p->x.res = R_RETRY;
+        p->x.t = now + ((uint64_t)USB_UFRAME_NS << (IREG8(2, RXINTERVAL) ? IREG8(2, RXINTERVAL) - 1 : 0));
+        return;
+      }
+      break;
+    case R_NAKTO:
+      p->csr |= 8;
+      p->req = 0;
+      musb_stat.nakto++;
+      usb.ep_is |= is;
+      break;
+    case R_STALL:
+      p->csr |= 0x40;
+      p->req = 0;
+      musb_stat.stalls++;
+      usb.ep_is |= is;
+      break;
+    case R_ERR:
+      p->csr |= 4;
+      p->req = 0;
+      usb.ep_is |= is;
+      break;
+  }
+  rx_kick(i);
+}
+
+static void rx_csr (int i, u16 v)
+{
+  struct RXP *p = &usb.rx[i];
+  if(v & 0x10 || !(v & 1)) rx_pop(p); // FlushFIFO, RxPktRdy cleared
+  if(v & 0x80) p->tog = 0;            // ClrDataTog
+  p->csr = (p->csr & 0x14C & v) | (v & 0xE800);
+  if(v & 0x20)                        // ReqPkt
+  {
+    p->req = 1;
+    p->x.nak_t = 0;
+  }
+  rx_kick(i);
+}
+
+static void wake_all (void)
+{
+  struct XFER *x[2] = { &usb.tx.x, &usb.rx[0].x };
+  for(int i = 0; i < 2; i++)
+    if(x[i]->wait)
+    {
+      x[i]->wait = 0;
+      x[i]->res = R_RETRY;
+      x[i]->t = now + USB_NAK_NS;
+    }
+}
+
+/*******************************************************************************
+                                    DDMA0
+*******************************************************************************/
+static u32 fifo1 (void)
+{
+  return (u32)(uintptr_t)&USB->FIFO[1];
+}
+
+/* DMA request mode 1 of the EP1 pipe VEND0 routes to DDMA0: a free TX
+   buffer, or a whole RX packet not read yet */
+static int drq (void)
+{
+  struct TXP *t = &usb.tx;
+  struct RXP *r = &usb.rx[0];
+  if(!(dma.cfg & (1U << 30)) || dma.stall) return 0;
+  if(dma.in)
+    return usb.vend0 == 3 && (r->csr & 0x2800) == 0x2800 && r->cnt && !r->pos && r->len[0] == 512;
+  return usb.vend0 == 1 && (t->csr & 0x1400) == 0x1400 && !t->n && t->cnt < fifo_bufs(1, 0);
+}
+
+static void dma_kick (void)
+{
+  if(!dma.t && drq()) dma.t = now + DMA_PKT_NS;
+}
+
+static void dma_event (void)
+{
+  u8  *mem = (u8*)(uintptr_t)(dma.in ? dma.dst : dma.src) + dma.done;
+  dma.t = 0;
+  if(!drq()) return;                  // the request went away meanwhile
+  if(dma.in)
+  {
+    memcpy(mem, usb.rx[0].pkt[0], 512);
+    usb.rx[0].pos = 512;
+    if(usb.rx[0].csr & 0x8000)        // AutoClear
+    {
+      rx_pop(&usb.rx[0]);
+      rx_kick(0);
+    }
+  }
+  else
+  {
+    memcpy(usb.tx.load, mem, 512);
+    usb.tx.n = 512;
+    if(usb.tx.csr & 0x8000 && IREG16(1, TXMAXP) == 512) tx_load();   // AutoSet
+  }
+  dma.done += 512;
+  musb_stat.dma_bytes += 512;
+  if(dma.done < dma.cnt) return;
+  dma.cfg &= ~(3U << 30);
+  dma.is |= 1 << 17;                  // DDMA0 full transfer
+}
+
+/* A run loaded into CFG: 32-bit words between DRAM and the EP1 FIFO in the
+   F1C100s layout (widths at bits 8 and 24, one burst bit at 7 and 23), over
+   a buffer the driver has cleaned, or cleaned and invalidated for IN */
+static void dma_load (u32 v)
+{
+  u32 in = (v & 0x1F) == 4, mem = in ? dma.dst : dma.src;
+  u32 exp = (2 << 24) | (2 << 8) | (in ? (1 << 16) | (1 << 5) | 4 : (1 << 21) | (4 << 16) | 1);
+  musb_stat.dma_runs++;
+  dma.in = in;
+  dma.done = 0;
+  dma.t = 0;
+  dma.cfg = 0;
+  if((v & 0x037F037F) != exp) usb_error("DDMA0 CFG is not a 32-bit run between DRAM and the USB FIFO");
+  if((in ? dma.src : dma.dst) != fifo1()) usb_error("DDMA0 does not address the EP1 FIFO");
+  if(!cache_done(mem, dma.cnt, in ? CACHE_INV : CACHE_CLEAN))
+    usb_error("DDMA0 buffer without D-cache maintenance");
+  if(!dma.cnt || dma.cnt & 511) usb_error("DDMA0 count is not whole packets");
+  else dma.cfg = v | (1U << 30);
+}
+
+/*******************************************************************************
+                                    Events
+*******************************************************************************/
+static uint64_t musb_next (void)
+{
+  uint64_t t = 0, e[5] = { usb.ep0.x.t, usb.tx.x.t, usb.rx[0].x.t, usb.rx[1].x.t, dma.t };
+  for(int i = 0; i < 5; i++)
+    if(e[i] && (!t || e[i] < t)) t = e[i];
+  return t;
+}
+
+/* Takes the events up to the present in order */
+static void update (void)
+{
+  uint64_t t;
+  while((t = musb_next()) && t <= sim_ns)
+  {
+    now = t;
+    if(t == usb.ep0.x.t) ep0_event();
+    else if(t == dma.t) dma_event();
+    else if(t == usb.tx.x.t)
+    {
+      if(usb.tx.x.res == R_RETRY) usb.tx.x.t = 0, tx_kick();
+      else tx_event();
+    }
+    else
+    {
+      int i = t == usb.rx[0].x.t ? 0 : 1;
+      if(usb.rx[i].x.res == R_RETRY) usb.rx[i].x.t = 0, rx_kick(i);
+      else rx_event(i);
+    }
+    dma_kick();
+  }
+  now = sim_ns;
+}
+
+/*******************************************************************************
+                                   Registers
+*******************************************************************************/
+static u8 fifo_byte (int ep)
+{
+  struct RXP *p = &usb.rx[ep - 1];
+  if(!ep)
+  {
+    if(usb.ep0.rx_pos < usb.ep0.rx_n) return usb.ep0.rx[usb.ep0.rx_pos++];
+  }
+  else if(ep < 3 && p->cnt && p->pos < p->len[0]) return p->pkt[0][p->pos++];
+  usb_error("FIFO read past the packet");
+  return 0;
+}
+
+static void fifo_put (int ep, u8 b)
+{
+  struct TXP *p = &usb.tx;
+  if(!ep && usb.ep0.n < 64) usb.ep0.fifo[usb.ep0.n++] = b;
+  else if(ep == 1 && p->n < 512)
+  {
+    p->load[p->n++] = b;
+    if(p->csr & 0x8000 && p->n == IREG16(1, TXMAXP) && p->cnt < fifo_bufs(1, 0))
+      tx_load();                      // AutoSet
+  }
+  else usb_error("FIFO written past the packet");
+}
+
+/* Registers 0x40..0x9F as the CPU sees them */
+static void view (u8 *r)
+{
+  int i = usb.idx;
+  u16 csr;
+  memset(r, 0, 0xA0);
+  r[0x40] = (usb.power & ~0x10) | (usb.conn && !(usb.power & 8) ? 0x10 : 0);
+  r[0x41] = usb.devctl;
+  r[0x42] = usb.idx;
+  r[0x43] = usb.vend0;
+  memcpy(r + 0x44, &usb.ep_is, 4);
+  memcpy(r + 0x48, &usb.ep_ie, 4);
+  memcpy(r + 0x4C, &usb.bus_is, 4);
+  memcpy(r + 0x80, usb.reg[i], 32);
+  if(!i)
+  {
+    memcpy(r + OFS(TXCSR), &usb.ep0.csr, 2);
+    r[OFS(RXCOUNT)] = usb.ep0.rx_n - usb.ep0.rx_pos;
+    return;
+  }
+  if(i == 1)
+  {
+    csr = (usb.tx.csr & ~3) | (usb.tx.cnt == fifo_bufs(1, 0) ? 1 : 0) | (usb.tx.cnt ? 2 : 0);
+    memcpy(r + OFS(TXCSR), &csr, 2);
+  }
+  struct RXP *p = &usb.rx[i - 1];
+  csr = p->csr | (p->cnt ? 1 : 0) | (p->cnt == fifo_bufs(i, 1) ? 2 : 0) | (p->req ? 0x20 : 0);
+  memcpy(r + OFS(RXCSR), &csr, 2);
+  csr = p->cnt ? p->len[0] - p->pos : 0;
+  memcpy(r + OFS(RXCOUNT), &csr, 2);
+  memcpy(r + OFS(RXPKTCNT), &p->left, 2);
+}
+
+static u32 usb_rd (u32 addr, int len)
+{
+  u32 ofs = addr - (u32)(uintptr_t)USB, val = 0;
+  u8  r[0xA0];
+  update();
+  if(ofs < 0x40)
+  {
+    reg_moved();
+    if(ofs / 4 == 1 && dma.cfg & (1U << 30)) usb_error("CPU reads the EP1 FIFO during a DDMA0 run");
+    for(int i = 0; i < len; i++) val |= fifo_byte(ofs / 4) << (i * 8);
+    return val;
+  }
+  if(ofs >= 0xA0)
+  {
+    memcpy(&val, (void*)(uintptr_t)addr, len);
+    return val;
+  }
+  view(r);
+  memcpy(&val, r + ofs, len);
+  return val;
+}
+
+static void usb_wr (u32 addr, int len, u32 val)
+{
+  u32 ofs = addr - (u32)(uintptr_t)USB;
+  int i = usb.idx;
+  update();
+  if(ofs < 0x40)
+  {
+    reg_moved();
+    if(ofs / 4 == 1 && dma.cfg & (1U << 30)) usb_error("CPU writes the EP1 FIFO during a DDMA0 run");
+    for(int j = 0; j < len; j++) fifo_put(ofs / 4, val >> (j * 8));
+    return;
+  }
+  switch(ofs)
+  {
+    case 0x40:                        // POWER: the end of a reset resets the device
+      if(usb.power & 8 && !(val & 8) && usb.conn)
+      {
+        usb.addr = usb.new_addr = 0;
+        memset(usb.halt, 0, sizeof(usb.halt));
+        memset(usb.tog, 0, sizeof(usb.tog));
+        usb.dev->reset();
+      }
+      usb.power = val;
+      return;
+    case 0x41: usb.devctl = val; return;
+    case 0x42:
+      if(val > 2) usb_error("EP_IDX beyond the endpoints in use");
+      usb.idx = val & 3;
+      return;
+    case 0x43:
+      usb.vend0 = val;
+      dma_kick();
+      return;
+    case 0x44: usb.ep_is &= ~val; return;
+    case 0x48: usb.ep_ie = val; return;
+    case 0x4C: usb.bus_is &= ~val; return;
+  }
+  if(ofs < 0x80 || ofs >= 0xA0 || i > 2) return;
+  memcpy(&usb.reg[i][ofs - 0x80], &val, len);
+  if(ofs == OFS(TXCSR))
+  {
+    if(len != 2) usb_error("TXCSR access is not 16-bit");
+    if(!i) ep0_csr(val);
+    else if(i == 1) tx_csr(val);
+  }
+  else if(ofs == OFS(RXCSR) && i)
+  {
+    if(len != 2) usb_error("RXCSR access is not 16-bit");
+    rx_csr(i - 1, val);
+  }
+  else if(ofs == OFS(RXPKTCNT) && i) usb.rx[i - 1].left = val;
+  dma_kick();
+}
+
+static const struct REG_MODEL usb_model = { (u32)(uintptr_t)USB, 0x410, usb_rd, usb_wr, musb_next };
+
+/* DMA IE, IS and DDMA0, the other channels keep what was written */
+static u32 dma_rd (u32 addr, int len)
+{
+  update();
+  if(addr == (u32)(uintptr_t)&DMA->IS) return dma.is;
+  if(addr == (u32)(uintptr_t)&DDMA0->CFG) return dma.cfg;
+  return *(u32*)(uintptr_t)addr;
+}
+
+static void dma_wr (u32 addr, int len, u32 val)
+{
+  update();
+  if(addr == (u32)(uintptr_t)&DMA->IE) dma.ie = val;
+  else if(addr == (u32)(uintptr_t)&DMA->IS) dma.is &= ~val;
+  else if(addr == (u32)(uintptr_t)&DDMA0->SRC) dma.src = val;
+  else if(addr == (u32)(uintptr_t)&DDMA0->DST) dma.dst = val;
+  else if(addr == (u32)(uintptr_t)&DDMA0->CNT) dma.cnt = val;
+  else if(addr == (u32)(uintptr_t)&DDMA0->CFG)
+  {
+    if(val & (1U << 31)) dma_load(val);
+    else dma.cfg = val, dma.t = 0;
+  }
+  dma_kick();
+}
+
+static const struct REG_MODEL dma_model = { (u32)(uintptr_t)DMA, 0x320, dma_rd, dma_wr, NULL };
+
+/*******************************************************************************
+                                     Port
+*******************************************************************************/
+void musb_init (void)
+{
+  static u8 on;
+  memset(&usb, 0, sizeof(usb));
+  memset(&dma, 0, sizeof(dma));
+  memset(&musb_stat, 0, sizeof(musb_stat));
+  if(!on) reg_model(&usb_model), reg_model(&dma_model);
+  on = 1;
+}
+
+void musb_attach (const struct USB_DEV *dev)
+{
+  update();
+  usb.dev = dev;
+  usb.conn = 1;
+  usb.addr = 0;
+  usb.bus_is |= 0x10;                 // connect
+}
+
+void musb_detach (void)
+{
+  update();
+  usb.conn = 0;
+  usb.bus_is |= 0x20;                 // disconnect
+}
+
+/* The pipes NAKed are asked again at once, also before their retry or NAK
+   limit: a device answering a NAKed IN token as soon as it has data */
+void musb_wake (void)
+{
+  struct XFER *x[2] = { &usb.tx.x, &usb.rx[0].x };
+  update();
+  wake_all();
+  for(int i = 0; i < 2; i++)
+    if(x[i]->t > now + USB_NAK_NS && (x[i]->res == R_RETRY || x[i]->res == R_NAKTO))
+    {
+      x[i]->res = R_RETRY;
+      x[i]->t = now + USB_NAK_NS;
+    }
+}
+
+int musb_irq (void)
+{
+  update();
+  return (usb.ep_is & usb.ep_ie) || (dma.is & dma.ie);
+}
+
+void musb_dma_stall (int on)
+{
+  dma.stall = on;
+}
@@ -0,0 +1,47 @@
+#ifndef MUSB_H
+#define MUSB_H
+
+/* The MUSB host controller with one high-speed device on its port. The
+   model keeps the CSR bits, FIFOs and interrupt status the drivers see for
+   EP0, the double-buffered bulk pair of EP1 and the interrupt IN of EP2,
+   and moves the packets over a bus with modelled times. DDMA0 serves the
+   EP1 DMA requests of mode 1 and checks its run against the FIFO and the
+   D-cache maintenance of the buffer. The device model
+   answers each transaction with data, NAK or STALL; NAK limits, data
+   toggles, function addresses and the FIFO map are checked on the way, and
+   what real hardware would get wrong silently counts as a protocol error. */
+
+#define USB_NAK     (-1)
+#define USB_STALL   (-2)
+
+/* A device on the port, transactions are answered at bus time t. SET_ADDRESS
+   is taken by the model, halted endpoints and data toggles are kept by it */
+struct USB_DEV {
+  void (*reset) (void);
+  int (*ctrl) (const u8 *setup, u8 *data, uint64_t t);  // IN: bytes in data, OUT: the data stage received, USB_STALL
+  int (*out) (int ep, const u8 *pkt, u32 len, uint64_t t);  // 0, USB_NAK, USB_STALL
+  int (*in) (int ep, u8 *pkt, u32 max, uint64_t t);         // bytes, USB_NAK, USB_STALL
+  uint64_t (*next) (void);          // time a NAKing endpoint gets ready, 0 - not known
+};
+
+struct MUSB_STAT {
+  u32 setups;
+  u32 pkts;         // bulk and interrupt data packets
+  u32 naks;
+  u32 nakto;        // NAK limits expired
+  u32 stalls;
+  u32 dma_runs;     // DDMA0 runs loaded
+  u32 dma_bytes;
+  u32 errors;       // protocol errors
+};
+
+extern struct MUSB_STAT musb_stat;
+
+void musb_init (void);
+void musb_attach (const struct USB_DEV *dev);
+void musb_detach (void);
+void musb_wake (void);              // the device got something for a NAKed endpoint
+int musb_irq (void);                // an enabled USB or DMA interrupt is pending
+void musb_dma_stall (int on);       // EP1 DMA requests do not reach DDMA0
+
+#endif
@@ -0,0 +1,295 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <ucontext.h>
+#include <sys/mman.h>
+#include "sys.h"
+#include "mmu.h"
+#include "reg.h"
+
+enum { ACC_RD = 1, ACC_WR = 2 };
+
+uint64_t sim_ns;
+u32 reg_acc;
+void (*irq_hook) (void);
+
+static const struct REG_MODEL *model[8];
+static struct {
+  u32 addr;
+  int len;
+  int acc;
+  const struct REG_MODEL *m;
+} cur;
+
+static struct {
+  u32 addr, len;
+  int op;
+} cache_log[16];
+
+static struct {
+  u32 addr, val;
+} seen[256];                          // last value per register and direction
+static u32 spins, step, moved;
+
+/*******************************************************************************
+                                 Access decoder
+*******************************************************************************/
+/* Memory access of the x86-64 instruction at ip: ACC_RD, ACC_WR or both for
+   a read-modify-write, 0 for anything a register access is not compiled to */
+static int decode (const u8 *ip, int *len)
+{
+  int op16 = 0, rex_w = 0, ext;
+  for(;; ip++)
+  {
+    if(*ip == 0x66) op16 = 1;
+    else if((*ip & 0xF0) == 0x40) rex_w = *ip & 8;
+    else break;
+  }
+  *len = rex_w ? 8 : op16 ? 2 : 4;
+  ext = (ip[1] >> 3) & 7;
+  switch(ip[0])
+  {
+    case 0x88: *len = 1;              // mov
+    case 0x89: case 0xC7: return ACC_WR;
+    case 0xC6: *len = 1; return ACC_WR;
+    case 0x8A: *len = 1;
+    case 0x8B: return ACC_RD;
+    case 0x84: case 0x38: case 0x3A: *len = 1;  // test, cmp
+    case 0x85: case 0x39: case 0x3B: return ACC_RD;
+    case 0x80: *len = 1;              // immediate ALU group, /7 is cmp
+    case 0x81: case 0x83: return ext == 7 ? ACC_RD : ACC_RD | ACC_WR;
+    case 0xF6: *len = 1;              // test immediate
+    case 0xF7: return ext == 0 ? ACC_RD : 0;
+    case 0xFE: *len = 1;              // inc, dec
+    case 0xFF: return ext < 2 ? ACC_RD | ACC_WR : 0;
+    case 0x0F:                        // movzx, movsx
+      if(ip[1] == 0xB6 || ip[1] == 0xBE) { *len = 1; return ACC_RD; }
+      if(ip[1] == 0xB7 || ip[1] == 0xBF) { *len = 2; return ACC_RD; }
+      return 0;
+  }
+  if(ip[0] < 0x40 && (ip[0] & 7) < 4) // add, or, adc, sbb, and, sub, xor
+  {
+    if(!(ip[0] & 1)) *len = 1;
+    return ip[0] & 2 ? ACC_RD : ACC_RD | ACC_WR;
+  }
+  return 0;
+}
+
+static const struct REG_MODEL tim_model;
+static u8 ms_polled;
+
+/*******************************************************************************
+                                  Idle polling
+*******************************************************************************/
+static void skip (void)
+{
+  uint64_t t = UINT64_MAX, n;
+  for(int i = 0; i < 8 && model[i]; i++)
+    if(model[i]->next && (n = model[i]->next()) > sim_ns && n < t) t = n;
+  if(t == UINT64_MAX)
+  {
+    t = sim_ns + (1000ULL << step);
+    if(step < 10) step++;
+  }
+  sim_ns = t;
+  spins = 0;
+  ms_polled = 0;
+}
+
+/* Runs of accesses that read and write the values seen before */
+static void spin (u32 addr, u32 val, int acc)
+{
+  u32 i = ((addr >> 2) ^ (acc == ACC_WR ? 128 : 0)) & 255;
+  if(cur.m == &tim_model) return;
+  if(!moved && seen[i].addr == addr && seen[i].val == val)
+  {
+    if(++spins >= 16) skip();
+    return;
+  }
+  seen[i].addr = addr;
+  seen[i].val = val;
+  spins = step = moved = 0;
+}
+
+void reg_moved (void)
+{
+  moved = 1;
+}
+
+/* WFI: the CPU sleeps until the next event, then takes the interrupt */
+void irq_wait (void)
+{
+  skip();
+  if(irq_hook) irq_hook();
+}
+
+/*******************************************************************************
+                                  Trap engine
+*******************************************************************************/
+static void *page (u32 addr)
+{
+  return (void*)(uintptr_t)(addr & ~4095);
+}
+
+static void on_segv (int sig, siginfo_t *si, void *ctx)
+{
+  ucontext_t *uc = ctx;
+  u8  *ip = (u8*)uc->uc_mcontext.gregs[REG_RIP];
+  u32 addr = (u32)(uintptr_t)si->si_addr, val;
+  if((uintptr_t)si->si_addr - REG_BASE >= REG_SIZE || cur.acc ||
+    !(cur.acc = decode(ip, &cur.len)) || cur.len > 4)
+  {
+    fprintf(stderr, "drvsim: fault at %p, ip %p: %02X %02X %02X\n",
+      si->si_addr, ip, ip[0], ip[1], ip[2]);
+    abort();
+  }
+  cur.addr = addr;
+  cur.m = NULL;
+  for(int i = 0; i < 8 && model[i]; i++)
+    if(addr - model[i]->base < model[i]->size) cur.m = model[i];
+  sim_ns += REG_NS;
+  reg_acc++;
+  mprotect(page(addr), 4096, PROT_READ | PROT_WRITE);
+  if(cur.acc & ACC_RD && cur.m)
+  {
+    val = cur.m->rd(addr, cur.len);
+    memcpy((void*)(uintptr_t)addr, &val, cur.len);
+  }
+  if(cur.acc == ACC_RD)
+  {
+    val = 0;
+    memcpy(&val, (void*)(uintptr_t)addr, cur.len);
+    spin(addr, val, ACC_RD);
+  }
+  uc->uc_mcontext.gregs[REG_EFL] |= 0x100;  // TF: back here after the access
+}
+
+static void on_trap (int sig, siginfo_t *si, void *ctx)
+{
+  ucontext_t *uc = ctx;
+  u32 val = 0;
+  if(!cur.acc) abort();
+  if(cur.acc & ACC_WR)
+  {
+    memcpy(&val, (void*)(uintptr_t)cur.addr, cur.len);
+    if(cur.m) cur.m->wr(cur.addr, cur.len, val);
+    spin(cur.addr, val, ACC_WR);
+  }
+  mprotect(page(cur.addr), 4096, PROT_NONE);
+  uc->uc_mcontext.gregs[REG_EFL] &= ~0x100;
+  cur.acc = 0;
+}
+
+void reg_init (void)
+{
+  struct sigaction sa;
+  if(mmap((void*)REG_BASE, REG_SIZE, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS |
+    MAP_FIXED_NOREPLACE, -1, 0) != (void*)REG_BASE)
+  {
+    perror("drvsim: register window");
+    exit(1);
+  }
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_flags = SA_SIGINFO | SA_NODEFER;
+  sa.sa_sigaction = on_segv;
+  sigaction(SIGSEGV, &sa, NULL);
+  sa.sa_sigaction = on_trap;
+  sigaction(SIGTRAP, &sa, NULL);
+  reg_model(&tim_model);
+}
+
+void reg_model (const struct REG_MODEL *m)
+{
+  for(int i = 0; i < 8; i++)
+    if(!model[i])
+    {
+      model[i] = m;
+      return;
+    }
+}
+
+void sim_wait (uint64_t ns)
+{
+  sim_ns += ns;
+}
+
+/*******************************************************************************
+                              Timers, board glue
+*******************************************************************************/
+/* AVS counters in uS and mS, Timer2 counts down at 3MHz. A CPU polling
+   ctr_ms sees it change every mS */
+static struct { uint64_t us, ms; } avs;
+
+static u32 tim_rd (u32 addr, int len)
+{
+  if(addr == (u32)&TIM->AVS_CNT0) return sim_ns / 1000 - avs.us;
+  if(addr == (u32)&TIM->AVS_CNT1) return ms_polled = 1, sim_ns / 1000000 - avs.ms;
+  if(addr == (u32)&TIM->T2_CURV) return ~(u32)(sim_ns * 3 / 1000);
+  return *(u32*)(uintptr_t)addr;
+}
+
+static void tim_wr (u32 addr, int len, u32 val)
+{
+  if(addr == (u32)&TIM->AVS_CNT0) avs.us = sim_ns / 1000 - val;
+  if(addr == (u32)&TIM->AVS_CNT1) avs.ms = sim_ns / 1000000 - val;
+}
+
+static uint64_t tim_next (void)
+{
+  return ms_polled ? (sim_ns / 1000000 + 1) * 1000000 : 0;
+}
+
+static const struct REG_MODEL tim_model = { (u32)TIM, sizeof(TIM_T), tim_rd, tim_wr, tim_next };
+
+void delay (u32 ms)
+{
+  sim_wait(ms * 1000000ULL);
+}
+
+void udelay (u32 us)
+{
+  sim_wait(us * 1000ULL);
+}
+
+void usb_mux (enum USB_MUX_STATE i)
+{
+}
+
+/* Each maintenance call is logged, a DMA model takes the entry that covers
+   its buffer with the operation it needs */
+static void cache_op (u32 addr, u32 len, int op)
+{
+  memmove(&cache_log[1], &cache_log[0], sizeof(cache_log) - sizeof(cache_log[0]));
+  cache_log[0].addr = addr;
+  cache_log[0].len = len;
+  cache_log[0].op = op;
+}
+
+int cache_done (u32 addr, u32 len, int op)
+{
+  for(int i = 0; i < 16; i++)
+    if((cache_log[i].op & op) == op && addr >= cache_log[i].addr &&
+      addr + len <= cache_log[i].addr + cache_log[i].len)
+    {
+      cache_log[i].op = 0;
+      return 1;
+    }
+  return 0;
+}
+
+void mmu_clean_dcache (rt_uint32_t buffer, rt_uint32_t size)
+{
+  cache_op(buffer, size, CACHE_CLEAN);
+}
+
+void mmu_invalidate_dcache (rt_uint32_t buffer, rt_uint32_t size)
+{
+  cache_op(buffer, size, CACHE_INV);
+}
+
+void mmu_clean_invalidated_dcache (rt_uint32_t buffer, rt_uint32_t size)
+{
+  cache_op(buffer, size, CACHE_FLUSH);
+}
@@ -0,0 +1,44 @@
+#ifndef REG_H
+#define REG_H
+
+/* The F1C100s peripheral window on the host: the register structs of
+   f1c100s.h point into an inaccessible mapping at their real addresses, so
+   every access of the unmodified drivers traps. The faulting instruction is
+   decoded for its width, single-stepped, and the peripheral model behind the
+   address reads or receives the value. Registers without a model keep what
+   was written, like plain memory.
+
+   Time is modelled: every register access costs REG_NS, delay() and
+   udelay() advance the clock. TIM serves ctr_us, ctr_ms and Timer2 from it.
+   A driver polling registers that do not change is moved on to the next
+   event of a model, or in growing steps while no model has one. */
+
+#include <stdint.h>
+
+#define REG_BASE  0x01C00000
+#define REG_SIZE  0x00030000
+#define REG_NS    40            // AHB register access
+
+struct REG_MODEL {
+  u32 base;
+  u32 size;
+  u32 (*rd) (u32 addr, int len);             // value of a read of len bytes
+  void (*wr) (u32 addr, int len, u32 val);   // a write of len bytes
+  uint64_t (*next) (void);                   // time of the next change, 0 - none
+};
+
+extern uint64_t sim_ns;       // modelled time
+extern u32 reg_acc;           // register accesses
+
+void reg_init (void);
+void reg_model (const struct REG_MODEL *m);
+void sim_wait (uint64_t ns);
+void reg_moved (void);        // the access moved data, it is not polling
+
+extern void (*irq_hook) (void);   // interrupt handler, run from IRQ_WAIT()
+
+/* D-cache maintenance done by the drivers, checked by the DMA models */
+enum CACHE_OP { CACHE_CLEAN = 1, CACHE_INV = 2, CACHE_FLUSH = 3 };
+int cache_done (u32 addr, u32 len, int op);
+
+#endif
@@ -0,0 +1,535 @@
+#include <stdio.h>
+#include <string.h>
+#include "sys.h"
+#include "reg.h"
+#include "musb.h"
+#include "rtldev.h"
+#include "r8152.h"
+
+#define RTL_WIRE_NS(n)  (((n) + 24) * 80ULL)  // frame, CRC, preamble and gap at 100Mbit/s
+#define RTL_AGG         16384   // RX aggregation, the transfers of the host
+#define RTL_AGG_NS      250000  // a transfer is started after, COALESCE_HIGH
+#define RTL_RXQ         256     // frames in the RX FIFO
+#define RTL_TXFIFO      (12288 * 80ULL)       // wire time the TX FIFO holds
+#define RTL_TXQ         1024    // frames sent, kept for the test
+
+#define BMCR            (OCP_BASE_MII + MII_BMCR * 2)
+#define BMSR            (OCP_BASE_MII + MII_BMSR * 2)
+
+struct RTL_STAT rtl_stat;
+
+static const u8 dsc_dev[18] = {
+  18, 1, 0x10, 0x02, 0, 0, 0, 64,
+  0xDA, 0x0B, 0x52, 0x81, 0x00, 0x20, 1, 2, 3, 1
+};
+
+static const u8 dsc_cfg[39] = {
+  9, 2, 39, 0, 1, 1, 0, 0xA0, 50,
+  9, 4, 0, 0, 3, 0xFF, 0xFF, 0, 0,  // vendor specific
+  7, 5, 0x81, 2, 0x00, 0x02, 0,     // bulk IN 512
+  7, 5, 0x02, 2, 0x00, 0x02, 0,     // bulk OUT 512
+  7, 5, 0x83, 3, 0x02, 0x00, 8      // interrupt IN 2, 16mS
+};
+
+struct FRAME {
+  u8  data[1536];
+  u32 len;
+  int flags;
+  uint64_t t;               // received from the wire
+};
+
+static struct {
+  u8  pla[0x10000], usb[0x10000];
+  u8  phy[0x10000];         // PHY OCP registers behind the GPHY window
+  u8  link, reported, stall;
+  struct FRAME rxq[RTL_RXQ];
+  u32 rx_head, rx_tail;
+  uint64_t rx_t;            // wire busy receiving until
+  u8  agg[RTL_AGG];         // bulk IN transfer being sent
+  u32 agg_len, agg_pos;
+  u8  zlp, cut;
+  u8  txs[4096];            // bulk OUT bytes not decoded yet
+  u32 tx_n;
+  uint64_t tx_t;            // wire busy sending until
+  u8  tx_nak;               // OUT NAKed with the FIFO full
+  struct FRAME txq[RTL_TXQ];
+  u32 tx_head, tx_tail;
+} rtl;
+
+static void rtl_error (char *str)
+{
+  if(rtl_stat.errors++ < 10) printf("RTL8152 model: %s\n", str);
+}
+
+static u32 rd16 (const u8 *p)
+{
+  return p[0] | p[1] << 8;
+}
+
+static u32 rd32 (const u8 *p)
+{
+  return p[0] | p[1] << 8 | p[2] << 16 | (u32)p[3] << 24;
+}
+
+static u32 be16 (const u8 *p)
+{
+  return p[0] << 8 | p[1];
+}
+
+/* One's complement sum of big-endian halfwords, not complemented */
+static u32 sum16 (const u8 *p, u32 n, u32 sum)
+{
+  for(; n > 1; p += 2, n -= 2) sum += be16(p);
+  if(n) sum += p[0] << 8;
+  while(sum >> 16) sum = (sum & 0xFFFF) + (sum >> 16);
+  return sum;
+}
+
+static void put16 (u8 *p, u32 v)
+{
+  p[0] = v >> 8;
+  p[1] = v;
+}
+
+/*******************************************************************************
+                                    Frames
+*******************************************************************************/
+/* IPv4 header length of an Ethernet frame, 0 if it is something else. The
+   L4 segment is complete when the frame holds the whole datagram and it is
+   not a fragment */
+static u32 ipv4 (const u8 *f, u32 n, u32 *l4)
+{
+  u32 hl = (f[14] & 15) * 4, tot;
+  *l4 = 0;
+  if(n < 34 || be16(f + 12) != 0x0800 || f[14] >> 4 != 4 || hl < 20 || 14 + hl > n) return 0;
+  tot = be16(f + 16);
+  if(tot >= hl && 14 + tot <= n && !(be16(f + 20) & 0x3FFF)) *l4 = tot - hl;
+  return hl;
+}
+
+/* Sum of the L4 segment with the pseudo header, 0xFFFF if it is right */
+static u32 l4_sum (const u8 *f, u32 hl, u32 len)
+{
+  u32 sum = sum16(f + 26, 8, f[23] + len);
+  return sum16(f + 14 + hl, len, sum);
+}
+
+/* The checksum results the device puts in rx_desc */
+static void rx_check (const u8 *f, u32 n, u32 *opts2, u32 *opts3)
+{
+  u32 l4, hl = ipv4(f, n, &l4);
+  *opts2 = *opts3 = 0;
+  if(!hl) return;
+  *opts2 |= RD_IPV4_CS;
+  if(sum16(f + 14, hl, 0) != 0xFFFF) *opts3 |= IPF;
+  if(!l4) return;
+  if(f[23] == 6)
+  {
+    *opts2 |= RD_TCP_CS;
+    if(l4_sum(f, hl, l4) != 0xFFFF) *opts3 |= TCPF;
+  }
+  if(f[23] == 17)
+  {
+    *opts2 |= RD_UDP_CS;
+    if(be16(f + 14 + hl + 6) && l4_sum(f, hl, l4) != 0xFFFF) *opts3 |= UDPF;
+  }
+}
+
+/* What leaves on the wire has to carry right checksums */
+static void wire_check (const u8 *f, u32 n)
+{
+  u32 l4, hl = ipv4(f, n, &l4);
+  if(!hl) return;
+  if(sum16(f + 14, hl, 0) != 0xFFFF) rtl_error("IPv4 header checksum wrong on the wire");
+  if(!l4) return;
+  if((f[23] == 6 || (f[23] == 17 && be16(f + 14 + hl + 6))) && l4_sum(f, hl, l4) != 0xFFFF)
+    rtl_error(f[23] == 6 ? "TCP checksum wrong on the wire" : "UDP checksum wrong on the wire");
+  if(f[23] == 1 && sum16(f + 14 + hl, l4, 0) != 0xFFFF) rtl_error("ICMP checksum wrong on the wire");
+}
+
+/* Checksums the tx_desc asks for. The TCP checksum field holds the pseudo
+   header sum the driver put there, the device adds the segment to it */
+static void tx_offload (u8 *f, u32 n, u32 opts2)
+{
+  u32 l4, hl = ipv4(f, n, &l4), ho = (opts2 >> TCPHO_SHIFT) & TCPHO_MAX;
+  if(!(opts2 & (IPV4_CS | TCP_CS | UDP_CS))) return;
+  if(!hl)
+  {
+    rtl_error("checksum offload on a frame that is not IPv4");
+    return;
+  }
+  if(opts2 & IPV4_CS)
+  {
+    put16(f + 24, 0);
+    put16(f + 24, ~sum16(f + 14, hl, 0));
+    rtl_stat.tx_csum++;
+  }
+  if(opts2 & UDP_CS) rtl_error("UDP checksum offload is not used by the driver");
+  if(!(opts2 & TCP_CS)) return;
+  if(f[23] != 6 || !l4 || ho != 14 + hl || l4 < 20)
+  {
+    rtl_error("TCPHO is not the TCP header of a whole IPv4 segment");
+    return;
+  }
+  put16(f + ho + 16, ~sum16(f + ho, l4, 0));
+  rtl_stat.tx_csum++;
+}
+
+/*******************************************************************************
+                                 OCP registers
+*******************************************************************************/
+static int link_up (void)
+{
+  return rtl.link && !(rd16(rtl.phy + BMCR) & BMCR_PDOWN);
+}
+
+/* Byte of a register space, the PLA window at 0xB000 maps the PHY */
+static u8 *ocp_byte (u16 type, u16 a)
+{
+  if(type == MCU_TYPE_PLA && a >= 0xB000 && a < 0xC000)
+    return &rtl.phy[(rd16(rtl.pla + PLA_OCP_GPHY_BASE) + (a & 0xFFF)) & 0xFFFF];
+  return type == MCU_TYPE_PLA ? &rtl.pla[a] : &rtl.usb[a];
+}
+
+/* Status bits as a read finds them */
+static void status (uint64_t t)
+{
+  u16 bmsr = rd16(rtl.phy + BMSR) & ~4;
+  rtl.pla[PLA_PHYSTATUS] = link_up() ? LINK_STATUS | _100bps | FULL_DUP : 0;
+  rtl.pla[PLA_PHY_PWR + 3] |= (PLA_PHY_PWR_LLR | PLA_PHY_PWR_TXEMP) >> 24;
+  if(rtl.tx_t <= t) rtl.pla[PLA_TCR0 + 1] |= TCR0_TX_EMPTY >> 8;
+  else rtl.pla[PLA_TCR0 + 1] &= ~(TCR0_TX_EMPTY >> 8);
+  if(link_up()) bmsr |= 4;
+  rtl.phy[BMSR] = bmsr;
+  rtl.phy[BMSR + 1] = bmsr >> 8;
+}
+
+/* The NIC reset clears the receiver and transmitter and their FIFOs */
+static void nic_reset (void)
+{
+  rtl.pla[PLA_CR] &= ~(PLA_CR_RST | PLA_CR_RE | PLA_CR_TE);
+  rtl.rx_tail = rtl.rx_head;
+  rtl.tx_n = 0;
+}
+
+static void ocp_write (u16 type, u16 a, u8 be, const u8 *d, u32 n)
+{
+  u8  first = be & 15, last = be >> 4, m, *p;
+  if(n < 4 || n & 3 || a & 3 || a + n > 0x10000)
+  {
+    rtl_error("OCP write is not whole dwords");
+    return;
+  }
+  if(n == 4 && first != last) rtl_error("byte enables of a single dword differ");
+  if(n > 4 && (!first || !last)) rtl_error("OCP burst without a first or last byte");
+  for(u32 i = 0; i < n; i++)
+  {
+    m = i < 4 ? first : i >= n - 4 ? last : 15;
+    if(!(m >> (i & 3) & 1)) continue;
+    p = ocp_byte(type, a + i);
+    if(type == MCU_TYPE_PLA && a + i >= PLA_IDR && a + i < PLA_IDR + 6 &&
+      rtl.pla[PLA_CRWECR] != CRWECR_CONFIG) continue;   // the MAC is locked
+    *p = d[i];
+  }
+  if(type != MCU_TYPE_PLA) return;
+  if(rtl.pla[PLA_CR] & PLA_CR_RST) nic_reset();
+  rtl.pla[PLA_SFF_STS_7 + 1] &= ~(RE_INIT_LL >> 8);
+  rtl.phy[BMCR + 1] &= ~(BMCR_RESET >> 8);
+}
+
+static void ocp_read (u16 type, u16 a, u8 *d, u32 n, uint64_t t)
+{
+  if(n < 4 || n > 64 || n & 3 || a & 3 || a + n > 0x10000)
+  {
+    rtl_error("OCP read is not 1 to 16 whole dwords");
+    return;
+  }
+  status(t);
+  for(u32 i = 0; i < n; i++) d[i] = *ocp_byte(type, a + i);
+}
+
+/*******************************************************************************
+                                      EP0
+*******************************************************************************/
+static int str_dsc (u8 idx, u8 *data)
+{
+  static const char *str[] = { NULL, "Realtek", "USB 10/100 LAN", "000001" };
+  int n = 2;
+  if(!idx)
+  {
+    memcpy(data, "\x04\x03\x09\x04", 4);
+    return 4;
+  }
+  if(idx > 3) return USB_STALL;
+  for(const char *s = str[idx]; *s; s++, n += 2) data[n] = *s, data[n + 1] = 0;
+  data[0] = n;
+  data[1] = 3;
+  return n;
+}
+
+/* OCP access: wValue the address, wIndex the MCU type and for writes the
+   byte enables of the first (bits 0..3) and last dword (bits 4..7) */
+static int rtl_ctrl (const u8 *s, u8 *data, uint64_t t)
+{
+  u16 req = s[0] | s[1] << 8, val = s[2] | s[3] << 8, idx = s[4] | s[5] << 8, len = s[6] | s[7] << 8;
+  switch(req)
+  {
+    case 0x0680:
+      if(s[3] == 1) return memcpy(data, dsc_dev, 18), 18;
+      if(s[3] == 2) return memcpy(data, dsc_cfg, sizeof(dsc_cfg)), sizeof(dsc_cfg);
+      if(s[3] == 3) return str_dsc(s[2], data);
+      return USB_STALL;
+    case 0x0900: return s[2] == 1 ? 0 : USB_STALL;
+    case 0x0102: return 0;
+    case 0x05C0:
+    case 0x0540:
+      rtl_stat.ctrl++;
+      if((idx & 0xFF00) != MCU_TYPE_PLA && (idx & 0xFF00) != MCU_TYPE_USB)
+      {
+        rtl_error("OCP access to an unknown MCU type");
+        return USB_STALL;
+      }
+      if(req == 0x0540)
+      {
+        ocp_write(idx & 0xFF00, val, idx, data, len);
+        return 0;
+      }
+      if(idx & 0xFF) rtl_error("byte enables on an OCP read");
+      ocp_read(idx & 0xFF00, val, data, len, t);
+      return len;
+  }
+  return USB_STALL;
+}
+
+/*******************************************************************************
+                                   Bulk data
+*******************************************************************************/
+static int rx_take (const u8 *f)
+{
+  u32 rcr = rd32(rtl.pla + PLA_RCR);
+  if(!(rtl.pla[PLA_CR] & PLA_CR_RE)) return 0;
+  if(rcr & RCR_AAP) return 1;
+  if(f[0] & 1)
+    return memcmp(f, "\xFF\xFF\xFF\xFF\xFF\xFF", 6) ? (rcr & RCR_AM) != 0 : (rcr & RCR_AB) != 0;
+  return rcr & RCR_APM && !memcmp(f, rtl.pla + PLA_IDR, 6);
+}
+
+/* Time the next bulk IN transfer starts: the first frame waited RTL_AGG_NS
+   or the frames received fill it, 0 if there is none */
+static uint64_t agg_time (void)
+{
+  struct FRAME *f;
+  uint64_t t;
+  u32 n = 0;
+  if(rtl.rx_tail == rtl.rx_head) return 0;
+  t = rtl.rxq[rtl.rx_tail % RTL_RXQ].t;
+  if(rd16(rtl.usb + USB_USB_CTRL) & RX_AGG_DISABLE) return t;
+  t += RTL_AGG_NS;
+  for(u32 i = rtl.rx_tail; i != rtl.rx_head && (f = &rtl.rxq[i % RTL_RXQ])->t < t; i++)
+    if((n += ALIGN(sizeof(struct rx_desc) + f->len + CRC_SIZE, RX_ALIGN)) > RTL_AGG) return f->t;
+  return t;
+}
+
+/* A bulk IN transfer of the frames received by t: rx_desc, the frame and
+   its CRC, each record padded to RX_ALIGN. It ends with a short packet, or
+   a zero-length one after whole packets */
+static int agg_build (uint64_t t)
+{
+  struct FRAME *f;
+  u32 rec, n, o2, o3, last = 0;
+  rtl.agg_len = rtl.agg_pos = 0;
+  while(rtl.rx_tail != rtl.rx_head && (f = &rtl.rxq[rtl.rx_tail % RTL_RXQ])->t <= t)
+  {
+    n = f->len + CRC_SIZE;
+    rec = ALIGN(sizeof(struct rx_desc) + n, RX_ALIGN);
+    if(rtl.agg_len + sizeof(struct rx_desc) + n > RTL_AGG) break;
+    rtl.rx_tail++;
+    if(!rx_take(f->data))
+    {
+      rtl_stat.rx_filter++;
+      continue;
+    }
+    rx_check(f->data, f->len, &o2, &o3);
+    if(f->flags & RTL_RX_NOCS) o2 = o3 = 0;
+    memset(rtl.agg + rtl.agg_len, 0, rec < RTL_AGG - rtl.agg_len ? rec : RTL_AGG - rtl.agg_len);
+    *(u32*)(rtl.agg + rtl.agg_len) = n | (f->flags & RTL_RX_CRC ? RD_CRC : 0);
+    *(u32*)(rtl.agg + rtl.agg_len + 4) = o2;
+    *(u32*)(rtl.agg + rtl.agg_len + 8) = o3;
+    memcpy(rtl.agg + rtl.agg_len + sizeof(struct rx_desc), f->data, f->len);
+    last = rtl.agg_len;
+    rtl.agg_len += rec;
+    rtl_stat.rx_frames++;
+    if(rd16(rtl.usb + USB_USB_CTRL) & RX_AGG_DISABLE) break;
+  }
+  if(!rtl.agg_len) return 0;
+  if(rtl.agg_len > RTL_AGG) rtl.agg_len = RTL_AGG;
+  if(rtl.cut)                           // the last frame is cut in half
+  {
+    rtl.agg_len = last + sizeof(struct rx_desc) + (rtl.agg[last] | rtl.agg[last + 1] << 8) / 2;
+    rtl.cut = 0;
+  }
+  rtl.zlp = !(rtl.agg_len & 511) && rtl.agg_len < RTL_AGG;
+  rtl_stat.rx_xfers++;
+  return 1;
+}
+
+static int int_in (u8 *pkt)
+{
+  if(rtl.stall) return USB_STALL;
+  if(link_up() == rtl.reported) return USB_NAK;
+  rtl.reported = link_up();
+  pkt[0] = rtl.reported ? INTR_LINK : 0;
+  pkt[1] = 0;
+  rtl_stat.ints++;
+  return INTBUFSIZE;
+}
+
+static int rtl_in (int ep, u8 *pkt, u32 max, uint64_t t)
+{
+  u32 n;
+  if(ep == 3) return int_in(pkt);
+  if(ep != 1)
+  {
+    rtl_error("IN from an endpoint the device does not have");
+    return USB_STALL;
+  }
+  if(rtl.agg_pos == rtl.agg_len)
+  {
+    if(rtl.zlp) return rtl.zlp = 0;
+    if(!agg_time() || agg_time() > t || !agg_build(t)) return USB_NAK;
+  }
+  n = rtl.agg_len - rtl.agg_pos < max ? rtl.agg_len - rtl.agg_pos : max;
+  memcpy(pkt, rtl.agg + rtl.agg_pos, n);
+  rtl.agg_pos += n;
+  return n;
+}
+
+/* A frame of the OUT stream goes on the wire when the wire is free */
+static void tx_frame (u8 *f, u32 n, u32 opts2, uint64_t t)
+{
+  struct FRAME *q = &rtl.txq[rtl.tx_head % RTL_TXQ];
+  if(!(rtl.pla[PLA_CR] & PLA_CR_TE)) rtl_error("frame sent with the transmitter off");
+  tx_offload(f, n, opts2);
+  wire_check(f, n);
+  rtl.tx_t = (rtl.tx_t > t ? rtl.tx_t : t) + RTL_WIRE_NS(n < 60 ? 60 : n);
+  rtl_stat.tx_frames++;
+  if(rtl.tx_head - rtl.tx_tail == RTL_TXQ) return;
+  memcpy(q->data, f, n);
+  q->len = n;
+  q->t = rtl.tx_t;
+  rtl.tx_head++;
+}
+
+/* Bulk OUT is a stream of tx_desc records aligned to TX_ALIGN, a short
+   packet has to end it between two of them */
+static int rtl_out (int ep, const u8 *pkt, u32 len, uint64_t t)
+{
+  u32 o1, n, rec;
+  if(ep != 2)
+  {
+    rtl_error("OUT to an endpoint the device does not have");
+    return USB_STALL;
+  }
+  if((rtl.tx_nak = rtl.tx_t > t + RTL_TXFIFO)) return USB_NAK;
+  memcpy(rtl.txs + rtl.tx_n, pkt, len);
+  rtl.tx_n += len;
+  while(rtl.tx_n >= sizeof(struct tx_desc))
+  {
+    o1 = rd32(rtl.txs);
+    n = o1 & TX_LEN_MAX;
+    rec = ALIGN(sizeof(struct tx_desc) + n, TX_ALIGN);
+    if((o1 & (TX_FS | TX_LS)) != (TX_FS | TX_LS) || n < 14 || n > 1514)
+    {
+      rtl_error("tx_desc is not a whole frame of 14 to 1514 bytes");
+      rtl.tx_n = 0;
+      break;
+    }
+    if(rtl.tx_n < rec) break;
+    tx_frame(rtl.txs + sizeof(struct tx_desc), n, rd32(rtl.txs + 4), t);
+    memmove(rtl.txs, rtl.txs + rec, rtl.tx_n -= rec);
+  }
+  if(len < 512 && rtl.tx_n)
+  {
+    rtl_error("bulk OUT transfer ends inside a frame");
+    rtl.tx_n = 0;
+  }
+  return 0;
+}
+
+/* The next RX transfer or the TX FIFO getting room */
+static uint64_t rtl_next (void)
+{
+  uint64_t t = agg_time();
+  if(rtl.tx_nak && (!t || rtl.tx_t - RTL_TXFIFO < t)) t = rtl.tx_t - RTL_TXFIFO;
+  return t;
+}
+
+static void rtl_reset (void)
+{
+  rtl.agg_len = rtl.agg_pos = rtl.zlp = 0;
+  rtl.tx_n = 0;
+  rtl.reported = 0;
+}
+
+const struct USB_DEV rtl_dev = { rtl_reset, rtl_ctrl, rtl_out, rtl_in, rtl_next };
+
+/*******************************************************************************
+                                     Wire
+*******************************************************************************/
+void rtl_init (void)
+{
+  memset(&rtl, 0, sizeof(rtl));
+  memset(&rtl_stat, 0, sizeof(rtl_stat));
+  rtl.pla[PLA_TCR1 + 1] = 0x4C;         // RTL_VER_01
+  rtl.usb[USB_USB_CTRL] = RX_AGG_DISABLE;
+  rtl.phy[BMCR + 1] = (BMCR_PDOWN | BMCR_ANENABLE) >> 8;
+  rtl.phy[BMSR] = 0x09;
+  rtl.phy[BMSR + 1] = 0x78;
+}
+
+u8 *rtl_ocp (u16 type)
+{
+  return type == MCU_TYPE_PLA ? rtl.pla : rtl.usb;
+}
+
+void rtl_link (int up)
+{
+  rtl.link = up;
+}
+
+void rtl_int_stall (int on)
+{
+  rtl.stall = on;
+}
+
+void rtl_rx (const u8 *frame, u32 len, int flags)
+{
+  struct FRAME *f = &rtl.rxq[rtl.rx_head % RTL_RXQ];
+  if(len > 1514) len = 1514;
+  rtl.rx_t = (rtl.rx_t > sim_ns ? rtl.rx_t : sim_ns) + RTL_WIRE_NS(len < 60 ? 60 : len);
+  if(!rtl.link || rtl.rx_head - rtl.rx_tail == RTL_RXQ)
+  {
+    rtl_stat.rx_filter++;
+    return;
+  }
+  memcpy(f->data, frame, len);
+  f->len = len;
+  f->flags = flags;
+  f->t = rtl.rx_t;
+  rtl.rx_head++;
+  musb_wake();
+}
+
+void rtl_rx_cut (void)
+{
+  rtl.cut = 1;
+}
+
+u32 rtl_tx (u8 *frame)
+{
+  struct FRAME *q = &rtl.txq[rtl.tx_tail % RTL_TXQ];
+  if(rtl.tx_tail == rtl.tx_head) return 0;
+  memcpy(frame, q->data, q->len);
+  rtl.tx_tail++;
+  return q->len;
+}
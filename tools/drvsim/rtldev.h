@@ -0,0 +1,49 @@
+#ifndef RTLDEV_H
+#define RTLDEV_H
+
+/* An RTL8152B USB Ethernet adapter on the MUSB model. The PLA and USB MCU
+   register spaces take the OCP control transfers of r8152.c with the byte
+   enables of their first and last dword, the PHY sits behind the GPHY
+   window. Frames from the wire arrive at 100Mbit/s and are aggregated for
+   up to 250uS into bulk IN transfers behind rx_desc records with the
+   checksum results of the device. Bulk OUT transfers are split by their tx_desc records, the
+   offloaded checksums are inserted and every frame is checked on the wire at
+   100Mbit/s, the TX FIFO NAKs while it is full. The interrupt endpoint
+   reports link changes. What the device would reject or send broken counts
+   as a protocol error. */
+
+#define RTL_RX_CRC    1         // the frame arrives with a CRC error
+#define RTL_RX_NOCS   2         // the device does not verify its checksums
+
+struct RTL_STAT {
+  u32 ctrl;         // OCP control transfers
+  u32 rx_frames;    // frames sent to the host
+  u32 rx_xfers;     // bulk IN transfers
+  u32 rx_filter;    // frames the receiver did not take
+  u32 tx_frames;    // frames sent on the wire
+  u32 tx_csum;      // checksums inserted by the offload
+  u32 ints;         // interrupt endpoint reports
+  u32 errors;       // protocol errors
+};
+
+/* A table of register, value pairs of r8152_fw.c (rtlfw.c) */
+struct OCP_TBL {
+  const char *name;
+  u16 type;
+  const u16 *tbl;
+  int n;
+};
+
+extern struct RTL_STAT rtl_stat;
+extern const struct USB_DEV rtl_dev;
+extern const struct OCP_TBL ocp_bp[];       // the breakpoint tables, NULL name at the end
+
+void rtl_init (void);                       // power-on state, no cable
+u8 *rtl_ocp (u16 type);                     // OCP space of MCU_TYPE_PLA or MCU_TYPE_USB
+void rtl_link (int up);                     // cable plugged in or pulled
+void rtl_int_stall (int on);                // the interrupt endpoint STALLs
+void rtl_rx (const u8 *frame, u32 len, int flags);  // a frame from the wire
+void rtl_rx_cut (void);                     // the next transfer ends inside its last frame
+u32 rtl_tx (u8 *frame);                     // next frame sent on the wire, its length or 0
+
+#endif
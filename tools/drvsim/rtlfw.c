@@ -0,0 +1,20 @@
+/* The breakpoint tables of r8152_fw.c are static: it is built here, with a
+   list of them for the OCP check */
+#include "r8152_fw.c"
+#include "rtldev.h"
+
+#define TBL(type, t)  { #t, type, t, ARRAY_SIZE(t) }
+
+const struct OCP_TBL ocp_bp[] = {
+  TBL(MCU_TYPE_PLA, r8152b_pla_patch_a_bp),
+  TBL(MCU_TYPE_PLA, r8152b_pla_patch_a2_bp),
+  TBL(MCU_TYPE_USB, r8153_usb_patch_b_bp),
+  TBL(MCU_TYPE_PLA, r8153_pla_patch_b_bp),
+  TBL(MCU_TYPE_USB, r8153_usb_patch_c_bp),
+  TBL(MCU_TYPE_PLA, r8153_pla_patch_c_bp),
+  TBL(MCU_TYPE_USB, r8153_usb_patch_d_bp),
+  TBL(MCU_TYPE_PLA, r8153_pla_patch_d_bp),
+  TBL(MCU_TYPE_USB, r8153b_usb_patch_b_bp),
+  TBL(MCU_TYPE_PLA, r8153b_pla_patch_b_bp),
+  { NULL }
+};
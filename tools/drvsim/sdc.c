@@ -0,0 +1,284 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sys.h"
+#include "reg.h"
+#include "sdc.h"
+
+#define SDC_WORD_NS   160       // 4 bytes on a 4-bit bus at 50MHz
+#define SDC_CMD_NS    2000      // command and response
+#define SDC_ACC_NS    100000    // read access time of the first block
+#define SDC_GAP_NS    5000      // between the blocks of a multi-block read
+#define SDC_BUSY_NS   20000     // busy after each block of a write
+#define SDC_PRG_NS    500000    // programming after a write
+
+#define REG(r)        (u32)(uintptr_t)&SD0->r
+
+struct SDC_STAT sdc_stat;
+
+static u8 *card;
+
+static struct {
+  u32 reg[0x200 / 4];       // registers as written
+  u32 ris;
+  u32 resp[4];
+  uint64_t cmd_t;           // command done
+  uint64_t stop_t;          // auto stop done
+  uint64_t busy_t;          // programming done
+  u32 rca;
+  u8  app;                  // CMD55 seen
+  u8  acmd41;               // ACMD41 polls answered busy
+  /* data phase */
+  u8  dir;                  // 0 - none, 1 - read, 2 - write
+  u8  multi;
+  u32 words, pos;           // FIFO words of the transfer, moved by the CPU
+  u32 cons;                 // write words taken by the card
+  u8  *data;
+  uint64_t avail;           // read: time the word at pos is in the FIFO
+  uint64_t *t;              // read: time each word was taken by the CPU,
+                            // write: time each word was taken by the card
+  u8  status[64];
+} sdc;
+
+static void sdc_error (char *str)
+{
+  if(sdc_stat.errors++ < 10) printf("SD model: %s\n", str);
+}
+
+/* Card side time of word i: the access time, the block gap or the busy time
+   of the block before comes first */
+static uint64_t word_ns (u32 i)
+{
+  if(i % 128) return SDC_WORD_NS;
+  if(sdc.dir == 2) return SDC_WORD_NS + (i ? SDC_BUSY_NS : 0);
+  return SDC_WORD_NS + (i ? SDC_GAP_NS : SDC_ACC_NS);
+}
+
+static void data_start (int dir, u8 *data, u32 bytes, int multi)
+{
+  sdc.dir = dir;
+  sdc.multi = multi;
+  sdc.data = data;
+  sdc.words = bytes / 4;
+  sdc.pos = sdc.cons = 0;
+  sdc.avail = sim_ns + SDC_CMD_NS + word_ns(0);
+  sdc.t = calloc(sdc.words, sizeof(uint64_t));
+}
+
+static void update (void)
+{
+  if(sdc.cmd_t && sim_ns >= sdc.cmd_t)
+  {
+    sdc.ris |= 4;
+    sdc.cmd_t = 0;
+  }
+  if(sdc.dir == 2)
+    while(sdc.cons < sdc.pos && sdc.t[sdc.cons] <= sim_ns) sdc.cons++;
+  if(sdc.dir && sdc.pos == sdc.words && (sdc.dir == 1 || sdc.cons == sdc.words))
+  {                         // data over, the stop command follows
+    sdc.ris |= 8;
+    if(sdc.multi) sdc.stop_t = sim_ns + SDC_CMD_NS;
+    if(sdc.dir == 2) sdc.busy_t = sim_ns + SDC_PRG_NS;
+    sdc.dir = 0;
+    free(sdc.t);
+  }
+  if(sdc.stop_t && sim_ns >= sdc.stop_t)
+  {
+    sdc.ris |= 1 << 14;
+    sdc.stop_t = 0;
+  }
+}
+
+static u32 fifo_empty (void)
+{
+  return sdc.dir != 1 || sdc.pos == sdc.words || sdc.avail > sim_ns;
+}
+
+static u32 fifo_full (void)
+{
+  return sdc.dir == 2 && sdc.pos - sdc.cons >= SDC_FIFO;
+}
+
+static u32 fifo_pop (void)
+{
+  u32 w, i = sdc.pos;
+  uint64_t t;
+  if(fifo_empty())
+  {
+    sdc_error("FIFO read while empty");
+    return 0;
+  }
+  memcpy(&w, sdc.data + i * 4, 4);
+  reg_moved();
+  sdc.t[i] = sim_ns;
+  sdc.pos++;
+  if(sdc.pos < sdc.words)
+  {                         // the card waits for room in the FIFO
+    t = sdc.pos >= SDC_FIFO ? sdc.t[sdc.pos - SDC_FIFO] : 0;
+    sdc.avail = (sdc.avail > t ? sdc.avail : t) + word_ns(sdc.pos);
+  }
+  return w;
+}
+
+static void fifo_push (u32 w)
+{
+  u32 i = sdc.pos;
+  uint64_t t;
+  if(sdc.dir != 2 || i == sdc.words || fifo_full())
+  {
+    sdc_error("FIFO write while full");
+    return;
+  }
+  memcpy(sdc.data + i * 4, &w, 4);
+  reg_moved();
+  t = i && sdc.t[i - 1] > sim_ns ? sdc.t[i - 1] : sim_ns;
+  sdc.t[i] = t + word_ns(i);
+  sdc.pos++;
+}
+
+/* Data commands: block addressing (SDHC), BYC has to match the command */
+static void data_cmd (u32 cmd, u32 idx, u32 arg)
+{
+  u32 byc = sdc.reg[0x14 / 4], n = byc / 512, wr = idx == 24 || idx == 25;
+  if(!(cmd & (1 << 9)) || !(cmd & (1 << 10)) != !wr)
+    sdc_error("data command without matching transfer flags");
+  else if(byc % 512 || !n || ((idx == 17 || idx == 24) && n != 1))
+    sdc_error("byte count does not match the command");
+  else if((idx == 18 || idx == 25) && !(cmd & (1 << 12)))
+    sdc_error("multi-block command without auto stop");
+  else if(arg + n > SDC_BLKS)
+    sdc_error("block address out of range");
+  else if(sim_ns < sdc.busy_t)
+    sdc_error("data command while the card is programming");
+  else if(!(sdc.reg[0] & (1U << 31)))
+    sdc_error("FIFO not switched to the AHB");
+  else
+  {
+    data_start(wr ? 2 : 1, card + arg * 512, byc, idx == 18 || idx == 25);
+    if(wr) sdc_stat.wr_blks += n;
+    else sdc_stat.rd_blks += n;
+  }
+}
+
+static void command (u32 cmd)
+{
+  u32 idx = cmd & 63, arg = sdc.reg[0x1C / 4], app = sdc.app;
+  sdc_stat.cmds++;
+  sdc.cmd_t = sim_ns + SDC_CMD_NS;
+  if(cmd & (1 << 21)) return;         // clock update, no command on the bus
+  if(sdc.dir) sdc_error("command during a data transfer");
+  memset(sdc.resp, 0, sizeof(sdc.resp));
+  sdc.app = 0;
+  if(app && idx == 41)                // SD_SEND_OP_COND: busy a few times
+    sdc.resp[0] = sdc.acmd41 && sdc.acmd41-- ? 0x00FF8000 :
+      arg & 0x40000000 ? 0xC0FF8000 : 0x80FF8000;
+  else if(app && idx == 6) sdc.resp[0] = 0x920;
+  else if(app && idx == 13)
+  {
+    if(sdc.reg[0x14 / 4] != 64 || sdc.reg[0x10 / 4] != 64 || !(cmd & (1 << 9)))
+      sdc_error("SD status without a 64-byte data phase");
+    else data_start(1, sdc.status, 64, 0);
+    sdc.resp[0] = 0x920;
+  }
+  else switch(idx)
+  {
+    case 0:
+      sdc.rca = 0;
+      sdc.acmd41 = 3;
+      break;
+    case 8: sdc.resp[0] = arg & 0xFFF; break;
+    case 55: sdc.app = 1; sdc.resp[0] = 0x120; break;
+    case 2: sdc.resp[3] = 0x03534453; break;        // CID: SD
+    case 3: sdc.rca = 0xB368; sdc.resp[0] = sdc.rca << 16 | 0x500; break;
+    case 9:                           // CSD 2.0, C_SIZE in bits 69..48
+      sdc.resp[3] = 0x400E0032;
+      sdc.resp[2] = 0x5B590000 | ((SDC_BLKS / 1024 - 1) >> 16);
+      sdc.resp[1] = (SDC_BLKS / 1024 - 1) << 16 | 0x7F80;
+      sdc.resp[0] = 0x0A400000;
+      break;
+    case 7:
+      if(arg != sdc.rca << 16) sdc_error("SELECT_CARD with a wrong RCA");
+      sdc.resp[0] = 0x700;
+      break;
+    case 16:
+      if(arg != 512) sdc_error("block length is not 512");
+      sdc.resp[0] = 0x900;
+      break;
+    case 13:                          // SEND_STATUS: tran or prg
+      sdc.resp[0] = sim_ns < sdc.busy_t ? 0xE00 : 0x900;
+      break;
+    case 17: case 18: case 24: case 25:
+      data_cmd(cmd, idx, arg);
+      sdc.resp[0] = 0x900;
+      break;
+    default:
+      sdc_error("unknown command");
+  }
+}
+
+static u32 sdc_rd (u32 addr, int len)
+{
+  u32 sta;
+  update();
+  if(addr == REG(FIFO))
+  {
+    if(len != 4) sdc_error("FIFO read narrower than a word");
+    return fifo_pop();
+  }
+  if(addr == REG(RIS)) return sdc.ris;
+  if(addr == REG(STA))
+  {
+    sta = (fifo_empty() ? 4 : 0) | (fifo_full() ? 8 : 0);
+    if(sdc.dir == 1 && sta & 4) sdc_stat.empty++;
+    if(sta & 8) sdc_stat.full++;
+    return sta;
+  }
+  if(addr >= REG(RESP0) && addr <= REG(RESP3)) return sdc.resp[(addr - REG(RESP0)) / 4];
+  return sdc.reg[(addr - REG(GCTL)) / 4];
+}
+
+static void sdc_wr (u32 addr, int len, u32 val)
+{
+  update();
+  if(addr == REG(FIFO))
+  {
+    if(len != 4) sdc_error("FIFO write narrower than a word");
+    fifo_push(val);
+    return;
+  }
+  if(addr == REG(RIS))
+  {
+    sdc.ris &= ~val;
+    return;
+  }
+  sdc.reg[(addr - REG(GCTL)) / 4] = val;
+  if(addr == REG(CMD) && val & (1U << 31)) command(val);
+}
+
+/* Next time a status bit can change */
+static uint64_t sdc_next (void)
+{
+  uint64_t t = 0;
+  if(sdc.cmd_t) t = sdc.cmd_t;
+  if(sdc.stop_t && (!t || sdc.stop_t < t)) t = sdc.stop_t;
+  if(sdc.busy_t > sim_ns && (!t || sdc.busy_t < t)) t = sdc.busy_t;
+  if(sdc.dir == 1 && sdc.pos < sdc.words && (!t || sdc.avail < t)) t = sdc.avail;
+  if(sdc.dir == 2 && sdc.cons < sdc.pos && (!t || sdc.t[sdc.cons] < t)) t = sdc.t[sdc.cons];
+  return t;
+}
+
+static const struct REG_MODEL sdc_model = { (u32)SD0, 0x204, sdc_rd, sdc_wr, sdc_next };
+
+void sdc_init (void)
+{
+  if(!card) card = calloc(SDC_BLKS, 512);
+  memset(&sdc, 0, sizeof(sdc));
+  sdc.status[10] = 9 << 4;            // AU_SIZE: 4MB
+  sdc.ris = 1 << 30;                  // card inserted
+  reg_model(&sdc_model);
+}
+
+u8 *sdc_mem (void)
+{
+  return card;
+}
@@ -0,0 +1,27 @@
+#ifndef SDC_H
+#define SDC_H
+
+/* SD0 controller with an SDHC card behind it. Data goes through the 32-bit
+   FIFO register at the speed of a 4-bit bus at 50MHz, the card adds an
+   access latency per block and a programming time after writes. FIFO
+   accesses the STA bits do not allow are protocol errors. */
+
+#define SDC_BLKS      16384     // 8MB
+#define SDC_AU        8192      // AU_SIZE 9, 4MB
+#define SDC_FIFO      64        // words
+
+struct SDC_STAT {
+  u32 cmds;
+  u32 rd_blks;
+  u32 wr_blks;
+  u32 empty;        // STA reads with a read FIFO empty
+  u32 full;         // STA reads with a write FIFO full
+  u32 errors;       // protocol errors
+};
+
+extern struct SDC_STAT sdc_stat;
+
+void sdc_init (void);
+u8 *sdc_mem (void);
+
+#endif
@@ -0,0 +1,366 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sys.h"
+#include "reg.h"
+#include "spinor.h"
+
+#define AHB_HZ        192000000
+#define SPI_FIFO      64
+#define NDMA_WORD_PS  20000     // NDMA0: a word from the RX FIFO to DRAM
+#define NDMA_DRQ_SPI0 0x04
+#define NDMA_DRQ_SDRAM 0x11
+
+#define REG(r)        (u32)(uintptr_t)&SPI0->r
+
+enum { N_CMD, N_ADDR, N_DUMMY, N_DATA, N_BAD };
+
+struct NOR_STAT nor_stat;
+
+static u8 *mem;
+
+static struct {
+  u32 reg[0x40 / 4];        // registers as written
+  u8  tx[SPI_FIFO];
+  u32 tx_n;
+  u8  rx[SPI_FIFO];
+  u32 rx_r, rx_n;           // ring: first byte, count
+  /* burst */
+  u8  xch;
+  u8  paused;               // RX FIFO full
+  u32 pos;
+  uint64_t t;               // next byte shifted, pS
+  /* flash */
+  u8  cs;
+  u8  state, cmd, k;
+  u32 addr;
+} spi;
+
+/* NDMA0 from the SPI0 RX FIFO to DRAM */
+static struct {
+  u32 cfg, src, dst, cnt;
+  u32 done;
+  u8  stall;                // the RX DRQ does not reach NDMA0
+  uint64_t t;               // word being moved, pS
+} dma;
+
+static uint64_t now;        // pS, time of the event being handled
+
+static void nor_error (char *str)
+{
+  if(nor_stat.errors++ < 10) printf("SPI NOR model: %s\n", str);
+}
+
+#define SR(r)         spi.reg[(REG(r) & 0x3F) / 4]
+#define MBC           (SR(MBC) & 0xFFFFFF)
+#define MTC           (SR(MTC) & 0xFFFFFF)
+
+/*******************************************************************************
+                                    Flash
+*******************************************************************************/
+/* One byte clocked with the flash selected: the command, address and dummy
+   byte are taken in single mode, data goes out on MISO, or on MISO and MOSI
+   for 0x3B */
+static u8 nor_byte (u8 in, int dual)
+{
+  u8  b = 0xFF;
+  if(spi.state < N_DATA && dual)
+  {
+    nor_error("command, address or dummy byte not in single mode");
+    spi.state = N_BAD;
+  }
+  switch(spi.state)
+  {
+    case N_CMD:
+      spi.cmd = in;
+      spi.addr = spi.k = 0;
+      spi.state = N_ADDR;
+      nor_stat.cmds++;
+      if(in != 0x03 && in != 0x0B && in != 0x3B)
+      {
+        nor_error("command is not a read");
+        spi.state = N_BAD;
+      }
+      break;
+    case N_ADDR:
+      spi.addr = spi.addr << 8 | in;
+      if(++spi.k == 3) spi.state = spi.cmd == 0x03 ? N_DATA : N_DUMMY;
+      break;
+    case N_DUMMY:
+      spi.state = N_DATA;
+      break;
+    case N_DATA:
+      b = mem[spi.addr++ & (NOR_SIZE - 1)];
+      nor_stat.bytes++;
+      if(dual != (spi.cmd == 0x3B))
+      {
+        nor_error("BCC dual bit does not match the read command");
+        b ^= 0xA5;
+      }
+      break;
+  }
+  return b;
+}
+
+/*******************************************************************************
+                                    SPI0
+*******************************************************************************/
+/* Clocks per byte from the CDR2 or CDR1 divider, 8 in single mode, 4 dual */
+static uint64_t byte_ps (int dual)
+{
+  u32 hz = SR(CC) & (1 << 12) ? AHB_HZ / (2 * ((SR(CC) & 255) + 1)) : AHB_HZ >> ((SR(CC) >> 8) & 15);
+  return (dual ? 4 : 8) * 1000000000000ULL / hz;
+}
+
+static int dual_at (u32 i)
+{
+  return i >= (SR(BCC) & 0xFFFFFF) && SR(BCC) & (1 << 28);
+}
+
+static void burst_start (void)
+{
+  if(!spi.cs) nor_error("burst without the chip select");
+  if(MTC > MBC || (SR(BCC) & 0xFFFFFF) > MTC) nor_error("MTC above MBC or STC above MTC");
+  if(spi.tx_n < MTC) nor_error("TX FIFO holds fewer bytes than MTC");
+  if(!MBC) return;
+  spi.xch = 1;
+  spi.paused = 0;
+  spi.pos = 0;
+  spi.t = now + byte_ps(dual_at(0));
+}
+
+static void spi_event (void)
+{
+  u8  in = 0xFF;
+  if(spi.rx_n == SPI_FIFO)
+  {
+    if(SR(GC) & (1 << 7))
+    {
+      spi.paused = 1;                 // TP_EN: the clock stops
+      return;
+    }
+    nor_error("RX FIFO overrun");
+    spi.rx_n--;
+  }
+  if(spi.pos < MTC)
+  {
+    in = spi.tx[0];
+    memmove(spi.tx, spi.tx + 1, --spi.tx_n);
+  }
+  spi.rx[(spi.rx_r + spi.rx_n++) % SPI_FIFO] = nor_byte(in, dual_at(spi.pos));
+  if(++spi.pos == MBC)
+  {
+    spi.xch = 0;
+    if(spi.tx_n) nor_error("TX FIFO bytes left after the burst");
+  }
+  else spi.t += byte_ps(dual_at(spi.pos));
+}
+
+static u8 rx_pop (void)
+{
+  u8  b = spi.rx[spi.rx_r];
+  spi.rx_r = (spi.rx_r + 1) % SPI_FIFO;
+  spi.rx_n--;
+  if(spi.paused)
+  {
+    spi.paused = 0;
+    spi.t = now + byte_ps(dual_at(spi.pos));
+  }
+  return b;
+}
+
+/*******************************************************************************
+                                    NDMA0
+*******************************************************************************/
+/* The RX DRQ is up while the FIFO holds the trigger level */
+static int drq (void)
+{
+  return dma.cfg & (1 << 30) && !dma.stall && SR(FC) & (1 << 8) && spi.rx_n >= (SR(FC) & 255);
+}
+
+static void dma_kick (void)
+{
+  if(!dma.t && drq()) dma.t = now + NDMA_WORD_PS;
+}
+
+static void dma_event (void)
+{
+  u32 w = 0;
+  dma.t = 0;
+  if(!drq()) return;
+  if(spi.rx_n < 4)
+  {
+    nor_error("NDMA0 reads the RX FIFO below its 32-bit width");
+    dma.cfg &= ~(3U << 30);
+    return;
+  }
+  for(int i = 0; i < 4; i++) w |= rx_pop() << (i * 8);
+  memcpy((u8*)(uintptr_t)dma.dst + dma.done, &w, 4);
+  dma.done += 4;
+  nor_stat.dma_bytes += 4;
+  if(dma.done >= dma.cnt) dma.cfg &= ~(3U << 30);
+}
+
+/* A run loaded into CFG: 32-bit words from the SPI0 RX FIFO, a fixed IO
+   address, to linear DRAM in the F1C100s layout (widths at bits 8 and 24),
+   over a buffer the driver has cleaned and invalidated */
+static void dma_load (u32 v)
+{
+  u32 exp = (2 << 24) | (NDMA_DRQ_SDRAM << 16) | (2 << 8) | (1 << 5) | NDMA_DRQ_SPI0;
+  nor_stat.dma_runs++;
+  dma.done = 0;
+  dma.t = 0;
+  dma.cfg = 0;
+  if((v & 0x033F033F) != exp) nor_error("NDMA0 CFG is not a 32-bit run from the SPI0 RX FIFO to DRAM");
+  else if(dma.src != REG(RX)) nor_error("NDMA0 does not read the SPI0 RX FIFO");
+  else if(!dma.cnt || dma.cnt & 3) nor_error("NDMA0 count is not whole words");
+  else
+  {
+    if(!cache_done(dma.dst, dma.cnt, CACHE_INV)) nor_error("NDMA0 buffer without D-cache maintenance");
+    dma.cfg = v | (1U << 30);
+  }
+}
+
+/*******************************************************************************
+                                    Events
+*******************************************************************************/
+static void update (void)
+{
+  uint64_t a, b, end = sim_ns * 1000;
+  for(;;)
+  {
+    a = spi.xch && !spi.paused ? spi.t : UINT64_MAX;
+    b = dma.t ? dma.t : UINT64_MAX;
+    if((a < b ? a : b) > end) break;
+    now = a < b ? a : b;
+    if(b <= a) dma_event();
+    else spi_event();
+    dma_kick();
+  }
+  now = end;
+}
+
+/* The next byte, or the end of an NDMA0 run that keeps up with the burst:
+   a driver waits for that only */
+static uint64_t nor_next (void)
+{
+  uint64_t t = 0;
+  if(spi.xch && !spi.paused)
+  {
+    t = spi.t;
+    if(dma.cfg & (1 << 30) && !dma.stall)
+      t += (MBC - spi.pos - 1) * byte_ps(dual_at(spi.pos)) + 2 * NDMA_WORD_PS;
+  }
+  else if(dma.t) t = dma.t;
+  return (t + 999) / 1000;
+}
+
+static u32 spi_rd (u32 addr, int len)
+{
+  u32 val = 0;
+  update();
+  if(addr == REG(RX))
+  {
+    reg_moved();
+    if(dma.cfg & (1 << 30)) nor_error("CPU reads the RX FIFO during an NDMA0 run");
+    if(spi.rx_n < len)
+    {
+      nor_error("RX FIFO read past its count");
+      return 0;
+    }
+    for(int i = 0; i < len; i++) val |= rx_pop() << (i * 8);
+    dma_kick();
+    return val;
+  }
+  if(addr == REG(GC)) return SR(GC) & ~(1U << 31);
+  if(addr == REG(TC)) return (SR(TC) & ~(1U << 31)) | (spi.xch ? 1U << 31 : 0);
+  if(addr == REG(FC)) return SR(FC) & ~((1U << 31) | (1 << 15));
+  if(addr == REG(FS)) return spi.rx_n | spi.tx_n << 16;
+  if(addr - REG(GC) < 0x3C) return spi.reg[(addr - (u32)(uintptr_t)SPI0) / 4];
+  return 0;
+}
+
+static void spi_wr (u32 addr, int len, u32 val)
+{
+  u8  cs;
+  update();
+  if(addr == REG(TX))
+  {
+    reg_moved();
+    for(int i = 0; i < len; i++)
+      if(spi.tx_n < SPI_FIFO) spi.tx[spi.tx_n++] = val >> (i * 8);
+      else nor_error("TX FIFO written past its size");
+    return;
+  }
+  if(addr - REG(GC) >= 0x3C) return;
+  spi.reg[(addr - (u32)(uintptr_t)SPI0) / 4] = val;
+  if(addr == REG(GC) && val & (1U << 31))
+  {                                   // SRST: the FIFOs and the burst go
+    spi.tx_n = spi.rx_n = spi.xch = spi.paused = 0;
+    SR(GC) = val & ~(1U << 31);
+  }
+  else if(addr == REG(FC))
+  {
+    if(val & (1U << 31)) spi.tx_n = 0;
+    if(val & (1 << 15)) spi.rx_n = 0;
+  }
+  else if(addr == REG(TC))
+  {
+    cs = (val & 0xC0) == 0x40;        // SS_OWNER, SS_LEVEL low
+    if(cs != spi.cs)
+    {
+      if(spi.xch) nor_error("chip select changed during a burst");
+      spi.xch = spi.paused = 0;
+      if(!cs && spi.rx_n) nor_error("RX FIFO not drained at the end of the command");
+      spi.cs = cs;
+      spi.state = N_CMD;
+    }
+    if(val & (1U << 31) && !spi.xch) burst_start();
+  }
+  dma_kick();
+}
+
+static const struct REG_MODEL spi_model = { (u32)(uintptr_t)SPI0, 0x304, spi_rd, spi_wr, nor_next };
+
+static u32 dma_rd (u32 addr, int len)
+{
+  update();
+  if(addr == (u32)(uintptr_t)&NDMA0->CFG) return dma.cfg;
+  if(addr == (u32)(uintptr_t)&NDMA0->SRC) return dma.src;
+  if(addr == (u32)(uintptr_t)&NDMA0->DST) return dma.dst;
+  return dma.cnt;
+}
+
+static void dma_wr (u32 addr, int len, u32 val)
+{
+  update();
+  if(addr == (u32)(uintptr_t)&NDMA0->SRC) dma.src = val;
+  else if(addr == (u32)(uintptr_t)&NDMA0->DST) dma.dst = val;
+  else if(addr == (u32)(uintptr_t)&NDMA0->CNT) dma.cnt = val;
+  else if(val & (1U << 31)) dma_load(val);
+  else dma.cfg = val, dma.t = 0;
+  dma_kick();
+}
+
+/* Registered after the DMA block of musb.c, it takes NDMA0 from it */
+static const struct REG_MODEL ndma_model = { (u32)(uintptr_t)NDMA0, 0x10, dma_rd, dma_wr, NULL };
+
+void nor_init (void)
+{
+  if(!mem) mem = malloc(NOR_SIZE);
+  memset(&spi, 0, sizeof(spi));
+  memset(&dma, 0, sizeof(dma));
+  reg_model(&spi_model);
+  reg_model(&ndma_model);
+}
+
+u8 *nor_mem (void)
+{
+  return mem;
+}
+
+void nor_dma_stall (int on)
+{
+  update();
+  dma.stall = on;
+}
@@ -0,0 +1,32 @@
+#ifndef SPINOR_H
+#define SPINOR_H
+
+/* SPI0 with a 16MB SPI NOR flash behind its chip select, and NDMA0. A burst
+   shifts MBC bytes: the first MTC come from the TX FIFO, the first STC of
+   them in single mode, the rest on both lines when the BCC dual bit is set.
+   Every byte received lands in the 64-byte RX FIFO, the clock pauses while
+   it is full. The flash takes READ (0x03), FAST READ (0x0B) and DUAL OUTPUT
+   FAST READ (0x3B) with their address and dummy byte, and streams from the
+   address while the chip select stays low. NDMA0 moves words from the RX
+   FIFO while the RX DRQ is up, its FIFO level reached. Command bytes not in
+   single mode, a dual bit that does not match the command, FIFO accesses
+   beyond the counts and NDMA0 runs the F1C100s would move wrong are counted
+   as protocol errors. */
+
+#define NOR_SIZE      (16 << 20)
+
+struct NOR_STAT {
+  u32 cmds;         // read commands
+  u32 bytes;        // data bytes sent by the flash
+  u32 dma_runs;     // NDMA0 runs loaded
+  u32 dma_bytes;
+  u32 errors;       // protocol errors
+};
+
+extern struct NOR_STAT nor_stat;
+
+void nor_init (void);
+u8 *nor_mem (void);
+void nor_dma_stall (int on);        // the SPI0 RX DRQ does not reach NDMA0
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef SYS_H
+#define SYS_H
+
+/* Host build stand-in for drv/sys.h: the F1C100s register map, which reg.c
+   backs with the peripheral models, the board calls made by the SD and USB
+   host drivers, and interrupt control: IRQ_WAIT() sleeps until the next event of
+   a model and runs the interrupt handler of the test. */
+
+#include "f1c100s.h"
+#include "sd.h"
+#include "spi.h"
+
+#define ctr_us  (TIM->AVS_CNT0)
+#define ctr_ms  (TIM->AVS_CNT1)
+void delay (u32 ms);
+void udelay (u32 us);
+
+enum USB_MUX_STATE { USB_MUX_DEVICE, USB_MUX_DISABLE, USB_MUX_HOST };
+void usb_mux (enum USB_MUX_STATE i);
+
+void irq_wait (void);
+static inline void IRQ_ENABLE (void) { }
+static inline void IRQ_DISABLE (void) { }
+static inline void IRQ_WAIT (void) { irq_wait(); }
+
+#endif
@@ -0,0 +1,150 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sys.h"
+#include "ff.h"
+#include "lwip/apps/fs.h"
+#include "lwip/apps/httpd.h"
+#include "lwip/pbuf.h"
+#include "lwip/def.h"
+#include "img.h"
+#include "http.h"
+
+#define HTTP_VERIFY (1024 * 1024)
+
+/* lwIP calls made by fs_fat.c, received data comes in single pbufs */
+static u32 post_acked;
+
+u16_t pbuf_copy_partial (const struct pbuf *p, void *dst, u16_t len, u16_t offset)
+{
+  memcpy(dst, (u8*)p->payload + offset, len);
+  return len;
+}
+
+u8_t pbuf_free (struct pbuf *p)
+{
+  free(p);
+  return 1;
+}
+
+void httpd_post_data_recved (void *connection, u16_t recved_len)
+{
+  post_acked += recved_len;
+}
+
+/* GET uri with an optional "Range: bytes=" spec, the status line goes to
+   the console and the body to dst */
+int http_get (char *uri, char *range, char *dst, UINT chunk)
+{
+  struct fs_file file;
+  char hdrs[128], *buf = malloc(chunk);
+  FILE *out = NULL;
+  u32 reads = 0, body = 0, hdr = 0;
+  char *end;
+  int n;
+  if(!buf || (dst && !(out = fopen(dst, "wb")))) return 1;
+  if(range) n = snprintf(hdrs, sizeof(hdrs), "\r\nRange: bytes=%s\r\n\r\n", range);
+  else n = snprintf(hdrs, sizeof(hdrs), "\r\n\r\n");
+  fs_request_custom(hdrs, n);
+  if(!fs_open_custom(&file, uri))
+  {
+    printf("%s: not found\n", uri);
+    return 1;
+  }
+  if(!file.pextension)          // a reply kept in memory
+  {
+    printf("%.*s", file.len, file.data);
+    fs_close_custom(&file);
+    return 0;
+  }
+  while(file.index < file.len && (n = fs_read_custom(&file, buf, chunk)) > 0)
+  {
+    if(!reads++)
+    {
+      if(!(end = lwip_strnstr(buf, "\r\n\r\n", n))) break;   // chunk shorter than the header
+      hdr = end + 4 - buf;
+      printf("%.*s", (int)(lwip_strnstr(buf, "\r\n", n) + 2 - buf), buf);
+    }
+    else hdr = 0;
+    if(out) fwrite(buf + hdr, 1, n - hdr, out);
+    body += n - hdr;
+  }
+  fs_close_custom(&file);
+  if(out) fclose(out);
+  free(buf);
+  printf("Body: %u bytes in %u reads of up to %u\n", body, reads, chunk);
+  return file.index != file.len;
+}
+
+/* POST the file src to uri in TCP_MSS segments, as much as the handler
+   leaves the TCP window open. cut > 0 drops the connection after that many
+   bytes. The reply is printed and a stored file compared with src */
+int http_post (char *src, char *uri, u32 cut)
+{
+  FILE *in = fopen(src, "rb");
+  FIL fil;
+  UINT br;
+  struct fs_file file;
+  struct pbuf *p;
+  char resp[64];
+  u8_t auto_wnd = 1;
+  u8 *buf, *chk;
+  u32 len, sent = 0, win = 0;
+  uint64_t t = img_stat(0)->time;
+  int res = 0;
+  if(!in) return 1;
+  fseek(in, 0, SEEK_END);
+  len = ftell(in);
+  rewind(in);
+  buf = malloc(len + 1);
+  chk = malloc(HTTP_VERIFY);
+  if(!buf || !chk || fread(buf, 1, len, in) != len) return 1;
+  fclose(in);
+  post_acked = 0;
+  if(httpd_post_begin(&file, uri, "", 0, len, resp, sizeof(resp), &auto_wnd) == ERR_OK)
+  {
+    while(sent < len && (!cut || sent < cut))
+    {
+      if(sent - post_acked + TCP_MSS > TCP_WND)
+      {
+        printf("Window closed at %u of %u bytes\n", sent, len);
+        break;
+      }
+      p = calloc(1, sizeof(struct pbuf));
+      p->payload = buf + sent;
+      p->len = p->tot_len = (u16_t)LWIP_MIN(len - sent, TCP_MSS);
+      sent += p->tot_len;
+      win = LWIP_MAX(win, sent - post_acked);
+      if(httpd_post_receive_data(&file, p) != ERR_OK) break;
+    }
+    httpd_post_finished(&file, resp, sizeof(resp));
+    t = img_stat(0)->time - t;
+    printf("Sent: %u bytes, up to %u unacknowledged (TCP_WND %u), device time %llu.%03llums",
+      sent, win, TCP_WND, (unsigned long long)t / 1000, (unsigned long long)t % 1000);
+    if(t) printf(" %.2fMB/s", (double)sent / t);
+    printf("\n");
+  }
+  if(!fs_open_custom(&file, resp)) return 1;
+  printf("%.*s", (int)(lwip_strnstr(file.data, "\r\n", file.len) + 2 - file.data), file.data);
+  if(!strncmp(file.data + 9, "201", 3))
+  {                             // "/upload/x" is "0:/x", %xx decoded
+    char *d = resp + 2;
+    strcpy(resp, "0:");
+    for(uri += 7; *uri && d < resp + sizeof(resp) - 1; d++)
+    {
+      if(uri[0] == '%' && sscanf(uri + 1, "%2hhx", d) == 1) uri += 3;
+      else *d = *uri++;
+    }
+    *d = 0;
+    if(f_open(&fil, resp, FA_READ) != FR_OK) return 1;
+    res = f_size(&fil) != len;
+    for(sent = 0; !res && sent < len; sent += br)
+      res = f_read(&fil, chk, HTTP_VERIFY, &br) != FR_OK || !br || memcmp(chk, buf + sent, br);
+    f_close(&fil);
+    printf("Verify: %s\n", res ? "error" : "OK");
+  }
+  fs_close_custom(&file);
+  free(buf);
+  free(chk);
+  return res;
+}
@@ -0,0 +1,10 @@
+#ifndef HTTP_H
+#define HTTP_H
+
+/* The httpd file system of src/lwip/httpd (fs_fat.c) driven without TCP:
+   requests go straight to its fs hooks, chunk stands for the httpd buffer */
+
+int http_get (char *uri, char *range, char *dst, UINT chunk);
+int http_post (char *src, char *uri, u32 cut);
+
+#endif
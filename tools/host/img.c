@@ -0,0 +1,139 @@
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "sys.h"
+#include "img.h"
+
+#define IMG_NUM 2
+
+static struct {
+  u8  *map;
+  size_t size;
+  struct IMG_CFG cfg;
+  struct IMG_STAT stat;
+  struct {
+    u32 au;       // allocation unit + 1, 0 - free slot
+    u32 next;     // next sector of a sequential write
+    u32 tick;
+  } open[IMG_AU_OPEN];
+  u32 tick;
+} img[IMG_NUM];
+
+static void img_delay (u32 i, u32 lat, u32 bw, u32 len)
+{
+  uint64_t us = lat + (bw ? (uint64_t)len * 1000 / bw : 0);
+  struct timespec ts = { us / 1000000, (us % 1000000) * 1000 };
+  img[i].stat.time += us;
+  if(img[i].cfg.sleep && us) nanosleep(&ts, NULL);
+}
+
+static u32 img_erase (u32 i, u32 addr, u32 cnt)
+{
+  u32 j, k, n, gc, au = img[i].cfg.au, us = 0;
+  while(au && cnt)
+  {
+    n = au - addr % au;
+    if(n > cnt) n = cnt;
+    for(j = 0, k = 0; j < img[i].cfg.au_open; j++)
+    {
+      if(img[i].open[j].au == addr / au + 1) break;
+      if(img[i].open[j].tick < img[i].open[k].tick) k = j;
+    }
+    if(j == img[i].cfg.au_open)
+    {                           // open a new unit in place of the oldest one
+      img[i].open[j = k].au = addr / au + 1;
+      gc = 1;
+    }
+    else gc = img[i].open[j].next != addr;
+    if(gc)
+    {
+      img[i].stat.erases++;
+      us += img[i].cfg.erase;
+    }
+    img[i].open[j].next = addr + n;
+    img[i].open[j].tick = ++img[i].tick;
+    addr += n;
+    cnt -= n;
+  }
+  return us;
+}
+
+static int img_read (u32 i, void *ptr, u32 addr, u32 cnt)
+{
+  if(!img[i].map || ((uint64_t)addr + cnt) * 512 > img[i].size) return 0;
+  memcpy(ptr, img[i].map + (size_t)addr * 512, (size_t)cnt * 512);
+  img[i].stat.rd_cmds++;
+  img[i].stat.rd_bytes += cnt * 512;
+  img_delay(i, img[i].cfg.rd_lat, img[i].cfg.rd_bw, cnt * 512);
+  return cnt;
+}
+
+static int img_write (u32 i, void *ptr, u32 addr, u32 cnt)
+{
+  if(!img[i].map || ((uint64_t)addr + cnt) * 512 > img[i].size) return 0;
+  memcpy(img[i].map + (size_t)addr * 512, ptr, (size_t)cnt * 512);
+  img[i].stat.wr_cmds++;
+  img[i].stat.wr_bytes += cnt * 512;
+  img_delay(i, img[i].cfg.wr_lat + img_erase(i, addr, cnt), img[i].cfg.wr_bw, cnt * 512);
+  return cnt;
+}
+
+/* disk_init() callbacks carry no drive number, so each slot gets its own pair */
+static int img_rd0 (void *ptr, u32 addr, u32 cnt) { return img_read(0, ptr, addr, cnt); }
+static int img_wr0 (void *ptr, u32 addr, u32 cnt) { return img_write(0, ptr, addr, cnt); }
+static int img_rd1 (void *ptr, u32 addr, u32 cnt) { return img_read(1, ptr, addr, cnt); }
+static int img_wr1 (void *ptr, u32 addr, u32 cnt) { return img_write(1, ptr, addr, cnt); }
+
+int img_open (u8 pdrv, const char *path, const struct IMG_CFG *cfg)
+{
+  int fd;
+  struct stat st;
+  if(pdrv >= IMG_NUM) return KO;
+  img_close(pdrv);
+  if((fd = open(path, O_RDWR)) < 0) return KO;
+  if(fstat(fd, &st) || st.st_size < 512)
+  {
+    close(fd);
+    return KO;
+  }
+  img[pdrv].map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if(img[pdrv].map == MAP_FAILED)
+  {
+    img[pdrv].map = NULL;
+    return KO;
+  }
+  img[pdrv].size = st.st_size;
+  memset(&img[pdrv].cfg, 0, sizeof(img[pdrv].cfg));
+  if(cfg) img[pdrv].cfg = *cfg;
+  if(img[pdrv].cfg.au_open < 1) img[pdrv].cfg.au_open = 1;
+  if(img[pdrv].cfg.au_open > IMG_AU_OPEN) img[pdrv].cfg.au_open = IMG_AU_OPEN;
+  memset(&img[pdrv].stat, 0, sizeof(img[pdrv].stat));
+  memset(&img[pdrv].open, 0, sizeof(img[pdrv].open));
+  if(pdrv == 0) disk_init(0, &img_rd0, &img_wr0);
+  else disk_init(1, &img_rd1, &img_wr1);
+  return OK;
+}
+
+void img_close (u8 pdrv)
+{
+  if(pdrv >= IMG_NUM || !img[pdrv].map) return;
+  msync(img[pdrv].map, img[pdrv].size, MS_SYNC);
+  munmap(img[pdrv].map, img[pdrv].size);
+  img[pdrv].map = NULL;
+  img[pdrv].size = 0;
+}
+
+u32 img_sectors (u8 pdrv)
+{
+  return pdrv < IMG_NUM ? img[pdrv].size / 512 : 0;
+}
+
+struct IMG_STAT *img_stat (u8 pdrv)
+{
+  return pdrv < IMG_NUM ? &img[pdrv].stat : NULL;
+}
@@ -0,0 +1,35 @@
+#ifndef IMG_H
+#define IMG_H
+
+#define IMG_AU_OPEN 8
+
+/* SD-card timing model: every command costs a fixed latency plus the time
+   to move its data at the given bandwidth. Writes also pay an erase cost
+   each time they open an allocation unit the card does not keep open or
+   leave the sequential order inside an open one. */
+struct IMG_CFG {
+  u32 rd_lat;     // read command latency (us)
+  u32 wr_lat;     // write command latency (us)
+  u32 rd_bw;      // read bandwidth (kB/s), 0 - unlimited
+  u32 wr_bw;      // write bandwidth (kB/s), 0 - unlimited
+  u32 au;         // allocation unit (sectors), 0 - no erase cost
+  u32 au_open;    // allocation units kept open (1..IMG_AU_OPEN)
+  u32 erase;      // allocation unit erase/rewrite cost (us)
+  u32 sleep : 1;  // really wait for the modelled time, otherwise only account it
+};
+
+struct IMG_STAT {
+  u32 rd_cmds;
+  u32 wr_cmds;
+  uint64_t rd_bytes;
+  uint64_t wr_bytes;
+  u32 erases;
+  uint64_t time;  // modelled device time (us)
+};
+
+int img_open (u8 pdrv, const char *path, const struct IMG_CFG *cfg);
+void img_close (u8 pdrv);
+u32 img_sectors (u8 pdrv);
+struct IMG_STAT *img_stat (u8 pdrv);
+
+#endif
@@ -0,0 +1,366 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "sys.h"
+#include "ff.h"
+#include "diskio.h"
+#include "clmt.h"
+#include "img.h"
+#include "bench.h"
+#include "lz4.h"
+#include "sdboot.h"
+#include "http.h"
+
+static FATFS fs;
+static struct IMG_CFG cfg = { .au_open = 2 };
+
+static uint64_t wall_us (void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void print_rate (char *str, uint64_t bytes, uint64_t us)
+{
+  printf("%s: %llu bytes %llu.%03llums", str, (unsigned long long)bytes,
+    (unsigned long long)us / 1000, (unsigned long long)us % 1000);
+  if(us) printf(" %.2fMB/s", (double)bytes / us);
+  printf("\n");
+}
+
+static void print_stat (void)
+{
+  struct IMG_STAT *st = img_stat(0);
+  printf("Device: %u reads (%llu bytes), %u writes (%llu bytes), %u erases\n",
+    st->rd_cmds, (unsigned long long)st->rd_bytes,
+    st->wr_cmds, (unsigned long long)st->wr_bytes, st->erases);
+  print_rate("Device time", st->rd_bytes + st->wr_bytes, st->time);
+}
+
+static int cmd_ls (char *path)
+{
+  DIR dir;
+  FILINFO fno;
+  if(f_opendir(&dir, path) != FR_OK) return 1;
+  while(f_readdir(&dir, &fno) == FR_OK && fno.fname[0])
+    printf("%10llu %c %s\n", (unsigned long long)fno.fsize,
+      fno.fattrib & AM_DIR ? 'd' : '-', fno.fname);
+  f_closedir(&dir);
+  return 0;
+}
+
+static int cmd_get (char *src, char *dst, UINT chunk)
+{
+  FIL fil;
+  FILE *out = NULL;
+  UINT res;
+  uint64_t total = 0, t;
+  u8  *buf = malloc(chunk);
+  if(!buf || f_open(&fil, src, FA_READ) != FR_OK) return 1;
+  if(dst && !(out = fopen(dst, "wb"))) return 1;
+  t = wall_us();
+  while(f_read(&fil, buf, chunk, &res) == FR_OK && res)
+  {
+    if(out) fwrite(buf, 1, res, out);
+    total += res;
+  }
+  t = wall_us() - t;
+  f_close(&fil);
+  if(out) fclose(out);
+  free(buf);
+  print_rate("Read", total, t);
+  return 0;
+}
+
+static int cmd_put (char *src, char *dst, UINT chunk)
+{
+  FIL fil;
+  FILE *in;
+  UINT res;
+  size_t len;
+  uint64_t total = 0, t;
+  u8  *buf = malloc(chunk);
+  if(!buf || !(in = fopen(src, "rb"))) return 1;
+  if(f_open(&fil, dst, FA_CREATE_ALWAYS | FA_WRITE) != FR_OK) return 1;
+  t = wall_us();
+  while((len = fread(buf, 1, chunk, in)) > 0)
+  {
+    if(f_write(&fil, buf, len, &res) != FR_OK || res != len) break;
+    total += res;
+  }
+  f_close(&fil);
+  t = wall_us() - t;
+  fclose(in);
+  free(buf);
+  print_rate("Write", total, t);
+  return 0;
+}
+
+static int cmd_mkfs (u32 au)
+{
+  static BYTE work[65536];
+  MKFS_PARM opt = { FM_ANY };
+  FRESULT res;
+  if(au)
+  {                           // SD layout aligned to the allocation unit
+    disk_geometry(0, img_sectors(0), au * 2);
+    res = disk_mkfs(0, work, sizeof(work));
+  }
+  else
+  {                           // FatFs defaults: partition at sector 63, no alignment
+    disk_geometry(0, img_sectors(0), 1);
+    res = f_mkfs("0:", &opt, work, sizeof(work));
+  }
+  printf("Format (AU %ukB): %s\n", au, res == FR_OK ? "OK" : "error");
+  return res != FR_OK;
+}
+
+static int cmd_wbench (char *name, u32 mb, UINT chunk)
+{
+  FIL fil;
+  UINT i, n, res;
+  struct IMG_STAT *st = img_stat(0), s0;
+  u8  *buf = malloc(chunk < 4096 ? 4096 : chunk);
+  if(!buf || !mb) return 1;
+  memset(buf, 0x55, chunk < 4096 ? 4096 : chunk);
+  if(f_open(&fil, name, FA_CREATE_ALWAYS | FA_WRITE) != FR_OK) return 1;
+  s0 = *st;
+  for(i = 0, n = ((uint64_t)mb << 20) / chunk; i < n; i++)
+    if(f_write(&fil, buf, chunk, &res) != FR_OK || res != chunk) break;
+  f_sync(&fil);
+  print_rate("Sequential write", (uint64_t)i * chunk, st->time - s0.time);
+  printf("  %u erases\n", st->erases - s0.erases);
+  s0 = *st;
+  srand(1);
+  for(i = 0, n = ((uint64_t)mb << 20) / 4096; i < 1024; i++)
+  {
+    f_lseek(&fil, (FSIZE_t)(rand() % n) * 4096);
+    if(f_write(&fil, buf, 4096, &res) != FR_OK || res != 4096) break;
+  }
+  f_sync(&fil);
+  print_rate("Random 4K write", (uint64_t)i * 4096, st->time - s0.time);
+  printf("  %u erases, %.1f IOPS\n", st->erases - s0.erases,
+    st->time > s0.time ? i * 1e6 / (st->time - s0.time) : 0);
+  f_close(&fil);
+  free(buf);
+  return 0;
+}
+
+static int cmd_frag (char *name, u32 mb, u32 frags)
+{
+  FIL fil, tmp;
+  UINT i, res, piece, clst = fs.csize * 512;
+  u8  *buf;
+  if(!mb || !frags) return 1;
+  piece = (((uint64_t)mb << 20) / frags + clst - 1) / clst * clst;
+  if(!(buf = calloc(1, piece))) return 1;
+  if(f_open(&fil, name, FA_CREATE_ALWAYS | FA_WRITE) != FR_OK) return 1;
+  if(f_open(&tmp, "0:/frag.tmp", FA_CREATE_ALWAYS | FA_WRITE) != FR_OK) return 1;
+  for(i = 0; i < frags; i++)
+  {                           // one cluster of filler between the pieces
+    if(f_write(&fil, buf, piece, &res) != FR_OK || res != piece) break;
+    if(f_write(&tmp, buf, clst, &res) != FR_OK || res != clst) break;
+  }
+  f_close(&tmp);
+  f_close(&fil);
+  f_unlink("0:/frag.tmp");
+  clmt_flush();
+  printf("Written: %s %u fragments of %u bytes\n", name, i, piece);
+  free(buf);
+  return i != frags;
+}
+
+static int cmd_sbench (char *name, u32 num)
+{
+  FIL fil;
+  UINT i, j, res;
+  u8  buf[512];
+  struct IMG_STAT *st = img_stat(0), s0;
+  for(j = 0; j < 2; j++)
+  {
+    s0 = *st;
+    if((j ? clmt_open(&fil, name, FA_READ) : f_open(&fil, name, FA_READ)) != FR_OK) return 1;
+    if(j)
+    {
+      if(!fil.cltbl) puts("Fast seek: no link map");
+      else printf("Link map: %u fragments, %u reads %llu.%03llums\n", (fil.cltbl[0] - 2) / 2,
+        st->rd_cmds - s0.rd_cmds, (unsigned long long)(st->time - s0.time) / 1000,
+        (unsigned long long)(st->time - s0.time) % 1000);
+    }
+    s0 = *st;
+    srand(1);
+    for(i = 0; i < num && f_size(&fil); i++)
+    {
+      f_lseek(&fil, (FSIZE_t)rand() * 512 % f_size(&fil));
+      if(f_read(&fil, buf, sizeof(buf), &res) != FR_OK) break;
+    }
+    printf("%s: %u seeks, %.2f reads/seek, %.1fus/seek\n", j ? "Fast seek" : "FAT walk", i,
+      i ? (double)(st->rd_cmds - s0.rd_cmds) / i : 0, i ? (double)(st->time - s0.time) / i : 0);
+    if(j) clmt_close(&fil);
+    else f_close(&fil);
+  }
+  return 0;
+}
+
+static int bench_rd (void *ptr, u32 addr, u32 cnt)
+{
+  return disk_read(0, ptr, addr, cnt) == RES_OK ? cnt : 0;
+}
+
+static int bench_wr (void *ptr, u32 addr, u32 cnt)
+{
+  return disk_write(0, ptr, addr, cnt) == RES_OK ? cnt : 0;
+}
+
+static u32 bench_us (void)
+{                             // modelled device time unless it is really slept
+  return cfg.sleep ? wall_us() : img_stat(0)->time;
+}
+
+static int cmd_bench (void)
+{
+  static u8 buf[BENCH_BLKS * 512];
+  struct BENCH b = { &bench_rd, &bench_wr, &bench_us, buf };
+  return bench_run(&b, "0:/bench.bin") != OK;
+}
+
+static int sd_rd (void *ptr, u32 addr, u32 cnt)
+{
+  return disk_read(0, ptr, addr, cnt) == RES_OK ? cnt : 0;
+}
+
+/* Raw boot image between the SPL and the first partition */
+static int cmd_sdraw (char *src)
+{
+  static u8 buf[512];
+  FILE *f = fopen(src, "rb");
+  u32 lba, part;
+  size_t n;
+  if(!f || disk_read(0, buf, 0, 1) != RES_OK) return 1;
+  part = buf[0] == 0xEB || buf[0] == 0xE9 ? 0 : buf[454] | buf[455] << 8 | buf[456] << 16 | buf[457] << 24;
+  for(lba = SDBOOT_LBA; (n = fread(memset(buf, 0, 512), 1, 512, f)) > 0; lba++)
+    if(lba >= part || disk_write(0, buf, lba, 1) != RES_OK) break;
+  fclose(f);
+  if(n) printf("Image does not fit below the partition at sector %u\n", part);
+  else printf("Raw image: sectors %u..%u\n", SDBOOT_LBA, lba - 1);
+  return n != 0;
+}
+
+/* Loads the boot image the way the SPL does (drv/boot.c) and checks it */
+static int cmd_sdboot (void)
+{
+  static u8 sec[1024];
+  struct SDBOOT b = { &sd_rd, sec };
+  struct IMG_STAT *st = img_stat(0);
+  uint64_t t = st->time;
+  struct LZ4_IMG hdr;
+  u32 size, res = KO;
+  u8 *buf = malloc(64 << 20), *app = malloc(64 << 20);
+  if(!buf || !app || sdboot_open(&b) != OK || sdboot_read(&b, buf, 1) != OK) return 1;
+  memcpy(&hdr, buf, sizeof(hdr));
+  if(hdr.magic == LZ4_IMG_MAGIC)
+  {
+    size = sizeof(hdr) + hdr.size;
+    if(hdr.size < (48 << 20) && hdr.raw < (64 << 20) && (!b.size || b.size >= size) &&
+      sdboot_read(&b, buf + 512, (size - 1) / 512) == OK &&
+      lz4_decode(buf + sizeof(hdr), hdr.size, app, hdr.raw) == hdr.raw &&
+      lz4_crc(app, hdr.raw) == hdr.crc) res = OK;
+  }
+  else
+  {
+    size = ((u32*)buf)[5];
+    if((buf[3] == 0xEA) && size && size < (48 << 20) && (!b.size || b.size >= size) &&
+      sdboot_read(&b, buf + 512, (size - 1) / 512) == OK) res = OK;
+  }
+  printf("%s: %s, %u bytes, %u reads, %u blocks\n", b.csize ? "APP.IMG" : "Raw image",
+    res == OK ? "OK" : "not valid", size, b.cmds, b.blks);
+  print_rate("Load", size, st->time - t);
+  free(buf);
+  free(app);
+  return res != OK;
+}
+
+static void usage (void)
+{
+  puts("Usage: fatimg [options] image command [args]\n"
+       "Options:\n"
+       "  -l us     read/write command latency\n"
+       "  -b kB/s   read/write bandwidth\n"
+       "  -c bytes  transfer chunk size (default 32768)\n"
+       "  -a kB     allocation unit of the erase model\n"
+       "  -o num    allocation units kept open by the card (default 2)\n"
+       "  -e us     allocation unit erase cost\n"
+       "  -s        sleep for the modelled device time\n"
+       "Commands:\n"
+       "  mkfs [au_kB]      format (default 4096, 0 - FatFs layout without alignment)\n"
+       "  ls [dir]\n"
+       "  mkdir dir\n"
+       "  get file [dst]\n"
+       "  put src file\n"
+       "  wbench file MB    sequential and random 4K write speed\n"
+       "  frag file MB num  write a file split into num fragments\n"
+       "  sbench file [num] random seek latency with and without fast seek\n"
+       "  bench             storage benchmark (src/bench/storage)\n"
+       "  sdraw file        write a raw boot image behind the SPL\n"
+       "  sdboot            load the boot image the way the SPL does\n"
+       "  httpget uri [range] [dst]  GET through the httpd file system (0:/www)\n"
+       "  upload src uri [cut]       POST src to uri (/upload/x writes 0:/x)");
+  exit(1);
+}
+
+int main (int argc, char *argv[])
+{
+  int c, res = 1;
+  UINT chunk = 32768;
+  while((c = getopt(argc, argv, "l:b:c:a:o:e:s")) != -1)
+  {
+    if(c == 'l') cfg.rd_lat = cfg.wr_lat = atoi(optarg);
+    else if(c == 'b') cfg.rd_bw = cfg.wr_bw = atoi(optarg);
+    else if(c == 'c') chunk = atoi(optarg);
+    else if(c == 'a') cfg.au = atoi(optarg) * 2;
+    else if(c == 'o') cfg.au_open = atoi(optarg);
+    else if(c == 'e') cfg.erase = atoi(optarg);
+    else if(c == 's') cfg.sleep = 1;
+    else usage();
+  }
+  if(argc - optind < 2 || !chunk) usage();
+  if(img_open(0, argv[optind], &cfg) != OK)
+  {
+    printf("%s: can't open image\n", argv[optind]);
+    return 1;
+  }
+  if(!strcmp(argv[optind + 1], "mkfs"))
+    res = cmd_mkfs(argc - optind > 2 ? atoi(argv[optind + 2]) : 4096);
+  else if(f_mount(&fs, "0:", 1) != FR_OK) puts("Mount: error");
+  else
+  {
+    printf("Mount: %s, %u sectors\n", fs.fs_type == FS_FAT12 ? "FAT12" :
+      fs.fs_type == FS_FAT16 ? "FAT16" : fs.fs_type == FS_FAT32 ? "FAT32" :
+      "exFAT", img_sectors(0));
+    argv += optind + 1;
+    argc -= optind + 1;
+    if(!strcmp(argv[0], "ls")) res = cmd_ls(argc > 1 ? argv[1] : "");
+    else if(!strcmp(argv[0], "mkdir") && argc > 1) res = f_mkdir(argv[1]) != FR_OK;
+    else if(!strcmp(argv[0], "get") && argc > 1) res = cmd_get(argv[1], argc > 2 ? argv[2] : NULL, chunk);
+    else if(!strcmp(argv[0], "put") && argc > 2) res = cmd_put(argv[1], argv[2], chunk);
+    else if(!strcmp(argv[0], "wbench") && argc > 2) res = cmd_wbench(argv[1], atoi(argv[2]), chunk);
+    else if(!strcmp(argv[0], "frag") && argc > 3) res = cmd_frag(argv[1], atoi(argv[2]), atoi(argv[3]));
+    else if(!strcmp(argv[0], "bench")) res = cmd_bench();
+    else if(!strcmp(argv[0], "sdraw") && argc > 1) res = cmd_sdraw(argv[1]);
+    else if(!strcmp(argv[0], "sdboot")) res = cmd_sdboot();
+    else if(!strcmp(argv[0], "httpget") && argc > 1)
+      res = http_get(argv[1], argc > 2 && strcmp(argv[2], "-") ? argv[2] : NULL, argc > 3 ? argv[3] : NULL, chunk);
+    else if(!strcmp(argv[0], "upload") && argc > 2)
+      res = http_post(argv[1], argv[2], argc > 3 ? atoi(argv[3]) : 0);
+    else if(!strcmp(argv[0], "sbench") && argc > 1) res = cmd_sbench(argv[1], argc > 2 ? atoi(argv[2]) : 1000);
+    else usage();
+    if(res) puts("Error");
+    print_stat();
+    f_mount(NULL, "0:", 0);
+  }
+  img_close(0);
+  return res;
+}
@@ -0,0 +1,25 @@
+#ifndef SYS_H
+#define SYS_H
+
+/* Host build stand-in for drv/sys.h: only the types and the disk glue needed
+   by lib/fatfs and the host-side tools. */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define u8  uint8_t
+#define u16 uint16_t
+#define u32 uint32_t
+#define s8  int8_t
+#define s16 int16_t
+#define s32 int32_t
+
+#define OK 0
+#define KO ~OK
+
+void disk_init ( u8 pdrv, int (*cbrd) (void *ptr, u32 addr, u32 cnt),
+  int (*cbwr) (void *ptr, u32 addr, u32 cnt));
+void disk_geometry (u8 pdrv, u32 cnt, u32 blk);
+void disk_sync (u8 pdrv, int (*cbsync) (void));
+
+#endif
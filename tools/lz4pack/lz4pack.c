@@ -0,0 +1,97 @@
+/* Packs an application image into the LZ4 boot format (drv/lz4.h) and
+   checks that drv/lz4.c restores it bit-exactly. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sys.h"
+#include "lz4.h"
+
+#define HASH_BITS 16
+
+static u32 read32 (const u8 *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((u32)p[3] << 24);
+}
+
+static u8 *put_len (u8 *op, u32 len)
+{
+  for(; len >= 255; len -= 255) *op++ = 255;
+  *op++ = len;
+  return op;
+}
+
+static u8 *put_seq (u8 *op, const u8 *lit, u32 nlit, u32 mlen, u32 ofs)
+{
+  u8 *tok = op++;
+  *tok = (nlit < 15 ? nlit : 15) << 4;
+  if(nlit >= 15) op = put_len(op, nlit - 15);
+  memcpy(op, lit, nlit);
+  op += nlit;
+  if(!mlen) return op;                // last literals
+  *op++ = ofs;
+  *op++ = ofs >> 8;
+  mlen -= 4;
+  *tok |= mlen < 15 ? mlen : 15;
+  if(mlen >= 15) op = put_len(op, mlen - 15);
+  return op;
+}
+
+/* Greedy LZ4 block compressor. The format requires the last match to
+   start 12 bytes before the end and the last 5 bytes to be literals. */
+static u32 lz4_encode (const u8 *src, u32 n, u8 *dst)
+{
+  static u32 tab[1 << HASH_BITS];
+  u32 ip = 0, anchor = 0, ref, h, ml;
+  u8 *op = dst;
+  memset(tab, 0, sizeof(tab));
+  while(n >= 13 && ip <= n - 13)
+  {
+    h = (read32(src + ip) * 2654435761U) >> (32 - HASH_BITS);
+    ref = tab[h];
+    tab[h] = ip + 1;
+    if(!ref-- || ip - ref > 65535 || read32(src + ref) != read32(src + ip))
+    {
+      ip++;
+      continue;
+    }
+    for(ml = 4; ip + ml < n - 5 && src[ref + ml] == src[ip + ml]; ml++);
+    op = put_seq(op, src + anchor, ip - anchor, ml, ip - ref);
+    ip += ml;
+    anchor = ip;
+  }
+  op = put_seq(op, src + anchor, n - anchor, 0, 0);
+  return op - dst;
+}
+
+int main (int argc, char *argv[])
+{
+  struct LZ4_IMG hdr = { LZ4_IMG_MAGIC };
+  FILE *f;
+  u8 *raw, *lz, *chk;
+  long n;
+  if(argc != 3)
+  {
+    puts("Usage: lz4pack image.bin image.lz4");
+    return 1;
+  }
+  if(!(f = fopen(argv[1], "rb"))) return printf("%s: can't open\n", argv[1]), 1;
+  fseek(f, 0, SEEK_END);
+  n = ftell(f);
+  rewind(f);
+  raw = malloc(n + 1);
+  lz = malloc(n + n / 255 + 16);
+  chk = malloc(n + 1);
+  if(!raw || !lz || !chk || fread(raw, 1, n, f) != n) return puts("Read error"), 1;
+  fclose(f);
+  hdr.raw = n;
+  hdr.crc = lz4_crc(raw, n);
+  hdr.size = lz4_encode(raw, n, lz);
+  if(lz4_decode(lz, hdr.size, chk, n) != n || memcmp(raw, chk, n) ||
+    lz4_crc(chk, n) != hdr.crc) return puts("Round-trip check failed"), 1;
+  if(!(f = fopen(argv[2], "wb")) || fwrite(&hdr, sizeof(hdr), 1, f) != 1 ||
+    fwrite(lz, 1, hdr.size, f) != hdr.size) return printf("%s: write error\n", argv[2]), 1;
+  fclose(f);
+  printf("%s: %u -> %u bytes (%u%%)\n", argv[2], hdr.raw, hdr.size + (u32)sizeof(hdr),
+    (hdr.size + (u32)sizeof(hdr)) * 100 / (hdr.raw ? hdr.raw : 1));
+  return 0;
+}